@@ -23,9 +23,11 @@
 #pragma once
 
 #include <stores/generic_library.h>
+#include <stores/Steam/keyvalues.h>
 //#include <stores/Steam/steam_library.h>
 
 #include <map>
+#include <memory>
 #include <string>
 #include <strsafe.h>
 #include <assert.h>
@@ -83,9 +85,79 @@ private:
 };
 
 
+// Owns an object that is only allocated on first access, and is deep-copied along with its owner
+template <class _Tp>
+class app_record_cold_s
+{
+public:
+  app_record_cold_s (void) = default;
+  app_record_cold_s (const app_record_cold_s& other) : _ptr ((other._ptr) ? std::make_unique <_Tp> (*other._ptr) : nullptr) { }
+  app_record_cold_s (app_record_cold_s&&) noexcept = default;
+
+  app_record_cold_s& operator= (const app_record_cold_s& other)
+  {
+    if (this != &other)
+      _ptr = (other._ptr) ? std::make_unique <_Tp> (*other._ptr) : nullptr;
+
+    return *this;
+  }
+
+  app_record_cold_s& operator= (app_record_cold_s&&) noexcept = default;
+
+  _Tp* operator-> (void)
+  {
+    if (! _ptr)
+      _ptr = std::make_unique <_Tp> ();
+
+    return _ptr.get ();
+  }
+
+  // Reads through a const record never allocate, and see a shared default object instead
+  const _Tp* operator-> (void) const
+  {
+    static const _Tp empty { };
+
+    return (_ptr) ? _ptr.get () : &empty;
+  }
+
+  _Tp&       operator*  (void)       { return *operator-> (); }
+  const _Tp& operator*  (void) const { return *operator-> (); }
+  bool       allocated  (void) const { return _ptr != nullptr; }
+
+private:
+  std::unique_ptr <_Tp> _ptr;
+};
+
 struct app_record_s {
   app_record_s (uint32_t id_) : id (id_) { };
 
+  enum class Store {
+    Steam       = 0x1,   // Initial commit
+    GOG         = 0x2,   // Sep 17, 2021
+    Custom      = 0x3,   // Oct  2, 2021 - SKIF custom games
+    Epic        = 0x4,   // Dec 27, 2021
+    Xbox        = 0x5,   // Mar  6, 2022
+    Unspecified = 0xffff
+  };
+
+  enum class Platform {
+    Unknown = 0x0,
+    Windows = 0x1,
+    Linux   = 0x2,
+    Mac     = 0x4,
+    All     = 0xffff
+  };
+
+  // The members used when iterating over the library (list, running state refresh, sorting)
+  //   come first, to keep them on the same few cache lines of each record
+
+  uint32_t     id;
+  bool         processed             =  false; // indicates if we have processed appinfo
+  bool         loading               =  false; // indicates if we are processing in a background thread
+  bool         filtered              =  false; // indicates if the app has been filtered out (used for search; not the same as the skif.hidden state!)
+  bool         cloud_enabled         =   true; // hidecloudui=false
+  Store        store                 =  Store::Unspecified;
+
   struct client_state_s {
     bool refresh    (app_record_s *pApp);
 
@@ -104,6 +176,23 @@ struct app_record_s {
     void invalidate (void) { dwTimeLastChecked = 0; }
   } _status, _staging;
 
+  std::string  ImGuiPushID           =  "";
+  std::string  ImGuiLabelID          =  "";
+
+  // Struct used to hold custom SKIF metadata about the game
+  struct custom_metadata_s {
+    std::string        name;
+    int            cpu_type =  0; // 0 = Common,             1 = x86,                 2 = x64,                0xFFFF = Any
+    int        instant_play =  0; // 0 = use global default, 1 = always instant play, 2 = never instant play
+    int           auto_stop =  0; // 0 = use global default, 1 = stop on injection,   2 = stop on game exit,  3 = never stop
+    int                uses =  0; // Number of times game has been launched
+    std::string        used = ""; // Unix timestamp (in string) of when the game was last used
+    std::string        used_formatted = ""; // Friendly human-readable representation of the Unix timestamp
+    std::string    category = ""; // Category to sort the game under
+    int              hidden = -1; // Is app hidden?    (-1 = unset;   0 = no;   1 = yes)
+    int              pinned = -1; // Is app favorited? (-1 = unset;   0 = no;   1 = yes;   51 = yes (on top);   99 = Special K)
+  } skif;
+
   struct names_s {
     std::string all_upper;
     std::string all_upper_alnum;
@@ -122,23 +211,6 @@ struct app_record_s {
     HANDLE          hWorker     = NULL;
   } tex_icon, tex_cover;
   
-  enum class Store {
-    Steam       = 0x1,   // Initial commit
-    GOG         = 0x2,   // Sep 17, 2021
-    Custom      = 0x3,   // Oct  2, 2021 - SKIF custom games
-    Epic        = 0x4,   // Dec 27, 2021
-    Xbox        = 0x5,   // Mar  6, 2022
-    Unspecified = 0xffff
-  };
-
-  enum class Platform {
-    Unknown = 0x0,
-    Windows = 0x1,
-    Linux   = 0x2,
-    Mac     = 0x4,
-    All     = 0xffff
-  };
-
   enum class CPUType {
     Common = 0x0, // Check the common config if encountered
     x86    = 0x1,
@@ -246,7 +318,7 @@ struct app_record_s {
       std::string developer;
       std::string homepage;
     } dev;
-  } extended_config;
+  };
 
   struct launch_config_s {
 
@@ -383,64 +455,59 @@ struct app_record_s {
   using branch_t =
     std::pair <std::string, branch_record_s>;
 
-  // This struct holds the cache for the right click context menu
-  struct {
-    int                                   numSecondaryLaunchConfigs = 0; // Secondary launch options
-  //bool                                  profileFolderExists       = false; // 2024-03-04: Not actually used any longer
-    bool                                  screenshotsFolderExists   = false;
-    std::wstring                          wsScreenshotDir           = L"";
-    std::vector   <CloudPath>             cloud_paths;   // Steam Auto-Cloud
-    std::multimap <int64_t, branch_t>     branches;      // Steam Branches
+  // Data that is only needed once an app has been selected (or its context menu opened),
+  //   allocated on first use and kept out of line so iterating over the library skips it
+  struct details_s {
+    extended_config_s                           extended_config;
+    std::map <std::string, branch_record_s    > branches;
+    std::map <int,         cloud_save_record_s> cloud_saves;
+    SK_Steam_KeyValueTree                       manifest;    // Steam; parsed once, see SK_GetManifestForAppID
+    std::set <std::string>                      screenshots; // Special K; utf8 path
+
+    // This struct holds the cache for the right click context menu
+    struct {
+      int                                   numSecondaryLaunchConfigs = 0; // Secondary launch options
+    //bool                                  profileFolderExists       = false; // 2024-03-04: Not actually used any longer
+      bool                                  screenshotsFolderExists   = false;
+      std::wstring                          wsScreenshotDir           = L"";
+      std::vector   <CloudPath>             cloud_paths;   // Steam Auto-Cloud
+      std::multimap <int64_t, branch_t>     branches;      // Steam Branches
 
-    // PCGamingWiki
-    std:: string pcgw;
+      // PCGamingWiki
+      std:: string pcgw;
 
-    // SteamGridDB
-    std:: string sgdbGrids;
-    std:: string sgdbIcons;
+      // SteamGridDB
+      std:: string sgdbGrids;
+      std:: string sgdbIcons;
 
-    std:: string label_version; // type_version
-  } ui;
+      std:: string label_version; // type_version
+    } ui;
+
+    struct {
+      std::wstring AppDetails      = L"";
+      std:: string AppDetails_utf8 =  "";
+      std::wstring IStoreBrowseService_GetItems1      = L"";
+      std:: string IStoreBrowseService_GetItems1_utf8 =  "";
+      std::wstring ISteamUserStats_GetNumberOfCurrentPlayers1      = L"";
+      std:: string ISteamUserStats_GetNumberOfCurrentPlayers1_utf8 =  "";
+    } urls; // Steam; used by the Developer menu
+  };
+
+  app_record_cold_s <details_s> details;
 
   struct specialk_config_s {
     std::wstring           profile_dir;
     std:: string           profile_dir_utf8;
-    std::set <std::string> screenshots; // utf8 path
     sk_install_state_s     injection;
   } specialk;
   
-  std::map <std::string, branch_record_s    > branches;
-  std::map <int,         cloud_save_record_s> cloud_saves;
   std::map <int,         launch_config_s    > launch_configs;
   std::map <int,         launch_config_s    > launch_configs_custom; // Workaround for Steam games parsing original launch configs on selection
   common_config_s                             common_config;
   
-  uint32_t     id;
-  bool         processed             =  false; // indicates if we have processed appinfo
-  bool         loading               =  false; // indicates if we are processing in a background thread
-  bool         filtered              =  false; // indicates if the app has been filtered out (used for search; not the same as the skif.hidden state!)
-  bool         cloud_enabled         =   true; // hidecloudui=false
   std::wstring install_dir; // Should NOT be backslash-terminated
-  Store        store                 =  Store::Unspecified;
   std::string  store_utf8            =  "";
 
-  std::string  ImGuiPushID           =  "";
-  std::string  ImGuiLabelID          =  "";
-
-  // Struct used to hold custom SKIF metadata about the game
-  struct custom_metadata_s {
-    std::string        name;
-    int            cpu_type =  0; // 0 = Common,             1 = x86,                 2 = x64,                0xFFFF = Any
-    int        instant_play =  0; // 0 = use global default, 1 = always instant play, 2 = never instant play
-    int           auto_stop =  0; // 0 = use global default, 1 = stop on injection,   2 = stop on game exit,  3 = never stop
-    int                uses =  0; // Number of times game has been launched
-    std::string        used = ""; // Unix timestamp (in string) of when the game was last used
-    std::string        used_formatted = ""; // Friendly human-readable representation of the Unix timestamp
-    std::string    category = ""; // Category to sort the game under
-    int              hidden = -1; // Is app hidden?    (-1 = unset;   0 = no;   1 = yes)
-    int              pinned = -1; // Is app favorited? (-1 = unset;   0 = no;   1 = yes;   51 = yes (on top);   99 = Special K)
-  } skif;
-
   struct {
     struct {
       std::string launch_option        = ""; // Holds the custom launch option set in the Steam client
@@ -453,17 +520,7 @@ struct app_record_s {
       std::vector <std::string> tags; // ???
     } shared; // roaming
 
-    struct {
-      std::wstring AppDetails      = L"";
-      std:: string AppDetails_utf8 =  "";
-      std::wstring IStoreBrowseService_GetItems1      = L"";
-      std:: string IStoreBrowseService_GetItems1_utf8 =  "";
-      std::wstring ISteamUserStats_GetNumberOfCurrentPlayers1      = L"";
-      std:: string ISteamUserStats_GetNumberOfCurrentPlayers1_utf8 =  "";
-    } urls; // Used by the Developer menu
-
-    std::string  manifest_data    =  "";
-    std::wstring manifest_path    = L"";
+    std::wstring manifest_path    = L""; // The manifest itself is in details, see SK_GetManifestForAppID
     std::string  branch           = "public"; // Holds the current "beta" branch set in the Steam client (default: public)
   } steam;
 
@@ -484,6 +541,7 @@ struct app_record_s {
   } xbox;
 
   bool           launch_failed           = false;
+  uint64_t       library_hash            = 0; // Of the data the library worker produced, see SKIF_LibrarySnapshot_Fingerprint
 
   template <class _Tp> static
     constexpr bool
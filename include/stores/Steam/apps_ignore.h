@@ -1,52547 +1,9 @@
 #ifndef STEAM_APPS_IGNORABLE_H
 #define STEAM_APPS_IGNORABLE_H
 
-static constexpr unsigned int steam_apps_ignorable[] = {
-  496450,
-  1787090,
-  1802970,
-  257650,
-  1775390,
-  617580,
-  446830,
-  431960,
-  1806550,
-  1771820,
-  963040,
-  580310,
-  943760,
-  1283970,
-  1759610,
-  1494460,
-  1587140,
-  1325400,
-  1126120,
-  1702210,
-  1363250,
-  1806340,
-  1334470,
-  495480,
-  1096900,
-  363890,
-  220700,
-  551370,
-  1364390,
-  1600220,
-  1244040,
-  1068820,
-  993090,
-  1664490,
-  1140360,
-  1046770,
-  1549660,
-  958210,
-  845210,
-  554820,
-  617550,
-  617560,
-  1516050,
-  325180,
-  1634680,
-  1133640,
-  502570,
-  1793500,
-  1775400,
-  944770,
-  766300,
-  724590,
-  1368950,
-  233680,
-  966610,
-  992490,
-  871170,
-  403040,
-  665300,
-  1765360,
-  1467560,
-  1577670,
-  1688750,
-  523600,
-  495800,
-  1009850,
-  1783540,
-  1289520,
-  1443900,
-  332360,
-  1403840,
-  919280,
-  1574050,
-  1366950,
-  1182940,
-  1247240,
-  1477830,
-  1024640,
-  1746920,
-  403030,
-  479010,
-  1634870,
-  1804180,
-  857350,
-  1403800,
-  1069090,
-  1252010,
-  780100,
-  1692080,
-  1816100,
-  248170,
-  1418970,
-  1242850,
-  785160,
-  467890,
-  1358800,
-  1014130,
-  847890,
-  1325860,
-  692500,
-  1588390,
-  1221050,
-  1686500,
-  954880,
-  1278480,
-  767240,
-  1017060,
-  528200,
-  965480,
-  1386180,
-  1106180,
-  697860,
-  1740670,
-  967130,
-  430890,
-  682130,
-  690280,
-  365670,
-  941490,
-  908290,
-  1779210,
-  1716280,
-  1789160,
-  1772160,
-  1035180,
-  1335290,
-  500500,
-  1515390,
-  1268040,
-  1781430,
-  1418800,
-  478960,
-  1836380,
-  1694700,
-  693990,
-  1806090,
-  929270,
-  1725730,
-  1214640,
-  1551180,
-  861590,
-  936030,
-  1454910,
-  552770,
-  223850,
-  493430,
-  1440240,
-  1593790,
-  1418790,
-  1234730,
-  908450,
-  834410,
-  715670,
-  753200,
-  1222360,
-  1832750,
-  1066110,
-  1091650,
-  949500,
-  1174860,
-  620040,
-  1393780,
-  1204050,
-  1066860,
-  325910,
-  1765720,
-  1590110,
-  1207050,
-  1279610,
-  1146720,
-  657280,
-  1480140,
-  979560,
-  857320,
-  406450,
-  758670,
-  1025020,
-  1834860,
-  755540,
-  1762550,
-  767810,
-  629520,
-  268850,
-  1283440,
-  1011650,
-  341960,
-  1606490,
-  1771540,
-  451650,
-  1242710,
-  1127860,
-  1081730,
-  672870,
-  837510,
-  592350,
-  1253550,
-  621300,
-  1734820,
-  981590,
-  1318170,
-  1038240,
-  754010,
-  1741830,
-  1451150,
-  1294770,
-  769670,
-  1093880,
-  583010,
-  955610,
-  1734480,
-  1529570,
-  1068620,
-  1832710,
-  464940,
-  579920,
-  1529240,
-  1027220,
-  527440,
-  374400,
-  1454500,
-  1125100,
-  1468090,
-  497150,
-  1648330,
-  927730,
-  1164010,
-  763860,
-  1352750,
-  1486350,
-  1791990,
-  1801480,
-  703060,
-  1004740,
-  1055010,
-  501610,
-  973600,
-  1670320,
-  687870,
-  1273620,
-  932480,
-  1228760,
-  1087320,
-  1182930,
-  1345610,
-  1390680,
-  253050,
-  1318030,
-  1445310,
-  1617770,
-  1018680,
-  234820,
-  508690,
-  1765340,
-  1222580,
-  375840,
-  719950,
-  521880,
-  650090,
-  1365760,
-  1782750,
-  1727420,
-  1454900,
-  1213710,
-  870420,
-  1575970,
-  1366800,
-  738100,
-  1384020,
-  1099550,
-  498310,
-  488040,
-  1783530,
-  1178460,
-  1696890,
-  282660,
-  1611360,
-  585600,
-  585610,
-  585620,
-  585410,
-  372390,
-  524390,
-  837380,
-  1691110,
-  1280420,
-  1765590,
-  1365420,
-  1420930,
-  376990,
-  1038000,
-  1591460,
-  241680,
-  1754470,
-  1666890,
-  444970,
-  571890,
-  1724880,
-  1810290,
-  221200,
-  347400,
-  935870,
-  1247290,
-  435060,
-  1053760,
-  1218010,
-  382110,
-  700020,
-  786520,
-  1635730,
-  1000510,
-  1195270,
-  1261060,
-  1727670,
-  1250070,
-  690690,
-  790900,
-  673400,
-  728970,
-  1355640,
-  274920,
-  1500130,
-  922670,
-  1152420,
-  732230,
-  1513510,
-  962230,
-  1173510,
-  1113620,
-  1517890,
-  622290,
-  1269310,
-  1118380,
-  1533430,
-  724070,
-  388600,
-  1632910,
-  760710,
-  779260,
-  1174980,
-  616720,
-  922660,
-  483950,
-  1796980,
-  1016840,
-  1121930,
-  1790240,
-  529830,
-  848340,
-  1447430,
-  598180,
-  1071100,
-  586210,
-  1119570,
-  689790,
-  502340,
-  998330,
-  954350,
-  1206740,
-  642770,
-  251810,
-  1298040,
-  496840,
-  1189750,
-  1248360,
-  721090,
-  404790,
-  1114420,
-  1739780,
-  1625390,
-  1653760,
-  1176140,
-  1420890,
-  670470,
-  504790,
-  506030,
-  630900,
-  1264640,
-  1573010,
-  314500,
-  1217120,
-  322410,
-  218760,
-  1621860,
-  1471920,
-  1022700,
-  548010,
-  1112440,
-  815740,
-  388980,
-  864790,
-  821680,
-  1010170,
-  266310,
-  288270,
-  577060,
-  668660,
-  1538090,
-  1110580,
-  504710,
-  1194110,
-  777890,
-  989060,
-  1259150,
-  228180,
-  1152900,
-  1804240,
-  1840,
-  1631280,
-  1792630,
-  619550,
-  1688050,
-  1099400,
-  1702750,
-  506780,
-  1599300,
-  1035340,
-  1688030,
-  1688040,
-  1688060,
-  892170,
-  1286570,
-  570090,
-  1548970,
-  1698340,
-  768100,
-  1120310,
-  983820,
-  726380,
-  670460,
-  597840,
-  365440,
-  401090,
-  1141530,
-  250360,
-  1497120,
-  345370,
-  1416190,
-  891420,
-  735470,
-  766110,
-  417540,
-  1810590,
-  1148910,
-  1662910,
-  881680,
-  1393010,
-  920490,
-  665680,
-  1624340,
-  1228510,
-  369190,
-  1105050,
-  795630,
-  773210,
-  1281310,
-  1455850,
-  775820,
-  224380,
-  263600,
-  583620,
-  1089000,
-  1154430,
-  1096540,
-  1022230,
-  1061820,
-  504010,
-  1194080,
-  1153510,
-  408930,
-  1422050,
-  1016810,
-  906810,
-  1787270,
-  367670,
-  449130,
-  1765450,
-  912170,
-  874870,
-  1176110,
-  1143750,
-  1370780,
-  517170,
-  464170,
-  236890,
-  205250,
-  205270,
-  1050330,
-  990230,
-  1435700,
-  1497850,
-  961990,
-  665690,
-  377340,
-  431730,
-  776920,
-  601780,
-  1026920,
-  883140,
-  746390,
-  1197580,
-  1043250,
-  257400,
-  858900,
-  703300,
-  1534490,
-  982520,
-  1640240,
-  100400,
-  760970,
-  301610,
-  939360,
-  428800,
-  1739590,
-  1774930,
-  617570,
-  1299980,
-  438450,
-  978990,
-  1553240,
-  504720,
-  1113740,
-  665920,
-  972390,
-  1127880,
-  1165780,
-  292350,
-  979010,
-  1044500,
-  527350,
-  1072450,
-  1522190,
-  1495350,
-  1607340,
-  1735480,
-  1440450,
-  1632350,
-  389980,
-  383730,
-  620050,
-  1601810,
-  1260310,
-  261920,
-  1182920,
-  783070,
-  307740,
-  310690,
-  495000,
-  1166200,
-  700010,
-  1061690,
-  756770,
-  280680,
-  751170,
-  452940,
-  751160,
-  452950,
-  269550,
-  798810,
-  458750,
-  1188920,
-  904300,
-  684380,
-  1576180,
-  774721,
-  454550,
-  1256350,
-  1325730,
-  1547920,
-  466260,
-  1455360,
-  1054580,
-  607380,
-  1674730,
-  606180,
-  1458680,
-  938760,
-  1750210,
-  200530,
-  1727320,
-  951800,
-  652150,
-  908520,
-  1127870,
-  1020820,
-  1520950,
-  1229740,
-  680440,
-  1449900,
-  269570,
-  415000,
-  1039110,
-  1157970,
-  741150,
-  1757900,
-  936100,
-  992590,
-  779960,
-  768970,
-  939920,
-  330070,
-  892040,
-  1101570,
-  1167550,
-  433800,
-  1632800,
-  1747840,
-  1767430,
-  1664920,
-  1741230,
-  1445700,
-  790730,
-  1638530,
-  489180,
-  100980,
-  776180,
-  969020,
-  1204920,
-  710360,
-  1175390,
-  1542560,
-  671190,
-  1179300,
-  384300,
-  1110410,
-  1078010,
-  1495870,
-  1522320,
-  809270,
-  391050,
-  220960,
-  1677660,
-  975550,
-  689580,
-  714100,
-  677310,
-  648870,
-  1009330,
-  1103140,
-  1691040,
-  404020,
-  440520,
-  1471980,
-  402460,
-  1578190,
-  1568050,
-  1512210,
-  1359860,
-  717090,
-  269450,
-  1160420,
-  1213180,
-  366530,
-  399610,
-  524660,
-  1105890,
-  940920,
-  1527250,
-  964080,
-  868400,
-  601890,
-  400040,
-  1183720,
-  1073720,
-  1107950,
-  1668660,
-  1098420,
-  243890,
-  1733430,
-  395760,
-  708120,
-  1497030,
-  1661460,
-  821060,
-  598660,
-  751390,
-  1105450,
-  241660,
-  330130,
-  455160,
-  627530,
-  872440,
-  924770,
-  1057500,
-  1208080,
-  576790,
-  1006850,
-  511720,
-  707340,
-  495450,
-  1060680,
-  865770,
-  844060,
-  1172460,
-  584200,
-  1716070,
-  622300,
-  443970,
-  831710,
-  834170,
-  227320,
-  1096550,
-  409020,
-  645700,
-  315240,
-  1175080,
-  556750,
-  885440,
-  269470,
-  943670,
-  1087080,
-  1690580,
-  305280,
-  947240,
-  1620380,
-  1142680,
-  883290,
-  544420,
-  417390,
-  1244390,
-  656770,
-  785170,
-  273390,
-  469650,
-  1390520,
-  685300,
-  1696420,
-  691190,
-  355500,
-  279740,
-  1365710,
-  520840,
-  583850,
-  500470,
-  372060,
-  705160,
-  1183240,
-  999900,
-  1659070,
-  1668270,
-  1483360,
-  976330,
-  828800,
-  1632890,
-  230780,
-  1194690,
-  393320,
-  1370800,
-  1683350,
-  260990,
-  1062410,
-  617360,
-  356940,
-  393340,
-  999880,
-  362870,
-  1006710,
-  1353710,
-  496490,
-  244830,
-  345310,
-  341190,
-  811800,
-  1560420,
-  793190,
-  844880,
-  888370,
-  323620,
-  227260,
-  1696400,
-  292230,
-  973590,
-  778060,
-  1706750,
-  547280,
-  596140,
-  288420,
-  501620,
-  993270,
-  878890,
-  878880,
-  856640,
-  1286590,
-  478000,
-  870820,
-  907180,
-  278190,
-  262490,
-  523130,
-  684690,
-  319990,
-  665040,
-  744570,
-  640080,
-  978680,
-  1692020,
-  1544600,
-  525100,
-  1327030,
-  393000,
-  278150,
-  1194120,
-  1694730,
-  329890,
-  1468390,
-  501630,
-  1011110,
-  1657860,
-  1079520,
-  831700,
-  1178280,
-  995660,
-  275030,
-  774231,
-  380080,
-  320000,
-  257610,
-  1527140,
-  368470,
-  1165000,
-  1463740,
-  1370650,
-  1570130,
-  227980,
-  228000,
-  314730,
-  1093310,
-  262650,
-  1675910,
-  819510,
-  665200,
-  253370,
-  227240,
-  398810,
-  1654330,
-  1665830,
-  871490,
-  446060,
-  1329250,
-  448830,
-  730550,
-  531980,
-  411340,
-  548760,
-  1660020,
-  1114720,
-  1146050,
-  631130,
-  1156810,
-  948220,
-  1448900,
-  432030,
-  320920,
-  1176510,
-  770620,
-  355000,
-  524490,
-  496910,
-  621500,
-  592920,
-  1569670,
-  464120,
-  349280,
-  518690,
-  264020,
-  525420,
-  625480,
-  848170,
-  1064820,
-  509020,
-  321540,
-  388080,
-  1474110,
-  838870,
-  892050,
-  828090,
-  1586630,
-  728920,
-  497160,
-  441850,
-  479130,
-  979710,
-  892030,
-  735360,
-  1073090,
-  355030,
-  460470,
-  523120,
-  504650,
-  1310860,
-  1593130,
-  314720,
-  545110,
-  967060,
-  1466430,
-  885250,
-  909460,
-  911310,
-  703480,
-  746470,
-  871020,
-  1391700,
-  305860,
-  608000,
-  1420640,
-  1462980,
-  281900,
-  364970,
-  714030,
-  577250,
-  377590,
-  934710,
-  1464460,
-  1592560,
-  277250,
-  1297130,
-  1507700,
-  592260,
-  1166490,
-  342290,
-  345300,
-  1553290,
-  221220,
-  1172310,
-  1187140,
-  1519560,
-  1201140,
-  1487080,
-  1070520,
-  845420,
-  910370,
-  235900,
-  1453820,
-  1001160,
-  273550,
-  875460,
-  1564310,
-  244290,
-  1020020,
-  690770,
-  923270,
-  1569980,
-  262610,
-  645370,
-  1580630,
-  632750,
-  363020,
-  899150,
-  1452680,
-  316830,
-  458890,
-  1412480,
-  562830,
-  432090,
-  337070,
-  1278000,
-  978690,
-  1556140,
-  755370,
-  755100,
-  336530,
-  983050,
-  520210,
-  876950,
-  1126560,
-  1126570,
-  1057220,
-  1271450,
-  1251530,
-  506750,
-  1512840,
-  1018590,
-  1019560,
-  403470,
-  551780,
-  1359750,
-  1359740,
-  1487610,
-  1531050,
-  987010,
-  1494120,
-  1544620,
-  679160,
-  523110,
-  1498990,
-  267440,
-  788940,
-  415140,
-  947340,
-  1500270,
-  1190750,
-  994610,
-  647810,
-  1527110,
-  1246040,
-  632620,
-  1326650,
-  1337060,
-  363550,
-  1202360,
-  432330,
-  456450,
-  392230,
-  635180,
-  1522520,
-  777180,
-  1517370,
-  457670,
-  566130,
-  1380960,
-  1453950,
-  1125980,
-  1132550,
-  575270,
-  1212360,
-  456590,
-  1462940,
-  1439360,
-  1361450,
-  947330,
-  947360,
-  947350,
-  327490,
-  868340,
-  1368630,
-  1483230,
-  625100,
-  1512760,
-  606920,
-  840160,
-  550060,
-  352290,
-  428340,
-  610340,
-  571690,
-  1102420,
-  562510,
-  736280,
-  1207030,
-  598860,
-  1327140,
-  869680,
-  272300,
-  625080,
-  1050340,
-  569180,
-  512630,
-  1450860,
-  639190,
-  1494740,
-  319980,
-  1276180,
-  346590,
-  632520,
-  823080,
-  1086890,
-  849010,
-  582520,
-  579640,
-  364240,
-  582510,
-  834350,
-  849050,
-  513760,
-  725610,
-  233570,
-  646400,
-  1359770,
-  502480,
-  880310,
-  505550,
-  1467930,
-  441770,
-  586560,
-  930010,
-  241790,
-  1388380,
-  523050,
-  1200610,
-  1400430,
-  214850,
-  1375110,
-  267130,
-  1326710,
-  1232210,
-  1010800,
-  220980,
-  304220,
-  269290,
-  1388790,
-  1363650,
-  388820,
-  1373820,
-  1171220,
-  1071860,
-  1221980,
-  1029940,
-  1364470,
-  1137770,
-  989280,
-  679560,
-  543510,
-  1086240,
-  907520,
-  1410880,
-  1197460,
-  366550,
-  1219140,
-  777980,
-  547120,
-  1371430,
-  730360,
-  1282180,
-  980760,
-  911250,
-  1356110,
-  296610,
-  1425950,
-  888180,
-  1407570,
-  325330,
-  512400,
-  253670,
-  1355840,
-  454510,
-  231180,
-  348200,
-  278210,
-  647790,
-  779810,
-  1399680,
-  1380110,
-  315880,
-  856070,
-  673730,
-  1376260,
-  1052490,
-  386550,
-  237370,
-  568640,
-  839580,
-  1117520,
-  912870,
-  513200,
-  264420,
-  449380,
-  887240,
-  1232920,
-  1170750,
-  1332870,
-  1329720,
-  1357650,
-  451450,
-  372590,
-  561390,
-  799310,
-  882030,
-  683880,
-  1282740,
-  1250170,
-  679550,
-  1046610,
-  615990,
-  1282440,
-  778710,
-  1170130,
-  246260,
-  596880,
-  679570,
-  597910,
-  100410,
-  1148250,
-  352280,
-  486670,
-  738830,
-  774731,
-  983780,
-  404230,
-  962640,
-  1308270,
-  360790,
-  1264470,
-  650460,
-  542170,
-  1068300,
-  497310,
-  571040,
-  1136210,
-  1337990,
-  325100,
-  1100380,
-  755320,
-  1052330,
-  853520,
-  433930,
-  1202860,
-  839180,
-  679540,
-  623970,
-  1242830,
-  246600,
-  368670,
-  1274960,
-  1223160,
-  1279020,
-  859140,
-  523410,
-  778430,
-  1178370,
-  458360,
-  1268060,
-  911840,
-  222710,
-  1264190,
-  1279550,
-  1278870,
-  922540,
-  911940,
-  1176080,
-  1022690,
-  823900,
-  1259480,
-  714270,
-  1104270,
-  886480,
-  1236280,
-  873860,
-  1246440,
-  1172290,
-  373890,
-  1241250,
-  755310,
-  1180560,
-  593090,
-  608980,
-  446570,
-  750120,
-  760520,
-  684330,
-  647670,
-  582220,
-  607690,
-  504990,
-  633300,
-  1166210,
-  999840,
-  1101740,
-  970210,
-  1140420,
-  1091220,
-  737820,
-  539010,
-  528790,
-  393330,
-  1061830,
-  1228470,
-  523220,
-  1223180,
-  1214250,
-  939550,
-  1178250,
-  1208160,
-  1205410,
-  387790,
-  1203740,
-  1012510,
-  1023710,
-  1172810,
-  1178570,
-  1046910,
-  1023340,
-  794930,
-  879660,
-  1188700,
-  1131630,
-  1063460,
-  1111020,
-  1080890,
-  942030,
-  1002900,
-  668490,
-  1162420,
-  785990,
-  657180,
-  862220,
-  1063520,
-  431570,
-  1179090,
-  1180340,
-  1179760,
-  965400,
-  624330,
-  1086920,
-  1100090,
-  1074870,
-  1150230,
-  362750,
-  1147320,
-  810020,
-  1126400,
-  1163170,
-  1157130,
-  1146380,
-  418290,
-  420130,
-  387810,
-  732710,
-  377000,
-  1155230,
-  679580,
-  988920,
-  679590,
-  1132790,
-  1074880,
-  1148960,
-  1081520,
-  1123000,
-  1027280,
-  1102770,
-  836660,
-  1073420,
-  978760,
-  770610,
-  1080070,
-  1093340,
-  1065540,
-  724460,
-  1023940,
-  973260,
-  1074930,
-  572350,
-  1075850,
-  1075860,
-  1074900,
-  1074910,
-  1074920,
-  1058990,
-  1021030,
-  206010,
-  665450,
-  854710,
-  833740,
-  719270,
-  672760,
-  652280,
-  630280,
-  619250,
-  601620,
-  551960,
-  544880,
-  529540,
-  534690,
-  506160,
-  964890,
-  1049340,
-  1016510,
-  755290,
-  560920,
-  425560,
-  1027950,
-  913680,
-  868480,
-  1003270,
-  1008160,
-  411350,
-  372980,
-  1008250,
-  1026450,
-  965130,
-  595490,
-  485150,
-  1035380,
-  1036510,
-  1025820,
-  925160,
-  625190,
-  791040,
-  892900,
-  707410,
-  528100,
-  316620,
-  945310,
-  991080,
-  881390,
-  888060,
-  436740,
-  996150,
-  982830,
-  238710,
-  967170,
-  520040,
-  965070,
-  980740,
-  892680,
-  896930,
-  480710,
-  850800,
-  952180,
-  973360,
-  936090,
-  804420,
-  906490,
-  971020,
-  952430,
-  898520,
-  936080,
-  519290,
-  635140,
-  770310,
-  635160,
-  682300,
-  519230,
-  552050,
-  777920,
-  559570,
-  777960,
-  507630,
-  626930,
-  775670,
-  626940,
-  783620,
-  759820,
-  685070,
-  783670,
-  783690,
-  519250,
-  557150,
-  712550,
-  519270,
-  780180,
-  768920,
-  624030,
-  559520,
-  559540,
-  559560,
-  467150,
-  559580,
-  765670,
-  635120,
-  626950,
-  519430,
-  507680,
-  660770,
-  682310,
-  507730,
-  507990,
-  507750,
-  508010,
-  552070,
-  519310,
-  519330,
-  519350,
-  508090,
-  507580,
-  519370,
-  777940,
-  519390,
-  684780,
-  519410,
-  527630,
-  557070,
-  519450,
-  419870,
-  557140,
-  508510,
-  507770,
-  483760,
-  507830,
-  489920,
-  507850,
-  508120,
-  265490,
-  419880,
-  527680,
-  827990,
-  795410,
-  924950,
-  833620,
-  812700,
-  812490,
-  795340,
-  795360,
-  795390,
-  803700,
-  822410,
-  964870,
-  942770,
-  837810,
-  817610,
-  670450,
-  832620,
-  925830,
-  668030,
-  580530,
-  384540,
-  799430,
-  438840,
-  501650,
-  501660,
-  910050,
-  293140,
-  471590,
-  450710,
-  866130,
-  821760,
-  821770,
-  750840,
-  583860,
-  583870,
-  507090,
-  501600,
-  501640,
-  471580,
-  458130,
-  450360,
-  435740,
-  435750,
-  425550,
-  418200,
-  415310,
-  405690,
-  405700,
-  405470,
-  394000,
-  391940,
-  391950,
-  386270,
-  379660,
-  377350,
-  360770,
-  352380,
-  352310,
-  338600,
-  316460,
-  277150,
-  277170,
-  277210,
-  277230,
-  420630,
-  241340,
-  207340,
-  831040,
-  330160,
-  289550,
-  265420,
-  255010,
-  243580,
-  241070,
-  100970,
-  556850,
-  459870,
-  810080,
-  738310,
-  727030,
-  720330,
-  667110,
-  598150,
-  456150,
-  458200,
-  773320,
-  763720,
-  388280,
-  736210,
-  769350,
-  689850,
-  677290,
-  656110,
-  588350,
-  583200,
-  555810,
-  549360,
-  526350,
-  501280,
-  480510,
-  468900,
-  443320,
-  438110,
-  432200,
-  426610,
-  419450,
-  406830,
-  406840,
-  406040,
-  406050,
-  406060,
-  387770,
-  387780,
-  387800,
-  377010,
-  377030,
-  377040,
-  377050,
-  374690,
-  373000,
-  372650,
-  335930,
-  321070,
-  274800,
-  217670,
-  745640,
-  760020,
-  845410,
-  316630,
-  792550,
-  639370,
-  623590,
-  779120,
-  797520,
-  644300,
-  795200,
-  534430,
-  638310,
-  509510,
-  723280,
-  707280,
-  264970,
-  405840,
-  640720,
-  736700,
-  606010,
-  513150,
-  716220,
-  705830,
-  588720,
-  716140,
-  579620,
-  651320,
-  592450,
-  561490,
-  583510,
-  511360,
-  633490,
-  520350,
-  613550,
-  431030,
-  639960,
-  669010,
-  423110,
-  639850,
-  638610,
-  621440,
-  284680,
-  607560,
-  590640,
-  442230,
-  595510,
-  461550,
-  461540,
-  461530,
-  492520,
-  565970,
-  398240,
-  400650,
-  507870,
-  508030,
-  419860,
-  488000,
-  217450,
-  327180,
-  442360,
-  441470,
-  419850,
-  419840,
-  419830,
-  419820,
-  407870,
-  419780,
-  419770,
-  425690,
-  419760,
-  419720,
-  419690,
-  419670,
-  419560,
-  419750,
-  419730,
-  419440,
-  419420,
-  417340,
-  417330,
-  410620,
-  410630,
-  404340,
-  404320,
-  402740,
-  402520,
-  385430,
-  375050,
-  406030,
-  112400,
-  203550,
-  116000,
-  115000,
-  115010,
-  304970,
-  100940,
-  111500,
-  253070,
-  210580,
-  112800,
-  204200,
-  210600,
-  112810,
-  364730,
-  116410,
-  210620,
-  115900,
-  115910,
-  210640,
-  115920,
-  210660,
-  279280,
-  210680,
-  1656370,
-  1592500,
-  1205050,
-  1822480,
-  1800130,
-  1776430,
-  1835850,
-  794110,
-  597420,
-  1767680,
-  1767691,
-  1745440,
-  1289451,
-  346791,
-  1442900,
-  1708091,
-  1636871,
-  1586100,
-  1475990,
-  1462460,
-  639680,
-  1636870,
-  1546855,
-  1206200,
-  1546854,
-  1630390,
-  1196670,
-  1042220,
-  1091300,
-  1546851,
-  1767690,
-  1712220,
-  1655780,
-  1262570,
-  1090150,
-  249082,
-  1622220,
-  211720,
-  1820540,
-  1145510,
-  1815620,
-  1760780,
-  1694800,
-  1626550,
-  1795060,
-  1804460,
-  1711180,
-  1711183,
-  1482630,
-  1498760,
-  1288440,
-  530710,
-  352000,
-  344510,
-  1227481,
-  1828340,
-  1227444,
-  1222633,
-  1227452,
-  1227454,
-  1222630,
-  1227453,
-  1227467,
-  1222631,
-  1227456,
-  1829870,
-  1227468,
-  1227460,
-  1234350,
-  1222635,
-  1679140,
-  1834330,
-  1828520,
-  907610,
-  1254010,
-  1718640,
-  1692371,
-  1621470,
-  1443780,
-  222623,
-  1366190,
-  1715900,
-  935512,
-  433241,
-  301210,
-  226880,
-  224200,
-  1443510,
-  1724920,
-  1833760,
-  1176740,
-  1426750,
-  1758840,
-  1758841,
-  1450340,
-  813830,
-  585480,
-  571410,
-  315150,
-  73035,
-  73036,
-  73037,
-  73039,
-  73057,
-  73058,
-  73091,
-  73092,
-  73093,
-  73095,
-  73096,
-  73097,
-  73098,
-  73115,
-  73033,
-  1478150,
-  1832960,
-  1838430,
-  1793012,
-  1793013,
-  1746860,
-  1793010,
-  1793011,
-  1673950,
-  1734080,
-  1682640,
-  1575885,
-  1475580,
-  1184351,
-  456480,
-  372440,
-  33934,
-  1813080,
-  1797350,
-  1801100,
-  1820200,
-  1708680,
-  1788610,
-  1011280,
-  406610,
-  1256,
-  1446070,
-  1031190,
-  1585813,
-  1449260,
-  1088330,
-  969710,
-  322060,
-  313375,
-  318410,
-  276190,
-  65250,
-  208375,
-  55115,
-  1726150,
-  577400,
-  1522650,
-  1348661,
-  1303183,
-  792520,
-  495950,
-  318411,
-  1786050,
-  1354053,
-  887380,
-  506970,
-  933620,
-  1613283,
-  1304600,
-  1364033,
-  1271790,
-  1058300,
-  480631,
-  1572491,
-  1648062,
-  1664950,
-  1531604,
-  1264171,
-  1635960,
-  1005970,
-  1005971,
-  1244230,
-  934650,
-  247292,
-  219441,
-  219442,
-  219444,
-  219445,
-  219446,
-  219447,
-  219440,
-  1783650,
-  1795320,
-  1739020,
-  1074650,
-  1738980,
-  1479451,
-  1731910,
-  1421640,
-  763780,
-  531163,
-  1705990,
-  1759140,
-  1711181,
-  1668180,
-  1556690,
-  980543,
-  437231,
-  436040,
-  436050,
-  437230,
-  1790230,
-  1692460,
-  1647960,
-  1103830,
-  849261,
-  1791340,
-  1813050,
-  431050,
-  1531607,
-  1817370,
-  1571390,
-  1664931,
-  1835760,
-  1835761,
-  1308850,
-  1832590,
-  1668560,
-  1648020,
-  1238070,
-  1838920,
-  1840980,
-  1566190,
-  1798680,
-  1764060,
-  1613282,
-  1613284,
-  1107813,
-  1117860,
-  1744550,
-  1386932,
-  1087424,
-  229310,
-  213250,
-  229210,
-  229270,
-  1586250,
-  1809660,
-  1694280,
-  1299270,
-  582574,
-  508340,
-  1774370,
-  1490116,
-  1418843,
-  1108450,
-  1170140,
-  1840600,
-  1176206,
-  1829290,
-  1772330,
-  1593330,
-  1629360,
-  400551,
-  388292,
-  388293,
-  388291,
-  267652,
-  259800,
-  212894,
-  1688110,
-  1826871,
-  236591,
-  1622940,
-  654120,
-  442050,
-  1755400,
-  1755401,
-  1755402,
-  1818040,
-  889902,
-  813390,
-  754660,
-  612261,
-  394320,
-  207114,
-  858980,
-  471741,
-  1804690,
-  1677150,
-  1443089,
-  1304412,
-  895490,
-  854960,
-  742410,
-  684610,
-  1797160,
-  1711182,
-  1432642,
-  1223490,
-  1202080,
-  1109206,
-  411910,
-  1815933,
-  1586790,
-  1072561,
-  548420,
-  1321580,
-  1481110,
-  324331,
-  1707430,
-  1741390,
-  1822310,
-  1569190,
-  1064220,
-  1611940,
-  1238050,
-  1221790,
-  1135438,
-  960781,
-  1549900,
-  1610540,
-  1781510,
-  1722533,
-  1405241,
-  72770,
-  1784720,
-  1715910,
-  1637171,
-  1534780,
-  1382241,
-  1353190,
-  1316840,
-  1557210,
-  1071200,
-  537330,
-  1834090,
-  1621110,
-  1544406,
-  1227350,
-  204388,
-  1718750,
-  1336350,
-  1802450,
-  1215160,
-  210904,
-  1732640,
-  974726,
-  34345,
-  2028850,
-  1348670,
-  986250,
-  1810030,
-  1238105,
-  577840,
-  1390150,
-  378649,
-  355880,
-  373950,
-  1219330,
-  1255760,
-  1100550,
-  1533002,
-  1533006,
-  1377080,
-  1087451,
-  830460,
-  1664951,
-  1631480,
-  1139080,
-  1063450,
-  1090182,
-  976210,
-  949081,
-  668040,
-  378641,
-  378644,
-  1766730,
-  1613285,
-  974580,
-  830450,
-  494630,
-  1822870,
-  1235722,
-  1822860,
-  950560,
-  300120,
-  1626002,
-  1148022,
-  1322770,
-  861732,
-  783545,
-  601710,
-  1673990,
-  1823440,
-  1616180,
-  1304461,
-  1090184,
-  65247,
-  1794910,
-  1593240,
-  1196793,
-  1225210,
-  1090167,
-  374860,
-  1690010,
-  1598441,
-  1530640,
-  1815932,
-  1756130,
-  1585812,
-  1533007,
-  1304601,
-  842050,
-  1744102,
-  1744101,
-  1637257,
-  1515063,
-  1267507,
-  957120,
-  201802,
-  1662380,
-  1426300,
-  1752630,
-  1641940,
-  1451460,
-  1282781,
-  317202,
-  34343,
-  1524820,
-  1479453,
-  1418840,
-  1169990,
-  486110,
-  1443092,
-  1435530,
-  434063,
-  33372,
-  558130,
-  401628,
-  401630,
-  318420,
-  257070,
-  210906,
-  208306,
-  1270830,
-  1227440,
-  779400,
-  747800,
-  759580,
-  759581,
-  731172,
-  704810,
-  721260,
-  727990,
-  561730,
-  1747960,
-  881960,
-  673440,
-  416420,
-  245890,
-  1500190,
-  1601350,
-  547500,
-  1778791,
-  1233370,
-  1174290,
-  1181771,
-  897670,
-  1656810,
-  1325500,
-  1024701,
-  1013300,
-  937892,
-  526660,
-  366650,
-  343464,
-  1533008,
-  1533009,
-  1241261,
-  1241262,
-  1211205,
-  1211206,
-  1159010,
-  1516010,
-  1066150,
-  830461,
-  609826,
-  436030,
-  1773800,
-  1433560,
-  1251000,
-  773600,
-  267780,
-  267775,
-  55472,
-  575290,
-  559840,
-  1064740,
-  1088640,
-  920564,
-  920568,
-  920560,
-  920561,
-  920562,
-  1702900,
-  1418842,
-  1449310,
-  1198849,
-  1238430,
-  1158730,
-  1162270,
-  1168030,
-  1656220,
-  1278630,
-  258648,
-  1535220,
-  1471521,
-  1336321,
-  739281,
-  524320,
-  320371,
-  265193,
-  1762580,
-  1755200,
-  1689830,
-  1437810,
-  1335840,
-  1419050,
-  824610,
-  550332,
-  1486710,
-  1478810,
-  1341701,
-  1192820,
-  1021110,
-  1011900,
-  895492,
-  639540,
-  550540,
-  410810,
-  395410,
-  396440,
-  340620,
-  1818164,
-  1818163,
-  1818162,
-  1818161,
-  1818160,
-  1797220,
-  1461160,
-  1400460,
-  1400530,
-  1415420,
-  1072560,
-  349660,
-  878463,
-  801710,
-  261390,
-  1088700,
-  973380,
-  1460021,
-  689860,
-  675590,
-  1807170,
-  1736720,
-  1782310,
-  1546670,
-  1410990,
-  548421,
-  577357,
-  245930,
-  232634,
-  230090,
-  218550,
-  213210,
-  1838260,
-  1761570,
-  1674580,
-  1711770,
-  1203350,
-  474740,
-  1762700,
-  616191,
-  1235730,
-  1235734,
-  1235757,
-  1235758,
-  1833940,
-  1621474,
-  1368570,
-  1368572,
-  1364034,
-  1301020,
-  1235761,
-  1050050,
-  1672983,
-  1760280,
-  1480462,
-  1304462,
-  1173930,
-  1840260,
-  1788530,
-  1274460,
-  619510,
-  1601550,
-  1107812,
-  277732,
-  1685690,
-  1663530,
-  1473431,
-  1112980,
-  218784,
-  1770580,
-  1540070,
-  1711772,
-  909150,
-  1744080,
-  1581451,
-  1364971,
-  1086480,
-  691120,
-  313100,
-  1544403,
-  315393,
-  315394,
-  320350,
-  1121740,
-  793070,
-  226459,
-  1796300,
-  1662503,
-  1426880,
-  1176203,
-  1607890,
-  1090620,
-  920571,
-  821950,
-  619720,
-  1723660,
-  1449882,
-  792420,
-  760843,
-  734740,
-  376200,
-  388790,
-  334080,
-  327340,
-  338360,
-  267784,
-  267781,
-  267772,
-  496100,
-  348560,
-  242120,
-  714860,
-  340640,
-  1751750,
-  1602660,
-  821740,
-  1764860,
-  1751202,
-  1270320,
-  1520480,
-  1816590,
-  1285810,
-  1179710,
-  434065,
-  378646,
-  1812470,
-  1812487,
-  1812486,
-  1812481,
-  1812480,
-  1812482,
-  1812484,
-  1812485,
-  1812483,
-  1537870,
-  905050,
-  999550,
-  1739021,
-  1158670,
-  1569400,
-  1490112,
-  1479630,
-  1351020,
-  1365230,
-  621922,
-  1691470,
-  1691471,
-  1633680,
-  726690,
-  406560,
-  366843,
-  1709974,
-  1832732,
-  1811650,
-  877620,
-  617090,
-  1832733,
-  1316020,
-  1125630,
-  1697710,
-  1832734,
-  1235733,
-  1117250,
-  1087428,
-  1553061,
-  1553060,
-  1832731,
-  320382,
-  320380,
-  320381,
-  1832730,
-  1241290,
-  1241267,
-  1241283,
-  1241286,
-  1415530,
-  1194010,
-  1024702,
-  491495,
-  1834410,
-  1215820,
-  1113410,
-  708770,
-  512540,
-  1536952,
-  1235742,
-  1668070,
-  1810031,
-  1361830,
-  1307591,
-  1167000,
-  1828250,
-  1599770,
-  1617870,
-  1520620,
-  1120301,
-  614582,
-  45775,
-  1822100,
-  1822101,
-  1822102,
-  1812160,
-  798250,
-  1110880,
-  868170,
-  470750,
-  944540,
-  686711,
-  1115791,
-  1822103,
-  1822104,
-  1633670,
-  1560935,
-  378647,
-  208318,
-  1438210,
-  1738392,
-  1738390,
-  1738391,
-  1812630,
-  1336322,
-  389720,
-  1819510,
-  1400301,
-  1400302,
-  1400303,
-  1400304,
-  1400305,
-  1400306,
-  1400300,
-  1255072,
-  1255071,
-  1255070,
-  1254920,
-  1254921,
-  1254922,
-  1254923,
-  756953,
-  756954,
-  1213940,
-  1213950,
-  1578357,
-  1549500,
-  1619191,
-  1147153,
-  725353,
-  612260,
-  1759000,
-  756952,
-  756951,
-  756950,
-  756955,
-  889073,
-  889072,
-  794560,
-  889071,
-  889070,
-  714861,
-  714850,
-  888856,
-  750381,
-  509060,
-  582600,
-  925750,
-  1176913,
-  969590,
-  971790,
-  1833410,
-  1833420,
-  1833421,
-  1833430,
-  1833440,
-  1749103,
-  1788210,
-  1670430,
-  1188790,
-  319120,
-  799200,
-  1199880,
-  700282,
-  1165630,
-  616290,
-  474763,
-  455572,
-  1495210,
-  1731600,
-  1677070,
-  1621473,
-  1830090,
-  1443011,
-  1492020,
-  1234740,
-  1424950,
-  1777420,
-  1622941,
-  1242773,
-  1242750,
-  1242772,
-  1670390,
-  1827860,
-  1803270,
-  1803280,
-  1803250,
-  1803260,
-  1803180,
-  1803240,
-  1834270,
-  1784870,
-  1674637,
-  1629010,
-  1575660,
-  1808990,
-  262341,
-  262342,
-  1826870,
-  1450570,
-  1450571,
-  1450572,
-  1795850,
-  1472190,
-  974400,
-  974723,
-  367872,
-  367870,
-  367871,
-  1764062,
-  1793050,
-  974702,
-  818330,
-  590860,
-  574570,
-  480560,
-  40393,
-  1456361,
-  556221,
-  1669300,
-  1674634,
-  1674635,
-  1674636,
-  1670391,
-  1672210,
-  1676100,
-  1594550,
-  1475830,
-  1289191,
-  1781410,
-  1780970,
-  1554690,
-  1458151,
-  1139110,
-  1161421,
-  943690,
-  487320,
-  1460140,
-  1202051,
-  379310,
-  297512,
-  34348,
-  115340,
-  1696530,
-  1751050,
-  1717654,
-  1592730,
-  1568680,
-  1444560,
-  1386610,
-  1386611,
-  1386612,
-  1356220,
-  1300210,
-  1300211,
-  1271670,
-  1206821,
-  1173140,
-  1149720,
-  1088290,
-  907881,
-  872080,
-  844810,
-  686890,
-  691310,
-  565610,
-  561631,
-  466544,
-  337661,
-  1663570,
-  1837360,
-  1813510,
-  1176914,
-  1827280,
-  1823441,
-  357160,
-  357161,
-  357162,
-  357163,
-  1461292,
-  1461294,
-  380850,
-  485300,
-  647860,
-  485301,
-  485302,
-  553920,
-  528890,
-  528891,
-  528892,
-  304071,
-  1831210,
-  1067690,
-  1410590,
-  208349,
-  316966,
-  246257,
-  1783290,
-  1816460,
-  1797900,
-  1788370,
-  1659940,
-  1700730,
-  1555760,
-  941962,
-  564251,
-  445700,
-  327130,
-  1774270,
-  1774271,
-  1774272,
-  1774273,
-  1774274,
-  1774275,
-  1774276,
-  1774277,
-  1774278,
-  1774280,
-  1774281,
-  1774282,
-  1774283,
-  1774284,
-  1774285,
-  1774286,
-  1774287,
-  1774288,
-  1774290,
-  1774291,
-  1774292,
-  1774293,
-  1774294,
-  1774295,
-  1774296,
-  1774297,
-  1774298,
-  1774300,
-  1774301,
-  1774302,
-  1774303,
-  1774304,
-  1774305,
-  1774310,
-  1774311,
-  1774312,
-  1774313,
-  1774314,
-  1774315,
-  1774316,
-  1774317,
-  1774318,
-  1774320,
-  1774321,
-  1774322,
-  1774323,
-  1774324,
-  1774325,
-  1209480,
-  889903,
-  771300,
-  1774326,
-  1774327,
-  1774328,
-  72760,
-  1774330,
-  1774331,
-  1774332,
-  1774333,
-  1774334,
-  1774335,
-  1774336,
-  1774337,
-  1774338,
-  1774340,
-  1774341,
-  1774342,
-  1826850,
-  1774343,
-  1774344,
-  1774345,
-  1774346,
-  1774348,
-  1774347,
-  885550,
-  1574960,
-  1574961,
-  1574962,
-  1694801,
-  259211,
-  245910,
-  1167280,
-  1167290,
-  423360,
-  245970,
-  1327840,
-  1327841,
-  1327842,
-  1323240,
-  1323241,
-  1323242,
-  213230,
-  347890,
-  207870,
-  1774262,
-  1774261,
-  1774260,
-  1774349,
-  1393110,
-  1167330,
-  956070,
-  957110,
-  810380,
-  323230,
-  1022850,
-  1710430,
-  1536954,
-  1288460,
-  1330040,
-  1135432,
-  1135436,
-  1137802,
-  1131170,
-  1240390,
-  1522430,
-  304070,
-  304072,
-  445320,
-  445321,
-  445330,
-  1137641,
-  888870,
-  686800,
-  1809123,
-  1809124,
-  1809125,
-  1813460,
-  1809122,
-  1809121,
-  1437000,
-  1650120,
-  1555741,
-  1443081,
-  1250730,
-  1150030,
-  888852,
-  1606160,
-  1606161,
-  1606162,
-  1482140,
-  1811220,
-  1817390,
-  1020631,
-  992150,
-  992160,
-  1020630,
-  972150,
-  1816820,
-  1815931,
-  1378760,
-  1036760,
-  35080,
-  1755190,
-  376953,
-  1631620,
-  715193,
-  277742,
-  277747,
-  277752,
-  704250,
-  1136001,
-  1592510,
-  325965,
-  1494351,
-  1710240,
-  1635853,
-  1583920,
-  1359320,
-  1235746,
-  1235747,
-  1248335,
-  304020,
-  1652350,
-  1549560,
-  1711771,
-  1755900,
-  934660,
-  1824340,
-  1468480,
-  1157230,
-  1019133,
-  819240,
-  564793,
-  564794,
-  482420,
-  1517460,
-  1359590,
-  1262000,
-  1150190,
-  584096,
-  450820,
-  1830750,
-  1443055,
-  1256750,
-  937680,
-  601670,
-  530598,
-  967230,
-  610820,
-  501560,
-  1696600,
-  1822730,
-  1777520,
-  1369030,
-  963060,
-  229630,
-  1695050,
-  1707530,
-  1707533,
-  1304150,
-  1690140,
-  1111442,
-  1816663,
-  1816664,
-  1643020,
-  1471870,
-  1202043,
-  1738208,
-  1658980,
-  1189890,
-  1217890,
-  1043420,
-  464590,
-  1784532,
-  1784531,
-  1784536,
-  1537760,
-  836810,
-  836812,
-  740141,
-  556390,
-  1238102,
-  1202041,
-  452960,
-  408610,
-  229621,
-  229622,
-  229626,
-  229627,
-  229628,
-  229629,
-  1719920,
-  1210750,
-  1062284,
-  747060,
-  1824680,
-  1575762,
-  1199630,
-  953830,
-  379544,
-  1764320,
-  1763310,
-  1581450,
-  1050440,
-  778190,
-  1732810,
-  1049240,
-  750340,
-  750341,
-  750320,
-  306392,
-  1162601,
-  977660,
-  814251,
-  594591,
-  225830,
-  1805600,
-  1191170,
-  1118012,
-  1531605,
-  1502940,
-  1180490,
-  657421,
-  265190,
-  1167310,
-  1252990,
-  1023780,
-  524290,
-  524300,
-  524310,
-  524260,
-  524270,
-  524280,
-  472350,
-  351552,
-  351554,
-  351555,
-  351556,
-  354425,
-  354426,
-  347155,
-  1352585,
-  1203510,
-  756010,
-  351553,
-  354427,
-  351551,
-  1448980,
-  1443016,
-  1090165,
-  1753460,
-  1826390,
-  979030,
-  974720,
-  942190,
-  942230,
-  496102,
-  462920,
-  1248334,
-  1163770,
-  1051380,
-  995640,
-  919770,
-  588300,
-  1800150,
-  1111447,
-  1111475,
-  1111482,
-  1604940,
-  1544402,
-  1287050,
-  868422,
-  645970,
-  1580050,
-  1532290,
-  1287056,
-  1287057,
-  1242740,
-  1242779,
-  1151710,
-  1076080,
-  380231,
-  1664020,
-  1798505,
-  1798504,
-  1798503,
-  1663080,
-  1405830,
-  1265640,
-  1798502,
-  1798501,
-  1111440,
-  1798500,
-  1279714,
-  1772405,
-  1772404,
-  1772402,
-  1817270,
-  1772403,
-  1451700,
-  1772401,
-  1311092,
-  1772400,
-  1732870,
-  1732860,
-  1732830,
-  1725150,
-  1527660,
-  974290,
-  249730,
-  1701790,
-  1835340,
-  1200349,
-  1782170,
-  1502000,
-  1503720,
-  1497870,
-  1211478,
-  888871,
-  874360,
-  42697,
-  1629270,
-  1416090,
-  1202052,
-  1705820,
-  1368571,
-  1235766,
-  1235740,
-  1235744,
-  1235745,
-  1235753,
-  1235755,
-  1235756,
-  1174470,
-  1245150,
-  616280,
-  1719910,
-  1816668,
-  1695660,
-  1729930,
-  1729931,
-  1777810,
-  498870,
-  1663490,
-  1557851,
-  1458155,
-  1233371,
-  452520,
-  1716090,
-  1698790,
-  1663550,
-  1663500,
-  1663510,
-  1663520,
-  1663540,
-  1668220,
-  1668230,
-  1668240,
-  1633700,
-  1633710,
-  1633720,
-  1633730,
-  1663460,
-  1663470,
-  1663480,
-  1722430,
-  737000,
-  65232,
-  1449442,
-  1308181,
-  1179290,
-  974701,
-  1134385,
-  1134406,
-  1823500,
-  1608380,
-  1800210,
-  1058390,
-  457120,
-  1348140,
-  1482081,
-  1481111,
-  957690,
-  535880,
-  378642,
-  378643,
-  376390,
-  1262980,
-  1154780,
-  1364038,
-  1567290,
-  1579991,
-  1173900,
-  235883,
-  1403630,
-  1640650,
-  1235721,
-  1087425,
-  1064271,
-  374871,
-  65231,
-  42722,
-  1650650,
-  1421460,
-  1085480,
-  1085490,
-  1654480,
-  1467350,
-  1255152,
-  827250,
-  575300,
-  575301,
-  495951,
-  338161,
-  48803,
-  1668570,
-  1784890,
-  1287062,
-  1151700,
-  931640,
-  646669,
-  657431,
-  602622,
-  555300,
-  474760,
-  1521130,
-  1351860,
-  1289950,
-  1015160,
-  889921,
-  393020,
-  390654,
-  390655,
-  390650,
-  390651,
-  288520,
-  1770860,
-  1416670,
-  206097,
-  206098,
-  206096,
-  1732704,
-  1629260,
-  1024110,
-  978951,
-  525011,
-  493880,
-  463798,
-  376967,
-  1681170,
-  1400970,
-  1412530,
-  1629240,
-  1606320,
-  1533011,
-  1389910,
-  986850,
-  609800,
-  468726,
-  1685910,
-  1608440,
-  1303312,
-  1303313,
-  1287020,
-  1016520,
-  1163520,
-  247299,
-  1317160,
-  1443019,
-  1456363,
-  1712190,
-  1649880,
-  888858,
-  868311,
-  1490110,
-  982590,
-  353760,
-  208353,
-  1042731,
-  1619320,
-  1390110,
-  405520,
-  1412230,
-  1816821,
-  1363540,
-  1169180,
-  1046050,
-  1033060,
-  650290,
-  499360,
-  1590565,
-  1316180,
-  1273971,
-  1058190,
-  1164110,
-  1112420,
-  1076850,
-  1070170,
-  767380,
-  706150,
-  640230,
-  399620,
-  1575800,
-  1281881,
-  592374,
-  1723430,
-  1807620,
-  888857,
-  1805850,
-  1473430,
-  751840,
-  306690,
-  22470,
-  1456210,
-  1490111,
-  1300850,
-  771890,
-  645402,
-  1681820,
-  1660410,
-  1660400,
-  1660390,
-  1660381,
-  1660380,
-  1792190,
-  422400,
-  441600,
-  358150,
-  311050,
-  384020,
-  384021,
-  339480,
-  330010,
-  374300,
-  374301,
-  320030,
-  612900,
-  487210,
-  254260,
-  259380,
-  259381,
-  433730,
-  366660,
-  548422,
-  344140,
-  545100,
-  591710,
-  450660,
-  267380,
-  267381,
-  331900,
-  275590,
-  349830,
-  351890,
-  264610,
-  323500,
-  468410,
-  348090,
-  368870,
-  401650,
-  337660,
-  1349400,
-  1341520,
-  818700,
-  1339440,
-  1016070,
-  277761,
-  1668110,
-  1560932,
-  247293,
-  201805,
-  1647900,
-  1645450,
-  850990,
-  794060,
-  426860,
-  1722280,
-  1449350,
-  1371403,
-  1371408,
-  1371427,
-  706770,
-  316961,
-  316964,
-  247294,
-  961150,
-  935810,
-  940220,
-  644700,
-  1564750,
-  1192561,
-  1209460,
-  1162206,
-  998550,
-  884140,
-  702660,
-  388479,
-  247291,
-  238301,
-  1588360,
-  1197650,
-  204371,
-  204372,
-  1317250,
-  1248332,
-  480520,
-  223180,
-  1235720,
-  1084430,
-  721060,
-  338620,
-  320860,
-  1561360,
-  1200360,
-  737001,
-  456510,
-  379242,
-  222380,
-  1796290,
-  989960,
-  1424200,
-  1585811,
-  1443015,
-  407475,
-  55380,
-  1533001,
-  1461050,
-  1248331,
-  861870,
-  920840,
-  816880,
-  1531473,
-  1784530,
-  1784500,
-  1784510,
-  1784533,
-  1784534,
-  1784535,
-  1784537,
-  1784538,
-  1643210,
-  1579090,
-  974721,
-  448195,
-  1544590,
-  261050,
-  1443082,
-  449392,
-  1626390,
-  1522550,
-  1545980,
-  1445990,
-  1508810,
-  490270,
-  1507380,
-  740142,
-  564170,
-  204900,
-  204901,
-  204902,
-  1242778,
-  849260,
-  379400,
-  1304411,
-  1075041,
-  1569281,
-  754920,
-  396172,
-  717250,
-  1677170,
-  1541930,
-  1041010,
-  621926,
-  240280,
-  1412760,
-  1052690,
-  821750,
-  774521,
-  663580,
-  370002,
-  247308,
-  247298,
-  1729680,
-  1785110,
-  1575020,
-  1727630,
-  1581934,
-  267810,
-  71163,
-  250990,
-  1740900,
-  1570390,
-  1531606,
-  1026970,
-  1542501,
-  1445550,
-  1227461,
-  1159060,
-  1118274,
-  1694070,
-  1636344,
-  1549670,
-  584140,
-  545170,
-  381712,
-  297515,
-  1046440,
-  1632320,
-  1202050,
-  1019931,
-  317200,
-  265191,
-  1822830,
-  1637170,
-  1420110,
-  1233360,
-  1080770,
-  493190,
-  317201,
-  317203,
-  317208,
-  328821,
-  1396474,
-  1055335,
-  282514,
-  241369,
-  1429910,
-  1311090,
-  1248333,
-  1253350,
-  837860,
-  452523,
-  407470,
-  407471,
-  407472,
-  407474,
-  282512,
-  1832770,
-  1778790,
-  1677990,
-  1289190,
-  455460,
-  1034720,
-  715192,
-  267630,
-  24679,
-  1624520,
-  1141980,
-  1084210,
-  1087426,
-  1831280,
-  1831281,
-  1608240,
-  1542500,
-  1458154,
-  1827350,
-  947670,
-  561650,
-  1831840,
-  1213540,
-  1162208,
-  1235750,
-  1198833,
-  297510,
-  297511,
-  297513,
-  249092,
-  260291,
-  249090,
-  1555740,
-  1397380,
-  662970,
-  1830550,
-  1576410,
-  1255000,
-  1174110,
-  883840,
-  201881,
-  1758940,
-  1685720,
-  1640310,
-  1610882,
-  1597920,
-  1471390,
-  826082,
-  560941,
-  1198837,
-  886280,
-  944071,
-  826081,
-  462390,
-  405031,
-  405032,
-  401632,
-  350171,
-  1828230,
-  1689970,
-  1569310,
-  1443091,
-  1425820,
-  556760,
-  401622,
-  401623,
-  401624,
-  401625,
-  401626,
-  401633,
-  401620,
-  378550,
-  10697,
-  1677550,
-  1137801,
-  687500,
-  1557850,
-  1120305,
-  459120,
-  222618,
-  1233062,
-  1058420,
-  1832970,
-  1556110,
-  1523740,
-  1304417,
-  1237430,
-  1826630,
-  1494350,
-  1803940,
-  1672986,
-  1079180,
-  1087450,
-  888859,
-  854070,
-  720710,
-  720780,
-  614580,
-  292220,
-  450470,
-  295530,
-  640390,
-  1140690,
-  730618,
-  223770,
-  1816400,
-  1525260,
-  1714330,
-  841250,
-  10695,
-  1174730,
-  1045290,
-  1045291,
-  1118010,
-  1067630,
-  744640,
-  1663300,
-  1517260,
-  1019930,
-  920960,
-  448194,
-  345681,
-  208377,
-  1634000,
-  1174630,
-  1125270,
-  1418980,
-  1260350,
-  1153560,
-  951664,
-  640140,
-  218780,
-  1565160,
-  1325790,
-  1270540,
-  974700,
-  582040,
-  365820,
-  297514,
-  260293,
-  558245,
-  1663120,
-  1480580,
-  356470,
-  1831600,
-  543640,
-  1824030,
-  1307600,
-  464840,
-  1729970,
-  1724640,
-  1450350,
-  1180230,
-  1095250,
-  1041290,
-  591800,
-  1770940,
-  1770941,
-  1770942,
-  1688680,
-  1688681,
-  1688682,
-  1688683,
-  1688684,
-  1593721,
-  1593722,
-  1594260,
-  1594580,
-  1594581,
-  1594582,
-  1594583,
-  1671150,
-  1671151,
-  1552700,
-  1552701,
-  1552702,
-  1552703,
-  1552704,
-  1552705,
-  1593720,
-  1435550,
-  1435551,
-  1435552,
-  1382612,
-  1382613,
-  1453800,
-  1453801,
-  1453802,
-  1283160,
-  1283161,
-  1283162,
-  1283163,
-  1283164,
-  1382590,
-  1382591,
-  1382592,
-  1382593,
-  1382600,
-  1382610,
-  1382611,
-  1201152,
-  1181540,
-  1181541,
-  1181542,
-  1201150,
-  1201151,
-  1816660,
-  1816661,
-  1816662,
-  1816665,
-  1816666,
-  1816667,
-  1816669,
-  1165510,
-  870272,
-  720750,
-  1573920,
-  1390840,
-  1209110,
-  500248,
-  295437,
-  248160,
-  1749080,
-  934680,
-  1295190,
-  1346730,
-  1178610,
-  1246520,
-  609821,
-  55344,
-  55345,
-  55348,
-  55470,
-  55473,
-  55343,
-  1708020,
-  65233,
-  1561362,
-  1317230,
-  1172540,
-  556391,
-  387440,
-  1827520,
-  1828560,
-  1797340,
-  1561363,
-  1423760,
-  321620,
-  258671,
-  1442320,
-  1181530,
-  906130,
-  542300,
-  548070,
-  673690,
-  676890,
-  1623571,
-  1357370,
-  1357371,
-  1357372,
-  1248330,
-  974724,
-  870273,
-  1492491,
-  1778800,
-  643692,
-  99610,
-  1364039,
-  1493170,
-  1433620,
-  1376750,
-  924220,
-  760720,
-  495371,
-  201279,
-  611110,
-  566720,
-  1819710,
-  1819730,
-  1819740,
-  1819760,
-  1415700,
-  1415070,
-  1235751,
-  625350,
-  379583,
-  1593360,
-  331181,
-  1802320,
-  1701060,
-  1781100,
-  1418844,
-  1331221,
-  837841,
-  776950,
-  1813090,
-  1766022,
-  1590563,
-  385970,
-  1764061,
-  850010,
-  277768,
-  208790,
-  208292,
-  1575610,
-  1575620,
-  1701862,
-  1701861,
-  1409143,
-  1354640,
-  1701860,
-  1480750,
-  1317260,
-  992171,
-  919720,
-  1090200,
-  848990,
-  407200,
-  407210,
-  744930,
-  349770,
-  410940,
-  365940,
-  415710,
-  521220,
-  988450,
-  1394890,
-  878462,
-  1809460,
-  1809461,
-  1809462,
-  1809463,
-  451050,
-  374500,
-  854750,
-  357360,
-  600560,
-  415720,
-  415700,
-  718570,
-  1648880,
-  1267502,
-  621925,
-  63399,
-  1803670,
-  1802950,
-  903690,
-  685840,
-  685850,
-  434040,
-  434041,
-  1455550,
-  1789150,
-  1307400,
-  972370,
-  735730,
-  841220,
-  1455640,
-  1455641,
-  1397340,
-  831640,
-  1361310,
-  1361311,
-  830910,
-  830920,
-  830930,
-  830940,
-  830950,
-  1830930,
-  1822330,
-  1409720,
-  401640,
-  338163,
-  1771860,
-  1232257,
-  1055810,
-  1820010,
-  1506950,
-  1304445,
-  1808430,
-  1445950,
-  1311091,
-  1101970,
-  821980,
-  770972,
-  34841,
-  1741180,
-  1520720,
-  1823520,
-  1823521,
-  1823530,
-  1823531,
-  1723904,
-  1723905,
-  1723906,
-  1293240,
-  584092,
-  559670,
-  285461,
-  335810,
-  1657120,
-  1648061,
-  1424940,
-  1074270,
-  1382210,
-  448184,
-  313101,
-  1576450,
-  1576460,
-  732960,
-  1209120,
-  1209121,
-  1158180,
-  1158181,
-  617810,
-  835670,
-  835671,
-  965220,
-  1036390,
-  779880,
-  781190,
-  1264270,
-  617870,
-  1074320,
-  1074321,
-  1003160,
-  594590,
-  594592,
-  594593,
-  594594,
-  594595,
-  594596,
-  594597,
-  594598,
-  1315750,
-  594599,
-  1315751,
-  594600,
-  1315752,
-  594601,
-  594602,
-  594603,
-  1083060,
-  735420,
-  1576390,
-  1423860,
-  1244670,
-  794111,
-  1622100,
-  1402920,
-  1294440,
-  1122400,
-  428810,
-  1738203,
-  1738210,
-  1738180,
-  1738181,
-  1738182,
-  1738200,
-  1738201,
-  1738202,
-  1738204,
-  1738205,
-  1738206,
-  1738209,
-  1738190,
-  1738207,
-  1558885,
-  1467120,
-  1317080,
-  1211480,
-  1819310,
-  1819320,
-  1819330,
-  1791690,
-  1809120,
-  1438630,
-  1090850,
-  1051620,
-  1051621,
-  310031,
-  249087,
-  249083,
-  733140,
-  813410,
-  751830,
-  806780,
-  841000,
-  921010,
-  988440,
-  813420,
-  751831,
-  949080,
-  806920,
-  751832,
-  785060,
-  1521000,
-  1523730,
-  1128540,
-  1806060,
-  480722,
-  480720,
-  480721,
-  1682230,
-  1201360,
-  208808,
-  39270,
-  1814680,
-  1628880,
-  1350930,
-  1615012,
-  1272440,
-  1329264,
-  273300,
-  1266860,
-  1544340,
-  1702060,
-  1351261,
-  601270,
-  354331,
-  320386,
-  320387,
-  320388,
-  226670,
-  226660,
-  1665843,
-  1817040,
-  1254380,
-  1753600,
-  1753610,
-  1753620,
-  1753590,
-  1662880,
-  1773880,
-  1726520,
-  1230230,
-  1083220,
-  957735,
-  221166,
-  1090181,
-  1824890,
-  1824870,
-  1824860,
-  1827270,
-  1824460,
-  1490115,
-  1404680,
-  730260,
-  1143400,
-  1298590,
-  306330,
-  1823680,
-  1491140,
-  1198835,
-  1710371,
-  1514860,
-  836750,
-  1272654,
-  1282550,
-  1365990,
-  1453070,
-  1378560,
-  1062590,
-  942290,
-  747430,
-  256270,
-  296990,
-  255980,
-  1744811,
-  1664040,
-  1223580,
-  914080,
-  306393,
-  306395,
-  306397,
-  306399,
-  306390,
-  1557980,
-  1439490,
-  993240,
-  238340,
-  213780,
-  463640,
-  319090,
-  489860,
-  1696390,
-  1696391,
-  811170,
-  452771,
-  408500,
-  245950,
-  40391,
-  1456840,
-  1456841,
-  1456842,
-  1456843,
-  1268940,
-  25806,
-  881890,
-  376810,
-  1635820,
-  1635821,
-  1635822,
-  1635823,
-  1801910,
-  63942,
-  64017,
-  64014,
-  271850,
-  1636800,
-  357760,
-  64016,
-  64005,
-  64013,
-  1260050,
-  890290,
-  1774530,
-  1710610,
-  1128020,
-  1677610,
-  531130,
-  1771840,
-  861090,
-  538760,
-  437233,
-  242300,
-  242310,
-  1807880,
-  530610,
-  1687510,
-  1408020,
-  861100,
-  861110,
-  501570,
-  458445,
-  258817,
-  1716670,
-  398472,
-  398473,
-  538080,
-  1785140,
-  1277570,
-  1206820,
-  1223780,
-  1230277,
-  292983,
-  292984,
-  292985,
-  226662,
-  226663,
-  226664,
-  226673,
-  210894,
-  203772,
-  22361,
-  22363,
-  1303182,
-  73032,
-  325462,
-  42914,
-  1143650,
-  1244781,
-  234430,
-  234432,
-  234433,
-  1493470,
-  1195240,
-  1078840,
-  1078850,
-  1078851,
-  1078852,
-  1809790,
-  1809800,
-  1809810,
-  1660060,
-  1441460,
-  1669460,
-  1368800,
-  1734690,
-  1109209,
-  214990,
-  1813040,
-  1824320,
-  1811090,
-  1787780,
-  1818510,
-  1810370,
-  1075040,
-  748340,
-  1731220,
-  1731180,
-  1258510,
-  620610,
-  1134460,
-  1428220,
-  1213590,
-  455040,
-  1811080,
-  1309110,
-  1338630,
-  988172,
-  1531471,
-  423363,
-  1168680,
-  1774730,
-  1365100,
-  1022830,
-  577402,
-  535720,
-  501170,
-  501171,
-  226671,
-  210901,
-  1472191,
-  874345,
-  373940,
-  247306,
-  1581511,
-  1695230,
-  494392,
-  1566770,
-  1560939,
-  1346541,
-  592800,
-  1488280,
-  1255150,
-  1744830,
-  1744831,
-  1744832,
-  1744833,
-  1744834,
-  1744835,
-  1744836,
-  1744818,
-  1375370,
-  1791210,
-  358142,
-  55382,
-  16863,
-  16861,
-  16862,
-  1778570,
-  598120,
-  1038400,
-  542160,
-  363990,
-  55396,
-  55397,
-  55391,
-  470080,
-  1451020,
-  1451021,
-  1451022,
-  1451023,
-  1451024,
-  220760,
-  651430,
-  682560,
-  932600,
-  1034000,
-  1006360,
-  982780,
-  1006340,
-  982610,
-  1025370,
-  873600,
-  1630580,
-  545210,
-  459110,
-  1006350,
-  921460,
-  1027580,
-  1393160,
-  1582400,
-  860710,
-  1539550,
-  1539560,
-  1426390,
-  1056950,
-  1033200,
-  1578356,
-  1578358,
-  1064980,
-  1064981,
-  1792910,
-  1786380,
-  1786041,
-  1786042,
-  1783790,
-  1573930,
-  1368920,
-  779010,
-  416400,
-  1107360,
-  1106900,
-  1664070,
-  1123350,
-  1135980,
-  1148950,
-  1021010,
-  1021011,
-  1027670,
-  1443790,
-  404800,
-  35091,
-  1006380,
-  1034080,
-  940200,
-  1090950,
-  1104360,
-  1383750,
-  1374450,
-  1186560,
-  1015880,
-  376933,
-  408220,
-  35090,
-  1495950,
-  1492030,
-  55388,
-  1442220,
-  1298210,
-  381716,
-  1810110,
-  1588930,
-  1444810,
-  304214,
-  1113550,
-  868312,
-  868310,
-  867340,
-  1121580,
-  570360,
-  1343320,
-  1304415,
-  980450,
-  1315300,
-  1784450,
-  1784451,
-  997254,
-  1782410,
-  1341320,
-  1479800,
-  1806890,
-  573820,
-  573821,
-  465290,
-  465291,
-  465292,
-  510940,
-  1806870,
-  788430,
-  1580220,
-  374390,
-  287371,
-  249085,
-  241364,
-  396520,
-  1555250,
-  1555251,
-  1555260,
-  1555261,
-  1555263,
-  673500,
-  1069580,
-  1278260,
-  1351010,
-  1815040,
-  1778746,
-  1778743,
-  1778744,
-  1778742,
-  1778741,
-  1778745,
-  1778740,
-  1778752,
-  1778748,
-  1157310,
-  1778751,
-  1778747,
-  1778750,
-  1542360,
-  1064270,
-  873880,
-  1058360,
-  849307,
-  849310,
-  425110,
-  1700710,
-  55381,
-  55385,
-  55386,
-  55390,
-  55392,
-  55395,
-  55399,
-  676670,
-  1032030,
-  860050,
-  1048180,
-  1056980,
-  1557960,
-  768530,
-  1121370,
-  1550410,
-  1121940,
-  1763080,
-  974722,
-  974725,
-  814110,
-  1638280,
-  1347610,
-  412990,
-  722120,
-  42716,
-  1304440,
-  849305,
-  1443090,
-  258653,
-  526950,
-  35137,
-  1543680,
-  867240,
-  857280,
-  1590710,
-  1443084,
-  1443062,
-  1443064,
-  1415691,
-  1443018,
-  1268570,
-  1118272,
-  1118275,
-  1118288,
-  1118290,
-  1118292,
-  1085500,
-  1087121,
-  1087122,
-  1087123,
-  1087131,
-  1085440,
-  1005010,
-  1004890,
-  1004892,
-  1004893,
-  1004894,
-  1004920,
-  1004921,
-  1004960,
-  1004980,
-  1004990,
-  972350,
-  972351,
-  941180,
-  868424,
-  868423,
-  848790,
-  845000,
-  845020,
-  624620,
-  624622,
-  515300,
-  513031,
-  513032,
-  513034,
-  378552,
-  289881,
-  277730,
-  259900,
-  250810,
-  224462,
-  213311,
-  200620,
-  55203,
-  35425,
-  45302,
-  1587640,
-  1308182,
-  333790,
-  1767420,
-  1766020,
-  862610,
-  865210,
-  1271792,
-  894600,
-  850260,
-  491494,
-  320353,
-  1020100,
-  1098291,
-  880283,
-  1531602,
-  1195990,
-  1748990,
-  1353060,
-  1466340,
-  1236500,
-  675340,
-  595200,
-  539310,
-  965720,
-  1256030,
-  564791,
-  1677171,
-  71164,
-  1354010,
-  560940,
-  350690,
-  1284921,
-  1016870,
-  1573740,
-  1287600,
-  1287602,
-  625172,
-  1084820,
-  73119,
-  73120,
-  975490,
-  1640500,
-  773500,
-  393830,
-  393831,
-  414651,
-  434400,
-  1293080,
-  1777410,
-  907370,
-  1676010,
-  1571590,
-  94202,
-  1366920,
-  1262571,
-  1033890,
-  885960,
-  1816540,
-  1660900,
-  1401490,
-  1054730,
-  468550,
-  271479,
-  309991,
-  205636,
-  934640,
-  1767240,
-  830451,
-  289730,
-  914340,
-  816790,
-  1822990,
-  1794570,
-  1545860,
-  1630728,
-  1819790,
-  1109920,
-  1467052,
-  763370,
-  1538940,
-  1588830,
-  1307440,
-  1143890,
-  884620,
-  720790,
-  658000,
-  564780,
-  1272930,
-  1572490,
-  1412761,
-  1012081,
-  98820,
-  1570180,
-  836900,
-  1086870,
-  728302,
-  1415690,
-  1544401,
-  1392840,
-  1824400,
-  1064273,
-  41019,
-  1641310,
-  1207470,
-  947930,
-  929106,
-  1811930,
-  1810400,
-  1065491,
-  636501,
-  1826580,
-  1773430,
-  988810,
-  258397,
-  402700,
-  539040,
-  888872,
-  1745290,
-  1016871,
-  1537610,
-  623619,
-  1542040,
-  1259810,
-  1016230,
-  1656800,
-  1573040,
-  1792980,
-  1626250,
-  311020,
-  1789190,
-  919680,
-  886910,
-  1809150,
-  791890,
-  1717655,
-  1717656,
-  1767340,
-  1238871,
-  691110,
-  1811800,
-  1811790,
-  1812350,
-  1635852,
-  1072380,
-  1798250,
-  1798251,
-  1809410,
-  1809413,
-  1809414,
-  1809411,
-  1809412,
-  513030,
-  16866,
-  803381,
-  343462,
-  1815930,
-  1813220,
-  1790540,
-  1689810,
-  1237524,
-  1203043,
-  638180,
-  1474030,
-  1793590,
-  1010190,
-  1359660,
-  891810,
-  1723912,
-  1723913,
-  1210300,
-  1445561,
-  1445560,
-  1748411,
-  1304414,
-  943420,
-  1587590,
-  1575881,
-  1575888,
-  72771,
-  1643351,
-  1537992,
-  1652430,
-  1819720,
-  1822850,
-  1820650,
-  1820670,
-  1785740,
-  1149640,
-  1751430,
-  1137940,
-  863520,
-  1608540,
-  1174880,
-  1438980,
-  1581690,
-  1581691,
-  1581692,
-  1303193,
-  1365220,
-  1633650,
-  461248,
-  1717652,
-  1346540,
-  929680,
-  804760,
-  1584710,
-  1552850,
-  1811230,
-  1820970,
-  933130,
-  952890,
-  952891,
-  952892,
-  1497160,
-  801650,
-  801670,
-  1657990,
-  801680,
-  801690,
-  801720,
-  1042360,
-  1781000,
-  1732856,
-  1353170,
-  1347750,
-  1304418,
-  1139930,
-  567810,
-  1515110,
-  1601720,
-  1735890,
-  1766280,
-  1232251,
-  1098300,
-  575310,
-  1758570,
-  1133090,
-  1128940,
-  1314563,
-  71160,
-  1187880,
-  1230271,
-  982201,
-  984210,
-  970060,
-  1590400,
-  1573830,
-  439410,
-  530590,
-  353310,
-  345190,
-  1799390,
-  1198470,
-  1817950,
-  1816280,
-  1816290,
-  274110,
-  876450,
-  842330,
-  1045630,
-  1176204,
-  1708620,
-  528330,
-  528310,
-  527610,
-  1710370,
-  1431030,
-  1331220,
-  668710,
-  1590712,
-  1515480,
-  1515481,
-  1515482,
-  1515483,
-  1515484,
-  1799880,
-  1775934,
-  1812490,
-  1135280,
-  1740520,
-  1516630,
-  1623740,
-  1634510,
-  1649990,
-  1599050,
-  1654481,
-  1235743,
-  446520,
-  449390,
-  449391,
-  449393,
-  439501,
-  329100,
-  210896,
-  210892,
-  832350,
-  1631810,
-  1581901,
-  892660,
-  506971,
-  300460,
-  226991,
-  1154770,
-  1541290,
-  691140,
-  1385930,
-  1250740,
-  1645390,
-  1549890,
-  1674690,
-  1475530,
-  974570,
-  1814390,
-  1466160,
-  1690330,
-  1365020,
-  730614,
-  1417600,
-  1361280,
-  1024770,
-  1810690,
-  695680,
-  247302,
-  201273,
-  1072410,
-  1503870,
-  244060,
-  224168,
-  224164,
-  275700,
-  1692462,
-  1692463,
-  1692464,
-  1692466,
-  1692465,
-  1678640,
-  1785610,
-  1583120,
-  35095,
-  1770020,
-  1648680,
-  1648681,
-  1648682,
-  1630250,
-  857390,
-  1645370,
-  1720890,
-  1583680,
-  1670720,
-  1725505,
-  1645380,
-  1652550,
-  1670220,
-  1549910,
-  1645400,
-  1418841,
-  1611610,
-  1568350,
-  1549920,
-  1645410,
-  1611620,
-  1356900,
-  1651050,
-  1645420,
-  1716340,
-  1651060,
-  1811060,
-  1645430,
-  229750,
-  1651070,
-  1645440,
-  1635970,
-  1744260,
-  1651080,
-  799130,
-  406440,
-  1626540,
-  1628080,
-  1316022,
-  859320,
-  329150,
-  1657030,
-  1083590,
-  17095,
-  311500,
-  1657040,
-  1746900,
-  281050,
-  1454560,
-  1723880,
-  1801960,
-  560360,
-  1621740,
-  1723890,
-  1801970,
-  1100250,
-  1701984,
-  1701983,
-  1701982,
-  1701981,
-  1701980,
-  1357360,
-  760610,
-  1205430,
-  1265910,
-  1265911,
-  1796420,
-  1236501,
-  1162600,
-  1162602,
-  878460,
-  878461,
-  878464,
-  878465,
-  878466,
-  878467,
-  580020,
-  1114550,
-  1114560,
-  1114561,
-  1289450,
-  1289452,
-  1289453,
-  1289454,
-  592370,
-  592371,
-  592372,
-  592373,
-  1302660,
-  1820520,
-  1581939,
-  1711032,
-  1728650,
-  1781070,
-  1424920,
-  1776020,
-  709650,
-  1615730,
-  1794650,
-  1801120,
-  1805010,
-  1811250,
-  1804790,
-  758771,
-  415750,
-  306394,
-  1761140,
-  1761150,
-  1581938,
-  1581936,
-  1581935,
-  1581933,
-  1581932,
-  1781930,
-  1542030,
-  1700720,
-  794340,
-  894710,
-  620680,
-  844890,
-  1643231,
-  1142800,
-  1091680,
-  794341,
-  540721,
-  1761610,
-  1817090,
-  1799680,
-  316446,
-  1535990,
-  1542200,
-  1539900,
-  939840,
-  313380,
-  1736994,
-  1736993,
-  318412,
-  318414,
-  313373,
-  1238030,
-  473850,
-  1460920,
-  1228540,
-  1581937,
-  509430,
-  1820310,
-  1504040,
-  1288340,
-  509031,
-  509032,
-  1676041,
-  888720,
-  796190,
-  1357160,
-  1215230,
-  453360,
-  1353080,
-  1304444,
-  1304460,
-  273153,
-  260471,
-  1708090,
-  463090,
-  345380,
-  206160,
-  222108,
-  1205361,
-  412580,
-  1737631,
-  1209531,
-  1070060,
-  531810,
-  206095,
-  206093,
-  206094,
-  1699470,
-  1678890,
-  1778810,
-  1755510,
-  1585810,
-  1303891,
-  1802260,
-  1413450,
-  1350680,
-  530611,
-  1811020,
-  304310,
-  908212,
-  1405240,
-  292320,
-  1571850,
-  1784491,
-  1622930,
-  1801744,
-  1695300,
-  1196150,
-  406580,
-  832700,
-  217900,
-  1771760,
-  1685721,
-  1531470,
-  1038500,
-  1281880,
-  554791,
-  1338740,
-  948680,
-  277757,
-  244390,
-  22410,
-  1643990,
-  1367290,
-  1478720,
-  941969,
-  1592630,
-  1423640,
-  692080,
-  1270340,
-  1203045,
-  660080,
-  279111,
-  279112,
-  279110,
-  261160,
-  48232,
-  48231,
-  343956,
-  1505320,
-  1027880,
-  1538960,
-  1304468,
-  1166470,
-  1056780,
-  754921,
-  1180120,
-  1148020,
-  1557310,
-  1196510,
-  378501,
-  560410,
-  223790,
-  1002130,
-  850210,
-  1301740,
-  754680,
-  870270,
-  870970,
-  590391,
-  364220,
-  1147157,
-  692120,
-  347154,
-  1599750,
-  1771370,
-  1362660,
-  1304410,
-  1049440,
-  776480,
-  1490114,
-  234791,
-  1126200,
-  1150380,
-  1453650,
-  629751,
-  1257,
-  1397381,
-  497660,
-  246255,
-  1074420,
-  500370,
-  441720,
-  324290,
-  1819270,
-  1805330,
-  201271,
-  1724230,
-  47892,
-  1090130,
-  798870,
-  798880,
-  1817751,
-  1416420,
-  1685640,
-  612960,
-  608160,
-  1313020,
-  794342,
-  684851,
-  1418848,
-  1304446,
-  1304464,
-  1252750,
-  1146830,
-  1418847,
-  873871,
-  745440,
-  774431,
-  776420,
-  770030,
-  773280,
-  974780,
-  751030,
-  755430,
-  754670,
-  754070,
-  750280,
-  744310,
-  1639960,
-  1364224,
-  1725190,
-  1531600,
-  1531601,
-  1531603,
-  1364220,
-  1364221,
-  1364222,
-  1037510,
-  1773801,
-  1324970,
-  1116060,
-  1761020,
-  1804680,
-  222568,
-  1800840,
-  1800870,
-  1800880,
-  335981,
-  1230180,
-  237800,
-  1798560,
-  1009820,
-  930200,
-  260473,
-  208818,
-  1780830,
-  1086481,
-  896715,
-  701180,
-  1641203,
-  1490360,
-  1768690,
-  1751370,
-  1768370,
-  359490,
-  47894,
-  1734340,
-  1108460,
-  860233,
-  860231,
-  885660,
-  1660061,
-  1386820,
-  1127420,
-  927330,
-  860232,
-  860230,
-  1365000,
-  1409141,
-  1108461,
-  1283090,
-  707189,
-  210902,
-  789070,
-  602740,
-  499410,
-  1392270,
-  1035230,
-  529390,
-  255163,
-  492750,
-  1791550,
-  1799250,
-  1783590,
-  1783343,
-  1783344,
-  1783345,
-  1783346,
-  1783347,
-  1783348,
-  1782403,
-  1782404,
-  1782405,
-  1782406,
-  1782407,
-  1782490,
-  1782491,
-  1782492,
-  1783260,
-  1782493,
-  1782494,
-  1782495,
-  1782496,
-  1782497,
-  1782498,
-  1782499,
-  1782500,
-  1782501,
-  1782502,
-  1782280,
-  1745970,
-  1782400,
-  1782401,
-  1782402,
-  760200,
-  1590580,
-  1813520,
-  325991,
-  1485180,
-  1751201,
-  1235731,
-  1235741,
-  660850,
-  1059290,
-  798543,
-  1495710,
-  966690,
-  24055,
-  1814750,
-  1812520,
-  1809200,
-  1812530,
-  1809210,
-  1812540,
-  1812550,
-  1812310,
-  1812320,
-  1812330,
-  1293280,
-  1202060,
-  1538741,
-  1374610,
-  826083,
-  708172,
-  1651480,
-  1739140,
-  1802230,
-  1619190,
-  512030,
-  1817160,
-  1450420,
-  715850,
-  1348740,
-  1699070,
-  34174,
-  1811770,
-  1142330,
-  1090140,
-  1023930,
-  1717653,
-  1343770,
-  1109630,
-  1436890,
-  1430610,
-  1283091,
-  712160,
-  306541,
-  411892,
-  817560,
-  1722693,
-  1722691,
-  1722692,
-  1741700,
-  1757080,
-  1543420,
-  1049940,
-  367290,
-  1813810,
-  1606254,
-  1482080,
-  1810170,
-  1687500,
-  1136150,
-  1090162,
-  1810090,
-  1591070,
-  1151170,
-  316441,
-  1295240,
-  1174370,
-  1638400,
-  1315871,
-  409143,
-  409144,
-  409145,
-  409146,
-  1167860,
-  1779830,
-  1200346,
-  364324,
-  1202055,
-  1816630,
-  1785960,
-  1475040,
-  1775932,
-  1374870,
-  1809128,
-  1184350,
-  1123650,
-  1003310,
-  890250,
-  1758970,
-  406590,
-  1622670,
-  1695290,
-  881830,
-  661770,
-  349130,
-  1103840,
-  258810,
-  376946,
-  326024,
-  1525880,
-  1147010,
-  486570,
-  224144,
-  1217600,
-  1017030,
-  438470,
-  1437660,
-  1238090,
-  316965,
-  316444,
-  316445,
-  1782530,
-  237070,
-  55393,
-  1045100,
-  1336320,
-  1316880,
-  1154590,
-  311600,
-  409140,
-  1041460,
-  409141,
-  409142,
-  47931,
-  425790,
-  367680,
-  505410,
-  887120,
-  1804160,
-  1055880,
-  354700,
-  354701,
-  1356221,
-  347070,
-  10195,
-  1804030,
-  1764063,
-  1488600,
-  1784030,
-  1206450,
-  1206451,
-  1538930,
-  1167870,
-  25962,
-  946430,
-  1579150,
-  971924,
-  971925,
-  971998,
-  971999,
-  971995,
-  971996,
-  918540,
-  1176870,
-  837990,
-  617100,
-  851860,
-  617110,
-  851870,
-  617120,
-  617140,
-  1085410,
-  1814660,
-  1578620,
-  1288240,
-  861888,
-  569000,
-  1098290,
-  1450700,
-  1731640,
-  1425450,
-  1811030,
-  1811830,
-  1810420,
-  65733,
-  1791380,
-  1615790,
-  1801130,
-  1808070,
-  624371,
-  570362,
-  1727240,
-  947650,
-  1347920,
-  1252740,
-  1507470,
-  1376280,
-  1292300,
-  257371,
-  702980,
-  1228720,
-  1810010,
-  1118024,
-  1118025,
-  763697,
-  1813670,
-  1202520,
-  1204160,
-  1187260,
-  774071,
-  436121,
-  1784497,
-  1784494,
-  1784496,
-  1151070,
-  1090141,
-  461800,
-  861642,
-  1556590,
-  1744819,
-  1744817,
-  1744816,
-  1744815,
-  1744814,
-  1744813,
-  1744812,
-  1744810,
-  1795400,
-  1512220,
-  888240,
-  216172,
-  216173,
-  1661710,
-  218241,
-  1036480,
-  414150,
-  1104560,
-  23552,
-  945930,
-  208690,
-  331330,
-  924230,
-  380232,
-  458840,
-  458841,
-  527201,
-  527202,
-  527203,
-  527204,
-  527205,
-  523380,
-  449670,
-  449671,
-  730261,
-  1779350,
-  596120,
-  430260,
-  430261,
-  1200566,
-  65732,
-  393960,
-  1082353,
-  23550,
-  861641,
-  1393180,
-  1568410,
-  1092310,
-  1580920,
-  888854,
-  646670,
-  210934,
-  1805860,
-  1807040,
-  1801160,
-  791871,
-  1619070,
-  790520,
-  1804250,
-  791870,
-  1209700,
-  604210,
-  609430,
-  572120,
-  561860,
-  561900,
-  1813260,
-  1053590,
-  1388850,
-  1271671,
-  1080550,
-  325962,
-  1784499,
-  1647962,
-  1579992,
-  1299591,
-  1523180,
-  1146930,
-  979700,
-  734830,
-  277770,
-  1090730,
-  1474630,
-  979930,
-  892810,
-  520500,
-  1612670,
-  1611450,
-  1736390,
-  1099600,
-  1106070,
-  1098163,
-  735510,
-  1557600,
-  1174632,
-  1605090,
-  530597,
-  884143,
-  792330,
-  448190,
-  56489,
-  1801810,
-  1801811,
-  1801812,
-  1801813,
-  1801814,
-  1801815,
-  1801816,
-  1801817,
-  1801818,
-  1801819,
-  1801770,
-  1801771,
-  1801772,
-  1801773,
-  1801774,
-  1801775,
-  1801776,
-  1801777,
-  1801778,
-  1801779,
-  1801780,
-  1801781,
-  1801782,
-  1801783,
-  1801784,
-  1801785,
-  1801786,
-  1801787,
-  1801788,
-  1801789,
-  1801790,
-  1801791,
-  1801792,
-  1801793,
-  1801794,
-  1801795,
-  1801796,
-  1801797,
-  1801798,
-  1801799,
-  1801800,
-  1801801,
-  1801802,
-  1801803,
-  1801804,
-  1801805,
-  1801806,
-  1801807,
-  1801808,
-  1801809,
-  1801766,
-  1801750,
-  1801751,
-  1801752,
-  1801753,
-  1801754,
-  1801755,
-  1801756,
-  1801757,
-  1801758,
-  1801759,
-  1801760,
-  1801761,
-  1801762,
-  1801763,
-  1801764,
-  1801765,
-  1801767,
-  1801768,
-  1801769,
-  1801733,
-  1801734,
-  1801736,
-  1801737,
-  1801738,
-  1801739,
-  1801741,
-  1801742,
-  1801745,
-  1801746,
-  1801747,
-  1801748,
-  1801749,
-  1801730,
-  1801731,
-  1801732,
-  1801735,
-  1801740,
-  1801743,
-  1801728,
-  1801726,
-  1801729,
-  1801720,
-  1801721,
-  1801722,
-  1801723,
-  1801724,
-  1801725,
-  1801727,
-  900448,
-  223792,
-  1230481,
-  836930,
-  1630726,
-  72730,
-  729850,
-  361840,
-  584970,
-  1318290,
-  1160240,
-  500214,
-  426730,
-  376942,
-  222584,
-  222631,
-  208363,
-  557280,
-  486571,
-  373150,
-  1264340,
-  391860,
-  1399412,
-  982970,
-  1763930,
-  1301021,
-  737990,
-  219136,
-  1046900,
-  466546,
-  229230,
-  229250,
-  229290,
-  229190,
-  1664500,
-  1205930,
-  1507810,
-  987730,
-  935010,
-  536543,
-  894240,
-  1667070,
-  950559,
-  950561,
-  950556,
-  950557,
-  849540,
-  1794050,
-  236080,
-  1083670,
-  969110,
-  330860,
-  1590713,
-  595830,
-  917390,
-  225827,
-  225828,
-  225834,
-  225820,
-  225822,
-  225823,
-  225824,
-  225825,
-  225826,
-  224161,
-  224162,
-  224166,
-  224167,
-  224140,
-  224141,
-  224142,
-  224143,
-  224145,
-  224160,
-  1168710,
-  980590,
-  561140,
-  1151540,
-  437350,
-  422480,
-  327170,
-  327171,
-  1415692,
-  1081000,
-  1791330,
-  1690510,
-  1690511,
-  1690512,
-  1690513,
-  1522410,
-  1062400,
-  1645360,
-  1096040,
-  336370,
-  1498210,
-  593370,
-  317590,
-  1623570,
-  435570,
-  1709970,
-  1709971,
-  1709972,
-  1709973,
-  1709975,
-  1709976,
-  1709977,
-  1709978,
-  1709979,
-  1709980,
-  1709981,
-  1709982,
-  1709983,
-  1709984,
-  325981,
-  1266670,
-  915390,
-  1418710,
-  1805450,
-  1223060,
-  642802,
-  1613110,
-  1800450,
-  1028891,
-  950562,
-  1148180,
-  1799921,
-  1799920,
-  1474340,
-  1177880,
-  1784492,
-  1784493,
-  1784495,
-  1098293,
-  1784498,
-  1784490,
-  1479454,
-  1147100,
-  1314561,
-  683850,
-  546373,
-  1606930,
-  411110,
-  1720670,
-  1011540,
-  1393111,
-  1760130,
-  1237860,
-  322100,
-  1343500,
-  1236360,
-  1167663,
-  615380,
-  1243021,
-  1512080,
-  1797310,
-  1763461,
-  1763462,
-  1763460,
-  1642950,
-  904370,
-  1429753,
-  1349770,
-  989740,
-  1259930,
-  1449881,
-  1200550,
-  871651,
-  1633960,
-  1008540,
-  1515062,
-  1065140,
-  1806280,
-  1792990,
-  1747810,
-  1760290,
-  215257,
-  215256,
-  1768610,
-  1241279,
-  1196794,
-  1118029,
-  1101730,
-  1242741,
-  1242744,
-  1242747,
-  374760,
-  374770,
-  991061,
-  1671650,
-  558244,
-  1502330,
-  498790,
-  1737141,
-  1807010,
-  1807060,
-  460030,
-  350172,
-  1810910,
-  462050,
-  1797280,
-  1173920,
-  825570,
-  1560570,
-  1467210,
-  1392620,
-  1587622,
-  890050,
-  1700750,
-  1809080,
-  1212690,
-  945931,
-  1704220,
-  1050040,
-  1576260,
-  1587591,
-  1587592,
-  1587593,
-  1587594,
-  1587595,
-  1587596,
-  1587597,
-  1587598,
-  1587599,
-  1587620,
-  1587621,
-  1587623,
-  1575882,
-  1575883,
-  1575884,
-  1575887,
-  1149760,
-  1337690,
-  1805870,
-  1805880,
-  1805890,
-  1805900,
-  1802760,
-  1779320,
-  1802740,
-  1202030,
-  779935,
-  1801540,
-  376977,
-  1366900,
-  1368801,
-  434066,
-  405450,
-  1771590,
-  1771591,
-  1771592,
-  1771594,
-  1771593,
-  1592041,
-  1481380,
-  438150,
-  1782531,
-  1252200,
-  1028270,
-  1770430,
-  1649810,
-  1737770,
-  1049810,
-  496580,
-  405030,
-  573580,
-  1606253,
-  1806153,
-  1794052,
-  1794051,
-  1794053,
-  1785830,
-  1806147,
-  1806157,
-  1806159,
-  1806140,
-  1806143,
-  1806146,
-  1806149,
-  1806151,
-  1806156,
-  1806150,
-  1806170,
-  1806144,
-  1806152,
-  1806145,
-  1806158,
-  1806148,
-  1806155,
-  1806154,
-  1806141,
-  1780910,
-  1303184,
-  920630,
-  1490117,
-  238304,
-  1663110,
-  954060,
-  1786890,
-  582570,
-  1241276,
-  1267099,
-  1267097,
-  1267101,
-  1267080,
-  1267092,
-  1267102,
-  1267090,
-  1267100,
-  1267105,
-  1267093,
-  1267095,
-  1267091,
-  1267094,
-  1267104,
-  1267106,
-  1267103,
-  1267098,
-  1024704,
-  1530430,
-  401629,
-  691560,
-  491780,
-  496900,
-  468510,
-  650840,
-  602720,
-  410530,
-  410531,
-  623270,
-  710830,
-  802000,
-  623100,
-  854050,
-  996910,
-  404570,
-  989810,
-  321140,
-  321141,
-  321142,
-  935590,
-  964530,
-  365520,
-  365530,
-  365540,
-  822010,
-  1150680,
-  526300,
-  367890,
-  335250,
-  1436850,
-  880281,
-  316960,
-  1775933,
-  1120260,
-  1120290,
-  1053570,
-  1370260,
-  1370080,
-  1370100,
-  1053550,
-  1370230,
-  1052630,
-  649272,
-  1182230,
-  649271,
-  962430,
-  740050,
-  649270,
-  670570,
-  771750,
-  981840,
-  356900,
-  1147158,
-  373370,
-  322000,
-  291900,
-  274050,
-  495930,
-  215374,
-  411930,
-  40392,
-  1202031,
-  1202040,
-  1202042,
-  1202044,
-  1202045,
-  1202053,
-  1202062,
-  1755050,
-  1691670,
-  1174631,
-  1156710,
-  1462530,
-  1209461,
-  1144582,
-  627390,
-  584097,
-  1590562,
-  1590560,
-  1590551,
-  1804660,
-  1275920,
-  1404250,
-  1431482,
-  1396473,
-  844190,
-  774041,
-  304380,
-  395180,
-  1441728,
-  724440,
-  724420,
-  798390,
-  744950,
-  332350,
-  1227700,
-  1251220,
-  1506340,
-  1424830,
-  530595,
-  1698300,
-  1798370,
-  1625560,
-  1625590,
-  1638900,
-  784070,
-  208283,
-  1698190,
-  283740,
-  206085,
-  206086,
-  34342,
-  222045,
-  222046,
-  1689950,
-  222048,
-  222049,
-  1291630,
-  1291632,
-  584820,
-  459660,
-  1689760,
-  1751203,
-  1751204,
-  1316262,
-  669640,
-  450530,
-  866850,
-  740710,
-  1088930,
-  385510,
-  1776850,
-  1176207,
-  1795050,
-  1782340,
-  448183,
-  208575,
-  1710650,
-  1695440,
-  1446770,
-  1224210,
-  466542,
-  229632,
-  229631,
-  1604970,
-  1575764,
-  1618840,
-  1111790,
-  396171,
-  47898,
-  1656221,
-  1656222,
-  1490113,
-  395233,
-  1284470,
-  648301,
-  1789240,
-  1231060,
-  1796760,
-  1478300,
-  1783573,
-  1783570,
-  1783571,
-  1796770,
-  1783572,
-  1783574,
-  1783575,
-  1783576,
-  1482170,
-  1801080,
-  1447200,
-  1793460,
-  1333220,
-  974650,
-  1797810,
-  1797860,
-  1300710,
-  1704460,
-  1567970,
-  958390,
-  1772850,
-  1201080,
-  1044440,
-  1707535,
-  1707534,
-  1707531,
-  1140640,
-  450000,
-  771720,
-  1749280,
-  1749281,
-  1749282,
-  1749283,
-  1749284,
-  1291700,
-  525031,
-  1682010,
-  1468290,
-  592670,
-  799520,
-  799522,
-  925100,
-  925101,
-  582880,
-  1307430,
-  1235732,
-  1214480,
-  1045170,
-  758290,
-  785910,
-  1782830,
-  1430990,
-  861889,
-  208981,
-  1094740,
-  1004891,
-  715890,
-  868280,
-  821170,
-  258460,
-  1708720,
-  1596710,
-  1596711,
-  525012,
-  1737630,
-  206091,
-  206090,
-  206092,
-  1594030,
-  1781320,
-  1761180,
-  1743970,
-  1743980,
-  1743990,
-  1743950,
-  382467,
-  1193613,
-  1193612,
-  1193611,
-  1193610,
-  1174313,
-  1157161,
-  1174310,
-  1174311,
-  1174312,
-  1157160,
-  1135721,
-  1157162,
-  1157163,
-  1120711,
-  1120720,
-  1135720,
-  1120710,
-  1102321,
-  1102320,
-  1102323,
-  1082662,
-  1102322,
-  1082660,
-  1082661,
-  1063781,
-  1063780,
-  1048931,
-  1048930,
-  1034292,
-  1034291,
-  1034290,
-  1013213,
-  994130,
-  988150,
-  562387,
-  1474730,
-  1049900,
-  1033530,
-  582573,
-  741370,
-  653728,
-  265461,
-  1096580,
-  558762,
-  1418845,
-  232647,
-  208793,
-  65244,
-  24065,
-  945450,
-  862450,
-  617960,
-  223793,
-  640900,
-  894670,
-  1120620,
-  1647450,
-  208355,
-  1748780,
-  525013,
-  413390,
-  376976,
-  1072063,
-  1633540,
-  1633570,
-  530596,
-  525000,
-  1713900,
-  1481570,
-  953981,
-  849262,
-  325504,
-  1447440,
-  525720,
-  420310,
-  99612,
-  614004,
-  500218,
-  210012,
-  1405650,
-  1189700,
-  1076630,
-  352590,
-  1751040,
-  327270,
-  328820,
-  1466780,
-  348040,
-  1536370,
-  1067010,
-  316910,
-  1679031,
-  1679030,
-  1426770,
-  225832,
-  208376,
-  1495680,
-  1251610,
-  1368210,
-  293054,
-  941950,
-  318850,
-  208304,
-  731101,
-  1639460,
-  731100,
-  200440,
-  1806180,
-  1450460,
-  940500,
-  895491,
-  244230,
-  94303,
-  748341,
-  1748559,
-  1748569,
-  961840,
-  42696,
-  1805460,
-  1198461,
-  1200552,
-  593052,
-  250310,
-  210014,
-  1805430,
-  1805440,
-  1802310,
-  1353360,
-  378648,
-  265192,
-  1304463,
-  264600,
-  215534,
-  1346910,
-  1128880,
-  577353,
-  258654,
-  1401480,
-  1180720,
-  530599,
-  1218040,
-  1304469,
-  942540,
-  709830,
-  920563,
-  885270,
-  448186,
-  1555040,
-  1485720,
-  768240,
-  691490,
-  692151,
-  388294,
-  388290,
-  227129,
-  598110,
-  1347520,
-  1788240,
-  523011,
-  272700,
-  1032370,
-  649410,
-  977070,
-  1166472,
-  1352581,
-  942240,
-  1211940,
-  534840,
-  397030,
-  1743840,
-  1147230,
-  1374340,
-  1056360,
-  799751,
-  1244780,
-  201272,
-  42695,
-  1800800,
-  1185910,
-  1481770,
-  980541,
-  413160,
-  1799480,
-  1805290,
-  1782220,
-  71162,
-  307610,
-  277751,
-  804640,
-  291790,
-  345470,
-  323560,
-  449720,
-  1314764,
-  580440,
-  457087,
-  1401460,
-  975360,
-  1441878,
-  1804700,
-  1452490,
-  1357180,
-  1307680,
-  513033,
-  325993,
-  1673610,
-  1441872,
-  1690300,
-  1616010,
-  1057070,
-  610070,
-  496101,
-  209460,
-  1796490,
-  1120630,
-  807080,
-  1480500,
-  1267510,
-  580100,
-  304212,
-  1416390,
-  895493,
-  1521480,
-  1717650,
-  584095,
-  445450,
-  1104680,
-  22440,
-  1741540,
-  208810,
-  208813,
-  208791,
-  208792,
-  208806,
-  208807,
-  1769710,
-  1790720,
-  1640390,
-  1797210,
-  1121030,
-  1762542,
-  1779601,
-  1762543,
-  1779600,
-  1762540,
-  1762541,
-  1777850,
-  1367570,
-  1777450,
-  539260,
-  1538740,
-  471891,
-  861887,
-  1748540,
-  1748541,
-  1748542,
-  1748543,
-  1748544,
-  1748545,
-  1748546,
-  1748547,
-  1748548,
-  1748549,
-  1748501,
-  1748502,
-  1748503,
-  1748504,
-  1748505,
-  1748506,
-  1748507,
-  1748508,
-  1748509,
-  1748520,
-  1748521,
-  1748522,
-  1748523,
-  1748524,
-  1748525,
-  1748526,
-  1748527,
-  1748528,
-  1748529,
-  1344320,
-  695860,
-  515190,
-  1799330,
-  1272657,
-  277740,
-  208350,
-  1748536,
-  1748537,
-  1748538,
-  1748539,
-  1748440,
-  1748441,
-  1748442,
-  1748443,
-  1748449,
-  1748531,
-  1748530,
-  1748532,
-  1748533,
-  1748534,
-  1748535,
-  1748444,
-  1748445,
-  1748446,
-  1748447,
-  1748448,
-  1748486,
-  1748487,
-  1748489,
-  1748484,
-  1748488,
-  1748466,
-  1748460,
-  1748461,
-  1748462,
-  1748463,
-  1748464,
-  1748465,
-  1748467,
-  1748468,
-  1748469,
-  1748480,
-  1748481,
-  1748482,
-  1748483,
-  1748485,
-  1748500,
-  1748470,
-  1748471,
-  1748472,
-  1748473,
-  1748474,
-  1748475,
-  1748477,
-  1748479,
-  1748476,
-  1748478,
-  1748556,
-  1748558,
-  1748550,
-  1748555,
-  1748557,
-  1748565,
-  1748567,
-  1748568,
-  1748560,
-  1748551,
-  1748552,
-  1748553,
-  1748554,
-  1748561,
-  1748563,
-  1748564,
-  1748566,
-  1748562,
-  1799960,
-  1799961,
-  1613281,
-  1613280,
-  1248530,
-  1396510,
-  1300980,
-  1153230,
-  1244920,
-  1048110,
-  469910,
-  71120,
-  1182000,
-  1120300,
-  1752320,
-  258270,
-  1314765,
-  779930,
-  395238,
-  311660,
-  1129370,
-  372110,
-  221001,
-  1799780,
-  1799790,
-  1798400,
-  1799760,
-  1799770,
-  1798840,
-  1791170,
-  1791190,
-  1785840,
-  1756290,
-  1360970,
-  1236290,
-  1291631,
-  1278450,
-  1153310,
-  794880,
-  210070,
-  210071,
-  210078,
-  210079,
-  210080,
-  210081,
-  210082,
-  210099,
-  210100,
-  210101,
-  210102,
-  210103,
-  210104,
-  210105,
-  210106,
-  210107,
-  210108,
-  210109,
-  210110,
-  210111,
-  210112,
-  1556451,
-  1599485,
-  1599486,
-  1599483,
-  1636840,
-  1756590,
-  1599481,
-  1599480,
-  1599482,
-  1696000,
-  1793470,
-  1599484,
-  395239,
-  395237,
-  395230,
-  396173,
-  395234,
-  395236,
-  396170,
-  395235,
-  1277250,
-  1263320,
-  1215130,
-  395232,
-  1157930,
-  1077690,
-  1356050,
-  1454350,
-  1462090,
-  1166471,
-  937891,
-  1626003,
-  1626001,
-  1125020,
-  1350040,
-  828790,
-  433741,
-  1796460,
-  544671,
-  1656380,
-  1209600,
-  1590564,
-  1753570,
-  1753580,
-  1753560,
-  597076,
-  1791130,
-  1791140,
-  1791150,
-  1786040,
-  1725541,
-  1713800,
-  1725540,
-  1658950,
-  1737351,
-  1605980,
-  907510,
-  1412520,
-  1558310,
-  1773910,
-  1120304,
-  1160243,
-  919051,
-  1316181,
-  1784391,
-  1784394,
-  1784400,
-  1784401,
-  1784404,
-  1784390,
-  1723902,
-  1723903,
-  1751200,
-  393990,
-  415220,
-  415221,
-  363590,
-  363591,
-  1759370,
-  208811,
-  208814,
-  16860,
-  1484870,
-  1628070,
-  1198462,
-  1791720,
-  1705910,
-  1424430,
-  1392850,
-  1359180,
-  1134340,
-  889420,
-  755710,
-  530280,
-  624590,
-  1760120,
-  355740,
-  1548770,
-  428730,
-  496432,
-  1590860,
-  1196784,
-  293059,
-  273380,
-  1396840,
-  852240,
-  998960,
-  1345990,
-  388780,
-  929350,
-  395231,
-  1429752,
-  1026740,
-  1190440,
-  1308180,
-  1238760,
-  257370,
-  941973,
-  50146,
-  967289,
-  1800720,
-  1793640,
-  1361831,
-  1537990,
-  1537991,
-  1537993,
-  1799430,
-  1801840,
-  1389911,
-  581400,
-  1134010,
-  558390,
-  493530,
-  937650,
-  47880,
-  1790570,
-  1632740,
-  919000,
-  210895,
-  1423070,
-  546360,
-  1436950,
-  64002,
-  1725960,
-  202520,
-  202523,
-  1775030,
-  477880,
-  105413,
-  1793480,
-  1316074,
-  1666900,
-  1727300,
-  1487530,
-  1348660,
-  648290,
-  805640,
-  1781570,
-  1429990,
-  1340940,
-  1171190,
-  715950,
-  880640,
-  404090,
-  1674350,
-  1631380,
-  720800,
-  1010940,
-  313370,
-  313371,
-  313372,
-  313374,
-  313381,
-  318550,
-  311670,
-  319360,
-  319361,
-  318390,
-  318400,
-  318401,
-  318402,
-  318413,
-  1141710,
-  533110,
-  561630,
-  716270,
-  1441990,
-  1709890,
-  1797620,
-  1426250,
-  1098292,
-  1692370,
-  1239010,
-  1429756,
-  1630729,
-  1521030,
-  1074660,
-  520900,
-  557290,
-  412430,
-  1144643,
-  794143,
-  463590,
-  1702810,
-  1773940,
-  1773100,
-  1799120,
-  1799100,
-  1794630,
-  1443000,
-  1569330,
-  1569331,
-  1569332,
-  1569333,
-  1569334,
-  1286400,
-  1783640,
-  1644210,
-  1608480,
-  1268270,
-  619790,
-  1463090,
-  1093700,
-  579670,
-  579671,
-  579672,
-  622450,
-  766870,
-  630940,
-  1108410,
-  602310,
-  583635,
-  430345,
-  739256,
-  1290630,
-  1798800,
-  405130,
-  1681090,
-  1636343,
-  1209132,
-  566390,
-  586910,
-  1611050,
-  1786310,
-  1200348,
-  932660,
-  1232250,
-  361820,
-  1715300,
-  1694850,
-  1771670,
-  1232256,
-  1233060,
-  1233061,
-  1396470,
-  1396471,
-  1396472,
-  325952,
-  730080,
-  1228530,
-  1067590,
-  886920,
-  1794410,
-  1772190,
-  1010440,
-  502560,
-  470230,
-  1784850,
-  1788080,
-  1045190,
-  411920,
-  1434030,
-  845010,
-  240300,
-  1161420,
-  1645520,
-  1202061,
-  1606090,
-  42968,
-  1198834,
-  1208880,
-  672270,
-  740160,
-  507510,
-  1472800,
-  1585820,
-  657422,
-  568380,
-  1478000,
-  657430,
-  536740,
-  536741,
-  404430,
-  376935,
-  1477780,
-  1194470,
-  208817,
-  1292130,
-  1195301,
-  272680,
-  820200,
-  995653,
-  529930,
-  379575,
-  1754660,
-  301660,
-  1530012,
-  1561770,
-  244066,
-  929550,
-  915590,
-  577401,
-  258751,
-  1681201,
-  1088482,
-  1012102,
-  574990,
-  65229,
-  65228,
-  343594,
-  990932,
-  943840,
-  500271,
-  55341,
-  638011,
-  624370,
-  728301,
-  530380,
-  689810,
-  327176,
-  258750,
-  42964,
-  387920,
-  619570,
-  561470,
-  908210,
-  804643,
-  804645,
-  1797730,
-  844340,
-  533602,
-  301900,
-  1308183,
-  1752350,
-  1762210,
-  1570380,
-  1746580,
-  35089,
-  208570,
-  35083,
-  1352583,
-  640070,
-  245810,
-  1156273,
-  1156272,
-  1161561,
-  1161560,
-  1156271,
-  1201821,
-  1156270,
-  1156140,
-  1201820,
-  1630727,
-  1191060,
-  1314562,
-  418221,
-  411900,
-  343953,
-  255691,
-  1311098,
-  418220,
-  1796400,
-  1464740,
-  492890,
-  492891,
-  492892,
-  952670,
-  952671,
-  980050,
-  1494339,
-  1087423,
-  203358,
-  1756560,
-  1768890,
-  1752120,
-  1768601,
-  1707160,
-  1581780,
-  1246400,
-  1676043,
-  944350,
-  888650,
-  971630,
-  1637256,
-  1054071,
-  1105950,
-  1768770,
-  1779580,
-  583640,
-  1768771,
-  1468450,
-  970100,
-  970110,
-  1672150,
-  208300,
-  277734,
-  1429754,
-  889890,
-  425360,
-  247309,
-  266730,
-  247300,
-  247301,
-  247304,
-  247305,
-  247295,
-  238300,
-  238302,
-  238303,
-  247290,
-  208804,
-  208805,
-  208795,
-  208796,
-  208797,
-  208798,
-  208799,
-  208800,
-  208802,
-  1796360,
-  1791470,
-  1791471,
-  34274,
-  1144684,
-  1752130,
-  775410,
-  208801,
-  208803,
-  1774670,
-  238230,
-  222680,
-  204380,
-  204384,
-  204385,
-  204386,
-  208541,
-  208544,
-  208546,
-  203700,
-  203701,
-  797050,
-  955140,
-  526020,
-  1418300,
-  108726,
-  896719,
-  1429757,
-  1211470,
-  1230274,
-  704286,
-  704287,
-  980547,
-  774751,
-  774752,
-  774753,
-  896745,
-  342000,
-  1360120,
-  953660,
-  891230,
-  821090,
-  611420,
-  611421,
-  649390,
-  611400,
-  1792310,
-  1792320,
-  1792330,
-  1792340,
-  1749102,
-  1259360,
-  960920,
-  960850,
-  834360,
-  827240,
-  768340,
-  760070,
-  721341,
-  721340,
-  642780,
-  625171,
-  625170,
-  625050,
-  617961,
-  538021,
-  538020,
-  487150,
-  472030,
-  443720,
-  436120,
-  415680,
-  414300,
-  373400,
-  373380,
-  373160,
-  354790,
-  338162,
-  338160,
-  327831,
-  327830,
-  310034,
-  310033,
-  310032,
-  310030,
-  304590,
-  295222,
-  295221,
-  295220,
-  279623,
-  279622,
-  279621,
-  279620,
-  278712,
-  278711,
-  278710,
-  241373,
-  241372,
-  241371,
-  241370,
-  241368,
-  241367,
-  241366,
-  241365,
-  241363,
-  241362,
-  241361,
-  241360,
-  1641204,
-  1641200,
-  1641202,
-  1641201,
-  1641205,
-  1437611,
-  1628870,
-  325723,
-  1182293,
-  1182292,
-  1182291,
-  1182294,
-  1594140,
-  1712070,
-  756070,
-  765960,
-  1688480,
-  1726200,
-  1264170,
-  896680,
-  260474,
-  227131,
-  208491,
-  1700310,
-  1257790,
-  1795500,
-  1794500,
-  1788140,
-  933980,
-  500270,
-  911930,
-  1735710,
-  1575820,
-  779937,
-  1590520,
-  1783330,
-  435111,
-  1016150,
-  203778,
-  35102,
-  1784392,
-  1784393,
-  1784402,
-  1784403,
-  1556722,
-  864220,
-  1773270,
-  950558,
-  737780,
-  440961,
-  440962,
-  277755,
-  996630,
-  642080,
-  234770,
-  807320,
-  1166390,
-  1795650,
-  1122300,
-  874620,
-  1775931,
-  1556715,
-  1556716,
-  1556719,
-  1556720,
-  1556721,
-  1556723,
-  1556709,
-  1556710,
-  1556714,
-  1556717,
-  1556718,
-  1556708,
-  1556711,
-  1556712,
-  1556713,
-  1556700,
-  1556701,
-  1556702,
-  1556703,
-  1556704,
-  1556705,
-  1556706,
-  1556707,
-  1556729,
-  1556724,
-  1556725,
-  1556726,
-  1556727,
-  1556728,
-  1278240,
-  1647620,
-  1176202,
-  362000,
-  362001,
-  362002,
-  271750,
-  35101,
-  35098,
-  35097,
-  35096,
-  35094,
-  35093,
-  35087,
-  35086,
-  1248434,
-  1791670,
-  1189910,
-  237620,
-  988360,
-  1077280,
-  1792090,
-  1188830,
-  262340,
-  1784740,
-  731170,
-  727980,
-  1262670,
-  229080,
-  1509120,
-  201277,
-  1794820,
-  905689,
-  905706,
-  905684,
-  905701,
-  905700,
-  905681,
-  905704,
-  905687,
-  905682,
-  905702,
-  1711773,
-  905707,
-  905708,
-  905688,
-  905683,
-  905685,
-  905705,
-  905686,
-  913930,
-  631550,
-  631551,
-  1142880,
-  1793870,
-  550910,
-  1782433,
-  631560,
-  550333,
-  550334,
-  1009821,
-  984200,
-  919390,
-  416750,
-  815770,
-  419967,
-  824382,
-  824381,
-  824380,
-  1074980,
-  804647,
-  804646,
-  804644,
-  804642,
-  804641,
-  550335,
-  550330,
-  550331,
-  631554,
-  631552,
-  631553,
-  1409142,
-  826650,
-  1779420,
-  23553,
-  217350,
-  347181,
-  217410,
-  1221700,
-  247620,
-  1669200,
-  1690960,
-  1669201,
-  1690961,
-  1669202,
-  1690962,
-  1669203,
-  1690963,
-  1669204,
-  1690964,
-  35419,
-  232830,
-  1127040,
-  431490,
-  595333,
-  33936,
-  891302,
-  1499570,
-  1760470,
-  1760480,
-  1769971,
-  1777140,
-  1760500,
-  23551,
-  920730,
-  210943,
-  889630,
-  889640,
-  1283710,
-  1517030,
-  1125120,
-  213370,
-  728930,
-  1782436,
-  1782435,
-  1782434,
-  756080,
-  1782430,
-  1782431,
-  1782432,
-  756071,
-  1518080,
-  1363500,
-  1630170,
-  1709620,
-  517450,
-  536760,
-  1793230,
-  1606163,
-  1554620,
-  1441720,
-  469570,
-  469580,
-  403140,
-  1449440,
-  323290,
-  653230,
-  924730,
-  209202,
-  390760,
-  1521470,
-  454640,
-  416421,
-  324332,
-  1316550,
-  1146870,
-  717490,
-  404014,
-  267880,
-  729230,
-  1698500,
-  1787720,
-  319018,
-  208364,
-  1780580,
-  1482160,
-  1780660,
-  1784280,
-  1793790,
-  1794090,
-  511310,
-  413360,
-  1189900,
-  1785290,
-  1760490,
-  1604971,
-  1788000,
-  1673960,
-  868870,
-  394400,
-  339030,
-  339031,
-  339033,
-  339034,
-  855020,
-  738320,
-  382470,
-  419110,
-  418750,
-  397910,
-  397920,
-  397930,
-  72750,
-  215535,
-  215536,
-  70615,
-  1371406,
-  371060,
-  42719,
-  898570,
-  711681,
-  608680,
-  982310,
-  1449450,
-  525030,
-  255910,
-  1634040,
-  1289234,
-  933262,
-  1780030,
-  947720,
-  947730,
-  948430,
-  947700,
-  947710,
-  1304467,
-  1287601,
-  849311,
-  511892,
-  525019,
-  376660,
-  331180,
-  307800,
-  229660,
-  211521,
-  211522,
-  211523,
-  211520,
-  876980,
-  461241,
-  388478,
-  327177,
-  1741380,
-  591983,
-  1691460,
-  1287820,
-  1740030,
-  564200,
-  533590,
-  533591,
-  533592,
-  564190,
-  273490,
-  1120302,
-  1695490,
-  1670521,
-  710300,
-  404013,
-  1117850,
-  302101,
-  317490,
-  339430,
-  91609,
-  91616,
-  231480,
-  1140430,
-  1017510,
-  378504,
-  378505,
-  1082370,
-  1047180,
-  1780890,
-  1418849,
-  1271793,
-  564300,
-  318750,
-  567990,
-  1189690,
-  1247120,
-  1324190,
-  1066920,
-  740640,
-  358020,
-  247307,
-  210931,
-  210932,
-  210933,
-  210937,
-  210938,
-  35417,
-  711680,
-  204303,
-  1790910,
-  366420,
-  22364,
-  1006370,
-  1034100,
-  982630,
-  580600,
-  1034090,
-  1006290,
-  982640,
-  1742260,
-  1194660,
-  1192360,
-  277736,
-  222564,
-  1064221,
-  41014,
-  1733210,
-  1773960,
-  640920,
-  388472,
-  884000,
-  505420,
-  1282350,
-  1347090,
-  958370,
-  739620,
-  646664,
-  577403,
-  577404,
-  577405,
-  335510,
-  222557,
-  1737632,
-  565250,
-  565210,
-  565220,
-  565230,
-  565240,
-  416900,
-  354020,
-  259041,
-  258663,
-  235585,
-  222586,
-  208379,
-  99611,
-  200610,
-  16867,
-  16868,
-  618480,
-  1110730,
-  1357330,
-  1272650,
-  1392100,
-  1112520,
-  986060,
-  433242,
-  1715811,
-  1157170,
-  998810,
-  950820,
-  922430,
-  931920,
-  986510,
-  941220,
-  959160,
-  975560,
-  966360,
-  878920,
-  904580,
-  886930,
-  913810,
-  848020,
-  864980,
-  892400,
-  859130,
-  1261270,
-  565001,
-  758420,
-  568980,
-  203776,
-  1794200,
-  491550,
-  113204,
-  461243,
-  295196,
-  569716,
-  569717,
-  1120550,
-  71119,
-  770973,
-  721280,
-  651440,
-  212672,
-  1790320,
-  1141711,
-  1196780,
-  1196781,
-  1196783,
-  1196785,
-  1196786,
-  1196787,
-  1049020,
-  1357070,
-  1019512,
-  1019513,
-  1471520,
-  1034470,
-  868420,
-  741420,
-  562372,
-  551880,
-  465480,
-  463796,
-  463797,
-  463799,
-  437070,
-  440980,
-  463790,
-  463792,
-  373540,
-  531152,
-  210899,
-  1506350,
-  531165,
-  445261,
-  531166,
-  1539880,
-  1792180,
-  672271,
-  210561,
-  47895,
-  1124040,
-  1749680,
-  531151,
-  533557,
-  533558,
-  1482631,
-  1304442,
-  741350,
-  1140001,
-  376932,
-  562040,
-  1155320,
-  799330,
-  1381790,
-  610290,
-  1600590,
-  299280,
-  1791370,
-  1638420,
-  1638320,
-  1638370,
-  1638380,
-  492360,
-  489980,
-  1089671,
-  1458150,
-  1731960,
-  1735800,
-  1441660,
-  1166500,
-  1052740,
-  1762780,
-  1585382,
-  1585381,
-  1585380,
-  222593,
-  208280,
-  1769970,
-  237619,
-  416422,
-  1359880,
-  1361420,
-  649032,
-  1637259,
-  413380,
-  1178321,
-  1577783,
-  474762,
-  215004,
-  822330,
-  1700821,
-  1740980,
-  1735720,
-  1782360,
-  705460,
-  1552610,
-  779931,
-  779939,
-  376944,
-  259251,
-  1734380,
-  702540,
-  1259750,
-  550210,
-  769130,
-  379584,
-  1752450,
-  201882,
-  1785170,
-  1779360,
-  1779370,
-  1779380,
-  1779390,
-  1655870,
-  1724752,
-  1535740,
-  1377860,
-  1396430,
-  1057900,
-  1092820,
-  790090,
-  674920,
-  240611,
-  1589030,
-  1649230,
-  1492701,
-  1568390,
-  1018330,
-  1775070,
-  1703150,
-  1785760,
-  1785620,
-  1481490,
-  1000717,
-  1706404,
-  1706402,
-  1706400,
-  1706403,
-  1706401,
-  215971,
-  1755710,
-  1756270,
-  1420870,
-  1670520,
-  16465,
-  782470,
-  1069450,
-  914970,
-  1176201,
-  1789200,
-  463795,
-  1784520,
-  1784540,
-  1607380,
-  941965,
-  920569,
-  411891,
-  457086,
-  1782370,
-  974610,
-  481090,
-  750030,
-  750031,
-  830530,
-  1788580,
-  1649580,
-  1525630,
-  208342,
-  1732678,
-  1732700,
-  1732701,
-  1732702,
-  1732676,
-  1732677,
-  1732703,
-  1732634,
-  1732636,
-  1732637,
-  1732671,
-  1732672,
-  1732675,
-  1732814,
-  1732638,
-  1732639,
-  1732670,
-  1732673,
-  1732674,
-  1732632,
-  1732633,
-  1732635,
-  1732813,
-  1732854,
-  1732855,
-  1732857,
-  1732778,
-  1732771,
-  1732797,
-  1732798,
-  1732811,
-  1732812,
-  1732631,
-  1732795,
-  1732796,
-  1732630,
-  1732791,
-  1732793,
-  1732794,
-  1732787,
-  1732788,
-  1732789,
-  1732790,
-  1732792,
-  1732559,
-  1732853,
-  1732773,
-  1732774,
-  1732775,
-  1732776,
-  1732777,
-  1732779,
-  1732780,
-  1732781,
-  1732782,
-  1732783,
-  1732784,
-  1732556,
-  1732557,
-  1732558,
-  1732851,
-  1732852,
-  1732770,
-  1732772,
-  1732551,
-  1732552,
-  1732553,
-  1732554,
-  1732555,
-  1732850,
-  1732785,
-  1732786,
-  1732550,
-  335020,
-  1537360,
-  1539820,
-  1539821,
-  1539822,
-  1539823,
-  455041,
-  455042,
-  1715810,
-  1394020,
-  1392250,
-  1140370,
-  1375360,
-  258752,
-  1628251,
-  1180721,
-  404280,
-  1774850,
-  1283050,
-  208369,
-  376930,
-  1128391,
-  360115,
-  1648060,
-  1630732,
-  1127800,
-  1158780,
-  1786160,
-  813460,
-  1470400,
-  231465,
-  1776340,
-  1710440,
-  1456180,
-  642750,
-  1711370,
-  1662600,
-  1662620,
-  1742030,
-  515270,
-  428602,
-  1690780,
-  1787250,
-  711170,
-  1316141,
-  1728820,
-  747860,
-  650611,
-  1158790,
-  383400,
-  1316274,
-  415690,
-  1315807,
-  1598440,
-  1725720,
-  1580760,
-  1599030,
-  468737,
-  1775930,
-  1239250,
-  1718780,
-  222281,
-  1598442,
-  1209590,
-  836920,
-  651020,
-  1773920,
-  1242760,
-  1135972,
-  1775900,
-  1442980,
-  1762080,
-  1777070,
-  1773260,
-  1775420,
-  985110,
-  277777,
-  642807,
-  500211,
-  258643,
-  325959,
-  466541,
-  448192,
-  277760,
-  677960,
-  940080,
-  1144640,
-  564790,
-  824890,
-  666200,
-  1648400,
-  1005550,
-  1061700,
-  434064,
-  564792,
-  406620,
-  264804,
-  1457750,
-  1725721,
-  758390,
-  281770,
-  261340,
-  1503200,
-  977420,
-  534331,
-  404012,
-  420824,
-  756611,
-  478301,
-  756610,
-  478300,
-  379235,
-  1376530,
-  1015050,
-  1126050,
-  975280,
-  621927,
-  1703151,
-  1116621,
-  1001290,
-  1576330,
-  849302,
-  849304,
-  849301,
-  500232,
-  1115180,
-  1443080,
-  1776450,
-  1577330,
-  1579750,
-  1120990,
-  561950,
-  616850,
-  257320,
-  1424240,
-  1296731,
-  1176130,
-  1560930,
-  1230270,
-  325953,
-  295162,
-  277771,
-  258641,
-  222633,
-  1577540,
-  1169182,
-  629750,
-  1004930,
-  397121,
-  317770,
-  271400,
-  1770450,
-  931970,
-  506040,
-  1674570,
-  694190,
-  721270,
-  208346,
-  1028430,
-  870280,
-  271110,
-  288900,
-  1057271,
-  1773090,
-  401635,
-  1330070,
-  331491,
-  331492,
-  331490,
-  1030500,
-  501671,
-  307750,
-  1567110,
-  992176,
-  573832,
-  1028920,
-  1087120,
-  868428,
-  1087130,
-  971760,
-  1205380,
-  1120844,
-  376979,
-  858690,
-  1004940,
-  875440,
-  648730,
-  387020,
-  1196770,
-  861885,
-  1011890,
-  457200,
-  646672,
-  34278,
-  1080320,
-  1688120,
-  1363410,
-  370000,
-  561400,
-  205633,
-  201274,
-  201275,
-  201276,
-  708173,
-  1769600,
-  1769620,
-  1722531,
-  571710,
-  1087427,
-  888851,
-  1511510,
-  746820,
-  1786020,
-  954101,
-  954103,
-  347990,
-  610400,
-  1245590,
-  1087421,
-  1661990,
-  1775610,
-  1304449,
-  1630734,
-  284440,
-  284441,
-  1776030,
-  686280,
-  1061350,
-  1775480,
-  1179450,
-  1159030,
-  97107,
-  97106,
-  9992,
-  1494130,
-  1449880,
-  716970,
-  716980,
-  716960,
-  713150,
-  1209470,
-  1426910,
-  227310,
-  1496410,
-  376943,
-  222545,
-  602730,
-  953680,
-  953682,
-  569700,
-  937720,
-  1611470,
-  1363880,
-  1055333,
-  930100,
-  1529380,
-  1438150,
-  523500,
-  222280,
-  1542400,
-  1436710,
-  1438010,
-  1550910,
-  1493620,
-  1452150,
-  1584870,
-  1648410,
-  320363,
-  320372,
-  320362,
-  1061140,
-  1025340,
-  318710,
-  1767030,
-  1461850,
-  1496043,
-  1496042,
-  1496041,
-  1496040,
-  1761160,
-  1617301,
-  1617303,
-  1617300,
-  1734180,
-  1734181,
-  1734182,
-  1731641,
-  1683700,
-  1721210,
-  1395809,
-  1395808,
-  1395807,
-  1395806,
-  1395804,
-  1395803,
-  1395802,
-  1395801,
-  1395800,
-  1395805,
-  1418846,
-  900449,
-  1746090,
-  1739810,
-  1324971,
-  988170,
-  1176200,
-  1087420,
-  359570,
-  1775890,
-  758770,
-  1757530,
-  1585790,
-  1778230,
-  1778240,
-  1778250,
-  1778260,
-  1778390,
-  1778400,
-  1776630,
-  1771910,
-  1769120,
-  1664550,
-  1647320,
-  1651330,
-  1014300,
-  525430,
-  1140660,
-  327175,
-  1203040,
-  849300,
-  222541,
-  1759300,
-  1493580,
-  1781120,
-  1088486,
-  1206750,
-  995651,
-  1645480,
-  939940,
-  880520,
-  880521,
-  657423,
-  453280,
-  583690,
-  595230,
-  1759310,
-  1737350,
-  1118026,
-  530060,
-  353570,
-  1781440,
-  758780,
-  1769500,
-  55340,
-  55347,
-  55471,
-  55474,
-  55475,
-  55476,
-  530140,
-  459852,
-  349230,
-  349231,
-  1016130,
-  1004290,
-  1004300,
-  1004301,
-  1466820,
-  1466821,
-  1004280,
-  815354,
-  815355,
-  815356,
-  815357,
-  815358,
-  815359,
-  499060,
-  815350,
-  815351,
-  815352,
-  815353,
-  1203542,
-  896000,
-  530780,
-  312290,
-  1190610,
-  1674680,
-  1762650,
-  1257640,
-  1228710,
-  1144646,
-  1722010,
-  1768560,
-  1135431,
-  24093,
-  961080,
-  1399110,
-  1630600,
-  1630601,
-  1630602,
-  1316240,
-  207760,
-  1470610,
-  1316270,
-  1305010,
-  830660,
-  1562310,
-  221931,
-  1756400,
-  1286905,
-  493850,
-  800340,
-  1458152,
-  1238851,
-  1084680,
-  329012,
-  329011,
-  226668,
-  226672,
-  210900,
-  210905,
-  1757220,
-  1621471,
-  1481250,
-  988670,
-  1761710,
-  1148580,
-  1606255,
-  1203041,
-  588301,
-  401631,
-  401621,
-  1765530,
-  1773190,
-  1768080,
-  1773310,
-  1773140,
-  1773250,
-  1764630,
-  1193840,
-  853170,
-  1323210,
-  1157730,
-  1606252,
-  1606256,
-  1736640,
-  1643260,
-  1643390,
-  1480230,
-  1411520,
-  1237526,
-  1089620,
-  929102,
-  1606100,
-  938400,
-  889900,
-  372112,
-  348940,
-  333110,
-  381760,
-  300870,
-  1113823,
-  1315480,
-  980548,
-  1515250,
-  1237830,
-  798252,
-  325973,
-  580730,
-  433240,
-  1581521,
-  1736990,
-  1736991,
-  1736992,
-  1581510,
-  1581513,
-  1581514,
-  1581515,
-  1581516,
-  1581517,
-  1581519,
-  1581520,
-  1581522,
-  1671010,
-  1581512,
-  1581518,
-  1637472,
-  1637470,
-  508400,
-  24044,
-  1386931,
-  1676120,
-  1714150,
-  1654720,
-  448199,
-  1664832,
-  1401461,
-  1401462,
-  436080,
-  1682100,
-  1744230,
-  1418231,
-  1098120,
-  376936,
-  382460,
-  306391,
-  306398,
-  1779400,
-  1645550,
-  941964,
-  991064,
-  537230,
-  528055,
-  528056,
-  528052,
-  528053,
-  528057,
-  528058,
-  528050,
-  528051,
-  1244640,
-  978070,
-  1770520,
-  1770521,
-  1268010,
-  457160,
-  457194,
-  657350,
-  1758560,
-  785300,
-  1237525,
-  207815,
-  1169980,
-  1045490,
-  845640,
-  1104260,
-  503720,
-  1090163,
-  1471590,
-  582575,
-  481360,
-  1450740,
-  960831,
-  711172,
-  1254570,
-  1016080,
-  1012220,
-  720960,
-  773991,
-  1105371,
-  466540,
-  318500,
-  1118270,
-  466547,
-  466551,
-  583680,
-  1628970,
-  888853,
-  634030,
-  1773930,
-  1179720,
-  992170,
-  960832,
-  1779250,
-  763696,
-  222625,
-  730630,
-  538190,
-  325954,
-  222597,
-  436550,
-  1734090,
-  1198460,
-  1090180,
-  1355151,
-  1355150,
-  1282531,
-  1090164,
-  412333,
-  1099561,
-  320352,
-  1604170,
-  1198836,
-  1133960,
-  1711040,
-  1749250,
-  1594240,
-  1705840,
-  1752900,
-  1213611,
-  1198841,
-  925110,
-  1273970,
-  888855,
-  1428990,
-  1159722,
-  1190770,
-  1472192,
-  1427650,
-  1200342,
-  1694400,
-  1462660,
-  1177050,
-  1117550,
-  1741760,
-  662351,
-  1461510,
-  1330480,
-  1239450,
-  1170010,
-  995860,
-  623781,
-  1000220,
-  875621,
-  943740,
-  1263080,
-  1206940,
-  797280,
-  568010,
-  222632,
-  1666760,
-  929101,
-  1270950,
-  1477740,
-  1365080,
-  1612050,
-  1704660,
-  1057160,
-  1761550,
-  1390430,
-  689800,
-  344461,
-  1746470,
-  1735680,
-  1776670,
-  1649930,
-  1645452,
-  1645460,
-  1645470,
-  1645490,
-  1645500,
-  1656770,
-  1645510,
-  1645530,
-  538430,
-  485840,
-  1700820,
-  1329573,
-  1590561,
-  799790,
-  1730040,
-  1761590,
-  1708600,
-  1645540,
-  347090,
-  1396070,
-  219091,
-  1777680,
-  48258,
-  210011,
-  1459820,
-  1775680,
-  1721770,
-  261060,
-  562373,
-  562389,
-  1141040,
-  1776950,
-  406600,
-  1774740,
-  1767060,
-  1767061,
-  1774490,
-  1767070,
-  1767071,
-  638120,
-  1767090,
-  1767100,
-  1767110,
-  376950,
-  325977,
-  258668,
-  567900,
-  674670,
-  522650,
-  522651,
-  522652,
-  509090,
-  558290,
-  1599180,
-  552090,
-  1698090,
-  1698100,
-  325987,
-  1663590,
-  1742190,
-  870274,
-  870275,
-  1663630,
-  1668250,
-  582571,
-  582572,
-  1590711,
-  1733670,
-  1741530,
-  1409140,
-  1481112,
-  1481113,
-  1105370,
-  720680,
-  720690,
-  720700,
-  720740,
-  720760,
-  720770,
-  1045890,
-  1744540,
-  949220,
-  949221,
-  1769540,
-  1162205,
-  1040690,
-  1771920,
-  957922,
-  1040930,
-  760730,
-  1076150,
-  1556062,
-  1556061,
-  1704110,
-  318510,
-  443730,
-  318290,
-  348330,
-  313560,
-  1143160,
-  1695390,
-  1695410,
-  1665841,
-  441700,
-  1485330,
-  874340,
-  657424,
-  1460020,
-  647560,
-  1672985,
-  1758610,
-  1414050,
-  1595650,
-  1744370,
-  938490,
-  1766610,
-  1756610,
-  1608190,
-  1283320,
-  408100,
-  1233310,
-  501750,
-  1633240,
-  1418230,
-  210013,
-  1066540,
-  1530310,
-  1762140,
-  1170814,
-  999260,
-  463810,
-  1615690,
-  1615680,
-  780560,
-  1647510,
-  1647530,
-  1647520,
-  523508,
-  1630736,
-  1765650,
-  1615011,
-  1750612,
-  1750610,
-  1750611,
-  1686740,
-  442010,
-  208281,
-  232550,
-  232570,
-  232590,
-  232530,
-  649482,
-  1315870,
-  700043,
-  416410,
-  646810,
-  1634460,
-  1316021,
-  344252,
-  1766870,
-  1704691,
-  407080,
-  406950,
-  406960,
-  393480,
-  457199,
-  1669680,
-  1460150,
-  1463250,
-  1042400,
-  1760000,
-  1715812,
-  361240,
-  98009,
-  360930,
-  360931,
-  1472780,
-  1450220,
-  1204850,
-  1704690,
-  1766620,
-  1702080,
-  1569320,
-  1569321,
-  1569322,
-  1569323,
-  1569324,
-  1396690,
-  1005972,
-  448191,
-  1656540,
-  1396700,
-  1765490,
-  1656530,
-  1758270,
-  282515,
-  282516,
-  282513,
-  1176180,
-  737040,
-  1708670,
-  1756050,
-  1622870,
-  1586690,
-  1586691,
-  1535180,
-  1678970,
-  594630,
-  463791,
-  1299590,
-  1755800,
-  954560,
-  42698,
-  1280450,
-  1073180,
-  1420500,
-  1737660,
-  1737661,
-  1487770,
-  208343,
-  1762980,
-  497970,
-  1062420,
-  1676190,
-  1157550,
-  888850,
-  1022200,
-  1630722,
-  92803,
-  1726480,
-  1379260,
-  995780,
-  1676900,
-  1745460,
-  231479,
-  1723910,
-  1723911,
-  1723900,
-  1723901,
-  1676042,
-  1591810,
-  1755930,
-  1021830,
-  1753480,
-  1235280,
-  277767,
-  1758720,
-  384560,
-  1310290,
-  1687520,
-  1751260,
-  500230,
-  1636341,
-  1174410,
-  420490,
-  915653,
-  325580,
-  947000,
-  646668,
-  1492920,
-  562399,
-  258678,
-  222578,
-  208293,
-  208348,
-  208361,
-  65239,
-  915652,
-  306150,
-  222639,
-  277674,
-  606100,
-  515191,
-  297143,
-  411650,
-  530660,
-  1600940,
-  72709,
-  1140661,
-  72772,
-  1733360,
-  734280,
-  381713,
-  381710,
-  1242755,
-  1771720,
-  1637255,
-  941958,
-  672830,
-  439540,
-  580731,
-  379554,
-  1771680,
-  1365280,
-  1138400,
-  951460,
-  642804,
-  594970,
-  379233,
-  10196,
-  34178,
-  1569630,
-  1187040,
-  457841,
-  889920,
-  1768840,
-  1200270,
-  526040,
-  593380,
-  256321,
-  256320,
-  1181990,
-  1767031,
-  1304413,
-  1494338,
-  1380590,
-  1364036,
-  1120540,
-  1761830,
-  1743291,
-  1493250,
-  1743290,
-  1751590,
-  1637253,
-  683100,
-  1586780,
-  408600,
-  460610,
-  1213613,
-  1748810,
-  1566380,
-  1637258,
-  1464061,
-  249181,
-  212301,
-  1758500,
-  1734730,
-  1099560,
-  1569304,
-  235584,
-  1769080,
-  487170,
-  1586080,
-  1191490,
-  925827,
-  1341702,
-  361290,
-  417462,
-  1764360,
-  1764380,
-  1764150,
-  1764330,
-  1764350,
-  1764140,
-  1757640,
-  1715410,
-  581450,
-  1694220,
-  222594,
-  55342,
-  1723521,
-  1723520,
-  446090,
-  553280,
-  554350,
-  716670,
-  518910,
-  460559,
-  460600,
-  530760,
-  472410,
-  702350,
-  642010,
-  815460,
-  1158100,
-  1731642,
-  457195,
-  1762030,
-  1651570,
-  951666,
-  699350,
-  448182,
-  1759022,
-  1759170,
-  1759020,
-  1759021,
-  648650,
-  1752460,
-  1521320,
-  1102310,
-  948140,
-  1766021,
-  635290,
-  277821,
-  385511,
-  1707360,
-  1143851,
-  245570,
-  996060,
-  1539310,
-  1001060,
-  322022,
-  921680,
-  1711030,
-  1711031,
-  1749820,
-  1735920,
-  1087000,
-  1303800,
-  462260,
-  462261,
-  1613060,
-  1347640,
-  1613111,
-  1533000,
-  1533003,
-  1533004,
-  1533005,
-  1735921,
-  1423650,
-  558241,
-  1721670,
-  1730712,
-  1730711,
-  1730713,
-  1730714,
-  1730715,
-  1670330,
-  215001,
-  1496920,
-  1760030,
-  1722690,
-  1156450,
-  1487090,
-  1726570,
-  1672984,
-  1672982,
-  1672981,
-  1672980,
-  1761890,
-  1222520,
-  671160,
-  1755000,
-  1755001,
-  688510,
-  688520,
-  688530,
-  557450,
-  1565570,
-  395260,
-  1752160,
-  1304419,
-  1000240,
-  1724740,
-  1490530,
-  1518230,
-  1752301,
-  431350,
-  1752310,
-  225821,
-  1737270,
-  615510,
-  33370,
-  1133170,
-  601800,
-  700900,
-  1748720,
-  1748730,
-  1569960,
-  760842,
-  379542,
-  1708860,
-  1673010,
-  1137440,
-  1033840,
-  1379280,
-  1755630,
-  1755631,
-  1398050,
-  1261120,
-  1730710,
-  1171470,
-  1183540,
-  1333570,
-  325714,
-  325716,
-  325715,
-  325713,
-  325712,
-  325711,
-  325710,
-  302103,
-  302102,
-  1753521,
-  1753523,
-  1753525,
-  1753527,
-  1753520,
-  1753524,
-  1753522,
-  1753528,
-  1753529,
-  1753526,
-  564400,
-  1751010,
-  1735500,
-  1758170,
-  1758240,
-  1754190,
-  1638620,
-  1453620,
-  1010136,
-  380740,
-  1557490,
-  275560,
-  988160,
-  1756680,
-  1224827,
-  1146520,
-  325992,
-  1389240,
-  1765750,
-  961580,
-  598022,
-  1765751,
-  1765753,
-  1554910,
-  751880,
-  302100,
-  1174580,
-  325724,
-  436081,
-  436082,
-  415370,
-  1112521,
-  1354960,
-  1241570,
-  412920,
-  1764470,
-  1056240,
-  1664041,
-  1466380,
-  1156960,
-  1111070,
-  942430,
-  377540,
-  760841,
-  715870,
-  554000,
-  874661,
-  502870,
-  1707532,
-  1744700,
-  667860,
-  1281570,
-  1652351,
-  1719810,
-  841150,
-  716660,
-  623140,
-  373740,
-  797240,
-  1349700,
-  1055290,
-  325970,
-  1199120,
-  244065,
-  1508910,
-  1284880,
-  1329100,
-  434067,
-  1477840,
-  995970,
-  224163,
-  225829,
-  225831,
-  1742150,
-  316963,
-  1163640,
-  790830,
-  488130,
-  347190,
-  301180,
-  769990,
-  1033800,
-  752870,
-  534950,
-  1596670,
-  1424060,
-  1435580,
-  1225140,
-  1077990,
-  414670,
-  1636340,
-  774759,
-  1536500,
-  787340,
-  798542,
-  1762590,
-  1762640,
-  821990,
-  554380,
-  320370,
-  1690310,
-  1413240,
-  1327341,
-  540810,
-  1729550,
-  317960,
-  1757780,
-  1180600,
-  1714220,
-  861871,
-  706450,
-  872280,
-  1756970,
-  1754230,
-  1233840,
-  1004917,
-  1004919,
-  672840,
-  968390,
-  1662730,
-  1518260,
-  1518261,
-  1518262,
-  1739890,
-  1739891,
-  1715600,
-  1698252,
-  1698250,
-  1698251,
-  1569301,
-  1569300,
-  635030,
-  1429450,
-  1176153,
-  1747130,
-  320384,
-  320385,
-  1574140,
-  1118650,
-  1650179,
-  1446730,
-  1701600,
-  1375364,
-  934690,
-  1378240,
-  338720,
-  335030,
-  222582,
-  1760630,
-  1762710,
-  1756990,
-  1724751,
-  1749100,
-  1255001,
-  449981,
-  1681210,
-  1681220,
-  461240,
-  318511,
-  320383,
-  1183050,
-  1183051,
-  1183052,
-  1713870,
-  423364,
-  1730421,
-  1730422,
-  1730423,
-  1730424,
-  1730420,
-  1756690,
-  1756640,
-  1756660,
-  1756670,
-  1744310,
-  1641740,
-  880282,
-  216412,
-  1637252,
-  1611330,
-  1242743,
-  900447,
-  1620400,
-  1747780,
-  1758750,
-  1741190,
-  1752550,
-  887080,
-  975180,
-  422670,
-  1300770,
-  1208150,
-  1466720,
-  1739120,
-  1466280,
-  1568200,
-  1192650,
-  1530500,
-  1530501,
-  1530502,
-  1530503,
-  1530504,
-  1695361,
-  499484,
-  1747380,
-  1752300,
-  1752311,
-  865670,
-  949870,
-  390657,
-  1567292,
-  1567291,
-  1756870,
-  1443083,
-  1724730,
-  1441600,
-  887780,
-  1762170,
-  204733,
-  394730,
-  1097220,
-  1109620,
-  1108763,
-  1064272,
-  1097222,
-  1108762,
-  1097223,
-  1108761,
-  1080080,
-  1108760,
-  1097224,
-  1109621,
-  525280,
-  500244,
-  1721630,
-  320351,
-  320360,
-  320361,
-  1573141,
-  1573140,
-  1559290,
-  1663130,
-  1440200,
-  1407710,
-  965950,
-  1636873,
-  1690840,
-  1636872,
-  409060,
-  623150,
-  1567293,
-  1567294,
-  1692490,
-  460557,
-  460558,
-  460550,
-  460551,
-  460554,
-  460555,
-  460556,
-  763695,
-  1181740,
-  1342010,
-  1526010,
-  836890,
-  214930,
-  488530,
-  1738700,
-  1738690,
-  1663700,
-  1721880,
-  42718,
-  935510,
-  604070,
-  744680,
-  359498,
-  779936,
-  1746260,
-  1021790,
-  1140000,
-  498540,
-  738940,
-  1638311,
-  1610600,
-  916430,
-  478990,
-  1736722,
-  1736723,
-  1457700,
-  1457701,
-  1749550,
-  602471,
-  1692530,
-  1692531,
-  1692532,
-  212892,
-  1286903,
-  595290,
-  826087,
-  826088,
-  1597100,
-  1424320,
-  259252,
-  1675790,
-  1676960,
-  1480460,
-  1480461,
-  1478940,
-  1322500,
-  1322510,
-  1322511,
-  1322512,
-  1180730,
-  505450,
-  1222634,
-  1227443,
-  1227441,
-  1205330,
-  792332,
-  742891,
-  1205580,
-  1222632,
-  1227448,
-  1227449,
-  1663100,
-  937630,
-  1634180,
-  1746000,
-  1451710,
-  666840,
-  531330,
-  1409590,
-  1756890,
-  1623270,
-  1751020,
-  1751030,
-  1499590,
-  1065280,
-  437660,
-  1646320,
-  1110190,
-  1259730,
-  984180,
-  1148021,
-  1148280,
-  10607,
-  992172,
-  921950,
-  204290,
-  207090,
-  624621,
-  730770,
-  747670,
-  1750850,
-  1719640,
-  1396360,
-  1736950,
-  1736940,
-  1432640,
-  941951,
-  941952,
-  941953,
-  941954,
-  941955,
-  941956,
-  941957,
-  941959,
-  941960,
-  941961,
-  1741360,
-  1741370,
-  1413420,
-  1282530,
-  1282532,
-  1754370,
-  1695920,
-  1702340,
-  1713380,
-  1205110,
-  1205111,
-  1205112,
-  1205113,
-  1205114,
-  1205115,
-  1187760,
-  986330,
-  759930,
-  572930,
-  572420,
-  572470,
-  572490,
-  573150,
-  1133000,
-  583632,
-  1679810,
-  1486570,
-  1737352,
-  603760,
-  1674911,
-  220824,
-  315890,
-  1209400,
-  1336484,
-  66001,
-  555531,
-  1661000,
-  962540,
-  471899,
-  548410,
-  594610,
-  709090,
-  579750,
-  1181770,
-  237010,
-  1049290,
-  969560,
-  916250,
-  647630,
-  1703728,
-  1703759,
-  1703720,
-  1703732,
-  1703733,
-  1703734,
-  1703737,
-  1703738,
-  1703751,
-  1703752,
-  1703753,
-  1703754,
-  1703755,
-  1703756,
-  1703757,
-  1703758,
-  1703727,
-  1703735,
-  1703736,
-  1703739,
-  1703750,
-  1703723,
-  1703729,
-  1703730,
-  1703731,
-  1703721,
-  1703722,
-  1703724,
-  1703725,
-  1703726,
-  1703766,
-  1703876,
-  1703877,
-  1703878,
-  1703886,
-  1703890,
-  1703902,
-  1703760,
-  1703761,
-  1703762,
-  1703763,
-  1703764,
-  1703765,
-  1703767,
-  1703768,
-  1703769,
-  1703901,
-  1703903,
-  1703904,
-  1703905,
-  1703906,
-  1703907,
-  1703908,
-  1703909,
-  1703875,
-  1703880,
-  1703882,
-  1703883,
-  1703884,
-  1703885,
-  1703888,
-  1703892,
-  1703894,
-  1703895,
-  1703896,
-  1703897,
-  1703898,
-  1703899,
-  1703900,
-  1703881,
-  1703891,
-  1703879,
-  1703887,
-  1703889,
-  1703893,
-  1704040,
-  1704041,
-  1704045,
-  1704047,
-  1704046,
-  1705105,
-  1704042,
-  1704043,
-  1704044,
-  1705103,
-  1705108,
-  1705109,
-  1705104,
-  1703874,
-  1704049,
-  1703870,
-  1703872,
-  1703873,
-  1704048,
-  1703871,
-  1705106,
-  1705107,
-  1705098,
-  1705102,
-  1705097,
-  1705101,
-  1705096,
-  1705099,
-  1705100,
-  1705085,
-  1705089,
-  1705090,
-  1705091,
-  1705092,
-  1705093,
-  1705094,
-  1705095,
-  1705083,
-  1705084,
-  1705086,
-  1705087,
-  1705088,
-  1705080,
-  1705081,
-  1705082,
-  1704033,
-  1704034,
-  1704050,
-  1704053,
-  1704055,
-  1704056,
-  1704058,
-  1704059,
-  1704051,
-  1704052,
-  1704054,
-  1704039,
-  1704057,
-  1704035,
-  1704036,
-  1704037,
-  1704038,
-  1704032,
-  1704030,
-  1704031,
-  650524,
-  580210,
-  1704411,
-  1704416,
-  1704417,
-  1704418,
-  1704419,
-  1704420,
-  1704424,
-  1704422,
-  1704423,
-  1704425,
-  1704426,
-  1704427,
-  1704428,
-  1704413,
-  1704414,
-  1704429,
-  1704421,
-  1704415,
-  1704410,
-  1704412,
-  1167660,
-  378730,
-  513500,
-  205632,
-  526411,
-  1020880,
-  916190,
-  500237,
-  1102160,
-  1703710,
-  1703713,
-  1703716,
-  1703718,
-  1703711,
-  1703712,
-  1703714,
-  1703717,
-  1703719,
-  1703715,
-  1703860,
-  1703861,
-  1703864,
-  1703865,
-  1703866,
-  1703867,
-  1703868,
-  1703869,
-  1703862,
-  1703863,
-  1704029,
-  1704028,
-  1704027,
-  1704026,
-  1704025,
-  1704024,
-  1704021,
-  1704022,
-  1704023,
-  1704020,
-  1704409,
-  1704408,
-  1003780,
-  1704403,
-  1704405,
-  1704406,
-  1704407,
-  1704401,
-  1704402,
-  1704404,
-  1704400,
-  1705073,
-  1705074,
-  1705077,
-  1705078,
-  1705079,
-  1705071,
-  1705072,
-  1705075,
-  1705076,
-  1705070,
-  1705320,
-  1705321,
-  1705322,
-  1705323,
-  1705324,
-  1705325,
-  1705326,
-  1705327,
-  1705328,
-  1705329,
-  1643350,
-  1460620,
-  443430,
-  1137800,
-  329530,
-  299230,
-  1104880,
-  1467121,
-  393010,
-  1610550,
-  1541260,
-  1371400,
-  1190010,
-  610700,
-  434942,
-  315190,
-  1330970,
-  1216160,
-  1010131,
-  1232252,
-  1000718,
-  704740,
-  1146690,
-  652960,
-  55398,
-  677150,
-  723620,
-  286991,
-  1750190,
-  1643355,
-  1627780,
-  580430,
-  1722530,
-  1722532,
-  1315350,
-  1456362,
-  1711820,
-  1711821,
-  1711822,
-  1071810,
-  1685670,
-  441340,
-  48806,
-  995610,
-  875620,
-  1741600,
-  1338540,
-  277776,
-  1750400,
-  1235764,
-  217370,
-  1752920,
-  1697480,
-  1471970,
-  1496830,
-  1754310,
-  1336482,
-  1397490,
-  1162207,
-  1109050,
-  1188610,
-  530711,
-  464202,
-  761820,
-  1584380,
-  1423952,
-  1423951,
-  1423953,
-  1423950,
-  1202063,
-  1310370,
-  1202064,
-  1202065,
-  291471,
-  1202032,
-  1202033,
-  1202034,
-  1202037,
-  1202035,
-  1202036,
-  1485620,
-  1503070,
-  1549490,
-  1677780,
-  1379330,
-  1479440,
-  408370,
-  1246380,
-  1750390,
-  955650,
-  593270,
-  1144680,
-  1534030,
-  1681271,
-  1710241,
-  1736721,
-  1715480,
-  329370,
-  1725504,
-  1725503,
-  1725502,
-  1725501,
-  1588821,
-  1304448,
-  1082357,
-  873870,
-  461961,
-  462300,
-  379557,
-  1560660,
-  1560670,
-  1560690,
-  1560680,
-  1560700,
-  1703851,
-  1703852,
-  1703853,
-  1703855,
-  1703707,
-  1703708,
-  1703709,
-  1703700,
-  1703701,
-  1703702,
-  1703703,
-  1703704,
-  1703705,
-  1703706,
-  1703859,
-  1703856,
-  1703857,
-  1703858,
-  1703850,
-  1703854,
-  1311170,
-  1705062,
-  1704019,
-  1705061,
-  1705063,
-  1705064,
-  1705065,
-  1705066,
-  1705069,
-  1705067,
-  1705060,
-  1704017,
-  1704018,
-  1704393,
-  1704398,
-  1704010,
-  1704394,
-  1704392,
-  1705068,
-  1704016,
-  1704011,
-  1704012,
-  1704014,
-  1704015,
-  1704397,
-  1704399,
-  1704395,
-  1704396,
-  1704390,
-  1704391,
-  1704013,
-  1705317,
-  1705318,
-  1705319,
-  1705311,
-  1705312,
-  1705313,
-  1705314,
-  1705315,
-  1705316,
-  1705310,
-  1217540,
-  589090,
-  1695350,
-  1695351,
-  1738510,
-  1715422,
-  1715450,
-  1721760,
-  1661510,
-  1057270,
-  355950,
-  488060,
-  239550,
-  1701200,
-  562378,
-  222601,
-  1628663,
-  1628662,
-  1628661,
-  1628660,
-  461960,
-  420757,
-  1316182,
-  1248431,
-  1248433,
-  1209880,
-  992173,
-  992174,
-  992175,
-  940501,
-  807480,
-  779932,
-  779934,
-  779938,
-  758772,
-  644900,
-  596190,
-  508401,
-  500246,
-  475132,
-  381711,
-  333810,
-  113405,
-  1711730,
-  1711731,
-  1711732,
-  1711733,
-  1711734,
-  1670570,
-  884142,
-  1114100,
-  1738440,
-  534280,
-  1731020,
-  1731150,
-  1057470,
-  1492410,
-  1699540,
-  1699541,
-  1699542,
-  1699543,
-  1699544,
-  1697320,
-  1697321,
-  1697322,
-  1697323,
-  1697324,
-  1695100,
-  1695101,
-  1695102,
-  1695103,
-  1695104,
-  1692750,
-  1692751,
-  1692752,
-  1692753,
-  1692754,
-  1687800,
-  1687801,
-  1687802,
-  1687803,
-  1687804,
-  1685350,
-  1685351,
-  1685352,
-  1685353,
-  1685354,
-  1680090,
-  1680091,
-  1680092,
-  1680093,
-  1680094,
-  1675710,
-  1675711,
-  1675712,
-  1675713,
-  1675714,
-  1667820,
-  1667821,
-  1667822,
-  1667823,
-  1667824,
-  1705230,
-  1705231,
-  1705232,
-  1705233,
-  1705234,
-  1704990,
-  1704991,
-  1704992,
-  1704993,
-  1704994,
-  1703660,
-  1703661,
-  1703662,
-  1703663,
-  1703664,
-  1703810,
-  1703811,
-  1703812,
-  1703813,
-  1703814,
-  1703960,
-  1703961,
-  1703962,
-  1703963,
-  1703964,
-  1700470,
-  1700471,
-  1700472,
-  1700473,
-  1700474,
-  1704330,
-  1704331,
-  1704332,
-  1704333,
-  1704334,
-  1643860,
-  1643861,
-  1643862,
-  1643863,
-  1643864,
-  24096,
-  1742220,
-  420680,
-  1650176,
-  1687808,
-  1650177,
-  1687809,
-  1650178,
-  1687810,
-  1687811,
-  1687812,
-  1687813,
-  1687814,
-  1687815,
-  1687816,
-  1687817,
-  48138,
-  1687818,
-  1687819,
-  1687820,
-  1687821,
-  1687822,
-  1687823,
-  1687824,
-  1687825,
-  1687826,
-  1687827,
-  1687828,
-  1687829,
-  1687830,
-  1687831,
-  1687832,
-  1687833,
-  1687834,
-  1687835,
-  1687836,
-  1687837,
-  1687838,
-  1687839,
-  1687850,
-  1687851,
-  1687852,
-  1687853,
-  1687854,
-  1687855,
-  1687856,
-  1687857,
-  1687858,
-  1687859,
-  1687860,
-  1687861,
-  1650230,
-  1687862,
-  1650231,
-  1687863,
-  1650232,
-  1687864,
-  515640,
-  1687865,
-  515641,
-  1687866,
-  515642,
-  1687867,
-  1687868,
-  1687869,
-  1687870,
-  1687871,
-  1687872,
-  1687873,
-  1687874,
-  1687875,
-  1687876,
-  1687877,
-  1687878,
-  1687879,
-  1687880,
-  1687881,
-  1687882,
-  1687883,
-  1687884,
-  1687885,
-  1687886,
-  1687887,
-  1687888,
-  1687889,
-  1687890,
-  556371,
-  1687891,
-  1650260,
-  1687892,
-  1687893,
-  1582422,
-  1687894,
-  1687895,
-  1687896,
-  1687897,
-  1687898,
-  33371,
-  1687899,
-  1687900,
-  1687901,
-  1687902,
-  1687903,
-  1687904,
-  1687905,
-  1687906,
-  1687907,
-  1687908,
-  1687909,
-  1158760,
-  1685355,
-  1685356,
-  1685357,
-  1685358,
-  1685359,
-  1685360,
-  1685361,
-  1685362,
-  1685363,
-  1685364,
-  1685365,
-  1685366,
-  1685367,
-  1685368,
-  1685369,
-  1685370,
-  1685371,
-  1685372,
-  1685373,
-  1685374,
-  1685375,
-  1685376,
-  1685377,
-  1685378,
-  1685379,
-  1685380,
-  1685381,
-  1685382,
-  1685383,
-  1685384,
-  1685385,
-  1685386,
-  1685387,
-  1685388,
-  1685389,
-  1685390,
-  1685391,
-  238480,
-  1685392,
-  1685393,
-  1685394,
-  1685395,
-  1685396,
-  1685397,
-  1685398,
-  1685399,
-  1685400,
-  1685401,
-  1685402,
-  1685403,
-  1685404,
-  1685405,
-  1685406,
-  1685407,
-  300960,
-  1685408,
-  1685409,
-  1685410,
-  1685411,
-  1685412,
-  1685413,
-  1685414,
-  1685415,
-  1685416,
-  1685417,
-  1685418,
-  1685419,
-  1685420,
-  1685421,
-  1685422,
-  1685423,
-  1685424,
-  1685425,
-  1685426,
-  1685427,
-  1685428,
-  1685429,
-  1685430,
-  1685431,
-  1685432,
-  1685433,
-  1685434,
-  1685435,
-  1685436,
-  1685437,
-  1685438,
-  1685439,
-  1685440,
-  1685441,
-  1685442,
-  1685443,
-  1685444,
-  1685445,
-  1685446,
-  1685447,
-  1685448,
-  1685449,
-  403151,
-  33245,
-  33246,
-  1650160,
-  1650170,
-  1650171,
-  1650172,
-  1650173,
-  1687805,
-  1650174,
-  1687806,
-  1650175,
-  1687807,
-  962750,
-  208809,
-  1162210,
-  1170100,
-  1116310,
-  1606960,
-  1220610,
-  943830,
-  1205760,
-  1627810,
-  423630,
-  1744980,
-  635350,
-  1615780,
-  1623150,
-  1742650,
-  1704650,
-  1742670,
-  1722720,
-  1485750,
-  1486560,
-  1087429,
-  761821,
-  1587450,
-  333400,
-  1689200,
-  214933,
-  1704960,
-  1704961,
-  622030,
-  752450,
-  1108180,
-  277830,
-  1437070,
-  1437071,
-  1437072,
-  1437073,
-  1437075,
-  1437074,
-  1636290,
-  1636291,
-  1636292,
-  1636293,
-  440960,
-  502842,
-  1184411,
-  1098520,
-  25808,
-  1207000,
-  678220,
-  1745940,
-  1369120,
-  1369190,
-  1369210,
-  1369220,
-  1369260,
-  1629843,
-  1629842,
-  1523181,
-  1629841,
-  1711810,
-  1629840,
-  1505810,
-  1505820,
-  1251491,
-  1369270,
-  1369230,
-  1484540,
-  1196420,
-  1146650,
-  999490,
-  501670,
-  1629000,
-  210936,
-  1113250,
-  996970,
-  222580,
-  947510,
-  1533010,
-  1585816,
-  1741020,
-  1741010,
-  1304447,
-  1703940,
-  264750,
-  1232254,
-  463720,
-  540711,
-  1537290,
-  282511,
-  306160,
-  894690,
-  1051700,
-  842680,
-  1504540,
-  1059820,
-  297830,
-  712630,
-  1651900,
-  1513890,
-  1513870,
-  1513880,
-  1513900,
-  1747710,
-  1117140,
-  1696880,
-  294560,
-  1247340,
-  404283,
-  1487540,
-  226990,
-  293061,
-  526060,
-  237450,
-  1262572,
-  1699642,
-  1699643,
-  1699647,
-  1699648,
-  1699649,
-  1699644,
-  1699645,
-  1699646,
-  1699640,
-  1699641,
-  1442210,
-  306850,
-  417461,
-  1238440,
-  968910,
-  968911,
-  420825,
-  333800,
-  289733,
-  1308090,
-  73041,
-  434944,
-  849308,
-  1516850,
-  319810,
-  1096940,
-  1731760,
-  1731761,
-  1731762,
-  1731763,
-  1731764,
-  1339520,
-  1260200,
-  1001784,
-  1387390,
-  1019510,
-  1738370,
-  1738350,
-  1738380,
-  1555050,
-  377560,
-  1090202,
-  951660,
-  951662,
-  614007,
-  1721040,
-  1483730,
-  287370,
-  1731160,
-  1354250,
-  642250,
-  211202,
-  1713330,
-  376954,
-  1741750,
-  1497350,
-  1637254,
-  1005790,
-  1662500,
-  627510,
-  1417100,
-  1238100,
-  1238104,
-  962530,
-  577901,
-  554381,
-  700280,
-  1336481,
-  1600800,
-  1740440,
-  1746690,
-  1150940,
-  456730,
-  394340,
-  437430,
-  1439000,
-  1439001,
-  526301,
-  1130871,
-  1130872,
-  1423921,
-  1423922,
-  1423920,
-  1670560,
-  1159930,
-  564360,
-  394090,
-  945011,
-  1125610,
-  1698430,
-  1090241,
-  1109180,
-  889120,
-  982650,
-  1109190,
-  1506270,
-  982660,
-  863930,
-  1265620,
-  811840,
-  1729500,
-  1738360,
-  979050,
-  979190,
-  933890,
-  940570,
-  955210,
-  783530,
-  955830,
-  1379080,
-  1588640,
-  55387,
-  507070,
-  1616080,
-  1329553,
-  1398060,
-  1744601,
-  1744600,
-  327174,
-  1737250,
-  1737260,
-  1639270,
-  480580,
-  334180,
-  1055336,
-  1728030,
-  678002,
-  1246570,
-  584141,
-  1060700,
-  1222190,
-  1253302,
-  1422060,
-  1048381,
-  1519170,
-  1541960,
-  1654721,
-  1654722,
-  1654723,
-  446980,
-  1650233,
-  1101720,
-  1740750,
-  1715421,
-  1715440,
-  823720,
-  1705053,
-  1705054,
-  1705055,
-  1705056,
-  1705057,
-  1705058,
-  1705059,
-  1705046,
-  1705045,
-  1705047,
-  1705049,
-  1705050,
-  1705051,
-  1705052,
-  1705048,
-  1703690,
-  1704001,
-  1703685,
-  1703687,
-  1703686,
-  1703688,
-  1703689,
-  1703691,
-  1703692,
-  1703693,
-  1703694,
-  1703695,
-  1703696,
-  1703697,
-  1703698,
-  1703699,
-  1703844,
-  1703846,
-  1703848,
-  1703849,
-  1703845,
-  1703847,
-  1703840,
-  1703842,
-  1703843,
-  1703836,
-  1703837,
-  1703838,
-  1703839,
-  1704002,
-  1704006,
-  1704007,
-  1704008,
-  1703841,
-  1704003,
-  1704004,
-  1704005,
-  1704009,
-  1703835,
-  1703997,
-  1703999,
-  1704384,
-  1704389,
-  1703995,
-  1703996,
-  1703998,
-  1704000,
-  1704387,
-  1704388,
-  1704385,
-  1704386,
-  1704381,
-  1704383,
-  1704378,
-  1704379,
-  1704380,
-  1704382,
-  1704375,
-  1704376,
-  1704377,
-  1705304,
-  1705301,
-  1705302,
-  1705303,
-  1697430,
-  1697433,
-  1697434,
-  1697436,
-  1697437,
-  1705308,
-  1705309,
-  1705306,
-  1705307,
-  1705300,
-  1697438,
-  1697439,
-  1697435,
-  1697431,
-  1697432,
-  1705305,
-  442051,
-  1744150,
-  556392,
-  1591930,
-  1528381,
-  1528382,
-  1528380,
-  1356410,
-  1104410,
-  1277830,
-  1690420,
-  967320,
-  1112470,
-  1180491,
-  1178950,
-  998560,
-  965040,
-  752440,
-  1112460,
-  769710,
-  1214350,
-  875600,
-  515171,
-  874343,
-  378710,
-  1724690,
-  645900,
-  473130,
-  1552588,
-  1295800,
-  973910,
-  1135960,
-  1049790,
-  1674910,
-  823990,
-  471410,
-  1723550,
-  209811,
-  277763,
-  1557981,
-  329990,
-  329991,
-  349960,
-  349961,
-  329230,
-  338451,
-  336660,
-  338452,
-  336661,
-  438550,
-  704540,
-  323870,
-  323871,
-  502580,
-  1550140,
-  1550141,
-  1550142,
-  548510,
-  571570,
-  610490,
-  323520,
-  325340,
-  328160,
-  381670,
-  325350,
-  381671,
-  1704681,
-  1729610,
-  1631890,
-  1709010,
-  1741840,
-  1742640,
-  48140,
-  48137,
-  48136,
-  1173860,
-  820180,
-  1704680,
-  1735520,
-  1741820,
-  1725506,
-  1725507,
-  1725500,
-  1142600,
-  1048872,
-  1048873,
-  1048875,
-  1048876,
-  1048879,
-  1375362,
-  1099563,
-  1048878,
-  1099581,
-  1099582,
-  1099584,
-  1099585,
-  1048870,
-  1048871,
-  1365360,
-  1741350,
-  1636180,
-  222588,
-  1545960,
-  1696500,
-  1517481,
-  1724200,
-  1735380,
-  1735381,
-  1720250,
-  1722880,
-  1740841,
-  1740840,
-  1723060,
-  1723040,
-  324250,
-  1176932,
-  1121020,
-  1135434,
-  1135435,
-  1135437,
-  277820,
-  702990,
-  222283,
-  222284,
-  1497320,
-  747740,
-  920352,
-  920353,
-  920350,
-  920351,
-  747742,
-  747741,
-  1040041,
-  1483491,
-  1258240,
-  1636294,
-  1194500,
-  323510,
-  323530,
-  323872,
-  451110,
-  802630,
-  889340,
-  951510,
-  1214290,
-  1214440,
-  1295960,
-  1364840,
-  1435930,
-  1495310,
-  1570060,
-  1735050,
-  1709200,
-  1469670,
-  1642810,
-  732460,
-  367810,
-  1176188,
-  216469,
-  21200,
-  21201,
-  21202,
-  21203,
-  21204,
-  21205,
-  21206,
-  21207,
-  21208,
-  21209,
-  21210,
-  21211,
-  21212,
-  21213,
-  21214,
-  21215,
-  562143,
-  21216,
-  21217,
-  21218,
-  21219,
-  21220,
-  21221,
-  21222,
-  21223,
-  21224,
-  21225,
-  21226,
-  21227,
-  21228,
-  1646950,
-  338453,
-  338450,
-  1687110,
-  1323810,
-  1522090,
-  304211,
-  1656350,
-  1726230,
-  1375363,
-  1375366,
-  1167661,
-  1048874,
-  1099562,
-  1209130,
-  1209133,
-  1363370,
-  1719520,
-  1740640,
-  1716291,
-  1625400,
-  200590,
-  1738250,
-  1109480,
-  1045980,
-  736580,
-  726480,
-  575291,
-  65258,
-  1656360,
-  328120,
-  272710,
-  339070,
-  405080,
-  371020,
-  1216640,
-  678710,
-  1341351,
-  1026750,
-  1721856,
-  1721857,
-  1721858,
-  1721859,
-  1721860,
-  1721861,
-  1721862,
-  1721863,
-  1721854,
-  1721855,
-  1721850,
-  1721851,
-  1721852,
-  1721853,
-  1464062,
-  1184412,
-  1092880,
-  1703680,
-  1703990,
-  1703991,
-  1703993,
-  1703994,
-  1705044,
-  1703831,
-  1703992,
-  1705043,
-  1703833,
-  1703834,
-  1703684,
-  1703832,
-  1705042,
-  1705040,
-  1705041,
-  1703682,
-  1703683,
-  1703681,
-  1703830,
-  1700586,
-  1705290,
-  1705291,
-  1705292,
-  1705293,
-  1705294,
-  1705295,
-  1705296,
-  1700583,
-  1700584,
-  1700585,
-  1700587,
-  1700588,
-  1700589,
-  1705297,
-  1705299,
-  1700581,
-  1700582,
-  1704374,
-  1704371,
-  1704372,
-  1704373,
-  1704370,
-  1705298,
-  1700580,
-  1697414,
-  1697410,
-  1697411,
-  1697412,
-  1697413,
-  1697415,
-  1697416,
-  1697417,
-  1697418,
-  1697419,
-  1619980,
-  1112483,
-  1631370,
-  667291,
-  571810,
-  1591080,
-  1529660,
-  1615010,
-  638280,
-  1591780,
-  204182,
-  1065490,
-  1109331,
-  1072020,
-  529550,
-  929103,
-  1658810,
-  1140662,
-  1160590,
-  1001620,
-  439450,
-  366849,
-  767570,
-  641430,
-  1494337,
-  522332,
-  522331,
-  739251,
-  1212660,
-  1022790,
-  1461180,
-  1734580,
-  457720,
-  271390,
-  1734220,
-  1674480,
-  480400,
-  592460,
-  592461,
-  565840,
-  522333,
-  522334,
-  522335,
-  1647470,
-  1160591,
-  1160592,
-  1160593,
-  1563430,
-  718600,
-  710800,
-  404250,
-  590610,
-  562144,
-  216464,
-  216465,
-  216466,
-  216467,
-  216468,
-  216444,
-  216445,
-  216446,
-  216447,
-  216448,
-  216449,
-  216450,
-  216451,
-  216452,
-  216453,
-  216454,
-  216455,
-  216456,
-  216457,
-  216458,
-  216459,
-  216460,
-  216461,
-  216462,
-  216463,
-  216430,
-  216431,
-  216432,
-  216433,
-  216434,
-  216435,
-  216436,
-  216437,
-  216438,
-  216439,
-  216440,
-  216441,
-  216442,
-  216443,
-  562145,
-  1475540,
-  997330,
-  277773,
-  1728240,
-  1728250,
-  1728220,
-  1728230,
-  213194,
-  1087850,
-  1142110,
-  1551410,
-  362980,
-  394080,
-  1577100,
-  1087860,
-  1047970,
-  741780,
-  1551380,
-  1532670,
-  366750,
-  1551400,
-  1064560,
-  1087870,
-  1087890,
-  368510,
-  392440,
-  1696510,
-  371110,
-  404930,
-  464720,
-  464130,
-  366710,
-  372200,
-  357100,
-  372270,
-  357090,
-  357080,
-  357110,
-  306100,
-  368410,
-  1577090,
-  1421070,
-  468010,
-  363040,
-  409180,
-  1218390,
-  1421110,
-  425380,
-  1064550,
-  362950,
-  372280,
-  1087840,
-  1249930,
-  1232070,
-  765750,
-  1708890,
-  382400,
-  562140,
-  1211475,
-  1105951,
-  1570170,
-  1630735,
-  461070,
-  1637471,
-  1581630,
-  1110320,
-  1737930,
-  1733870,
-  1723640,
-  1734440,
-  1453720,
-  1105360,
-  1715420,
-  1715430,
-  1633484,
-  1633485,
-  1633486,
-  540070,
-  779933,
-  740143,
-  365840,
-  1243841,
-  214292,
-  520980,
-  231970,
-  1316140,
-  465220,
-  521030,
-  565620,
-  524920,
-  477821,
-  492670,
-  206721,
-  543620,
-  338580,
-  1607060,
-  1607061,
-  1607062,
-  1607063,
-  1607064,
-  492700,
-  1112480,
-  1112481,
-  1112482,
-  1112484,
-  1112485,
-  439480,
-  1640383,
-  357850,
-  333560,
-  1308670,
-  706230,
-  868429,
-  763820,
-  442052,
-  1427674,
-  760840,
-  1656330,
-  1144682,
-  1144683,
-  795731,
-  1732690,
-  1731300,
-  1714161,
-  1714160,
-  1135971,
-  1162230,
-  1415450,
-  474720,
-  1599010,
-  530180,
-  1498801,
-  426321,
-  1665680,
-  1521460,
-  800140,
-  1720871,
-  1720872,
-  1720873,
-  1720874,
-  1720875,
-  1720876,
-  1720877,
-  1720878,
-  1720879,
-  1707350,
-  1516260,
-  1719800,
-  1699632,
-  1699639,
-  1700574,
-  1699637,
-  1699638,
-  1699633,
-  1699634,
-  1699635,
-  1699636,
-  1699630,
-  1699631,
-  1700576,
-  1700577,
-  1700578,
-  1700579,
-  1700575,
-  1700570,
-  1700571,
-  1700572,
-  1700573,
-  1705282,
-  1705283,
-  1705284,
-  1705285,
-  1705288,
-  1705280,
-  1705287,
-  1705289,
-  1705286,
-  1705281,
-  1704360,
-  1704361,
-  1704362,
-  1704364,
-  1704365,
-  1704366,
-  1704363,
-  1703980,
-  1703828,
-  1703827,
-  1704367,
-  1704368,
-  1704369,
-  1703989,
-  1703986,
-  1703987,
-  1703988,
-  1703984,
-  1703985,
-  1703982,
-  1703983,
-  1703981,
-  1703829,
-  1703826,
-  1703824,
-  1703825,
-  1703822,
-  1703823,
-  1703820,
-  1703821,
-  1705014,
-  1703675,
-  1703676,
-  1703677,
-  1703678,
-  1703679,
-  1703674,
-  1705000,
-  1705010,
-  1705011,
-  1705012,
-  1705013,
-  1705015,
-  1705016,
-  1705017,
-  1705018,
-  1705019,
-  1703670,
-  1703671,
-  1703672,
-  1703673,
-  1720870,
-  1696270,
-  1708840,
-  1720002,
-  1092291,
-  1733900,
-  1588720,
-  1351990,
-  995670,
-  1365200,
-  1144645,
-  1004950,
-  1550160,
-  1550161,
-  1192340,
-  562375,
-  292712,
-  1642320,
-  1438690,
-  1640381,
-  1247480,
-  213195,
-  213198,
-  213199,
-  213197,
-  258803,
-  258800,
-  1682480,
-  1593470,
-  1630050,
-  1656340,
-  1700060,
-  1637531,
-  1731810,
-  1731620,
-  1731780,
-  223597,
-  1702290,
-  982600,
-  1637530,
-  1663240,
-  325971,
-  1438000,
-  1734100,
-  1115940,
-  1643091,
-  1643090,
-  898962,
-  1289910,
-  563890,
-  1161370,
-  400490,
-  715190,
-  1667600,
-  1559320,
-  1667620,
-  1667660,
-  1667610,
-  836910,
-  1287082,
-  554390,
-  1514530,
-  1584890,
-  1279780,
-  1273190,
-  1288000,
-  417464,
-  645840,
-  1472856,
-  1472859,
-  1472861,
-  1472857,
-  1472858,
-  1472860,
-  1472862,
-  236590,
-  969570,
-  1726920,
-  711020,
-  711021,
-  711022,
-  711023,
-  370340,
-  1707440,
-  1596666,
-  1370350,
-  555120,
-  1179260,
-  1731980,
-  1440930,
-  342010,
-  1095031,
-  1205100,
-  240820,
-  327172,
-  56493,
-  56480,
-  1722460,
-  769610,
-  345980,
-  639000,
-  1281330,
-  568960,
-  667290,
-  376938,
-  861872,
-  22420,
-  347213,
-  781020,
-  1724750,
-  1179930,
-  781010,
-  266930,
-  1248380,
-  1527740,
-  259250,
-  463794,
-  1155760,
-  1067210,
-  768830,
-  1686030,
-  1239150,
-  1127600,
-  380710,
-  1729890,
-  1123390,
-  909720,
-  1149540,
-  334780,
-  1476190,
-  798750,
-  1664880,
-  1001371,
-  1416640,
-  1267590,
-  417465,
-  1627910,
-  1717480,
-  817270,
-  760420,
-  845980,
-  552950,
-  1506192,
-  1506194,
-  1506193,
-  1506191,
-  1506195,
-  1506190,
-  1415640,
-  834131,
-  834130,
-  1264040,
-  1374380,
-  1085400,
-  939480,
-  1728910,
-  1348710,
-  277775,
-  820203,
-  678003,
-  967287,
-  834407,
-  1721320,
-  1629020,
-  1144410,
-  355340,
-  1034630,
-  1720690,
-  1720691,
-  1720692,
-  1720693,
-  1720694,
-  1720695,
-  1720440,
-  1720696,
-  1720441,
-  1720697,
-  1720442,
-  1720698,
-  1720443,
-  1720699,
-  1720444,
-  1720445,
-  1720446,
-  1720447,
-  1720448,
-  1720449,
-  1415430,
-  47899,
-  1705001,
-  1705003,
-  1705004,
-  1705006,
-  1705007,
-  1705009,
-  1720001,
-  1720003,
-  1720004,
-  1720009,
-  1720000,
-  1720005,
-  1720006,
-  1720007,
-  1720008,
-  1705008,
-  1705002,
-  1705005,
-  1705277,
-  1705275,
-  1705270,
-  1705272,
-  1705274,
-  1705276,
-  1705278,
-  1705279,
-  1705271,
-  1705273,
-  1700561,
-  1700568,
-  1700560,
-  1700562,
-  1700563,
-  1700567,
-  1700569,
-  1700566,
-  1700564,
-  1700565,
-  1699620,
-  1699621,
-  1699623,
-  1699624,
-  1699625,
-  1699626,
-  1699627,
-  1699628,
-  1699629,
-  1697391,
-  1697392,
-  1697393,
-  1697394,
-  1697395,
-  1697396,
-  1697397,
-  1697399,
-  1697390,
-  1699622,
-  1697398,
-  606970,
-  1255310,
-  1113821,
-  1725780,
-  1725790,
-  1652530,
-  778160,
-  1633651,
-  779280,
-  1727700,
-  1728730,
-  1709840,
-  1726670,
-  528620,
-  1059291,
-  1281010,
-  689950,
-  852430,
-  210945,
-  1123960,
-  1628250,
-  1628252,
-  1628254,
-  1628255,
-  1628253,
-  1365350,
-  1176922,
-  870276,
-  1680960,
-  1680973,
-  318793,
-  234787,
-  234772,
-  893550,
-  234782,
-  219097,
-  1621670,
-  1634697,
-  1634705,
-  1634707,
-  1634713,
-  1634699,
-  1634711,
-  1634712,
-  1634702,
-  1634706,
-  1567340,
-  1499350,
-  1191850,
-  1343612,
-  1427380,
-  508150,
-  648420,
-  1248430,
-  1697580,
-  1664150,
-  1664151,
-  1664152,
-  1664153,
-  933504,
-  938440,
-  1718360,
-  466545,
-  466549,
-  1711330,
-  1095030,
-  1575412,
-  1575413,
-  1575414,
-  1575415,
-  1158270,
-  349350,
-  456960,
-  1286914,
-  639860,
-  666232,
-  1705600,
-  1634440,
-  685220,
-  401078,
-  1316029,
-  1009860,
-  562630,
-  593360,
-  1706200,
-  990690,
-  537320,
-  476392,
-  537321,
-  537322,
-  537324,
-  464890,
-  1616530,
-  1436290,
-  331930,
-  1634140,
-  1724520,
-  1586200,
-  1714110,
-  1699800,
-  1706840,
-  1719010,
-  629990,
-  1082359,
-  1082358,
-  1235763,
-  344450,
-  1710660,
-  1055670,
-  28011,
-  28010,
-  897870,
-  940370,
-  939590,
-  915990,
-  938530,
-  917590,
-  938540,
-  1105800,
-  1518790,
-  1154760,
-  853360,
-  1441877,
-  1441874,
-  1196100,
-  367210,
-  1113824,
-  488470,
-  715110,
-  215003,
-  218785,
-  1509410,
-  916410,
-  636630,
-  1144681,
-  203765,
-  203766,
-  373340,
-  1132962,
-  648293,
-  334792,
-  208812,
-  208816,
-  541750,
-  418680,
-  418690,
-  418700,
-  418710,
-  505540,
-  418760,
-  418770,
-  418780,
-  418790,
-  418800,
-  418810,
-  688090,
-  1147154,
-  1621510,
-  1233100,
-  975320,
-  712340,
-  298990,
-  943200,
-  849306,
-  849309,
-  209812,
-  275690,
-  580081,
-  1449441,
-  708170,
-  1708930,
-  1106170,
-  1228340,
-  1725140,
-  570660,
-  1708440,
-  1071670,
-  433091,
-  1137640,
-  1079460,
-  1010135,
-  484860,
-  420030,
-  1699610,
-  1700542,
-  1700543,
-  1700544,
-  1700545,
-  1700547,
-  1700548,
-  1700549,
-  1700541,
-  1700546,
-  1700540,
-  1699618,
-  1699619,
-  1699611,
-  1699612,
-  1699614,
-  1699615,
-  1699616,
-  1699617,
-  1699613,
-  1697380,
-  1697383,
-  1697384,
-  1697385,
-  1697389,
-  1697388,
-  1697381,
-  1697386,
-  1697387,
-  1697382,
-  1704995,
-  1704998,
-  1703668,
-  1704996,
-  1704997,
-  1704999,
-  1703665,
-  1703667,
-  1703669,
-  1703666,
-  1703971,
-  1703972,
-  1703973,
-  1703976,
-  1703978,
-  1703979,
-  1703815,
-  1703819,
-  1703816,
-  1703817,
-  1703818,
-  1703977,
-  1703974,
-  1703975,
-  1703970,
-  1705269,
-  1704350,
-  1704354,
-  1704358,
-  1704359,
-  1704353,
-  1704355,
-  1704356,
-  1704357,
-  1705268,
-  1704351,
-  1704352,
-  1705261,
-  1705262,
-  1705263,
-  1705264,
-  1705266,
-  1705267,
-  1705260,
-  1705265,
-  378461,
-  740140,
-  348310,
-  456221,
-  466548,
-  248750,
-  34842,
-  645430,
-  798520,
-  616300,
-  698560,
-  476391,
-  537323,
-  537325,
-  714230,
-  462660,
-  476390,
-  431430,
-  1116450,
-  1716060,
-  1091150,
-  513800,
-  1351060,
-  438690,
-  1294530,
-  707390,
-  988750,
-  1717970,
-  1506370,
-  1527810,
-  1496460,
-  1455981,
-  1453585,
-  1453584,
-  1593540,
-  1254350,
-  858240,
-  1669720,
-  1582821,
-  1496331,
-  728300,
-  1351790,
-  597071,
-  226667,
-  73031,
-  1640850,
-  345900,
-  807460,
-  807470,
-  807490,
-  807500,
-  807450,
-  569400,
-  1531472,
-  1596632,
-  561620,
-  563850,
-  1439430,
-  282090,
-  222558,
-  235940,
-  1464060,
-  390750,
-  1453580,
-  1453581,
-  1453582,
-  1453583,
-  1484290,
-  1485220,
-  1477111,
-  1230275,
-  770975,
-  250300,
-  1718950,
-  1718951,
-  1718960,
-  1718970,
-  1718980,
-  1718140,
-  1718150,
-  1718930,
-  1718170,
-  622710,
-  1522211,
-  1598482,
-  1598481,
-  1598480,
-  1698380,
-  1698560,
-  1694780,
-  748260,
-  240500,
-  260301,
-  249093,
-  231495,
-  231493,
-  249103,
-  344353,
-  344355,
-  344358,
-  344380,
-  344381,
-  344383,
-  344384,
-  344386,
-  344387,
-  344389,
-  344390,
-  231494,
-  344392,
-  344393,
-  344395,
-  371843,
-  371846,
-  371847,
-  260310,
-  322840,
-  322830,
-  322820,
-  1324060,
-  558480,
-  1660740,
-  1665842,
-  1697220,
-  1004220,
-  1697211,
-  203773,
-  1721900,
-  405580,
-  559430,
-  1719569,
-  1719281,
-  1719284,
-  1719285,
-  1719567,
-  1719568,
-  1719560,
-  1719561,
-  1719562,
-  1719563,
-  1719564,
-  1719565,
-  1719566,
-  1719286,
-  1719287,
-  1719288,
-  1719280,
-  1719282,
-  1719283,
-  1719289,
-  1691240,
-  1696470,
-  407473,
-  1071370,
-  22630,
-  855170,
-  372900,
-  382451,
-  545090,
-  452522,
-  1710020,
-  1203520,
-  1203530,
-  1202190,
-  1125210,
-  874610,
-  728910,
-  773471,
-  627430,
-  467980,
-  308310,
-  1351260,
-  22631,
-  22632,
-  22633,
-  22634,
-  1676044,
-  556150,
-  1408620,
-  1709560,
-  1014700,
-  920570,
-  278120,
-  1634692,
-  1634693,
-  281340,
-  1110540,
-  1110541,
-  1110550,
-  1110551,
-  1110552,
-  1110553,
-  493130,
-  1716580,
-  1716581,
-  493160,
-  1089390,
-  1217400,
-  1217401,
-  356750,
-  1719440,
-  920980,
-  1124770,
-  17097,
-  1133020,
-  445990,
-  1338470,
-  496431,
-  1599194,
-  1599192,
-  1599193,
-  1599191,
-  1599190,
-  1104750,
-  949900,
-  1235762,
-  282510,
-  1710030,
-  1713490,
-  1623250,
-  1615200,
-  1442990,
-  1694910,
-  1643420,
-  1461853,
-  1116410,
-  324343,
-  643740,
-  1625320,
-  1365340,
-  403520,
-  379562,
-  277741,
-  562390,
-  610704,
-  1711390,
-  1715610,
-  1647966,
-  1315442,
-  774011,
-  547560,
-  369470,
-  360020,
-  316470,
-  1643230,
-  817310,
-  310260,
-  310240,
-  310280,
-  310300,
-  623530,
-  950270,
-  958711,
-  1013740,
-  1272640,
-  1272641,
-  1272642,
-  1272643,
-  1272644,
-  1272645,
-  1238870,
-  1253300,
-  1160241,
-  1116620,
-  1707020,
-  369610,
-  286971,
-  65249,
-  1697960,
-  1707022,
-  1707021,
-  1184972,
-  1184971,
-  1209150,
-  1707920,
-  1707921,
-  1707922,
-  1707930,
-  1707931,
-  1707932,
-  1707910,
-  1707933,
-  1704280,
-  1124540,
-  1048050,
-  928100,
-  215371,
-  1568221,
-  1658730,
-  55389,
-  55400,
-  1498090,
-  502490,
-  376955,
-  988171,
-  759130,
-  933670,
-  1083280,
-  282201,
-  1697373,
-  1217601,
-  999470,
-  999520,
-  1025640,
-  1025660,
-  1025680,
-  1000680,
-  997100,
-  1000690,
-  1247750,
-  662352,
-  1699600,
-  1699601,
-  1699602,
-  1699603,
-  1699604,
-  1699605,
-  1699606,
-  1700532,
-  1700533,
-  1700534,
-  1699607,
-  1699608,
-  1699609,
-  1700531,
-  1700535,
-  1700521,
-  1700522,
-  1700523,
-  1700530,
-  1700520,
-  1697378,
-  1697376,
-  1697377,
-  1697379,
-  1697370,
-  1697371,
-  1697372,
-  1697374,
-  1697375,
-  1658630,
-  1654950,
-  1150031,
-  1130780,
-  584770,
-  582577,
-  420540,
-  1268561,
-  65255,
-  24083,
-  1087740,
-  1687290,
-  1190510,
-  1190490,
-  1190500,
-  1282960,
-  246250,
-  1715520,
-  1715521,
-  1710300,
-  1710301,
-  1039811,
-  1693720,
-  258743,
-  1463440,
-  1715990,
-  1083282,
-  376956,
-  1682510,
-  1009630,
-  486970,
-  414301,
-  1472710,
-  570220,
-  1701480,
-  1144685,
-  1115560,
-  1083910,
-  1515064,
-  42966,
-  42965,
-  1458153,
-  1713281,
-  1715230,
-  1484231,
-  435881,
-  1322430,
-  1536510,
-  1708931,
-  231470,
-  231471,
-  231472,
-  231474,
-  231475,
-  231476,
-  231478,
-  231483,
-  231486,
-  231491,
-  231492,
-  551821,
-  249088,
-  249094,
-  249100,
-  249101,
-  249102,
-  249104,
-  249105,
-  249106,
-  249107,
-  249108,
-  249109,
-  249110,
-  249111,
-  249112,
-  249113,
-  249114,
-  249115,
-  249116,
-  231453,
-  249117,
-  231454,
-  231455,
-  231457,
-  231458,
-  231459,
-  231460,
-  231462,
-  231463,
-  231464,
-  231466,
-  231467,
-  231468,
-  231469,
-  231473,
-  231477,
-  231482,
-  231484,
-  231485,
-  231488,
-  231504,
-  231505,
-  231506,
-  231507,
-  260292,
-  249081,
-  249086,
-  231451,
-  228221,
-  228222,
-  228223,
-  317850,
-  260290,
-  260305,
-  260308,
-  1638580,
-  1662430,
-  1604190,
-  1186561,
-  1708660,
-  932780,
-  1109207,
-  970640,
-  1123700,
-  1182540,
-  999150,
-  1711380,
-  1711410,
-  1712770,
-  1712780,
-  1712790,
-  1710080,
-  1699360,
-  1710060,
-  1710061,
-  1710070,
-  1198832,
-  1697210,
-  1697230,
-  1634708,
-  1634709,
-  1634710,
-  1634700,
-  1634701,
-  1634703,
-  1634704,
-  1634698,
-  1552561,
-  1588350,
-  1198780,
-  1179451,
-  1179452,
-  1179453,
-  1179454,
-  1179455,
-  1179456,
-  1179457,
-  1179458,
-  1486240,
-  1486241,
-  1295330,
-  439241,
-  1357480,
-  485930,
-  1703410,
-  311361,
-  200322,
-  1497020,
-  1206130,
-  1019511,
-  1019491,
-  823980,
-  226457,
-  226454,
-  226451,
-  903840,
-  1703400,
-  1692610,
-  1668430,
-  1668390,
-  1379170,
-  1090161,
-  953681,
-  1705258,
-  1705250,
-  1705251,
-  1705252,
-  1705253,
-  1705254,
-  1705255,
-  1705256,
-  1705257,
-  1705259,
-  1700518,
-  1700519,
-  1699593,
-  1699595,
-  1699596,
-  1699598,
-  1699599,
-  1700515,
-  1700516,
-  1700517,
-  1699597,
-  1697369,
-  1697363,
-  1697365,
-  1697366,
-  1697367,
-  1697368,
-  972400,
-  875890,
-  455220,
-  329920,
-  1676230,
-  1317200,
-  271944,
-  1628460,
-  344070,
-  344080,
-  344090,
-  426280,
-  426281,
-  1316145,
-  678730,
-  678731,
-  678732,
-  678733,
-  678734,
-  505430,
-  381790,
-  381791,
-  666230,
-  700042,
-  419980,
-  1705630,
-  1706180,
-  453060,
-  1171400,
-  574670,
-  574671,
-  574672,
-  574673,
-  574674,
-  574675,
-  574676,
-  574677,
-  63213,
-  344060,
-  925650,
-  730262,
-  315050,
-  1567090,
-  1164210,
-  1563690,
-  806190,
-  1648641,
-  1648640,
-  110810,
-  292021,
-  235230,
-  1209530,
-  1209532,
-  1498530,
-  958710,
-  546260,
-  1698180,
-  1569311,
-  1569312,
-  1569313,
-  1569314,
-  1457800,
-  719670,
-  1706690,
-  591986,
-  1598110,
-  1442970,
-  1704610,
-  1695740,
-  1684770,
-  1691570,
-  1694950,
-  401700,
-  1171890,
-  1457450,
-  890320,
-  325590,
-  1679900,
-  1333740,
-  1492490,
-  1677710,
-  306460,
-  1377530,
-  1307540,
-  1400050,
-  1400051,
-  730616,
-  1677991,
-  1524862,
-  1524861,
-  1524860,
-  1526710,
-  1308110,
-  254673,
-  254674,
-  1623780,
-  1623782,
-  1623781,
-  1623783,
-  1673930,
-  1074260,
-  713560,
-  1269010,
-  1698580,
-  1367480,
-  207010,
-  207011,
-  1200345,
-  459460,
-  338650,
-  745580,
-  556212,
-  606971,
-  504640,
-  1485570,
-  1396230,
-  990202,
-  990201,
-  990200,
-  642800,
-  982110,
-  222610,
-  22400,
-  1012200,
-  1382900,
-  676080,
-  381792,
-  1179830,
-  1485292,
-  290402,
-  290400,
-  290401,
-  1109205,
-  593051,
-  1160540,
-  1711900,
-  747030,
-  465250,
-  208288,
-  1594350,
-  1107760,
-  543192,
-  1251870,
-  651510,
-  414680,
-  414640,
-  453620,
-  1705242,
-  1703966,
-  1703967,
-  1703968,
-  1703969,
-  1703965,
-  1704347,
-  1704348,
-  1704349,
-  1704342,
-  1704343,
-  1704344,
-  1704345,
-  1704346,
-  1705246,
-  1705247,
-  1705248,
-  1705249,
-  1704340,
-  1704341,
-  1705241,
-  1705243,
-  1705244,
-  1705245,
-  1705240,
-  1699585,
-  1699586,
-  1699587,
-  1699588,
-  1699590,
-  1699594,
-  1697355,
-  1697356,
-  1697357,
-  1697358,
-  1697359,
-  1697360,
-  1697361,
-  1697362,
-  1697364,
-  1700505,
-  1700509,
-  1700510,
-  1700512,
-  1700513,
-  1700514,
-  1699591,
-  1699592,
-  1700506,
-  1700507,
-  1700508,
-  1700511,
-  1699589,
-  454800,
-  222561,
-  1029412,
-  1224340,
-  1224341,
-  1200341,
-  419120,
-  295520,
-  792980,
-  49603,
-  63210,
-  448188,
-  258644,
-  457842,
-  1623540,
-  1583100,
-  1534129,
-  1534114,
-  1577784,
-  1577786,
-  381240,
-  208352,
-  1484230,
-  1678240,
-  1610880,
-  500239,
-  324020,
-  1697440,
-  1352030,
-  822000,
-  1710470,
-  452521,
-  554340,
-  267788,
-  1695760,
-  1695770,
-  1695711,
-  1695731,
-  526850,
-  450730,
-  1295130,
-  1295180,
-  1096030,
-  1329260,
-  1329261,
-  1121960,
-  1111500,
-  1215220,
-  1680940,
-  1681050,
-  1523970,
-  1707820,
-  1652862,
-  1652863,
-  1211473,
-  849303,
-  374800,
-  1641150,
-  1643620,
-  1643630,
-  306396,
-  1365330,
-  1680950,
-  1680971,
-  1680972,
-  1633482,
-  1633483,
-  1638310,
-  1709140,
-  491490,
-  879240,
-  621923,
-  654180,
-  654189,
-  1669710,
-  1146320,
-  227130,
-  227132,
-  1675550,
-  1676800,
-  1671190,
-  1676810,
-  1675560,
-  1676820,
-  1676830,
-  1675570,
-  547760,
-  1121600,
-  417463,
-  279603,
-  515170,
-  891730,
-  360350,
-  1405940,
-  1590590,
-  1224970,
-  1696360,
-  996742,
-  974302,
-  761590,
-  820930,
-  1704339,
-  1704338,
-  1704337,
-  1704335,
-  1704336,
-  1705238,
-  1705239,
-  1705236,
-  1705237,
-  1705235,
-  1700502,
-  1700503,
-  1700504,
-  1699584,
-  1697345,
-  1697346,
-  1697348,
-  1697352,
-  1697353,
-  1700496,
-  1700498,
-  1700500,
-  1695127,
-  1699576,
-  1699577,
-  1699578,
-  1699580,
-  1699582,
-  1699583,
-  1697347,
-  1697349,
-  1697351,
-  1700499,
-  1699575,
-  1699581,
-  1700495,
-  1700501,
-  1697350,
-  1700497,
-  1697354,
-  1699579,
-  363010,
-  613660,
-  318751,
-  1669920,
-  1316142,
-  1099592,
-  1647950,
-  1647961,
-  1647964,
-  1647965,
-  1102430,
-  1647967,
-  1647968,
-  437620,
-  1700475,
-  1700476,
-  1700477,
-  1700478,
-  1700479,
-  1700480,
-  1700481,
-  1700482,
-  1700483,
-  1700484,
-  1700485,
-  1700486,
-  1700487,
-  1700488,
-  1700489,
-  1700490,
-  1700491,
-  1656972,
-  1700492,
-  1656973,
-  1700493,
-  1700494,
-  1704100,
-  9908,
-  399050,
-  417740,
-  1704440,
-  1656974,
-  1647963,
-  1524671,
-  1524670,
-  701531,
-  1490540,
-  1290210,
-  1207560,
-  1217320,
-  1240151,
-  1230950,
-  1193360,
-  1221870,
-  1060740,
-  1103260,
-  1149110,
-  1167340,
-  1316183,
-  1449883,
-  1449890,
-  1701070,
-  1639970,
-  1678190,
-  1609980,
-  1612340,
-  1684800,
-  1605730,
-  731000,
-  585481,
-  585482,
-  1327790,
-  1091850,
-  474764,
-  598020,
-  1287059,
-  932740,
-  932741,
-  932744,
-  932742,
-  932743,
-  819820,
-  819810,
-  938950,
-  819850,
-  819840,
-  1214810,
-  441940,
-  1634694,
-  1634696,
-  1649711,
-  1649710,
-  1634695,
-  1634691,
-  1634690,
-  709150,
-  1456371,
-  1261250,
-  728850,
-  1331250,
-  218786,
-  434943,
-  1517480,
-  1118250,
-  1118251,
-  1118260,
-  1118262,
-  1401452,
-  1401451,
-  317860,
-  1401450,
-  1081660,
-  1071395,
-  1071394,
-  1071393,
-  1071392,
-  1071391,
-  1071390,
-  1071379,
-  1071378,
-  1071377,
-  1071376,
-  1071375,
-  1071374,
-  1071373,
-  1071372,
-  1071371,
-  1118294,
-  1118293,
-  1118291,
-  1118287,
-  1118286,
-  1118285,
-  1118284,
-  1118283,
-  1118282,
-  1118281,
-  1118280,
-  1118273,
-  1118271,
-  1118263,
-  1005030,
-  1005020,
-  1664830,
-  1384690,
-  1664831,
-  1643380,
-  1083090,
-  1448920,
-  461245,
-  1184970,
-  1697341,
-  1697342,
-  1697343,
-  1697344,
-  1699555,
-  1699556,
-  1699558,
-  1699559,
-  1699570,
-  1699571,
-  1699572,
-  1699573,
-  1699574,
-  1697335,
-  1697336,
-  1697337,
-  1697338,
-  1697339,
-  1697340,
-  1699557,
-  22430,
-  282470,
-  883310,
-  1690470,
-  1691140,
-  1690670,
-  57923,
-  1638582,
-  1638581,
-  1305040,
-  848320,
-  512035,
-  229754,
-  73030,
-  1584700,
-  576300,
-  343950,
-  1517482,
-  670560,
-  56438,
-  793551,
-  869230,
-  1105030,
-  1699550,
-  1699551,
-  1699552,
-  1699553,
-  1699554,
-  1697330,
-  1697331,
-  1697332,
-  1697333,
-  1697334,
-  406540,
-  1089040,
-  361843,
-  434910,
-  573831,
-  224165,
-  271943,
-  35136,
-  35138,
-  102622,
-  35135,
-  871600,
-  1643290,
-  1681790,
-  1543700,
-  1705900,
-  1169650,
-  333811,
-  333812,
-  333813,
-  333814,
-  333815,
-  333816,
-  333817,
-  249320,
-  208302,
-  1472450,
-  1682830,
-  875980,
-  372870,
-  434900,
-  434901,
-  361842,
-  1494336,
-  4932,
-  1698490,
-  1637251,
-  1082354,
-  388470,
-  577020,
-  370003,
-  1406060,
-  431980,
-  975400,
-  321300,
-  893160,
-  510610,
-  1674040,
-  1620780,
-  1284010,
-  208287,
-  1221340,
-  1300851,
-  1211471,
-  1685290,
-  1224820,
-  911990,
-  897230,
-  897240,
-  897250,
-  361841,
-  1701430,
-  677900,
-  398860,
-  1700360,
-  1697260,
-  1681690,
-  10604,
-  1659110,
-  1622460,
-  1652861,
-  1644613,
-  750492,
-  1641950,
-  1688000,
-  1697325,
-  1697326,
-  1697327,
-  1697329,
-  1697328,
-  1699548,
-  1699549,
-  1699545,
-  1699546,
-  1699547,
-  896713,
-  1700390,
-  1637350,
-  1159080,
-  1690130,
-  1416391,
-  1702640,
-  1681270,
-  827320,
-  1368110,
-  1121970,
-  1699330,
-  1695750,
-  1699340,
-  1699350,
-  1699100,
-  1695780,
-  1695710,
-  1695730,
-  1671030,
-  610703,
-  408101,
-  1677542,
-  1652450,
-  543190,
-  543191,
-  543193,
-  475130,
-  475131,
-  1696060,
-  1696061,
-  1696062,
-  1620552,
-  460890,
-  1518153,
-  614581,
-  1314130,
-  1608610,
-  737002,
-  412090,
-  1685340,
-  667250,
-  305187,
-  1680970,
-  1680920,
-  1680930,
-  1620550,
-  1620551,
-  1698050,
-  594182,
-  1682710,
-  217430,
-  1578355,
-  1316242,
-  1316260,
-  1697510,
-  63211,
-  63212,
-  707080,
-  710430,
-  1356010,
-  1676500,
-  1680750,
-  500247,
-  1250690,
-  1677320,
-  1691540,
-  1674280,
-  1684730,
-  1439570,
-  1633610,
-  1583110,
-  1690750,
-  1677210,
-  1450370,
-  893760,
-  1123701,
-  1162341,
-  65224,
-  1287760,
-  1054920,
-  1126350,
-  1365320,
-  516760,
-  1430490,
-  1552585,
-  1552584,
-  1552583,
-  1552582,
-  1552581,
-  1552580,
-  1552569,
-  1552568,
-  1552567,
-  1552566,
-  1552565,
-  1552564,
-  1552563,
-  1552562,
-  1461854,
-  1461852,
-  1461851,
-  1552560,
-  924150,
-  208362,
-  306610,
-  770480,
-  379568,
-  521600,
-  353571,
-  1580350,
-  1321550,
-  1238850,
-  1259490,
-  1259491,
-  1259492,
-  1259493,
-  1259494,
-  1259495,
-  1259496,
-  1259497,
-  1259498,
-  1259499,
-  347880,
-  1066850,
-  1130600,
-  425960,
-  1518150,
-  108230,
-  684850,
-  1695228,
-  1695223,
-  1695224,
-  1695225,
-  1695226,
-  1695227,
-  1695229,
-  1695216,
-  1695217,
-  1695218,
-  1695219,
-  1695220,
-  1695221,
-  1695222,
-  1695214,
-  1695215,
-  1695210,
-  1695211,
-  1695212,
-  1695213,
-  1695195,
-  1695196,
-  1695197,
-  1695198,
-  1695199,
-  1695192,
-  1695193,
-  1695194,
-  1695188,
-  1695189,
-  1695190,
-  1695191,
-  1695181,
-  1695183,
-  1695185,
-  1695186,
-  1695187,
-  1695184,
-  1695182,
-  1695174,
-  1695175,
-  1695176,
-  1695179,
-  1695180,
-  1695170,
-  1695171,
-  1695172,
-  1695173,
-  1695177,
-  1695178,
-  1695120,
-  1695121,
-  1695122,
-  1695124,
-  1695125,
-  1695126,
-  1695165,
-  1695166,
-  1695167,
-  1695168,
-  1695169,
-  1695105,
-  1695106,
-  1695107,
-  1695108,
-  1695109,
-  1695110,
-  1695111,
-  1695112,
-  1695113,
-  1695115,
-  1695116,
-  1695117,
-  1695118,
-  1695119,
-  1695114,
-  1695123,
-  1695128,
-  1695129,
-  1695143,
-  1695149,
-  1695161,
-  1695162,
-  1695163,
-  1695164,
-  1695146,
-  1695147,
-  1695148,
-  1695160,
-  1695140,
-  1695141,
-  1695142,
-  1695144,
-  1695145,
-  602750,
-  988470,
-  1641110,
-  389930,
-  222549,
-  551820,
-  456630,
-  1358890,
-  1689710,
-  951650,
-  324340,
-  826090,
-  1421551,
-  556880,
-  488820,
-  1089672,
-  1681300,
-  301140,
-  1299530,
-  1678260,
-  875960,
-  678001,
-  1086760,
-  1411650,
-  1240900,
-  1250980,
-  1143510,
-  331353,
-  331354,
-  331355,
-  331356,
-  331357,
-  331358,
-  344170,
-  344171,
-  344172,
-  344173,
-  344174,
-  344175,
-  344176,
-  344177,
-  344178,
-  331350,
-  331351,
-  331352,
-  308269,
-  308268,
-  308267,
-  308266,
-  308265,
-  308264,
-  308263,
-  308262,
-  308261,
-  1174581,
-  46342,
-  274440,
-  64008,
-  622360,
-  46362,
-  523821,
-  323650,
-  523850,
-  523851,
-  523852,
-  203353,
-  487520,
-  426080,
-  426081,
-  322700,
-  323740,
-  306340,
-  313790,
-  1160140,
-  1021901,
-  451560,
-  311540,
-  420640,
-  1696690,
-  1383870,
-  1612260,
-  1253990,
-  1279960,
-  1696120,
-  1484360,
-  1348470,
-  1348500,
-  1503710,
-  1162201,
-  1162203,
-  874341,
-  874342,
-  920565,
-  426100,
-  621920,
-  956490,
-  1637960,
-  1213610,
-  1258155,
-  1431481,
-  1431486,
-  1431493,
-  1431494,
-  1431495,
-  1431496,
-  1431497,
-  1431498,
-  1015900,
-  470070,
-  909690,
-  976220,
-  838770,
-  1691930,
-  1691931,
-  1691940,
-  1691950,
-  1691960,
-  1691910,
-  1691920,
-  1674951,
-  1684590,
-  1684591,
-  1684592,
-  1684960,
-  1684961,
-  1670142,
-  1670140,
-  1670141,
-  207112,
-  1644614,
-  1652860,
-  1688990,
-  400780,
-  391880,
-  323340,
-  1637250,
-  1070000,
-  534330,
-  1679580,
-  1646940,
-  1237523,
-  1238103,
-  1209471,
-  1012980,
-  421273,
-  339396,
-  1695690,
-  1695691,
-  921870,
-  1128700,
-  621840,
-  284430,
-  929100,
-  1520141,
-  1018761,
-  1520140,
-  1194780,
-  1194781,
-  1018760,
-  346170,
-  1677541,
-  1677540,
-  1642020,
-  379587,
-  457085,
-  379541,
-  379586,
-  352230,
-  379588,
-  1680450,
-  1680480,
-  1599260,
-  1666380,
-  1089270,
-  1024554,
-  1689290,
-  1689291,
-  1689292,
-  1405520,
-  414601,
-  1061310,
-  1688900,
-  1443010,
-  829960,
-  937800,
-  1041820,
-  1650000,
-  836811,
-  768050,
-  353051,
-  1464063,
-  1267504,
-  678004,
-  1615500,
-  474761,
-  49604,
-  1000150,
-  1297730,
-  1127750,
-  1131370,
-  493420,
-  1128820,
-  1691810,
-  1131440,
-  554950,
-  1290700,
-  1315809,
-  1695720,
-  1672300,
-  1569020,
-  1567750,
-  1569050,
-  1569030,
-  1569060,
-  1583430,
-  1627584,
-  1627585,
-  1627586,
-  1627583,
-  1322670,
-  1397600,
-  1667560,
-  1439530,
-  1439540,
-  1667410,
-  1674210,
-  1675011,
-  1675010,
-  1536953,
-  1666020,
-  1666040,
-  1666041,
-  687820,
-  403870,
-  10608,
-  10606,
-  1692833,
-  1692760,
-  1692755,
-  1692756,
-  1692757,
-  1692758,
-  1692759,
-  1692761,
-  1692762,
-  1692763,
-  1692764,
-  1692765,
-  1692766,
-  1692767,
-  1692768,
-  1692769,
-  1692770,
-  1692771,
-  1692772,
-  1692773,
-  1692774,
-  1692775,
-  1692776,
-  1692777,
-  1692778,
-  1692779,
-  1692780,
-  1692781,
-  1692782,
-  1692783,
-  1692784,
-  1692785,
-  1692786,
-  1692787,
-  1692788,
-  1692789,
-  1692790,
-  1692791,
-  1692799,
-  1692810,
-  1692813,
-  1692814,
-  1692816,
-  1692792,
-  1692793,
-  1692808,
-  1692815,
-  1692817,
-  1692794,
-  1692796,
-  1692797,
-  1692800,
-  1692803,
-  1692807,
-  1692812,
-  1692818,
-  1692795,
-  1692798,
-  1692801,
-  1692802,
-  1692804,
-  1692805,
-  1692806,
-  1692809,
-  1692811,
-  1692821,
-  1692822,
-  1692823,
-  1692824,
-  1692825,
-  1692826,
-  1692827,
-  1692828,
-  1692829,
-  1692830,
-  1692831,
-  1692832,
-  1692834,
-  1692835,
-  1692836,
-  1692837,
-  1692838,
-  1692839,
-  1692820,
-  1692819,
-  1692840,
-  1692841,
-  1692842,
-  1692843,
-  1692844,
-  1692845,
-  1692846,
-  1692847,
-  1692848,
-  1692849,
-  871900,
-  598021,
-  414240,
-  1072562,
-  326810,
-  1400309,
-  1688500,
-  1400308,
-  1400307,
-  1615280,
-  273381,
-  929480,
-  1669210,
-  1151110,
-  1429751,
-  1303030,
-  483840,
-  1205600,
-  258647,
-  1423900,
-  1657140,
-  1657141,
-  244062,
-  244063,
-  1033490,
-  237030,
-  1098166,
-  540340,
-  662350,
-  1100810,
-  348561,
-  686790,
-  1054871,
-  411890,
-  926020,
-  1034471,
-  1691980,
-  1672580,
-  1672570,
-  1671680,
-  1670150,
-  511891,
-  458640,
-  883940,
-  1544950,
-  311163,
-  754923,
-  1684890,
-  1107840,
-  1000714,
-  1655230,
-  222611,
-  456800,
-  459070,
-  1393040,
-  1268500,
-  1479110,
-  1344610,
-  658270,
-  1675930,
-  512034,
-  1664030,
-  1664031,
-  1664032,
-  1664033,
-  1664034,
-  1686040,
-  1641160,
-  1177763,
-  1177764,
-  1177765,
-  1177770,
-  1177771,
-  1177772,
-  1177773,
-  1177774,
-  1177775,
-  1177776,
-  1177777,
-  1177780,
-  1177781,
-  1177782,
-  1177783,
-  1177784,
-  1177785,
-  1177787,
-  1177800,
-  1177801,
-  1177802,
-  1177803,
-  1177804,
-  1177805,
-  1177806,
-  1177807,
-  1197890,
-  1197891,
-  1197892,
-  1197893,
-  1197894,
-  1197895,
-  1197900,
-  1197901,
-  1197902,
-  1197903,
-  1197904,
-  1197905,
-  1197906,
-  1197910,
-  1197911,
-  1197912,
-  1197913,
-  1197914,
-  1197915,
-  516620,
-  516621,
-  259253,
-  1494430,
-  1592960,
-  29570,
-  319012,
-  874344,
-  434940,
-  408102,
-  431191,
-  431190,
-  434941,
-  1196710,
-  913750,
-  1640200,
-  1691811,
-  1680128,
-  1680129,
-  1680130,
-  1680131,
-  1680132,
-  1680133,
-  218630,
-  1680134,
-  1680135,
-  1680136,
-  1688840,
-  1680137,
-  1680138,
-  1680139,
-  239390,
-  600620,
-  997680,
-  1267250,
-  273480,
-  341841,
-  1069420,
-  1069421,
-  222573,
-  1069422,
-  1079670,
-  1079671,
-  666233,
-  1688450,
-  1688451,
-  649860,
-  249740,
-  561040,
-  1351570,
-  1351571,
-  1351572,
-  642200,
-  538535,
-  1499580,
-  1641161,
-  1509580,
-  459480,
-  1680095,
-  1509600,
-  1680096,
-  1680097,
-  1680098,
-  1680099,
-  1680100,
-  1680101,
-  1680102,
-  1680103,
-  1680104,
-  1680105,
-  1509610,
-  1680106,
-  1680107,
-  1680108,
-  1680109,
-  1680110,
-  1680111,
-  1680112,
-  1680113,
-  1680114,
-  1680115,
-  1509620,
-  1680116,
-  1680117,
-  1680118,
-  1680119,
-  1525240,
-  1680120,
-  1680121,
-  1348090,
-  1680122,
-  1680123,
-  1680124,
-  1680125,
-  1680126,
-  1680127,
-  379564,
-  693760,
-  1352160,
-  1356222,
-  1685050,
-  1685080,
-  1685081,
-  1685090,
-  1685100,
-  1685110,
-  1670990,
-  1671000,
-  1671040,
-  1004840,
-  1004870,
-  1004871,
-  1004880,
-  1004881,
-  988680,
-  988820,
-  988660,
-  988661,
-  665970,
-  437122,
-  1390130,
-  1390131,
-  1390132,
-  898961,
-  1449610,
-  416424,
-  695740,
-  695743,
-  695742,
-  695741,
-  1004970,
-  1004900,
-  988662,
-  1517270,
-  1363591,
-  1379261,
-  1644610,
-  1644615,
-  1182190,
-  895440,
-  798541,
-  1085460,
-  1085470,
-  437120,
-  437121,
-  220801,
-  220802,
-  220803,
-  220804,
-  220805,
-  220806,
-  220807,
-  220808,
-  220809,
-  220810,
-  220812,
-  220813,
-  220811,
-  1455700,
-  1118261,
-  334781,
-  612341,
-  408380,
-  408381,
-  334773,
-  334782,
-  334790,
-  334770,
-  334774,
-  334772,
-  334791,
-  334793,
-  612340,
-  863160,
-  1290250,
-  1095500,
-  1141960,
-  1487500,
-  304320,
-  1024703,
-  954810,
-  883150,
-  1687610,
-  1365310,
-  692770,
-  650291,
-  360960,
-  1456373,
-  1456372,
-  1456370,
-  1456360,
-  1535410,
-  830440,
-  598390,
-  222627,
-  909640,
-  1046500,
-  622660,
-  590460,
-  326391,
-  450790,
-  245580,
-  1628050,
-  1341703,
-  794150,
-  1565930,
-  437701,
-  1242749,
-  445992,
-  455350,
-  562392,
-  1273370,
-  532021,
-  1682390,
-  1211209,
-  1674632,
-  1674633,
-  1674631,
-  1522420,
-  305186,
-  1600000,
-  385870,
-  938160,
-  1117300,
-  584060,
-  557390,
-  520430,
-  1491860,
-  643682,
-  468460,
-  1202290,
-  920566,
-  1015030,
-  1347720,
-  1636780,
-  1627580,
-  1627581,
-  1627582,
-  1644480,
-  1686300,
-  1688170,
-  1689100,
-  1055331,
-  939570,
-  1409380,
-  1373150,
-  506190,
-  841163,
-  437700,
-  616170,
-  525016,
-  1130770,
-  967380,
-  1648413,
-  436572,
-  1562720,
-  1143853,
-  540730,
-  1282190,
-  334771,
-  354710,
-  1682770,
-  999420,
-  1252870,
-  550880,
-  354330,
-  1039420,
-  1313800,
-  435870,
-  1157950,
-  1504511,
-  1611520,
-  791580,
-  577110,
-  688460,
-  677250,
-  247303,
-  210908,
-  719330,
-  258652,
-  1143520,
-  258679,
-  582380,
-  451030,
-  1242690,
-  1064720,
-  258656,
-  729490,
-  459140,
-  389150,
-  1102380,
-  1021190,
-  343461,
-  731171,
-  402290,
-  1195160,
-  404284,
-  1395100,
-  1437130,
-  1503980,
-  215002,
-  1420471,
-  1385932,
-  1255151,
-  1489800,
-  1683260,
-  351740,
-  987050,
-  1120025,
-  1195216,
-  1396820,
-  1424212,
-  573160,
-  1056761,
-  720860,
-  636710,
-  561150,
-  994210,
-  449394,
-  1682771,
-  475180,
-  1042390,
-  794343,
-  794345,
-  737270,
-  737272,
-  289570,
-  1475320,
-  1568300,
-  729240,
-  554260,
-  860700,
-  754200,
-  1143590,
-  1525860,
-  1279712,
-  1279710,
-  1648403,
-  1096890,
-  1279711,
-  1279713,
-  1053990,
-  1543950,
-  667680,
-  1680189,
-  1680185,
-  1680186,
-  1680187,
-  1680188,
-  1680181,
-  1680182,
-  1680183,
-  1680184,
-  1680180,
-  1454770,
-  350460,
-  327850,
-  1665100,
-  484910,
-  484920,
-  531650,
-  1679620,
-  1679630,
-  1679640,
-  1679600,
-  1679601,
-  1679610,
-  1679611,
-  1626000,
-  1548200,
-  629700,
-  1644611,
-  1644612,
-  1680160,
-  1680161,
-  1680162,
-  1680163,
-  1680164,
-  1680165,
-  1680166,
-  1680167,
-  1680168,
-  1680169,
-  1680150,
-  1680172,
-  1680176,
-  1680177,
-  1680140,
-  1680141,
-  1680142,
-  1680144,
-  1680148,
-  1680149,
-  1680153,
-  1680170,
-  1680173,
-  1680174,
-  1680175,
-  1680178,
-  1680179,
-  1680145,
-  1680146,
-  1680171,
-  1680159,
-  1680157,
-  1680158,
-  1680152,
-  1680154,
-  1680155,
-  1680156,
-  1680147,
-  1680151,
-  1680143,
-  464591,
-  408580,
-  1365580,
-  1317970,
-  337570,
-  1237720,
-  980591,
-  786810,
-  1246530,
-  962120,
-  210893,
-  411893,
-  1172860,
-  1000400,
-  222562,
-  1559470,
-  1537270,
-  249310,
-  210944,
-  874310,
-  343580,
-  639310,
-  360820,
-  1379360,
-  571770,
-  66002,
-  468723,
-  429730,
-  1155070,
-  1155050,
-  333891,
-  333892,
-  333890,
-  420410,
-  1682720,
-  1682730,
-  756280,
-  1666130,
-  1666131,
-  515680,
-  1560936,
-  1560937,
-  1542020,
-  1378950,
-  215997,
-  616130,
-  903410,
-  495160,
-  334112,
-  334113,
-  334110,
-  1205000,
-  1186610,
-  1166410,
-  1151661,
-  913400,
-  1151660,
-  1144420,
-  462290,
-  1654370,
-  602623,
-  1678310,
-  1210171,
-  1204130,
-  423369,
-  1200370,
-  770061,
-  770060,
-  1524780,
-  356950,
-  1682180,
-  297841,
-  286963,
-  1170791,
-  1170800,
-  1170803,
-  1170807,
-  315151,
-  376965,
-  1419960,
-  1005541,
-  452430,
-  70616,
-  1196060,
-  1196061,
-  1196050,
-  324344,
-  819410,
-  1019540,
-  947690,
-  783150,
-  799950,
-  1151730,
-  1677760,
-  1563810,
-  898960,
-  734430,
-  513730,
-  313430,
-  1511440,
-  1511441,
-  1511442,
-  1511443,
-  1511444,
-  1511445,
-  1460180,
-  223594,
-  1678120,
-  1476700,
-  1211474,
-  1365300,
-  1675735,
-  1675779,
-  1675785,
-  1675749,
-  1675715,
-  1675716,
-  1675717,
-  1675718,
-  1675719,
-  1675720,
-  1675721,
-  1675722,
-  1675723,
-  1675724,
-  1675725,
-  1675726,
-  1675727,
-  1675728,
-  1675743,
-  1675744,
-  1675745,
-  1675746,
-  1675747,
-  1675759,
-  1675775,
-  1675776,
-  1675748,
-  1675751,
-  1675753,
-  1675754,
-  1675758,
-  1675770,
-  1675771,
-  1675772,
-  1675773,
-  1675774,
-  1675777,
-  1675750,
-  1675755,
-  1675778,
-  1675752,
-  1675729,
-  1675730,
-  1675739,
-  1675742,
-  1675731,
-  1675732,
-  1675733,
-  1675734,
-  1675736,
-  1675737,
-  1675738,
-  1675740,
-  1675741,
-  1675756,
-  1675757,
-  1675780,
-  1675781,
-  1675782,
-  1675783,
-  1675784,
-  1675786,
-  1675787,
-  1675788,
-  1675789,
-  1675800,
-  1675801,
-  1675802,
-  1675803,
-  1675804,
-  1675805,
-  1675806,
-  1675807,
-  1675808,
-  1675809,
-  1675810,
-  1675811,
-  1675812,
-  1675814,
-  1675813,
-  1675815,
-  1675816,
-  1675817,
-  1675818,
-  1675819,
-  1675820,
-  1675821,
-  1675822,
-  1675823,
-  1675824,
-  1675825,
-  1675826,
-  1675827,
-  1675828,
-  1675829,
-  1050122,
-  309990,
-  277769,
-  15522,
-  1668750,
-  1663360,
-  1668740,
-  274120,
-  274122,
-  234777,
-  234781,
-  234785,
-  234794,
-  234771,
-  274121,
-  234775,
-  1461950,
-  577358,
-  1670840,
-  995770,
-  869670,
-  1566970,
-  1566971,
-  1164840,
-  1251490,
-  1131910,
-  894700,
-  1247010,
-  1356411,
-  425570,
-  399860,
-  1663022,
-  1663021,
-  1663020,
-  1650241,
-  1650240,
-  987070,
-  1421540,
-  1118130,
-  865070,
-  1518152,
-  1353980,
-  616200,
-  1172130,
-  1633480,
-  1633481,
-  215005,
-  880540,
-  327173,
-  769750,
-  1230830,
-  1117640,
-  1648520,
-  704150,
-  34281,
-  782310,
-  487300,
-  1140120,
-  776120,
-  518630,
-  374851,
-  353052,
-  1639280,
-  277774,
-  273152,
-  788983,
-  788982,
-  788981,
-  788980,
-  1285770,
-  1237721,
-  666350,
-  350272,
-  212893,
-  1670790,
-  512032,
-  940770,
-  1082840,
-  1654820,
-  1052820,
-  362360,
-  777120,
-  202961,
-  609880,
-  1281820,
-  1494335,
-  500850,
-  1203440,
-  1162340,
-  889870,
-  999421,
-  1057060,
-  1200260,
-  472490,
-  388476,
-  1035020,
-  807020,
-  1661140,
-  1107180,
-  1119960,
-  580620,
-  1674614,
-  1674610,
-  1674611,
-  1674612,
-  1674613,
-  1441711,
-  1460190,
-  1356500,
-  1080140,
-  998620,
-  1090166,
-  712640,
-  907070,
-  370810,
-  1526620,
-  1518151,
-  1098121,
-  1673240,
-  1673250,
-  1196070,
-  556460,
-  454110,
-  1355700,
-  1556450,
-  1662505,
-  1656320,
-  1662502,
-  1662501,
-  1662504,
-  636610,
-  1638754,
-  1638753,
-  1640870,
-  1676080,
-  894030,
-  783910,
-  1526720,
-  1667950,
-  1667960,
-  1667951,
-  1667918,
-  1667958,
-  1667957,
-  1667956,
-  1667916,
-  1667917,
-  1667919,
-  1667953,
-  1674790,
-  996740,
-  1667952,
-  1667955,
-  1667954,
-  1667913,
-  1667914,
-  1667915,
-  1667910,
-  1667911,
-  1667912,
-  1667876,
-  1667885,
-  1667897,
-  1667898,
-  1667900,
-  1667901,
-  1667902,
-  1667905,
-  1667906,
-  1667907,
-  1667909,
-  1667903,
-  1667904,
-  1667908,
-  1667899,
-  1667895,
-  1667896,
-  1667888,
-  1667889,
-  1667890,
-  1667891,
-  1667892,
-  1667893,
-  1667894,
-  1667882,
-  1667883,
-  1667884,
-  1667886,
-  1667887,
-  1667877,
-  1667878,
-  1667879,
-  1667880,
-  1667881,
-  1667872,
-  1667873,
-  1667874,
-  1667875,
-  1667867,
-  1667868,
-  1667869,
-  1667871,
-  1667858,
-  1667863,
-  1667864,
-  1667865,
-  1667866,
-  1667859,
-  1667860,
-  1667861,
-  1667862,
-  1667850,
-  1667851,
-  1667827,
-  1667829,
-  1667831,
-  1667833,
-  1667834,
-  1667836,
-  1667838,
-  1667826,
-  1667828,
-  1667855,
-  1667830,
-  1667835,
-  1667837,
-  1667839,
-  1667856,
-  1667857,
-  1667852,
-  1667853,
-  1667854,
-  1667832,
-  1667825,
-  1643988,
-  1643989,
-  1643985,
-  1643986,
-  1643987,
-  1643984,
-  1643982,
-  1643983,
-  1643959,
-  1643980,
-  1643956,
-  1643957,
-  1643954,
-  1643955,
-  1643952,
-  1643953,
-  1643949,
-  1643950,
-  1643951,
-  1643946,
-  1643947,
-  1643948,
-  1643945,
-  1643942,
-  1643943,
-  1643944,
-  1643941,
-  1643981,
-  1643928,
-  1643940,
-  1643925,
-  1643926,
-  1643927,
-  1643922,
-  1643923,
-  1643924,
-  1643918,
-  1643919,
-  1643921,
-  1643913,
-  1643914,
-  1643915,
-  1643916,
-  1643917,
-  1643910,
-  1643906,
-  1643907,
-  1643908,
-  1643909,
-  1643902,
-  1643903,
-  1643904,
-  1643905,
-  1643898,
-  1643899,
-  1643900,
-  1643901,
-  1643895,
-  1643896,
-  1643897,
-  1643892,
-  1643893,
-  1643894,
-  1643890,
-  1643891,
-  1643889,
-  1643887,
-  1643888,
-  1643885,
-  1643886,
-  1643912,
-  1650640,
-  1289211,
-  1257440,
-  536580,
-  1350660,
-  1256310,
-  1673280,
-  1648511,
-  1648521,
-  1483290,
-  571250,
-  1676630,
-  714960,
-  740591,
-  740592,
-  1588820,
-  1604220,
-  1203042,
-  602260,
-  376011,
-  884141,
-  1636880,
-  1665560,
-  1082350,
-  822350,
-  1317180,
-  224180,
-  47932,
-  458670,
-  410760,
-  1521860,
-  1572500,
-  1605990,
-  646666,
-  1478950,
-  1478951,
-  1478952,
-  1478953,
-  1480310,
-  1480311,
-  1480312,
-  1480313,
-  1344150,
-  1344151,
-  1344152,
-  1344153,
-  1198360,
-  1198361,
-  1198362,
-  1198363,
-  1198364,
-  1172551,
-  1172552,
-  1218720,
-  1199530,
-  1199531,
-  1199532,
-  1453290,
-  1381620,
-  1597360,
-  1547710,
-  1661530,
-  836630,
-  1172553,
-  1172550,
-  1108900,
-  1108910,
-  1108920,
-  836631,
-  836632,
-  1480314,
-  1480315,
-  1481190,
-  1481200,
-  990270,
-  1108580,
-  1108860,
-  1108870,
-  1667930,
-  1670842,
-  423851,
-  301892,
-  1015170,
-  1569283,
-  1569284,
-  1569280,
-  1569282,
-  1424201,
-  1021280,
-  858290,
-  861390,
-  761900,
-  822180,
-  1655360,
-  1336850,
-  1549150,
-  1592010,
-  1667370,
-  1670730,
-  1667570,
-  1674190,
-  1668100,
-  1649050,
-  1592250,
-  1105400,
-  632790,
-  619711,
-  1531480,
-  884730,
-  1598980,
-  1324000,
-  1433082,
-  1433081,
-  1433080,
-  1416830,
-  940740,
-  1019640,
-  778530,
-  780990,
-  587200,
-  304490,
-  1670841,
-  301897,
-  1666440,
-  1666450,
-  1432470,
-  793910,
-  616350,
-  508403,
-  1666420,
-  1665420,
-  1642760,
-  1665310,
-  1665440,
-  1665450,
-  1666390,
-  1666410,
-  1666360,
-  1313850,
-  929111,
-  896718,
-  35103,
-  1584790,
-  1059100,
-  1630610,
-  376958,
-  35081,
-  35082,
-  35084,
-  35085,
-  35088,
-  35092,
-  35099,
-  35100,
-  401850,
-  348880,
-  279602,
-  1122080,
-  1115140,
-  1173031,
-  1173050,
-  1554350,
-  742350,
-  1503230,
-  592700,
-  1427470,
-  1247700,
-  1434450,
-  225340,
-  48705,
-  273150,
-  1545310,
-  1442500,
-  1281571,
-  1075720,
-  72740,
-  215373,
-  987430,
-  1093730,
-  215370,
-  629370,
-  223593,
-  1630480,
-  1651913,
-  1651912,
-  1107420,
-  1424211,
-  1647970,
-  980720,
-  643681,
-  1162200,
-  820820,
-  820821,
-  829550,
-  999300,
-  999301,
-  999302,
-  1210000,
-  1312430,
-  1320670,
-  756730,
-  756731,
-  733700,
-  591880,
-  591890,
-  591900,
-  731210,
-  731010,
-  731030,
-  731090,
-  731110,
-  755180,
-  756720,
-  756721,
-  756722,
-  756723,
-  756724,
-  756725,
-  755190,
-  756726,
-  756727,
-  756728,
-  756729,
-  630780,
-  591070,
-  1159329,
-  981701,
-  735370,
-  480630,
-  1651910,
-  1651911,
-  456050,
-  376700,
-  1670910,
-  1147770,
-  1638752,
-  1598244,
-  1588961,
-  1577431,
-  1577430,
-  1559221,
-  1559220,
-  1598247,
-  1408390,
-  301115,
-  1600860,
-  1535730,
-  353590,
-  615540,
-  1666730,
-  1666731,
-  1517217,
-  1062570,
-  461249,
-  1143840,
-  823780,
-  962140,
-  929160,
-  399550,
-  399560,
-  399570,
-  800220,
-  800221,
-  800222,
-  1648510,
-  1130840,
-  455580,
-  1664270,
-  1610300,
-  1671050,
-  1162342,
-  1665360,
-  1665370,
-  1665380,
-  1665390,
-  1653900,
-  1638750,
-  1638751,
-  1248432,
-  1560938,
-  1664970,
-  1362180,
-  1362162,
-  71113,
-  359790,
-  747520,
-  266590,
-  1658190,
-  1176936,
-  1565520,
-  1176934,
-  1176926,
-  1175581,
-  1176923,
-  535820,
-  1176030,
-  1247620,
-  1176918,
-  1176925,
-  794000,
-  794010,
-  794020,
-  1664760,
-  1365290,
-  434069,
-  258740,
-  899130,
-  419471,
-  649280,
-  709831,
-  1551440,
-  820150,
-  1499390,
-  1315802,
-  590390,
-  826084,
-  826085,
-  826086,
-  710410,
-  474766,
-  326430,
-  326431,
-  305180,
-  305181,
-  305182,
-  305183,
-  305184,
-  305185,
-  312680,
-  312690,
-  312740,
-  1095780,
-  1095770,
-  1185440,
-  1242680,
-  1635540,
-  1351161,
-  1649150,
-  1662490,
-  1643911,
-  1643958,
-  1337860,
-  334810,
-  1663420,
-  1456541,
-  1665840,
-  870380,
-  1288850,
-  1621650,
-  1612710,
-  1621630,
-  1366500,
-  1612720,
-  1612700,
-  1621631,
-  1621660,
-  1621651,
-  1612680,
-  1621661,
-  299270,
-  649480,
-  649481,
-  649483,
-  649484,
-  649485,
-  649486,
-  1602070,
-  24110,
-  418350,
-  224560,
-  216630,
-  216631,
-  216632,
-  216633,
-  334150,
-  843340,
-  636240,
-  334161,
-  1424213,
-  333910,
-  1424214,
-  1424215,
-  1424216,
-  435550,
-  333920,
-  333921,
-  994420,
-  565621,
-  211321,
-  211322,
-  842362,
-  842363,
-  842364,
-  24190,
-  817790,
-  842366,
-  220800,
-  842368,
-  842370,
-  874891,
-  229771,
-  255890,
-  249750,
-  315800,
-  1565600,
-  1565601,
-  1565602,
-  24230,
-  298671,
-  213170,
-  347570,
-  213171,
-  213172,
-  213173,
-  213174,
-  215990,
-  213175,
-  215991,
-  215992,
-  213177,
-  215993,
-  213178,
-  215994,
-  213179,
-  215995,
-  215996,
-  215998,
-  213190,
-  213191,
-  526280,
-  213192,
-  213193,
-  639433,
-  639435,
-  213196,
-  639436,
-  639438,
-  1544400,
-  452050,
-  820440,
-  820442,
-  331740,
-  361183,
-  102625,
-  1565410,
-  1565411,
-  1565412,
-  1565413,
-  1565414,
-  1565415,
-  1565416,
-  304120,
-  304121,
-  301820,
-  842367,
-  639432,
-  262140,
-  1526072,
-  1295340,
-  420390,
-  645400,
-  720900,
-  757020,
-  978730,
-  1443150,
-  1182050,
-  1280110,
-  1050480,
-  1367930,
-  637380,
-  546520,
-  1440600,
-  334160,
-  332890,
-  334440,
-  334441,
-  334442,
-  334450,
-  332420,
-  332430,
-  310580,
-  227440,
-  249760,
-  249770,
-  258804,
-  218240,
-  218242,
-  334430,
-  24100,
-  1598850,
-  1585871,
-  213176,
-  1146540,
-  900820,
-  837360,
-  639431,
-  494390,
-  557020,
-  494391,
-  361181,
-  361182,
-  275020,
-  298670,
-  298672,
-  1650100,
-  681701,
-  1515065,
-  1664210,
-  1661590,
-  1660810,
-  732860,
-  1534680,
-  1439520,
-  260470,
-  1615501,
-  498520,
-  1660760,
-  258655,
-  1639820,
-  1640750,
-  1579830,
-  1150032,
-  1150033,
-  726190,
-  544832,
-  204381,
-  204383,
-  203702,
-  686710,
-  1560280,
-  1056090,
-  1052830,
-  204387,
-  259110,
-  715194,
-  233870,
-  1665630,
-  1176121,
-  1485400,
-  909350,
-  704282,
-  754360,
-  1622290,
-  1659350,
-  1661520,
-  1661540,
-  1662610,
-  1662640,
-  1656910,
-  892870,
-  642280,
-  1535390,
-  447740,
-  1541180,
-  1465750,
-  471650,
-  908470,
-  264803,
-  1653720,
-  1664460,
-  347210,
-  1595430,
-  1269840,
-  1344680,
-  1658860,
-  1534100,
-  1255080,
-  1356690,
-  208367,
-  1535540,
-  1539200,
-  1183640,
-  428310,
-  428312,
-  428311,
-  1315443,
-  995960,
-  450960,
-  1659570,
-  1643080,
-  503470,
-  461900,
-  1272090,
-  799140,
-  34287,
-  1396920,
-  1640440,
-  1649600,
-  1592770,
-  1466120,
-  921540,
-  801980,
-  1491330,
-  1662890,
-  1079350,
-  513520,
-  495370,
-  207375,
-  1056530,
-  566040,
-  1056540,
-  1189670,
-  1189671,
-  622120,
-  625200,
-  1060660,
-  597050,
-  377920,
-  377930,
-  596830,
-  1169530,
-  1126530,
-  1126540,
-  1627790,
-  621460,
-  621461,
-  1627800,
-  1091490,
-  1161380,
-  1161390,
-  1077700,
-  1056220,
-  489960,
-  612630,
-  612631,
-  592960,
-  630970,
-  637370,
-  591810,
-  591811,
-  591812,
-  591813,
-  1228400,
-  1199500,
-  1435620,
-  753520,
-  1575763,
-  1647540,
-  1575761,
-  1575760,
-  1609280,
-  1593124,
-  1593123,
-  1593122,
-  1642120,
-  1135430,
-  215970,
-  1620950,
-  1620951,
-  887050,
-  1563620,
-  1610800,
-  930870,
-  1004910,
-  1654380,
-  1654381,
-  405920,
-  1648401,
-  1648402,
-  1648411,
-  1648412,
-  1294131,
-  1294141,
-  1294143,
-  1199600,
-  1199601,
-  1199602,
-  1060650,
-  1091480,
-  1077710,
-  1056100,
-  1056210,
-  703560,
-  945830,
-  1028890,
-  1028894,
-  939051,
-  995654,
-  945831,
-  939050,
-  228601,
-  1392090,
-  1392091,
-  1648110,
-  1501246,
-  1607210,
-  1651820,
-  1655040,
-  1603121,
-  1212080,
-  466550,
-  1658430,
-  1635171,
-  1635170,
-  423366,
-  423367,
-  423365,
-  423368,
-  496430,
-  496438,
-  496437,
-  730615,
-  591981,
-  422473,
-  591970,
-  591985,
-  730613,
-  496436,
-  1000719,
-  1200344,
-  1000715,
-  591980,
-  1000712,
-  1663340,
-  591982,
-  1200347,
-  1200340,
-  591987,
-  591984,
-  730619,
-  730617,
-  1000713,
-  496439,
-  421760,
-  730612,
-  730611,
-  591971,
-  496435,
-  1000711,
-  1200343,
-  1000710,
-  496434,
-  1000716,
-  1655471,
-  1648780,
-  626790,
-  549840,
-  790831,
-  1453690,
-  642806,
-  1573260,
-  512340,
-  1039230,
-  1337580,
-  927700,
-  818200,
-  307650,
-  330260,
-  94304,
-  1536920,
-  1118170,
-  1078020,
-  670870,
-  893630,
-  744920,
-  1624290,
-  1536540,
-  1536560,
-  1536550,
-  1089910,
-  1182290,
-  1612320,
-  1637860,
-  899360,
-  739282,
-  214988,
-  214991,
-  214987,
-  538930,
-  957124,
-  1240020,
-  1212890,
-  1134160,
-  1383800,
-  1332687,
-  1256740,
-  1142610,
-  1142590,
-  1118140,
-  1118150,
-  1118160,
-  1118180,
-  1114310,
-  1114320,
-  1114330,
-  1082790,
-  1082800,
-  1074100,
-  1082810,
-  1074110,
-  1082820,
-  1082830,
-  1055250,
-  1053980,
-  1055260,
-  1054000,
-  1054010,
-  1074090,
-  523010,
-  645401,
-  512031,
-  512033,
-  521770,
-  1644550,
-  1644520,
-  1644530,
-  1604850,
-  234784,
-  24012,
-  208351,
-  1316273,
-  338250,
-  390180,
-  382410,
-  987110,
-  1643865,
-  1643866,
-  1643867,
-  1643868,
-  1643869,
-  1035000,
-  1417260,
-  234776,
-  1049430,
-  649490,
-  1657850,
-  465600,
-  313102,
-  1644420,
-  376971,
-  455810,
-  1230460,
-  1144710,
-  420650,
-  1276160,
-  1447530,
-  208365,
-  1447500,
-  1447510,
-  1447520,
-  1655470,
-  1120460,
-  1147382,
-  1643872,
-  1643874,
-  1643875,
-  1643877,
-  1643878,
-  1643880,
-  1643882,
-  1643881,
-  1643883,
-  1643884,
-  1643879,
-  1643876,
-  1643870,
-  1643871,
-  1643873,
-  1451620,
-  1323110,
-  1216360,
-  1077370,
-  1077371,
-  1077372,
-  1077373,
-  1232530,
-  1096680,
-  286636,
-  343610,
-  782110,
-  741440,
-  222282,
-  1639240,
-  1600010,
-  1628281,
-  1471310,
-  47893,
-  1628280,
-  1647790,
-  450811,
-  1264780,
-  1262742,
-  1344050,
-  376980,
-  873780,
-  458400,
-  1007510,
-  1091060,
-  776850,
-  1642710,
-  1656720,
-  1636790,
-  1651630,
-  1651631,
-  1651640,
-  1651650,
-  1651660,
-  1651670,
-  953980,
-  1112820,
-  816140,
-  540710,
-  214332,
-  249170,
-  807510,
-  378640,
-  1489240,
-  1000170,
-  330950,
-  1598245,
-  1598246,
-  316967,
-  349000,
-  1560934,
-  240480,
-  1359050,
-  1618990,
-  1245970,
-  1206190,
-  932760,
-  1351160,
-  980570,
-  1415440,
-  739160,
-  803450,
-  1651120,
-  1422720,
-  321580,
-  213312,
-  1082250,
-  1389493,
-  376975,
-  1128080,
-  556210,
-  379551,
-  1596631,
-  1596630,
-  1196651,
-  220280,
-  1651830,
-  1633190,
-  1385931,
-  1385933,
-  1385934,
-  1385935,
-  1640620,
-  1639980,
-  1075820,
-  1645850,
-  1469740,
-  1639800,
-  1639810,
-  1472300,
-  1472310,
-  1472240,
-  456220,
-  1483210,
-  1419120,
-  1419121,
-  1419122,
-  1543600,
-  888360,
-  744834,
-  1143660,
-  1389492,
-  1159723,
-  1159720,
-  1159721,
-  1140082,
-  984711,
-  1140080,
-  1140081,
-  316962,
-  460070,
-  1241000,
-  1126940,
-  1132330,
-  1156560,
-  306240,
-  908471,
-  1604860,
-  1618410,
-  1635390,
-  1454750,
-  1629640,
-  456470,
-  367480,
-  325950,
-  1476200,
-  795470,
-  247297,
-  208296,
-  1600540,
-  1600541,
-  1366091,
-  910940,
-  208301,
-  1602230,
-  495380,
-  735270,
-  706970,
-  1651180,
-  1640010,
-  779896,
-  1132060,
-  953940,
-  1650780,
-  8990,
-  1176158,
-  1176186,
-  500272,
-  687251,
-  318872,
-  318874,
-  318875,
-  318870,
-  1641360,
-  770977,
-  893770,
-  34282,
-  1230273,
-  1105542,
-  967280,
-  260309,
-  893882,
-  893881,
-  893880,
-  1029090,
-  1535250,
-  1535251,
-  1535260,
-  1535261,
-  1535262,
-  1535263,
-  1535264,
-  1535265,
-  1535266,
-  1535580,
-  1535400,
-  281100,
-  281102,
-  281103,
-  1004820,
-  277721,
-  1005040,
-  277720,
-  593055,
-  646671,
-  72773,
-  578030,
-  597074,
-  597075,
-  558391,
-  222554,
-  1644410,
-  549071,
-  1600770,
-  525037,
-  216174,
-  1340612,
-  1247614,
-  1340617,
-  1340616,
-  1340615,
-  1340614,
-  1340613,
-  1340611,
-  1247613,
-  1340610,
-  1247612,
-  1494334,
-  1644730,
-  1538230,
-  1351271,
-  359860,
-  991062,
-  208356,
-  1526280,
-  313420,
-  334330,
-  1650630,
-  297831,
-  1057263,
-  781510,
-  781541,
-  409252,
-  623350,
-  1241870,
-  980544,
-  1531392,
-  1531393,
-  1531391,
-  1644860,
-  1644870,
-  1644880,
-  1644881,
-  1644890,
-  1644900,
-  1522600,
-  264802,
-  264805,
-  1384810,
-  1650940,
-  1643250,
-  258541,
-  1494352,
-  1577000,
-  376970,
-  1494333,
-  1494332,
-  1494331,
-  1494330,
-  1598242,
-  1598243,
-  260950,
-  260472,
-  1636342,
-  1636345,
-  1636346,
-  1124100,
-  1112590,
-  1561840,
-  1112591,
-  1057320,
-  1098030,
-  963120,
-  963130,
-  961600,
-  203343,
-  1624261,
-  1624262,
-  1624260,
-  1044160,
-  1633910,
-  65246,
-  1365270,
-  1596667,
-  1596665,
-  1596664,
-  1596663,
-  1596662,
-  1596661,
-  1596660,
-  1596655,
-  1596654,
-  1596653,
-  1596652,
-  1596651,
-  1596650,
-  1530273,
-  1530272,
-  1530271,
-  1530270,
-  401058,
-  1621330,
-  1621340,
-  1566854,
-  1566855,
-  1566856,
-  839760,
-  1594640,
-  1587400,
-  228740,
-  896747,
-  1650420,
-  1073630,
-  1475510,
-  512100,
-  208354,
-  255580,
-  260478,
-  264812,
-  260476,
-  260477,
-  1465734,
-  1424100,
-  1424101,
-  1424102,
-  1424110,
-  1480670,
-  1619854,
-  1619853,
-  1619852,
-  1619851,
-  1619850,
-  1623360,
-  260304,
-  497340,
-  551810,
-  1637310,
-  1003430,
-  1600512,
-  1600511,
-  1600510,
-  1593850,
-  1593840,
-  1593830,
-  573240,
-  528322,
-  528323,
-  528324,
-  1626670,
-  1047940,
-  1117450,
-  1331010,
-  1331011,
-  1331020,
-  1331021,
-  1136310,
-  1136311,
-  1136312,
-  1136313,
-  1120461,
-  1605840,
-  1605870,
-  1605871,
-  1605872,
-  1605873,
-  1147380,
-  1147381,
-  1147383,
-  1639840,
-  1564390,
-  1648120,
-  793610,
-  438800,
-  208151,
-  208152,
-  208153,
-  208154,
-  208155,
-  208156,
-  208157,
-  208158,
-  208159,
-  224325,
-  1626971,
-  1626973,
-  462971,
-  462973,
-  609950,
-  1388200,
-  1114800,
-  1316024,
-  1316027,
-  1648063,
-  465350,
-  1315808,
-  1539561,
-  1539562,
-  1512140,
-  1412790,
-  1081270,
-  1521380,
-  1521381,
-  1521382,
-  1521383,
-  696680,
-  1102610,
-  1102630,
-  1102640,
-  1011520,
-  1011521,
-  1011522,
-  1011523,
-  1011524,
-  1102590,
-  942352,
-  942353,
-  942355,
-  942356,
-  1626970,
-  1626972,
-  1588030,
-  1618700,
-  1619650,
-  1434190,
-  1436320,
-  1572870,
-  369410,
-  1632840,
-  382464,
-  975380,
-  1379780,
-  1639841,
-  1418900,
-  991773,
-  578240,
-  65735,
-  65734,
-  639600,
-  1560440,
-  1556730,
-  496103,
-  945690,
-  1330240,
-  858930,
-  899140,
-  942590,
-  1600410,
-  676160,
-  855660,
-  874150,
-  874151,
-  874152,
-  874153,
-  874160,
-  860120,
-  620470,
-  489250,
-  489300,
-  489320,
-  1175222,
-  462972,
-  460840,
-  1460240,
-  1563290,
-  1193870,
-  268080,
-  376960,
-  815380,
-  1632380,
-  896742,
-  1251940,
-  1501130,
-  460830,
-  474930,
-  462970,
-  677540,
-  677550,
-  476350,
-  476351,
-  476352,
-  476353,
-  476354,
-  476355,
-  476356,
-  476357,
-  673020,
-  441610,
-  440500,
-  1642850,
-  303730,
-  677530,
-  28012,
-  215000,
-  1113700,
-  1538250,
-  1120730,
-  1033477,
-  1335450,
-  258812,
-  1121810,
-  969470,
-  547502,
-  457201,
-  1644760,
-  35429,
-  821970,
-  1581570,
-  1642740,
-  1552100,
-  292982,
-  708171,
-  369490,
-  1641140,
-  205630,
-  353140,
-  513430,
-  1615260,
-  1149990,
-  1167910,
-  835730,
-  1504300,
-  1641490,
-  1605790,
-  237618,
-  1638790,
-  1638800,
-  1638810,
-  1638811,
-  1638820,
-  1638830,
-  1638840,
-  730750,
-  282280,
-  217300,
-  746700,
-  739253,
-  435880,
-  1546560,
-  1585000,
-  820560,
-  1591920,
-  1642910,
-  297651,
-  297652,
-  1598241,
-  1598240,
-  871650,
-  539420,
-  763330,
-  539430,
-  1054280,
-  241430,
-  527500,
-  268081,
-  268082,
-  297800,
-  297650,
-  1408290,
-  577352,
-  219101,
-  1639540,
-  998970,
-  1585610,
-  672170,
-  546310,
-  1028895,
-  961930,
-  1611730,
-  1410760,
-  1634400,
-  1610881,
-  65216,
-  1588960,
-  1588962,
-  1588963,
-  1551390,
-  1551391,
-  1529890,
-  1529891,
-  1494600,
-  1494601,
-  1494602,
-  1494603,
-  1494604,
-  1494605,
-  1494606,
-  1494607,
-  1494608,
-  1494609,
-  1494610,
-  1494611,
-  1432173,
-  1460362,
-  1460363,
-  1460364,
-  1460365,
-  1460366,
-  1460367,
-  1460368,
-  1460369,
-  1535650,
-  1535651,
-  1535652,
-  1559222,
-  1559223,
-  1427670,
-  1427671,
-  1577432,
-  1427672,
-  1577433,
-  1536760,
-  1536761,
-  1536762,
-  1536763,
-  1536764,
-  1622020,
-  1622021,
-  1601290,
-  1582820,
-  1362601,
-  1362602,
-  1354790,
-  1362600,
-  1173750,
-  1173751,
-  1141811,
-  1153620,
-  1153630,
-  1105010,
-  1090860,
-  1066300,
-  1088120,
-  978950,
-  1070470,
-  1135433,
-  1612600,
-  1354110,
-  1635910,
-  1206460,
-  795720,
-  1073160,
-  1175990,
-  24073,
-  609310,
-  354702,
-  609956,
-  602584,
-  1316073,
-  1290340,
-  1524890,
-  542490,
-  1634200,
-  1634201,
-  1634202,
-  1261620,
-  1617690,
-  1609620,
-  260860,
-  45773,
-  45774,
-  1163280,
-  1434170,
-  1434180,
-  1142630,
-  1177200,
-  1142650,
-  1209210,
-  1209220,
-  1436300,
-  1209230,
-  1436310,
-  1209240,
-  1209250,
-  1209260,
-  1163200,
-  1163210,
-  1163220,
-  1163240,
-  1163250,
-  1440250,
-  1055270,
-  1592040,
-  621921,
-  215259,
-  55394,
-  1596830,
-  541260,
-  984090,
-  408730,
-  668714,
-  1347650,
-  1365260,
-  452770,
-  648400,
-  1172270,
-  810310,
-  759490,
-  823000,
-  833240,
-  1406190,
-  493590,
-  1492700,
-  1483510,
-  45776,
-  959812,
-  1111013,
-  1111015,
-  1111011,
-  1111014,
-  1111012,
-  1111010,
-  1111016,
-  1243770,
-  828300,
-  1129050,
-  1054020,
-  1183620,
-  1543350,
-  920567,
-  630850,
-  998961,
-  322021,
-  610520,
-  1163360,
-  458860,
-  40135,
-  1093400,
-  1634760,
-  292711,
-  875950,
-  200185,
-  1123270,
-  1068400,
-  223592,
-  769140,
-  638460,
-  529620,
-  502970,
-  1617949,
-  1536050,
-  1617855,
-  1617858,
-  1617940,
-  1620760,
-  1620761,
-  1620762,
-  1580070,
-  1580080,
-  1617850,
-  1617851,
-  1617852,
-  1617853,
-  1617854,
-  1617856,
-  1617859,
-  1617860,
-  1617861,
-  1617862,
-  1617863,
-  1617864,
-  1617942,
-  1617943,
-  1617944,
-  1617945,
-  1617946,
-  1617947,
-  1617948,
-  1617941,
-  235130,
-  235150,
-  258500,
-  258501,
-  223261,
-  223262,
-  1617857,
-  1591620,
-  1621300,
-  1370010,
-  1521420,
-  1022120,
-  1592512,
-  1592511,
-  1629090,
-  1630220,
-  1630240,
-  1630260,
-  1630230,
-  1621150,
-  1621151,
-  1143850,
-  1612070,
-  1622750,
-  1555170,
-  1560933,
-  1582830,
-  376966,
-  1206800,
-  1633870,
-  1609610,
-  1610510,
-  774754,
-  267655,
-  1154280,
-  1219750,
-  1567390,
-  562382,
-  1176189,
-  237621,
-  1034450,
-  955180,
-  1632520,
-  1632540,
-  1632541,
-  1632550,
-  1632560,
-  1632570,
-  1624400,
-  952080,
-  815760,
-  361470,
-  1581230,
-  279131,
-  279130,
-  1046550,
-  1560190,
-  1560191,
-  1560192,
-  1560193,
-  1386616,
-  820860,
-  820870,
-  1178940,
-  1146960,
-  540720,
-  500245,
-  24963,
-  1232255,
-  640410,
-  1614171,
-  1614172,
-  1614170,
-  1614173,
-  889820,
-  1088310,
-  679310,
-  1501245,
-  1324140,
-  564680,
-  707670,
-  343460,
-  1581130,
-  698240,
-  65217,
-  918800,
-  918810,
-  914830,
-  914831,
-  349310,
-  814060,
-  340260,
-  739581,
-  1585870,
-  990731,
-  268614,
-  344551,
-  1329590,
-  301894,
-  301896,
-  316060,
-  969730,
-  1552480,
-  1103720,
-  688040,
-  98008,
-  1315806,
-  1561580,
-  1574230,
-  1617520,
-  1574640,
-  1574641,
-  1353600,
-  1539340,
-  1615270,
-  1627300,
-  1433180,
-  1471810,
-  1630790,
-  994821,
-  501510,
-  969140,
-  1037050,
-  896640,
-  819320,
-  530690,
-  579930,
-  430094,
-  489750,
-  1123980,
-  1612410,
-  1558300,
-  1522880,
-  1485060,
-  1447360,
-  1289760,
-  1205501,
-  1205500,
-  223598,
-  1167510,
-  981700,
-  974740,
-  962960,
-  840770,
-  840760,
-  840750,
-  798740,
-  987340,
-  981702,
-  1633250,
-  1633251,
-  834020,
-  1617380,
-  626470,
-  838020,
-  918760,
-  738810,
-  636880,
-  215772,
-  90207,
-  90208,
-  90209,
-  90210,
-  979340,
-  1180750,
-  945790,
-  460552,
-  201804,
-  102623,
-  512621,
-  729450,
-  710350,
-  206193,
-  206195,
-  1106220,
-  404240,
-  437140,
-  630010,
-  1285300,
-  1243400,
-  571820,
-  879190,
-  515710,
-  41074,
-  66000,
-  948970,
-  1218690,
-  1473590,
-  1630620,
-  1066250,
-  1066190,
-  582150,
-  510120,
-  506100,
-  373951,
-  616960,
-  268101,
-  405430,
-  1617550,
-  1617503,
-  941360,
-  1147480,
-  485280,
-  1506120,
-  761250,
-  1251570,
-  222574,
-  1010220,
-  891550,
-  940340,
-  1347751,
-  1354051,
-  345680,
-  742710,
-  1474240,
-  1608020,
-  1557620,
-  1557621,
-  1383804,
-  208373,
-  500620,
-  437800,
-  1010130,
-  404011,
-  960720,
-  995590,
-  1033790,
-  965350,
-  267770,
-  952490,
-  691440,
-  1139990,
-  990730,
-  1172890,
-  1029331,
-  707490,
-  658900,
-  980810,
-  1114750,
-  591494,
-  1550290,
-  1624410,
-  1617502,
-  1617540,
-  1622150,
-  1622240,
-  1619710,
-  1599800,
-  1352110,
-  1370810,
-  1391810,
-  1351920,
-  1359610,
-  1383420,
-  820590,
-  570960,
-  1531100,
-  287760,
-  1231450,
-  1115490,
-  932380,
-  1058260,
-  740590,
-  1365250,
-  1472520,
-  1472530,
-  1196788,
-  662250,
-  1463340,
-  1449390,
-  212041,
-  222603,
-  1627650,
-  378731,
-  1628220,
-  1618620,
-  1618640,
-  1588980,
-  1541140,
-  1559440,
-  1540040,
-  484970,
-  304140,
-  286635,
-  1176187,
-  282550,
-  541400,
-  50110,
-  382462,
-  1583050,
-  1241270,
-  1162202,
-  1014290,
-  369670,
-  492810,
-  734230,
-  754210,
-  240420,
-  1315878,
-  385320,
-  405033,
-  272950,
-  272960,
-  272970,
-  268620,
-  803410,
-  765280,
-  727650,
-  224611,
-  224612,
-  224613,
-  224614,
-  224615,
-  224616,
-  356473,
-  1598330,
-  333181,
-  851600,
-  851601,
-  35485,
-  249540,
-  304080,
-  304081,
-  304082,
-  560100,
-  560101,
-  560102,
-  369650,
-  369660,
-  475230,
-  1517420,
-  1180010,
-  573960,
-  266740,
-  925826,
-  1208730,
-  1130220,
-  1571250,
-  1538530,
-  1046801,
-  1087010,
-  1102530,
-  535780,
-  443550,
-  1528250,
-  1626310,
-  1524830,
-  1618680,
-  355960,
-  1206761,
-  1206760,
-  865351,
-  1339390,
-  1623050,
-  1623051,
-  1558880,
-  1558881,
-  1558882,
-  1558883,
-  1558884,
-  438810,
-  867860,
-  1623030,
-  1623031,
-  994840,
-  491410,
-  455670,
-  537770,
-  870277,
-  1559361,
-  1575080,
-  1575081,
-  1016872,
-  772630,
-  356960,
-  1199890,
-  917090,
-  823660,
-  819360,
-  750150,
-  750151,
-  749170,
-  730040,
-  1462050,
-  1619951,
-  1619950,
-  731750,
-  646665,
-  1493510,
-  1493500,
-  394321,
-  631580,
-  703160,
-  1329556,
-  1329557,
-  1329558,
-  903750,
-  903770,
-  903771,
-  903772,
-  904390,
-  1133850,
-  1158200,
-  1084100,
-  1542571,
-  298810,
-  1023770,
-  541830,
-  1529920,
-  1270240,
-  1167230,
-  1167231,
-  1167232,
-  1167233,
-  414180,
-  698440,
-  677360,
-  463780,
-  1371870,
-  1107260,
-  414100,
-  423850,
-  703770,
-  694200,
-  1232253,
-  772150,
-  521160,
-  1048360,
-  914060,
-  646480,
-  646320,
-  736450,
-  574280,
-  524990,
-  412000,
-  235140,
-  258502,
-  768620,
-  712130,
-  1443093,
-  1095960,
-  944070,
-  379563,
-  348680,
-  294990,
-  335640,
-  1110130,
-  1110131,
-  1196290,
-  1120860,
-  793091,
-  793090,
-  1456460,
-  909851,
-  861300,
-  899350,
-  429810,
-  1088484,
-  1241010,
-  1165300,
-  838170,
-  828630,
-  828631,
-  828632,
-  746730,
-  589610,
-  590160,
-  590161,
-  590162,
-  593500,
-  593501,
-  593502,
-  593503,
-  1558691,
-  245220,
-  716840,
-  1623280,
-  1288681,
-  1288682,
-  1288683,
-  1288684,
-  1288685,
-  1206762,
-  412980,
-  257310,
-  1339391,
-  476041,
-  1603120,
-  500290,
-  1557590,
-  1608150,
-  1075210,
-  1618060,
-  1617530,
-  1617501,
-  1618040,
-  706260,
-  1209800,
-  1209801,
-  463490,
-  891840,
-  1059360,
-  905520,
-  919140,
-  894950,
-  1571740,
-  1619730,
-  1619740,
-  1618100,
-  1618110,
-  1618120,
-  1617500,
-  978060,
-  726370,
-  348070,
-  205083,
-  218065,
-  205063,
-  205073,
-  202951,
-  1610580,
-  246050,
-  847423,
-  224610,
-  1472865,
-  1472864,
-  1472863,
-  1472866,
-  1472867,
-  1472868,
-  1472869,
-  1472870,
-  1472871,
-  1472872,
-  1472873,
-  1472874,
-  1472875,
-  1472876,
-  1472877,
-  1472879,
-  1472890,
-  1472891,
-  1472895,
-  1472896,
-  303331,
-  360090,
-  382510,
-  385650,
-  385660,
-  334510,
-  334520,
-  336860,
-  336870,
-  331240,
-  331260,
-  1195300,
-  330340,
-  1605820,
-  1619800,
-  1560931,
-  630890,
-  650360,
-  206522,
-  694210,
-  1565920,
-  1565921,
-  1565922,
-  1094282,
-  1354560,
-  762970,
-  1607211,
-  1472510,
-  209201,
-  1407580,
-  1407590,
-  1407600,
-  1407610,
-  1501241,
-  1352980,
-  345150,
-  1088480,
-  1154870,
-  316560,
-  1130800,
-  754922,
-  717030,
-  705720,
-  1581710,
-  434068,
-  1478751,
-  1415510,
-  1431701,
-  1431702,
-  1431710,
-  1442280,
-  1442281,
-  1399790,
-  1399791,
-  1204070,
-  1269880,
-  1268120,
-  1244880,
-  1092691,
-  1092693,
-  1092694,
-  1092695,
-  1122140,
-  1158800,
-  1049650,
-  1092690,
-  797150,
-  587910,
-  1054480,
-  226665,
-  1607050,
-  1610801,
-  979780,
-  957010,
-  1474380,
-  1467010,
-  1473720,
-  1333510,
-  1418860,
-  1377690,
-  1273630,
-  1259110,
-  1210090,
-  1210091,
-  1093410,
-  1159530,
-  1130690,
-  1194440,
-  1012010,
-  1029680,
-  1024610,
-  999070,
-  1029820,
-  1083100,
-  935430,
-  970630,
-  967350,
-  953800,
-  929520,
-  991730,
-  859430,
-  859500,
-  907420,
-  907421,
-  876970,
-  876971,
-  830650,
-  814100,
-  771110,
-  794170,
-  765830,
-  753120,
-  717340,
-  731080,
-  746731,
-  370430,
-  1196040,
-  1566852,
-  1566853,
-  1239110,
-  1189480,
-  1169670,
-  1008730,
-  974880,
-  738050,
-  762090,
-  829430,
-  499500,
-  422120,
-  465680,
-  1590530,
-  1561365,
-  1561364,
-  1561361,
-  915170,
-  822300,
-  821280,
-  506720,
-  326510,
-  315906,
-  317452,
-  317453,
-  1352720,
-  1352721,
-  1146130,
-  1146131,
-  1146132,
-  1297700,
-  1071690,
-  1268820,
-  1268821,
-  1123420,
-  1123430,
-  1123431,
-  1123433,
-  1123434,
-  1383790,
-  1383791,
-  1383792,
-  1123440,
-  1123441,
-  1123470,
-  1123471,
-  1123472,
-  1459600,
-  1386390,
-  1123480,
-  1241240,
-  1123481,
-  1123482,
-  1247900,
-  1247901,
-  1071780,
-  1202600,
-  1202601,
-  1202603,
-  412332,
-  1202604,
-  969900,
-  1565100,
-  1202605,
-  1326770,
-  1414130,
-  1414131,
-  400890,
-  400892,
-  710490,
-  1606840,
-  1606810,
-  1375470,
-  1375471,
-  1208250,
-  1192680,
-  1165070,
-  1118230,
-  1092490,
-  1061440,
-  1061441,
-  1061442,
-  1061443,
-  1055630,
-  1062030,
-  1028240,
-  1028260,
-  932200,
-  928920,
-  827720,
-  834430,
-  828830,
-  825640,
-  827690,
-  825650,
-  827700,
-  825660,
-  827710,
-  825670,
-  825680,
-  825690,
-  825700,
-  825710,
-  783370,
-  767650,
-  753460,
-  753470,
-  753480,
-  729690,
-  753500,
-  753510,
-  721880,
-  602390,
-  638790,
-  516100,
-  549650,
-  502830,
-  454960,
-  502610,
-  508830,
-  370230,
-  372170,
-  367310,
-  332240,
-  241280,
-  1612210,
-  1618600,
-  1618660,
-  245176,
-  370371,
-  1565270,
-  1515060,
-  1098820,
-  1020380,
-  1020350,
-  1020370,
-  905250,
-  823930,
-  217961,
-  217962,
-  1339430,
-  1339431,
-  1339432,
-  1344620,
-  1345070,
-  1512430,
-  1460880,
-  1452430,
-  938590,
-  391080,
-  316869,
-  1198960,
-  500890,
-  1385850,
-  202181,
-  1525820,
-  1525840,
-  1365240,
-  1438050,
-  1592570,
-  344462,
-  1502440,
-  451160,
-  1617730,
-  744871,
-  1537550,
-  1230480,
-  1230482,
-  1230483,
-  1190011,
-  1190012,
-  1190013,
-  249910,
-  1058180,
-  568970,
-  1101750,
-  70617,
-  455750,
-  1073650,
-  490650,
-  1614800,
-  1553100,
-  1553101,
-  947660,
-  277737,
-  1345800,
-  451690,
-  40940,
-  1610970,
-  1336480,
-  1336483,
-  1215110,
-  381840,
-  573940,
-  980542,
-  556222,
-  321430,
-  737860,
-  736330,
-  743520,
-  1590830,
-  1588430,
-  1510640,
-  1507300,
-  1515690,
-  1609210,
-  605560,
-  466543,
-  318792,
-  318794,
-  1211172,
-  229753,
-  1111950,
-  1607320,
-  1607321,
-  1000120,
-  249180,
-  558243,
-  1168500,
-  24095,
-  1442550,
-  1176924,
-  1592070,
-  1610010,
-  1590300,
-  1610030,
-  1596210,
-  1605750,
-  1609960,
-  1578580,
-  1576800,
-  1582220,
-  1579410,
-  1578670,
-  1586140,
-  1575930,
-  1586170,
-  1533290,
-  1540280,
-  1540290,
-  1465420,
-  1393060,
-  1396680,
-  1468660,
-  869900,
-  842331,
-  376945,
-  317480,
-  474765,
-  1177210,
-  1551950,
-  1052274,
-  1052270,
-  1052272,
-  1052275,
-  836320,
-  836321,
-  835750,
-  1052271,
-  1184410,
-  836843,
-  836845,
-  836844,
-  836846,
-  836841,
-  836842,
-  836840,
-  1048430,
-  933524,
-  1577781,
-  787681,
-  787682,
-  787680,
-  1610080,
-  1610090,
-  1610091,
-  1610100,
-  1599790,
-  1598520,
-  1598530,
-  1603560,
-  1596910,
-  678080,
-  406071,
-  364340,
-  1386930,
-  1377650,
-  1599040,
-  1598340,
-  277758,
-  333440,
-  1109202,
-  697290,
-  1536700,
-  1589850,
-  1589851,
-  1589853,
-  1589852,
-  944290,
-  447682,
-  447683,
-  447684,
-  447685,
-  447686,
-  568940,
-  1359040,
-  1003200,
-  525520,
-  267789,
-  258816,
-  352510,
-  352511,
-  1597540,
-  1272383,
-  1272384,
-  1272385,
-  1196850,
-  1272380,
-  1272381,
-  1272382,
-  909850,
-  215301,
-  215303,
-  215309,
-  215310,
-  215311,
-  215314,
-  215317,
-  369150,
-  420610,
-  547501,
-  715191,
-  235920,
-  714740,
-  1611670,
-  947680,
-  1123432,
-  1123473,
-  945720,
-  1374734,
-  832580,
-  1033040,
-  392900,
-  1605972,
-  1605970,
-  1605971,
-  1609150,
-  1609140,
-  204112,
-  389240,
-  1190050,
-  1190051,
-  203187,
-  1109430,
-  328400,
-  636900,
-  392170,
-  392171,
-  1418260,
-  1051480,
-  1396420,
-  885450,
-  723800,
-  809350,
-  885430,
-  354468,
-  696750,
-  969890,
-  1552450,
-  633310,
-  271030,
-  1075410,
-  1186130,
-  1127340,
-  596960,
-  1609260,
-  1075102,
-  1400310,
-  1567730,
-  1610050,
-  573547,
-  1052860,
-  1062300,
-  573290,
-  509520,
-  204106,
-  204107,
-  204108,
-  204109,
-  204110,
-  204111,
-  1564910,
-  1237200,
-  362003,
-  413180,
-  1158111,
-  1158110,
-  1129530,
-  795650,
-  223595,
-  1584250,
-  754770,
-  565040,
-  208286,
-  1315510,
-  453330,
-  1220420,
-  1237450,
-  806420,
-  756060,
-  754550,
-  311380,
-  456280,
-  555420,
-  1502350,
-  1242776,
-  991890,
-  1523430,
-  1478120,
-  1346090,
-  1180580,
-  222556,
-  542542,
-  542541,
-  542540,
-  1468080,
-  776520,
-  1605170,
-  694330,
-  1555852,
-  1606650,
-  650410,
-  1082351,
-  1598990,
-  34313,
-  1195130,
-  452530,
-  1427591,
-  1599290,
-  1345630,
-  359496,
-  564730,
-  1603330,
-  1603340,
-  1598500,
-  1598510,
-  1603320,
-  212210,
-  1550610,
-  1588970,
-  1441725,
-  700860,
-  1602642,
-  1602643,
-  1602644,
-  1602641,
-  1602640,
-  1603010,
-  1590930,
-  806120,
-  440390,
-  1542570,
-  1579040,
-  1579041,
-  1472500,
-  1579042,
-  1579043,
-  1563120,
-  1337900,
-  1354111,
-  921541,
-  921542,
-  921543,
-  900070,
-  246251,
-  246252,
-  246254,
-  246256,
-  551790,
-  1473690,
-  558370,
-  1579820,
-  1579810,
-  1560360,
-  1560361,
-  508402,
-  508405,
-  1560371,
-  1560370,
-  1311094,
-  1311100,
-  1311101,
-  1501260,
-  1501275,
-  1501282,
-  1501259,
-  1501261,
-  1501263,
-  1501264,
-  1501265,
-  1501266,
-  1501268,
-  1501269,
-  1501270,
-  1501271,
-  1501272,
-  1501274,
-  1501276,
-  1501277,
-  1501279,
-  1501280,
-  1501281,
-  1501283,
-  1501284,
-  1501257,
-  1501258,
-  1501242,
-  1501244,
-  1501243,
-  1501247,
-  1501248,
-  1501249,
-  1501250,
-  1501251,
-  1501252,
-  1501253,
-  1501254,
-  1501256,
-  1501262,
-  1501267,
-  1501273,
-  1501278,
-  1501240,
-  637748,
-  637764,
-  637828,
-  637849,
-  579730,
-  492955,
-  664770,
-  436611,
-  436646,
-  436647,
-  436587,
-  436598,
-  1599310,
-  1526240,
-  790832,
-  1224370,
-  938770,
-  929104,
-  921483,
-  921487,
-  921488,
-  921489,
-  921482,
-  907230,
-  654340,
-  1493080,
-  1600710,
-  1408510,
-  1297050,
-  1393590,
-  1324470,
-  1127490,
-  1580731,
-  304010,
-  1441717,
-  1374730,
-  1374731,
-  1374733,
-  1374735,
-  1452050,
-  1476910,
-  1465731,
-  1465732,
-  1253750,
-  1253751,
-  1253752,
-  1253753,
-  1253754,
-  1253755,
-  214932,
-  1465733,
-  1465730,
-  1445930,
-  1445900,
-  2827,
-  412500,
-  688240,
-  214645,
-  214646,
-  1311102,
-  355208,
-  394650,
-  647070,
-  1575416,
-  425980,
-  1053260,
-  1530320,
-  805060,
-  590360,
-  590361,
-  108231,
-  1576340,
-  206080,
-  206081,
-  206082,
-  206083,
-  206084,
-  206087,
-  206088,
-  206089,
-  206099,
-  206100,
-  206101,
-  206102,
-  206103,
-  206104,
-  206105,
-  206106,
-  206107,
-  206108,
-  206109,
-  206110,
-  206111,
-  206112,
-  206113,
-  206114,
-  206115,
-  206116,
-  206117,
-  206118,
-  206119,
-  206120,
-  206121,
-  206122,
-  206123,
-  206124,
-  206125,
-  206126,
-  206127,
-  206128,
-  206129,
-  206130,
-  206131,
-  206132,
-  206133,
-  206134,
-  206135,
-  206136,
-  206137,
-  206138,
-  206139,
-  206140,
-  206141,
-  206142,
-  206143,
-  206144,
-  206145,
-  206146,
-  206147,
-  206148,
-  206149,
-  206150,
-  206151,
-  206152,
-  206153,
-  206154,
-  206155,
-  206156,
-  206157,
-  206158,
-  206159,
-  206161,
-  206162,
-  206163,
-  206164,
-  206165,
-  206166,
-  206167,
-  206168,
-  206169,
-  222041,
-  206170,
-  222042,
-  206171,
-  222043,
-  206172,
-  222044,
-  206173,
-  206174,
-  206175,
-  222047,
-  206176,
-  206177,
-  206178,
-  222050,
-  206179,
-  222051,
-  222052,
-  222053,
-  222054,
-  222055,
-  222056,
-  222057,
-  222058,
-  222059,
-  222060,
-  222061,
-  222062,
-  222063,
-  222064,
-  222065,
-  222066,
-  222067,
-  222068,
-  222069,
-  222070,
-  222071,
-  222072,
-  222073,
-  222074,
-  222075,
-  222076,
-  222077,
-  222078,
-  222079,
-  222080,
-  222081,
-  222082,
-  222083,
-  222084,
-  222085,
-  222086,
-  222087,
-  222088,
-  222089,
-  222090,
-  222091,
-  222092,
-  222093,
-  222094,
-  222095,
-  222096,
-  222097,
-  222098,
-  222099,
-  222100,
-  222101,
-  222102,
-  222103,
-  222104,
-  222105,
-  222106,
-  222107,
-  222109,
-  222110,
-  222111,
-  222112,
-  222113,
-  222114,
-  222115,
-  222116,
-  222117,
-  222118,
-  222119,
-  222120,
-  222121,
-  222122,
-  222138,
-  222139,
-  294600,
-  455520,
-  577359,
-  1539470,
-  1590280,
-  1433260,
-  439690,
-  215972,
-  1241550,
-  1224858,
-  47897,
-  1517213,
-  1158810,
-  1101350,
-  1433660,
-  1579770,
-  1176490,
-  1065220,
-  1602680,
-  1162220,
-  1211880,
-  1196041,
-  367180,
-  440370,
-  988970,
-  648930,
-  1534121,
-  1351030,
-  1555850,
-  1555851,
-  1555853,
-  1580930,
-  1026010,
-  325955,
-  305200,
-  568630,
-  459330,
-  313930,
-  313931,
-  313932,
-  622690,
-  492390,
-  492391,
-  492392,
-  838250,
-  838251,
-  675200,
-  1437330,
-  1437331,
-  1074590,
-  304300,
-  304301,
-  396250,
-  308160,
-  308161,
-  1342160,
-  553160,
-  1577785,
-  1561410,
-  1534133,
-  1534130,
-  1534122,
-  1534126,
-  1534125,
-  1534124,
-  1534123,
-  1534120,
-  1534119,
-  1534118,
-  1534115,
-  1534112,
-  1534110,
-  523501,
-  450550,
-  1574650,
-  819150,
-  573180,
-  24082,
-  1575490,
-  402990,
-  450100,
-  543610,
-  370400,
-  370401,
-  370402,
-  378620,
-  378621,
-  1056760,
-  711490,
-  634040,
-  1527580,
-  1259260,
-  1430840,
-  1430860,
-  1430850,
-  1430830,
-  1430770,
-  984000,
-  1176700,
-  1441719,
-  1591510,
-  1471160,
-  1471161,
-  397000,
-  1575410,
-  1575364,
-  1575368,
-  1575363,
-  1592090,
-  1575365,
-  1575411,
-  1580540,
-  1580541,
-  1575367,
-  1575369,
-  1575397,
-  1575366,
-  1573918,
-  1117641,
-  540750,
-  540751,
-  540760,
-  325070,
-  613260,
-  1515069,
-  1597890,
-  624530,
-  624531,
-  1476070,
-  1588370,
-  1594630,
-  1594631,
-  225780,
-  1272480,
-  1272481,
-  1273051,
-  1273052,
-  1273054,
-  1273055,
-  1273056,
-  1189390,
-  1216820,
-  1218650,
-  1188230,
-  1188840,
-  1131010,
-  1121330,
-  1147250,
-  1157520,
-  1157030,
-  1114040,
-  1120450,
-  1155010,
-  1125320,
-  1109240,
-  1064210,
-  1064211,
-  1064212,
-  1064213,
-  1046880,
-  1059170,
-  1012380,
-  1060780,
-  1012400,
-  1012401,
-  1012402,
-  1012403,
-  1012404,
-  1012405,
-  1064191,
-  867630,
-  766770,
-  757800,
-  760130,
-  761210,
-  757410,
-  756690,
-  1441950,
-  1442010,
-  1450970,
-  1463600,
-  1463610,
-  1463620,
-  1463630,
-  1463640,
-  1463650,
-  1468850,
-  1468860,
-  1468870,
-  1468880,
-  1468890,
-  1468900,
-  1468910,
-  1468930,
-  1468940,
-  1473700,
-  1468920,
-  1493090,
-  1493100,
-  1486480,
-  1486490,
-  1493110,
-  1493120,
-  1493130,
-  1493140,
-  1499320,
-  1499330,
-  1499340,
-  1499360,
-  1499370,
-  1499380,
-  1503800,
-  1517650,
-  1517660,
-  1517670,
-  1523000,
-  1523050,
-  1517680,
-  1517690,
-  1517700,
-  1523060,
-  1523070,
-  1523080,
-  1523110,
-  1523120,
-  1523950,
-  1523960,
-  1533200,
-  1533210,
-  1533170,
-  1533180,
-  1533220,
-  1533230,
-  1533250,
-  1533270,
-  1533340,
-  1533350,
-  1539320,
-  1542690,
-  1547570,
-  1547680,
-  1539520,
-  1578770,
-  1554480,
-  1554490,
-  1567320,
-  1567330,
-  1578600,
-  1567350,
-  1567360,
-  1578630,
-  1547690,
-  1547700,
-  1578680,
-  1583800,
-  1565380,
-  1547720,
-  1565390,
-  1571550,
-  1558250,
-  1558260,
-  1595560,
-  1595570,
-  1590200,
-  1596860,
-  1583810,
-  1590210,
-  1596870,
-  1596880,
-  1596900,
-  1350870,
-  1350880,
-  1350900,
-  1350910,
-  1350940,
-  1350960,
-  1350970,
-  1350980,
-  1350990,
-  1351040,
-  1351050,
-  1366640,
-  1516480,
-  1378420,
-  1378430,
-  1378440,
-  1378450,
-  1378460,
-  1405560,
-  1405570,
-  1405580,
-  1405590,
-  1405600,
-  1405610,
-  1405620,
-  1433630,
-  1433640,
-  1433650,
-  487570,
-  1433670,
-  1433680,
-  1433690,
-  1441910,
-  1441920,
-  1441930,
-  1441940,
-  1441970,
-  1441980,
-  1442000,
-  1450940,
-  1450950,
-  1450960,
-  1450980,
-  1595530,
-  1595550,
-  1595551,
-  1595580,
-  1165410,
-  1450990,
-  1451000,
-  277739,
-  1454630,
-  1105760,
-  936670,
-  1109290,
-  1230440,
-  1230441,
-  1230442,
-  1237470,
-  1202850,
-  1356930,
-  1356920,
-  1566750,
-  582578,
-  1067921,
-  771830,
-  1219410,
-  1223000,
-  1593910,
-  1094160,
-  1552690,
-  1113510,
-  789640,
-  647370,
-  647371,
-  283750,
-  284450,
-  271942,
-  1583940,
-  1582880,
-  1585510,
-  207620,
-  1487490,
-  771560,
-  790180,
-  411460,
-  403910,
-  1064970,
-  1598380,
-  1570590,
-  1570594,
-  661540,
-  503590,
-  864820,
-  705080,
-  694590,
-  544071,
-  1591880,
-  1591881,
-  1592910,
-  704080,
-  682580,
-  704100,
-  709990,
-  24938,
-  670580,
-  779894,
-  435330,
-  546970,
-  729500,
-  1521321,
-  619180,
-  560560,
-  724410,
-  334010,
-  204731,
-  692670,
-  403150,
-  642530,
-  786660,
-  495590,
-  386793,
-  386798,
-  212211,
-  544500,
-  1015600,
-  1107814,
-  1542310,
-  1539490,
-  1592030,
-  1562950,
-  1562960,
-  1443220,
-  325994,
-  1568990,
-  923720,
-  1441727,
-  1441729,
-  834403,
-  801860,
-  1569778,
-  1569776,
-  1569774,
-  1569772,
-  1569770,
-  1569779,
-  1569777,
-  1569775,
-  1569773,
-  1569771,
-  255250,
-  255251,
-  255253,
-  1552670,
-  1551430,
-  222285,
-  1424210,
-  1448100,
-  978080,
-  420050,
-  929360,
-  1330721,
-  998600,
-  1404641,
-  1404640,
-  916170,
-  1262610,
-  1422991,
-  520780,
-  536576,
-  1570591,
-  1570592,
-  1570593,
-  1414540,
-  526910,
-  1324160,
-  1177060,
-  1089670,
-  987440,
-  1586770,
-  1154591,
-  1477540,
-  1009540,
-  645172,
-  1088497,
-  1590170,
-  1590171,
-  358144,
-  362700,
-  1528440,
-  1528442,
-  1528441,
-  1571630,
-  1515068,
-  1210170,
-  1133840,
-  1158210,
-  1084110,
-  1133820,
-  608730,
-  1542230,
-  1572431,
-  1572432,
-  1572430,
-  1472490,
-  1572433,
-  1464310,
-  702950,
-  339032,
-  1427673,
-  1397250,
-  1576310,
-  1576311,
-  1576312,
-  214330,
-  214331,
-  946970,
-  440930,
-  1261540,
-  1261541,
-  1302060,
-  1255390,
-  1568991,
-  812290,
-  1330420,
-  1580730,
-  1418730,
-  401920,
-  398310,
-  1567660,
-  1570561,
-  1271270,
-  1572890,
-  1572891,
-  1572892,
-  1572894,
-  1515067,
-  955000,
-  1516430,
-  1312920,
-  39126,
-  966120,
-  956660,
-  971510,
-  971511,
-  971512,
-  974330,
-  378460,
-  1176155,
-  1176185,
-  606080,
-  1155280,
-  1087830,
-  337840,
-  1457530,
-  1572030,
-  1161740,
-  568850,
-  363780,
-  363781,
-  653090,
-  592420,
-  592421,
-  592422,
-  592423,
-  658860,
-  363770,
-  357790,
-  1579980,
-  1529400,
-  1587980,
-  1394000,
-  1539480,
-  1480880,
-  1584490,
-  1575250,
-  211205,
-  580660,
-  580661,
-  1569230,
-  448198,
-  1365460,
-  709060,
-  708900,
-  1216890,
-  1441724,
-  1441722,
-  1441723,
-  1441721,
-  1255250,
-  1255260,
-  1255270,
-  1491100,
-  47896,
-  1149840,
-  1128070,
-  1127410,
-  1538200,
-  1472855,
-  1472854,
-  1472853,
-  1472851,
-  1472852,
-  1472850,
-  1472849,
-  1472848,
-  1472847,
-  1472846,
-  1472845,
-  1472844,
-  1472843,
-  1472842,
-  1515066,
-  1547810,
-  781542,
-  444760,
-  1570772,
-  1558690,
-  1566851,
-  1566850,
-  1158130,
-  1256621,
-  1147150,
-  1576200,
-  1578121,
-  1578122,
-  1578123,
-  1578124,
-  1578125,
-  1578126,
-  1578127,
-  1578128,
-  1578129,
-  1578120,
-  1214310,
-  1296790,
-  1570771,
-  1570770,
-  1188600,
-  329010,
-  1431712,
-  1264430,
-  1583310,
-  1268850,
-  1491890,
-  1547940,
-  1023802,
-  1529390,
-  1327490,
-  352840,
-  662353,
-  546590,
-  906150,
-  945832,
-  1210270,
-  1282840,
-  208289,
-  1352580,
-  1538870,
-  484840,
-  1477800,
-  1230130,
-  1230131,
-  1360370,
-  1385070,
-  973750,
-  750230,
-  1559610,
-  1572893,
-  1357071,
-  1568220,
-  610709,
-  1092692,
-  1477671,
-  1477670,
-  1483490,
-  1511150,
-  1511151,
-  1561930,
-  1557110,
-  1574630,
-  1553020,
-  1586180,
-  1464312,
-  1485790,
-  658001,
-  1192350,
-  1583790,
-  1245390,
-  806390,
-  679940,
-  435610,
-  468140,
-  439230,
-  439231,
-  439232,
-  258744,
-  759590,
-  1561110,
-  1582050,
-  1432940,
-  1560980,
-  1560982,
-  1560983,
-  1560984,
-  1560981,
-  1575340,
-  1573670,
-  794105,
-  411894,
-  1182640,
-  1023160,
-  1473610,
-  1198940,
-  1582590,
-  1365210,
-  1567070,
-  1567071,
-  1567072,
-  1567073,
-  1316750,
-  843800,
-  1431490,
-  1431491,
-  1431492,
-  387980,
-  792630,
-  330491,
-  330490,
-  355641,
-  347212,
-  1544760,
-  1067770,
-  1584880,
-  325988,
-  1391880,
-  1391890,
-  1391900,
-  1391910,
-  1387670,
-  1387680,
-  1387690,
-  1387700,
-  1387710,
-  1387720,
-  1391820,
-  1387730,
-  1391830,
-  1387740,
-  1391840,
-  1387750,
-  1391850,
-  1387760,
-  1391860,
-  1391870,
-  1331720,
-  1331730,
-  1331740,
-  1331750,
-  1331760,
-  1331770,
-  1331780,
-  1331790,
-  1331800,
-  1331810,
-  1276200,
-  1276210,
-  1276220,
-  1276230,
-  1276240,
-  1276250,
-  1267300,
-  1276260,
-  1276280,
-  1267140,
-  1578531,
-  577354,
-  584240,
-  47722,
-  47723,
-  18052,
-  18053,
-  18060,
-  18061,
-  24996,
-  24997,
-  24998,
-  1316265,
-  1563621,
-  1486580,
-  1486590,
-  1578530,
-  1580880,
-  1574790,
-  102000,
-  102001,
-  34490,
-  34491,
-  34492,
-  34493,
-  34495,
-  34496,
-  34497,
-  34498,
-  16865,
-  1259670,
-  1289192,
-  851500,
-  843671,
-  1575341,
-  1578610,
-  1582240,
-  885070,
-  1578690,
-  315200,
-  1562900,
-  1219990,
-  992180,
-  577130,
-  577131,
-  357170,
-  357171,
-  400720,
-  400721,
-  1584012,
-  1584013,
-  1584011,
-  1583970,
-  1583971,
-  1584010,
-  1583340,
-  701270,
-  1443017,
-  1443020,
-  1443021,
-  1443022,
-  1443023,
-  1443024,
-  1443025,
-  1443026,
-  1443027,
-  1443028,
-  1443029,
-  1443040,
-  1443041,
-  1443042,
-  1443043,
-  1443044,
-  1443045,
-  1443046,
-  1443047,
-  1443048,
-  1443049,
-  1443050,
-  1443051,
-  1443052,
-  1443053,
-  1443054,
-  1443056,
-  1443057,
-  1443058,
-  1443059,
-  1443060,
-  1443061,
-  1443063,
-  1443065,
-  1443066,
-  1374880,
-  1507100,
-  1507160,
-  1501080,
-  1501081,
-  1501082,
-  1488580,
-  1488581,
-  1507070,
-  1521500,
-  1521501,
-  1521502,
-  1536430,
-  662357,
-  453250,
-  1259270,
-  1219870,
-  619580,
-  619583,
-  619584,
-  619586,
-  629020,
-  783280,
-  1580360,
-  1196650,
-  1170270,
-  1184630,
-  1189760,
-  1195150,
-  1158490,
-  260880,
-  942280,
-  265463,
-  61710,
-  325963,
-  903244,
-  273151,
-  208303,
-  1060270,
-  708880,
-  1163330,
-  622661,
-  488811,
-  990930,
-  344290,
-  366331,
-  986090,
-  364322,
-  376951,
-  1533240,
-  315560,
-  1149393,
-  1484260,
-  781530,
-  1414200,
-  215240,
-  1582490,
-  1581540,
-  1376930,
-  1176915,
-  616530,
-  1379430,
-  410641,
-  410650,
-  410651,
-  410652,
-  410653,
-  410654,
-  324180,
-  324200,
-  305540,
-  272290,
-  332990,
-  333000,
-  1147151,
-  255240,
-  402660,
-  1426920,
-  1066122,
-  1066120,
-  1066121,
-  376969,
-  1261542,
-  1563040,
-  1580581,
-  1580584,
-  1580585,
-  1580588,
-  1580589,
-  1580590,
-  1580592,
-  1580593,
-  1580594,
-  1580595,
-  1580586,
-  1580596,
-  1580582,
-  1580583,
-  1580587,
-  1580591,
-  1580580,
-  1078890,
-  1037200,
-  462270,
-  1539290,
-  1249280,
-  564250,
-  545740,
-  545741,
-  545742,
-  545743,
-  412240,
-  412241,
-  412242,
-  412243,
-  988730,
-  287330,
-  1524740,
-  1088000,
-  1486833,
-  1486834,
-  1486835,
-  1486836,
-  1486830,
-  1486831,
-  1486832,
-  730632,
-  852020,
-  588962,
-  568950,
-  1558340,
-  1558341,
-  1574120,
-  534850,
-  1546853,
-  1503030,
-  1573781,
-  1573940,
-  1463160,
-  1438020,
-  35134,
-  1546852,
-  427561,
-  1564820,
-  429310,
-  1570530,
-  1569910,
-  1571710,
-  1554360,
-  1553790,
-  640200,
-  860630,
-  1424170,
-  207811,
-  207812,
-  207813,
-  207814,
-  1571903,
-  1571902,
-  1571901,
-  1571900,
-  222591,
-  1028120,
-  1573230,
-  1562770,
-  1289590,
-  494140,
-  700320,
-  364329,
-  1546040,
-  654183,
-  1518520,
-  1502320,
-  35725,
-  1559640,
-  1178879,
-  1500840,
-  1055338,
-  1496730,
-  624642,
-  624643,
-  408350,
-  338740,
-  1571510,
-  1571511,
-  1571512,
-  1571513,
-  956110,
-  284640,
-  47843,
-  1214420,
-  1370280,
-  974380,
-  1419500,
-  1566520,
-  996220,
-  1578560,
-  1115750,
-  1115751,
-  1115752,
-  1115753,
-  959790,
-  1111441,
-  1034483,
-  835480,
-  913900,
-  620000,
-  619680,
-  509350,
-  572030,
-  1421580,
-  1320851,
-  1375190,
-  1489230,
-  1441730,
-  1441731,
-  376934,
-  447300,
-  401740,
-  1090600,
-  1090601,
-  1090602,
-  1090603,
-  1090604,
-  1090605,
-  1090606,
-  1090607,
-  1090608,
-  1090612,
-  1089850,
-  1089851,
-  1089852,
-  1089853,
-  1353090,
-  1271200,
-  1271210,
-  1088940,
-  1088941,
-  1088942,
-  1088943,
-  1088944,
-  1088945,
-  1088946,
-  1088947,
-  1088948,
-  1088949,
-  601390,
-  1442140,
-  1530881,
-  1217840,
-  1167880,
-  1001280,
-  884761,
-  884762,
-  884860,
-  1461330,
-  1480751,
-  413060,
-  1188615,
-  1400550,
-  793340,
-  415410,
-  920590,
-  650520,
-  998064,
-  998295,
-  998062,
-  998090,
-  998202,
-  998070,
-  1258701,
-  998214,
-  998260,
-  998257,
-  803380,
-  1534920,
-  525470,
-  220823,
-  1555550,
-  493610,
-  325958,
-  258658,
-  222608,
-  1556090,
-  1551170,
-  1532580,
-  258659,
-  1121430,
-  1010820,
-  1010821,
-  470540,
-  226370,
-  226390,
-  206521,
-  348091,
-  1372400,
-  546320,
-  1145690,
-  648292,
-  1533030,
-  791230,
-  1563980,
-  373490,
-  226350,
-  222551,
-  1349010,
-  267650,
-  1314900,
-  966840,
-  966841,
-  966842,
-  970170,
-  966843,
-  966845,
-  222555,
-  1573380,
-  354467,
-  841169,
-  1155530,
-  1233700,
-  216417,
-  1568992,
-  1376920,
-  1571400,
-  814250,
-  1542470,
-  1485960,
-  1102090,
-  1180722,
-  1160242,
-  734281,
-  734282,
-  734283,
-  1316185,
-  1375580,
-  779401,
-  721290,
-  1054873,
-  1200551,
-  1253301,
-  1116622,
-  1415130,
-  1396460,
-  1571520,
-  1571521,
-  1571530,
-  386721,
-  439995,
-  1544410,
-  1573780,
-  1491420,
-  286634,
-  393060,
-  1472470,
-  1472480,
-  1468140,
-  1341700,
-  1537780,
-  1211476,
-  590480,
-  1555600,
-  1555601,
-  1555602,
-  1555603,
-  1365190,
-  1570560,
-  1329554,
-  1329555,
-  1496731,
-  462610,
-  915630,
-  1465850,
-  739280,
-  443750,
-  439900,
-  581080,
-  743620,
-  344460,
-  1524770,
-  1206030,
-  1032150,
-  486950,
-  471560,
-  460553,
-  487280,
-  445630,
-  746960,
-  1124441,
-  626900,
-  1124440,
-  1549100,
-  1069990,
-  1268560,
-  1551320,
-  1413080,
-  65242,
-  1078150,
-  1530940,
-  1089203,
-  65256,
-  1530011,
-  1530010,
-  1443088,
-  1443087,
-  1443086,
-  1443085,
-  1483720,
-  1483700,
-  1483710,
-  1483690,
-  1550120,
-  1564320,
-  1562190,
-  1214890,
-  1566260,
-  1501170,
-  1500441,
-  1500442,
-  1500440,
-  947550,
-  995380,
-  1261840,
-  1015950,
-  996541,
-  842840,
-  807260,
-  732410,
-  538820,
-  559381,
-  537260,
-  535732,
-  535740,
-  538828,
-  537820,
-  537827,
-  537828,
-  470190,
-  275138,
-  210074,
-  210075,
-  210046,
-  210051,
-  210045,
-  210057,
-  200860,
-  200870,
-  65259,
-  4856,
-  969620,
-  398820,
-  1533460,
-  610707,
-  991520,
-  1025590,
-  1559360,
-  1137280,
-  1137281,
-  1137282,
-  1137283,
-  47749,
-  583070,
-  91346,
-  1566470,
-  1082576,
-  1082577,
-  1082578,
-  1082579,
-  1082580,
-  1082581,
-  1082582,
-  1055680,
-  1082571,
-  1082572,
-  1082573,
-  1082574,
-  1082575,
-  847416,
-  847417,
-  847418,
-  847420,
-  847421,
-  847422,
-  1094310,
-  1100750,
-  1158491,
-  892600,
-  850100,
-  796410,
-  1239100,
-  1246410,
-  1419715,
-  208284,
-  1484220,
-  502890,
-  1012101,
-  1246411,
-  237050,
-  334340,
-  445991,
-  816780,
-  759104,
-  1024660,
-  1530830,
-  359930,
-  355341,
-  610708,
-  1246413,
-  1246412,
-  258645,
-  1570640,
-  1431700,
-  1176919,
-  1565170,
-  378040,
-  1561700,
-  1565300,
-  1240930,
-  1240950,
-  1240960,
-  1240970,
-  1240980,
-  1240990,
-  1222920,
-  1183520,
-  1226460,
-  613000,
-  486960,
-  400770,
-  330510,
-  1354120,
-  258420,
-  218100,
-  1243840,
-  1291320,
-  803090,
-  847413,
-  847414,
-  847415,
-  530580,
-  417850,
-  417851,
-  1537401,
-  1537400,
-  1497480,
-  209817,
-  1363632,
-  1363631,
-  1363630,
-  295190,
-  279600,
-  1565400,
-  1565350,
-  1565360,
-  1565370,
-  1566180,
-  222576,
-  1552901,
-  1552900,
-  987270,
-  317240,
-  317230,
-  1531400,
-  730350,
-  583110,
-  1353520,
-  1353522,
-  1382220,
-  923380,
-  319000,
-  1513140,
-  988410,
-  1216840,
-  1442510,
-  1561820,
-  1561790,
-  511890,
-  1386470,
-  313720,
-  614180,
-  1426921,
-  1366580,
-  463630,
-  338770,
-  383130,
-  347900,
-  1546490,
-  683610,
-  1566000,
-  1354052,
-  1134387,
-  420822,
-  1061810,
-  1528070,
-  762911,
-  583220,
-  630110,
-  587410,
-  587413,
-  587411,
-  587412,
-  587414,
-  102510,
-  560400,
-  9240,
-  9241,
-  1000490,
-  1358160,
-  744830,
-  242070,
-  455330,
-  1170890,
-  1316300,
-  1430390,
-  1176935,
-  1296900,
-  1236660,
-  1562290,
-  1561420,
-  1560080,
-  1457060,
-  1539500,
-  1558120,
-  1558040,
-  1561950,
-  1561940,
-  1365180,
-  1049460,
-  1245200,
-  1254270,
-  1232340,
-  1516780,
-  1516770,
-  1515940,
-  990931,
-  548700,
-  1113822,
-  1550440,
-  1441726,
-  1481850,
-  733100,
-  1559200,
-  1523810,
-  1107810,
-  927900,
-  973270,
-  1031030,
-  1501700,
-  1120670,
-  623190,
-  789393,
-  1539830,
-  1176920,
-  58643,
-  58645,
-  226666,
-  226669,
-  210898,
-  343962,
-  677951,
-  598540,
-  1088483,
-  798901,
-  798902,
-  361060,
-  613870,
-  1505291,
-  1505294,
-  1505295,
-  1505296,
-  1504800,
-  1500200,
-  1494850,
-  1499460,
-  1501290,
-  1503100,
-  1504640,
-  1496980,
-  1497750,
-  1500850,
-  1498580,
-  1503970,
-  1496050,
-  1503730,
-  1495540,
-  1490700,
-  1481240,
-  1489460,
-  1477431,
-  1478760,
-  1485170,
-  1480320,
-  1480321,
-  1494410,
-  1488780,
-  1482390,
-  1487260,
-  1478560,
-  1484200,
-  1488300,
-  1479350,
-  1482960,
-  1492180,
-  1492960,
-  1486310,
-  1486311,
-  1486312,
-  1483500,
-  1463810,
-  1474820,
-  1465880,
-  1471260,
-  1473320,
-  1470250,
-  1477430,
-  1464140,
-  1475660,
-  1461070,
-  1462890,
-  1461870,
-  1466990,
-  1476980,
-  1464950,
-  1470600,
-  1464470,
-  1470630,
-  1459880,
-  1469100,
-  1472200,
-  1468150,
-  1460730,
-  1453060,
-  1453880,
-  1458510,
-  1421650,
-  1421651,
-  1421652,
-  1421653,
-  1453180,
-  1439880,
-  1435030,
-  1451170,
-  1456550,
-  1433510,
-  1454510,
-  1412283,
-  1452740,
-  1425860,
-  1457610,
-  1459150,
-  1455570,
-  1446910,
-  1412280,
-  1412281,
-  1412282,
-  1397990,
-  1176917,
-  1476490,
-  1176921,
-  483450,
-  514800,
-  577356,
-  297792,
-  211203,
-  298641,
-  1247710,
-  373491,
-  360280,
-  447510,
-  245172,
-  245173,
-  245174,
-  245175,
-  245177,
-  360270,
-  207816,
-  267382,
-  274160,
-  274161,
-  1230450,
-  1010139,
-  433080,
-  433090,
-  442840,
-  1501870,
-  1315520,
-  1553270,
-  1431480,
-  508800,
-  1558280,
-  1558220,
-  1558230,
-  1558240,
-  1558270,
-  1556330,
-  1427160,
-  1494612,
-  222613,
-  1526070,
-  1526071,
-  1205090,
-  1537650,
-  1537640,
-  1515061,
-  1478465,
-  837861,
-  1523470,
-  1140190,
-  1140200,
-  1140210,
-  1140230,
-  1140240,
-  1140250,
-  1141820,
-  1150280,
-  1512110,
-  1240200,
-  1448580,
-  1478464,
-  1478466,
-  1290400,
-  1251050,
-  1240380,
-  1271131,
-  1271132,
-  1271133,
-  1250920,
-  1431489,
-  1431487,
-  1431488,
-  1499490,
-  553075,
-  357180,
-  1546850,
-  1234230,
-  1199590,
-  1165051,
-  1165052,
-  542450,
-  1402710,
-  1549470,
-  1200960,
-  742680,
-  742690,
-  762290,
-  762300,
-  762310,
-  762320,
-  762330,
-  762340,
-  762350,
-  742660,
-  687110,
-  742670,
-  687120,
-  687130,
-  687150,
-  687160,
-  687170,
-  687180,
-  687190,
-  687200,
-  687210,
-  687220,
-  687230,
-  688280,
-  688290,
-  688300,
-  688310,
-  687080,
-  687090,
-  687100,
-  686970,
-  686980,
-  686990,
-  687000,
-  687010,
-  687020,
-  687030,
-  687040,
-  687050,
-  687060,
-  687070,
-  279601,
-  1225300,
-  1469010,
-  22521,
-  1530080,
-  1392610,
-  1399411,
-  98211,
-  1419714,
-  1543160,
-  1543161,
-  1213480,
-  773470,
-  1531390,
-  744340,
-  370341,
-  1392220,
-  1310760,
-  1305680,
-  1285990,
-  1286000,
-  1269490,
-  707176,
-  707177,
-  707178,
-  707179,
-  707180,
-  707181,
-  707182,
-  707183,
-  707186,
-  707187,
-  707188,
-  707190,
-  707191,
-  707192,
-  707193,
-  707194,
-  707195,
-  707172,
-  707173,
-  707174,
-  707175,
-  1530883,
-  438801,
-  332820,
-  317463,
-  255000,
-  1537580,
-  1537581,
-  1537582,
-  1537583,
-  1537584,
-  1374000,
-  1537585,
-  216152,
-  504960,
-  1033920,
-  494560,
-  1316071,
-  1306410,
-  107821,
-  107820,
-  1032050,
-  1555441,
-  1555442,
-  351462,
-  1555440,
-  1442700,
-  1442701,
-  1442702,
-  1442703,
-  22510,
-  22520,
-  1373660,
-  1530882,
-  1552420,
-  1550070,
-  1556390,
-  1548160,
-  1424530,
-  1406550,
-  1406580,
-  1406530,
-  1550170,
-  1437960,
-  1559950,
-  1538660,
-  564030,
-  524330,
-  1417810,
-  1150750,
-  1506570,
-  209872,
-  209873,
-  1104760,
-  957918,
-  750430,
-  1551130,
-  1469470,
-  1469471,
-  404282,
-  623611,
-  1002940,
-  771270,
-  1472030,
-  1554190,
-  1554200,
-  1553700,
-  1554230,
-  1553720,
-  1554240,
-  1554250,
-  1553760,
-  1553770,
-  305570,
-  1205290,
-  1314350,
-  1090609,
-  792331,
-  1253092,
-  990760,
-  937890,
-  941170,
-  221162,
-  1019010,
-  255550,
-  255551,
-  352710,
-  1028892,
-  1383801,
-  826260,
-  969270,
-  855930,
-  1068260,
-  455570,
-  1059700,
-  1136890,
-  836785,
-  234021,
-  234022,
-  234023,
-  234024,
-  556217,
-  1536010,
-  1554450,
-  1547850,
-  1554410,
-  1554420,
-  1554430,
-  715910,
-  1442620,
-  1440191,
-  1357340,
-  1517210,
-  1517211,
-  1517212,
-  1517214,
-  1517215,
-  1517216,
-  1479790,
-  1479791,
-  1479792,
-  1479793,
-  1479794,
-  1454040,
-  1448510,
-  1448511,
-  1448512,
-  1404040,
-  1404041,
-  1404042,
-  1271862,
-  1271890,
-  1271891,
-  1271892,
-  1271893,
-  1271860,
-  1271861,
-  1090611,
-  1090610,
-  1545770,
-  550050,
-  1485950,
-  48802,
-  502860,
-  502891,
-  630430,
-  1394950,
-  1246031,
-  1503190,
-  1490100,
-  1365170,
-  1502870,
-  201100,
-  382950,
-  219443,
-  1521245,
-  1521246,
-  1521247,
-  1521244,
-  1521243,
-  865320,
-  434060,
-  472671,
-  1552360,
-  1553730,
-  1550500,
-  1365130,
-  1365160,
-  212520,
-  1508610,
-  1508600,
-  621870,
-  1543220,
-  756660,
-  1125810,
-  643760,
-  1444590,
-  562380,
-  376959,
-  849160,
-  849161,
-  849162,
-  849163,
-  849164,
-  849165,
-  849166,
-  849167,
-  849168,
-  849170,
-  849171,
-  849176,
-  849177,
-  849178,
-  849179,
-  849180,
-  849181,
-  849186,
-  849187,
-  849188,
-  849200,
-  905320,
-  890030,
-  890031,
-  890032,
-  1406520,
-  1546200,
-  1529970,
-  1548170,
-  1406440,
-  1520550,
-  1548260,
-  1524960,
-  1553780,
-  1524900,
-  1001150,
-  219092,
-  859100,
-  962500,
-  577630,
-  582230,
-  1171390,
-  1533040,
-  581951,
-  804980,
-  581950,
-  1331820,
-  1331821,
-  1001370,
-  748101,
-  317464,
-  1528791,
-  1528790,
-  715900,
-  273261,
-  677991,
-  1501460,
-  1413520,
-  1296730,
-  1532610,
-  1532630,
-  1224890,
-  254610,
-  1130630,
-  1133650,
-  1012381,
-  1351270,
-  1055339,
-  490060,
-  512620,
-  1316264,
-  468733,
-  1497960,
-  1179550,
-  815410,
-  1549770,
-  1540380,
-  889800,
-  387120,
-  396620,
-  987170,
-  888701,
-  515100,
-  204160,
-  457090,
-  94203,
-  94205,
-  1546983,
-  1546982,
-  1546980,
-  203777,
-  203775,
-  203774,
-  1479710,
-  1483460,
-  455223,
-  488100,
-  1404950,
-  1219460,
-  1171750,
-  1144780,
-  1114580,
-  1113430,
-  1043550,
-  1146550,
-  411901,
-  304210,
-  397122,
-  1422160,
-  1547600,
-  325974,
-  1399111,
-  1429758,
-  1144500,
-  730000,
-  874410,
-  782270,
-  1361620,
-  766450,
-  492020,
-  891540,
-  1411530,
-  65253,
-  904920,
-  879720,
-  891530,
-  869740,
-  556350,
-  1547560,
-  318871,
-  299350,
-  378500,
-  370250,
-  1076760,
-  1076761,
-  1073681,
-  1073680,
-  472070,
-  329013,
-  326530,
-  449980,
-  401660,
-  292980,
-  292981,
-  210897,
-  210903,
-  210907,
-  1498800,
-  1206686,
-  428720,
-  616210,
-  1431483,
-  1531280,
-  1543310,
-  1431485,
-  1314560,
-  1431484,
-  1489231,
-  1489232,
-  1489233,
-  1518670,
-  1521242,
-  1521241,
-  1521240,
-  1158540,
-  1100960,
-  847840,
-  1546981,
-  318873,
-  1370020,
-  1452620,
-  1387630,
-  780770,
-  1211920,
-  461247,
-  1107290,
-  779660,
-  1399410,
-  556213,
-  1461880,
-  709170,
-  276050,
-  47815,
-  759760,
-  896717,
-  621928,
-  1463060,
-  1143820,
-  762770,
-  1530880,
-  1383600,
-  343600,
-  1464580,
-  1455960,
-  1453970,
-  1414310,
-  1420220,
-  1420221,
-  1390770,
-  1326060,
-  1200171,
-  952390,
-  891770,
-  891780,
-  872610,
-  1527530,
-  1468650,
-  1527490,
-  1536951,
-  931980,
-  301893,
-  301895,
-  812760,
-  1441875,
-  821940,
-  763590,
-  1490200,
-  1467370,
-  441300,
-  1385310,
-  1535570,
-  208319,
-  1544060,
-  1544070,
-  415800,
-  240612,
-  1523880,
-  1500700,
-  1530380,
-  1522250,
-  1532330,
-  795000,
-  411420,
-  345870,
-  1504530,
-  1532570,
-  896748,
-  1500730,
-  1539700,
-  1539660,
-  1539690,
-  1536950,
-  401320,
-  441301,
-  619582,
-  1523450,
-  1523451,
-  47930,
-  610706,
-  1402170,
-  411950,
-  350270,
-  108232,
-  108233,
-  1429759,
-  1517130,
-  1517131,
-  1515130,
-  277756,
-  277733,
-  558240,
-  775630,
-  1524200,
-  1524210,
-  1524220,
-  1277860,
-  1481800,
-  1436060,
-  727050,
-  625500,
-  725880,
-  727440,
-  306190,
-  216332,
-  216333,
-  216334,
-  216335,
-  215245,
-  215246,
-  215247,
-  215248,
-  215249,
-  215251,
-  215253,
-  215255,
-  215241,
-  215242,
-  215243,
-  215244,
-  202191,
-  202193,
-  477790,
-  527200,
-  641380,
-  1189110,
-  456600,
-  1328010,
-  1267710,
-  1532450,
-  1532451,
-  1539330,
-  1539260,
-  1539300,
-  950553,
-  975330,
-  731390,
-  1478750,
-  1516140,
-  360860,
-  375470,
-  1490040,
-  1049700,
-  1522210,
-  1262660,
-  1528990,
-  512350,
-  1047200,
-  1047201,
-  1047202,
-  989741,
-  900442,
-  900444,
-  900445,
-  945272,
-  947090,
-  951520,
-  889922,
-  889923,
-  267653,
-  565280,
-  413370,
-  329880,
-  329910,
-  329930,
-  1493830,
-  1528480,
-  1528490,
-  1524660,
-  1535930,
-  1535931,
-  1535932,
-  1535933,
-  1524680,
-  1524681,
-  1524682,
-  1524683,
-  1524684,
-  1524685,
-  1524686,
-  1524687,
-  1385410,
-  1419520,
-  1396600,
-  1396590,
-  1406430,
-  1406590,
-  1406420,
-  1446290,
-  1542520,
-  1483511,
-  411030,
-  1496403,
-  1496404,
-  1496420,
-  1496421,
-  1496422,
-  1496423,
-  1496400,
-  1496401,
-  1496402,
-  1322790,
-  1322791,
-  1322792,
-  1322793,
-  1322794,
-  1322795,
-  1322796,
-  1322797,
-  1322798,
-  1211300,
-  1211301,
-  1211302,
-  1211303,
-  1211310,
-  1211311,
-  1211312,
-  1211313,
-  1211314,
-  1496330,
-  1245510,
-  1443770,
-  1484190,
-  1522910,
-  1542190,
-  1523380,
-  1523310,
-  1523300,
-  1523280,
-  533220,
-  528140,
-  366844,
-  1473810,
-  1007112,
-  1007113,
-  363030,
-  1066280,
-  677930,
-  1090090,
-  1090091,
-  1090092,
-  1090093,
-  1090094,
-  1090095,
-  1090096,
-  1264700,
-  368961,
-  1155140,
-  1038950,
-  1090151,
-  1090152,
-  350060,
-  1090170,
-  1090201,
-  1039030,
-  1039031,
-  462550,
-  1537260,
-  358120,
-  1535333,
-  1535332,
-  1535331,
-  1535330,
-  1192790,
-  1508560,
-  1007111,
-  477040,
-  319930,
-  376940,
-  1007110,
-  715070,
-  1375361,
-  1526050,
-  1526051,
-  1526052,
-  1534440,
-  740800,
-  802700,
-  930020,
-  874800,
-  1475680,
-  764460,
-  1246750,
-  1440320,
-  480610,
-  776530,
-  975301,
-  1181775,
-  1181772,
-  1181773,
-  1181774,
-  1209135,
-  1209134,
-  1209131,
-  1521940,
-  1463190,
-  1463240,
-  1463270,
-  1454860,
-  1504510,
-  1278470,
-  1287060,
-  602472,
-  230940,
-  1024700,
-  1458520,
-  1521990,
-  1048460,
-  1309230,
-  55205,
-  1348900,
-  793542,
-  1500420,
-  1531440,
-  343959,
-  335060,
-  271520,
-  255692,
-  249122,
-  221160,
-  221161,
-  221165,
-  221168,
-  888330,
-  1524500,
-  953650,
-  1188730,
-  1153810,
-  780340,
-  488090,
-  316591,
-  487490,
-  635330,
-  494529,
-  1435140,
-  71168,
-  211200,
-  211201,
-  249089,
-  736770,
-  211204,
-  211206,
-  34310,
-  211207,
-  34311,
-  211208,
-  34312,
-  211209,
-  34314,
-  34315,
-  34316,
-  34317,
-  34318,
-  34319,
-  258580,
-  344354,
-  344359,
-  952360,
-  38185,
-  404010,
-  34346,
-  34347,
-  404015,
-  711730,
-  711731,
-  711732,
-  711733,
-  201270,
-  711734,
-  711735,
-  711736,
-  711737,
-  711738,
-  711739,
-  711740,
-  711741,
-  201278,
-  344382,
-  711742,
-  231487,
-  711743,
-  711744,
-  344385,
-  231489,
-  711745,
-  231490,
-  711746,
-  344388,
-  344391,
-  224840,
-  344394,
-  344650,
-  203600,
-  715860,
-  344662,
-  933720,
-  694880,
-  10600,
-  10601,
-  10602,
-  10603,
-  306540,
-  56431,
-  626800,
-  56432,
-  327280,
-  56433,
-  278130,
-  56434,
-  278131,
-  56435,
-  56436,
-  56437,
-  933750,
-  933751,
-  56439,
-  933752,
-  933753,
-  933754,
-  34170,
-  377210,
-  933755,
-  34171,
-  933756,
-  34172,
-  933757,
-  34173,
-  933758,
-  933759,
-  34175,
-  933760,
-  34176,
-  933761,
-  34177,
-  933762,
-  933763,
-  34179,
-  933764,
-  933765,
-  34184,
-  259210,
-  282520,
-  314780,
-  387740,
-  314781,
-  387741,
-  314782,
-  387742,
-  314783,
-  387743,
-  387744,
-  56481,
-  387745,
-  56482,
-  56483,
-  56484,
-  56485,
-  56486,
-  343463,
-  56487,
-  56488,
-  357810,
-  378041,
-  324030,
-  71110,
-  71111,
-  71112,
-  286920,
-  71114,
-  71115,
-  71116,
-  71117,
-  71118,
-  56536,
-  260312,
-  56537,
-  56538,
-  260315,
-  260316,
-  260317,
-  260318,
-  260319,
-  34272,
-  260320,
-  34273,
-  34275,
-  34276,
-  34277,
-  34279,
-  260327,
-  34280,
-  260328,
-  260329,
-  255210,
-  34283,
-  34284,
-  34285,
-  34286,
-  34288,
-  34289,
-  261620,
-  249080,
-  71161,
-  249084,
-  71165,
-  71166,
-  71167,
-  1526250,
-  1285950,
-  1538000,
-  1329550,
-  1329551,
-  1329552,
-  1329559,
-  1024910,
-  1024915,
-  1024920,
-  1121790,
-  921480,
-  294180,
-  1524870,
-  1125640,
-  1125641,
-  1125642,
-  1146680,
-  1133140,
-  1187230,
-  955590,
-  707185,
-  475460,
-  396470,
-  379566,
-  1294390,
-  1252980,
-  1517750,
-  1517760,
-  234431,
-  1460462,
-  941966,
-  1523410,
-  1536330,
-  430370,
-  1365150,
-  1478462,
-  1478463,
-  502010,
-  940390,
-  353053,
-  325990,
-  1387920,
-  1387921,
-  1387922,
-  1462450,
-  1462451,
-  1486020,
-  1374660,
-  1406400,
-  1406300,
-  1527550,
-  1412210,
-  1534670,
-  1533360,
-  1527590,
-  1525170,
-  1534750,
-  1520630,
-  1224410,
-  610100,
-  1303780,
-  1196791,
-  379567,
-  1179142,
-  1320850,
-  502790,
-  564509,
-  1079390,
-  1079400,
-  383900,
-  584094,
-  654510,
-  1441710,
-  706261,
-  706262,
-  1520860,
-  484850,
-  1446170,
-  1212090,
-  935511,
-  588660,
-  1465272,
-  1465271,
-  1465270,
-  1180910,
-  1379950,
-  353050,
-  1453500,
-  1428690,
-  1296690,
-  1299300,
-  1294030,
-  1271570,
-  1271571,
-  1277260,
-  1283200,
-  1276360,
-  1282250,
-  1278460,
-  926660,
-  1512700,
-  1463260,
-  1290401,
-  1290402,
-  310100,
-  1526460,
-  1441718,
-  1441716,
-  1441715,
-  1441714,
-  1441713,
-  1441712,
-  381150,
-  1337905,
-  1211479,
-  1514510,
-  929193,
-  899790,
-  1089219,
-  753806,
-  1122606,
-  643689,
-  360340,
-  1458130,
-  1458131,
-  759600,
-  218560,
-  445200,
-  1478094,
-  1478091,
-  1478090,
-  1478092,
-  1478096,
-  1478095,
-  1478093,
-  611370,
-  1524760,
-  1522240,
-  1519960,
-  456200,
-  277754,
-  311161,
-  614870,
-  1520400,
-  1505580,
-  379560,
-  531157,
-  1186240,
-  1186245,
-  1186244,
-  1186243,
-  1186242,
-  1186241,
-  1186239,
-  1186238,
-  1186237,
-  1186236,
-  1186235,
-  1186234,
-  1186233,
-  1186232,
-  1186231,
-  1186230,
-  1211174,
-  896744,
-  1498150,
-  445690,
-  1380040,
-  297791,
-  1514790,
-  1514320,
-  1490070,
-  1490080,
-  1490090,
-  1440190,
-  1515910,
-  1515911,
-  222602,
-  944820,
-  853180,
-  1046100,
-  277731,
-  967282,
-  1400540,
-  592830,
-  294970,
-  1517730,
-  1517740,
-  1517790,
-  1517631,
-  1517632,
-  643730,
-  1515670,
-  1507450,
-  435960,
-  1514110,
-  434633,
-  1502390,
-  650900,
-  646800,
-  1010020,
-  1277700,
-  1277690,
-  1147650,
-  485020,
-  1453630,
-  784930,
-  826080,
-  1396560,
-  1510120,
-  1506070,
-  1396550,
-  434631,
-  434630,
-  389421,
-  1158120,
-  1226222,
-  1226220,
-  1383803,
-  1527860,
-  1092860,
-  209343,
-  55113,
-  55114,
-  230010,
-  219130,
-  219131,
-  219133,
-  219134,
-  219135,
-  206743,
-  206744,
-  206745,
-  206746,
-  206747,
-  206748,
-  206749,
-  206750,
-  206751,
-  206752,
-  206753,
-  1516930,
-  1338370,
-  454790,
-  271381,
-  271382,
-  271383,
-  271384,
-  271385,
-  271386,
-  1315872,
-  73018,
-  318010,
-  1496660,
-  1496661,
-  428650,
-  206711,
-  476580,
-  957122,
-  516400,
-  1506240,
-  1501060,
-  1406310,
-  1406320,
-  924151,
-  343010,
-  336170,
-  797510,
-  1232041,
-  1230451,
-  1232040,
-  980620,
-  1237600,
-  944930,
-  1371404,
-  1020290,
-  1126620,
-  1126610,
-  820201,
-  405170,
-  1504680,
-  1361370,
-  1075840,
-  322070,
-  798430,
-  226998,
-  930370,
-  937110,
-  912350,
-  912340,
-  1517710,
-  1448582,
-  1505870,
-  284500,
-  763692,
-  219098,
-  319010,
-  1246032,
-  1212540,
-  1159130,
-  359495,
-  1514870,
-  1054670,
-  1512222,
-  1521740,
-  688960,
-  1524260,
-  999970,
-  999980,
-  999950,
-  999960,
-  907150,
-  898110,
-  866290,
-  775600,
-  400950,
-  1147300,
-  1389960,
-  1393140,
-  1409960,
-  1495180,
-  359491,
-  1515960,
-  1506310,
-  1499510,
-  1258690,
-  1249000,
-  1518340,
-  1246192,
-  706180,
-  670840,
-  675280,
-  1517630,
-  1517720,
-  1517780,
-  941080,
-  591520,
-  391470,
-  356970,
-  1366410,
-  1241289,
-  1522290,
-  1183621,
-  1125220,
-  1089560,
-  1080810,
-  339810,
-  1460463,
-  1211477,
-  374850,
-  702960,
-  1519270,
-  1236650,
-  925621,
-  747180,
-  1520100,
-  1209560,
-  1142640,
-  1464311,
-  348760,
-  779180,
-  465610,
-  1517200,
-  1004914,
-  1251640,
-  1365120,
-  1365090,
-  1211171,
-  1287058,
-  1500080,
-  258640,
-  631041,
-  610051,
-  499590,
-  1517201,
-  1517202,
-  1517203,
-  845340,
-  1520430,
-  1268050,
-  1499040,
-  1500950,
-  1400800,
-  1400810,
-  1518470,
-  1400780,
-  1499100,
-  1518450,
-  1482220,
-  1293870,
-  1472720,
-  1510850,
-  1419952,
-  1406660,
-  1406600,
-  1514600,
-  1510200,
-  1141110,
-  998380,
-  255050,
-  1246185,
-  1076092,
-  1056626,
-  311164,
-  1264110,
-  1460361,
-  1460350,
-  1460360,
-  535310,
-  1392710,
-  626491,
-  1000140,
-  1058960,
-  208307,
-  1047690,
-  476040,
-  268560,
-  1088485,
-  1515050,
-  763699,
-  762914,
-  762915,
-  762916,
-  735300,
-  1510940,
-  288850,
-  404281,
-  707330,
-  1514630,
-  65218,
-  244610,
-  957914,
-  326622,
-  1220421,
-  50145,
-  1284490,
-  500241,
-  1516840,
-  1203482,
-  1202940,
-  1202941,
-  1203480,
-  1203481,
-  65243,
-  1432152,
-  1503770,
-  1503771,
-  1508480,
-  1503740,
-  1429755,
-  1516700,
-  888770,
-  807630,
-  1346080,
-  446860,
-  57925,
-  694390,
-  1458030,
-  1419450,
-  1495890,
-  1503650,
-  925580,
-  1481920,
-  1506220,
-  1424440,
-  1495740,
-  1430960,
-  1410130,
-  1343980,
-  1464640,
-  1496440,
-  1496520,
-  1108070,
-  1486360,
-  517831,
-  1509240,
-  1501660,
-  1515120,
-  1495160,
-  988180,
-  818250,
-  490320,
-  464980,
-  564840,
-  899450,
-  519040,
-  753040,
-  605650,
-  451040,
-  665580,
-  1151111,
-  398915,
-  705990,
-  665100,
-  1088498,
-  569410,
-  432670,
-  978810,
-  1098580,
-  1038710,
-  953350,
-  1234780,
-  1117060,
-  1513850,
-  1092640,
-  1010137,
-  210113,
-  1460680,
-  580051,
-  1501681,
-  1501680,
-  1432190,
-  987500,
-  841164,
-  1478460,
-  1478461,
-  735000,
-  630500,
-  570310,
-  935513,
-  1460500,
-  1448581,
-  1214550,
-  1214557,
-  1214556,
-  1214551,
-  1214554,
-  1214555,
-  1214553,
-  1214552,
-  272770,
-  1012100,
-  1173190,
-  1492560,
-  348690,
-  562381,
-  1423251,
-  1423243,
-  1423246,
-  321700,
-  1019110,
-  1048770,
-  888430,
-  924210,
-  1246191,
-  810600,
-  638550,
-  1423248,
-  1423249,
-  1423250,
-  571850,
-  1039700,
-  1039730,
-  1134620,
-  1055790,
-  1039680,
-  1185260,
-  1039720,
-  1039670,
-  1039640,
-  1043820,
-  1123760,
-  1086190,
-  1102450,
-  978000,
-  370370,
-  1506650,
-  1423241,
-  1423244,
-  1423247,
-  1450540,
-  1504590,
-  373550,
-  373551,
-  374352,
-  374353,
-  374354,
-  374355,
-  1394980,
-  1510970,
-  1510980,
-  1042730,
-  1507920,
-  1353750,
-  1511170,
-  822080,
-  455470,
-  796740,
-  228421,
-  804170,
-  796750,
-  450130,
-  804180,
-  73054,
-  744836,
-  700047,
-  1316263,
-  296103,
-  700081,
-  639434,
-  1398770,
-  1441870,
-  1121090,
-  57697,
-  487130,
-  1505293,
-  1505298,
-  1419713,
-  969030,
-  969040,
-  969041,
-  969042,
-  969043,
-  969044,
-  969045,
-  971491,
-  686401,
-  686402,
-  686403,
-  686404,
-  686405,
-  686410,
-  686390,
-  686400,
-  571760,
-  571761,
-  547570,
-  1505931,
-  1505932,
-  1505930,
-  450810,
-  450812,
-  534990,
-  382910,
-  497170,
-  401590,
-  523980,
-  382210,
-  457190,
-  1456480,
-  1333390,
-  1299090,
-  222575,
-  397120,
-  1460461,
-  1460460,
-  1316110,
-  1456660,
-  943730,
-  1390940,
-  523510,
-  204310,
-  1416990,
-  523511,
-  887580,
-  845930,
-  698690,
-  379558,
-  1369530,
-  406140,
-  1431711,
-  1130850,
-  990650,
-  938030,
-  1226500,
-  953450,
-  1426640,
-  1493330,
-  347211,
-  678005,
-  325956,
-  817550,
-  370580,
-  216331,
-  205634,
-  205635,
-  205637,
-  205638,
-  57695,
-  57696,
-  18508,
-  18509,
-  1000200,
-  216413,
-  216414,
-  216421,
-  216411,
-  937790,
-  937791,
-  937792,
-  1368390,
-  222021,
-  1432641,
-  1486780,
-  549070,
-  654187,
-  414390,
-  588961,
-  1455982,
-  1453590,
-  1453610,
-  1215050,
-  1246030,
-  1190570,
-  1190580,
-  1262550,
-  1299190,
-  982130,
-  1035150,
-  289734,
-  595940,
-  889000,
-  1046180,
-  1504170,
-  1496300,
-  1423245,
-  1423240,
-  1392500,
-  954603,
-  1501010,
-  1423242,
-  1493010,
-  1493030,
-  1493031,
-  1447620,
-  937400,
-  1495590,
-  1505890,
-  962000,
-  610693,
-  256504,
-  376972,
-  1504750,
-  1504370,
-  808932,
-  869390,
-  1484310,
-  215258,
-  891820,
-  1505950,
-  1168330,
-  1162490,
-  1168450,
-  1168440,
-  1496370,
-  1496070,
-  1110810,
-  1468700,
-  1429810,
-  1499790,
-  1057670,
-  1328421,
-  564440,
-  616950,
-  1489180,
-  1432129,
-  1432180,
-  1432181,
-  1432182,
-  1282300,
-  1505290,
-  1505292,
-  1505297,
-  1505299,
-  1505300,
-  1504641,
-  1502150,
-  576930,
-  1500430,
-  1454120,
-  1500431,
-  1494300,
-  1483520,
-  662290,
-  1461670,
-  361530,
-  1054780,
-  1498950,
-  1498960,
-  1211530,
-  920981,
-  704410,
-  1052610,
-  1052620,
-  639437,
-  328700,
-  1451400,
-  1466980,
-  1399810,
-  492690,
-  1212817,
-  562384,
-  1193871,
-  1291880,
-  1291881,
-  1291882,
-  1291883,
-  1291884,
-  1419712,
-  1486400,
-  723440,
-  325080,
-  437590,
-  267787,
-  793547,
-  457162,
-  715940,
-  1118120,
-  780140,
-  1110930,
-  1378241,
-  623010,
-  65254,
-  926650,
-  1458089,
-  1458083,
-  1458081,
-  1458085,
-  1458080,
-  1458084,
-  1458086,
-  1458087,
-  1458088,
-  32472,
-  878630,
-  1471930,
-  1337090,
-  318520,
-  1262300,
-  1341530,
-  1341531,
-  1486160,
-  1457053,
-  1496200,
-  1271880,
-  1365060,
-  1080910,
-  214931,
-  1393470,
-  1475870,
-  1475880,
-  1289390,
-  1055440,
-  1365070,
-  1365050,
-  1365110,
-  797220,
-  1231660,
-  1459120,
-  1493011,
-  1493032,
-  1493033,
-  1493190,
-  397125,
-  1149270,
-  684630,
-  1497340,
-  1432128,
-  1432176,
-  1432177,
-  1432178,
-  1496280,
-  1026800,
-  1022720,
-  1441871,
-  1441873,
-  1441876,
-  1012621,
-  1467051,
-  1467050,
-  1496910,
-  1464880,
-  1100740,
-  1100741,
-  382870,
-  1269220,
-  1463496,
-  1463497,
-  1463494,
-  1463495,
-  1442640,
-  1100796,
-  1100797,
-  1100792,
-  1100793,
-  1100794,
-  1100795,
-  1100790,
-  1100791,
-  1100785,
-  1100787,
-  1100788,
-  1100789,
-  1100780,
-  1100781,
-  1100782,
-  1100783,
-  1100784,
-  1498030,
-  1500680,
-  1500670,
-  1482120,
-  1495730,
-  258860,
-  1022350,
-  481172,
-  1329230,
-  704180,
-  1500900,
-  1461270,
-  1471010,
-  1501710,
-  1500673,
-  1500672,
-  1500671,
-  1499270,
-  1495330,
-  1354050,
-  753284,
-  553770,
-  1435130,
-  1435120,
-  1390950,
-  1390930,
-  699200,
-  1246190,
-  323341,
-  1040042,
-  1500690,
-  1279252,
-  1279291,
-  1281910,
-  1258700,
-  1279290,
-  1432643,
-  1125260,
-  1150050,
-  1312040,
-  1463592,
-  1487910,
-  1338960,
-  1338961,
-  1338962,
-  1008810,
-  1496911,
-  1278477,
-  800341,
-  800342,
-  970020,
-  599050,
-  1312980,
-  1428110,
-  400842,
-  1392120,
-  277842,
-  326760,
-  1392271,
-  1088492,
-  1492340,
-  952570,
-  1123920,
-  1286510,
-  695370,
-  1450260,
-  1465431,
-  1465432,
-  1465430,
-  227662,
-  1453210,
-  1054921,
-  1419951,
-  1448280,
-  1036020,
-  1038040,
-  1281900,
-  1497920,
-  1497930,
-  1415980,
-  1493034,
-  1493035,
-  1495810,
-  834401,
-  1496700,
-  1496701,
-  1483740,
-  1432126,
-  1432127,
-  1432174,
-  1432175,
-  1438180,
-  1497220,
-  353830,
-  429450,
-  1491450,
-  675390,
-  1369290,
-  1484500,
-  1369250,
-  1496950,
-  1482290,
-  1409721,
-  411911,
-  555530,
-  555532,
-  685080,
-  813900,
-  549200,
-  1418400,
-  918970,
-  602620,
-  602621,
-  1279251,
-  1279250,
-  1497090,
-  359780,
-  1492690,
-  733970,
-  238991,
-  1364111,
-  1364110,
-  1338963,
-  1338964,
-  24449,
-  24440,
-  24441,
-  342784,
-  637696,
-  899840,
-  509696,
-  390400,
-  342785,
-  294913,
-  637697,
-  899841,
-  509697,
-  390401,
-  342786,
-  294914,
-  637698,
-  899842,
-  509698,
-  390402,
-  342787,
-  294915,
-  637699,
-  899843,
-  509699,
-  390403,
-  342788,
-  294916,
-  637700,
-  899844,
-  509700,
-  390404,
-  294917,
-  637701,
-  899845,
-  509701,
-  390405,
-  342790,
-  637702,
-  899846,
-  509702,
-  390406,
-  342791,
-  294919,
-  637703,
-  899847,
-  390407,
-  342792,
-  294920,
-  637704,
-  899848,
-  509704,
-  390408,
-  342793,
-  294921,
-  637705,
-  899849,
-  509705,
-  390409,
-  342794,
-  294922,
-  637706,
-  899850,
-  509706,
-  390410,
-  342795,
-  294923,
-  637707,
-  509707,
-  294924,
-  637708,
-  509708,
-  390412,
-  294925,
-  637709,
-  509709,
-  390413,
-  294926,
-  637710,
-  509710,
-  390414,
-  294927,
-  637711,
-  509711,
-  390415,
-  294928,
-  637712,
-  509712,
-  390416,
-  342801,
-  294929,
-  637713,
-  509713,
-  390417,
-  342802,
-  294930,
-  637714,
-  509714,
-  390418,
-  342803,
-  294931,
-  637715,
-  509715,
-  390419,
-  342804,
-  294932,
-  637716,
-  509716,
-  390420,
-  342805,
-  637717,
-  509717,
-  342806,
-  294934,
-  637718,
-  509718,
-  390422,
-  342807,
-  294935,
-  637719,
-  509719,
-  342808,
-  294936,
-  637720,
-  509720,
-  390424,
-  342809,
-  294937,
-  637721,
-  509721,
-  390425,
-  342810,
-  294938,
-  637722,
-  509722,
-  390426,
-  637723,
-  509723,
-  390427,
-  342812,
-  294940,
-  637724,
-  509724,
-  390428,
-  342813,
-  294941,
-  637725,
-  509725,
-  390429,
-  342814,
-  294942,
-  637726,
-  509726,
-  342815,
-  294943,
-  637727,
-  509727,
-  342816,
-  294944,
-  637728,
-  509728,
-  342817,
-  294945,
-  637729,
-  509729,
-  342818,
-  294946,
-  637730,
-  509730,
-  342819,
-  294947,
-  637731,
-  509731,
-  342820,
-  637732,
-  509732,
-  637733,
-  509733,
-  258341,
-  342822,
-  637734,
-  509734,
-  258342,
-  342823,
-  637735,
-  509735,
-  258343,
-  342824,
-  637736,
-  509736,
-  258344,
-  390440,
-  294953,
-  637737,
-  509737,
-  258345,
-  390441,
-  342826,
-  294954,
-  637738,
-  509738,
-  258346,
-  390442,
-  342827,
-  294955,
-  637739,
-  509739,
-  258347,
-  390443,
-  342828,
-  294956,
-  637740,
-  509740,
-  258348,
-  390444,
-  342829,
-  637741,
-  509741,
-  258349,
-  390445,
-  342830,
-  294958,
-  637742,
-  509742,
-  258350,
-  390446,
-  294959,
-  637743,
-  509743,
-  258351,
-  390447,
-  294960,
-  637744,
-  509744,
-  258352,
-  390448,
-  294961,
-  637745,
-  509745,
-  390449,
-  294962,
-  637746,
-  509746,
-  258354,
-  390450,
-  294963,
-  637747,
-  509747,
-  258355,
-  342836,
-  294964,
-  899892,
-  509748,
-  258356,
-  390452,
-  342837,
-  294965,
-  637749,
-  509749,
-  390453,
-  342838,
-  294966,
-  637750,
-  390454,
-  342839,
-  294967,
-  637751,
-  271416,
-  342840,
-  294968,
-  637752,
-  390456,
-  271417,
-  342841,
-  294969,
-  637753,
-  390457,
-  271418,
-  342842,
-  637754,
-  390458,
-  271419,
-  342843,
-  637755,
-  390459,
-  342844,
-  294972,
-  637756,
-  258364,
-  294973,
-  637757,
-  258365,
-  271422,
-  342846,
-  294974,
-  637758,
-  258366,
-  271423,
-  342847,
-  294975,
-  637759,
-  271424,
-  342848,
-  294976,
-  637760,
-  342849,
-  637761,
-  258369,
-  342850,
-  294978,
-  637762,
-  258370,
-  294979,
-  637763,
-  342852,
-  294980,
-  258372,
-  342853,
-  637765,
-  258373,
-  342854,
-  294982,
-  637766,
-  258374,
-  342855,
-  294983,
-  637767,
-  258375,
-  271432,
-  342856,
-  294984,
-  637768,
-  258376,
-  271433,
-  342857,
-  637769,
-  258377,
-  637770,
-  342859,
-  637771,
-  753740,
-  637772,
-  753741,
-  637773,
-  271438,
-  753742,
-  637774,
-  753743,
-  637775,
-  271440,
-  294992,
-  753744,
-  637776,
-  258384,
-  271441,
-  294993,
-  753745,
-  637777,
-  258385,
-  271442,
-  294994,
-  753746,
-  637778,
-  258386,
-  271443,
-  294995,
-  753747,
-  637779,
-  294996,
-  753748,
-  637780,
-  271445,
-  294997,
-  753749,
-  637781,
-  271446,
-  294998,
-  753750,
-  637782,
-  271447,
-  294999,
-  753751,
-  637783,
-  271448,
-  295000,
-  753752,
-  637784,
-  258392,
-  271449,
-  295001,
-  753753,
-  637785,
-  258393,
-  590170,
-  271450,
-  295002,
-  753754,
-  436570,
-  637786,
-  258394,
-  590171,
-  271451,
-  295003,
-  753755,
-  637787,
-  258395,
-  590172,
-  271452,
-  295004,
-  753756,
-  637788,
-  258396,
-  590173,
-  271453,
-  753757,
-  436573,
-  637789,
-  590174,
-  271454,
-  295006,
-  753758,
-  436574,
-  637790,
-  258398,
-  590175,
-  271455,
-  295007,
-  753759,
-  436575,
-  637791,
-  258399,
-  590176,
-  271456,
-  295008,
-  753760,
-  369760,
-  436576,
-  637792,
-  258400,
-  590177,
-  271457,
-  295009,
-  753761,
-  369761,
-  436577,
-  637793,
-  590178,
-  295010,
-  753762,
-  436578,
-  637794,
-  258402,
-  590179,
-  295011,
-  753763,
-  369763,
-  436579,
-  637795,
-  258403,
-  590180,
-  295012,
-  753764,
-  369764,
-  436580,
-  637796,
-  258404,
-  590181,
-  295013,
-  753765,
-  369765,
-  436581,
-  637797,
-  258405,
-  590182,
-  295014,
-  753766,
-  369766,
-  436582,
-  637798,
-  258406,
-  590183,
-  295015,
-  753767,
-  436583,
-  637799,
-  590184,
-  271464,
-  295016,
-  753768,
-  369768,
-  637800,
-  258408,
-  590185,
-  271465,
-  753769,
-  369769,
-  436585,
-  637801,
-  258409,
-  590186,
-  271466,
-  753770,
-  369770,
-  436586,
-  637802,
-  258410,
-  590187,
-  271467,
-  753771,
-  637803,
-  258411,
-  590188,
-  271468,
-  753772,
-  369772,
-  637804,
-  258412,
-  590189,
-  753773,
-  369773,
-  436589,
-  637805,
-  258413,
-  590190,
-  295022,
-  753774,
-  369774,
-  436590,
-  637806,
-  258414,
-  590191,
-  753775,
-  369775,
-  436591,
-  637807,
-  258415,
-  590192,
-  295024,
-  753776,
-  369776,
-  436592,
-  637808,
-  258416,
-  590193,
-  295025,
-  753777,
-  369777,
-  637809,
-  258417,
-  590194,
-  295026,
-  753778,
-  369778,
-  436594,
-  637810,
-  258418,
-  590195,
-  271475,
-  295027,
-  753779,
-  369779,
-  436595,
-  637811,
-  590196,
-  271476,
-  295028,
-  753780,
-  369780,
-  436596,
-  637812,
-  590197,
-  271477,
-  295029,
-  753781,
-  637813,
-  590198,
-  295030,
-  753782,
-  369782,
-  637814,
-  590199,
-  295031,
-  753783,
-  369783,
-  637815,
-  590200,
-  271480,
-  753784,
-  369784,
-  637816,
-  590201,
-  271481,
-  295033,
-  753785,
-  369785,
-  637817,
-  590202,
-  295034,
-  753786,
-  369786,
-  637818,
-  590203,
-  295035,
-  753787,
-  369787,
-  637819,
-  590204,
-  295036,
-  753788,
-  369788,
-  436604,
-  637820,
-  590205,
-  295037,
-  753789,
-  369789,
-  436605,
-  637821,
-  590206,
-  295038,
-  753790,
-  369790,
-  436606,
-  637822,
-  590207,
-  295039,
-  753791,
-  369791,
-  637823,
-  590208,
-  295040,
-  753792,
-  369792,
-  436608,
-  637824,
-  590209,
-  295041,
-  753793,
-  436609,
-  637825,
-  590210,
-  295042,
-  753794,
-  369794,
-  436610,
-  637826,
-  590211,
-  295043,
-  753795,
-  369795,
-  637827,
-  590212,
-  753796,
-  369796,
-  436612,
-  590213,
-  295045,
-  753797,
-  436613,
-  637829,
-  590214,
-  295046,
-  753798,
-  369798,
-  436614,
-  637830,
-  590215,
-  295047,
-  753799,
-  369799,
-  436615,
-  637831,
-  590216,
-  295048,
-  753800,
-  369800,
-  436616,
-  637832,
-  590217,
-  271497,
-  295049,
-  753801,
-  369801,
-  436617,
-  637833,
-  590218,
-  271498,
-  295050,
-  753802,
-  369802,
-  436618,
-  637834,
-  590219,
-  271499,
-  295051,
-  753803,
-  369803,
-  436619,
-  637835,
-  590220,
-  295052,
-  753804,
-  492940,
-  369804,
-  637836,
-  590221,
-  295053,
-  753805,
-  492941,
-  369805,
-  436621,
-  637837,
-  590222,
-  295054,
-  492942,
-  369806,
-  436622,
-  637838,
-  590223,
-  295055,
-  753807,
-  492943,
-  436623,
-  637839,
-  590224,
-  753808,
-  369808,
-  436624,
-  637840,
-  590225,
-  753809,
-  492945,
-  369809,
-  436625,
-  637841,
-  590226,
-  753810,
-  492946,
-  369810,
-  637842,
-  590227,
-  492947,
-  369811,
-  436627,
-  637843,
-  590228,
-  492948,
-  369812,
-  436628,
-  637844,
-  590229,
-  492949,
-  369813,
-  436629,
-  637845,
-  590230,
-  492950,
-  369814,
-  637846,
-  590231,
-  295063,
-  753815,
-  492951,
-  436631,
-  637847,
-  590232,
-  753816,
-  492952,
-  369816,
-  436632,
-  637848,
-  590233,
-  295065,
-  753817,
-  492953,
-  369817,
-  436633,
-  590234,
-  295066,
-  753818,
-  369818,
-  590235,
-  295067,
-  753819,
-  369819,
-  436635,
-  590236,
-  753820,
-  492956,
-  369820,
-  436636,
-  590237,
-  753821,
-  369821,
-  436637,
-  590238,
-  753822,
-  492958,
-  369822,
-  436638,
-  590239,
-  753823,
-  492959,
-  369823,
-  436639,
-  590240,
-  753824,
-  492960,
-  369824,
-  590241,
-  753825,
-  492961,
-  369825,
-  436641,
-  590242,
-  753826,
-  492962,
-  369826,
-  436642,
-  590243,
-  753827,
-  492963,
-  436643,
-  590244,
-  753828,
-  492964,
-  369828,
-  436644,
-  590245,
-  753829,
-  492965,
-  369829,
-  436645,
-  590246,
-  753830,
-  492966,
-  590247,
-  753831,
-  590248,
-  753832,
-  492968,
-  436648,
-  590249,
-  753833,
-  492969,
-  436649,
-  753834,
-  492970,
-  753835,
-  492971,
-  436651,
-  753836,
-  492972,
-  436652,
-  436653,
-  492974,
-  436654,
-  295087,
-  248751,
-  295088,
-  492976,
-  436656,
-  248752,
-  295089,
-  492977,
-  248753,
-  295090,
-  753842,
-  492978,
-  436658,
-  248754,
-  295091,
-  753843,
-  492979,
-  248755,
-  295092,
-  753844,
-  492980,
-  436660,
-  248756,
-  753845,
-  436661,
-  248757,
-  295094,
-  753846,
-  492982,
-  436662,
-  295095,
-  753847,
-  492983,
-  436663,
-  295096,
-  753848,
-  492984,
-  295097,
-  753849,
-  436665,
-  295098,
-  753850,
-  492986,
-  436666,
-  295099,
-  753851,
-  492987,
-  436667,
-  753852,
-  492988,
-  753853,
-  492989,
-  436669,
-  753854,
-  509630,
-  753855,
-  509631,
-  753856,
-  753857,
-  509633,
-  753858,
-  509634,
-  753859,
-  509635,
-  753860,
-  509636,
-  753861,
-  899781,
-  509637,
-  753862,
-  899782,
-  509638,
-  753863,
-  899783,
-  509639,
-  753864,
-  899784,
-  509640,
-  753865,
-  899785,
-  509641,
-  753866,
-  899786,
-  509642,
-  753867,
-  899787,
-  509643,
-  753868,
-  899788,
-  509644,
-  753869,
-  899789,
-  509645,
-  753870,
-  509646,
-  753871,
-  899791,
-  509647,
-  753872,
-  899792,
-  509648,
-  753873,
-  899793,
-  509649,
-  753874,
-  899794,
-  509650,
-  753875,
-  899795,
-  509651,
-  753876,
-  899796,
-  509652,
-  753877,
-  899797,
-  509653,
-  753878,
-  899798,
-  509654,
-  753879,
-  899799,
-  509655,
-  753880,
-  899800,
-  509656,
-  390360,
-  753881,
-  899801,
-  509657,
-  753882,
-  899802,
-  509658,
-  390362,
-  753883,
-  899803,
-  509659,
-  390363,
-  753884,
-  899804,
-  509660,
-  390364,
-  753885,
-  899805,
-  509661,
-  342750,
-  753886,
-  899806,
-  509662,
-  390366,
-  342751,
-  753887,
-  899807,
-  509663,
-  390367,
-  342752,
-  753888,
-  899808,
-  509664,
-  390368,
-  342753,
-  753889,
-  899809,
-  509665,
-  342754,
-  753890,
-  899810,
-  509666,
-  342755,
-  753891,
-  899811,
-  509667,
-  342756,
-  753892,
-  899812,
-  509668,
-  342757,
-  753893,
-  899813,
-  509669,
-  342758,
-  753894,
-  899814,
-  509670,
-  390374,
-  342759,
-  753895,
-  899815,
-  509671,
-  390375,
-  342760,
-  753896,
-  899816,
-  509672,
-  390376,
-  342761,
-  899817,
-  509673,
-  390377,
-  342762,
-  899818,
-  509674,
-  390378,
-  342763,
-  899819,
-  390379,
-  342764,
-  899820,
-  509676,
-  390380,
-  342765,
-  899821,
-  509677,
-  390381,
-  342766,
-  899822,
-  509678,
-  390382,
-  342767,
-  899823,
-  509679,
-  342768,
-  899824,
-  509680,
-  390384,
-  342769,
-  899825,
-  509681,
-  390385,
-  342770,
-  899826,
-  509682,
-  390386,
-  342771,
-  899827,
-  509683,
-  390387,
-  342772,
-  899828,
-  509684,
-  390388,
-  342773,
-  899829,
-  509685,
-  390389,
-  342774,
-  899830,
-  509686,
-  390390,
-  899831,
-  509687,
-  390391,
-  342776,
-  899832,
-  509688,
-  390392,
-  342777,
-  899833,
-  509689,
-  390393,
-  342778,
-  637690,
-  899834,
-  509690,
-  390394,
-  637691,
-  899835,
-  509691,
-  390395,
-  342780,
-  637692,
-  899836,
-  509692,
-  390396,
-  342781,
-  294909,
-  637693,
-  899837,
-  509693,
-  390397,
-  342782,
-  294910,
-  637694,
-  899838,
-  509694,
-  390398,
-  342783,
-  294911,
-  637695,
-  899839,
-  509695,
-  390399,
-  1284690,
-  1485130,
-  298680,
-  1205530,
-  355600,
-  526612,
-  440860,
-  573880,
-  102842,
-  1136580,
-  1399510,
-  1399520,
-  573920,
-  553190,
-  1353521,
-  977610,
-  566890,
-  1470990,
-  1470950,
-  1409950,
-  803610,
-  113203,
-  113205,
-  368010,
-  1399490,
-  1399500,
-  339302,
-  339303,
-  1428860,
-  1490280,
-  823810,
-  1397150,
-  1315540,
-  1271350,
-  1486510,
-  1004130,
-  1427677,
-  1379740,
-  782230,
-  1375200,
-  1436970,
-  1484670,
-  1111170,
-  596821,
-  759230,
-  596822,
-  596820,
-  596823,
-  702414,
-  702413,
-  702411,
-  702415,
-  702410,
-  702412,
-  1118021,
-  1079880,
-  379561,
-  1196930,
-  399870,
-  983440,
-  1089300,
-  1010133,
-  1257830,
-  1371405,
-  367330,
-  222579,
-  1275990,
-  1453360,
-  1450710,
-  1453370,
-  1453380,
-  1432120,
-  1187541,
-  1187540,
-  337160,
-  202522,
-  1475130,
-  1475131,
-  1430891,
-  1430892,
-  1430893,
-  1430894,
-  1430896,
-  1430897,
-  1332686,
-  1430890,
-  1430895,
-  1482900,
-  1293893,
-  1457051,
-  1429750,
-  1485610,
-  750060,
-  1303310,
-  1303314,
-  1482632,
-  1337500,
-  809300,
-  695820,
-  1401860,
-  1295040,
-  332340,
-  1486460,
-  1486470,
-  1486471,
-  1486500,
-  1432125,
-  1432170,
-  1432171,
-  1432172,
-  1427220,
-  1427221,
-  766710,
-  766711,
-  766712,
-  539001,
-  438831,
-  646663,
-  646661,
-  646660,
-  1480760,
-  657420,
-  646662,
-  1034970,
-  950760,
-  1440700,
-  1013110,
-  325976,
-  24029,
-  1466760,
-  552680,
-  1287051,
-  325972,
-  1463492,
-  1463493,
-  1409802,
-  896549,
-  896545,
-  1142900,
-  1142910,
-  1142920,
-  1168130,
-  896790,
-  908224,
-  508772,
-  802030,
-  1086930,
-  639520,
-  473410,
-  959810,
-  1209680,
-  747863,
-  732280,
-  1451673,
-  1451678,
-  409760,
-  483280,
-  675570,
-  1477180,
-  1455950,
-  1479070,
-  1461170,
-  1407810,
-  1319590,
-  995810,
-  1457410,
-  1303311,
-  1475630,
-  414610,
-  1124910,
-  1246189,
-  948410,
-  948411,
-  654173,
-  388474,
-  820470,
-  1249310,
-  1207240,
-  1168131,
-  1433606,
-  1176820,
-  787670,
-  787671,
-  572190,
-  467970,
-  1349611,
-  453370,
-  1337904,
-  1353430,
-  1436176,
-  1436168,
-  1436169,
-  1436170,
-  1436171,
-  1436172,
-  1436173,
-  1436174,
-  1436175,
-  1436166,
-  1436167,
-  1436162,
-  1436163,
-  1436164,
-  1436165,
-  1436160,
-  1436161,
-  1342820,
-  1246810,
-  1435920,
-  1270480,
-  1109780,
-  25892,
-  25896,
-  25897,
-  42902,
-  42903,
-  42904,
-  42905,
-  214986,
-  1485290,
-  1485291,
-  1088740,
-  97108,
-  1247320,
-  963600,
-  960890,
-  1175220,
-  1175221,
-  1175223,
-  1471360,
-  361310,
-  356240,
-  297644,
-  503440,
-  325989,
-  1028970,
-  1032330,
-  1055220,
-  959816,
-  1283711,
-  747040,
-  741760,
-  646110,
-  612480,
-  408300,
-  771020,
-  962890,
-  1393591,
-  1436660,
-  1477690,
-  1400900,
-  931520,
-  363351,
-  363350,
-  360080,
-  98421,
-  1463580,
-  1463581,
-  1463590,
-  1463591,
-  1463660,
-  1463670,
-  1430580,
-  1304441,
-  336270,
-  1402620,
-  1191161,
-  1419711,
-  1461720,
-  1420074,
-  1420075,
-  1420076,
-  1463490,
-  49408,
-  312580,
-  97328,
-  266810,
-  49477,
-  49478,
-  49479,
-  267870,
-  213860,
-  215913,
-  215914,
-  215915,
-  215916,
-  215917,
-  215918,
-  215921,
-  215922,
-  214440,
-  214441,
-  214442,
-  265146,
-  265150,
-  219620,
-  219621,
-  324600,
-  49406,
-  49407,
-  1096850,
-  1178600,
-  1096860,
-  1178620,
-  1178630,
-  1178640,
-  1178660,
-  1178670,
-  1179950,
-  308300,
-  49427,
-  97312,
-  97320,
-  97324,
-  223852,
-  384240,
-  49443,
-  49442,
-  49441,
-  49440,
-  49439,
-  49438,
-  49437,
-  49436,
-  49435,
-  49434,
-  49433,
-  49432,
-  49431,
-  49430,
-  49429,
-  49428,
-  49425,
-  49426,
-  49422,
-  49423,
-  49424,
-  49421,
-  49419,
-  49418,
-  49417,
-  49416,
-  49415,
-  49414,
-  49413,
-  49412,
-  49411,
-  49410,
-  49409,
-  49404,
-  49403,
-  49402,
-  97389,
-  97388,
-  97387,
-  97386,
-  97385,
-  97384,
-  97383,
-  97382,
-  97381,
-  97380,
-  97379,
-  97378,
-  97377,
-  97376,
-  97375,
-  97374,
-  97373,
-  97372,
-  97371,
-  97370,
-  97369,
-  97368,
-  97367,
-  97366,
-  97365,
-  97364,
-  97363,
-  97361,
-  97362,
-  97360,
-  97350,
-  208830,
-  208831,
-  208832,
-  208833,
-  208834,
-  208835,
-  208836,
-  208837,
-  208838,
-  208839,
-  208840,
-  208843,
-  208841,
-  208842,
-  208844,
-  1467220,
-  265140,
-  265141,
-  265142,
-  265143,
-  265144,
-  265145,
-  326210,
-  1125050,
-  97327,
-  97326,
-  97325,
-  97323,
-  97322,
-  97321,
-  97319,
-  97318,
-  97317,
-  97316,
-  97301,
-  97300,
-  97302,
-  97303,
-  97304,
-  97305,
-  97306,
-  97307,
-  97308,
-  97309,
-  97310,
-  97311,
-  97313,
-  97314,
-  97315,
-  49499,
-  49498,
-  49496,
-  49495,
-  49494,
-  49493,
-  49492,
-  49490,
-  49491,
-  49476,
-  49475,
-  49474,
-  49473,
-  1394231,
-  1459610,
-  1309102,
-  1473440,
-  1473470,
-  1482350,
-  215911,
-  1403380,
-  1264112,
-  1291031,
-  1291030,
-  1404370,
-  1291032,
-  1264106,
-  1291033,
-  1291034,
-  1291038,
-  1291035,
-  1264104,
-  1291036,
-  1291037,
-  1264102,
-  1264105,
-  1264114,
-  1264101,
-  1264103,
-  1264113,
-  1474470,
-  1124670,
-  1264111,
-  213890,
-  213891,
-  213892,
-  213893,
-  213894,
-  213895,
-  213896,
-  213897,
-  213898,
-  213899,
-  213900,
-  213901,
-  213902,
-  213903,
-  213904,
-  213905,
-  213906,
-  213907,
-  213908,
-  213909,
-  215850,
-  215851,
-  215852,
-  215853,
-  215854,
-  215855,
-  215856,
-  215857,
-  215858,
-  215859,
-  215860,
-  215910,
-  215912,
-  215919,
-  215920,
-  215923,
-  215924,
-  219622,
-  219623,
-  219624,
-  219625,
-  219626,
-  219627,
-  219628,
-  219629,
-  226190,
-  226192,
-  226193,
-  226194,
-  226195,
-  226196,
-  226197,
-  226198,
-  1432123,
-  1432164,
-  1432165,
-  1432166,
-  1432124,
-  1432167,
-  1432168,
-  1432169,
-  25893,
-  1438770,
-  1436771,
-  1436770,
-  1436772,
-  1237527,
-  1416570,
-  1406620,
-  1406640,
-  1406650,
-  1364660,
-  1212900,
-  786460,
-  1476301,
-  1476300,
-  1433605,
-  1427590,
-  1433602,
-  1433607,
-  1433601,
-  1433604,
-  1433603,
-  1473710,
-  1427592,
-  1347611,
-  1441191,
-  1441192,
-  1441190,
-  1441193,
-  1395610,
-  770670,
-  722820,
-  1287061,
-  364328,
-  1477720,
-  1211176,
-  228750,
-  688700,
-  520360,
-  1216950,
-  757960,
-  1314550,
-  966700,
-  1420880,
-  1256590,
-  443620,
-  1474140,
-  1474141,
-  1474142,
-  1473080,
-  1348780,
-  301060,
-  216415,
-  216416,
-  216418,
-  338951,
-  1461290,
-  1461291,
-  1461293,
-  216153,
-  1166190,
-  1166191,
-  1166192,
-  1166194,
-  1166195,
-  1166196,
-  1166197,
-  1166198,
-  1166199,
-  630662,
-  1166220,
-  1166221,
-  1166222,
-  1166223,
-  1166224,
-  1166225,
-  1309103,
-  382450,
-  1475340,
-  1479580,
-  1457052,
-  1166193,
-  1479250,
-  939060,
-  1144490,
-  1444680,
-  1444690,
-  1463582,
-  1463593,
-  1463680,
-  1043010,
-  50147,
-  631690,
-  1466460,
-  1466470,
-  1466480,
-  896547,
-  1460370,
-  398913,
-  398916,
-  398917,
-  352560,
-  636500,
-  582540,
-  1474620,
-  1255400,
-  1255401,
-  1329262,
-  1192450,
-  609823,
-  325968,
-  1464510,
-  1281870,
-  1476120,
-  677940,
-  1309100,
-  891037,
-  1474610,
-  222622,
-  582576,
-  1430590,
-  1246760,
-  1329780,
-  1207450,
-  1127411,
-  1127412,
-  1477280,
-  1476810,
-  1469780,
-  1469900,
-  1457240,
-  1190220,
-  1078810,
-  799750,
-  352512,
-  526610,
-  526611,
-  536610,
-  525940,
-  462720,
-  275600,
-  340160,
-  447680,
-  447681,
-  801730,
-  447687,
-  365040,
-  891032,
-  1198840,
-  1198848,
-  1293030,
-  1198839,
-  1258152,
-  1198844,
-  1198847,
-  1258150,
-  1258154,
-  1258151,
-  1198845,
-  1198843,
-  1198846,
-  1213612,
-  1198831,
-  1198830,
-  331071,
-  1368360,
-  1144581,
-  1374732,
-  1450690,
-  789530,
-  891034,
-  732120,
-  1430881,
-  1430880,
-  960180,
-  1413390,
-  462600,
-  439890,
-  296440,
-  1262130,
-  514330,
-  381152,
-  1468673,
-  1468672,
-  1468670,
-  351550,
-  391433,
-  996820,
-  1472400,
-  1083890,
-  347150,
-  392880,
-  405360,
-  1317280,
-  899410,
-  200188,
-  1338700,
-  1459180,
-  1127300,
-  318791,
-  1267509,
-  1403920,
-  302280,
-  298980,
-  298986,
-  1473680,
-  1446490,
-  963311,
-  963312,
-  1222780,
-  1205796,
-  1224761,
-  1316184,
-  1224760,
-  1212813,
-  1134380,
-  1471072,
-  1471073,
-  1471074,
-  846720,
-  1364037,
-  1428024,
-  1428023,
-  1428022,
-  1428020,
-  1467940,
-  1428021,
-  1450430,
-  1473520,
-  1440761,
-  1081970,
-  1246188,
-  391680,
-  1036112,
-  584093,
-  1241275,
-  943720,
-  1466790,
-  1471070,
-  1471071,
-  1463594,
-  1463597,
-  998580,
-  1405840,
-  614680,
-  1465650,
-  1465651,
-  1463251,
-  1463261,
-  1463271,
-  1463220,
-  1463230,
-  1463241,
-  1454870,
-  1454871,
-  448189,
-  1312820,
-  1209640,
-  1193890,
-  1116940,
-  1202320,
-  1324670,
-  1304031,
-  1342712,
-  1342710,
-  1293891,
-  1293892,
-  1271370,
-  1358162,
-  1317980,
-  1282990,
-  1332680,
-  1332681,
-  1332682,
-  1332685,
-  1304030,
-  1342713,
-  390658,
-  390653,
-  1242742,
-  1242746,
-  1242745,
-  763698,
-  896580,
-  438802,
-  481120,
-  481170,
-  481171,
-  571360,
-  649330,
-  378645,
-  1463491,
-  257302,
-  982730,
-  468730,
-  222596,
-  376978,
-  418820,
-  413990,
-  413991,
-  423852,
-  423853,
-  392860,
-  1015980,
-  1059140,
-  849930,
-  723650,
-  458160,
-  459850,
-  459853,
-  1451140,
-  257300,
-  1392440,
-  448181,
-  711171,
-  481121,
-  1157540,
-  1210400,
-  588963,
-  202485,
-  1321370,
-  1464710,
-  1461440,
-  1458010,
-  1419460,
-  1452520,
-  1388040,
-  1390160,
-  1400790,
-  1312260,
-  1153190,
-  1197860,
-  578980,
-  1314761,
-  338661,
-  1002250,
-  1128040,
-  571361,
-  793750,
-  793536,
-  793537,
-  1469810,
-  1470260,
-  1470410,
-  1472350,
-  1432162,
-  1432163,
-  1432144,
-  1432145,
-  1432146,
-  1432147,
-  1432148,
-  1432149,
-  1432150,
-  1432151,
-  1432153,
-  1432154,
-  1432155,
-  1432156,
-  1432157,
-  1432158,
-  1432159,
-  1432160,
-  1432161,
-  1432121,
-  1432122,
-  1432140,
-  1432141,
-  1432142,
-  1432143,
-  1431160,
-  1421814,
-  801440,
-  10696,
-  1000180,
-  363170,
-  762171,
-  762170,
-  761599,
-  761598,
-  1008400,
-  1469730,
-  1468710,
-  1436460,
-  1253091,
-  1253090,
-  1232240,
-  1256890,
-  967420,
-  943123,
-  568990,
-  376391,
-  1420073,
-  1198410,
-  277762,
-  1216400,
-  494523,
-  751120,
-  1242756,
-  29700,
-  1281410,
-  1067340,
-  823301,
-  649920,
-  262230,
-  262142,
-  256500,
-  894500,
-  861880,
-  1249630,
-  1448101,
-  1319450,
-  1456790,
-  1318890,
-  1369456,
-  794140,
-  643731,
-  1455870,
-  611210,
-  898700,
-  978140,
-  1040640,
-  72840,
-  1457670,
-  457191,
-  526530,
-  407760,
-  1355130,
-  370001,
-  245190,
-  1457050,
-  455270,
-  1448430,
-  1249140,
-  1098164,
-  1444790,
-  492680,
-  1144580,
-  1303191,
-  1303197,
-  209813,
-  877130,
-  876550,
-  997253,
-  672530,
-  675930,
-  374870,
-  1371654,
-  580180,
-  1463583,
-  1463595,
-  1463596,
-  1463690,
-  328810,
-  1448420,
-  1427676,
-  1427675,
-  55383,
-  1168620,
-  1333177,
-  1333178,
-  1333179,
-  1333175,
-  1333176,
-  1356850,
-  214531,
-  1201050,
-  1080220,
-  1023670,
-  1195740,
-  476560,
-  257301,
-  1431870,
-  433520,
-  374810,
-  1454440,
-  770550,
-  204185,
-  1093040,
-  1457290,
-  1459380,
-  1388060,
-  1388020,
-  420828,
-  1429230,
-  1429240,
-  1453890,
-  283530,
-  1451521,
-  666231,
-  1458630,
-  1369000,
-  1451520,
-  1412300,
-  1173752,
-  410420,
-  693160,
-  1461940,
-  24094,
-  1421550,
-  72774,
-  1246187,
-  1454470,
-  1456510,
-  1456520,
-  744580,
-  648980,
-  1180510,
-  1210870,
-  955130,
-  1451130,
-  562379,
-  1464680,
-  1464681,
-  343595,
-  1031600,
-  965100,
-  1363910,
-  344463,
-  1089940,
-  1442100,
-  955240,
-  24021,
-  645040,
-  546880,
-  1029450,
-  1455320,
-  1192600,
-  373590,
-  1022590,
-  1263250,
-  271332,
-  641020,
-  317500,
-  219103,
-  1449460,
-  1167662,
-  1267593,
-  1375365,
-  1375367,
-  1375368,
-  1375369,
-  1048877,
-  1267591,
-  1099583,
-  1099580,
-  1267594,
-  1450450,
-  1028893,
-  277765,
-  817100,
-  1254175,
-  1062440,
-  1006973,
-  929191,
-  544831,
-  1294144,
-  1294142,
-  700870,
-  880880,
-  1451340,
-  1444203,
-  1444202,
-  1444201,
-  1444200,
-  979131,
-  1451070,
-  1433740,
-  1433583,
-  1272960,
-  1459970,
-  397124,
-  1225515,
-  420753,
-  420755,
-  420756,
-  1448480,
-  1457270,
-  1303605,
-  1419950,
-  1440830,
-  42900,
-  1420072,
-  1460390,
-  1455480,
-  1414170,
-  1452340,
-  846280,
-  1330410,
-  635300,
-  1409800,
-  754600,
-  793270,
-  1453980,
-  1333370,
-  1347790,
-  1418480,
-  884031,
-  503380,
-  1356730,
-  1356731,
-  1356732,
-  1356733,
-  1421553,
-  1421552,
-  896544,
-  1254580,
-  1254581,
-  1254582,
-  1293591,
-  1334810,
-  1112260,
-  1450560,
-  1453410,
-  1387880,
-  1388000,
-  435963,
-  1227610,
-  434632,
-  1315400,
-  1289920,
-  1280390,
-  1284060,
-  1307720,
-  588830,
-  929105,
-  1068290,
-  237090,
-  1330600,
-  1330602,
-  846860,
-  759680,
-  759681,
-  737250,
-  588580,
-  729420,
-  564321,
-  564323,
-  469810,
-  398520,
-  403790,
-  355390,
-  368520,
-  1431080,
-  1429860,
-  1457260,
-  1365650,
-  1384230,
-  1444100,
-  1452580,
-  1104070,
-  1450820,
-  1455690,
-  1455310,
-  1447460,
-  289880,
-  545020,
-  421771,
-  1071960,
-  1458410,
-  990830,
-  1204100,
-  368960,
-  1224866,
-  1224850,
-  1224856,
-  1224859,
-  254672,
-  824230,
-  1450140,
-  1427370,
-  1450040,
-  304000,
-  1422010,
-  1433760,
-  485321,
-  1445180,
-  1178800,
-  1455600,
-  1381791,
-  1324390,
-  865350,
-  1427010,
-  1315580,
-  1315550,
-  1315560,
-  1450840,
-  1433730,
-  872070,
-  481122,
-  1343250,
-  1433582,
-  1442810,
-  1304416,
-  1432460,
-  1405910,
-  1390620,
-  1429010,
-  1284680,
-  1072360,
-  1450440,
-  1437610,
-  1369453,
-  1004911,
-  1004912,
-  1004913,
-  1004915,
-  1004916,
-  1004918,
-  1315430,
-  1315431,
-  1315432,
-  1315433,
-  1315434,
-  1315435,
-  1315440,
-  1315441,
-  1315470,
-  1315471,
-  1315472,
-  1449930,
-  1203081,
-  606090,
-  1399020,
-  1408650,
-  1452610,
-  1419710,
-  555240,
-  379547,
-  403152,
-  1184910,
-  1180590,
-  1185790,
-  965370,
-  960620,
-  965280,
-  476940,
-  379546,
-  1446190,
-  1446240,
-  1448050,
-  1447040,
-  1410170,
-  1427170,
-  1427180,
-  1427190,
-  1384640,
-  896546,
-  793554,
-  1449340,
-  1208020,
-  425840,
-  831390,
-  836510,
-  1442811,
-  1415310,
-  1425910,
-  896548,
-  520550,
-  476862,
-  286990,
-  333700,
-  369720,
-  1400551,
-  1020570,
-  1020571,
-  1240750,
-  397126,
-  1408511,
-  368840,
-  646673,
-  1278474,
-  1278471,
-  1278472,
-  1278475,
-  1278476,
-  1278473,
-  1432540,
-  783990,
-  998500,
-  338470,
-  697350,
-  1303198,
-  1308680,
-  893310,
-  1446120,
-  1167520,
-  544830,
-  1441450,
-  1420470,
-  1352582,
-  884760,
-  311921,
-  1427000,
-  1364035,
-  1137530,
-  1137531,
-  1137532,
-  1137533,
-  1379300,
-  983930,
-  995650,
-  718130,
-  1371651,
-  1371650,
-  1371652,
-  572310,
-  1450010,
-  838680,
-  1433720,
-  1433581,
-  1357171,
-  1428510,
-  1352584,
-  1157732,
-  1157731,
-  1124541,
-  1007910,
-  1007580,
-  1357170,
-  1246186,
-  1435260,
-  1448680,
-  659930,
-  730720,
-  450090,
-  896543,
-  1208660,
-  1239130,
-  1445170,
-  1112971,
-  1314760,
-  1314762,
-  1314763,
-  1394232,
-  1394230,
-  963240,
-  237190,
-  1438730,
-  1282620,
-  1448700,
-  1445800,
-  1421915,
-  1421914,
-  1421913,
-  1421912,
-  1421911,
-  1421910,
-  1421898,
-  1421897,
-  1421896,
-  1421895,
-  1421894,
-  1421893,
-  1421892,
-  1421891,
-  1421890,
-  1421888,
-  1421887,
-  1421886,
-  1421885,
-  1421884,
-  1421883,
-  1421882,
-  1421881,
-  1421880,
-  1421878,
-  1421877,
-  1421876,
-  1421875,
-  1421874,
-  1421873,
-  1421872,
-  1421871,
-  1421870,
-  1421868,
-  1421867,
-  1421866,
-  1421865,
-  1421864,
-  1421863,
-  1421862,
-  1421861,
-  1421860,
-  1421859,
-  1421858,
-  1421857,
-  1421856,
-  1421855,
-  1421854,
-  1421853,
-  1421852,
-  1421851,
-  1421850,
-  1421849,
-  1421848,
-  1421847,
-  1421846,
-  1421845,
-  1421844,
-  1421843,
-  1421842,
-  1421841,
-  1421840,
-  1421839,
-  1421838,
-  1421837,
-  1421836,
-  1421835,
-  1421834,
-  1421833,
-  1421832,
-  1421831,
-  1421830,
-  1421813,
-  1421812,
-  1421811,
-  1421810,
-  1421809,
-  1421808,
-  1421807,
-  1421806,
-  1421803,
-  1421804,
-  1421805,
-  1421802,
-  1421801,
-  1421800,
-  1421788,
-  1421787,
-  1421786,
-  1421785,
-  1421784,
-  1421782,
-  1421783,
-  1421781,
-  1421780,
-  1405401,
-  1405400,
-  1443970,
-  1419420,
-  1439670,
-  1435340,
-  1382050,
-  1082355,
-  1082356,
-  1410940,
-  997470,
-  851990,
-  461200,
-  1400160,
-  1115600,
-  316542,
-  896780,
-  1443531,
-  1443530,
-  1443532,
-  1443533,
-  324330,
-  1420070,
-  1420071,
-  447220,
-  1431810,
-  331380,
-  1428120,
-  1424000,
-  1428121,
-  1388730,
-  854660,
-  1199080,
-  1301870,
-  939320,
-  388475,
-  222628,
-  322153,
-  1012203,
-  204308,
-  204311,
-  229752,
-  201966,
-  891630,
-  1345960,
-  222599,
-  73118,
-  983441,
-  1372980,
-  1117721,
-  292470,
-  271964,
-  1265470,
-  1407701,
-  451890,
-  400841,
-  400840,
-  862780,
-  1444140,
-  542830,
-  1437783,
-  1437782,
-  1437781,
-  1437784,
-  1437780,
-  1383802,
-  1332684,
-  1332683,
-  1342711,
-  1117010,
-  1433710,
-  1433580,
-  1378342,
-  1378195,
-  1323720,
-  1369451,
-  1369452,
-  1369454,
-  1369455,
-  1088780,
-  219104,
-  42723,
-  547660,
-  67350,
-  50140,
-  50141,
-  50142,
-  50143,
-  50144,
-  1431310,
-  1440760,
-  1363750,
-  1441150,
-  1431330,
-  765930,
-  1429270,
-  1414690,
-  1434290,
-  1416630,
-  1436360,
-  1415900,
-  1385490,
-  1407900,
-  1396400,
-  721320,
-  1438550,
-  1371407,
-  47426,
-  1436740,
-  316410,
-  853190,
-  1364661,
-  1364662,
-  1364663,
-  1364664,
-  1131050,
-  374792,
-  1426660,
-  1395950,
-  1281620,
-  1154630,
-  618661,
-  1217150,
-  1150370,
-  1205180,
-  1363450,
-  653720,
-  915620,
-  1337902,
-  259040,
-  1370790,
-  1356211,
-  1425933,
-  1425932,
-  1425931,
-  1425930,
-  315392,
-  1040950,
-  1402610,
-  1413750,
-  594184,
-  497740,
-  1238891,
-  334401,
-  964290,
-  1012202,
-  1438420,
-  1428930,
-  946820,
-  820450,
-  1287083,
-  1219440,
-  1419820,
-  1024810,
-  1214891,
-  1214892,
-  1214893,
-  1214894,
-  1214895,
-  1214896,
-  1214897,
-  1120250,
-  640350,
-  640610,
-  640630,
-  1414590,
-  1427360,
-  1205364,
-  362110,
-  821710,
-  633890,
-  650521,
-  1433600,
-  1405640,
-  1405543,
-  1405557,
-  578201,
-  578200,
-  450830,
-  1414450,
-  823261,
-  1351861,
-  1371420,
-  1371409,
-  1371401,
-  1371402,
-  1371425,
-  1371426,
-  1371428,
-  1371429,
-  1371421,
-  1371422,
-  1371423,
-  1371424,
-  762910,
-  1065500,
-  397490,
-  1411080,
-  1411100,
-  1411060,
-  1411070,
-  1428330,
-  1409850,
-  1409120,
-  1309690,
-  648690,
-  1386740,
-  1429560,
-  1435060,
-  984740,
-  666370,
-  1249810,
-  1389080,
-  1369450,
-  1206687,
-  629710,
-  1391080,
-  397123,
-  1423390,
-  1427230,
-  1422350,
-  1416590,
-  1417630,
-  1396670,
-  1419490,
-  1423440,
-  1396270,
-  1436180,
-  1206682,
-  380230,
-  1360333,
-  1360334,
-  1360335,
-  955181,
-  297790,
-  976531,
-  976530,
-  976520,
-  434062,
-  1233090,
-  399730,
-  807560,
-  1291781,
-  1092330,
-  1414353,
-  1414352,
-  1414351,
-  1414350,
-  906610,
-  695410,
-  1435452,
-  1435451,
-  1435450,
-  1096321,
-  536545,
-  468270,
-  374840,
-  1409580,
-  1411510,
-  1037890,
-  941967,
-  1145760,
-  813050,
-  686220,
-  930660,
-  670740,
-  1050710,
-  1427850,
-  488810,
-  765190,
-  770976,
-  1099620,
-  1073730,
-  565770,
-  512940,
-  598580,
-  1421370,
-  596760,
-  950500,
-  840640,
-  1382700,
-  370960,
-  258662,
-  272030,
-  363261,
-  277764,
-  1334270,
-  1431600,
-  1419900,
-  730631,
-  1419940,
-  1405540,
-  1405550,
-  1405551,
-  1392830,
-  1425520,
-  1397480,
-  663230,
-  1364032,
-  220825,
-  1381170,
-  339550,
-  1081920,
-  1061960,
-  286671,
-  489200,
-  526830,
-  465340,
-  1428250,
-  1224350,
-  1184661,
-  1184660,
-  1184650,
-  1183190,
-  1184651,
-  1215460,
-  1194858,
-  1168590,
-  1106242,
-  237617,
-  237616,
-  504270,
-  1279211,
-  1128350,
-  1419790,
-  1164950,
-  1068810,
-  1399820,
-  1399830,
-  1409870,
-  1408870,
-  1422320,
-  564830,
-  63398,
-  1307470,
-  1416620,
-  627580,
-  214937,
-  214936,
-  214935,
-  1287960,
-  1368930,
-  1368931,
-  1194859,
-  1337370,
-  356630,
-  1411390,
-  501580,
-  1146990,
-  1407020,
-  1403950,
-  763280,
-  1187170,
-  1210630,
-  1009130,
-  1113910,
-  1387310,
-  1374150,
-  1387850,
-  722550,
-  750370,
-  756430,
-  756431,
-  756432,
-  809620,
-  824060,
-  824061,
-  968670,
-  1208292,
-  588790,
-  1079710,
-  260960,
-  1385020,
-  920530,
-  1306050,
-  1298090,
-  1301490,
-  1304250,
-  1267730,
-  1056190,
-  1000160,
-  936710,
-  24075,
-  1419840,
-  1425040,
-  1207290,
-  1405030,
-  1203082,
-  1345500,
-  1396800,
-  1399010,
-  1345510,
-  1198163,
-  831920,
-  861881,
-  1285150,
-  1209621,
-  1209620,
-  25899,
-  1244490,
-  1084060,
-  435511,
-  435512,
-  1135970,
-  1258153,
-  1146030,
-  1143530,
-  451270,
-  1405541,
-  1405542,
-  1405552,
-  1405553,
-  1405630,
-  1414330,
-  1380090,
-  641010,
-  424580,
-  425190,
-  425200,
-  212753,
-  1418660,
-  1364051,
-  1364050,
-  1323941,
-  1323940,
-  862710,
-  1214230,
-  1343180,
-  1343181,
-  1343182,
-  997750,
-  1362223,
-  1422250,
-  1358461,
-  1358460,
-  1396780,
-  231456,
-  231461,
-  371840,
-  371841,
-  371842,
-  371845,
-  260311,
-  468040,
-  418900,
-  1349653,
-  1349660,
-  1349614,
-  974282,
-  1174480,
-  974281,
-  974280,
-  1400400,
-  1423770,
-  891301,
-  1423210,
-  1412830,
-  1422830,
-  1416740,
-  1417560,
-  1422170,
-  1412140,
-  1196792,
-  488992,
-  1273050,
-  1344192,
-  1387890,
-  1384610,
-  1412060,
-  202086,
-  202085,
-  781540,
-  409653,
-  1264450,
-  1349661,
-  1349652,
-  1349613,
-  1349663,
-  1349650,
-  1349616,
-  1349662,
-  1349651,
-  1349612,
-  919340,
-  816981,
-  427750,
-  915650,
-  780980,
-  214649,
-  1295350,
-  1108280,
-  599441,
-  556970,
-  1246184,
-  1084070,
-  1018890,
-  923151,
-  1164217,
-  1106073,
-  1261861,
-  1353990,
-  1284890,
-  1206640,
-  1318300,
-  1274410,
-  1401040,
-  222804,
-  841167,
-  1175090,
-  1246730,
-  996313,
-  589650,
-  364170,
-  289025,
-  1400770,
-  1294460,
-  563107,
-  861640,
-  1042792,
-  1042791,
-  1214900,
-  1214880,
-  339390,
-  324720,
-  1211170,
-  1022190,
-  917031,
-  916071,
-  388471,
-  918490,
-  876360,
-  1054330,
-  1267592,
-  464522,
-  1105830,
-  903260,
-  903261,
-  903262,
-  903263,
-  703441,
-  342330,
-  297793,
-  274123,
-  573850,
-  1094040,
-  739700,
-  1131340,
-  677990,
-  521840,
-  1354220,
-  1210200,
-  1282480,
-  1249920,
-  1242752,
-  1235752,
-  500219,
-  444120,
-  531131,
-  506800,
-  782090,
-  18522,
-  1295300,
-  1242753,
-  980592,
-  933610,
-  1379222,
-  762913,
-  734400,
-  1330150,
-  355300,
-  463740,
-  478033,
-  419472,
-  419470,
-  896620,
-  896630,
-  556470,
-  1359670,
-  1100130,
-  486002,
-  1051150,
-  754650,
-  888000,
-  675290,
-  359380,
-  1383180,
-  900540,
-  478032,
-  961590,
-  938460,
-  862760,
-  1389340,
-  1330720,
-  478031,
-  328171,
-  1267506,
-  1087590,
-  698250,
-  583140,
-  525010,
-  316447,
-  1417032,
-  1417031,
-  1417080,
-  1417030,
-  626522,
-  478030,
-  431621,
-  1265061,
-  1147155,
-  448185,
-  1047150,
-  369210,
-  1242759,
-  900530,
-  744840,
-  1069630,
-  634170,
-  1405990,
-  478048,
-  1176980,
-  1155430,
-  903245,
-  410790,
-  896540,
-  339770,
-  1211207,
-  1411960,
-  1413530,
-  310430,
-  1111360,
-  1070703,
-  855220,
-  855230,
-  855250,
-  855260,
-  855280,
-  591503,
-  577311,
-  521970,
-  425530,
-  973770,
-  798890,
-  491760,
-  1398610,
-  707480,
-  612491,
-  974301,
-  525183,
-  1094700,
-  988870,
-  1242754,
-  934200,
-  934300,
-  770951,
-  756181,
-  707184,
-  732791,
-  728462,
-  677690,
-  707170,
-  587510,
-  548830,
-  475010,
-  256611,
-  945483,
-  403930,
-  1184100,
-  1278300,
-  577350,
-  577351,
-  548820,
-  1405554,
-  1405555,
-  969770,
-  969771,
-  969772,
-  969773,
-  957601,
-  957602,
-  957603,
-  957604,
-  957605,
-  957607,
-  889614,
-  889620,
-  535970,
-  585640,
-  540380,
-  587500,
-  524630,
-  506460,
-  208371,
-  570480,
-  578280,
-  516330,
-  978740,
-  962040,
-  943820,
-  591495,
-  571290,
-  488998,
-  409652,
-  421163,
-  1420840,
-  1150192,
-  821620,
-  821630,
-  808900,
-  808903,
-  808902,
-  808901,
-  784330,
-  1303200,
-  1018670,
-  220285,
-  1279460,
-  271331,
-  461242,
-  388477,
-  234510,
-  352021,
-  1011950,
-  1010300,
-  1101110,
-  1080280,
-  210015,
-  210016,
-  210017,
-  210018,
-  210019,
-  256522,
-  235580,
-  1307590,
-  1254980,
-  1254990,
-  1254991,
-  1167020,
-  1167030,
-  1167040,
-  1167050,
-  207165,
-  1150840,
-  1150860,
-  1047770,
-  965780,
-  965781,
-  968900,
-  968901,
-  968902,
-  639080,
-  273680,
-  1412710,
-  200186,
-  1193410,
-  1183440,
-  1066830,
-  1071210,
-  1044260,
-  1385980,
-  1105350,
-  1046800,
-  1007060,
-  999530,
-  980370,
-  980390,
-  978858,
-  978859,
-  978860,
-  980400,
-  980410,
-  980420,
-  964930,
-  970930,
-  798860,
-  677370,
-  309940,
-  622350,
-  768120,
-  1316075,
-  392400,
-  1101890,
-  525036,
-  598930,
-  1318430,
-  1302810,
-  1269440,
-  1051910,
-  1036770,
-  1036771,
-  461244,
-  1267800,
-  1267801,
-  1235060,
-  1235080,
-  968880,
-  909330,
-  1272490,
-  1273053,
-  623890,
-  402680,
-  319011,
-  319013,
-  319014,
-  319015,
-  319016,
-  319017,
-  1087680,
-  1077980,
-  678009,
-  354466,
-  354464,
-  354465,
-  345040,
-  300860,
-  982200,
-  909340,
-  961570,
-  457196,
-  1362116,
-  600591,
-  600592,
-  1411110,
-  1382440,
-  1392990,
-  1393020,
-  1396860,
-  1392870,
-  1311860,
-  954730,
-  1401861,
-  1036470,
-  29620,
-  1101870,
-  1101830,
-  1101880,
-  1101810,
-  540330,
-  1287075,
-  517560,
-  1405556,
-  1286253,
-  1286256,
-  1286254,
-  1286251,
-  1286252,
-  1286255,
-  1286250,
-  1112970,
-  976050,
-  237810,
-  266931,
-  1368610,
-  1285880,
-  1247180,
-  1028070,
-  1241271,
-  315397,
-  1364970,
-  747900,
-  1409220,
-  1409222,
-  1409223,
-  1409224,
-  1409225,
-  1409226,
-  1409227,
-  1409229,
-  1409221,
-  1409228,
-  1408182,
-  1408183,
-  1408186,
-  1408187,
-  1408188,
-  1408189,
-  1408180,
-  1408184,
-  1408185,
-  1408181,
-  1405218,
-  1405219,
-  1405214,
-  1405215,
-  1405216,
-  1405212,
-  1405213,
-  1405217,
-  1405211,
-  1405210,
-  1188618,
-  1157380,
-  1157430,
-  1157440,
-  1157450,
-  1157460,
-  1157480,
-  1179330,
-  396960,
-  677640,
-  800450,
-  1287490,
-  940736,
-  688410,
-  464680,
-  329822,
-  740960,
-  457192,
-  304400,
-  643687,
-  1193390,
-  654172,
-  1082920,
-  421164,
-  358470,
-  42918,
-  873660,
-  997840,
-  789390,
-  533560,
-  1360332,
-  616060,
-  825470,
-  678186,
-  436571,
-  774931,
-  1232540,
-  457198,
-  800370,
-  460390,
-  1390590,
-  676151,
-  326390,
-  359480,
-  892250,
-  409191,
-  1237100,
-  592292,
-  1075101,
-  1246830,
-  1364030,
-  1009830,
-  1388620,
-  1187630,
-  1256090,
-  1182306,
-  1148640,
-  609970,
-  1219130,
-  1153680,
-  1372490,
-  792110,
-  1412330,
-  550461,
-  716580,
-  849931,
-  1216951,
-  1410520,
-  1348890,
-  952320,
-  1256780,
-  1393900,
-  1076014,
-  605280,
-  1357310,
-  1357311,
-  1357312,
-  1357313,
-  1411760,
-  645911,
-  478047,
-  1412350,
-  1378343,
-  1378196,
-  1378530,
-  643685,
-  1329760,
-  1329761,
-  1329770,
-  1309540,
-  1309541,
-  1319030,
-  1140992,
-  1140993,
-  1140994,
-  1140995,
-  1141000,
-  1141010,
-  1141011,
-  1141012,
-  1141013,
-  1141014,
-  1141015,
-  1131200,
-  1131201,
-  1140990,
-  1140991,
-  1056800,
-  202941,
-  98011,
-  562386,
-  957760,
-  957762,
-  957761,
-  1176670,
-  565323,
-  553074,
-  1366600,
-  856200,
-  1262591,
-  789080,
-  1292303,
-  1292304,
-  1292301,
-  1292302,
-  1050780,
-  457197,
-  1033474,
-  1394310,
-  1400280,
-  1362224,
-  1362222,
-  868680,
-  1329571,
-  812750,
-  1349490,
-  1393230,
-  1393250,
-  1067150,
-  498770,
-  1404900,
-  1404901,
-  1404910,
-  926590,
-  731240,
-  715920,
-  698280,
-  639570,
-  414010,
-  683060,
-  631320,
-  542330,
-  932990,
-  602812,
-  356980,
-  529030,
-  1351230,
-  1360323,
-  950060,
-  888830,
-  728463,
-  896760,
-  923290,
-  1031740,
-  650370,
-  585440,
-  1162204,
-  599910,
-  1412940,
-  1412930,
-  1155450,
-  1186877,
-  1381570,
-  1364521,
-  1351100,
-  1150195,
-  996300,
-  996350,
-  480530,
-  805970,
-  441270,
-  789392,
-  969471,
-  1088230,
-  1088220,
-  1088210,
-  1093000,
-  287530,
-  1392210,
-  1393000,
-  1391320,
-  1381340,
-  1144310,
-  208543,
-  421271,
-  622851,
-  614000,
-  1132200,
-  741030,
-  589140,
-  589141,
-  589142,
-  292710,
-  1376770,
-  1269221,
-  345670,
-  1342720,
-  416423,
-  789170,
-  403063,
-  888515,
-  893001,
-  888493,
-  1178870,
-  1178871,
-  1178872,
-  1144942,
-  1144941,
-  1144940,
-  1144944,
-  404286,
-  404288,
-  360360,
-  1144943,
-  580080,
-  558761,
-  1241265,
-  592290,
-  453240,
-  444890,
-  558760,
-  1355740,
-  1355741,
-  1153050,
-  847470,
-  1333210,
-  1403900,
-  1070601,
-  558242,
-  418990,
-  1383230,
-  1410820,
-  1410910,
-  1317840,
-  711270,
-  964640,
-  964630,
-  1004680,
-  1230278,
-  996240,
-  904270,
-  1123120,
-  996720,
-  1401960,
-  1399920,
-  983420,
-  579740,
-  1047230,
-  863240,
-  1028400,
-  948390,
-  862380,
-  719260,
-  743610,
-  743630,
-  743631,
-  743632,
-  651480,
-  651481,
-  1379221,
-  1379220,
-  1367670,
-  1367660,
-  1367650,
-  1367640,
-  1367630,
-  1367610,
-  1280121,
-  239570,
-  1246183,
-  588960,
-  335800,
-  1069552,
-  366845,
-  960310,
-  761596,
-  1246590,
-  1246591,
-  1184290,
-  990680,
-  538600,
-  509522,
-  467770,
-  500460,
-  222585,
-  387910,
-  1314370,
-  822094,
-  559040,
-  909050,
-  326016,
-  315395,
-  315396,
-  1227170,
-  1028703,
-  797990,
-  1324480,
-  1221900,
-  556214,
-  500234,
-  281343,
-  1119750,
-  954030,
-  610699,
-  1245110,
-  1145990,
-  498020,
-  446890,
-  1089280,
-  1089281,
-  1023080,
-  1180260,
-  1384050,
-  1304591,
-  1338900,
-  1338890,
-  1223130,
-  361170,
-  1300450,
-  1021910,
-  29580,
-  29540,
-  29560,
-  222617,
-  1219270,
-  1198280,
-  1272430,
-  794109,
-  1372740,
-  365033,
-  356591,
-  1154000,
-  789391,
-  211419,
-  226995,
-  200891,
-  295078,
-  572840,
-  222566,
-  1227510,
-  1257740,
-  1257741,
-  1336780,
-  559890,
-  1118400,
-  985460,
-  985470,
-  1179800,
-  527070,
-  1267505,
-  863450,
-  596520,
-  749660,
-  505150,
-  1065820,
-  1402640,
-  1358161,
-  1337091,
-  1337092,
-  1293890,
-  1052730,
-  593050,
-  632440,
-  1329572,
-  1329570,
-  1378344,
-  1378194,
-  1378197,
-  1378198,
-  1378540,
-  389770,
-  365950,
-  1354819,
-  1230280,
-  1210040,
-  414520,
-  1083283,
-  459240,
-  373980,
-  1275430,
-  757510,
-  520646,
-  643910,
-  649310,
-  499270,
-  417460,
-  1242761,
-  753283,
-  856149,
-  345740,
-  326623,
-  326624,
-  377180,
-  819601,
-  819600,
-  909610,
-  473390,
-  563106,
-  1010132,
-  961090,
-  605958,
-  1248183,
-  1404230,
-  1404231,
-  1280124,
-  533870,
-  1322120,
-  1278950,
-  1278951,
-  1065660,
-  1105630,
-  1008300,
-  801310,
-  393640,
-  267660,
-  1197800,
-  1290530,
-  1290531,
-  1290580,
-  419966,
-  351660,
-  1280125,
-  1356490,
-  1358070,
-  1280126,
-  1280127,
-  1177830,
-  1405873,
-  1405875,
-  1405874,
-  1405872,
-  1405870,
-  1405871,
-  1203540,
-  477030,
-  1290520,
-  540000,
-  379620,
-  1056620,
-  1056621,
-  1056622,
-  619630,
-  1056623,
-  316670,
-  1382400,
-  1383260,
-  1399450,
-  1392110,
-  410250,
-  1405300,
-  1172880,
-  395990,
-  1396750,
-  1221610,
-  1372791,
-  1280128,
-  1280129,
-  1280120,
-  1280123,
-  1403860,
-  1372790,
-  1130860,
-  1361591,
-  565000,
-  1375250,
-  1278133,
-  1349491,
-  1349492,
-  691170,
-  623830,
-  1281710,
-  357130,
-  1072680,
-  1364310,
-  1142250,
-  1051520,
-  353820,
-  832000,
-  675355,
-  909390,
-  1395590,
-  1050712,
-  918151,
-  1266501,
-  1222100,
-  1222101,
-  909522,
-  909521,
-  909520,
-  908161,
-  908160,
-  794520,
-  1284990,
-  1284991,
-  1284992,
-  539760,
-  1207750,
-  1145840,
-  768910,
-  964120,
-  1329704,
-  1329703,
-  1329702,
-  1329701,
-  1329700,
-  1329705,
-  1329706,
-  1329707,
-  1329708,
-  1399770,
-  1327891,
-  1327890,
-  968912,
-  1222890,
-  1336720,
-  1191880,
-  1349250,
-  1386270,
-  425500,
-  849330,
-  222598,
-  1390510,
-  1356000,
-  1356001,
-  1306000,
-  1306001,
-  1055861,
-  1030050,
-  931010,
-  936910,
-  908810,
-  911410,
-  928090,
-  928110,
-  908670,
-  908680,
-  908760,
-  870630,
-  869430,
-  869330,
-  829700,
-  830010,
-  852130,
-  806430,
-  817240,
-  799280,
-  802150,
-  799160,
-  1016340,
-  340110,
-  314580,
-  16870,
-  1389800,
-  683500,
-  663770,
-  836820,
-  1362220,
-  1362221,
-  679340,
-  1391930,
-  1392020,
-  1238101,
-  396940,
-  440360,
-  420240,
-  1040040,
-  633961,
-  1225430,
-  807620,
-  808430,
-  435177,
-  367850,
-  413070,
-  836520,
-  836530,
-  1278134,
-  1238831,
-  1238011,
-  1238014,
-  1238013,
-  1238012,
-  842020,
-  504890,
-  636502,
-  1093230,
-  1230240,
-  614005,
-  1398580,
-  1395300,
-  256280,
-  576617,
-  576616,
-  576615,
-  576614,
-  576613,
-  1024050,
-  1045820,
-  954670,
-  983460,
-  983470,
-  983480,
-  983490,
-  983500,
-  893700,
-  897350,
-  906060,
-  915591,
-  880350,
-  880351,
-  842000,
-  716790,
-  552020,
-  511840,
-  515950,
-  464681,
-  320830,
-  1264440,
-  789460,
-  474804,
-  568110,
-  1386540,
-  1299610,
-  854220,
-  731460,
-  652490,
-  605690,
-  1088491,
-  379230,
-  1345930,
-  1196560,
-  1196561,
-  1309790,
-  565050,
-  488010,
-  460460,
-  218783,
-  1394530,
-  517290,
-  517292,
-  517291,
-  1246182,
-  601690,
-  515090,
-  573900,
-  1378341,
-  1378192,
-  1378193,
-  1378520,
-  1333173,
-  1387105,
-  1390210,
-  1390212,
-  1390211,
-  1390213,
-  1390214,
-  1362330,
-  948780,
-  912270,
-  605550,
-  1322340,
-  629310,
-  1106072,
-  968840,
-  1380140,
-  1379390,
-  306510,
-  1384100,
-  1377220,
-  1255370,
-  350750,
-  1390710,
-  1383240,
-  1381330,
-  445280,
-  439991,
-  222544,
-  1343790,
-  1383241,
-  1379311,
-  1379310,
-  712270,
-  1377570,
-  230690,
-  230691,
-  230692,
-  951610,
-  963260,
-  1356210,
-  270740,
-  270741,
-  270742,
-  1377750,
-  1389491,
-  1389490,
-  1176156,
-  1088493,
-  1088496,
-  304213,
-  308162,
-  308163,
-  308164,
-  270743,
-  270744,
-  270745,
-  1112850,
-  1337901,
-  360091,
-  1278510,
-  1362410,
-  252990,
-  364323,
-  1389400,
-  1211860,
-  1230279,
-  1193370,
-  1170461,
-  315120,
-  1377460,
-  1382960,
-  1383900,
-  1378610,
-  1353740,
-  743790,
-  1327630,
-  1182270,
-  1231340,
-  1387540,
-  896430,
-  1010134,
-  1374650,
-  1088350,
-  1377910,
-  1341690,
-  1121380,
-  468725,
-  794401,
-  1378340,
-  1378190,
-  1378191,
-  1378510,
-  1095721,
-  1366910,
-  1303192,
-  1303194,
-  1303195,
-  1303196,
-  1303199,
-  1303201,
-  1348150,
-  1362160,
-  1362178,
-  1362159,
-  1362161,
-  1362112,
-  1362157,
-  1362158,
-  1362175,
-  1362176,
-  1362155,
-  1362156,
-  1362113,
-  1362114,
-  1362154,
-  1362173,
-  1362174,
-  1362177,
-  1362153,
-  1362106,
-  1362107,
-  1362108,
-  1362109,
-  1362110,
-  1362152,
-  1362171,
-  1362172,
-  1362102,
-  1362103,
-  1362104,
-  1362105,
-  1362119,
-  1362150,
-  1362151,
-  1362169,
-  1362170,
-  1362101,
-  1362111,
-  1362168,
-  1362080,
-  1362117,
-  1362118,
-  1362165,
-  1362166,
-  1362167,
-  1362100,
-  1362164,
-  1362179,
-  1362163,
-  1362115,
-  1363000,
-  923850,
-  806010,
-  997120,
-  1267990,
-  1342230,
-  1177160,
-  1185610,
-  1214030,
-  1228370,
-  633960,
-  1282170,
-  1188480,
-  1106820,
-  1335950,
-  1331360,
-  1042850,
-  1257380,
-  908213,
-  1219260,
-  1287110,
-  1201900,
-  1219830,
-  610040,
-  865260,
-  233592,
-  1356331,
-  1063150,
-  1003410,
-  1291840,
-  631450,
-  1177630,
-  1325620,
-  1347380,
-  1347410,
-  1335390,
-  1376650,
-  1299390,
-  1357760,
-  1320690,
-  1287360,
-  1347400,
-  1291850,
-  1318250,
-  1253510,
-  1376670,
-  1357770,
-  1335930,
-  1331350,
-  1299380,
-  1306870,
-  1320700,
-  1252520,
-  1381410,
-  1382340,
-  1376500,
-  1343780,
-  512622,
-  488630,
-  1372710,
-  1372690,
-  1369310,
-  1369280,
-  1369100,
-  1341860,
-  1206685,
-  439680,
-  527020,
-  527021,
-  527022,
-  1187750,
-  1381580,
-  1333170,
-  1219630,
-  416480,
-  842213,
-  1235767,
-  1235760,
-  1308721,
-  226993,
-  748840,
-  1146440,
-  357250,
-  403351,
-  1031940,
-  640040,
-  561527,
-  675354,
-  1181890,
-  907580,
-  771200,
-  633981,
-  664270,
-  208741,
-  208742,
-  1276831,
-  1276830,
-  943180,
-  268100,
-  1055710,
-  417260,
-  547030,
-  1376970,
-  1376971,
-  1376972,
-  1376973,
-  1376974,
-  1246181,
-  1333400,
-  728600,
-  1173210,
-  1090160,
-  1354817,
-  1354818,
-  1354862,
-  1354880,
-  1131980,
-  337120,
-  763530,
-  1299200,
-  1356330,
-  1267501,
-  1275360,
-  1201430,
-  1203541,
-  1229170,
-  1232050,
-  1210820,
-  1180410,
-  1122201,
-  1122202,
-  1122203,
-  1122204,
-  1155240,
-  991069,
-  991060,
-  991063,
-  991065,
-  991066,
-  935514,
-  991067,
-  991068,
-  841168,
-  854780,
-  841160,
-  841161,
-  841162,
-  841165,
-  841166,
-  689870,
-  675350,
-  675351,
-  675356,
-  675357,
-  675358,
-  675359,
-  636130,
-  636131,
-  636132,
-  636133,
-  636134,
-  623616,
-  623620,
-  605780,
-  614001,
-  614002,
-  614003,
-  614006,
-  614008,
-  614009,
-  623613,
-  434061,
-  1311180,
-  1343160,
-  1343161,
-  1367800,
-  898190,
-  1333174,
-  780830,
-  1324590,
-  1367801,
-  1383860,
-  1361590,
-  1345580,
-  1372540,
-  1130750,
-  1130810,
-  1130790,
-  1179653,
-  1179656,
-  1154594,
-  1154595,
-  1154596,
-  1154597,
-  1099314,
-  1099370,
-  1111518,
-  1058120,
-  1058121,
-  1042851,
-  1061081,
-  1061083,
-  1061084,
-  1322470,
-  1192920,
-  1380025,
-  1380023,
-  1380024,
-  1380021,
-  1380022,
-  1380020,
-  1364440,
-  1036810,
-  848160,
-  1368503,
-  1368502,
-  1368501,
-  1379541,
-  1379540,
-  1374790,
-  463650,
-  1188611,
-  1219150,
-  534260,
-  1377830,
-  1377210,
-  1375700,
-  1376490,
-  1367740,
-  1375680,
-  1145500,
-  727670,
-  445260,
-  376961,
-  1379800,
-  1094283,
-  1019965,
-  426743,
-  1376000,
-  1287065,
-  1287069,
-  1287052,
-  1287055,
-  1287063,
-  1265472,
-  1242762,
-  1241264,
-  622356,
-  361311,
-  957696,
-  957697,
-  957698,
-  950540,
-  977941,
-  950550,
-  950551,
-  950552,
-  950554,
-  950555,
-  957730,
-  957731,
-  957733,
-  1169960,
-  1169970,
-  972340,
-  577355,
-  870271,
-  870278,
-  870279,
-  598920,
-  598921,
-  1192080,
-  1054872,
-  1146790,
-  1116330,
-  1180350,
-  1010110,
-  1080001,
-  1049050,
-  1010138,
-  1171420,
-  1172700,
-  957691,
-  957692,
-  957693,
-  957694,
-  957695,
-  1343860,
-  295173,
-  396810,
-  1194000,
-  760340,
-  397370,
-  572780,
-  1041830,
-  1041831,
-  971750,
-  569850,
-  379750,
-  240610,
-  1361250,
-  1216510,
-  419070,
-  590750,
-  1242751,
-  561816,
-  1321770,
-  1154060,
-  341810,
-  1123950,
-  1232030,
-  602819,
-  793549,
-  286966,
-  1100220,
-  1028530,
-  425544,
-  980545,
-  663280,
-  277748,
-  1170410,
-  981510,
-  991771,
-  65252,
-  573830,
-  770970,
-  734866,
-  408680,
-  533570,
-  940735,
-  259590,
-  259591,
-  259592,
-  1336870,
-  1243680,
-  1243681,
-  1241490,
-  1213490,
-  1213491,
-  1205310,
-  1213560,
-  1238210,
-  1234150,
-  1278700,
-  892393,
-  491493,
-  1271330,
-  1230272,
-  850850,
-  622353,
-  522120,
-  396990,
-  392670,
-  1261310,
-  1244700,
-  1244701,
-  1243682,
-  1246180,
-  1146523,
-  829340,
-  610705,
-  770974,
-  933521,
-  488340,
-  1255311,
-  583730,
-  1366470,
-  215533,
-  834406,
-  1188619,
-  953101,
-  1166340,
-  762912,
-  942210,
-  1211673,
-  1195540,
-  1082610,
-  360113,
-  242520,
-  240613,
-  297970,
-  1354814,
-  1354815,
-  1354816,
-  1354861,
-  1067471,
-  561811,
-  1377340,
-  1203830,
-  1367390,
-  1267503,
-  1287070,
-  496104,
-  1287064,
-  1188601,
-  1118510,
-  1376720,
-  641000,
-  1241287,
-  1241288,
-  762174,
-  654171,
-  958730,
-  619940,
-  907880,
-  1369380,
-  1376250,
-  1213353,
-  1188616,
-  1282481,
-  1287081,
-  1322250,
-  609260,
-  1287076,
-  793534,
-  556650,
-  1367850,
-  1371250,
-  1369490,
-  1367030,
-  1364480,
-  1361930,
-  1360910,
-  1361960,
-  1360950,
-  1362790,
-  1361770,
-  1358200,
-  1359230,
-  1367000,
-  1343760,
-  1296820,
-  1261720,
-  73071,
-  42881,
-  1132150,
-  1222760,
-  226994,
-  340610,
-  1287053,
-  811460,
-  548920,
-  1052731,
-  830400,
-  900610,
-  1363240,
-  423000,
-  510090,
-  1267500,
-  1181170,
-  769800,
-  769810,
-  769820,
-  769830,
-  769850,
-  769760,
-  769770,
-  769780,
-  769790,
-  769740,
-  582381,
-  1375350,
-  495920,
-  1176372,
-  1176373,
-  1333550,
-  1337450,
-  1334410,
-  1334930,
-  1216750,
-  1158930,
-  1162260,
-  1184920,
-  1185210,
-  1160170,
-  1128090,
-  917890,
-  829270,
-  543670,
-  498890,
-  385570,
-  382200,
-  1033070,
-  1369680,
-  1241266,
-  1308720,
-  562385,
-  204318,
-  793530,
-  423310,
-  1333741,
-  450080,
-  489950,
-  1151910,
-  210048,
-  1242766,
-  237151,
-  1228660,
-  915340,
-  1076420,
-  763693,
-  1241280,
-  1341790,
-  1107811,
-  494420,
-  217941,
-  1030980,
-  641384,
-  674700,
-  1248180,
-  65920,
-  606321,
-  306401,
-  831840,
-  1237630,
-  1004260,
-  997041,
-  403153,
-  1088340,
-  774081,
-  654181,
-  361313,
-  361314,
-  361312,
-  1366300,
-  1372960,
-  443691,
-  1305410,
-  418890,
-  376973,
-  1350550,
-  1343740,
-  1243020,
-  1162160,
-  1066852,
-  1152011,
-  1152012,
-  1152010,
-  571651,
-  571650,
-  571300,
-  571190,
-  526640,
-  994300,
-  1188613,
-  1032180,
-  908130,
-  1330215,
-  286960,
-  555865,
-  1195840,
-  1354812,
-  1354813,
-  1354860,
-  1354870,
-  490330,
-  1097290,
-  717530,
-  1362930,
-  801920,
-  203340,
-  203341,
-  1297120,
-  1093430,
-  827810,
-  827820,
-  267785,
-  267776,
-  267777,
-  267778,
-  267782,
-  267783,
-  267771,
-  267773,
-  258813,
-  267774,
-  258814,
-  258815,
-  591493,
-  1369440,
-  659990,
-  1176619,
-  691300,
-  533552,
-  531161,
-  531162,
-  410690,
-  1093431,
-  757070,
-  1357880,
-  435510,
-  343597,
-  331070,
-  654540,
-  869830,
-  520710,
-  318521,
-  555861,
-  1242748,
-  1101150,
-  1211202,
-  1115280,
-  754790,
-  592860,
-  768703,
-  1372021,
-  1372020,
-  1370902,
-  1370901,
-  1370900,
-  1368984,
-  1368983,
-  1368982,
-  1368981,
-  1368980,
-  1265471,
-  1110142,
-  1241272,
-  1109564,
-  1250950,
-  1250951,
-  1250952,
-  1250953,
-  574330,
-  364325,
-  1198620,
-  894720,
-  896741,
-  439870,
-  440940,
-  1362730,
-  1354320,
-  1366370,
-  1359210,
-  1354380,
-  1358220,
-  1355920,
-  1355940,
-  1347890,
-  1353290,
-  1353320,
-  1343650,
-  1354200,
-  1348850,
-  616440,
-  381151,
-  1076011,
-  208980,
-  622330,
-  1258610,
-  1194021,
-  643688,
-  1203720,
-  940530,
-  1263760,
-  453590,
-  404840,
-  1195907,
-  1112810,
-  398912,
-  24447,
-  1349750,
-  299190,
-  690330,
-  1233373,
-  924181,
-  1328550,
-  1326300,
-  1311260,
-  1307170,
-  1160960,
-  1088494,
-  973840,
-  1059510,
-  695000,
-  591507,
-  480595,
-  372020,
-  357350,
-  904110,
-  1175010,
-  1025040,
-  438980,
-  1307210,
-  605951,
-  561543,
-  561545,
-  561547,
-  561551,
-  561552,
-  561553,
-  561556,
-  561530,
-  561531,
-  561532,
-  561533,
-  561534,
-  561535,
-  561536,
-  561537,
-  561538,
-  561539,
-  561540,
-  561541,
-  200880,
-  200890,
-  1117950,
-  1262981,
-  648240,
-  690190,
-  225833,
-  984040,
-  325141,
-  659290,
-  564670,
-  1058463,
-  1147159,
-  1262412,
-  1262425,
-  625660,
-  956896,
-  537780,
-  500235,
-  1164380,
-  797840,
-  920598,
-  486220,
-  1067830,
-  1158530,
-  1156240,
-  507040,
-  616901,
-  616150,
-  1358500,
-  1343490,
-  1340350,
-  1340351,
-  508271,
-  1021170,
-  798100,
-  292050,
-  426741,
-  1241285,
-  737740,
-  1071460,
-  1094281,
-  1156160,
-  1360680,
-  1330218,
-  1330219,
-  1259320,
-  1226850,
-  1163790,
-  1081690,
-  1094900,
-  875090,
-  1031410,
-  720130,
-  875070,
-  801970,
-  796120,
-  605540,
-  549380,
-  415570,
-  422580,
-  360114,
-  541580,
-  294340,
-  1041790,
-  702967,
-  379572,
-  425141,
-  1205820,
-  1205830,
-  1205840,
-  1248320,
-  1270490,
-  1287071,
-  1287072,
-  1287073,
-  1287074,
-  1287067,
-  1287068,
-  1287066,
-  1287054,
-  1187631,
-  1183101,
-  1176371,
-  931791,
-  966844,
-  629940,
-  784160,
-  736690,
-  338202,
-  1354810,
-  1354811,
-  1176370,
-  1230276,
-  774758,
-  326005,
-  1347100,
-  1347980,
-  1349350,
-  1350400,
-  1352320,
-  1351320,
-  1251350,
-  514331,
-  451280,
-  648291,
-  1111476,
-  1168566,
-  1188614,
-  1310320,
-  1310310,
-  1344190,
-  1344191,
-  1344193,
-  1344194,
-  1166170,
-  1271794,
-  1272170,
-  536540,
-  255750,
-  1356430,
-  91333,
-  1310000,
-  1359780,
-  1335870,
-  592475,
-  592473,
-  592474,
-  592472,
-  592471,
-  592470,
-  582072,
-  582071,
-  582070,
-  565353,
-  570300,
-  565352,
-  565351,
-  563289,
-  565350,
-  563288,
-  563287,
-  563286,
-  563285,
-  563284,
-  563283,
-  563282,
-  563281,
-  563280,
-  559382,
-  559380,
-  559370,
-  547420,
-  538831,
-  538829,
-  538830,
-  538827,
-  538826,
-  538825,
-  538824,
-  538823,
-  538822,
-  538821,
-  537981,
-  537980,
-  537829,
-  537826,
-  537825,
-  537824,
-  537823,
-  537822,
-  537821,
-  537271,
-  537270,
-  537269,
-  537268,
-  537267,
-  537266,
-  537265,
-  537264,
-  537263,
-  537262,
-  537261,
-  537161,
-  537160,
-  537159,
-  537158,
-  537157,
-  537156,
-  537155,
-  537154,
-  537153,
-  537152,
-  537151,
-  537150,
-  535736,
-  535737,
-  535738,
-  535739,
-  535741,
-  535735,
-  535733,
-  535734,
-  534341,
-  534340,
-  523920,
-  519910,
-  507290,
-  204600,
-  102511,
-  1311760,
-  1354620,
-  1111530,
-  1241268,
-  1220400,
-  1220401,
-  500208,
-  701980,
-  616190,
-  1170710,
-  1062281,
-  1045690,
-  885750,
-  529010,
-  317465,
-  1165980,
-  1169320,
-  808400,
-  728780,
-  390656,
-  390659,
-  393021,
-  393022,
-  393023,
-  393042,
-  393043,
-  390652,
-  372511,
-  1187550,
-  1220130,
-  1055700,
-  1351910,
-  1351420,
-  1350800,
-  453380,
-  204312,
-  996314,
-  390490,
-  372810,
-  258543,
-  451430,
-  529690,
-  540820,
-  313280,
-  313281,
-  336850,
-  336851,
-  296450,
-  305360,
-  319580,
-  1302040,
-  1130680,
-  563210,
-  477940,
-  1004440,
-  1113990,
-  943850,
-  1262590,
-  1271371,
-  1262573,
-  249250,
-  249270,
-  249290,
-  313070,
-  1169722,
-  1168568,
-  1111481,
-  1111513,
-  1361080,
-  1360355,
-  1203300,
-  1102440,
-  793730,
-  448180,
-  1000230,
-  45795,
-  45796,
-  45797,
-  45794,
-  45791,
-  45792,
-  45793,
-  45790,
-  1061740,
-  222542,
-  45798,
-  1364320,
-  1183110,
-  1358330,
-  297940,
-  299290,
-  299140,
-  299300,
-  299301,
-  300440,
-  300441,
-  300442,
-  300450,
-  301240,
-  301241,
-  301242,
-  301243,
-  301244,
-  301245,
-  301246,
-  301247,
-  301248,
-  301249,
-  302300,
-  303330,
-  303332,
-  305470,
-  305471,
-  305472,
-  306530,
-  306531,
-  308010,
-  308020,
-  308030,
-  311920,
-  308140,
-  314170,
-  315730,
-  313520,
-  315630,
-  316490,
-  316491,
-  317830,
-  316650,
-  316651,
-  319840,
-  317831,
-  317832,
-  317833,
-  320560,
-  320570,
-  319880,
-  325040,
-  324590,
-  326790,
-  325041,
-  325042,
-  325043,
-  325044,
-  328020,
-  328021,
-  328022,
-  330480,
-  331000,
-  331960,
-  332000,
-  332001,
-  332010,
-  336180,
-  333900,
-  333520,
-  332011,
-  332020,
-  346660,
-  346310,
-  346311,
-  347100,
-  347101,
-  347102,
-  347103,
-  347104,
-  347490,
-  347491,
-  347492,
-  347105,
-  347493,
-  347494,
-  349820,
-  360092,
-  360093,
-  360094,
-  360095,
-  360096,
-  360097,
-  360098,
-  360099,
-  360110,
-  360111,
-  360112,
-  360120,
-  360420,
-  360421,
-  360422,
-  360423,
-  360424,
-  360425,
-  360426,
-  360427,
-  360428,
-  362010,
-  362320,
-  361870,
-  389910,
-  389911,
-  389912,
-  389913,
-  389914,
-  389915,
-  389916,
-  389917,
-  389920,
-  389921,
-  389922,
-  403500,
-  394810,
-  394811,
-  415540,
-  415550,
-  415560,
-  425020,
-  420730,
-  420731,
-  425030,
-  425060,
-  425090,
-  425180,
-  436250,
-  436251,
-  425181,
-  425182,
-  428520,
-  438060,
-  438061,
-  438062,
-  438070,
-  438071,
-  445930,
-  445931,
-  450091,
-  450092,
-  450093,
-  450094,
-  450095,
-  450096,
-  450097,
-  450098,
-  450099,
-  453460,
-  456890,
-  456891,
-  457470,
-  468520,
-  466250,
-  462740,
-  460010,
-  469530,
-  469850,
-  468610,
-  471310,
-  469940,
-  471250,
-  473600,
-  472670,
-  471760,
-  476440,
-  477990,
-  478970,
-  482340,
-  479120,
-  482720,
-  481750,
-  484940,
-  483670,
-  484820,
-  483800,
-  485200,
-  485210,
-  486270,
-  488850,
-  488970,
-  489010,
-  488930,
-  489410,
-  490240,
-  489670,
-  489450,
-  490480,
-  491840,
-  491680,
-  490680,
-  493210,
-  495330,
-  500280,
-  500310,
-  499150,
-  498900,
-  501290,
-  501730,
-  501230,
-  501820,
-  502630,
-  502900,
-  502930,
-  504170,
-  504220,
-  502960,
-  504520,
-  504870,
-  505240,
-  505260,
-  507180,
-  505510,
-  508420,
-  508780,
-  507530,
-  511850,
-  508860,
-  512190,
-  510450,
-  520310,
-  512380,
-  513010,
-  524080,
-  520340,
-  520630,
-  520390,
-  527220,
-  525730,
-  525750,
-  527080,
-  532550,
-  528480,
-  533190,
-  534580,
-  534650,
-  535180,
-  534670,
-  535830,
-  536910,
-  536150,
-  537030,
-  541980,
-  537890,
-  541880,
-  542470,
-  542320,
-  542890,
-  544080,
-  543840,
-  543860,
-  543730,
-  544120,
-  544460,
-  544210,
-  544490,
-  544850,
-  544890,
-  544900,
-  544960,
-  545310,
-  545610,
-  545500,
-  545760,
-  546720,
-  546730,
-  547020,
-  547100,
-  547170,
-  547720,
-  547800,
-  547060,
-  548190,
-  548200,
-  548210,
-  547830,
-  548690,
-  548730,
-  548750,
-  549230,
-  549250,
-  548770,
-  549370,
-  550260,
-  550300,
-  550640,
-  550680,
-  551240,
-  551290,
-  551310,
-  552830,
-  553360,
-  552860,
-  553930,
-  554500,
-  554130,
-  554480,
-  554540,
-  555030,
-  555590,
-  555680,
-  554960,
-  555790,
-  555840,
-  556610,
-  555740,
-  556670,
-  556690,
-  557210,
-  557230,
-  557250,
-  557640,
-  558540,
-  557300,
-  560140,
-  559790,
-  559800,
-  560090,
-  560110,
-  560390,
-  560670,
-  560500,
-  560680,
-  561290,
-  561310,
-  561830,
-  561330,
-  561920,
-  563640,
-  563900,
-  563650,
-  565450,
-  563920,
-  566480,
-  565460,
-  565500,
-  567820,
-  566590,
-  567230,
-  566510,
-  569600,
-  569930,
-  569950,
-  568540,
-  569980,
-  570020,
-  570030,
-  570560,
-  570670,
-  570720,
-  572060,
-  571900,
-  572770,
-  572790,
-  572070,
-  573470,
-  573500,
-  574450,
-  574460,
-  575240,
-  575250,
-  574490,
-  575230,
-  575260,
-  576180,
-  576200,
-  576220,
-  576270,
-  576570,
-  576250,
-  577590,
-  576580,
-  577620,
-  578480,
-  578500,
-  580740,
-  580240,
-  580290,
-  579790,
-  581390,
-  580760,
-  580790,
-  582650,
-  583720,
-  584250,
-  583230,
-  584270,
-  585110,
-  585120,
-  584390,
-  585700,
-  585210,
-  587120,
-  585870,
-  585930,
-  585980,
-  587270,
-  587550,
-  587150,
-  587230,
-  587610,
-  588390,
-  587640,
-  587700,
-  589130,
-  589010,
-  588510,
-  589790,
-  590630,
-  590650,
-  591430,
-  590760,
-  593420,
-  593130,
-  592110,
-  593390,
-  593450,
-  595050,
-  596130,
-  595700,
-  597290,
-  597310,
-  597600,
-  597610,
-  597890,
-  597930,
-  599860,
-  600470,
-  597940,
-  597950,
-  601350,
-  602400,
-  601730,
-  602820,
-  602870,
-  603170,
-  602950,
-  604180,
-  604310,
-  604350,
-  603590,
-  604360,
-  604650,
-  604730,
-  604800,
-  604840,
-  604860,
-  604870,
-  605480,
-  605590,
-  605670,
-  605700,
-  607450,
-  607480,
-  607500,
-  608020,
-  607510,
-  607550,
-  608100,
-  608140,
-  608150,
-  608200,
-  608210,
-  608840,
-  608600,
-  609370,
-  608220,
-  609700,
-  609460,
-  609730,
-  609480,
-  610150,
-  610420,
-  610760,
-  610830,
-  610850,
-  610870,
-  611250,
-  613690,
-  612500,
-  611270,
-  612580,
-  611310,
-  614190,
-  613950,
-  614270,
-  614280,
-  614290,
-  614300,
-  614330,
-  614340,
-  614410,
-  614420,
-  614350,
-  614370,
-  614720,
-  614750,
-  614760,
-  614780,
-  615170,
-  615190,
-  615710,
-  615520,
-  614820,
-  616480,
-  616260,
-  616430,
-  615920,
-  616510,
-  616540,
-  616590,
-  617130,
-  617150,
-  618320,
-  617340,
-  617400,
-  617470,
-  618520,
-  619050,
-  619160,
-  619170,
-  618460,
-  620290,
-  620090,
-  619190,
-  619200,
-  620270,
-  620810,
-  620830,
-  620880,
-  620910,
-  620730,
-  620780,
-  620920,
-  620930,
-  620950,
-  620970,
-  620990,
-  621110,
-  621160,
-  621180,
-  621200,
-  622070,
-  622090,
-  622160,
-  622210,
-  622240,
-  622260,
-  622280,
-  622520,
-  623560,
-  624110,
-  625450,
-  626240,
-  624540,
-  625060,
-  625110,
-  626740,
-  627030,
-  628310,
-  626830,
-  628980,
-  629880,
-  629890,
-  629900,
-  630200,
-  629490,
-  629500,
-  630330,
-  631110,
-  632140,
-  633020,
-  630270,
-  636210,
-  635510,
-  635570,
-  634580,
-  635890,
-  636780,
-  638620,
-  639950,
-  636890,
-  641280,
-  641030,
-  641580,
-  640680,
-  643130,
-  642180,
-  641740,
-  644520,
-  645660,
-  645050,
-  645850,
-  645100,
-  645620,
-  648450,
-  648500,
-  646260,
-  647340,
-  647350,
-  648940,
-  645880,
-  650920,
-  650930,
-  650190,
-  649700,
-  649720,
-  660240,
-  654360,
-  659230,
-  651630,
-  662450,
-  654330,
-  654590,
-  668950,
-  663660,
-  665520,
-  662710,
-  668090,
-  666300,
-  667370,
-  670980,
-  670030,
-  673120,
-  671110,
-  673170,
-  676110,
-  674880,
-  674950,
-  676040,
-  675060,
-  676750,
-  677320,
-  676810,
-  680010,
-  680790,
-  679790,
-  679850,
-  679150,
-  684140,
-  682900,
-  686700,
-  685480,
-  685250,
-  688820,
-  689590,
-  688830,
-  688890,
-  690450,
-  695080,
-  690540,
-  690380,
-  697400,
-  695870,
-  696670,
-  697480,
-  696830,
-  697620,
-  697510,
-  698060,
-  697560,
-  697570,
-  700930,
-  698810,
-  698840,
-  698090,
-  700950,
-  701490,
-  700980,
-  702850,
-  701840,
-  705850,
-  704620,
-  704130,
-  703420,
-  706590,
-  706600,
-  705880,
-  706650,
-  709130,
-  706700,
-  706780,
-  706800,
-  709680,
-  709690,
-  709600,
-  709980,
-  710000,
-  710010,
-  710040,
-  710050,
-  711220,
-  711040,
-  710060,
-  711280,
-  713630,
-  713130,
-  713900,
-  717100,
-  718390,
-  718420,
-  716990,
-  715480,
-  718460,
-  718480,
-  718520,
-  722690,
-  727810,
-  722710,
-  727080,
-  722740,
-  727820,
-  727870,
-  727890,
-  727940,
-  728640,
-  728000,
-  728060,
-  731140,
-  729360,
-  731780,
-  731020,
-  731810,
-  731850,
-  732170,
-  732180,
-  732200,
-  732220,
-  733220,
-  737320,
-  733490,
-  732270,
-  738110,
-  737350,
-  738140,
-  737400,
-  738240,
-  741160,
-  741170,
-  741180,
-  741200,
-  740510,
-  745230,
-  742780,
-  750980,
-  749450,
-  742810,
-  752990,
-  754290,
-  754860,
-  754880,
-  757760,
-  755730,
-  754900,
-  757790,
-  759330,
-  759390,
-  760940,
-  759280,
-  762660,
-  766310,
-  764270,
-  762060,
-  771390,
-  770130,
-  766350,
-  770730,
-  770000,
-  784900,
-  773300,
-  784860,
-  784880,
-  790280,
-  786760,
-  786780,
-  790150,
-  791070,
-  795210,
-  791120,
-  795250,
-  793470,
-  796170,
-  795260,
-  795290,
-  798990,
-  799030,
-  798110,
-  798150,
-  798970,
-  804920,
-  800210,
-  805100,
-  800250,
-  806450,
-  806200,
-  805200,
-  806280,
-  809990,
-  810070,
-  807300,
-  809970,
-  807420,
-  813850,
-  810090,
-  810480,
-  813810,
-  810490,
-  815120,
-  814440,
-  814780,
-  815600,
-  815680,
-  815710,
-  815720,
-  816510,
-  815610,
-  818810,
-  818300,
-  818820,
-  818340,
-  818870,
-  818880,
-  818900,
-  819420,
-  818920,
-  819590,
-  819610,
-  822210,
-  819430,
-  822860,
-  823150,
-  823190,
-  822780,
-  823400,
-  823430,
-  823200,
-  823240,
-  823250,
-  824330,
-  828690,
-  831830,
-  824160,
-  832010,
-  832780,
-  833340,
-  835830,
-  837970,
-  839270,
-  838000,
-  838080,
-  839990,
-  840040,
-  839290,
-  839320,
-  841280,
-  840540,
-  841310,
-  840630,
-  840680,
-  842240,
-  842300,
-  842390,
-  842480,
-  843240,
-  843290,
-  846410,
-  843910,
-  845190,
-  851510,
-  849240,
-  846450,
-  847990,
-  848000,
-  847090,
-  852290,
-  852370,
-  852930,
-  852940,
-  855810,
-  854900,
-  854910,
-  854410,
-  854270,
-  855880,
-  855890,
-  857960,
-  856820,
-  858660,
-  859250,
-  858610,
-  858620,
-  859400,
-  859270,
-  860110,
-  860470,
-  860610,
-  861380,
-  860130,
-  861440,
-  862100,
-  861600,
-  862170,
-  862840,
-  863110,
-  864210,
-  862970,
-  864290,
-  864320,
-  864670,
-  864240,
-  864250,
-  865650,
-  864890,
-  864900,
-  865740,
-  866300,
-  866360,
-  867680,
-  866410,
-  867740,
-  867810,
-  867880,
-  867890,
-  867910,
-  867970,
-  872190,
-  872210,
-  872260,
-  873630,
-  873640,
-  873650,
-  874680,
-  873670,
-  873690,
-  874860,
-  874920,
-  876420,
-  876430,
-  876490,
-  876570,
-  876610,
-  876640,
-  876520,
-  878200,
-  879500,
-  879760,
-  878230,
-  879860,
-  882720,
-  880680,
-  880630,
-  879870,
-  882740,
-  885410,
-  885460,
-  885490,
-  885520,
-  886050,
-  886130,
-  886150,
-  887180,
-  887230,
-  891930,
-  891260,
-  890770,
-  892610,
-  890080,
-  892710,
-  893340,
-  893380,
-  899660,
-  900460,
-  893400,
-  899580,
-  903970,
-  903990,
-  904010,
-  905740,
-  904610,
-  904150,
-  905750,
-  906780,
-  905770,
-  905820,
-  906700,
-  906800,
-  906840,
-  908190,
-  908240,
-  910600,
-  910160,
-  908380,
-  910040,
-  908250,
-  910640,
-  912180,
-  912240,
-  911490,
-  915210,
-  916570,
-  916600,
-  914410,
-  916720,
-  918360,
-  918400,
-  917930,
-  918830,
-  922200,
-  922280,
-  922300,
-  924160,
-  924190,
-  926850,
-  926670,
-  926890,
-  926980,
-  926940,
-  928220,
-  928240,
-  931330,
-  932510,
-  932520,
-  931300,
-  935710,
-  935770,
-  933990,
-  932540,
-  936570,
-  935830,
-  937370,
-  935850,
-  940090,
-  943530,
-  937440,
-  940270,
-  946710,
-  945990,
-  946420,
-  946740,
-  952410,
-  954770,
-  951790,
-  956230,
-  955760,
-  955810,
-  954800,
-  956120,
-  956300,
-  956320,
-  956330,
-  956340,
-  956440,
-  957300,
-  957310,
-  959070,
-  958570,
-  958580,
-  957320,
-  957330,
-  959140,
-  959950,
-  959460,
-  963350,
-  963410,
-  962680,
-  961980,
-  962780,
-  965700,
-  966750,
-  964520,
-  974080,
-  976690,
-  974730,
-  974800,
-  974590,
-  984850,
-  976750,
-  977020,
-  979950,
-  984860,
-  985180,
-  985200,
-  985290,
-  987220,
-  988830,
-  988840,
-  985520,
-  991850,
-  993420,
-  992920,
-  994460,
-  988850,
-  996530,
-  994490,
-  994530,
-  996590,
-  997910,
-  997920,
-  997460,
-  997520,
-  999790,
-  999580,
-  999380,
-  999670,
-  1002760,
-  1000630,
-  999870,
-  1002710,
-  1002740,
-  1004060,
-  1003870,
-  1003920,
-  1003990,
-  1006650,
-  1007190,
-  1005160,
-  1007570,
-  1007590,
-  1007640,
-  1007660,
-  1007670,
-  1007600,
-  1008750,
-  1008760,
-  1008770,
-  1009310,
-  1010350,
-  1011730,
-  1011010,
-  1013550,
-  1012890,
-  1013420,
-  1012420,
-  1013500,
-  1017680,
-  1014870,
-  1017700,
-  1017730,
-  1017790,
-  1017870,
-  1017890,
-  1017920,
-  1017840,
-  1017850,
-  1018370,
-  1018460,
-  1018470,
-  1020400,
-  1020460,
-  1022060,
-  1021090,
-  1021150,
-  1021160,
-  1023540,
-  1023580,
-  1026240,
-  1024710,
-  1024760,
-  1031680,
-  1027590,
-  1031690,
-  1030800,
-  1028580,
-  1037060,
-  1034760,
-  1039130,
-  1032300,
-  1035910,
-  1033900,
-  1039660,
-  1042480,
-  1039170,
-  1044680,
-  1040360,
-  1045320,
-  1045420,
-  1047510,
-  1045500,
-  1051650,
-  1051680,
-  1048140,
-  1052320,
-  1052680,
-  1054810,
-  1057760,
-  1057880,
-  1057920,
-  1057970,
-  1060730,
-  1063430,
-  1064230,
-  1064240,
-  1065600,
-  1068550,
-  1068610,
-  1067710,
-  1072200,
-  1072230,
-  1070720,
-  1068710,
-  1073930,
-  1076820,
-  1072630,
-  1076860,
-  1076870,
-  1076930,
-  1078220,
-  1079090,
-  1079120,
-  1080190,
-  1079190,
-  1080270,
-  1082230,
-  1080970,
-  1081750,
-  1082390,
-  1082420,
-  1085580,
-  1085600,
-  1085650,
-  1085710,
-  1086570,
-  1086600,
-  1086610,
-  1090830,
-  1091630,
-  1090880,
-  1087300,
-  1094430,
-  1094350,
-  1098240,
-  1094940,
-  1097080,
-  1097640,
-  1097140,
-  1098310,
-  1098350,
-  1098950,
-  1098970,
-  1102600,
-  1105790,
-  1105820,
-  1106870,
-  1100480,
-  1107460,
-  1107990,
-  1107500,
-  1107400,
-  1107430,
-  1109270,
-  1108770,
-  1108650,
-  1109950,
-  1112660,
-  1112720,
-  1110450,
-  1115130,
-  1115440,
-  1115390,
-  1117230,
-  1119370,
-  1119390,
-  1116640,
-  1119850,
-  1119880,
-  1119900,
-  1119410,
-  1120440,
-  1121800,
-  1121840,
-  1121870,
-  1121130,
-  1120470,
-  1122370,
-  1123170,
-  1121900,
-  1123200,
-  1123840,
-  1127430,
-  1123860,
-  1126810,
-  1126080,
-  1133380,
-  1133400,
-  1128120,
-  1128130,
-  1136130,
-  1136170,
-  1136180,
-  1135540,
-  1135550,
-  1137950,
-  1136970,
-  1136990,
-  1137000,
-  1137890,
-  1139260,
-  1139270,
-  1139290,
-  1140220,
-  1140320,
-  1140380,
-  1140470,
-  1142350,
-  1140910,
-  1140920,
-  1141500,
-  1143360,
-  1151820,
-  1146460,
-  1142370,
-  1152520,
-  1151950,
-  1151970,
-  1153180,
-  1153240,
-  1156280,
-  1156310,
-  1159050,
-  1158560,
-  1159100,
-  1159670,
-  1160230,
-  1160300,
-  1160930,
-  1164430,
-  1164490,
-  1164540,
-  1165160,
-  1165940,
-  1165200,
-  1165210,
-  1166620,
-  1168180,
-  1168200,
-  1166670,
-  1168080,
-  1168700,
-  1171020,
-  1168730,
-  1172210,
-  1174930,
-  1177010,
-  1174000,
-  1181260,
-  1180780,
-  1177520,
-  1181320,
-  1181860,
-  1181350,
-  1181930,
-  1184520,
-  1184580,
-  1182560,
-  1183960,
-  1188120,
-  1187370,
-  1188940,
-  1185890,
-  1185920,
-  1190920,
-  1189000,
-  1190140,
-  1190940,
-  1192220,
-  1190960,
-  1192180,
-  1192710,
-  1192770,
-  1196210,
-  1192690,
-  1198680,
-  1199720,
-  1199750,
-  1206830,
-  1207510,
-  1205470,
-  1207530,
-  1207550,
-  1209710,
-  1210350,
-  1211690,
-  1211590,
-  1216000,
-  1216020,
-  1218990,
-  1213160,
-  1220180,
-  1225350,
-  1225420,
-  1219040,
-  1226130,
-  1226680,
-  1225440,
-  1226710,
-  1226730,
-  1226740,
-  1226750,
-  1226780,
-  1229670,
-  1229690,
-  1241090,
-  1229700,
-  1241070,
-  1244870,
-  1244900,
-  1243380,
-  1245020,
-  1245050,
-  1245070,
-  1246640,
-  1246660,
-  1251620,
-  1254750,
-  1246670,
-  1254650,
-  1261680,
-  1259400,
-  1259410,
-  1267030,
-  1265250,
-  1266940,
-  1268520,
-  1268580,
-  1272210,
-  1268470,
-  1273090,
-  1273140,
-  1273170,
-  1272270,
-  1273040,
-  1278990,
-  1281090,
-  1286100,
-  1286130,
-  1291040,
-  1296230,
-  1289660,
-  1290950,
-  1289700,
-  1296420,
-  1298980,
-  1298870,
-  1298920,
-  1301050,
-  1301080,
-  1303900,
-  1303490,
-  1308160,
-  1311790,
-  1308210,
-  1309240,
-  1309160,
-  1311810,
-  1311870,
-  1312300,
-  1313610,
-  1312340,
-  1313460,
-  1317890,
-  1317920,
-  1318760,
-  1318880,
-  1319770,
-  1319640,
-  1319660,
-  1320330,
-  1320350,
-  1328610,
-  1328640,
-  1328650,
-  1329050,
-  1329060,
-  1329160,
-  1329090,
-  1329870,
-  1329120,
-  1329970,
-  1330750,
-  1330810,
-  1330900,
-  1329900,
-  1332810,
-  1333640,
-  1333760,
-  1333770,
-  1334370,
-  1334400,
-  1334430,
-  1334870,
-  1334890,
-  1334460,
-  1339660,
-  1339680,
-  1338300,
-  1338310,
-  1336550,
-  1339930,
-  1339940,
-  1339950,
-  1339990,
-  1340700,
-  1340060,
-  1341910,
-  1340670,
-  1341920,
-  1059800,
-  1059790,
-  1059780,
-  790770,
-  785230,
-  785220,
-  785210,
-  785190,
-  783110,
-  810300,
-  985130,
-  681570,
-  1336220,
-  1309101,
-  258650,
-  204287,
-  923851,
-  290403,
-  290405,
-  290406,
-  289731,
-  1265476,
-  1265475,
-  1265474,
-  1265473,
-  1242777,
-  1360310,
-  1360311,
-  1360312,
-  1360313,
-  1360314,
-  1360329,
-  1360340,
-  1360341,
-  1360342,
-  1360345,
-  1360346,
-  1360347,
-  1360353,
-  1360354,
-  1360356,
-  1360357,
-  1242775,
-  1242774,
-  996721,
-  1242771,
-  1242770,
-  974300,
-  1242769,
-  1242768,
-  1242767,
-  1242765,
-  1242764,
-  1242763,
-  1242758,
-  763691,
-  762919,
-  1242757,
-  762918,
-  1241284,
-  1241282,
-  1241281,
-  1241278,
-  1241277,
-  762179,
-  762177,
-  1241274,
-  762178,
-  1241273,
-  762176,
-  1241269,
-  1241263,
-  1241260,
-  761597,
-  1211208,
-  761595,
-  761594,
-  1211204,
-  1211203,
-  761593,
-  1211201,
-  1241300,
-  761592,
-  1211200,
-  1241299,
-  1211179,
-  761591,
-  1241298,
-  1211178,
-  1211177,
-  1241297,
-  1241296,
-  1211175,
-  759455,
-  1241295,
-  1211173,
-  1241294,
-  759454,
-  1241293,
-  763694,
-  1241292,
-  763690,
-  1241291,
-  1118023,
-  759453,
-  1118022,
-  1118019,
-  759452,
-  1118018,
-  759451,
-  1118017,
-  1118015,
-  759450,
-  1118014,
-  1118013,
-  996741,
-  825420,
-  1124320,
-  1172420,
-  908211,
-  796310,
-  808410,
-  329270,
-  282091,
-  282092,
-  289020,
-  289021,
-  289022,
-  289023,
-  289024,
-  295100,
-  304450,
-  324130,
-  964250,
-  613630,
-  578580,
-  1346160,
-  1360318,
-  1360319,
-  1360320,
-  1360321,
-  1360322,
-  1360324,
-  1360325,
-  1360326,
-  1360327,
-  1360328,
-  1360330,
-  1360331,
-  1360343,
-  1360344,
-  1360348,
-  1360349,
-  1360350,
-  1360351,
-  1360352,
-  1360315,
-  1360316,
-  1360317,
-  1135520,
-  917170,
-  435110,
-  331060,
-  492210,
-  1323510,
-  648790,
-  1108700,
-  1277370,
-  430110,
-  971910,
-  1353490,
-  1354410,
-  1098860,
-  1290521,
-  1290532,
-  1353480,
-  1183040,
-  320550,
-  677950,
-  1099202,
-  435450,
-  1313010,
-  500233,
-  1348420,
-  530661,
-  938120,
-  1028420,
-  1145710,
-  1234392,
-  941971,
-  1039090,
-  1095930,
-  1181230,
-  323210,
-  330730,
-  1113820,
-  900240,
-  900241,
-  900242,
-  914660,
-  914661,
-  914662,
-  612350,
-  221169,
-  1355856,
-  1355857,
-  1355858,
-  1356370,
-  1355859,
-  1356371,
-  1355850,
-  1355851,
-  1355852,
-  1355853,
-  1355854,
-  1355855,
-  1355750,
-  1355751,
-  1355752,
-  1355753,
-  1355754,
-  944520,
-  1198982,
-  1198981,
-  1198980,
-  823090,
-  823091,
-  823092,
-  723700,
-  998803,
-  940731,
-  237613,
-  237615,
-  237622,
-  237623,
-  1075770,
-  1169810,
-  1078860,
-  1356340,
-  1000210,
-  1341350,
-  1030270,
-  1341810,
-  1240100,
-  1258280,
-  1338870,
-  392980,
-  996990,
-  999050,
-  1205785,
-  1339010,
-  1339011,
-  1339012,
-  1339400,
-  1339770,
-  1339771,
-  1171500,
-  1186410,
-  1189770,
-  1204200,
-  1210070,
-  1210080,
-  1213500,
-  1213510,
-  1215920,
-  1216390,
-  1221100,
-  1221110,
-  1221120,
-  1221130,
-  1221140,
-  1221150,
-  1221160,
-  1221180,
-  1221190,
-  1221200,
-  1221210,
-  1221220,
-  1221360,
-  1223010,
-  1227520,
-  1293320,
-  1293330,
-  1293340,
-  1293350,
-  1231910,
-  1293360,
-  1227340,
-  1254300,
-  1275040,
-  1275050,
-  1263020,
-  1263030,
-  1252280,
-  1262010,
-  1272770,
-  1263050,
-  1242840,
-  1226980,
-  1227500,
-  750310,
-  1330216,
-  1330217,
-  1331115,
-  1331150,
-  1356510,
-  1321790,
-  1256840,
-  1048380,
-  1348190,
-  588964,
-  974728,
-  637990,
-  588261,
-  588262,
-  588263,
-  1338080,
-  1338060,
-  1341411,
-  1341413,
-  1341414,
-  1341412,
-  1341410,
-  1349521,
-  1352172,
-  1352173,
-  1352171,
-  1352170,
-  1351604,
-  1351603,
-  1351602,
-  1351601,
-  1351600,
-  1349523,
-  1349522,
-  1349520,
-  1346060,
-  1345560,
-  588260,
-  393040,
-  1337182,
-  1337181,
-  1337180,
-  1334792,
-  1334791,
-  1334790,
-  1354430,
-  1331002,
-  1331001,
-  1331000,
-  1355280,
-  1350603,
-  1355282,
-  1354431,
-  1355281,
-  1350602,
-  1355283,
-  1348720,
-  1342883,
-  1342882,
-  1342881,
-  1342880,
-  1342870,
-  1355871,
-  1355872,
-  1355870,
-  1350604,
-  1350601,
-  1350600,
-  357240,
-  1022910,
-  977930,
-  665500,
-  579270,
-  538090,
-  520640,
-  520642,
-  520643,
-  520644,
-  520645,
-  511450,
-  461130,
-  1179920,
-  909730,
-  1166721,
-  1354312,
-  1354310,
-  967275,
-  1166171,
-  1354650,
-  1031300,
-  768600,
-  765340,
-  1349180,
-  920982,
-  1056770,
-  879733,
-  1235765,
-  1235754,
-  1235759,
-  1353000,
-  1354280,
-  1099341,
-  1099360,
-  1099365,
-  1099393,
-  376949,
-  1099363,
-  1099372,
-  1099373,
-  1099343,
-  1099420,
-  1099344,
-  1099390,
-  1099342,
-  1099352,
-  1099364,
-  1030420,
-  433460,
-  436450,
-  466970,
-  521020,
-  530770,
-  635340,
-  635341,
-  1099361,
-  1099350,
-  1099362,
-  1099371,
-  1099422,
-  1099345,
-  1099351,
-  1099391,
-  1099392,
-  1099421,
-  1183610,
-  1354561,
-  1354630,
-  1354631,
-  1354740,
-  1354741,
-  385721,
-  367250,
-  952220,
-  571580,
-  813840,
-  1336930,
-  1315874,
-  333040,
-  292900,
-  233590,
-  233591,
-  630091,
-  1023950,
-  1327770,
-  931670,
-  1344470,
-  822480,
-  1353780,
-  1353840,
-  1353700,
-  1353701,
-  1307060,
-  984270,
-  1286904,
-  1286902,
-  1286900,
-  1262592,
-  1316272,
-  1316275,
-  1316144,
-  1315801,
-  1315804,
-  1315803,
-  425120,
-  1316023,
-  1316025,
-  1316026,
-  1316028,
-  1316241,
-  1316076,
-  1225270,
-  1316143,
-  1316070,
-  1315805,
-  1315800,
-  1316261,
-  1316271,
-  1316146,
-  1316072,
-  1315876,
-  1304960,
-  1315875,
-  1315873,
-  1315877,
-  1328032,
-  1328030,
-  1328031,
-  1286915,
-  1286913,
-  1286912,
-  1286916,
-  1271130,
-  1303190,
-  1330214,
-  320987,
-  1309120,
-  398471,
-  398470,
-  1075460,
-  900231,
-  900230,
-  918792,
-  918793,
-  918794,
-  918795,
-  359781,
-  742790,
-  1114200,
-  1114190,
-  1110632,
-  1110631,
-  1110630,
-  1114180,
-  1352990,
-  1352780,
-  1353110,
-  1352880,
-  343611,
-  1348590,
-  1133560,
-  1198140,
-  323360,
-  212521,
-  288322,
-  1309420,
-  1294580,
-  756750,
-  1189870,
-  1189871,
-  692050,
-  636440,
-  491640,
-  1345060,
-  1336711,
-  352150,
-  1085960,
-  90504,
-  90503,
-  1345961,
-  1345962,
-  1199870,
-  861800,
-  353311,
-  345191,
-  278611,
-  988020,
-  1255081,
-  1255075,
-  1255074,
-  1255073,
-  422180,
-  552820,
-  319240,
-  1346580,
-  1116630,
-  1297051,
-  338882,
-  1042710,
-  435770,
-  1255120,
-  1346920,
-  984741,
-  1233320,
-  339760,
-  339620,
-  339630,
-  338920,
-  892580,
-  1301800,
-  730500,
-  1078190,
-  1262740,
-  1172110,
-  1123540,
-  1055910,
-  651130,
-  1342760,
-  1342670,
-  325964,
-  1337440,
-  1109208,
-  356410,
-  642803,
-  874850,
-  984130,
-  381160,
-  381161,
-  381162,
-  307390,
-  1188360,
-  1347370,
-  357660,
-  304491,
-  383310,
-  591500,
-  591499,
-  591498,
-  591497,
-  591496,
-  591492,
-  591490,
-  591491,
-  589651,
-  577312,
-  577310,
-  565324,
-  565322,
-  565321,
-  565320,
-  553073,
-  553072,
-  553071,
-  553070,
-  543811,
-  543810,
-  524420,
-  509900,
-  509521,
-  502841,
-  502840,
-  501172,
-  480594,
-  480593,
-  480592,
-  480591,
-  480590,
-  476010,
-  467500,
-  467260,
-  591505,
-  591504,
-  591502,
-  591501,
-  734868,
-  734867,
-  734865,
-  734864,
-  734863,
-  734862,
-  734861,
-  734860,
-  591509,
-  591508,
-  591506,
-  734869,
-  957900,
-  957901,
-  957902,
-  957917,
-  957916,
-  957915,
-  957913,
-  957912,
-  957911,
-  957910,
-  957906,
-  957905,
-  957904,
-  957903,
-  957919,
-  957920,
-  957921,
-  1088481,
-  1088487,
-  1088488,
-  1088489,
-  1088490,
-  1088495,
-  1088499,
-  1347341,
-  1347340,
-  807520,
-  1330212,
-  1330213,
-  1331113,
-  1331114,
-  1331140,
-  802570,
-  1219660,
-  1278310,
-  1278311,
-  1279354,
-  1279355,
-  1279357,
-  1278131,
-  1264460,
-  1278315,
-  1278314,
-  1278313,
-  1278312,
-  1238890,
-  1278130,
-  1238830,
-  1279010,
-  1279011,
-  1279012,
-  1279013,
-  1279340,
-  1279341,
-  1279350,
-  1279351,
-  1279352,
-  1279353,
-  1279356,
-  1290424,
-  1290423,
-  1264172,
-  1290422,
-  1290420,
-  1237960,
-  1253170,
-  1317495,
-  1317494,
-  1317493,
-  1276020,
-  1317491,
-  1317490,
-  1317489,
-  1317488,
-  1317487,
-  1317486,
-  1317485,
-  1237990,
-  1317484,
-  1254080,
-  1317483,
-  1254081,
-  1317482,
-  1254082,
-  1317481,
-  1317476,
-  1254083,
-  1254084,
-  1317475,
-  1317474,
-  1317473,
-  1317472,
-  1254090,
-  1317471,
-  1317470,
-  753282,
-  920601,
-  1234210,
-  1315960,
-  258353,
-  1346820,
-  1345310,
-  1345620,
-  1345920,
-  407540,
-  1176184,
-  1176183,
-  1176182,
-  1176181,
-  1176159,
-  1176157,
-  1176154,
-  1176152,
-  1176151,
-  1176150,
-  464970,
-  464730,
-  1122790,
-  542380,
-  317150,
-  40408,
-  238950,
-  40406,
-  40403,
-  40407,
-  238900,
-  1335690,
-  1336900,
-  1336901,
-  1256240,
-  1184240,
-  524041,
-  1045360,
-  372710,
-  437560,
-  531601,
-  531600,
-  1337470,
-  1337490,
-  1184200,
-  1052780,
-  1304230,
-  883210,
-  1344280,
-  1344100,
-  1345230,
-  1345231,
-  1345232,
-  1345233,
-  920600,
-  1131850,
-  1332980,
-  1094860,
-  1319870,
-  1238640,
-  774971,
-  1319810,
-  803190,
-  861955,
-  861954,
-  861953,
-  861952,
-  861951,
-  861950,
-  937480,
-  1070600,
-  1070602,
-  1226770,
-  1069330,
-  932400,
-  953010,
-  954820,
-  485990,
-  1336710,
-  1023660,
-  965101,
-  1105320,
-  1168380,
-  233010,
-  362170,
-  1282681,
-  1282680,
-  1332400,
-  1342570,
-  407450,
-  407451,
-  1333140,
-  1344000,
-  1344040,
-  1290590,
-  1342840,
-  1342831,
-  1342830,
-  1344650,
-  1338270,
-  1159311,
-  388760,
-  1067680,
-  1003250,
-  1129040,
-  1180950,
-  1338070,
-  1342190,
-  228580,
-  1334680,
-  1276420,
-  1337360,
-  321380,
-  1330210,
-  1330211,
-  1331112,
-  1331130,
-  979466,
-  1007341,
-  904123,
-  1308934,
-  1308935,
-  1285333,
-  1285334,
-  1285335,
-  1285336,
-  1285337,
-  1285338,
-  1285339,
-  1285340,
-  1285341,
-  1285342,
-  1285343,
-  1285344,
-  1285332,
-  1295727,
-  1295726,
-  1295725,
-  1295724,
-  1295723,
-  1295722,
-  1295721,
-  1295720,
-  1295719,
-  1295718,
-  1295717,
-  1295716,
-  1295715,
-  1295714,
-  1295713,
-  1295712,
-  1290410,
-  1238381,
-  1255348,
-  1255347,
-  1255349,
-  1255346,
-  1255350,
-  1255345,
-  1255351,
-  1255344,
-  1255352,
-  1255343,
-  1255360,
-  1255342,
-  1255361,
-  1255341,
-  1255340,
-  1302010,
-  1308933,
-  1308932,
-  1308930,
-  1282780,
-  1295710,
-  1283300,
-  1238380,
-  1262292,
-  1294790,
-  1282800,
-  1294930,
-  1285330,
-  1284710,
-  1284712,
-  1157500,
-  1157510,
-  1309070,
-  1340461,
-  1340464,
-  1340463,
-  1340590,
-  1340462,
-  1314950,
-  1096830,
-  720440,
-  583681,
-  583691,
-  751850,
-  1083900,
-  585510,
-  726560,
-  1243710,
-  1164218,
-  1164216,
-  1164213,
-  1164211,
-  1164215,
-  352184,
-  1080002,
-  636290,
-  1339910,
-  1332480,
-  1314951,
-  1324741,
-  1313500,
-  1219850,
-  874050,
-  222604,
-  1150100,
-  748100,
-  249091,
-  632650,
-  1327420,
-  1131030,
-  1262743,
-  697380,
-  697410,
-  928580,
-  741540,
-  699060,
-  699070,
-  648200,
-  656670,
-  348970,
-  432440,
-  525970,
-  525971,
-  640940,
-  626650,
-  1287581,
-  1025100,
-  1071980,
-  988230,
-  988220,
-  988210,
-  965430,
-  942180,
-  887030,
-  1073660,
-  1065370,
-  1224660,
-  1224661,
-  1224662,
-  1224663,
-  1224664,
-  1224665,
-  1224666,
-  1224667,
-  1224668,
-  1224669,
-  307550,
-  569710,
-  1303081,
-  318980,
-  318990,
-  271800,
-  271802,
-  977970,
-  1007170,
-  945380,
-  896480,
-  835590,
-  1334710,
-  696300,
-  1288010,
-  1309250,
-  1316340,
-  1090110,
-  1019000,
-  437640,
-  1335650,
-  565800,
-  1224898,
-  1045540,
-  1191970,
-  1145540,
-  1302500,
-  803510,
-  1331111,
-  1296710,
-  1296740,
-  1296760,
-  1317300,
-  1287582,
-  1287580,
-  1234570,
-  1327330,
-  802460,
-  267786,
-  1168516,
-  1262741,
-  1265670,
-  1331270,
-  1314060,
-  1314061,
-  1314062,
-  1321290,
-  995652,
-  1337560,
-  338721,
-  1335740,
-  1335750,
-  394050,
-  396780,
-  896766,
-  1268391,
-  494522,
-  317660,
-  1203640,
-  39180,
-  39181,
-  39182,
-  39183,
-  558840,
-  944890,
-  378950,
-  1328340,
-  1176623,
-  1176621,
-  1176622,
-  1262200,
-  1331160,
-  1331110,
-  1279210,
-  1206688,
-  1214620,
-  1018440,
-  1276341,
-  1083980,
-  1231020,
-  1315760,
-  747600,
-  408970,
-  421081,
-  907756,
-  907755,
-  907753,
-  907754,
-  907752,
-  907751,
-  907300,
-  907750,
-  1115200,
-  1115230,
-  1328950,
-  1328960,
-  1326720,
-  1326730,
-  1330320,
-  1328341,
-  736800,
-  1037160,
-  1285030,
-  1327410,
-  1332520,
-  1002090,
-  354260,
-  1265100,
-  1278120,
-  1324740,
-  1324700,
-  723460,
-  1133410,
-  1294140,
-  1294130,
-  775280,
-  1328880,
-  1318320,
-  1324240,
-  1067920,
-  980430,
-  1195030,
-  1195040,
-  1195050,
-  1195060,
-  1257490,
-  1040100,
-  961830,
-  1169720,
-  1159323,
-  995560,
-  1328420,
-  1296711,
-  1296712,
-  1296741,
-  1296761,
-  234570,
-  1260070,
-  1102660,
-  1115340,
-  1115350,
-  1115370,
-  1115310,
-  1115330,
-  1115300,
-  1115290,
-  1115250,
-  1115260,
-  1115220,
-  1115270,
-  1115210,
-  1115190,
-  1115320,
-  1319490,
-  1316810,
-  307971,
-  307970,
-  1287320,
-  1287321,
-  1306810,
-  1104970,
-  447660,
-  1233372,
-  1308260,
-  1144960,
-  896767,
-  632610,
-  617780,
-  639060,
-  639061,
-  639062,
-  639063,
-  639064,
-  639065,
-  639066,
-  617051,
-  639067,
-  640180,
-  640960,
-  617050,
-  718630,
-  1287323,
-  1287324,
-  1287322,
-  777290,
-  525188,
-  487560,
-  746460,
-  612490,
-  546850,
-  509040,
-  546190,
-  546191,
-  546192,
-  546193,
-  546194,
-  546195,
-  546196,
-  414650,
-  363700,
-  363701,
-  363702,
-  363703,
-  354390,
-  352860,
-  352861,
-  352862,
-  353120,
-  352870,
-  352871,
-  352872,
-  352873,
-  352874,
-  352875,
-  343980,
-  343981,
-  343982,
-  876731,
-  876730,
-  254290,
-  254291,
-  1196020,
-  1166181,
-  1086730,
-  423960,
-  320740,
-  278031,
-  281510,
-  206550,
-  206560,
-  206570,
-  206580,
-  206590,
-  73055,
-  278030,
-  281511,
-  320720,
-  320721,
-  320730,
-  320750,
-  1266717,
-  1266718,
-  1266719,
-  1291885,
-  1291886,
-  1291887,
-  1291888,
-  1291889,
-  1266710,
-  1266711,
-  1266712,
-  1266713,
-  1266714,
-  1266715,
-  1266716,
-  1265710,
-  318270,
-  318271,
-  318272,
-  318280,
-  318281,
-  287620,
-  316120,
-  316121,
-  316130,
-  316131,
-  225424,
-  225426,
-  225429,
-  225430,
-  225431,
-  225432,
-  225434,
-  306170,
-  306171,
-  310050,
-  73183,
-  73014,
-  73013,
-  73012,
-  73185,
-  73187,
-  206710,
-  206712,
-  206716,
-  206718,
-  206720,
-  310040,
-  230920,
-  230900,
-  222221,
-  222222,
-  222223,
-  25811,
-  25810,
-  25809,
-  617962,
-  358662,
-  367720,
-  349184,
-  349185,
-  358660,
-  358661,
-  351130,
-  351131,
-  351132,
-  349180,
-  349181,
-  349182,
-  349183,
-  329081,
-  25812,
-  25813,
-  25814,
-  25815,
-  25816,
-  25817,
-  734070,
-  344550,
-  1109510,
-  1100060,
-  42967,
-  1329920,
-  554840,
-  25898,
-  25960,
-  214981,
-  616160,
-  616180,
-  1021741,
-  1329263,
-  524174,
-  524175,
-  524176,
-  524171,
-  524173,
-  524172,
-  524170,
-  348990,
-  1266750,
-  1227620,
-  234792,
-  1277280,
-  1025730,
-  1025700,
-  961300,
-  961290,
-  1012150,
-  1000190,
-  1311920,
-  494570,
-  640190,
-  1249340,
-  630950,
-  941241,
-  1015490,
-  391610,
-  1318720,
-  587380,
-  1115360,
-  1115150,
-  209421,
-  209422,
-  209423,
-  209425,
-  209426,
-  209427,
-  209428,
-  958940,
-  1250500,
-  24488,
-  947760,
-  455380,
-  1296742,
-  1296762,
-  1296713,
-  1296714,
-  1191010,
-  638330,
-  800810,
-  853014,
-  783508,
-  783546,
-  542500,
-  564890,
-  554371,
-  553271,
-  553270,
-  551919,
-  551917,
-  551912,
-  551910,
-  551590,
-  457070,
-  822091,
-  822090,
-  783870,
-  809740,
-  960290,
-  1034510,
-  1141790,
-  1076740,
-  1049120,
-  1158240,
-  1254240,
-  1276340,
-  1042870,
-  268613,
-  249923,
-  268612,
-  271960,
-  277840,
-  285462,
-  297640,
-  283542,
-  291472,
-  325502,
-  330630,
-  333090,
-  462211,
-  462213,
-  462212,
-  462084,
-  646560,
-  618770,
-  801571,
-  783501,
-  783500,
-  783541,
-  783540,
-  853015,
-  852996,
-  892941,
-  462085,
-  919180,
-  892942,
-  888494,
-  929190,
-  462082,
-  957537,
-  462214,
-  957532,
-  462210,
-  618680,
-  406075,
-  321180,
-  806521,
-  924050,
-  618660,
-  893000,
-  806500,
-  957539,
-  525440,
-  333091,
-  801561,
-  646550,
-  329821,
-  337900,
-  291470,
-  888517,
-  462086,
-  406077,
-  325503,
-  271962,
-  265460,
-  831310,
-  957535,
-  868112,
-  957536,
-  814390,
-  868111,
-  868110,
-  842941,
-  842940,
-  285460,
-  229751,
-  268611,
-  249921,
-  297643,
-  525282,
-  793770,
-  793771,
-  755754,
-  525281,
-  455521,
-  932643,
-  755753,
-  618662,
-  852993,
-  852992,
-  1315290,
-  721051,
-  618682,
-  337902,
-  904200,
-  958150,
-  957534,
-  755742,
-  721053,
-  783502,
-  542501,
-  815820,
-  867020,
-  755755,
-  815750,
-  797671,
-  542491,
-  815810,
-  867030,
-  321182,
-  406076,
-  462087,
-  947740,
-  325501,
-  249922,
-  653721,
-  653722,
-  618681,
-  801570,
-  462081,
-  755744,
-  783506,
-  783507,
-  932621,
-  329820,
-  618663,
-  852991,
-  875152,
-  755757,
-  801560,
-  783544,
-  932644,
-  337901,
-  271963,
-  357260,
-  332292,
-  291473,
-  721052,
-  330631,
-  406074,
-  325500,
-  277843,
-  406073,
-  283541,
-  755752,
-  809630,
-  932641,
-  806501,
-  835471,
-  356231,
-  809650,
-  835460,
-  321170,
-  277841,
-  271961,
-  871260,
-  809631,
-  835470,
-  904124,
-  904125,
-  867100,
-  703471,
-  321181,
-  332293,
-  618771,
-  265462,
-  297642,
-  297641,
-  653892,
-  462088,
-  653891,
-  525442,
-  888492,
-  703461,
-  798210,
-  831311,
-  831312,
-  653727,
-  618664,
-  969653,
-  455224,
-  377420,
-  1224790,
-  653726,
-  525284,
-  797670,
-  969652,
-  969651,
-  888490,
-  721050,
-  755743,
-  455222,
-  455221,
-  755756,
-  321100,
-  958140,
-  789790,
-  357262,
-  258741,
-  923920,
-  332291,
-  332290,
-  947770,
-  406078,
-  258745,
-  783504,
-  957600,
-  525441,
-  291474,
-  789810,
-  462089,
-  789811,
-  783505,
-  249920,
-  783503,
-  406072,
-  957530,
-  924051,
-  904122,
-  957533,
-  904121,
-  947741,
-  904120,
-  783543,
-  957531,
-  525283,
-  789800,
-  904126,
-  789801,
-  797672,
-  892940,
-  904127,
-  783542,
-  861730,
-  949760,
-  949750,
-  969658,
-  980270,
-  979464,
-  979465,
-  980330,
-  980272,
-  969659,
-  980271,
-  979470,
-  979467,
-  979469,
-  979468,
-  993921,
-  993922,
-  993920,
-  993923,
-  993912,
-  993924,
-  993926,
-  993927,
-  993928,
-  993930,
-  993929,
-  993940,
-  993932,
-  993911,
-  993925,
-  993931,
-  1006960,
-  1006971,
-  1006962,
-  1278550,
-  1278551,
-  698203,
-  698204,
-  698205,
-  698206,
-  698207,
-  698208,
-  698209,
-  698210,
-  698211,
-  698212,
-  698213,
-  698214,
-  698215,
-  698216,
-  698217,
-  698218,
-  698219,
-  698220,
-  698221,
-  698222,
-  698180,
-  698190,
-  698200,
-  698201,
-  698202,
-  445560,
-  1033621,
-  933350,
-  1153500,
-  1006974,
-  1033620,
-  1075970,
-  904220,
-  969800,
-  1006964,
-  1006981,
-  841910,
-  767190,
-  1019210,
-  1019120,
-  1254213,
-  1214115,
-  1214113,
-  1020040,
-  1195950,
-  1195930,
-  1178980,
-  1019213,
-  1164240,
-  1019132,
-  904210,
-  1006990,
-  841900,
-  1020070,
-  1033520,
-  1033503,
-  1051392,
-  1051434,
-  1051433,
-  1051450,
-  933330,
-  1124750,
-  1051390,
-  1062492,
-  1110160,
-  958160,
-  1051431,
-  1124760,
-  1075100,
-  1075103,
-  1178970,
-  1097890,
-  653890,
-  1033522,
-  932622,
-  1109562,
-  1153490,
-  333410,
-  1110141,
-  888514,
-  356230,
-  1109563,
-  1033521,
-  1075010,
-  277844,
-  764331,
-  764330,
-  1124111,
-  853012,
-  871250,
-  265464,
-  330650,
-  1097392,
-  764320,
-  543520,
-  283540,
-  1124110,
-  277846,
-  871241,
-  1124151,
-  871240,
-  888497,
-  1109560,
-  888498,
-  1124153,
-  888495,
-  888496,
-  1124152,
-  888499,
-  1195880,
-  1124114,
-  888510,
-  1254193,
-  1214095,
-  1214093,
-  1195884,
-  1195881,
-  1164200,
-  1124156,
-  1178933,
-  265465,
-  888511,
-  853011,
-  888516,
-  297645,
-  1019211,
-  1051391,
-  1143580,
-  1153420,
-  1164150,
-  1164219,
-  1124155,
-  932620,
-  1195906,
-  690430,
-  1153443,
-  653860,
-  1124115,
-  1164160,
-  1110140,
-  755740,
-  653861,
-  1164212,
-  1195900,
-  1178874,
-  932642,
-  820720,
-  1267340,
-  1164230,
-  1164170,
-  1246890,
-  1075104,
-  1006982,
-  1006970,
-  848110,
-  1254171,
-  1051430,
-  875151,
-  815160,
-  229755,
-  861731,
-  698223,
-  698224,
-  698225,
-  698226,
-  723320,
-  618700,
-  1097990,
-  1110150,
-  755072,
-  851910,
-  1110170,
-  1178960,
-  969820,
-  1110180,
-  453160,
-  778480,
-  703470,
-  755073,
-  755741,
-  892270,
-  892260,
-  933340,
-  904190,
-  851900,
-  755071,
-  1124116,
-  1124113,
-  1127510,
-  1178932,
-  888513,
-  653725,
-  755070,
-  1033502,
-  929192,
-  1153442,
-  1254211,
-  1254212,
-  1229870,
-  1229860,
-  1214116,
-  754470,
-  573640,
-  572400,
-  1033501,
-  485010,
-  1214114,
-  1214112,
-  969790,
-  969780,
-  1164220,
-  993950,
-  853013,
-  1178930,
-  966495,
-  1011174,
-  1110143,
-  888491,
-  277845,
-  1254191,
-  966498,
-  966497,
-  917018,
-  988043,
-  1254192,
-  1229850,
-  1229840,
-  1214096,
-  1214094,
-  1270250,
-  1036796,
-  917015,
-  1036792,
-  1044141,
-  988045,
-  808941,
-  988040,
-  988017,
-  1011172,
-  988010,
-  966525,
-  808936,
-  1214092,
-  1214090,
-  1164190,
-  1036794,
-  1011170,
-  917030,
-  1011177,
-  1044234,
-  988046,
-  1044233,
-  954606,
-  954607,
-  966493,
-  1011178,
-  988021,
-  988044,
-  988041,
-  1044140,
-  1097391,
-  966490,
-  1164130,
-  1164180,
-  993910,
-  1097390,
-  1044232,
-  966529,
-  966528,
-  966499,
-  808934,
-  808940,
-  988012,
-  954605,
-  988011,
-  988018,
-  954602,
-  966522,
-  966520,
-  808931,
-  917032,
-  917040,
-  917016,
-  988016,
-  558641,
-  1044231,
-  917033,
-  1036790,
-  558640,
-  966521,
-  966526,
-  954604,
-  966523,
-  988013,
-  988019,
-  1011176,
-  1011179,
-  988042,
-  1011175,
-  917014,
-  1036799,
-  954609,
-  988015,
-  988047,
-  1036798,
-  966524,
-  966491,
-  808937,
-  954601,
-  917010,
-  917017,
-  808938,
-  966494,
-  988014,
-  1044230,
-  917019,
-  916070,
-  1036793,
-  966492,
-  917011,
-  1011171,
-  917012,
-  966527,
-  297142,
-  680160,
-  445710,
-  297140,
-  403050,
-  403051,
-  297141,
-  403052,
-  283551,
-  1006963,
-  852994,
-  1178876,
-  969657,
-  283552,
-  283550,
-  1109565,
-  892240,
-  875153,
-  1254174,
-  1254173,
-  954600,
-  808930,
-  917013,
-  1011173,
-  808935,
-  808939,
-  1075105,
-  809632,
-  969656,
-  1036791,
-  1036795,
-  1229820,
-  1229830,
-  1213380,
-  1213382,
-  1213384,
-  745912,
-  834040,
-  745910,
-  745911,
-  1213386,
-  969655,
-  969654,
-  1097895,
-  510100,
-  638950,
-  578110,
-  540040,
-  488650,
-  530480,
-  1164214,
-  353060,
-  993933,
-  1097894,
-  1006980,
-  433021,
-  366740,
-  1097891,
-  1153440,
-  1153423,
-  1153441,
-  1062491,
-  841821,
-  875150,
-  1097896,
-  1178873,
-  1062490,
-  1097970,
-  1097980,
-  861753,
-  861752,
-  1097892,
-  861751,
-  1097893,
-  1178931,
-  861750,
-  491403,
-  491402,
-  1178877,
-  1153422,
-  1153421,
-  979463,
-  979462,
-  979461,
-  1178935,
-  979460,
-  1178921,
-  491401,
-  491400,
-  624850,
-  542640,
-  1254170,
-  1213381,
-  1178934,
-  1213383,
-  1195904,
-  1195901,
-  957538,
-  1178875,
-  473960,
-  1178920,
-  1178990,
-  1178936,
-  1178922,
-  1195940,
-  1195883,
-  1195902,
-  1195960,
-  1195885,
-  592291,
-  1195905,
-  1195970,
-  1214111,
-  1214091,
-  1213385,
-  1214730,
-  1238770,
-  1246900,
-  1254172,
-  1254890,
-  1254210,
-  1254190,
-  1254176,
-  1267380,
-  1267360,
-  1267341,
-  599440,
-  1006972,
-  841820,
-  510200,
-  1019130,
-  1051432,
-  932640,
-  367530,
-  572381,
-  540681,
-  428603,
-  653723,
-  1124157,
-  1109561,
-  572380,
-  1296763,
-  1267384,
-  1267383,
-  1267382,
-  755750,
-  653724,
-  450480,
-  572382,
-  1267381,
-  1267490,
-  1296743,
-  1296744,
-  1267363,
-  428600,
-  957541,
-  428601,
-  540682,
-  496972,
-  1267365,
-  428604,
-  1267364,
-  1267362,
-  428605,
-  1267361,
-  1267480,
-  496970,
-  496971,
-  1288080,
-  1296715,
-  1267344,
-  1267346,
-  1267345,
-  703460,
-  540680,
-  755751,
-  1267343,
-  1124158,
-  1124154,
-  1267342,
-  326310,
-  1267440,
-  373090,
-  434950,
-  1178878,
-  631500,
-  366730,
-  329823,
-  476050,
-  937540,
-  1169220,
-  1153360,
-  743810,
-  1163180,
-  906670,
-  937660,
-  1208010,
-  1208011,
-  1159380,
-  1215450,
-  1180920,
-  1197560,
-  576530,
-  576520,
-  1105840,
-  429880,
-  429881,
-  392250,
-  768730,
-  1102360,
-  779940,
-  1020572,
-  758774,
-  1315570,
-  940480,
-  1095050,
-  693000,
-  993060,
-  985610,
-  947750,
-  1262303,
-  1262302,
-  1262304,
-  1309020,
-  1315010,
-  1307420,
-  261161,
-  364280,
-  364281,
-  364282,
-  1309156,
-  1309153,
-  1309152,
-  1309154,
-  1309155,
-  1309159,
-  1309151,
-  1309150,
-  1302521,
-  1310730,
-  1310731,
-  1304590,
-  1312720,
-  1303150,
-  1307290,
-  1312414,
-  1303082,
-  1312413,
-  1312411,
-  1312412,
-  1303080,
-  1312410,
-  1302522,
-  1302520,
-  961100,
-  476871,
-  488812,
-  500390,
-  1231690,
-  1315460,
-  1208940,
-  1205890,
-  282580,
-  776300,
-  778880,
-  778881,
-  1287770,
-  222606,
-  1296891,
-  1296890,
-  1306830,
-  1289740,
-  1284720,
-  1248181,
-  1248182,
-  991011,
-  991010,
-  1267900,
-  379545,
-  891451,
-  891450,
-  1217676,
-  1261190,
-  1268300,
-  1000250,
-  1314150,
-  325957,
-  325975,
-  376937,
-  222629,
-  1314790,
-  379243,
-  293057,
-  1078030,
-  807640,
-  808440,
-  969920,
-  1276780,
-  1276781,
-  1306230,
-  409750,
-  1304240,
-  1303910,
-  793545,
-  578340,
-  667750,
-  1179494,
-  1132871,
-  1288150,
-  896610,
-  1224868,
-  1175680,
-  1131320,
-  1208820,
-  1308010,
-  1285590,
-  1285592,
-  1285593,
-  1285591,
-  696240,
-  663620,
-  1292430,
-  1131350,
-  626561,
-  1249900,
-  1247600,
-  1249903,
-  1249902,
-  1249901,
-  338723,
-  353620,
-  1012270,
-  646667,
-  718800,
-  653580,
-  1284920,
-  1284970,
-  799010,
-  1174520,
-  1286820,
-  753281,
-  895240,
-  895250,
-  747290,
-  895260,
-  744740,
-  895270,
-  895280,
-  895290,
-  952900,
-  895300,
-  1064810,
-  823020,
-  518710,
-  538720,
-  1291780,
-  843672,
-  843670,
-  425540,
-  867270,
-  562780,
-  559780,
-  560630,
-  1282490,
-  1286960,
-  937880,
-  896765,
-  1305360,
-  854290,
-  1149780,
-  1149781,
-  208294,
-  1237850,
-  989220,
-  222615,
-  1190291,
-  1287570,
-  708621,
-  541900,
-  1274080,
-  1233050,
-  1303830,
-  1224872,
-  1292230,
-  1015840,
-  1069550,
-  1254241,
-  1150870,
-  1160571,
-  1160570,
-  1160573,
-  1290380,
-  1085740,
-  1123580,
-  982190,
-  908472,
-  908473,
-  908474,
-  908461,
-  908460,
-  1291960,
-  1004480,
-  1245320,
-  35723,
-  1070603,
-  713270,
-  1190470,
-  956260,
-  956080,
-  961810,
-  1080840,
-  1182120,
-  1019960,
-  1154260,
-  70603,
-  70604,
-  70605,
-  70606,
-  70607,
-  200172,
-  200173,
-  200174,
-  200175,
-  200176,
-  200177,
-  200178,
-  200179,
-  200180,
-  200189,
-  1290917,
-  1290915,
-  1290916,
-  1290918,
-  1206580,
-  1203150,
-  1220700,
-  1220730,
-  265060,
-  378520,
-  378521,
-  715780,
-  638050,
-  605460,
-  1297460,
-  1290913,
-  1290914,
-  1290910,
-  1290890,
-  1290911,
-  1290912,
-  1292320,
-  1224867,
-  1224877,
-  1294800,
-  1291930,
-  1157690,
-  674000,
-  1079920,
-  425541,
-  1286540,
-  1290690,
-  540520,
-  22635,
-  22636,
-  968273,
-  899902,
-  615930,
-  206523,
-  206526,
-  720460,
-  258540,
-  258542,
-  988690,
-  1290800,
-  1290870,
-  1290970,
-  246030,
-  246010,
-  279090,
-  1018530,
-  1256050,
-  917210,
-  271428,
-  510350,
-  639620,
-  1186010,
-  1292640,
-  1269754,
-  1269753,
-  1269752,
-  1269751,
-  1269750,
-  1269749,
-  1269747,
-  1269744,
-  1269741,
-  1269740,
-  521960,
-  521961,
-  1123630,
-  1123631,
-  1123632,
-  1123633,
-  1123634,
-  486200,
-  435519,
-  561990,
-  1248340,
-  1293410,
-  1273962,
-  297840,
-  297842,
-  486530,
-  486560,
-  1224895,
-  338370,
-  338371,
-  338372,
-  568013,
-  1291480,
-  1181680,
-  286961,
-  286962,
-  286964,
-  286965,
-  286970,
-  286972,
-  1120570,
-  984970,
-  896830,
-  346360,
-  561030,
-  500080,
-  499550,
-  440050,
-  440030,
-  1002620,
-  959060,
-  762600,
-  376963,
-  439500,
-  1196860,
-  1223790,
-  462280,
-  1273961,
-  1273963,
-  1273960,
-  1128701,
-  331068,
-  891830,
-  1094810,
-  947950,
-  1083833,
-  1083832,
-  1083831,
-  1083830,
-  356440,
-  1094800,
-  1055550,
-  376941,
-  642801,
-  642808,
-  1105541,
-  1080911,
-  383860,
-  1008660,
-  1255490,
-  642640,
-  542600,
-  246253,
-  585160,
-  966710,
-  587170,
-  348683,
-  790011,
-  208282,
-  588270,
-  342851,
-  445661,
-  539710,
-  268113,
-  1224897,
-  1224864,
-  1224865,
-  1224870,
-  1224871,
-  1224873,
-  1224874,
-  1224875,
-  1224876,
-  1224878,
-  1224879,
-  1224891,
-  1224892,
-  1224893,
-  1224894,
-  1224896,
-  1224851,
-  1224852,
-  1224853,
-  1224854,
-  1224855,
-  1224857,
-  1224860,
-  1224861,
-  1224862,
-  1224863,
-  342779,
-  369762,
-  342845,
-  342789,
-  342775,
-  436593,
-  369807,
-  369815,
-  342825,
-  342811,
-  369827,
-  390361,
-  342831,
-  342800,
-  342796,
-  342797,
-  342798,
-  342799,
-  342835,
-  342832,
-  342833,
-  342834,
-  1027760,
-  1192370,
-  905730,
-  1192371,
-  1291980,
-  504970,
-  322480,
-  1009970,
-  379241,
-  770580,
-  239370,
-  1182870,
-  1198146,
-  1276503,
-  1276522,
-  1276523,
-  1276524,
-  1276525,
-  1276501,
-  1276521,
-  1276520,
-  1276502,
-  1276500,
-  750490,
-  1289731,
-  1289730,
-  1194430,
-  1187680,
-  342821,
-  342858,
-  369797,
-  1286050,
-  1286090,
-  974350,
-  974351,
-  974352,
-  974353,
-  974354,
-  974360,
-  974361,
-  974362,
-  974363,
-  974364,
-  736630,
-  1182330,
-  736640,
-  1182340,
-  736650,
-  736660,
-  1182360,
-  736670,
-  736680,
-  1182380,
-  1182390,
-  1182400,
-  1185990,
-  1186000,
-  408690,
-  411510,
-  402350,
-  412080,
-  526670,
-  464270,
-  464290,
-  464300,
-  464310,
-  464320,
-  607250,
-  438850,
-  438860,
-  438870,
-  1089730,
-  1089740,
-  297990,
-  373200,
-  392420,
-  297960,
-  392430,
-  297980,
-  515110,
-  515120,
-  347450,
-  352570,
-  515130,
-  515140,
-  903240,
-  903241,
-  903242,
-  903243,
-  563790,
-  903246,
-  515150,
-  903247,
-  903248,
-  903249,
-  571730,
-  903250,
-  903251,
-  903252,
-  903253,
-  515160,
-  900700,
-  350560,
-  900710,
-  900470,
-  900480,
-  562060,
-  900510,
-  900550,
-  592840,
-  900560,
-  592850,
-  900570,
-  900580,
-  1259010,
-  1193320,
-  1251230,
-  1253540,
-  1107380,
-  1217675,
-  295068,
-  294981,
-  295093,
-  294971,
-  295084,
-  295083,
-  295082,
-  295085,
-  295074,
-  295075,
-  295076,
-  295077,
-  295072,
-  295071,
-  295070,
-  295073,
-  295086,
-  295017,
-  294985,
-  294957,
-  295056,
-  294977,
-  295032,
-  295018,
-  295019,
-  295020,
-  295021,
-  295023,
-  914280,
-  565002,
-  565090,
-  668050,
-  668060,
-  533601,
-  444030,
-  444031,
-  444032,
-  1224763,
-  670743,
-  533600,
-  606320,
-  1195167,
-  258381,
-  258382,
-  258380,
-  258379,
-  258378,
-  295064,
-  295069,
-  271431,
-  258419,
-  271469,
-  294912,
-  258357,
-  258401,
-  294939,
-  258389,
-  258390,
-  258388,
-  258391,
-  294918,
-  271478,
-  294948,
-  258371,
-  294903,
-  294902,
-  294901,
-  294900,
-  258362,
-  258361,
-  258360,
-  258359,
-  258358,
-  258363,
-  271470,
-  271471,
-  271472,
-  271473,
-  271474,
-  271414,
-  271413,
-  271412,
-  271411,
-  271410,
-  271415,
-  271439,
-  271421,
-  271462,
-  271461,
-  271460,
-  271459,
-  271458,
-  271420,
-  271463,
-  294905,
-  294906,
-  294907,
-  294908,
-  1278340,
-  900446,
-  900440,
-  418930,
-  1261510,
-  1214800,
-  295005,
-  271444,
-  451370,
-  505180,
-  222587,
-  1248160,
-  1275020,
-  99909,
-  1042810,
-  735170,
-  870540,
-  1154592,
-  1205810,
-  1209641,
-  1159310,
-  353970,
-  748291,
-  1218860,
-  929880,
-  323931,
-  433746,
-  1216681,
-  1281000,
-  1281060,
-  1254850,
-  1254851,
-  1192300,
-  1191810,
-  1189620,
-  728180,
-  647760,
-  617410,
-  1246700,
-  294904,
-  295044,
-  258407,
-  973611,
-  1136000,
-  1030560,
-  1030561,
-  1030562,
-  1030563,
-  925871,
-  500215,
-  579541,
-  1278850,
-  1207720,
-  1198165,
-  654176,
-  326621,
-  322960,
-  536700,
-  1281960,
-  1179200,
-  527180,
-  1276650,
-  295057,
-  295058,
-  295059,
-  295060,
-  295061,
-  271426,
-  271427,
-  271429,
-  271430,
-  509675,
-  899859,
-  899860,
-  899861,
-  899862,
-  753811,
-  753812,
-  753813,
-  753814,
-  271489,
-  271490,
-  271491,
-  295079,
-  295080,
-  436599,
-  436600,
-  436601,
-  436602,
-  1174360,
-  1192400,
-  1141800,
-  1158241,
-  1101710,
-  1101711,
-  1101712,
-  1076741,
-  1034511,
-  1049121,
-  1021742,
-  1021740,
-  1255850,
-  736100,
-  577450,
-  1007251,
-  1159140,
-  658370,
-  658380,
-  658381,
-  658382,
-  658383,
-  658384,
-  658385,
-  658386,
-  1266500,
-  1266502,
-  1266503,
-  1203070,
-  1203080,
-  1007550,
-  975300,
-  1122663,
-  1122664,
-  1122662,
-  1122661,
-  1230250,
-  1268210,
-  575501,
-  575500,
-  893981,
-  893983,
-  893984,
-  893980,
-  572210,
-  975303,
-  975302,
-  932610,
-  1086740,
-  1205786,
-  933410,
-  967981,
-  1138480,
-  1218630,
-  1266510,
-  1074275,
-  1166180,
-  962410,
-  1273460,
-  1224821,
-  1224823,
-  1224832,
-  1207170,
-  1224835,
-  1128850,
-  1273490,
-  1159328,
-  1110700,
-  1110710,
-  1219261,
-  1196490,
-  1196010,
-  1268970,
-  1222891,
-  1278980,
-  1278570,
-  781532,
-  1261712,
-  1261711,
-  1255960,
-  1261710,
-  1276630,
-  1270000,
-  622850,
-  848900,
-  848910,
-  848911,
-  848860,
-  1247681,
-  1206690,
-  1254680,
-  1277990,
-  1270040,
-  1268620,
-  1273860,
-  1276770,
-  1275780,
-  1275100,
-  374260,
-  786010,
-  1221940,
-  1099940,
-  1050380,
-  1050390,
-  1050400,
-  1050401,
-  1050402,
-  1062230,
-  1062280,
-  1062282,
-  1062283,
-  898470,
-  1122890,
-  1009420,
-  1265060,
-  1216956,
-  1216955,
-  1216954,
-  1216953,
-  1216952,
-  1203044,
-  1218632,
-  1256800,
-  609792,
-  609793,
-  609794,
-  609795,
-  609796,
-  609790,
-  609791,
-  611920,
-  611921,
-  611922,
-  611923,
-  611924,
-  611925,
-  611940,
-  611941,
-  611942,
-  822060,
-  822061,
-  1217684,
-  339300,
-  339301,
-  407280,
-  331072,
-  343951,
-  1255950,
-  327191,
-  995950,
-  491498,
-  488821,
-  1222530,
-  1179651,
-  1252880,
-  1252881,
-  369430,
-  1080600,
-  464160,
-  492320,
-  452900,
-  1098301,
-  390470,
-  708180,
-  848991,
-  576610,
-  576611,
-  1080420,
-  576612,
-  1026410,
-  602231,
-  1128060,
-  1246610,
-  1160600,
-  1160603,
-  1105321,
-  1105323,
-  494260,
-  526520,
-  1082040,
-  1080510,
-  494270,
-  552640,
-  552641,
-  552642,
-  526531,
-  552643,
-  526532,
-  997830,
-  552650,
-  552651,
-  552652,
-  552653,
-  1189840,
-  1160661,
-  996310,
-  1160662,
-  996312,
-  1262820,
-  1080570,
-  1247680,
-  946910,
-  1122658,
-  1122659,
-  1122657,
-  1122660,
-  1214950,
-  414600,
-  590810,
-  425791,
-  1261692,
-  1262435,
-  1262408,
-  332120,
-  1261690,
-  1261691,
-  1261693,
-  1261713,
-  1261714,
-  1261715,
-  1261716,
-  1261717,
-  1262340,
-  1262341,
-  1262342,
-  1262343,
-  1262344,
-  1262345,
-  1262346,
-  1262347,
-  1262348,
-  1262349,
-  1262370,
-  1262371,
-  1262372,
-  1262373,
-  1262374,
-  1262375,
-  1262376,
-  1262377,
-  1262378,
-  1262379,
-  1262390,
-  1262391,
-  1262392,
-  1262393,
-  1262394,
-  1262395,
-  1262396,
-  1262397,
-  1262398,
-  1262399,
-  1262400,
-  1262401,
-  1262402,
-  1262403,
-  1262404,
-  1262405,
-  1262406,
-  1262407,
-  1262409,
-  1262410,
-  1262411,
-  1262413,
-  1262414,
-  1262415,
-  1262416,
-  1262417,
-  1262418,
-  1262419,
-  1262420,
-  1262421,
-  1262422,
-  1262423,
-  1262424,
-  1262426,
-  1262427,
-  1262428,
-  1262429,
-  1262430,
-  1262431,
-  1262432,
-  1262433,
-  1262434,
-  1262436,
-  1262437,
-  1262438,
-  1262439,
-  1270090,
-  414780,
-  808760,
-  31420,
-  1272880,
-  639150,
-  698940,
-  702840,
-  741280,
-  741281,
-  741282,
-  741283,
-  741284,
-  741310,
-  741311,
-  741312,
-  741313,
-  741314,
-  698350,
-  698351,
-  698352,
-  698353,
-  698354,
-  698355,
-  698356,
-  698357,
-  698358,
-  698359,
-  670581,
-  670582,
-  670583,
-  670584,
-  670590,
-  670591,
-  670592,
-  645670,
-  645671,
-  1263870,
-  748790,
-  1271231,
-  1271240,
-  914990,
-  1221170,
-  1272180,
-  1136430,
-  1265600,
-  551660,
-  1271800,
-  1249320,
-  405390,
-  455170,
-  1118980,
-  390480,
-  602230,
-  1090171,
-  1232770,
-  1169800,
-  1169801,
-  1160602,
-  1105322,
-  946620,
-  885700,
-  885701,
-  946640,
-  1160660,
-  996311,
-  1160663,
-  1104860,
-  1012201,
-  549110,
-  549111,
-  549112,
-  549113,
-  1211472,
-  1137540,
-  1258450,
-  1206630,
-  729630,
-  908860,
-  1215360,
-  42147,
-  512910,
-  512911,
-  512912,
-  512913,
-  716440,
-  500910,
-  806620,
-  806621,
-  1267780,
-  1106130,
-  306880,
-  1024551,
-  1269742,
-  1269743,
-  1269748,
-  1269755,
-  1269746,
-  1269745,
-  1003540,
-  625920,
-  1241351,
-  376340,
-  1169721,
-  637000,
-  945760,
-  558690,
-  375161,
-  1224826,
-  1263500,
-  941968,
-  1268390,
-  376270,
-  1145851,
-  408510,
-  1254000,
-  1270790,
-  1122653,
-  1122654,
-  1122655,
-  1122656,
-  1122200,
-  1170530,
-  1170531,
-  1170532,
-  1169680,
-  1263040,
-  1118264,
-  1118265,
-  988671,
-  887350,
-  372512,
-  373560,
-  368060,
-  368061,
-  384220,
-  384221,
-  384222,
-  384223,
-  384224,
-  384225,
-  384226,
-  384227,
-  384228,
-  384229,
-  367590,
-  367591,
-  367592,
-  380910,
-  1163812,
-  1163811,
-  1163810,
-  1045560,
-  1079930,
-  1098161,
-  1260900,
-  1259900,
-  1259200,
-  1146521,
-  1146522,
-  829580,
-  379579,
-  718100,
-  1224834,
-  1217673,
-  1217674,
-  1237528,
-  1237522,
-  1237520,
-  1237521,
-  550130,
-  877500,
-  1230740,
-  482200,
-  1257321,
-  1194540,
-  1241341,
-  1241340,
-  1261860,
-  601100,
-  1217687,
-  1217690,
-  1217689,
-  1217688,
-  1217686,
-  1217685,
-  1217683,
-  1217679,
-  1217682,
-  1217677,
-  1217671,
-  1217672,
-  1217692,
-  1217691,
-  751520,
-  1201970,
-  1224762,
-  637001,
-  1074265,
-  1205850,
-  354421,
-  1224822,
-  1224824,
-  1224825,
-  1224830,
-  1224831,
-  1224833,
-  1224836,
-  1212807,
-  742830,
-  800950,
-  914120,
-  1144540,
-  1144541,
-  913630,
-  588780,
-  559860,
-  1261930,
-  481080,
-  113404,
-  1033500,
-  498200,
-  456820,
-  456821,
-  1085450,
-  1205513,
-  1205511,
-  1205512,
-  1205510,
-  1122652,
-  1122650,
-  1122651,
-  1122649,
-  479060,
-  276551,
-  1211670,
-  645171,
-  1247711,
-  616600,
-  379590,
-  1002571,
-  892750,
-  873680,
-  379190,
-  1249251,
-  1249250,
-  1246740,
-  891031,
-  1099211,
-  1264370,
-  504350,
-  222589,
-  928040,
-  1246300,
-  898710,
-  1180150,
-  1099260,
-  580610,
-  583990,
-  583991,
-  583992,
-  583993,
-  583994,
-  1017430,
-  1103990,
-  1038330,
-  1240301,
-  1109203,
-  1246842,
-  1246843,
-  1246840,
-  1246841,
-  1180140,
-  1191162,
-  1035420,
-  1176378,
-  1176379,
-  1245120,
-  788450,
-  1250620,
-  1250621,
-  1250622,
-  859210,
-  323933,
-  1170813,
-  967010,
-  519110,
-  1107880,
-  1250585,
-  1250584,
-  1250583,
-  1250582,
-  1250581,
-  1261340,
-  1250580,
-  1122645,
-  1122646,
-  1122648,
-  1122647,
-  533670,
-  916220,
-  931530,
-  978880,
-  973612,
-  973610,
-  883200,
-  1241350,
-  1241352,
-  1169181,
-  629790,
-  844830,
-  629792,
-  629793,
-  629796,
-  1060391,
-  1224764,
-  1224780,
-  1224783,
-  1224784,
-  1224786,
-  1224788,
-  1224789,
-  1224796,
-  447340,
-  1248880,
-  536710,
-  933850,
-  1187304,
-  1040210,
-  1258490,
-  1193440,
-  1257460,
-  564260,
-  1181920,
-  1257352,
-  1257350,
-  1257351,
-  1230730,
-  974170,
-  836780,
-  279100,
-  223031,
-  223032,
-  1126930,
-  1127910,
-  1244180,
-  1126910,
-  980460,
-  1223290,
-  1140550,
-  445150,
-  1122600,
-  677691,
-  677692,
-  362330,
-  1171210,
-  1171211,
-  1176374,
-  1176375,
-  1176376,
-  1176377,
-  1182960,
-  1252310,
-  500243,
-  1206683,
-  1181950,
-  1140553,
-  985630,
-  630090,
-  1191160,
-  500392,
-  491740,
-  629794,
-  629795,
-  629791,
-  896764,
-  57655,
-  57656,
-  415460,
-  209424,
-  795870,
-  1176610,
-  1176611,
-  1253970,
-  1253960,
-  877140,
-  1168480,
-  1122642,
-  1122643,
-  1122644,
-  1122641,
-  956460,
-  24033,
-  322141,
-  1206540,
-  1206541,
-  1224781,
-  1224782,
-  1224785,
-  1224787,
-  1224791,
-  1224792,
-  1224793,
-  1224794,
-  1224795,
-  672060,
-  383490,
-  324342,
-  1256790,
-  640401,
-  1179140,
-  1101500,
-  1180400,
-  1195110,
-  579140,
-  1050550,
-  1205882,
-  1160642,
-  1160641,
-  1160640,
-  1165220,
-  1165221,
-  1165260,
-  1165261,
-  1165262,
-  1215680,
-  836730,
-  65959,
-  1154311,
-  551850,
-  1111350,
-  1111351,
-  1111352,
-  1245340,
-  1253020,
-  1253830,
-  744872,
-  1243390,
-  1249350,
-  1252460,
-  222635,
-  968272,
-  952651,
-  1187328,
-  1205887,
-  1169726,
-  1246310,
-  1246210,
-  1246330,
-  1227030,
-  1247610,
-  1247611,
-  1240300,
-  1221850,
-  1221851,
-  1221852,
-  1221853,
-  840991,
-  1009680,
-  1233290,
-  414310,
-  852580,
-  1154530,
-  1251730,
-  1207351,
-  1246910,
-  592820,
-  1212630,
-  1235600,
-  1241850,
-  1136840,
-  1083770,
-  1046080,
-  1046081,
-  1046082,
-  1046083,
-  1046084,
-  1046085,
-  1046086,
-  1046087,
-  1046088,
-  1046089,
-  1046090,
-  1046091,
-  1046092,
-  624740,
-  770420,
-  768210,
-  768220,
-  648010,
-  912460,
-  686420,
-  642900,
-  766550,
-  824500,
-  626750,
-  1155020,
-  535770,
-  535771,
-  435470,
-  365381,
-  365382,
-  422230,
-  441290,
-  1067750,
-  409550,
-  409551,
-  457843,
-  1051770,
-  1051771,
-  336800,
-  979130,
-  979132,
-  979133,
-  1050090,
-  1072430,
-  356830,
-  272880,
-  315410,
-  315411,
-  315412,
-  223791,
-  223794,
-  267191,
-  387985,
-  387986,
-  387987,
-  108727,
-  203180,
-  203181,
-  203186,
-  203188,
-  1206680,
-  1185710,
-  1206681,
-  574963,
-  1253600,
-  819340,
-  437641,
-  437642,
-  900450,
-  1252290,
-  1195166,
-  22460,
-  22465,
-  22475,
-  660,
-  214934,
-  243411,
-  243412,
-  243413,
-  243414,
-  243415,
-  1122638,
-  1122639,
-  1122640,
-  1122637,
-  1214430,
-  1115710,
-  911000,
-  870847,
-  1225514,
-  1225513,
-  1225512,
-  1225511,
-  1225510,
-  323935,
-  226452,
-  623617,
-  296320,
-  1036180,
-  1036181,
-  295511,
-  24045,
-  735640,
-  1249160,
-  343961,
-  940750,
-  940738,
-  940739,
-  940737,
-  940734,
-  940771,
-  940733,
-  940732,
-  940730,
-  940620,
-  1216680,
-  1152930,
-  837160,
-  855300,
-  855310,
-  855330,
-  855340,
-  855350,
-  855360,
-  855400,
-  855410,
-  855420,
-  855430,
-  855440,
-  855450,
-  855460,
-  855470,
-  855270,
-  855290,
-  609240,
-  1211672,
-  1102620,
-  953100,
-  953102,
-  1000720,
-  953106,
-  953107,
-  1024620,
-  958950,
-  942350,
-  942351,
-  942354,
-  1212810,
-  1212811,
-  1212812,
-  1212814,
-  1212815,
-  1212816,
-  729160,
-  264830,
-  364321,
-  1230710,
-  985860,
-  393650,
-  1222280,
-  222567,
-  222577,
-  1232170,
-  1246370,
-  1061020,
-  863181,
-  989970,
-  893321,
-  863182,
-  971240,
-  1075990,
-  1075991,
-  1075993,
-  1075994,
-  1075996,
-  1075997,
-  1075998,
-  1075999,
-  1076000,
-  1117540,
-  1117541,
-  1150191,
-  1150194,
-  1025060,
-  1025061,
-  1060990,
-  700851,
-  1061050,
-  1061060,
-  906440,
-  971241,
-  971242,
-  971243,
-  971250,
-  971251,
-  971252,
-  1075995,
-  893320,
-  700850,
-  863180,
-  971260,
-  1061030,
-  1061040,
-  1061070,
-  480550,
-  1248900,
-  480540,
-  1241080,
-  1176612,
-  1176618,
-  1176617,
-  1176616,
-  1176613,
-  1176614,
-  1176615,
-  1176620,
-  1216810,
-  1162190,
-  548250,
-  500970,
-  777110,
-  1151590,
-  1211682,
-  1211683,
-  1211679,
-  1211681,
-  1211680,
-  1211678,
-  1211677,
-  1211676,
-  1211674,
-  1211675,
-  1211671,
-  999261,
-  342050,
-  342051,
-  414790,
-  1128300,
-  1076460,
-  1076470,
-  1009170,
-  1206500,
-  370650,
-  1131150,
-  844220,
-  1223630,
-  1212800,
-  1212801,
-  1212802,
-  1212803,
-  1212804,
-  1212805,
-  1212806,
-  1212808,
-  1212809,
-  928190,
-  1027640,
-  775380,
-  808390,
-  732700,
-  981330,
-  1205789,
-  1205866,
-  1220062,
-  1220060,
-  1220061,
-  1219900,
-  1122635,
-  1122636,
-  1122633,
-  1122634,
-  1199310,
-  385640,
-  1215640,
-  1190240,
-  762640,
-  872300,
-  708650,
-  663700,
-  985790,
-  982071,
-  982070,
-  1220750,
-  1162110,
-  304480,
-  1217970,
-  1240940,
-  820140,
-  704283,
-  338744,
-  1216380,
-  1245030,
-  1088820,
-  922310,
-  682890,
-  439860,
-  435820,
-  1015110,
-  1230970,
-  1194980,
-  1120500,
-  1065661,
-  829581,
-  1198193,
-  1208291,
-  1205784,
-  1201020,
-  455561,
-  1194661,
-  1115900,
-  452982,
-  452981,
-  452980,
-  276552,
-  389420,
-  279968,
-  279967,
-  279966,
-  279965,
-  279964,
-  279963,
-  279962,
-  279961,
-  279960,
-  276550,
-  670742,
-  1205783,
-  638760,
-  597270,
-  941963,
-  941970,
-  941972,
-  945600,
-  573620,
-  1139150,
-  1128550,
-  798980,
-  1155042,
-  1021580,
-  1229951,
-  1229952,
-  1229950,
-  976040,
-  249862,
-  249861,
-  1082020,
-  775480,
-  1220970,
-  807530,
-  807540,
-  807401,
-  807400,
-  444700,
-  345050,
-  1229945,
-  1229944,
-  1229943,
-  1229942,
-  1229941,
-  1229940,
-  584960,
-  416930,
-  1006280,
-  635820,
-  325570,
-  1122632,
-  1122629,
-  1122630,
-  1122631,
-  511210,
-  455410,
-  455411,
-  1236550,
-  258992,
-  1042811,
-  905680,
-  905703,
-  557380,
-  557350,
-  430120,
-  546890,
-  460240,
-  1155040,
-  1155041,
-  590490,
-  1187820,
-  441040,
-  316400,
-  1213820,
-  793546,
-  992440,
-  1180180,
-  924930,
-  899380,
-  598800,
-  925859,
-  535200,
-  1193190,
-  994110,
-  994120,
-  1013210,
-  1013211,
-  1013212,
-  696620,
-  1230040,
-  407140,
-  616370,
-  1224000,
-  1197907,
-  802370,
-  369350,
-  235960,
-  258993,
-  258994,
-  406320,
-  406324,
-  510270,
-  953020,
-  793390,
-  971570,
-  1165120,
-  1053580,
-  1238750,
-  970120,
-  1230700,
-  953080,
-  748102,
-  891300,
-  23455,
-  1205880,
-  1205881,
-  1205883,
-  1205884,
-  1205885,
-  1205886,
-  1205787,
-  1205788,
-  1205790,
-  1205791,
-  1205792,
-  1205793,
-  1205794,
-  1205795,
-  1205797,
-  1205798,
-  1205799,
-  1205860,
-  1205861,
-  1205862,
-  1205863,
-  1205864,
-  1205865,
-  1205867,
-  1205868,
-  1205869,
-  1205761,
-  1205762,
-  1205780,
-  1205781,
-  1205782,
-  1195162,
-  1195163,
-  1195164,
-  1195165,
-  1195200,
-  1195201,
-  1195202,
-  1195203,
-  1195204,
-  1195205,
-  1195206,
-  1195207,
-  1195208,
-  1195209,
-  1195210,
-  1195211,
-  1195212,
-  1195213,
-  1195214,
-  1195215,
-  1188608,
-  1188609,
-  1188612,
-  1188617,
-  1188620,
-  1195161,
-  1188602,
-  1188603,
-  1188604,
-  1187325,
-  1188605,
-  1187326,
-  1188606,
-  1187327,
-  1188607,
-  1187301,
-  1187302,
-  1187303,
-  1187305,
-  1187306,
-  1187307,
-  1187308,
-  1187309,
-  1187310,
-  1187311,
-  1187312,
-  1187313,
-  1187314,
-  1187315,
-  1187316,
-  1187317,
-  1187318,
-  1187319,
-  1187320,
-  1187321,
-  1187322,
-  1187323,
-  1187324,
-  1179650,
-  1179652,
-  1179654,
-  1179655,
-  1187300,
-  1179630,
-  1179631,
-  1179632,
-  1179633,
-  1179634,
-  1179635,
-  1179636,
-  1179637,
-  1179638,
-  1179639,
-  1169723,
-  1169724,
-  1169725,
-  1168580,
-  1168511,
-  1168512,
-  1168513,
-  1168514,
-  1168515,
-  1168517,
-  1168518,
-  1168519,
-  1168520,
-  1168521,
-  1168522,
-  1168523,
-  1168524,
-  1168525,
-  1168526,
-  1168560,
-  1168561,
-  1168562,
-  1168563,
-  1168564,
-  1168565,
-  1168567,
-  1154593,
-  1168501,
-  1168502,
-  1168510,
-  1159312,
-  1159313,
-  1159314,
-  1159315,
-  1159316,
-  1159320,
-  1159321,
-  1159322,
-  1159324,
-  1159325,
-  1159326,
-  1159327,
-  1134414,
-  1134415,
-  1134416,
-  1134417,
-  1134418,
-  1134419,
-  1134420,
-  1134421,
-  1134422,
-  1134423,
-  1134430,
-  1134431,
-  1134432,
-  1134381,
-  1134382,
-  1134383,
-  1134384,
-  1134386,
-  1134400,
-  1134401,
-  1134402,
-  1134403,
-  1134404,
-  1134405,
-  1134407,
-  1134408,
-  1134409,
-  1134410,
-  1134411,
-  1134412,
-  1134413,
-  1120020,
-  1120021,
-  1120022,
-  1120023,
-  1120024,
-  1111512,
-  1111514,
-  1111515,
-  1111516,
-  1111517,
-  1119990,
-  1119991,
-  1119992,
-  1119993,
-  1119994,
-  1119995,
-  1119996,
-  1119997,
-  1119998,
-  1119999,
-  1111443,
-  1111444,
-  1111445,
-  1111446,
-  1111448,
-  1111470,
-  1111471,
-  1111472,
-  1111473,
-  1111474,
-  1111477,
-  1111480,
-  1111490,
-  1111510,
-  1111511,
-  1099316,
-  1099320,
-  1099340,
-  1099264,
-  1099270,
-  1099271,
-  1099272,
-  1099273,
-  1099280,
-  1099281,
-  1099282,
-  1099283,
-  1099290,
-  1099291,
-  1099292,
-  1099293,
-  1099294,
-  1099300,
-  1099301,
-  1099302,
-  1099303,
-  1099304,
-  1099305,
-  1099310,
-  1099311,
-  1099312,
-  1099313,
-  1099315,
-  1099263,
-  1094186,
-  1094187,
-  1097320,
-  1099190,
-  1099191,
-  1099200,
-  1099201,
-  1099203,
-  1099210,
-  1099212,
-  1099213,
-  1099214,
-  1099215,
-  1099216,
-  1099230,
-  1099231,
-  1099232,
-  1099233,
-  1099240,
-  1099241,
-  1099261,
-  1099262,
-  1094180,
-  1094181,
-  1094182,
-  1094183,
-  1094184,
-  1094185,
-  1074218,
-  1074219,
-  1074261,
-  1074262,
-  1074263,
-  1074264,
-  1074266,
-  1074267,
-  1074271,
-  1074272,
-  1074273,
-  1074274,
-  1074276,
-  1074277,
-  1074200,
-  1074201,
-  1074202,
-  1074203,
-  1074204,
-  1074205,
-  1074206,
-  1074207,
-  1074208,
-  1074209,
-  1074210,
-  1074211,
-  1074212,
-  1074213,
-  1074214,
-  1074215,
-  1074216,
-  1074217,
-  1062511,
-  1062512,
-  1062513,
-  1062514,
-  1062515,
-  1063920,
-  1063921,
-  1063922,
-  1063923,
-  1047070,
-  1055060,
-  1055061,
-  1055062,
-  1055063,
-  1055064,
-  1055065,
-  1055066,
-  1055067,
-  1055070,
-  1055071,
-  1055072,
-  1055073,
-  1052520,
-  1062510,
-  1061750,
-  1061751,
-  1061752,
-  1061753,
-  1061754,
-  1061755,
-  1061756,
-  1061757,
-  1061080,
-  1061082,
-  1033473,
-  1033475,
-  1033476,
-  1033478,
-  1033479,
-  1033480,
-  1033481,
-  1033482,
-  1033483,
-  1033484,
-  1033485,
-  1033486,
-  1033487,
-  1033488,
-  1033489,
-  1033491,
-  1033492,
-  1042812,
-  1042813,
-  1034480,
-  1034481,
-  1034482,
-  1034484,
-  1033472,
-  1019969,
-  1019970,
-  1019971,
-  1019980,
-  1019981,
-  1019982,
-  1019983,
-  1019984,
-  1019985,
-  1019986,
-  1019987,
-  1019988,
-  1019989,
-  1019990,
-  1019991,
-  1019992,
-  1019993,
-  1019994,
-  1033460,
-  1033470,
-  1033471,
-  1011215,
-  1011216,
-  1011217,
-  1011218,
-  1013030,
-  1015850,
-  1019961,
-  1019962,
-  1019963,
-  1019964,
-  1019966,
-  1019967,
-  1019968,
-  1012620,
-  1017260,
-  1013990,
-  1016550,
-  1014000,
-  1016560,
-  1011210,
-  1011211,
-  1011212,
-  1011213,
-  1011214,
-  875990,
-  1218080,
-  411702,
-  977520,
-  1231850,
-  323936,
-  1235530,
-  663804,
-  663803,
-  663802,
-  663801,
-  663800,
-  1192320,
-  983442,
-  408041,
-  1234391,
-  1234393,
-  1028793,
-  1076170,
-  1144480,
-  968830,
-  1212210,
-  1212211,
-  1212212,
-  1212213,
-  1212214,
-  1212215,
-  1212216,
-  1212217,
-  1212218,
-  1212219,
-  1037670,
-  1230910,
-  1234510,
-  463950,
-  758720,
-  1215461,
-  1215463,
-  1215462,
-  1122628,
-  1122627,
-  1122626,
-  1122625,
-  1234390,
-  374880,
-  945480,
-  1235410,
-  1221500,
-  214530,
-  1207100,
-  1207620,
-  1225400,
-  1181420,
-  1179980,
-  1179990,
-  1179940,
-  1132400,
-  1118900,
-  1230770,
-  1230750,
-  1180290,
-  437351,
-  266750,
-  1194852,
-  1025400,
-  1219852,
-  628240,
-  549960,
-  554360,
-  703640,
-  498590,
-  215200,
-  900100,
-  900101,
-  900102,
-  900103,
-  856660,
-  856680,
-  864710,
-  871380,
-  894440,
-  878060,
-  1096050,
-  1092240,
-  1092250,
-  1095900,
-  891250,
-  277735,
-  1182180,
-  1115460,
-  399840,
-  1230690,
-  250890,
-  620746,
-  967279,
-  742890,
-  441730,
-  824480,
-  1198166,
-  1198164,
-  336460,
-  910711,
-  1009480,
-  910710,
-  1223340,
-  270940,
-  1045810,
-  476869,
-  1064180,
-  1227560,
-  849760,
-  794106,
-  1026150,
-  210562,
-  708500,
-  708490,
-  923580,
-  986840,
-  1220210,
-  1226720,
-  1225800,
-  1230630,
-  1196782,
-  1196789,
-  1196790,
-  750380,
-  620230,
-  639710,
-  969580,
-  540071,
-  1190800,
-  850070,
-  1085690,
-  761470,
-  532040,
-  1221780,
-  1170453,
-  1170454,
-  1170455,
-  1170456,
-  1170457,
-  1170458,
-  1170459,
-  578160,
-  819760,
-  1158960,
-  1198141,
-  1198142,
-  1198143,
-  1198144,
-  1198145,
-  1198147,
-  1198148,
-  1198149,
-  1198160,
-  1198161,
-  1198162,
-  1203800,
-  819830,
-  493230,
-  1216690,
-  937430,
-  1122623,
-  1122624,
-  1122622,
-  1122621,
-  334111,
-  1076091,
-  1015970,
-  794141,
-  1121620,
-  1121621,
-  1121622,
-  1214170,
-  1230290,
-  1230300,
-  1154820,
-  627582,
-  1231370,
-  1231380,
-  471350,
-  790530,
-  1029320,
-  912710,
-  1189570,
-  1171202,
-  1171201,
-  1171200,
-  1003682,
-  1003681,
-  1003680,
-  977170,
-  976051,
-  571960,
-  479230,
-  315220,
-  1020320,
-  1200170,
-  579530,
-  648112,
-  648110,
-  648111,
-  579534,
-  579533,
-  579532,
-  579536,
-  579537,
-  579535,
-  583633,
-  583634,
-  579531,
-  579540,
-  579539,
-  579538,
-  612860,
-  589700,
-  544570,
-  544571,
-  506804,
-  583631,
-  583630,
-  648113,
-  1001783,
-  433560,
-  1198192,
-  1198191,
-  1198190,
-  1198189,
-  1198188,
-  1198187,
-  1198186,
-  1198185,
-  1198184,
-  1198183,
-  1198182,
-  1198181,
-  1198180,
-  1144641,
-  1144644,
-  1144642,
-  1216290,
-  1184101,
-  1091851,
-  1025030,
-  1014410,
-  500249,
-  379565,
-  426230,
-  948542,
-  1213430,
-  1213431,
-  1212230,
-  1212310,
-  1212311,
-  1209050,
-  1209051,
-  426320,
-  1145250,
-  237491,
-  1022570,
-  997150,
-  1209900,
-  1153352,
-  1187155,
-  1132920,
-  843000,
-  1091760,
-  1223300,
-  1016873,
-  1178730,
-  1122618,
-  1122620,
-  1122619,
-  1201980,
-  1126740,
-  738250,
-  836830,
-  1069581,
-  1069600,
-  1132872,
-  1132873,
-  1153350,
-  1153351,
-  1153353,
-  1170711,
-  1170713,
-  1170712,
-  1170714,
-  1170731,
-  1170730,
-  1170715,
-  1170732,
-  1170733,
-  1179490,
-  1179491,
-  1179492,
-  1179493,
-  1187150,
-  1187151,
-  1187152,
-  1187153,
-  1187154,
-  1202010,
-  1202011,
-  1202012,
-  1202013,
-  1202014,
-  1122617,
-  649140,
-  412503,
-  1129470,
-  1106450,
-  1106451,
-  1106452,
-  1106221,
-  1106222,
-  1106223,
-  1106224,
-  1106225,
-  1106226,
-  1106227,
-  1106228,
-  1103670,
-  1106230,
-  1106231,
-  1106232,
-  1106233,
-  1106234,
-  1106235,
-  1106236,
-  1106237,
-  1106238,
-  1106239,
-  1106240,
-  1106241,
-  1106243,
-  1106250,
-  1106251,
-  1176660,
-  1103710,
-  1103711,
-  1106280,
-  1106290,
-  1106300,
-  1106310,
-  1106320,
-  1106321,
-  1176730,
-  1176750,
-  1106100,
-  1106360,
-  1176760,
-  1106361,
-  1106362,
-  1106363,
-  1106370,
-  1106371,
-  1106380,
-  1106381,
-  1106390,
-  1106391,
-  1057280,
-  1057281,
-  1057282,
-  1057283,
-  1076010,
-  1076012,
-  1076013,
-  1076015,
-  1057272,
-  1057273,
-  1057274,
-  1057275,
-  1057276,
-  1057277,
-  1057278,
-  1057279,
-  288980,
-  549830,
-  682750,
-  1157580,
-  379552,
-  794400,
-  1194360,
-  1194361,
-  288240,
-  1216792,
-  1216790,
-  1216793,
-  1216794,
-  844470,
-  718150,
-  1214110,
-  1180980,
-  742430,
-  641382,
-  542080,
-  1204090,
-  597660,
-  1220660,
-  1102520,
-  459670,
-  1183340,
-  1217910,
-  1213330,
-  1213331,
-  1213354,
-  1213355,
-  1213332,
-  1208280,
-  532720,
-  1213352,
-  1213351,
-  1213350,
-  1213335,
-  1213334,
-  1213333,
-  1219851,
-  1023270,
-  1211460,
-  1084510,
-  384380,
-  1039250,
-  874420,
-  874421,
-  1056242,
-  1103740,
-  869700,
-  1122613,
-  1122614,
-  1122616,
-  1122615,
-  1217000,
-  1194270,
-  1209340,
-  1199001,
-  1199000,
-  1181870,
-  364327,
-  874431,
-  874430,
-  761231,
-  761230,
-  660220,
-  1219560,
-  551560,
-  899900,
-  1189260,
-  1189261,
-  769180,
-  317591,
-  1007690,
-  1099330,
-  509370,
-  627440,
-  287410,
-  1109200,
-  1125090,
-  379559,
-  1216900,
-  467511,
-  467512,
-  467513,
-  467514,
-  467515,
-  1216920,
-  1216910,
-  510670,
-  1186876,
-  1186874,
-  1186870,
-  1186872,
-  1186873,
-  1186875,
-  1186871,
-  450750,
-  977220,
-  1212880,
-  1083971,
-  1083970,
-  1132990,
-  1019380,
-  1208440,
-  950150,
-  1199470,
-  1160650,
-  1160651,
-  1160652,
-  379548,
-  854430,
-  746980,
-  787560,
-  782600,
-  1195886,
-  1110750,
-  658304,
-  658306,
-  658305,
-  1206650,
-  1082032,
-  1214970,
-  955990,
-  1190330,
-  1190331,
-  630920,
-  1205980,
-  1207890,
-  1207930,
-  1207920,
-  1207970,
-  1207980,
-  1207950,
-  1207900,
-  1207960,
-  1207910,
-  1209630,
-  997250,
-  997251,
-  997252,
-  1056241,
-  1056243,
-  426270,
-  538910,
-  378400,
-  1209500,
-  1214610,
-  582170,
-  1205400,
-  1082352,
-  1197740,
-  1143500,
-  1009670,
-  1204820,
-  1206390,
-  1206400,
-  1059480,
-  1024914,
-  639531,
-  639532,
-  754630,
-  1210990,
-  1182753,
-  1185430,
-  1185432,
-  1182755,
-  1182754,
-  1182757,
-  1185431,
-  1182759,
-  1182756,
-  1185434,
-  1182758,
-  1185463,
-  1185457,
-  1185433,
-  1185460,
-  1194855,
-  1194856,
-  1194857,
-  999630,
-  346742,
-  1210133,
-  1210132,
-  1203543,
-  875580,
-  1213270,
-  1019950,
-  1077060,
-  654179,
-  560910,
-  1208290,
-  427560,
-  1120200,
-  1204400,
-  1165340,
-  1147152,
-  1206689,
-  204292,
-  204291,
-  898770,
-  1082031,
-  1197310,
-  1210131,
-  1097930,
-  1161600,
-  1161601,
-  1161602,
-  1161603,
-  1199324,
-  1210290,
-  1149650,
-  1177560,
-  924920,
-  1212220,
-  1212490,
-  1212670,
-  755260,
-  1122609,
-  1122610,
-  1122611,
-  1122612,
-  1025490,
-  1102670,
-  1102671,
-  1204500,
-  1157490,
-  1210130,
-  1209540,
-  1159910,
-  610702,
-  471390,
-  1201510,
-  379577,
-  1145850,
-  1182520,
-  420750,
-  900232,
-  781531,
-  1169610,
-  1118430,
-  1200640,
-  1206160,
-  1141810,
-  552010,
-  552011,
-  553120,
-  849230,
-  1200621,
-  1200623,
-  1200622,
-  1200620,
-  1208140,
-  1210730,
-  1133660,
-  347152,
-  347153,
-  351558,
-  354413,
-  332221,
-  238305,
-  1195882,
-  1195903,
-  421070,
-  1149810,
-  1082170,
-  625875,
-  1047040,
-  591040,
-  475170,
-  1205220,
-  417770,
-  444780,
-  1162723,
-  1162722,
-  970590,
-  752250,
-  1201300,
-  1125794,
-  1191300,
-  1153290,
-  1161230,
-  945170,
-  945180,
-  1170460,
-  1170462,
-  1170463,
-  945200,
-  944950,
-  1170490,
-  1170491,
-  1170492,
-  944970,
-  945230,
-  944980,
-  393044,
-  1194070,
-  1170520,
-  1170521,
-  1170522,
-  1170523,
-  1170524,
-  1170525,
-  1170526,
-  945000,
-  1170550,
-  945020,
-  943750,
-  945040,
-  892340,
-  945080,
-  945120,
-  944870,
-  945130,
-  1198720,
-  1210041,
-  1122607,
-  1122605,
-  1122608,
-  1162620,
-  1125795,
-  864660,
-  1193640,
-  1170549,
-  1170548,
-  1170547,
-  1170546,
-  1170545,
-  1170544,
-  1170543,
-  1170542,
-  1170541,
-  1170540,
-  1170452,
-  1170451,
-  1170450,
-  1170430,
-  688246,
-  688247,
-  1207460,
-  1207760,
-  997230,
-  1151270,
-  900441,
-  409500,
-  1141401,
-  1141400,
-  1207330,
-  578290,
-  774757,
-  1207790,
-  1205200,
-  673340,
-  1170930,
-  880923,
-  880924,
-  911920,
-  889901,
-  422310,
-  1136002,
-  1198480,
-  1198481,
-  964938,
-  964937,
-  964936,
-  964935,
-  978867,
-  978866,
-  978865,
-  978864,
-  939030,
-  939040,
-  1024550,
-  932700,
-  930920,
-  1000420,
-  1206684,
-  1185850,
-  1195331,
-  1195332,
-  1195330,
-  264813,
-  1195310,
-  1195311,
-  1195312,
-  1195313,
-  1195314,
-  1195315,
-  1109204,
-  610010,
-  1170510,
-  1161920,
-  1120490,
-  1187821,
-  1138931,
-  1122601,
-  1122602,
-  1122603,
-  1122604,
-  24046,
-  1201180,
-  1175130,
-  1070054,
-  1070055,
-  1070056,
-  1070057,
-  1196141,
-  24022,
-  24023,
-  24025,
-  24026,
-  24027,
-  24030,
-  24031,
-  24042,
-  1188780,
-  247811,
-  572390,
-  727880,
-  1118660,
-  1100330,
-  811431,
-  811430,
-  1200830,
-  1082030,
-  720720,
-  1170784,
-  1170785,
-  1000290,
-  1170786,
-  1170787,
-  1170789,
-  1116270,
-  384650,
-  977820,
-  720810,
-  404910,
-  750000,
-  863960,
-  1026520,
-  1082172,
-  1143490,
-  1079990,
-  1089410,
-  1008420,
-  527390,
-  382390,
-  807410,
-  582340,
-  1177786,
-  1036040,
-  1036050,
-  1036090,
-  1036100,
-  616550,
-  1035670,
-  685470,
-  1035680,
-  1194853,
-  1194854,
-  1194850,
-  1194851,
-  1199960,
-  1195600,
-  1169950,
-  1169951,
-  791310,
-  652491,
-  1122597,
-  1122598,
-  1122599,
-  1200940,
-  1200470,
-  1201010,
-  1200820,
-  1170812,
-  924490,
-  964931,
-  964932,
-  964933,
-  964934,
-  978850,
-  978851,
-  978852,
-  978853,
-  978854,
-  978855,
-  978856,
-  978857,
-  978861,
-  978862,
-  978863,
-  892390,
-  892391,
-  892392,
-  892394,
-  892395,
-  892396,
-  892397,
-  892398,
-  892399,
-  963070,
-  962304,
-  962305,
-  956930,
-  962306,
-  956940,
-  956941,
-  956942,
-  956943,
-  956944,
-  956945,
-  956946,
-  956947,
-  956948,
-  956949,
-  956700,
-  956701,
-  956702,
-  956703,
-  956704,
-  956705,
-  956706,
-  956707,
-  956708,
-  956709,
-  956720,
-  956721,
-  956722,
-  956723,
-  956724,
-  956725,
-  956726,
-  956727,
-  956728,
-  956729,
-  956730,
-  956731,
-  956732,
-  956733,
-  956734,
-  956735,
-  956736,
-  956737,
-  956738,
-  956739,
-  956750,
-  956751,
-  956752,
-  956753,
-  956760,
-  956761,
-  956762,
-  956763,
-  956764,
-  956765,
-  956766,
-  956767,
-  956768,
-  956769,
-  956770,
-  956771,
-  956772,
-  956860,
-  956861,
-  956862,
-  956863,
-  956864,
-  956865,
-  956866,
-  956867,
-  956868,
-  956869,
-  956890,
-  956891,
-  956892,
-  956893,
-  956894,
-  956895,
-  956897,
-  956898,
-  956899,
-  956920,
-  956921,
-  956922,
-  956923,
-  956924,
-  962300,
-  962301,
-  962302,
-  962303,
-  1199950,
-  1023240,
-  916460,
-  800880,
-  732100,
-  1037660,
-  764070,
-  760280,
-  1152630,
-  1114770,
-  1107930,
-  1046280,
-  1054220,
-  1053200,
-  1046290,
-  1054230,
-  1053210,
-  1053230,
-  1053240,
-  1053310,
-  1053320,
-  1054130,
-  1054140,
-  1046720,
-  1053130,
-  1046730,
-  1045970,
-  1053140,
-  1045990,
-  1046000,
-  1040130,
-  1041430,
-  1040670,
-  1041440,
-  1040680,
-  1040170,
-  1040180,
-  1041480,
-  1041740,
-  1041490,
-  1041750,
-  1041530,
-  1041540,
-  1045440,
-  1041350,
-  1045960,
-  1045450,
-  1041360,
-  1041370,
-  1041380,
-  1045230,
-  1040120,
-  1045240,
-  1039920,
-  1039930,
-  1039980,
-  1039990,
-  1038720,
-  1039490,
-  1038730,
-  1040010,
-  1039500,
-  1040020,
-  1037720,
-  1039520,
-  1037730,
-  1038760,
-  1039530,
-  1038770,
-  1038790,
-  1038800,
-  1039840,
-  1039850,
-  1034800,
-  1037630,
-  1037640,
-  1037650,
-  1035360,
-  1037680,
-  1035390,
-  1035391,
-  1037700,
-  1037710,
-  860250,
-  849150,
-  801000,
-  758550,
-  764000,
-  701320,
-  679040,
-  692220,
-  622960,
-  627700,
-  593480,
-  590520,
-  576600,
-  579690,
-  574680,
-  566300,
-  555390,
-  564870,
-  565400,
-  528440,
-  538520,
-  537250,
-  500780,
-  497750,
-  498810,
-  498811,
-  501200,
-  509410,
-  456040,
-  413840,
-  441240,
-  1163030,
-  1167420,
-  261220,
-  300150,
-  920440,
-  1185760,
-  376550,
-  1187050,
-  1187060,
-  1083130,
-  576350,
-  1177762,
-  1177760,
-  1177761,
-  1199920,
-  488990,
-  1198350,
-  1199670,
-  1197970,
-  1196700,
-  1198010,
-  1196220,
-  1199580,
-  1198560,
-  1197040,
-  1052570,
-  1055900,
-  343290,
-  401580,
-  872770,
-  915350,
-  1146490,
-  1199400,
-  861120,
-  1189990,
-  870640,
-  387190,
-  1138200,
-  992570,
-  991830,
-  1024360,
-  506920,
-  1198725,
-  1198724,
-  1198723,
-  1198722,
-  1198721,
-  1194820,
-  719980,
-  1085320,
-  1143961,
-  876000,
-  1188040,
-  1122593,
-  1122594,
-  1122595,
-  1122596,
-  1172330,
-  1197170,
-  1009400,
-  1075382,
-  1096450,
-  1134560,
-  1146142,
-  1176682,
-  1100120,
-  1030590,
-  1196340,
-  1193690,
-  1189310,
-  1179141,
-  1150970,
-  1177600,
-  1165370,
-  1167690,
-  1182800,
-  1182810,
-  1182811,
-  1175760,
-  1175761,
-  1175780,
-  1177590,
-  1177591,
-  1177592,
-  1177597,
-  1177598,
-  1177599,
-  1161090,
-  1162150,
-  845581,
-  845582,
-  845580,
-  823960,
-  1153820,
-  1183102,
-  1183100,
-  1182304,
-  1182305,
-  1182307,
-  1182308,
-  1182309,
-  1182300,
-  1182301,
-  1182302,
-  1182303,
-  879380,
-  1011400,
-  899280,
-  842960,
-  527370,
-  584260,
-  497610,
-  497611,
-  670700,
-  388020,
-  1187530,
-  390430,
-  390431,
-  390432,
-  390433,
-  390434,
-  1082171,
-  1193750,
-  1173580,
-  548180,
-  487310,
-  595350,
-  267480,
-  337400,
-  486004,
-  457390,
-  982731,
-  1122585,
-  1122586,
-  1122587,
-  1122588,
-  1179230,
-  1111720,
-  1084073,
-  1107700,
-  1191130,
-  1049980,
-  1082120,
-  1082150,
-  1082160,
-  1082161,
-  1186140,
-  1192801,
-  1140600,
-  1140601,
-  1140602,
-  1192800,
-  994480,
-  993670,
-  1191230,
-  1186540,
-  1178810,
-  1173890,
-  542190,
-  529430,
-  1177920,
-  1177930,
-  1164260,
-  1149150,
-  846400,
-  846310,
-  717031,
-  717032,
-  1017810,
-  1098167,
-  331230,
-  509703,
-  390421,
-  390436,
-  390437,
-  390438,
-  390451,
-  258368,
-  436620,
-  492973,
-  492975,
-  436657,
-  390370,
-  390371,
-  390372,
-  925680,
-  1167980,
-  1176680,
-  1176681,
-  678740,
-  1184270,
-  1029720,
-  1166826,
-  1166821,
-  1166824,
-  1166823,
-  1166820,
-  1166827,
-  1166825,
-  1166822,
-  1176655,
-  1176654,
-  1176653,
-  1176652,
-  1176651,
-  1176650,
-  1190210,
-  974340,
-  974341,
-  974342,
-  1137510,
-  722800,
-  730480,
-  730490,
-  1167740,
-  723080,
-  930440,
-  730510,
-  730520,
-  729760,
-  730530,
-  726700,
-  1184690,
-  749240,
-  749241,
-  749242,
-  1180890,
-  1138930,
-  971770,
-  1122574,
-  1157470,
-  1190250,
-  1122579,
-  1122580,
-  1122581,
-  1122578,
-  1122582,
-  1122577,
-  1122583,
-  1122576,
-  1122584,
-  1122575,
-  512930,
-  363640,
-  1188500,
-  597072,
-  895880,
-  641450,
-  1123890,
-  1187160,
-  1185650,
-  1186420,
-  1163430,
-  1157420,
-  1177280,
-  1173560,
-  1187100,
-  355900,
-  347981,
-  335260,
-  347980,
-  246562,
-  274431,
-  274430,
-  246563,
-  246564,
-  265410,
-  246561,
-  1153600,
-  1101590,
-  350271,
-  1187660,
-  1128560,
-  810010,
-  1000890,
-  1000910,
-  1184130,
-  1182510,
-  1178910,
-  485810,
-  1174250,
-  1122570,
-  1122571,
-  1122572,
-  1122573,
-  1169120,
-  208312,
-  1185200,
-  577540,
-  1169600,
-  870621,
-  725350,
-  725351,
-  725352,
-  1080591,
-  1166870,
-  1166871,
-  1080032,
-  1177900,
-  856630,
-  818190,
-  828430,
-  421080,
-  421090,
-  938410,
-  1059250,
-  418720,
-  1036110,
-  1173760,
-  1036117,
-  1036116,
-  1171460,
-  1160010,
-  323930,
-  1040320,
-  1040350,
-  574110,
-  1152560,
-  1133550,
-  1132780,
-  1133551,
-  1162780,
-  1162781,
-  1162782,
-  1162783,
-  1162784,
-  1162785,
-  1162790,
-  1162791,
-  1162792,
-  1162793,
-  1162794,
-  1162795,
-  1162796,
-  1162800,
-  1162801,
-  1162710,
-  1162711,
-  1162712,
-  1162713,
-  1162714,
-  1162715,
-  1162716,
-  1162720,
-  1162721,
-  1168910,
-  1149240,
-  1175820,
-  1175310,
-  453150,
-  47911,
-  47912,
-  1173300,
-  894780,
-  1021250,
-  505200,
-  505201,
-  440970,
-  440971,
-  440972,
-  1107600,
-  1083281,
-  1084071,
-  1084072,
-  1130670,
-  1163440,
-  455360,
-  559590,
-  1097190,
-  500461,
-  429461,
-  429460,
-  486770,
-  429462,
-  1122566,
-  1122567,
-  1122568,
-  1122569,
-  1018362,
-  931600,
-  1064040,
-  279132,
-  1170470,
-  1097450,
-  323934,
-  1134360,
-  1112900,
-  781850,
-  870600,
-  1179520,
-  390411,
-  390423,
-  390435,
-  390455,
-  271425,
-  258383,
-  369767,
-  436588,
-  369781,
-  492944,
-  436626,
-  295081,
-  436650,
-  436655,
-  492981,
-  390369,
-  390383,
-  258367,
-  436584,
-  369771,
-  436597,
-  436603,
-  369793,
-  271492,
-  295062,
-  436630,
-  492954,
-  436640,
-  436664,
-  492985,
-  509632,
-  390365,
-  391432,
-  390439,
-  436607,
-  436634,
-  492957,
-  492967,
-  436659,
-  436668,
-  390373,
-  391431,
-  391430,
-  391621,
-  1172600,
-  799481,
-  799480,
-  799482,
-  1169930,
-  1169931,
-  1098165,
-  1168810,
-  335611,
-  322140,
-  620540,
-  1095470,
-  295185,
-  325960,
-  325982,
-  1098160,
-  1169010,
-  1169330,
-  1166420,
-  886660,
-  886661,
-  882350,
-  864180,
-  864181,
-  864182,
-  864183,
-  864184,
-  864185,
-  864186,
-  864187,
-  864188,
-  864189,
-  993241,
-  1122563,
-  1122564,
-  1122565,
-  1122562,
-  842410,
-  1089020,
-  547530,
-  547400,
-  514450,
-  1080590,
-  1092200,
-  1167500,
-  716510,
-  757920,
-  989680,
-  729600,
-  1084960,
-  439240,
-  529400,
-  972731,
-  1130501,
-  1102840,
-  1151810,
-  1151811,
-  1151812,
-  1151813,
-  1151814,
-  1151830,
-  1151831,
-  1151832,
-  1151833,
-  1151834,
-  1149363,
-  1149364,
-  1149380,
-  1149381,
-  1149382,
-  1149383,
-  1149384,
-  1149390,
-  1149391,
-  1149392,
-  1149394,
-  1149410,
-  1149411,
-  1149412,
-  1149413,
-  1135620,
-  1135660,
-  1135661,
-  1130551,
-  1132370,
-  1132380,
-  1147310,
-  1147311,
-  1147312,
-  1149360,
-  1147313,
-  1149361,
-  1147314,
-  1149362,
-  1132250,
-  1132260,
-  1132270,
-  1135600,
-  1132280,
-  1135610,
-  1130500,
-  1130520,
-  1130521,
-  1130530,
-  1130531,
-  1130532,
-  1130533,
-  1130540,
-  1130541,
-  1130550,
-  1123223,
-  1123224,
-  1123225,
-  1130480,
-  1130481,
-  1130490,
-  1130491,
-  1130492,
-  1122320,
-  1116740,
-  1122390,
-  1122391,
-  1122392,
-  1122397,
-  1122398,
-  1122399,
-  1113450,
-  1123220,
-  1123221,
-  1123222,
-  1114570,
-  1102850,
-  1102861,
-  1100820,
-  1113440,
-  1113441,
-  1098850,
-  1113442,
-  1113443,
-  1113444,
-  1113445,
-  1095330,
-  1109500,
-  1096190,
-  972730,
-  983750,
-  838670,
-  773080,
-  698140,
-  590450,
-  700350,
-  559220,
-  1176539,
-  1176538,
-  1176537,
-  1176536,
-  1176535,
-  1176534,
-  1176533,
-  1176532,
-  1176531,
-  1176530,
-  1176524,
-  1176523,
-  1176522,
-  1176521,
-  1176520,
-  1175713,
-  1175712,
-  1175711,
-  1175710,
-  1174069,
-  1174068,
-  1174067,
-  1174066,
-  1174065,
-  1174064,
-  1174063,
-  1174062,
-  1174061,
-  1174060,
-  1174049,
-  1174048,
-  1174047,
-  1174046,
-  1174045,
-  1174044,
-  1174043,
-  1174042,
-  1174041,
-  1174040,
-  1173971,
-  1173970,
-  1173489,
-  1173488,
-  1173487,
-  1173486,
-  1173485,
-  1173484,
-  1173483,
-  1173482,
-  1173481,
-  1173480,
-  1173470,
-  1173454,
-  1173453,
-  1173452,
-  1173451,
-  1173450,
-  1160404,
-  1160403,
-  1160402,
-  1160401,
-  1160400,
-  1147122,
-  1147121,
-  1147120,
-  1135670,
-  1135650,
-  1135630,
-  1122396,
-  1122395,
-  1122394,
-  1122393,
-  1113452,
-  1113451,
-  1102860,
-  1095340,
-  1071400,
-  532710,
-  687330,
-  605090,
-  559240,
-  401260,
-  323660,
-  321000,
-  320995,
-  320994,
-  320993,
-  320992,
-  320991,
-  320990,
-  942790,
-  1159900,
-  432710,
-  588600,
-  558000,
-  1147040,
-  461246,
-  388473,
-  639701,
-  1160520,
-  1120841,
-  1018361,
-  1163400,
-  1163401,
-  1163402,
-  1158620,
-  501150,
-  1172870,
-  1171590,
-  1171591,
-  1161990,
-  1162000,
-  239380,
-  804930,
-  1122551,
-  1064192,
-  1064214,
-  1064215,
-  1064216,
-  1064217,
-  1064218,
-  1064219,
-  1064190,
-  1168780,
-  1122554,
-  1122553,
-  1122561,
-  769090,
-  1122560,
-  1122559,
-  1122558,
-  1122557,
-  1122556,
-  1122555,
-  1122552,
-  1173080,
-  1162450,
-  1162451,
-  1162452,
-  1080940,
-  1171900,
-  1171910,
-  1171920,
-  1171930,
-  1171940,
-  639530,
-  308171,
-  308170,
-  308172,
-  1156740,
-  1156660,
-  1151480,
-  993610,
-  1068890,
-  1152700,
-  1025910,
-  1160760,
-  1170850,
-  1170860,
-  665990,
-  696340,
-  1163900,
-  1171680,
-  1112080,
-  1112081,
-  1112082,
-  1112083,
-  1161970,
-  1161980,
-  298783,
-  1093260,
-  907280,
-  984340,
-  881330,
-  876732,
-  876733,
-  876734,
-  876735,
-  939730,
-  298785,
-  1126720,
-  972260,
-  972261,
-  231481,
-  1025380,
-  1012960,
-  1164810,
-  245660,
-  260850,
-  58646,
-  58648,
-  1132870,
-  297520,
-  1089242,
-  1089243,
-  1089244,
-  1089245,
-  615200,
-  1166900,
-  1161960,
-  837340,
-  922230,
-  1169090,
-  1161950,
-  1145711,
-  1122260,
-  1154310,
-  1047900,
-  414590,
-  724650,
-  972720,
-  948930,
-  1161940,
-  1153020,
-  365570,
-  1153021,
-  1160710,
-  459750,
-  1102330,
-  1149740,
-  1137370,
-  1144750,
-  1155380,
-  1165130,
-  1161690,
-  1157210,
-  1160160,
-  412351,
-  506802,
-  506801,
-  556800,
-  430351,
-  430350,
-  430349,
-  430348,
-  396435,
-  433420,
-  396434,
-  573570,
-  506803,
-  412352,
-  428500,
-  428501,
-  430347,
-  430346,
-  430344,
-  430343,
-  1087422,
-  508162,
-  1161610,
-  610701,
-  430342,
-  430341,
-  422182,
-  422200,
-  422193,
-  422192,
-  422191,
-  422201,
-  422190,
-  422181,
-  366150,
-  111403,
-  442900,
-  442990,
-  476950,
-  476951,
-  476952,
-  477150,
-  477151,
-  367682,
-  621320,
-  367681,
-  609220,
-  336290,
-  630420,
-  957630,
-  972300,
-  1087340,
-  895130,
-  1109030,
-  923160,
-  1018230,
-  1019850,
-  1045879,
-  1069048,
-  1069049,
-  1069046,
-  1069047,
-  1069044,
-  1069045,
-  1069042,
-  1069043,
-  1069040,
-  1069041,
-  1069028,
-  1069029,
-  1069026,
-  1069027,
-  1069024,
-  1069025,
-  1069022,
-  1069023,
-  1068940,
-  1068941,
-  1068950,
-  1068951,
-  1068960,
-  1068961,
-  1068962,
-  1068963,
-  1069020,
-  1069021,
-  1068931,
-  1068930,
-  1065120,
-  1065121,
-  1065122,
-  1065123,
-  1065130,
-  1065131,
-  1065132,
-  1065133,
-  1065134,
-  1065135,
-  1068740,
-  1068741,
-  1068742,
-  1068743,
-  1068744,
-  1068750,
-  1068751,
-  1068752,
-  1068753,
-  1068754,
-  1063650,
-  1063651,
-  1063652,
-  1063653,
-  1063654,
-  1062150,
-  1062151,
-  1062152,
-  1062153,
-  1062154,
-  1062155,
-  1062156,
-  1062157,
-  1062158,
-  1062159,
-  1062980,
-  1062981,
-  1062982,
-  1062983,
-  1062984,
-  1062985,
-  1062986,
-  1062987,
-  1062988,
-  1062989,
-  1060480,
-  1060481,
-  1060482,
-  1060483,
-  1060484,
-  1060485,
-  1060486,
-  1061510,
-  1060487,
-  1061511,
-  1060488,
-  1061512,
-  1060489,
-  1061513,
-  1061514,
-  1061515,
-  1061516,
-  1061517,
-  1061518,
-  1061520,
-  1056153,
-  1056154,
-  1056155,
-  1056156,
-  1056157,
-  1056158,
-  1056159,
-  1063640,
-  1063641,
-  1058010,
-  1063642,
-  1058011,
-  1063643,
-  1058012,
-  1063644,
-  1058013,
-  1058014,
-  1058015,
-  1058016,
-  1058017,
-  1058018,
-  1051980,
-  1051981,
-  1051982,
-  1051983,
-  1051984,
-  1051985,
-  1051986,
-  1051987,
-  1051988,
-  1051989,
-  1045860,
-  1045861,
-  1045862,
-  1045863,
-  1045864,
-  1045865,
-  1045866,
-  1045867,
-  1045868,
-  1045869,
-  1045870,
-  1045871,
-  1045872,
-  1045873,
-  1045874,
-  1045875,
-  1045876,
-  1045877,
-  1045878,
-  1056150,
-  1056151,
-  1056152,
-  1039780,
-  975310,
-  975311,
-  975312,
-  975313,
-  975314,
-  975315,
-  975316,
-  975317,
-  975318,
-  986980,
-  1165030,
-  1164780,
-  1089241,
-  856090,
-  691520,
-  952652,
-  711510,
-  930240,
-  930250,
-  1114591,
-  1114590,
-  1164400,
-  968271,
-  968270,
-  952650,
-  1160990,
-  1016300,
-  976664,
-  976663,
-  976662,
-  976661,
-  848043,
-  1109770,
-  339080,
-  359521,
-  359522,
-  359520,
-  456802,
-  984430,
-  1148820,
-  1152530,
-  1163310,
-  1163650,
-  842820,
-  851610,
-  852200,
-  842880,
-  1161290,
-  1113150,
-  1024912,
-  1040880,
-  1160181,
-  1160180,
-  635530,
-  514320,
-  1142340,
-  777080,
-  1147830,
-  1155381,
-  508165,
-  1132350,
-  500213,
-  988760,
-  1140552,
-  1017390,
-  1017391,
-  1007420,
-  1007421,
-  980290,
-  980291,
-  1099590,
-  1099594,
-  956630,
-  956640,
-  956650,
-  1080031,
-  546311,
-  1089240,
-  1089237,
-  1089238,
-  1089239,
-  954120,
-  954130,
-  954140,
-  908340,
-  954020,
-  954090,
-  954110,
-  811210,
-  546312,
-  979140,
-  914770,
-  914780,
-  914790,
-  914810,
-  914820,
-  649160,
-  508163,
-  508161,
-  483790,
-  466710,
-  455530,
-  440130,
-  508160,
-  1145080,
-  1098162,
-  620260,
-  1143300,
-  1005350,
-  1147540,
-  514332,
-  663820,
-  1133880,
-  230891,
-  1093250,
-  1085200,
-  1076580,
-  852995,
-  892790,
-  476051,
-  476052,
-  580050,
-  1070122,
-  766102,
-  766101,
-  747720,
-  752630,
-  728461,
-  728460,
-  703440,
-  1158440,
-  1158441,
-  980100,
-  982460,
-  982470,
-  982471,
-  982472,
-  1146140,
-  1146141,
-  649550,
-  1146080,
-  1146064,
-  1146063,
-  1146062,
-  1146061,
-  1146060,
-  1143970,
-  1143971,
-  1143972,
-  1143973,
-  1143974,
-  1143975,
-  1143976,
-  1143977,
-  1143978,
-  1143979,
-  1143980,
-  1143981,
-  1143982,
-  1143983,
-  1143990,
-  1143991,
-  1143992,
-  1143993,
-  1143994,
-  1143995,
-  1146620,
-  1070123,
-  1070130,
-  1070131,
-  1070132,
-  1070140,
-  1070141,
-  1070142,
-  1132390,
-  535420,
-  1096840,
-  1149130,
-  463310,
-  437790,
-  1089233,
-  1125792,
-  1089236,
-  924185,
-  1089234,
-  1089235,
-  1125793,
-  91104,
-  91106,
-  924184,
-  828880,
-  894590,
-  1122850,
-  598710,
-  1155400,
-  1150240,
-  1150250,
-  1149260,
-  1149261,
-  205120,
-  205140,
-  1128703,
-  1128702,
-  206525,
-  1153970,
-  1140551,
-  1144230,
-  1144231,
-  670640,
-  1055334,
-  1080030,
-  1128400,
-  913610,
-  1154270,
-  1089222,
-  1089232,
-  1089231,
-  1089230,
-  1089229,
-  1089223,
-  940820,
-  694300,
-  1148190,
-  906830,
-  1110112,
-  208743,
-  208744,
-  208745,
-  208746,
-  208747,
-  208748,
-  208749,
-  1150830,
-  933261,
-  1150101,
-  1150102,
-  973290,
-  1152240,
-  1150320,
-  1089228,
-  1089227,
-  1089226,
-  1089225,
-  1089246,
-  573540,
-  1145170,
-  1136950,
-  968890,
-  1095624,
-  984710,
-  865700,
-  1134690,
-  1148970,
-  330511,
-  1012080,
-  1110110,
-  1110113,
-  984161,
-  1145310,
-  925190,
-  973830,
-  925191,
-  976280,
-  831160,
-  831161,
-  925180,
-  1069410,
-  1132960,
-  1070121,
-  1070120,
-  1070059,
-  1070058,
-  318795,
-  318790,
-  1070053,
-  1070052,
-  1070051,
-  1070050,
-  1067476,
-  1107881,
-  1140670,
-  1056990,
-  24066,
-  24067,
-  24068,
-  24069,
-  24070,
-  295174,
-  24071,
-  24072,
-  256520,
-  295177,
-  256521,
-  24074,
-  295178,
-  256523,
-  24076,
-  256524,
-  24077,
-  295181,
-  256525,
-  24078,
-  295182,
-  256526,
-  24079,
-  295183,
-  256527,
-  678160,
-  24080,
-  295184,
-  500240,
-  24081,
-  256529,
-  277778,
-  500242,
-  256530,
-  277779,
-  256531,
-  24084,
-  295188,
-  256532,
-  24085,
-  256533,
-  24086,
-  256534,
-  24087,
-  295191,
-  256535,
-  24088,
-  295192,
-  704280,
-  24089,
-  295193,
-  704281,
-  24090,
-  295194,
-  24091,
-  256539,
-  24092,
-  295197,
-  704285,
-  295198,
-  295199,
-  295200,
-  704288,
-  24097,
-  295201,
-  704289,
-  24098,
-  295202,
-  256546,
-  24099,
-  295203,
-  678180,
-  295204,
-  678181,
-  295205,
-  256549,
-  678182,
-  295206,
-  678183,
-  295207,
-  295208,
-  256552,
-  678185,
-  295209,
-  256554,
-  678187,
-  256555,
-  678188,
-  256556,
-  512310,
-  512311,
-  512312,
-  256568,
-  512313,
-  512314,
-  256570,
-  512315,
-  980540,
-  325951,
-  704320,
-  256576,
-  704321,
-  704322,
-  513090,
-  980546,
-  513091,
-  513092,
-  704325,
-  513093,
-  980549,
-  704326,
-  513094,
-  704327,
-  513095,
-  704328,
-  513096,
-  513097,
-  325961,
-  513098,
-  513099,
-  222540,
-  513100,
-  513101,
-  513102,
-  325966,
-  222543,
-  513103,
-  325967,
-  513104,
-  513105,
-  325969,
-  222546,
-  513106,
-  258642,
-  222547,
-  513107,
-  222548,
-  513108,
-  513109,
-  222550,
-  513110,
-  258646,
-  513111,
-  275800,
-  513112,
-  513113,
-  513114,
-  325978,
-  513115,
-  325979,
-  275804,
-  513116,
-  275805,
-  513117,
-  275806,
-  513118,
-  275807,
-  513119,
-  325983,
-  834400,
-  275809,
-  258657,
-  834402,
-  376931,
-  774755,
-  1055332,
-  621924,
-  834404,
-  774756,
-  222565,
-  834405,
-  258661,
-  256614,
-  834408,
-  774760,
-  222569,
-  621929,
-  834409,
-  222570,
-  643690,
-  258666,
-  222571,
-  376939,
-  222572,
-  325996,
-  643693,
-  643694,
-  643695,
-  678000,
-  643696,
-  967281,
-  643697,
-  326001,
-  643698,
-  258674,
-  326002,
-  376947,
-  967283,
-  643699,
-  326003,
-  376948,
-  326004,
-  222581,
-  967285,
-  258677,
-  678006,
-  326006,
-  222583,
-  326007,
-  678008,
-  376952,
-  967288,
-  326008,
-  326009,
-  326010,
-  326011,
-  326012,
-  376957,
-  326013,
-  222590,
-  326014,
-  326015,
-  326017,
-  376962,
-  326018,
-  222595,
-  326019,
-  376964,
-  967300,
-  326020,
-  326021,
-  326022,
-  326023,
-  376968,
-  326025,
-  326026,
-  326027,
-  326028,
-  222605,
-  326029,
-  376974,
-  326030,
-  222607,
-  326031,
-  222609,
-  326033,
-  623250,
-  326034,
-  326035,
-  222612,
-  326036,
-  326037,
-  326038,
-  326039,
-  222616,
-  326040,
-  326041,
-  326042,
-  222619,
-  326043,
-  623260,
-  326044,
-  208285,
-  222621,
-  623261,
-  326045,
-  623262,
-  326046,
-  623263,
-  326047,
-  222624,
-  623264,
-  623265,
-  326049,
-  208290,
-  222626,
-  623266,
-  623267,
-  623268,
-  222630,
-  208295,
-  208298,
-  222634,
-  208299,
-  222636,
-  222637,
-  222638,
-  208305,
-  275124,
-  275125,
-  208311,
-  275127,
-  275128,
-  208313,
-  861882,
-  208314,
-  65210,
-  861883,
-  208315,
-  448187,
-  65211,
-  861884,
-  208316,
-  65212,
-  208317,
-  65213,
-  275134,
-  65214,
-  65215,
-  208320,
-  208321,
-  448193,
-  562370,
-  208323,
-  275139,
-  65219,
-  448196,
-  65220,
-  448197,
-  65221,
-  562374,
-  65222,
-  65223,
-  275144,
-  562376,
-  896712,
-  448200,
-  448201,
-  65225,
-  448202,
-  65226,
-  448203,
-  65227,
-  896716,
-  448204,
-  448205,
-  448206,
-  65230,
-  448207,
-  448208,
-  448209,
-  65234,
-  65235,
-  208340,
-  562388,
-  65236,
-  208341,
-  65237,
-  65238,
-  562391,
-  208344,
-  24024,
-  65240,
-  208345,
-  562393,
-  65241,
-  562394,
-  208347,
-  275163,
-  562395,
-  24028,
-  562397,
-  65245,
-  562398,
-  24032,
-  65248,
-  24034,
-  24035,
-  65251,
-  24036,
-  208357,
-  24037,
-  24038,
-  642790,
-  24039,
-  24040,
-  24041,
-  65257,
-  24043,
-  208366,
-  277743,
-  24047,
-  24048,
-  277745,
-  24049,
-  208370,
-  24050,
-  500210,
-  24051,
-  24052,
-  500212,
-  277749,
-  24053,
-  642805,
-  208374,
-  24054,
-  24056,
-  500216,
-  277753,
-  24057,
-  500217,
-  896761,
-  208378,
-  24058,
-  896762,
-  24059,
-  24060,
-  24061,
-  24062,
-  277759,
-  1057841,
-  1089218,
-  1089220,
-  1089221,
-  977040,
-  963740,
-  976080,
-  933260,
-  974729,
-  1144120,
-  1120060,
-  1066330,
-  831162,
-  1146400,
-  1120180,
-  961471,
-  318240,
-  304620,
-  455562,
-  768855,
-  1137520,
-  948550,
-  1105190,
-  624940,
-  317501,
-  1115720,
-  562000,
-  1120610,
-  1038700,
-  1147410,
-  1148340,
-  63004,
-  63003,
-  1147680,
-  632190,
-  1135591,
-  1135580,
-  1135590,
-  1135640,
-  1147781,
-  1121540,
-  1120830,
-  1147780,
-  1110111,
-  1110120,
-  1110121,
-  899851,
-  899855,
-  899856,
-  899857,
-  899858,
-  899867,
-  899868,
-  899869,
-  899870,
-  899871,
-  899872,
-  899873,
-  899874,
-  899876,
-  899877,
-  899878,
-  899879,
-  899880,
-  899881,
-  899882,
-  899883,
-  899884,
-  899885,
-  899886,
-  899887,
-  899888,
-  899889,
-  899890,
-  899891,
-  899893,
-  899894,
-  899895,
-  899896,
-  899897,
-  899898,
-  899899,
-  899901,
-  899903,
-  899904,
-  899905,
-  899906,
-  899907,
-  899908,
-  899909,
-  899910,
-  1089160,
-  1089161,
-  1089162,
-  1089163,
-  1089164,
-  1089165,
-  1089166,
-  1089167,
-  1089168,
-  1089169,
-  1089170,
-  1089171,
-  1089172,
-  1089173,
-  1089174,
-  1089175,
-  1089176,
-  1089177,
-  1089178,
-  1089179,
-  1089180,
-  1089181,
-  1089182,
-  1089183,
-  1089184,
-  1089185,
-  1089186,
-  1089187,
-  1089188,
-  1089189,
-  1089190,
-  1089191,
-  1089192,
-  1089193,
-  1089194,
-  1089195,
-  1089196,
-  1089197,
-  1089198,
-  1089199,
-  1089200,
-  1089201,
-  1089202,
-  1089204,
-  1089205,
-  1089206,
-  1089207,
-  1089208,
-  1089209,
-  1089210,
-  1089211,
-  1089212,
-  1089213,
-  1089214,
-  1089215,
-  1089216,
-  1089217,
-  1145930,
-  872050,
-  870225,
-  870228,
-  1117290,
-  870212,
-  870224,
-  975421,
-  870223,
-  975420,
-  870253,
-  869980,
-  870214,
-  870219,
-  870211,
-  870222,
-  870217,
-  870220,
-  870216,
-  870227,
-  973970,
-  870210,
-  870215,
-  1074850,
-  1103270,
-  1124780,
-  1125550,
-  1070040,
-  1145190,
-  851270,
-  729440,
-  1146610,
-  953140,
-  412550,
-  1088080,
-  1138670,
-  1113810,
-  1133220,
-  1091120,
-  439541,
-  813621,
-  813620,
-  813622,
-  1139852,
-  1012406,
-  813624,
-  813625,
-  813627,
-  813612,
-  813613,
-  813615,
-  813616,
-  813623,
-  813610,
-  813611,
-  813626,
-  775300,
-  524592,
-  524593,
-  524594,
-  524595,
-  524596,
-  524591,
-  354469,
-  813614,
-  524590,
-  1130240,
-  1136640,
-  1032960,
-  1134850,
-  1138690,
-  1043970,
-  1030660,
-  1050630,
-  1129990,
-  1028870,
-  1095430,
-  1119240,
-  1093640,
-  1106440,
-  1130250,
-  1136650,
-  1129740,
-  1134860,
-  1136140,
-  1138700,
-  1038860,
-  1043980,
-  1030670,
-  1050640,
-  1130000,
-  1095440,
-  1119250,
-  1070610,
-  1130260,
-  1136660,
-  1075220,
-  1077780,
-  1129750,
-  1134870,
-  1138710,
-  1038870,
-  1043990,
-  1030680,
-  1130010,
-  1040410,
-  1119260,
-  1070620,
-  1106460,
-  1130270,
-  1136670,
-  1075230,
-  1077790,
-  1134880,
-  1138720,
-  1038880,
-  1044000,
-  1030690,
-  1130020,
-  1104420,
-  1119270,
-  1070630,
-  1106470,
-  1050920,
-  1130280,
-  1075240,
-  1077800,
-  1129770,
-  1134890,
-  1138730,
-  1038890,
-  1030700,
-  1033260,
-  1130030,
-  1119280,
-  1070640,
-  1106480,
-  1050930,
-  1130290,
-  1075250,
-  1077810,
-  1038130,
-  1129780,
-  1134900,
-  1138740,
-  1038900,
-  1030710,
-  1033270,
-  1130040,
-  1119290,
-  1070650,
-  1106490,
-  1050940,
-  1130300,
-  1075260,
-  1077820,
-  1038140,
-  1129790,
-  1134910,
-  1138750,
-  1038910,
-  1030720,
-  1130050,
-  1119300,
-  1106500,
-  1050950,
-  1130310,
-  1075270,
-  1077830,
-  1038150,
-  1043270,
-  1129800,
-  1134920,
-  1138760,
-  1038920,
-  1042760,
-  1130060,
-  1119310,
-  1070670,
-  1106510,
-  1050960,
-  1130320,
-  1075280,
-  1077840,
-  1043280,
-  1044560,
-  1134930,
-  1138770,
-  1038930,
-  1042770,
-  1130070,
-  1119320,
-  1055320,
-  1070680,
-  1106520,
-  1050970,
-  1130330,
-  1075290,
-  1033050,
-  1038170,
-  1043290,
-  1044570,
-  1134940,
-  1038940,
-  1130080,
-  1119330,
-  1050980,
-  1130340,
-  1075300,
-  1038180,
-  1043300,
-  1044580,
-  1134950,
-  1130090,
-  1119340,
-  1106540,
-  1050990,
-  1130350,
-  1075310,
-  1038190,
-  1044590,
-  1129840,
-  1134960,
-  1073520,
-  1038960,
-  1130100,
-  1119350,
-  1138550,
-  1106550,
-  1051000,
-  1130360,
-  1075320,
-  1038200,
-  1044600,
-  1129850,
-  1134970,
-  1038970,
-  1130110,
-  1119360,
-  1138560,
-  1106560,
-  1051010,
-  1130370,
-  1075330,
-  1038210,
-  1044610,
-  1129860,
-  1134980,
-  1069700,
-  1038980,
-  1075590,
-  1130120,
-  1136520,
-  1032840,
-  1106570,
-  1051020,
-  1077900,
-  1038220,
-  1129870,
-  1134990,
-  1038990,
-  1119120,
-  1075600,
-  1130130,
-  1136530,
-  1032850,
-  992660,
-  1134740,
-  1070740,
-  1106580,
-  1051030,
-  1077910,
-  1054360,
-  1129880,
-  1135000,
-  1137560,
-  1073560,
-  1039000,
-  1119130,
-  1075610,
-  1130140,
-  1136540,
-  1032860,
-  1055390,
-  1106590,
-  1077920,
-  1129890,
-  1135010,
-  1137570,
-  1073570,
-  1039010,
-  1119140,
-  1075620,
-  1130150,
-  1136550,
-  1141670,
-  1032870,
-  1055400,
-  1134760,
-  1106600,
-  1051050,
-  1076650,
-  1077930,
-  1129900,
-  1135020,
-  1137580,
-  1073580,
-  1039020,
-  1119150,
-  1075630,
-  1107630,
-  1130160,
-  1136560,
-  1032880,
-  1134770,
-  1106610,
-  1076660,
-  1077940,
-  1129910,
-  1137590,
-  1119160,
-  1075640,
-  1093560,
-  1130170,
-  1136570,
-  1091770,
-  1032890,
-  1134780,
-  1106620,
-  1076670,
-  1077950,
-  1137600,
-  1119170,
-  1075650,
-  1093570,
-  1130180,
-  1090500,
-  1091780,
-  1032900,
-  1134790,
-  1106630,
-  1076680,
-  1077960,
-  1129930,
-  1137610,
-  1119180,
-  1075660,
-  1093580,
-  1130190,
-  1136590,
-  1091790,
-  1032910,
-  1134800,
-  1106640,
-  1062610,
-  1076690,
-  1030610,
-  1129940,
-  1119190,
-  1055190,
-  1075670,
-  1093590,
-  1130200,
-  1136600,
-  1091800,
-  1032920,
-  1134810,
-  1023450,
-  1106650,
-  1043930,
-  1076700,
-  1030620,
-  1129950,
-  1119200,
-  1055200,
-  1075680,
-  1093600,
-  1106400,
-  1130210,
-  1136610,
-  1091810,
-  1032930,
-  1134820,
-  1043940,
-  1076710,
-  1030630,
-  1129960,
-  1041640,
-  1119210,
-  1075690,
-  1093610,
-  1106410,
-  1136620,
-  1091820,
-  1032940,
-  1134830,
-  1043950,
-  1030640,
-  1129970,
-  1095410,
-  1119220,
-  1075700,
-  1093620,
-  1106420,
-  1130230,
-  1136630,
-  1091830,
-  1032950,
-  1138680,
-  1043960,
-  1030650,
-  1129980,
-  1095420,
-  1119230,
-  1055230,
-  1093630,
-  1106430,
-  1097510,
-  1110122,
-  1110123,
-  1110124,
-  1110125,
-  620741,
-  620744,
-  620745,
-  620740,
-  620743,
-  620742,
-  1128460,
-  310600,
-  324040,
-  302281,
-  302282,
-  773690,
-  833310,
-  764950,
-  1094840,
-  1128290,
-  1050121,
-  1051790,
-  1051791,
-  1051780,
-  1051781,
-  1050120,
-  1042040,
-  1042050,
-  847411,
-  847412,
-  354463,
-  354461,
-  354462,
-  847410,
-  1117270,
-  602060,
-  1004830,
-  1006630,
-  1008440,
-  1003660,
-  1023440,
-  1004760,
-  1141190,
-  1111140,
-  1134490,
-  1140710,
-  894510,
-  632320,
-  830720,
-  704260,
-  548870,
-  657160,
-  1095690,
-  632340,
-  767260,
-  658720,
-  660000,
-  789041,
-  748850,
-  632370,
-  437580,
-  1109330,
-  607830,
-  656990,
-  803170,
-  660090,
-  662140,
-  728700,
-  940671,
-  1078400,
-  662150,
-  884870,
-  662160,
-  437410,
-  641970,
-  658640,
-  1132240,
-  630480,
-  658650,
-  943070,
-  657130,
-  824810,
-  635370,
-  657140,
-  635380,
-  632310,
-  615420,
-  657150,
-  1136751,
-  1136750,
-  722090,
-  948540,
-  604280,
-  1024410,
-  1094280,
-  1128510,
-  1086040,
-  1010680,
-  1071930,
-  1135490,
-  221164,
-  221167,
-  255690,
-  1049990,
-  1138340,
-  1128640,
-  512290,
-  789040,
-  791830,
-  1134561,
-  1134562,
-  791831,
-  1103750,
-  1125585,
-  1125584,
-  1125583,
-  1125582,
-  1125581,
-  1125580,
-  829510,
-  967278,
-  1124930,
-  1135290,
-  766610,
-  766611,
-  768710,
-  706290,
-  330240,
-  322510,
-  343760,
-  1131500,
-  330230,
-  1115240,
-  1008470,
-  1028650,
-  986470,
-  899490,
-  868990,
-  872100,
-  873130,
-  1115160,
-  1115170,
-  1124700,
-  1124701,
-  1124702,
-  949160,
-  908221,
-  908222,
-  1136480,
-  894290,
-  1136060,
-  1134350,
-  1128230,
-  1113710,
-  879330,
-  783880,
-  793330,
-  742021,
-  747420,
-  749230,
-  842651,
-  842650,
-  722310,
-  768856,
-  768853,
-  768854,
-  768850,
-  768852,
-  768851,
-  1009840,
-  851318,
-  404670,
-  789140,
-  1131020,
-  1087510,
-  1090330,
-  1085760,
-  1008310,
-  413330,
-  462611,
-  637130,
-  443690,
-  1063400,
-  871340,
-  1099122,
-  1117940,
-  945070,
-  520320,
-  1099120,
-  1099121,
-  1125790,
-  1125791,
-  1124590,
-  1127160,
-  894220,
-  1107590,
-  384530,
-  1057840,
-  1057000,
-  1111640,
-  1111670,
-  1128530,
-  768700,
-  768701,
-  768702,
-  1125430,
-  1068000,
-  1067990,
-  1111671,
-  925102,
-  925103,
-  1054070,
-  497140,
-  1073000,
-  1071230,
-  1076840,
-  676250,
-  676251,
-  676252,
-  676253,
-  676254,
-  676255,
-  676257,
-  676258,
-  676256,
-  1121610,
-  1129141,
-  991770,
-  991772,
-  908970,
-  1111000,
-  856150,
-  1063480,
-  445850,
-  324352,
-  360920,
-  324351,
-  324350,
-  231503,
-  231502,
-  231501,
-  231500,
-  1105880,
-  1126981,
-  1126980,
-  910620,
-  964880,
-  231499,
-  231498,
-  1059720,
-  1058970,
-  829000,
-  1050070,
-  1050060,
-  1042950,
-  366930,
-  1126380,
-  231510,
-  231509,
-  231452,
-  231511,
-  231497,
-  231496,
-  297519,
-  1032290,
-  1053080,
-  1003220,
-  935000,
-  935040,
-  936370,
-  936400,
-  936430,
-  936440,
-  996210,
-  936350,
-  936360,
-  936660,
-  936310,
-  936340,
-  936390,
-  936420,
-  936480,
-  936280,
-  936290,
-  936300,
-  936690,
-  936450,
-  1120070,
-  936460,
-  1121390,
-  1044190,
-  1095626,
-  1123880,
-  1108530,
-  1076090,
-  983090,
-  675400,
-  1042790,
-  1107890,
-  696030,
-  1115120,
-  1122530,
-  1052960,
-  530730,
-  288310,
-  806050,
-  1118540,
-  1113140,
-  1001260,
-  1109850,
-  1103751,
-  986240,
-  1098880,
-  815020,
-  961630,
-  1071560,
-  1004120,
-  438700,
-  317190,
-  317090,
-  316880,
-  238652,
-  1120843,
-  1120842,
-  1120840,
-  1116160,
-  646160,
-  1103440,
-  1103441,
-  988570,
-  1046540,
-  1118710,
-  1072222,
-  1072220,
-  1072221,
-  216419,
-  216420,
-  216429,
-  1110820,
-  636080,
-  990732,
-  990733,
-  1108790,
-  1108791,
-  1108792,
-  1108793,
-  1108794,
-  368910,
-  707890,
-  1102900,
-  1102901,
-  1102910,
-  1102922,
-  695371,
-  65110,
-  1086320,
-  345741,
-  1058460,
-  1058461,
-  1058462,
-  411040,
-  335290,
-  553700,
-  797540,
-  1096020,
-  967276,
-  93206,
-  93207,
-  959660,
-  1045600,
-  959630,
-  959640,
-  959620,
-  1114450,
-  959680,
-  959580,
-  959530,
-  996760,
-  281606,
-  940970,
-  848042,
-  848040,
-  807150,
-  848041,
-  1100020,
-  1106120,
-  1102921,
-  1102920,
-  1110590,
-  1114440,
-  24496,
-  752540,
-  1117190,
-  1117191,
-  1117192,
-  1009080,
-  304330,
-  307420,
-  1116610,
-  1116611,
-  1116612,
-  1116613,
-  1103741,
-  1103742,
-  1103752,
-  1061380,
-  948440,
-  1055580,
-  323730,
-  1006820,
-  65810,
-  1114441,
-  470290,
-  470291,
-  470292,
-  842570,
-  535201,
-  535202,
-  630190,
-  682200,
-  212675,
-  258811,
-  750630,
-  989520,
-  1106010,
-  1106011,
-  1106012,
-  1096350,
-  903860,
-  1106020,
-  1106021,
-  1106022,
-  1106023,
-  1106013,
-  1071396,
-  1000970,
-  1000940,
-  200300,
-  200310,
-  904650,
-  959820,
-  1084650,
-  1084651,
-  1087650,
-  396460,
-  1103680,
-  654174,
-  654170,
-  1109530,
-  1037870,
-  966410,
-  1099130,
-  835140,
-  1089450,
-  971520,
-  931340,
-  1070606,
-  1107480,
-  1070660,
-  1026630,
-  1026631,
-  1026650,
-  1026651,
-  1032801,
-  1026660,
-  1070700,
-  1070704,
-  1070707,
-  998800,
-  998801,
-  998802,
-  998804,
-  1106071,
-  1070604,
-  1070605,
-  1070661,
-  1070662,
-  1070663,
-  1070664,
-  1106000,
-  1070701,
-  1070702,
-  1070705,
-  1070706,
-  884790,
-  1032410,
-  1107120,
-  1099597,
-  1099595,
-  1099593,
-  1099591,
-  348190,
-  1105640,
-  563720,
-  374160,
-  321471,
-  744150,
-  473430,
-  345720,
-  712200,
-  1042580,
-  214643,
-  895840,
-  950590,
-  1083020,
-  1104130,
-  574966,
-  1057260,
-  1057261,
-  1057262,
-  1057265,
-  1057264,
-  998806,
-  998805,
-  749790,
-  704160,
-  1082570,
-  333630,
-  1088680,
-  1089150,
-  1089750,
-  1107090,
-  1093980,
-  1094500,
-  1042370,
-  1041171,
-  1041172,
-  1041173,
-  1035580,
-  1050714,
-  1050716,
-  1102540,
-  1082320,
-  973280,
-  811770,
-  801580,
-  799700,
-  799690,
-  799680,
-  798090,
-  798080,
-  798070,
-  798060,
-  798050,
-  798030,
-  798020,
-  798010,
-  798000,
-  797980,
-  797970,
-  797960,
-  797950,
-  797940,
-  797930,
-  797920,
-  797910,
-  797900,
-  797890,
-  797880,
-  797870,
-  797860,
-  797850,
-  797830,
-  797820,
-  797810,
-  797800,
-  797790,
-  797780,
-  797770,
-  797760,
-  797750,
-  797740,
-  797730,
-  797720,
-  334610,
-  325680,
-  325690,
-  325691,
-  325692,
-  320390,
-  333470,
-  333480,
-  333481,
-  705520,
-  705560,
-  705540,
-  72902,
-  72907,
-  72903,
-  72904,
-  255140,
-  72905,
-  746230,
-  1022540,
-  1015590,
-  1038090,
-  1077240,
-  1105290,
-  1074360,
-  461934,
-  502361,
-  461933,
-  644780,
-  381200,
-  381201,
-  411470,
-  348750,
-  530640,
-  530641,
-  502360,
-  466200,
-  311330,
-  73192,
-  287094,
-  73195,
-  287092,
-  287091,
-  73194,
-  287093,
-  287095,
-  73193,
-  287090,
-  329551,
-  397381,
-  397380,
-  329550,
-  313800,
-  312380,
-  1104810,
-  374750,
-  411010,
-  1071110,
-  1066060,
-  1066050,
-  983270,
-  983271,
-  846630,
-  852640,
-  1079750,
-  610270,
-  899330,
-  1087011,
-  1099380,
-  738680,
-  1082050,
-  996330,
-  1050790,
-  1046680,
-  1046681,
-  1046682,
-  920480,
-  809100,
-  958381,
-  758160,
-  1095621,
-  1095622,
-  1064630,
-  1091420,
-  1091430,
-  1091450,
-  1046690,
-  658670,
-  1091160,
-  1096451,
-  1096460,
-  586220,
-  264682,
-  1088081,
-  900443,
-  1094300,
-  58625,
-  58647,
-  996680,
-  1096080,
-  1096081,
-  1087900,
-  213781,
-  213782,
-  208691,
-  213231,
-  1089442,
-  1089441,
-  1089440,
-  1089422,
-  1089421,
-  1089420,
-  1068160,
-  574968,
-  456281,
-  1036114,
-  1079070,
-  1093190,
-  543560,
-  1075380,
-  1075381,
-  718690,
-  363253,
-  363251,
-  363250,
-  362650,
-  825090,
-  995030,
-  436460,
-  546374,
-  546371,
-  546372,
-  546370,
-  298781,
-  1058250,
-  989700,
-  1061190,
-  1096220,
-  984630,
-  1084470,
-  1094210,
-  1094220,
-  1094480,
-  1094490,
-  1093990,
-  1094550,
-  1094560,
-  795621,
-  406100,
-  1093940,
-  1093941,
-  498220,
-  498221,
-  498222,
-  498223,
-  426810,
-  393041,
-  642160,
-  542610,
-  542611,
-  542612,
-  1060520,
-  441780,
-  441781,
-  441782,
-  1067980,
-  1071820,
-  788440,
-  1091291,
-  545260,
-  425981,
-  425982,
-  1091290,
-  1011480,
-  988880,
-  1090320,
-  1056630,
-  1079490,
-  765970,
-  812820,
-  812830,
-  502980,
-  417190,
-  858720,
-  798320,
-  1090640,
-  958380,
-  1089580,
-  1089581,
-  943844,
-  425270,
-  946310,
-  328280,
-  328290,
-  285730,
-  272083,
-  272084,
-  1088450,
-  894970,
-  591620,
-  1084940,
-  1094284,
-  1094285,
-  1092890,
-  1085360,
-  1042540,
-  1016530,
-  1016540,
-  1015680,
-  1015690,
-  1016480,
-  1016500,
-  664390,
-  1092030,
-  1064570,
-  906720,
-  1093530,
-  609200,
-  571670,
-  335610,
-  1017220,
-  984440,
-  593170,
-  1072681,
-  1080710,
-  1082300,
-  860720,
-  894080,
-  1066340,
-  893750,
-  884791,
-  927880,
-  690300,
-  1090990,
-  1006750,
-  1090970,
-  239391,
-  385120,
-  687910,
-  1084700,
-  1084701,
-  1084860,
-  1085550,
-  1077170,
-  1088410,
-  1075890,
-  622750,
-  622740,
-  1084950,
-  1083250,
-  1078741,
-  884710,
-  870550,
-  870530,
-  1053860,
-  1053810,
-  816390,
-  819290,
-  959250,
-  996700,
-  994430,
-  579860,
-  1080470,
-  1076380,
-  990170,
-  1088020,
-  829460,
-  1065624,
-  1065625,
-  1065620,
-  1065622,
-  1065623,
-  1065621,
-  905190,
-  1087710,
-  1076430,
-  1036797,
-  346070,
-  346071,
-  646900,
-  956610,
-  1012760,
-  1025290,
-  1084410,
-  1079221,
-  322361,
-  586410,
-  582172,
-  322360,
-  582171,
-  983080,
-  819310,
-  708620,
-  736990,
-  708622,
-  455280,
-  376360,
-  937600,
-  1044400,
-  1053180,
-  1083340,
-  1053050,
-  1068085,
-  1068084,
-  1068083,
-  1068082,
-  1068081,
-  1068080,
-  1050530,
-  967272,
-  795600,
-  1059610,
-  750910,
-  750911,
-  750912,
-  1051750,
-  951850,
-  492790,
-  1080880,
-  270700,
-  952960,
-  1080460,
-  1054870,
-  990880,
-  1066710,
-  661141,
-  1074560,
-  732190,
-  1056624,
-  1056625,
-  1082210,
-  1056627,
-  1056628,
-  1056629,
-  1071340,
-  1066350,
-  1075870,
-  1075150,
-  608590,
-  995400,
-  995390,
-  921820,
-  1002110,
-  1025190,
-  758810,
-  780600,
-  742270,
-  759480,
-  503000,
-  1062170,
-  1065730,
-  647171,
-  647170,
-  1062190,
-  1059910,
-  1076890,
-  776800,
-  48196,
-  48198,
-  300661,
-  933400,
-  1079690,
-  1037620,
-  1075451,
-  1079220,
-  1075450,
-  1079240,
-  1075452,
-  1006210,
-  1057020,
-  1075453,
-  1075520,
-  1075521,
-  733960,
-  729730,
-  1067530,
-  1064760,
-  1074050,
-  1075470,
-  1067230,
-  1078170,
-  1076190,
-  1078070,
-  1048340,
-  1071420,
-  1030220,
-  1030221,
-  1030222,
-  1030223,
-  1030230,
-  921481,
-  997163,
-  235611,
-  249070,
-  940550,
-  1019320,
-  967271,
-  1072460,
-  683993,
-  1042450,
-  368401,
-  368400,
-  1066100,
-  1064500,
-  1072690,
-  1071050,
-  1015220,
-  1015221,
-  1015222,
-  990761,
-  990762,
-  354414,
-  1055860,
-  349160,
-  1032490,
-  1032460,
-  574965,
-  933012,
-  1066510,
-  869241,
-  430340,
-  430352,
-  430353,
-  430354,
-  420462,
-  396430,
-  396431,
-  396432,
-  396433,
-  410300,
-  410301,
-  410302,
-  412350,
-  410303,
-  410310,
-  410311,
-  449010,
-  449011,
-  872430,
-  1060830,
-  918630,
-  1071430,
-  526571,
-  526561,
-  526121,
-  526560,
-  987120,
-  538400,
-  526572,
-  526570,
-  526562,
-  526122,
-  526120,
-  1042440,
-  1071051,
-  1065240,
-  1024913,
-  981610,
-  1066851,
-  1066853,
-  916451,
-  916452,
-  899875,
-  1029430,
-  1029431,
-  1029432,
-  1029440,
-  1029441,
-  1029451,
-  816100,
-  842230,
-  924183,
-  924182,
-  201806,
-  1042720,
-  994950,
-  1058170,
-  868421,
-  1067910,
-  320988,
-  320989,
-  320986,
-  1065290,
-  491340,
-  437360,
-  1059630,
-  667470,
-  1056400,
-  790924,
-  790923,
-  1060910,
-  1042740,
-  1042741,
-  926830,
-  384720,
-  1011180,
-  1029390,
-  1029391,
-  1029392,
-  1029400,
-  1029401,
-  1029402,
-  1029410,
-  1029411,
-  63392,
-  210560,
-  1036410,
-  1044430,
-  714830,
-  714831,
-  634050,
-  350260,
-  1018151,
-  1018150,
-  1058440,
-  1009980,
-  941560,
-  861200,
-  1059590,
-  624760,
-  366847,
-  366846,
-  788160,
-  592813,
-  752110,
-  1033870,
-  1060860,
-  298784,
-  1060120,
-  1000780,
-  1000781,
-  1000782,
-  1000783,
-  1037180,
-  1029360,
-  1029361,
-  1029362,
-  1029370,
-  1029371,
-  1029372,
-  1029352,
-  899863,
-  899864,
-  899865,
-  899866,
-  816360,
-  950271,
-  1038550,
-  1038560,
-  311590,
-  900310,
-  1035810,
-  742730,
-  992850,
-  549970,
-  549971,
-  830830,
-  985980,
-  757890,
-  562820,
-  934310,
-  984530,
-  996340,
-  1056450,
-  752650,
-  730570,
-  722900,
-  1056270,
-  748500,
-  713700,
-  1011100,
-  1025090,
-  1049170,
-  300663,
-  293055,
-  300660,
-  1051460,
-  899852,
-  899853,
-  899854,
-  830840,
-  1058520,
-  1028721,
-  1028720,
-  1028712,
-  821240,
-  942380,
-  1031340,
-  1038530,
-  1029350,
-  1029351,
-  1029321,
-  1029322,
-  1029323,
-  1029330,
-  1050717,
-  1050715,
-  1050713,
-  1050711,
-  1023801,
-  892294,
-  1049770,
-  1054960,
-  1036220,
-  965102,
-  1052700,
-  1052701,
-  1056670,
-  739831,
-  1046342,
-  1046341,
-  1046340,
-  1046322,
-  1046321,
-  1046320,
-  561720,
-  793553,
-  277530,
-  277531,
-  291901,
-  291902,
-  1055581,
-  1055582,
-  945900,
-  966640,
-  1055570,
-  920599,
-  968490,
-  1046220,
-  920596,
-  920595,
-  753291,
-  1052273,
-  974727,
-  1046312,
-  1051550,
-  602210,
-  457990,
-  1028700,
-  1028701,
-  944230,
-  1029480,
-  1029481,
-  957126,
-  1029290,
-  1029300,
-  1029301,
-  1029310,
-  1029311,
-  1029312,
-  1028702,
-  1028704,
-  1028705,
-  1028710,
-  1028711,
-  1029280,
-  794108,
-  313760,
-  1050610,
-  1022402,
-  1044510,
-  1045410,
-  1045470,
-  1047330,
-  1034500,
-  646490,
-  457430,
-  960670,
-  811220,
-  1031750,
-  1049350,
-  1050890,
-  1049330,
-  1046311,
-  968810,
-  1024170,
-  1024171,
-  934320,
-  934321,
-  934330,
-  934331,
-  934340,
-  934341,
-  934350,
-  934351,
-  934352,
-  934353,
-  934360,
-  934361,
-  1038260,
-  640810,
-  804740,
-  804741,
-  804742,
-  804750,
-  648300,
-  648310,
-  382452,
-  623110,
-  584090,
-  584091,
-  621100,
-  362600,
-  556270,
-  508404,
-  378502,
-  378503,
-  1028790,
-  1028791,
-  1028792,
-  1028794,
-  1028795,
-  458440,
-  458441,
-  458442,
-  458443,
-  458444,
-  458460,
-  301890,
-  301891,
-  543890,
-  435160,
-  287770,
-  287771,
-  271940,
-  271941,
-  289120,
-  289121,
-  289122,
-  355700,
-  287360,
-  1050611,
-  1038510,
-  1033820,
-  1045550,
-  1046260,
-  1016620,
-  1035720,
-  515800,
-  949661,
-  949660,
-  1046310,
-  215812,
-  215813,
-  215814,
-  215815,
-  215816,
-  215817,
-  215818,
-  215819,
-  215820,
-  215825,
-  215826,
-  215827,
-  1024090,
-  998280,
-  998281,
-  998282,
-  998283,
-  998284,
-  998285,
-  998286,
-  1016590,
-  998287,
-  1017230,
-  998288,
-  998292,
-  998293,
-  998291,
-  998297,
-  998294,
-  998296,
-  998321,
-  998289,
-  998290,
-  998298,
-  998299,
-  998310,
-  998311,
-  998312,
-  998320,
-  1026350,
-  1022620,
-  1024190,
-  1010280,
-  974440,
-  974441,
-  962180,
-  962181,
-  894560,
-  894561,
-  898150,
-  898151,
-  904910,
-  904911,
-  903380,
-  903381,
-  707690,
-  731570,
-  676780,
-  1036450,
-  988740,
-  750491,
-  1022511,
-  1022512,
-  1022513,
-  1022514,
-  217115,
-  1020990,
-  939860,
-  209874,
-  209875,
-  209876,
-  209877,
-  1022426,
-  1022476,
-  1022477,
-  1022478,
-  1022479,
-  1022490,
-  1022491,
-  1022492,
-  1022493,
-  1022494,
-  1022495,
-  1022496,
-  1022497,
-  1022498,
-  1022499,
-  1022500,
-  1022501,
-  1022502,
-  1022503,
-  1022504,
-  1022505,
-  1022506,
-  1022507,
-  1022508,
-  1022509,
-  1022510,
-  1022464,
-  1022465,
-  1022466,
-  1022467,
-  1022468,
-  1022469,
-  1022470,
-  1022471,
-  1022472,
-  1022473,
-  1022474,
-  1022475,
-  1022429,
-  1022430,
-  1022431,
-  1022432,
-  1022433,
-  1022435,
-  1022436,
-  1022437,
-  1022438,
-  1022439,
-  1022440,
-  1022441,
-  1022442,
-  1022443,
-  1022444,
-  1022445,
-  1022446,
-  1022447,
-  1022448,
-  1022449,
-  1022460,
-  1022461,
-  1022462,
-  1022463,
-  1022330,
-  1022340,
-  1022343,
-  1022344,
-  1022345,
-  1022360,
-  1022361,
-  1022362,
-  1022365,
-  1022366,
-  1022367,
-  1022391,
-  1022392,
-  1022393,
-  1022394,
-  1022397,
-  1022400,
-  1022401,
-  1022410,
-  1022411,
-  1022412,
-  1022413,
-  1022414,
-  1022415,
-  1022416,
-  1022417,
-  1022418,
-  1022419,
-  1022420,
-  1022421,
-  1022422,
-  1022423,
-  1022424,
-  1022425,
-  1022427,
-  1022428,
-  1022520,
-  1022395,
-  1022396,
-  1047400,
-  1037370,
-  1037360,
-  1013780,
-  562870,
-  563100,
-  563101,
-  563102,
-  563103,
-  563104,
-  563105,
-  969260,
-  969261,
-  969262,
-  883640,
-  1037300,
-  889430,
-  1044661,
-  1044662,
-  1044660,
-  931020,
-  1046640,
-  326370,
-  735050,
-  992140,
-  907613,
-  907614,
-  907611,
-  1040330,
-  992130,
-  998258,
-  998259,
-  998243,
-  998244,
-  998250,
-  998251,
-  998252,
-  998253,
-  998254,
-  998255,
-  998256,
-  998261,
-  998240,
-  998241,
-  998242,
-  998245,
-  998246,
-  998247,
-  998248,
-  998249,
-  667710,
-  621960,
-  508810,
-  646920,
-  646921,
-  646922,
-  646860,
-  940672,
-  978220,
-  1019200,
-  1019201,
-  1039210,
-  925863,
-  1037520,
-  1037450,
-  1037451,
-  891440,
-  1043660,
-  1000401,
-  1039760,
-  1031950,
-  967274,
-  525390,
-  33325,
-  1019521,
-  1019520,
-  1019515,
-  1019514,
-  953910,
-  492620,
-  1044270,
-  258742,
-  1037860,
-  925869,
-  1040110,
-  1039450,
-  1031530,
-  1031520,
-  671360,
-  610697,
-  1030402,
-  1030401,
-  1030400,
-  582250,
-  924180,
-  924840,
-  924841,
-  928770,
-  928771,
-  521010,
-  522750,
-  1039390,
-  1041240,
-  998160,
-  998170,
-  998180,
-  998181,
-  998190,
-  998191,
-  998200,
-  998201,
-  998210,
-  998211,
-  998212,
-  998213,
-  998230,
-  998231,
-  998232,
-  998233,
-  998234,
-  998140,
-  998141,
-  998142,
-  1040500,
-  1040501,
-  925822,
-  1038060,
-  1039740,
-  1040030,
-  718700,
-  742820,
-  920970,
-  925870,
-  925868,
-  925865,
-  925866,
-  925867,
-  333230,
-  948572,
-  779520,
-  614620,
-  1034550,
-  462540,
-  568290,
-  1031720,
-  825590,
-  1019530,
-  650260,
-  650261,
-  650270,
-  650280,
-  1014640,
-  702330,
-  695500,
-  1032800,
-  1035480,
-  1018400,
-  623230,
-  952115,
-  995021,
-  605240,
-  998041,
-  998050,
-  998000,
-  998030,
-  998040,
-  471893,
-  471894,
-  471895,
-  471896,
-  471897,
-  471898,
-  457082,
-  457083,
-  457084,
-  457088,
-  1035520,
-  375630,
-  1002060,
-  925861,
-  261590,
-  925862,
-  925864,
-  925860,
-  906860,
-  925821,
-  1033760,
-  1031620,
-  261200,
-  856900,
-  856910,
-  856920,
-  897190,
-  856940,
-  892295,
-  892293,
-  1034640,
-  1034780,
-  379549,
-  967150,
-  782560,
-  1035130,
-  1035170,
-  1026930,
-  923250,
-  1019490,
-  1019481,
-  1019480,
-  995530,
-  995531,
-  933565,
-  933567,
-  933568,
-  933569,
-  933571,
-  987690,
-  952111,
-  952112,
-  952113,
-  952114,
-  933564,
-  933572,
-  933573,
-  440290,
-  440300,
-  933507,
-  933508,
-  933503,
-  933471,
-  1032200,
-  1034010,
-  735090,
-  440910,
-  440911,
-  440913,
-  420460,
-  420461,
-  427670,
-  427671,
-  426180,
-  426181,
-  439790,
-  321649,
-  782780,
-  429590,
-  428564,
-  428563,
-  428562,
-  428561,
-  428560,
-  427679,
-  427678,
-  427677,
-  427676,
-  427675,
-  427674,
-  427673,
-  427672,
-  426742,
-  426740,
-  426720,
-  426710,
-  426700,
-  426200,
-  420463,
-  413590,
-  410750,
-  406570,
-  388700,
-  381731,
-  381730,
-  381721,
-  381720,
-  377790,
-  376611,
-  376610,
-  363911,
-  363910,
-  352830,
-  344123,
-  344120,
-  344110,
-  339410,
-  316868,
-  316867,
-  316866,
-  316865,
-  316864,
-  316863,
-  316862,
-  316861,
-  316860,
-  316821,
-  316820,
-  316448,
-  316443,
-  316442,
-  316440,
-  265130,
-  265131,
-  265132,
-  978310,
-  998051,
-  998060,
-  998061,
-  998063,
-  998065,
-  998066,
-  998067,
-  998068,
-  998069,
-  998071,
-  998072,
-  998073,
-  998080,
-  998081,
-  998091,
-  998100,
-  998101,
-  998110,
-  998111,
-  998120,
-  998121,
-  998130,
-  534130,
-  534131,
-  509061,
-  1025220,
-  1023400,
-  863600,
-  359492,
-  359493,
-  359494,
-  359497,
-  614610,
-  264990,
-  264991,
-  264992,
-  264993,
-  264994,
-  264995,
-  264996,
-  413790,
-  265061,
-  413800,
-  413801,
-  654186,
-  413811,
-  413812,
-  413813,
-  413814,
-  413815,
-  413816,
-  413817,
-  645770,
-  645771,
-  814750,
-  691872,
-  691873,
-  691874,
-  617380,
-  226490,
-  915660,
-  915661,
-  113402,
-  113403,
-  1019280,
-  1019290,
-  925856,
-  925857,
-  925858,
-  1019300,
-  1009711,
-  1017910,
-  654188,
-  994510,
-  1026170,
-  1026171,
-  386920,
-  1026640,
-  1024870,
-  862400,
-  862401,
-  449880,
-  449871,
-  449870,
-  338900,
-  387940,
-  1002810,
-  510140,
-  1018363,
-  1018350,
-  1018360,
-  1018364,
-  802610,
-  874320,
-  990310,
-  990320,
-  990340,
-  774821,
-  774822,
-  774823,
-  486590,
-  242204,
-  242203,
-  880414,
-  1024240,
-  1006840,
-  510150,
-  1028290,
-  776570,
-  1015860,
-  646730,
-  925828,
-  925829,
-  925850,
-  925851,
-  925852,
-  925853,
-  925854,
-  925855,
-  1029010,
-  413810,
-  226491,
-  654185,
-  207221,
-  111910,
-  111911,
-  111912,
-  111913,
-  111914,
-  111915,
-  111916,
-  1001321,
-  1028200,
-  1020230,
-  1006821,
-  1006822,
-  965270,
-  916920,
-  212171,
-  212170,
-  212172,
-  311580,
-  346720,
-  1024040,
-  905310,
-  969600,
-  753292,
-  798896,
-  798895,
-  798894,
-  798893,
-  798892,
-  833730,
-  729410,
-  977530,
-  681680,
-  465630,
-  455760,
-  1021080,
-  920592,
-  920593,
-  920594,
-  920597,
-  920591,
-  441810,
-  366848,
-  366842,
-  366841,
-  366840,
-  925824,
-  925825,
-  896746,
-  1023330,
-  1012407,
-  1024270,
-  747410,
-  868250,
-  935080,
-  566010,
-  795620,
-  663310,
-  609300,
-  366850,
-  408630,
-  997160,
-  949780,
-  1002570,
-  816050,
-  579504,
-  579505,
-  579506,
-  579507,
-  579508,
-  1010530,
-  1010531,
-  1010532,
-  343590,
-  586900,
-  986140,
-  957090,
-  986290,
-  899411,
-  787890,
-  1018210,
-  688810,
-  914520,
-  345930,
-  715390,
-  996360,
-  907540,
-  261210,
-  1018480,
-  354428,
-  354429,
-  580030,
-  1001410,
-  1001420,
-  1001440,
-  264680,
-  264681,
-  264683,
-  925823,
-  995290,
-  925820,
-  462880,
-  356140,
-  360240,
-  363830,
-  352730,
-  990330,
-  315970,
-  315980,
-  382465,
-  382466,
-  382468,
-  382469,
-  382461,
-  382463,
-  922420,
-  207111,
-  207113,
-  207115,
-  221500,
-  921484,
-  921485,
-  921486,
-  983530,
-  731630,
-  656930,
-  387250,
-  826498,
-  1015960,
-  409650,
-  488997,
-  409254,
-  409255,
-  735140,
-  735150,
-  735180,
-  735190,
-  792140,
-  735120,
-  735210,
-  735100,
-  735230,
-  735130,
-  735160,
-  321643,
-  735080,
-  297898,
-  386820,
-  297895,
-  735070,
-  392646,
-  321647,
-  392642,
-  392644,
-  392647,
-  344121,
-  392640,
-  392645,
-  392641,
-  321642,
-  321648,
-  392630,
-  297896,
-  321641,
-  363230,
-  297892,
-  344122,
-  392643,
-  297890,
-  321640,
-  298771,
-  297891,
-  297894,
-  321646,
-  321644,
-  321645,
-  307330,
-  298770,
-  297897,
-  297893,
-  297880,
-  735200,
-  735220,
-  810910,
-  810830,
-  755860,
-  627980,
-  724060,
-  642720,
-  679290,
-  614020,
-  531169,
-  531159,
-  531155,
-  531154,
-  776840,
-  547230,
-  533555,
-  533554,
-  810820,
-  403062,
-  403060,
-  533553,
-  349940,
-  531164,
-  363630,
-  403061,
-  573546,
-  533556,
-  533559,
-  810860,
-  531150,
-  349941,
-  531156,
-  531171,
-  531167,
-  531170,
-  535950,
-  531158,
-  348685,
-  531172,
-  533551,
-  438710,
-  445262,
-  349931,
-  349930,
-  531160,
-  531153,
-  531168,
-  403350,
-  506850,
-  468190,
-  425140,
-  348686,
-  349937,
-  358143,
-  349936,
-  348684,
-  349933,
-  349939,
-  358141,
-  533550,
-  494510,
-  349934,
-  349938,
-  349935,
-  358140,
-  348687,
-  349932,
-  348682,
-  348681,
-  996570,
-  996540,
-  722880,
-  722881,
-  1012408,
-  467510,
-  429110,
-  410480,
-  451710,
-  369050,
-  351390,
-  344050,
-  1008350,
-  643630,
-  643640,
-  1012930,
-  1017110,
-  940670,
-  947130,
-  487460,
-  1016190,
-  958600,
-  1002150,
-  1011640,
-  961480,
-  951665,
-  999780,
-  832950,
-  1013230,
-  91612,
-  91618,
-  1010340,
-  614200,
-  820010,
-  938610,
-  781060,
-  566790,
-  462603,
-  885260,
-  427020,
-  690700,
-  462605,
-  846350,
-  863760,
-  698130,
-  808470,
-  868120,
-  711960,
-  676380,
-  846620,
-  846621,
-  412960,
-  694050,
-  857380,
-  541220,
-  857381,
-  612650,
-  884010,
-  809260,
-  884780,
-  876590,
-  888110,
-  644910,
-  719150,
-  527410,
-  864050,
-  883250,
-  634420,
-  848180,
-  634421,
-  872250,
-  765500,
-  661310,
-  667200,
-  580160,
-  845120,
-  449603,
-  833860,
-  542021,
-  791110,
-  880460,
-  884560,
-  644690,
-  731220,
-  865620,
-  551510,
-  641880,
-  885850,
-  885851,
-  697180,
-  804190,
-  880480,
-  884580,
-  823140,
-  804200,
-  607340,
-  580460,
-  497520,
-  799090,
-  865140,
-  883060,
-  883061,
-  883062,
-  876920,
-  743290,
-  438906,
-  868220,
-  839550,
-  326270,
-  856710,
-  874121,
-  756620,
-  875410,
-  883090,
-  632210,
-  867990,
-  567960,
-  884890,
-  858270,
-  885920,
-  851360,
-  722850,
-  722851,
-  882340,
-  630180,
-  803240,
-  846760,
-  880810,
-  884650,
-  592811,
-  384171,
-  887980,
-  592815,
-  456880,
-  875190,
-  326070,
-  862910,
-  873920,
-  875200,
-  862913,
-  837570,
-  779720,
-  459,
-  780240,
-  590290,
-  862931,
-  875220,
-  731610,
-  571610,
-  358620,
-  884700,
-  737760,
-  566760,
-  868330,
-  884970,
-  628970,
-  695530,
-  883180,
-  883181,
-  878830,
-  883182,
-  328690,
-  768500,
-  878840,
-  813560,
-  881660,
-  1006961,
-  439710,
-  649320,
-  649340,
-  1011360,
-  602350,
-  414210,
-  1002873,
-  1011920,
-  620520,
-  938110,
-  987600,
-  620560,
-  664360,
-  599760,
-  664280,
-  602340,
-  794344,
-  618090,
-  556950,
-  1001050,
-  940400,
-  939890,
-  939640,
-  940410,
-  939900,
-  938880,
-  939650,
-  940420,
-  938900,
-  940440,
-  938910,
-  939680,
-  940450,
-  938920,
-  940460,
-  939710,
-  938180,
-  609280,
-  602370,
-  664330,
-  609290,
-  602380,
-  564270,
-  564290,
-  598870,
-  599640,
-  585060,
-  598890,
-  599660,
-  585070,
-  598900,
-  598910,
-  570750,
-  570240,
-  599690,
-  570250,
-  938130,
-  570260,
-  938140,
-  619420,
-  570270,
-  598950,
-  938150,
-  570280,
-  620460,
-  619440,
-  599740,
-  620480,
-  619460,
-  620490,
-  570830,
-  564690,
-  620500,
-  609250,
-  582130,
-  585460,
-  609270,
-  1010320,
-  716691,
-  625030,
-  617040,
-  993180,
-  993181,
-  390980,
-  991774,
-  999940,
-  91617,
-  772400,
-  581940,
-  494650,
-  472630,
-  501250,
-  966150,
-  897060,
-  897061,
-  897062,
-  897063,
-  897064,
-  897065,
-  897066,
-  897067,
-  897068,
-  897069,
-  897070,
-  897071,
-  897072,
-  897073,
-  897074,
-  897075,
-  493630,
-  897090,
-  613700,
-  493640,
-  613710,
-  899920,
-  736370,
-  394370,
-  384140,
-  409230,
-  465040,
-  465320,
-  394410,
-  390320,
-  394420,
-  400820,
-  394421,
-  400821,
-  394422,
-  400822,
-  394423,
-  394424,
-  394425,
-  394426,
-  394427,
-  961472,
-  612550,
-  981190,
-  774611,
-  983770,
-  383450,
-  774621,
-  728550,
-  341990,
-  774631,
-  774641,
-  364020,
-  899060,
-  899061,
-  874580,
-  899550,
-  1001291,
-  748140,
-  875290,
-  798440,
-  873380,
-  890350,
-  977800,
-  1007920,
-  401430,
-  401440,
-  401450,
-  401460,
-  401470,
-  420320,
-  420322,
-  907571,
-  907570,
-  1001580,
-  1002870,
-  1002871,
-  1002872,
-  1006130,
-  366450,
-  995020,
-  396920,
-  1004530,
-  896542,
-  713280,
-  933460,
-  933470,
-  933490,
-  933491,
-  933492,
-  933493,
-  933500,
-  933501,
-  933502,
-  978160,
-  978161,
-  978162,
-  408140,
-  406510,
-  408160,
-  408150,
-  1003740,
-  1001720,
-  1001780,
-  1001320,
-  1003170,
-  823262,
-  256240,
-  1006080,
-  1004590,
-  1004450,
-  943843,
-  994710,
-  1000621,
-  1000620,
-  870760,
-  993410,
-  976350,
-  553620,
-  1002790,
-  996890,
-  986120,
-  986230,
-  976130,
-  981200,
-  981210,
-  981220,
-  805910,
-  847930,
-  909400,
-  804470,
-  804480,
-  811400,
-  805830,
-  911330,
-  911340,
-  629580,
-  581770,
-  581771,
-  581772,
-  581773,
-  580500,
-  784870,
-  580090,
-  896260,
-  788230,
-  788231,
-  925760,
-  945481,
-  945482,
-  891280,
-  816370,
-  975541,
-  616840,
-  781730,
-  999262,
-  999263,
-  957123,
-  957121,
-  957125,
-  957127,
-  995190,
-  880451,
-  880450,
-  880440,
-  880430,
-  880420,
-  880413,
-  880412,
-  880411,
-  880410,
-  209429,
-  993300,
-  1001920,
-  998540,
-  991220,
-  827730,
-  907170,
-  574964,
-  736530,
-  567360,
-  951950,
-  977250,
-  564681,
-  1001090,
-  986300,
-  915631,
-  975542,
-  986110,
-  986170,
-  945271,
-  945270,
-  970160,
-  971980,
-  890490,
-  997042,
-  977750,
-  913611,
-  979850,
-  560900,
-  919310,
-  452890,
-  812320,
-  996900,
-  784730,
-  292700,
-  245340,
-  292701,
-  292702,
-  784750,
-  784760,
-  493950,
-  811650,
-  784770,
-  811660,
-  784780,
-  811670,
-  784790,
-  784800,
-  883110,
-  784810,
-  784820,
-  982461,
-  488140,
-  662251,
-  997740,
-  945250,
-  217610,
-  217630,
-  229150,
-  229151,
-  229152,
-  229153,
-  229154,
-  229155,
-  229156,
-  229157,
-  229158,
-  229159,
-  229160,
-  229161,
-  229162,
-  229163,
-  229164,
-  217650,
-  229170,
-  257330,
-  257331,
-  257332,
-  257333,
-  257334,
-  239680,
-  239681,
-  239682,
-  239683,
-  239684,
-  239685,
-  239686,
-  239687,
-  239688,
-  217507,
-  217508,
-  217510,
-  217530,
-  217550,
-  254170,
-  217570,
-  254180,
-  254181,
-  254182,
-  254183,
-  254184,
-  254185,
-  217590,
-  922160,
-  313250,
-  457,
-  393910,
-  714660,
-  751800,
-  980930,
-  965420,
-  993710,
-  998350,
-  998351,
-  998352,
-  998353,
-  863410,
-  980860,
-  930570,
-  925740,
-  924340,
-  918290,
-  918210,
-  792510,
-  709580,
-  976370,
-  976371,
-  959430,
-  994660,
-  978170,
-  301720,
-  671070,
-  574967,
-  379556,
-  536577,
-  989170,
-  638980,
-  522500,
-  638981,
-  439830,
-  639001,
-  330280,
-  638010,
-  342590,
-  986180,
-  813380,
-  362820,
-  342600,
-  816980,
-  479061,
-  816982,
-  459360,
-  459361,
-  459362,
-  459363,
-  438900,
-  438901,
-  438902,
-  438903,
-  438904,
-  438905,
-  333441,
-  342160,
-  438950,
-  438951,
-  438960,
-  982473,
-  305400,
-  933011,
-  951667,
-  979861,
-  979860,
-  979852,
-  979851,
-  238570,
-  991580,
-  593990,
-  976660,
-  977060,
-  683992,
-  683994,
-  683991,
-  985410,
-  442830,
-  965520,
-  987460,
-  670961,
-  690730,
-  670960,
-  894870,
-  892290,
-  892292,
-  892291,
-  892289,
-  892288,
-  892287,
-  892286,
-  892285,
-  892284,
-  892283,
-  892282,
-  892281,
-  892280,
-  992010,
-  315160,
-  991910,
-  948541,
-  982910,
-  927040,
-  989480,
-  989500,
-  986000,
-  986001,
-  807261,
-  962980,
-  47420,
-  47421,
-  47422,
-  976540,
-  748070,
-  828490,
-  621210,
-  982490,
-  574960,
-  981230,
-  684110,
-  921830,
-  988780,
-  356471,
-  401634,
-  794620,
-  975040,
-  988550,
-  491310,
-  491300,
-  718230,
-  770581,
-  959550,
-  959560,
-  959570,
-  959610,
-  959650,
-  959670,
-  488993,
-  488995,
-  409651,
-  409204,
-  409240,
-  409250,
-  409251,
-  409256,
-  409257,
-  972870,
-  978532,
-  912850,
-  987680,
-  616980,
-  616990,
-  617000,
-  617001,
-  720450,
-  721980,
-  883320,
-  984280,
-  978530,
-  978531,
-  948910,
-  904250,
-  564320,
-  838920,
-  928540,
-  776990,
-  985390,
-  824370,
-  841530,
-  740930,
-  808050,
-  930180,
-  824750,
-  761270,
-  941240,
-  977860,
-  818130,
-  786930,
-  593920,
-  672550,
-  723250,
-  648770,
-  723530,
-  565070,
-  591700,
-  690030,
-  550800,
-  679610,
-  574400,
-  600770,
-  619970,
-  638410,
-  595180,
-  393024,
-  393025,
-  393026,
-  608170,
-  608180,
-  958970,
-  943842,
-  982960,
-  984160,
-  984162,
-  357131,
-  311450,
-  311431,
-  311430,
-  844480,
-  948250,
-  888700,
-  938450,
-  644922,
-  644921,
-  975540,
-  836570,
-  949110,
-  976100,
-  840520,
-  981730,
-  959910,
-  964500,
-  925390,
-  925400,
-  980080,
-  953090,
-  953091,
-  953092,
-  953093,
-  953094,
-  953095,
-  953096,
-  393057,
-  967340,
-  941100,
-  650390,
-  739460,
-  740700,
-  749620,
-  749280,
-  748280,
-  944160,
-  978150,
-  968230,
-  968240,
-  965930,
-  968220,
-  971970,
-  799524,
-  799521,
-  820940,
-  618280,
-  907080,
-  852030,
-  979750,
-  979630,
-  979631,
-  979632,
-  979633,
-  979634,
-  816940,
-  912700,
-  979635,
-  933570,
-  610696,
-  978350,
-  975082,
-  975080,
-  975081,
-  20902,
-  976650,
-  972860,
-  349970,
-  622730,
-  973870,
-  943831,
-  951663,
-  845149,
-  969090,
-  972880,
-  965850,
-  238450,
-  258930,
-  883800,
-  958820,
-  797590,
-  973500,
-  956220,
-  874890,
-  874892,
-  874893,
-  959450,
-  969430,
-  948620,
-  948621,
-  356620,
-  356472,
-  356474,
-  415650,
-  350170,
-  401627,
-  967980,
-  974460,
-  975930,
-  970230,
-  933534,
-  959110,
-  958660,
-  961140,
-  933533,
-  933535,
-  933536,
-  933537,
-  933538,
-  933539,
-  933550,
-  933551,
-  933552,
-  933553,
-  933554,
-  933555,
-  933556,
-  933557,
-  933558,
-  933560,
-  973520,
-  501891,
-  896800,
-  753286,
-  574962,
-  946520,
-  973490,
-  836370,
-  877830,
-  962990,
-  928560,
-  928570,
-  927780,
-  928550,
-  845148,
-  973180,
-  933505,
-  933506,
-  933522,
-  933512,
-  933520,
-  933511,
-  933510,
-  933509,
-  933523,
-  933532,
-  933528,
-  933530,
-  933531,
-  933529,
-  933525,
-  933526,
-  933527,
-  933561,
-  933562,
-  933563,
-  933566,
-  792150,
-  322740,
-  968680,
-  699250,
-  247296,
-  267230,
-  961780,
-  961470,
-  746870,
-  888210,
-  970990,
-  949664,
-  949663,
-  949665,
-  949662,
-  968180,
-  931800,
-  447750,
-  968740,
-  951870,
-  964480,
-  965980,
-  923310,
-  590350,
-  752510,
-  925620,
-  907572,
-  923640,
-  963750,
-  966440,
-  960771,
-  800777,
-  800778,
-  800784,
-  800785,
-  800787,
-  800788,
-  606240,
-  952870,
-  537390,
-  537391,
-  537392,
-  537400,
-  955970,
-  587080,
-  555860,
-  555862,
-  555863,
-  555864,
-  786030,
-  786031,
-  525180,
-  796540,
-  525181,
-  796541,
-  525182,
-  796542,
-  525184,
-  554880,
-  525185,
-  525186,
-  525187,
-  102028,
-  102029,
-  561810,
-  561812,
-  766100,
-  561813,
-  561814,
-  561815,
-  800430,
-  800431,
-  800432,
-  800433,
-  800434,
-  539060,
-  378551,
-  539070,
-  747721,
-  561890,
-  791530,
-  791531,
-  791532,
-  791533,
-  538350,
-  538351,
-  538352,
-  538353,
-  934130,
-  934131,
-  538360,
-  800760,
-  800761,
-  774273,
-  372470,
-  969070,
-  896743,
-  444360,
-  276200,
-  329840,
-  959230,
-  903110,
-  828610,
-  943450,
-  968913,
-  926320,
-  949491,
-  636600,
-  949495,
-  949494,
-  949492,
-  949490,
-  327810,
-  939090,
-  781400,
-  965290,
-  48173,
-  47936,
-  22360,
-  22362,
-  223591,
-  234040,
-  300600,
-  488822,
-  488823,
-  488824,
-  652930,
-  952500,
-  465210,
-  960770,
-  288813,
-  288814,
-  288815,
-  288816,
-  288817,
-  288818,
-  288819,
-  288820,
-  288822,
-  288823,
-  288824,
-  318110,
-  318111,
-  288810,
-  288811,
-  288812,
-  254580,
-  254581,
-  254582,
-  254583,
-  254584,
-  254585,
-  908040,
-  468580,
-  954100,
-  954102,
-  955440,
-  954960,
-  955480,
-  955520,
-  947980,
-  721100,
-  721101,
-  721102,
-  721103,
-  721104,
-  721105,
-  593053,
-  593054,
-  593056,
-  593057,
-  278140,
-  274111,
-  274112,
-  951668,
-  951661,
-  912830,
-  912831,
-  912832,
-  912833,
-  912835,
-  821210,
-  57921,
-  57922,
-  72906,
-  915090,
-  912834,
-  539240,
-  630663,
-  830570,
-  916432,
-  435190,
-  405730,
-  435200,
-  324300,
-  383660,
-  377730,
-  416711,
-  416713,
-  416710,
-  416712,
-  954221,
-  17714,
-  351070,
-  898130,
-  545140,
-  858300,
-  916772,
-  916771,
-  386130,
-  425370,
-  759170,
-  792490,
-  535710,
-  541860,
-  963340,
-  923152,
-  910932,
-  748290,
-  470691,
-  633990,
-  927830,
-  102003,
-  960120,
-  916431,
-  962421,
-  962420,
-  952480,
-  961160,
-  952210,
-  470690,
-  943841,
-  905170,
-  437232,
-  533650,
-  870840,
-  870848,
-  870849,
-  865730,
-  910030,
-  911590,
-  674240,
-  937510,
-  871630,
-  500236,
-  364320,
-  364326,
-  355640,
-  433740,
-  433742,
-  433743,
-  433744,
-  433745,
-  471890,
-  433747,
-  379231,
-  379232,
-  379234,
-  379240,
-  457080,
-  343952,
-  343955,
-  379540,
-  379543,
-  379550,
-  379553,
-  379555,
-  379569,
-  379570,
-  379571,
-  352181,
-  352182,
-  352183,
-  494520,
-  379576,
-  352185,
-  494521,
-  352186,
-  379578,
-  352187,
-  352188,
-  494524,
-  352189,
-  494525,
-  494526,
-  379582,
-  494527,
-  379585,
-  379589,
-  352200,
-  491491,
-  491492,
-  491496,
-  500201,
-  500202,
-  491499,
-  500203,
-  500204,
-  500205,
-  500206,
-  536578,
-  536579,
-  760844,
-  500238,
-  622351,
-  622352,
-  622354,
-  622355,
-  622357,
-  622358,
-  609820,
-  609822,
-  609824,
-  609825,
-  609827,
-  609828,
-  609829,
-  845140,
-  643670,
-  845142,
-  643671,
-  845143,
-  845144,
-  845147,
-  643680,
-  643683,
-  643684,
-  643686,
-  677992,
-  677993,
-  677994,
-  677995,
-  677996,
-  677997,
-  677998,
-  677999,
-  602800,
-  602801,
-  602810,
-  556218,
-  602811,
-  556219,
-  556220,
-  602813,
-  602814,
-  602815,
-  556223,
-  602816,
-  556224,
-  602817,
-  556225,
-  602818,
-  556226,
-  556229,
-  536541,
-  536544,
-  536546,
-  536547,
-  536548,
-  536549,
-  896749,
-  702961,
-  702962,
-  702963,
-  702964,
-  794101,
-  702965,
-  794102,
-  794103,
-  794104,
-  702968,
-  536570,
-  794107,
-  536571,
-  536572,
-  536573,
-  536574,
-  536575,
-  58649,
-  948360,
-  954950,
-  948380,
-  954940,
-  863620,
-  948361,
-  889300,
-  795660,
-  787020,
-  787030,
-  787080,
-  795790,
-  795800,
-  795810,
-  795820,
-  795830,
-  795840,
-  795850,
-  795860,
-  795880,
-  795890,
-  795900,
-  890020,
-  702800,
-  99613,
-  266720,
-  102002,
-  210450,
-  34494,
-  16864,
-  859670,
-  605020,
-  933010,
-  348900,
-  105411,
-  857153,
-  857152,
-  857151,
-  857150,
-  910930,
-  949640,
-  949641,
-  949642,
-  888512,
-  825220,
-  330040,
-  948810,
-  954220,
-  407820,
-  407821,
-  407822,
-  407823,
-  404610,
-  421770,
-  560441,
-  560442,
-  560440,
-  927030,
-  957290,
-  943122,
-  891000,
-  951350,
-  851750,
-  851310,
-  851396,
-  851397,
-  851398,
-  949610,
-  934610,
-  934961,
-  946902,
-  942360,
-  946150,
-  934960,
-  947810,
-  946901,
-  680720,
-  764020,
-  865660,
-  686210,
-  854200,
-  602460,
-  767580,
-  602461,
-  929620,
-  878700,
-  878701,
-  808110,
-  808140,
-  808150,
-  943870,
-  943871,
-  938550,
-  534640,
-  644920,
-  946900,
-  631293,
-  950640,
-  284700,
-  256230,
-  927240,
-  945032,
-  827790,
-  830610,
-  945400,
-  945401,
-  945402,
-  945403,
-  945404,
-  947590,
-  731904,
-  943120,
-  943121,
-  943910,
-  931420,
-  918640,
-  918650,
-  918660,
-  941720,
-  942260,
-  879730,
-  879731,
-  879732,
-  806370,
-  922581,
-  503850,
-  939080,
-  720370,
-  922570,
-  353870,
-  348080,
-  345910,
-  343700,
-  867200,
-  867220,
-  852000,
-  867230,
-  444040,
-  914081,
-  927210,
-  931193,
-  931191,
-  937240,
-  945370,
-  682520,
-  682540,
-  621980,
-  621981,
-  621990,
-  682460,
-  944600,
-  894211,
-  894212,
-  894213,
-  894214,
-  894215,
-  894216,
-  894217,
-  776710,
-  776711,
-  719900,
-  717600,
-  713770,
-  717900,
-  768390,
-  708270,
-  800990,
-  800991,
-  800992,
-  800993,
-  699380,
-  776700,
-  776701,
-  723200,
-  722950,
-  838610,
-  925020,
-  948570,
-  948571,
-  904870,
-  945031,
-  945033,
-  946750,
-  677130,
-  833100,
-  554320,
-  554321,
-  620150,
-  423854,
-  929720,
-  793535,
-  889610,
-  889611,
-  889612,
-  889613,
-  945220,
-  930980,
-  930982,
-  930984,
-  930990,
-  931192,
-  931190,
-  910560,
-  944891,
-  944892,
-  944893,
-  870841,
-  870842,
-  870843,
-  870844,
-  870845,
-  870846,
-  903100,
-  903660,
-  932080,
-  304134,
-  665150,
-  926970,
-  930985,
-  930991,
-  930983,
-  930981,
-  471800,
-  914840,
-  422691,
-  466380,
-  422690,
-  874720,
-  906861,
-  933100,
-  938991,
-  938990,
-  925380,
-  938420,
-  450780,
-  915690,
-  897280,
-  793751,
-  793531,
-  793532,
-  793533,
-  793538,
-  793539,
-  793540,
-  793541,
-  793543,
-  793544,
-  793548,
-  793550,
-  793552,
-  915180,
-  774111,
-  941910,
-  863680,
-  863681,
-  928380,
-  73179,
-  917260,
-  899551,
-  812130,
-  930790,
-  828500,
-  43120,
-  55409,
-  43130,
-  43140,
-  43163,
-  834510,
-  848210,
-  820151,
-  820152,
-  820153,
-  528320,
-  528321,
-  514590,
-  511780,
-  511781,
-  511782,
-  516780,
-  462601,
-  456270,
-  456271,
-  456350,
-  461770,
-  556360,
-  556370,
-  560990,
-  565622,
-  562130,
-  566500,
-  489330,
-  646950,
-  646951,
-  646952,
-  646953,
-  646970,
-  633963,
-  350520,
-  351557,
-  351559,
-  351560,
-  351561,
-  351562,
-  351563,
-  351564,
-  354410,
-  354411,
-  354412,
-  354415,
-  354416,
-  354417,
-  354418,
-  354419,
-  354420,
-  349170,
-  349171,
-  349172,
-  349173,
-  349174,
-  349175,
-  389990,
-  388030,
-  338722,
-  321440,
-  326620,
-  349176,
-  349177,
-  377410,
-  57920,
-  57924,
-  239180,
-  239181,
-  239182,
-  222803,
-  222805,
-  222806,
-  222807,
-  55384,
-  275240,
-  222801,
-  222802,
-  206435,
-  102020,
-  102030,
-  102031,
-  102032,
-  102033,
-  238481,
-  102034,
-  238482,
-  102035,
-  302020,
-  302030,
-  271840,
-  217850,
-  907550,
-  906910,
-  851470,
-  913240,
-  850370,
-  927800,
-  926560,
-  890860,
-  922311,
-  922312,
-  922313,
-  854320,
-  854321,
-  875370,
-  868221,
-  869860,
-  879680,
-  871910,
-  758540,
-  750140,
-  759100,
-  759101,
-  759102,
-  759103,
-  759110,
-  732560,
-  732570,
-  742330,
-  755700,
-  749060,
-  580231,
-  602580,
-  602581,
-  602582,
-  602583,
-  584950,
-  594180,
-  594183,
-  594270,
-  568170,
-  812200,
-  812210,
-  808890,
-  812220,
-  812230,
-  568011,
-  568012,
-  812240,
-  812250,
-  812260,
-  812270,
-  814070,
-  812280,
-  574790,
-  706140,
-  578140,
-  577900,
-  716690,
-  571160,
-  732580,
-  732590,
-  732600,
-  732610,
-  732620,
-  728781,
-  732630,
-  732640,
-  728810,
-  732650,
-  729590,
-  783380,
-  783390,
-  783391,
-  783392,
-  784710,
-  779350,
-  771940,
-  778100,
-  775550,
-  785810,
-  785120,
-  788220,
-  791660,
-  792440,
-  791420,
-  793555,
-  670741,
-  806710,
-  806711,
-  806712,
-  806713,
-  806714,
-  806715,
-  806716,
-  797320,
-  797321,
-  691870,
-  691871,
-  691670,
-  691671,
-  565,
-  690270,
-  690160,
-  386310,
-  541630,
-  572311,
-  611950,
-  879460,
-  337810,
-  323420,
-  571031,
-  931050,
-  928290,
-  679010,
-  679020,
-  684670,
-  526000,
-  526001,
-  526002,
-  927720,
-  935390,
-  462083,
-  918770,
-  910410,
-  623690,
-  411380,
-  410780,
-  717550,
-  887640,
-  934940,
-  918460,
-  926562,
-  926561,
-  852980,
-  911070,
-  598302,
-  742892,
-  462604,
-  931720,
-  931790,
-  678130,
-  827350,
-  292114,
-  292116,
-  292117,
-  292118,
-  292119,
-  329580,
-  329590,
-  495640,
-  874611,
-  337101,
-  337100,
-  336070,
-  326772,
-  326771,
-  326770,
-  320052,
-  320051,
-  320050,
-  337103,
-  337104,
-  337105,
-  337102,
-  262360,
-  262361,
-  262362,
-  328130,
-  352990,
-  918410,
-  859040,
-  909250,
-  929820,
-  456801,
-  358820,
-  923930,
-  932471,
-  932472,
-  914560,
-  914570,
-  720930,
-  212440,
-  212441,
-  212442,
-  212443,
-  212444,
-  212445,
-  212432,
-  223181,
-  930380,
-  930381,
-  922750,
-  707730,
-  823750,
-  823760,
-  582382,
-  927920,
-  547620,
-  554370,
-  553170,
-  551916,
-  551918,
-  925410,
-  891660,
-  918270,
-  896541,
-  701230,
-  692040,
-  802710,
-  838520,
-  650320,
-  889180,
-  919230,
-  532621,
-  586550,
-  697292,
-  697301,
-  697300,
-  697293,
-  697291,
-  666030,
-  794980,
-  893580,
-  710580,
-  917780,
-  486190,
-  899070,
-  573230,
-  245030,
-  220640,
-  213930,
-  732890,
-  916020,
-  532620,
-  222890,
-  629021,
-  619585,
-  768562,
-  768561,
-  768560,
-  354800,
-  743980,
-  856140,
-  856141,
-  856142,
-  856143,
-  856144,
-  856145,
-  856146,
-  856147,
-  856148,
-  842210,
-  842211,
-  842212,
-  842214,
-  842215,
-  896102,
-  921110,
-  917630,
-  894150,
-  854970,
-  854980,
-  915870,
-  917250,
-  912640,
-  907120,
-  908220,
-  908223,
-  908225,
-  908226,
-  908227,
-  904260,
-  903810,
-  894840,
-  889871,
-  889872,
-  889880,
-  892300,
-  892410,
-  889380,
-  889830,
-  889840,
-  884740,
-  883920,
-  881220,
-  881480,
-  882270,
-  881590,
-  881591,
-  874710,
-  874730,
-  874740,
-  874750,
-  870920,
-  872540,
-  870850,
-  870851,
-  870852,
-  870853,
-  870854,
-  870620,
-  866210,
-  866211,
-  866212,
-  866980,
-  866990,
-  861700,
-  861701,
-  860980,
-  860981,
-  859041,
-  854880,
-  856970,
-  856971,
-  856972,
-  856020,
-  853280,
-  853281,
-  853282,
-  852100,
-  854010,
-  850440,
-  850520,
-  850280,
-  850080,
-  850090,
-  848240,
-  847210,
-  842841,
-  845920,
-  844690,
-  844240,
-  841040,
-  842610,
-  842360,
-  842361,
-  842365,
-  842369,
-  841090,
-  842381,
-  842382,
-  842383,
-  842384,
-  838130,
-  838140,
-  836781,
-  836782,
-  836783,
-  836784,
-  836786,
-  836070,
-  834290,
-  832701,
-  832740,
-  829730,
-  829731,
-  829732,
-  829733,
-  829734,
-  829735,
-  829736,
-  829737,
-  826490,
-  826491,
-  826492,
-  826493,
-  826494,
-  826495,
-  826496,
-  826497,
-  826499,
-  826500,
-  826501,
-  826502,
-  826503,
-  826504,
-  826505,
-  826506,
-  826507,
-  826520,
-  827380,
-  825221,
-  823970,
-  823981,
-  824510,
-  820230,
-  820231,
-  820232,
-  822120,
-  820441,
-  816910,
-  817170,
-  818980,
-  818981,
-  818982,
-  819750,
-  819010,
-  818040,
-  819860,
-  817060,
-  817070,
-  817910,
-  820220,
-  813720,
-  811010,
-  812291,
-  811020,
-  810840,
-  810850,
-  810870,
-  810880,
-  810890,
-  810900,
-  813210,
-  810920,
-  812970,
-  810930,
-  813490,
-  813491,
-  810940,
-  813500,
-  811710,
-  811200,
-  810950,
-  810960,
-  810970,
-  810980,
-  810990,
-  811000,
-  807700,
-  809170,
-  802100,
-  802910,
-  802500,
-  804050,
-  806380,
-  799020,
-  799820,
-  795732,
-  793860,
-  793861,
-  793650,
-  788860,
-  787600,
-  787610,
-  787910,
-  788451,
-  788452,
-  788453,
-  788454,
-  788455,
-  785900,
-  780550,
-  781070,
-  780561,
-  782620,
-  783930,
-  780610,
-  780660,
-  780460,
-  776460,
-  776470,
-  776471,
-  776472,
-  776473,
-  776474,
-  776475,
-  776476,
-  776477,
-  776478,
-  776479,
-  779370,
-  779890,
-  779891,
-  779892,
-  779893,
-  779895,
-  779897,
-  779898,
-  779899,
-  776640,
-  774761,
-  775290,
-  774271,
-  774272,
-  774274,
-  774275,
-  774276,
-  773765,
-  774277,
-  774278,
-  774279,
-  773800,
-  773801,
-  773802,
-  773803,
-  773804,
-  773805,
-  773806,
-  775350,
-  775351,
-  773450,
-  773472,
-  773760,
-  773761,
-  773762,
-  773763,
-  771490,
-  773110,
-  770450,
-  766470,
-  766471,
-  766472,
-  766520,
-  766521,
-  766790,
-  766030,
-  766440,
-  766441,
-  766442,
-  766443,
-  766444,
-  766445,
-  766446,
-  766447,
-  766448,
-  766449,
-  767230,
-  763450,
-  763390,
-  760270,
-  760540,
-  761822,
-  761823,
-  759140,
-  758380,
-  756580,
-  754490,
-  753285,
-  753287,
-  753290,
-  753293,
-  751140,
-  752970,
-  751960,
-  751720,
-  753000,
-  753001,
-  753002,
-  753003,
-  753004,
-  753280,
-  747020,
-  747861,
-  747862,
-  747940,
-  747950,
-  748210,
-  747961,
-  742720,
-  745800,
-  745801,
-  745802,
-  743270,
-  743280,
-  744831,
-  744832,
-  744833,
-  744835,
-  744837,
-  744841,
-  744850,
-  744851,
-  744380,
-  746190,
-  746191,
-  746192,
-  746193,
-  740650,
-  740660,
-  742090,
-  738570,
-  737590,
-  737850,
-  736940,
-  736941,
-  736942,
-  736750,
-  738800,
-  734500,
-  734770,
-  734790,
-  735630,
-  733390,
-  733391,
-  735480,
-  731150,
-  731160,
-  732500,
-  730470,
-  732380,
-  732381,
-  729770,
-  729771,
-  729560,
-  728030,
-  728032,
-  725260,
-  724020,
-  722530,
-  724840,
-  722300,
-  726180,
-  722130,
-  723430,
-  724720,
-  720400,
-  719940,
-  719990,
-  721054,
-  721106,
-  721107,
-  721108,
-  721109,
-  721110,
-  721111,
-  721112,
-  721113,
-  721114,
-  721115,
-  721116,
-  721117,
-  721118,
-  721119,
-  721130,
-  721131,
-  721132,
-  721133,
-  721140,
-  721141,
-  721142,
-  721143,
-  721144,
-  721145,
-  721146,
-  721147,
-  721148,
-  721149,
-  721150,
-  721151,
-  717650,
-  716450,
-  719530,
-  719790,
-  715080,
-  715150,
-  714330,
-  714331,
-  714332,
-  714333,
-  714334,
-  714335,
-  714336,
-  714337,
-  714380,
-  712590,
-  707620,
-  709171,
-  709172,
-  709173,
-  709174,
-  709175,
-  709210,
-  710500,
-  710530,
-  708520,
-  708521,
-  708522,
-  708523,
-  708530,
-  709300,
-  706060,
-  707090,
-  706580,
-  706070,
-  706080,
-  706090,
-  706100,
-  706110,
-  706910,
-  704630,
-  704900,
-  704930,
-  707240,
-  707070,
-  702750,
-  703350,
-  700430,
-  702230,
-  702240,
-  702250,
-  700230,
-  702560,
-  702561,
-  701310,
-  701311,
-  700800,
-  701312,
-  700040,
-  700041,
-  700044,
-  700045,
-  700046,
-  700048,
-  700080,
-  700082,
-  700083,
-  700084,
-  700085,
-  700086,
-  700087,
-  623130,
-  623131,
-  623132,
-  623133,
-  623134,
-  623191,
-  623192,
-  623193,
-  623194,
-  623195,
-  623196,
-  623197,
-  623198,
-  623200,
-  622990,
-  622991,
-  623000,
-  623020,
-  622331,
-  619800,
-  619801,
-  620320,
-  620321,
-  620322,
-  620323,
-  620324,
-  620325,
-  620326,
-  620850,
-  620151,
-  617490,
-  617500,
-  617510,
-  617520,
-  617530,
-  619070,
-  618940,
-  618730,
-  616970,
-  614740,
-  616020,
-  614240,
-  612870,
-  614170,
-  613430,
-  614080,
-  612560,
-  614110,
-  614111,
-  612200,
-  611740,
-  612320,
-  610050,
-  610060,
-  609860,
-  610910,
-  610690,
-  610691,
-  610692,
-  610694,
-  610695,
-  610698,
-  610970,
-  609951,
-  609952,
-  609953,
-  609954,
-  609955,
-  609957,
-  609311,
-  607300,
-  607310,
-  607570,
-  607320,
-  608090,
-  607580,
-  608420,
-  607143,
-  605953,
-  605954,
-  605955,
-  605956,
-  605957,
-  605959,
-  605960,
-  605961,
-  607010,
-  605325,
-  605326,
-  605327,
-  605328,
-  605330,
-  605331,
-  605332,
-  605333,
-  605334,
-  605335,
-  605350,
-  605351,
-  605352,
-  605353,
-  605354,
-  605360,
-  605361,
-  605400,
-  605940,
-  602690,
-  605270,
-  603510,
-  603520,
-  604290,
-  605320,
-  605321,
-  605322,
-  605323,
-  605324,
-  603300,
-  603301,
-  603302,
-  603303,
-  603305,
-  603306,
-  603307,
-  603308,
-  603310,
-  602440,
-  602441,
-  602450,
-  602451,
-  602470,
-  602290,
-  601290,
-  601291,
-  601292,
-  601293,
-  601294,
-  601295,
-  601296,
-  601297,
-  601298,
-  601300,
-  601301,
-  601302,
-  601303,
-  601820,
-  601310,
-  601850,
-  599810,
-  597780,
-  599850,
-  599851,
-  599400,
-  597870,
-  599930,
-  599931,
-  599932,
-  599933,
-  599980,
-  598210,
-  599520,
-  599530,
-  599020,
-  599021,
-  599022,
-  599023,
-  599540,
-  596480,
-  595970,
-  596230,
-  596231,
-  595750,
-  595751,
-  595752,
-  595753,
-  595754,
-  595755,
-  595756,
-  595757,
-  597070,
-  597073,
-  597077,
-  597078,
-  597079,
-  597100,
-  597101,
-  597102,
-  597103,
-  596860,
-  595330,
-  595331,
-  595332,
-  596110,
-  594432,
-  594433,
-  594440,
-  594450,
-  594451,
-  594452,
-  594453,
-  594454,
-  593431,
-  594460,
-  594461,
-  594462,
-  594463,
-  594464,
-  594470,
-  594480,
-  592980,
-  592981,
-  593271,
-  593272,
-  593273,
-  594560,
-  594561,
-  593550,
-  593040,
-  594400,
-  594430,
-  594431,
-  591872,
-  592671,
-  592531,
-  591770,
-  591771,
-  591772,
-  591773,
-  591774,
-  591775,
-  591776,
-  591777,
-  591778,
-  591779,
-  591780,
-  591781,
-  591820,
-  591600,
-  591870,
-  591871,
-  591121,
-  590392,
-  590393,
-  590410,
-  589810,
-  589811,
-  589812,
-  589813,
-  589560,
-  586760,
-  588810,
-  586010,
-  588130,
-  586870,
-  586420,
-  589020,
-  589021,
-  586730,
-  586731,
-  586732,
-  586000,
-  585520,
-  585540,
-  585130,
-  583800,
-  582240,
-  580830,
-  580831,
-  580832,
-  580833,
-  579900,
-  579901,
-  579910,
-  579911,
-  580192,
-  579100,
-  578380,
-  579410,
-  578970,
-  579320,
-  577600,
-  577610,
-  576450,
-  578270,
-  578020,
-  573510,
-  573511,
-  573512,
-  573513,
-  574300,
-  573541,
-  573542,
-  573543,
-  573544,
-  573545,
-  573548,
-  573350,
-  573161,
-  574961,
-  571150,
-  571030,
-  571362,
-  570160,
-  570170,
-  570180,
-  570181,
-  570190,
-  570200,
-  570210,
-  570801,
-  570361,
-  570363,
-  568080,
-  568120,
-  569160,
-  569680,
-  569681,
-  569682,
-  569683,
-  569684,
-  569685,
-  569686,
-  569687,
-  569688,
-  569689,
-  569690,
-  569691,
-  569692,
-  569711,
-  569712,
-  569713,
-  569714,
-  569715,
-  569730,
-  569240,
-  569241,
-  569242,
-  569243,
-  569244,
-  569245,
-  569246,
-  569247,
-  569248,
-  569249,
-  569790,
-  569320,
-  565261,
-  565810,
-  565820,
-  565830,
-  567110,
-  566960,
-  566450,
-  566460,
-  566470,
-  565470,
-  564500,
-  564501,
-  564502,
-  564503,
-  564504,
-  564505,
-  564506,
-  564507,
-  564508,
-  564020,
-  563780,
-  564322,
-  563300,
-  564324,
-  563820,
-  564850,
-  564120,
-  564130,
-  564910,
-  564410,
-  564411,
-  564412,
-  564413,
-  564414,
-  564415,
-  564416,
-  562850,
-  562142,
-  562151,
-  561522,
-  561542,
-  561544,
-  561546,
-  561548,
-  561549,
-  561550,
-  561554,
-  561555,
-  561557,
-  561558,
-  561559,
-  561560,
-  561561,
-  561050,
-  561566,
-  561567,
-  558860,
-  559470,
-  558970,
-  558830,
-  558831,
-  558832,
-  558833,
-  558834,
-  558835,
-  558836,
-  558080,
-  558081,
-  558082,
-  558083,
-  558084,
-  558085,
-  558630,
-  558380,
-  558381,
-  558382,
-  558400,
-  558510,
-  558511,
-  558512,
-  558513,
-  558514,
-  558270,
-  557510,
-  558300,
-  558301,
-  558302,
-  556352,
-  557000,
-  557001,
-  557003,
-  556030,
-  554270,
-  554271,
-  554272,
-  554273,
-  553771,
-  553861,
-  553980,
-  551970,
-  551971,
-  552490,
-  551911,
-  551913,
-  551914,
-  551915,
-  550460,
-  550030,
-  549610,
-  549620,
-  548880,
-  548120,
-  548380,
-  548660,
-  547430,
-  547070,
-  544770,
-  544260,
-  543750,
-  545070,
-  543550,
-  543820,
-  543821,
-  543822,
-  543823,
-  543330,
-  543331,
-  544620,
-  545160,
-  543630,
-  543470,
-  544240,
-  544250,
-  542760,
-  542761,
-  540752,
-  542040,
-  540800,
-  540801,
-  540802,
-  540803,
-  540804,
-  540805,
-  541360,
-  541361,
-  542130,
-  542950,
-  539910,
-  539920,
-  539930,
-  539940,
-  539950,
-  539960,
-  539970,
-  539780,
-  539790,
-  539800,
-  539810,
-  539820,
-  539830,
-  540090,
-  539840,
-  539590,
-  539591,
-  539592,
-  539593,
-  539594,
-  539850,
-  539595,
-  539860,
-  539100,
-  539101,
-  539102,
-  539870,
-  539103,
-  539104,
-  539880,
-  539890,
-  539900,
-  536600,
-  537120,
-  536650,
-  537930,
-  536651,
-  537940,
-  537210,
-  538750,
-  536720,
-  538770,
-  536730,
-  537790,
-  537300,
-  537070,
-  537080,
-  536310,
-  535570,
-  535580,
-  535590,
-  535600,
-  534860,
-  535130,
-  534940,
-  535540,
-  535550,
-  532240,
-  532250,
-  532251,
-  532810,
-  532850,
-  532940,
-  530591,
-  530592,
-  530593,
-  530594,
-  530670,
-  530671,
-  528490,
-  529530,
-  529531,
-  528570,
-  529350,
-  526150,
-  525410,
-  525412,
-  525413,
-  525960,
-  527780,
-  525034,
-  525035,
-  526070,
-  524040,
-  524042,
-  523531,
-  524043,
-  523532,
-  523533,
-  523534,
-  523840,
-  525014,
-  523990,
-  525015,
-  525017,
-  525018,
-  525020,
-  525032,
-  525033,
-  523521,
-  523530,
-  522330,
-  521610,
-  523502,
-  523503,
-  523504,
-  523505,
-  523506,
-  523507,
-  519950,
-  520480,
-  520790,
-  518760,
-  520560,
-  520561,
-  517752,
-  517760,
-  517761,
-  517762,
-  520870,
-  520871,
-  520872,
-  520873,
-  520620,
-  517830,
-  518370,
-  517730,
-  516710,
-  517750,
-  517751,
-  516770,
-  516060,
-  513130,
-  514683,
-  514684,
-  514685,
-  512780,
-  512810,
-  512820,
-  512840,
-  512850,
-  512860,
-  512870,
-  511930,
-  512480,
-  512510,
-  510271,
-  511640,
-  511650,
-  511480,
-  508970,
-  508770,
-  508771,
-  509030,
-  508560,
-  508561,
-  509080,
-  509081,
-  508570,
-  505620,
-  506940,
-  502850,
-  505250,
-  501770,
-  501260,
-  501520,
-  501521,
-  501780,
-  501540,
-  501550,
-  501040,
-  500530,
-  500540,
-  500410,
-  501960,
-  501961,
-  501962,
-  501963,
-  501964,
-  501965,
-  501966,
-  501967,
-  501968,
-  501969,
-  502510,
-  500391,
-  500400,
-  499530,
-  497620,
-  497621,
-  498670,
-  495360,
-  495361,
-  494880,
-  494881,
-  494882,
-  494883,
-  496433,
-  495170,
-  495953,
-  495954,
-  496220,
-  494080,
-  494110,
-  493120,
-  493240,
-  493300,
-  493301,
-  493560,
-  491570,
-  492420,
-  489490,
-  489500,
-  490070,
-  490071,
-  490072,
-  490073,
-  490074,
-  490075,
-  490076,
-  490350,
-  489840,
-  489841,
-  489842,
-  489843,
-  489844,
-  489845,
-  489846,
-  489847,
-  489848,
-  489849,
-  489850,
-  489851,
-  489852,
-  490410,
-  490411,
-  490412,
-  489390,
-  489391,
-  489393,
-  490190,
-  490191,
-  490192,
-  489970,
-  489971,
-  489972,
-  489973,
-  489974,
-  489975,
-  489976,
-  489977,
-  489978,
-  487680,
-  488980,
-  488981,
-  488750,
-  487540,
-  487550,
-  488830,
-  488831,
-  488870,
-  488170,
-  486710,
-  486000,
-  486001,
-  486003,
-  486005,
-  486006,
-  486007,
-  486008,
-  486009,
-  486010,
-  486011,
-  486012,
-  485320,
-  486090,
-  486610,
-  486100,
-  483940,
-  483941,
-  484810,
-  483810,
-  484580,
-  482220,
-  482221,
-  482222,
-  482223,
-  482224,
-  479240,
-  479580,
-  477780,
-  477781,
-  477820,
-  476470,
-  477240,
-  477000,
-  476520,
-  477050,
-  476860,
-  476861,
-  476863,
-  476864,
-  476865,
-  476866,
-  476867,
-  476868,
-  476870,
-  475420,
-  475450,
-  475000,
-  474260,
-  475030,
-  475031,
-  474800,
-  474801,
-  474802,
-  474803,
-  472840,
-  472841,
-  472860,
-  472861,
-  473660,
-  473440,
-  473441,
-  473442,
-  473443,
-  473444,
-  473445,
-  473446,
-  473447,
-  472750,
-  472810,
-  472811,
-  472820,
-  472821,
-  472822,
-  472823,
-  472824,
-  472825,
-  472826,
-  472827,
-  472828,
-  471420,
-  471240,
-  471520,
-  470620,
-  470930,
-  470680,
-  470011,
-  470012,
-  468736,
-  468738,
-  468739,
-  469050,
-  468600,
-  468390,
-  468720,
-  468721,
-  468722,
-  468724,
-  468727,
-  468728,
-  468729,
-  468731,
-  468732,
-  468734,
-  468735,
-  467030,
-  467031,
-  467032,
-  467033,
-  467034,
-  467035,
-  467036,
-  467037,
-  467038,
-  467039,
-  467040,
-  467041,
-  467042,
-  467043,
-  467044,
-  467045,
-  467046,
-  467047,
-  467048,
-  467049,
-  467050,
-  467051,
-  464200,
-  464201,
-  464203,
-  464204,
-  464205,
-  464206,
-  463951,
-  464210,
-  464220,
-  464510,
-  464511,
-  464512,
-  464513,
-  464520,
-  464521,
-  464523,
-  464524,
-  464525,
-  464580,
-  466150,
-  464370,
-  462140,
-  462150,
-  462190,
-  461071,
-  461073,
-  461610,
-  461930,
-  461931,
-  461932,
-  461935,
-  460420,
-  461461,
-  461250,
-  460110,
-  459600,
-  458620,
-  457610,
-  457620,
-  458910,
-  457630,
-  459450,
-  459500,
-  458220,
-  459501,
-  456770,
-  456310,
-  457360,
-  456370,
-  455890,
-  457180,
-  453410,
-  455250,
-  455010,
-  453490,
-  455571,
-  455060,
-  455061,
-  455573,
-  455062,
-  455574,
-  455575,
-  455576,
-  455577,
-  454810,
-  455578,
-  455579,
-  455581,
-  455070,
-  453561,
-  453562,
-  455610,
-  453563,
-  455611,
-  455612,
-  453600,
-  453361,
-  453630,
-  453200,
-  453210,
-  452190,
-  452191,
-  452192,
-  452193,
-  452250,
-  452251,
-  450880,
-  450881,
-  451420,
-  451421,
-  451422,
-  451680,
-  451460,
-  451461,
-  451462,
-  451463,
-  451464,
-  451465,
-  451466,
-  451467,
-  451468,
-  451469,
-  451530,
-  451531,
-  451532,
-  451533,
-  451534,
-  451535,
-  451536,
-  451537,
-  451538,
-  451539,
-  451550,
-  451320,
-  451580,
-  450001,
-  450010,
-  447490,
-  447260,
-  447261,
-  447870,
-  447130,
-  446920,
-  447440,
-  447480,
-  445460,
-  446740,
-  445470,
-  445471,
-  445472,
-  445473,
-  445474,
-  445475,
-  445476,
-  445477,
-  445478,
-  445479,
-  445480,
-  445481,
-  445482,
-  445483,
-  445484,
-  445485,
-  445500,
-  445501,
-  445502,
-  445510,
-  445511,
-  445512,
-  445513,
-  445530,
-  446370,
-  446130,
-  446131,
-  446132,
-  446133,
-  446134,
-  446135,
-  446140,
-  446141,
-  446142,
-  443692,
-  445240,
-  445250,
-  443470,
-  445270,
-  445271,
-  445272,
-  444300,
-  442130,
-  442150,
-  443180,
-  442160,
-  441651,
-  443200,
-  443201,
-  443202,
-  443203,
-  443204,
-  443205,
-  443206,
-  443207,
-  441930,
-  443240,
-  442240,
-  441740,
-  443300,
-  443100,
-  443390,
-  440400,
-  440912,
-  440914,
-  440915,
-  440920,
-  440921,
-  441480,
-  439990,
-  439992,
-  439993,
-  439994,
-  439330,
-  439360,
-  438890,
-  438390,
-  437930,
-  439510,
-  438500,
-  437280,
-  437281,
-  437282,
-  437110,
-  437702,
-  435500,
-  435760,
-  436083,
-  435890,
-  435170,
-  435171,
-  435172,
-  435173,
-  435174,
-  435175,
-  435176,
-  435690,
-  435180,
-  433680,
-  433690,
-  433200,
-  433780,
-  433040,
-  430390,
-  430480,
-  430310,
-  430311,
-  430312,
-  430313,
-  430314,
-  430315,
-  430316,
-  430317,
-  430318,
-  430319,
-  430320,
-  432880,
-  430321,
-  430322,
-  430323,
-  430324,
-  430325,
-  430326,
-  430327,
-  430328,
-  430329,
-  430090,
-  430091,
-  430092,
-  430093,
-  429870,
-  429871,
-  429872,
-  429890,
-  428620,
-  429900,
-  429901,
-  429902,
-  429903,
-  429904,
-  429905,
-  429906,
-  429907,
-  429908,
-  428890,
-  430180,
-  430181,
-  430182,
-  428651,
-  428652,
-  428653,
-  429960,
-  430220,
-  429710,
-  429711,
-  428970,
-  429010,
-  429011,
-  428780,
-  429820,
-  427080,
-  427601,
-  427602,
-  427603,
-  427604,
-  427605,
-  428480,
-  428481,
-  428482,
-  426990,
-  426991,
-  426992,
-  426993,
-  426994,
-  426995,
-  426996,
-  426997,
-  426998,
-  426999,
-  427000,
-  427001,
-  427002,
-  427003,
-  427004,
-  427005,
-  427006,
-  427007,
-  425780,
-  425620,
-  426920,
-  426921,
-  426922,
-  426923,
-  426924,
-  426925,
-  426926,
-  426927,
-  426928,
-  426929,
-  426951,
-  426952,
-  425961,
-  425542,
-  424120,
-  421920,
-  422950,
-  422960,
-  422961,
-  422470,
-  422471,
-  422472,
-  422474,
-  423361,
-  423362,
-  420890,
-  421160,
-  421161,
-  421162,
-  421165,
-  421166,
-  420758,
-  421270,
-  421272,
-  421274,
-  421275,
-  420780,
-  420781,
-  420820,
-  420821,
-  420823,
-  420826,
-  420829,
-  420830,
-  421100,
-  419410,
-  419411,
-  419412,
-  419930,
-  419931,
-  419932,
-  419933,
-  419934,
-  419935,
-  419936,
-  419937,
-  419938,
-  419939,
-  419940,
-  419941,
-  419942,
-  419943,
-  419944,
-  420200,
-  419945,
-  419946,
-  419947,
-  419948,
-  419949,
-  419960,
-  419961,
-  419962,
-  419963,
-  419964,
-  419965,
-  420491,
-  420492,
-  420493,
-  420494,
-  420751,
-  420752,
-  419473,
-  419474,
-  420754,
-  419475,
-  419476,
-  419477,
-  419478,
-  419479,
-  419490,
-  419540,
-  418566,
-  418880,
-  418881,
-  418140,
-  417962,
-  417963,
-  417964,
-  417965,
-  417966,
-  417967,
-  417968,
-  417970,
-  417971,
-  417972,
-  417973,
-  417974,
-  417975,
-  417976,
-  419040,
-  418550,
-  417300,
-  417160,
-  417960,
-  417961,
-  414480,
-  415100,
-  415101,
-  415102,
-  415103,
-  415104,
-  415360,
-  415105,
-  415106,
-  415107,
-  415110,
-  415111,
-  415112,
-  415113,
-  414602,
-  414603,
-  415120,
-  415440,
-  412501,
-  412502,
-  413050,
-  413051,
-  413052,
-  412330,
-  412331,
-  412590,
-  413661,
-  413662,
-  413663,
-  410640,
-  411700,
-  411701,
-  411703,
-  411100,
-  410400,
-  410410,
-  410160,
-  410170,
-  408950,
-  409740,
-  408980,
-  408982,
-  408983,
-  408984,
-  410280,
-  409050,
-  408560,
-  409840,
-  409841,
-  409842,
-  409843,
-  410100,
-  409080,
-  408430,
-  406700,
-  406460,
-  408270,
-  407010,
-  407011,
-  408040,
-  406770,
-  405510,
-  405511,
-  405512,
-  405513,
-  405514,
-  405515,
-  406321,
-  406322,
-  406323,
-  406325,
-  406326,
-  406190,
-  406230,
-  405210,
-  406240,
-  405220,
-  405230,
-  403761,
-  403762,
-  403763,
-  403764,
-  403765,
-  403766,
-  403767,
-  403768,
-  403769,
-  403770,
-  404285,
-  404287,
-  404289,
-  404130,
-  404131,
-  404140,
-  404141,
-  404142,
-  403890,
-  404190,
-  404210,
-  404211,
-  404212,
-  404980,
-  404213,
-  404981,
-  404214,
-  404982,
-  404215,
-  404216,
-  404217,
-  404218,
-  404219,
-  404220,
-  404990,
-  403456,
-  403457,
-  403730,
-  403731,
-  403220,
-  403480,
-  403750,
-  403760,
-  402230,
-  402240,
-  402270,
-  402550,
-  402551,
-  403630,
-  402110,
-  403450,
-  403451,
-  403452,
-  403453,
-  403454,
-  403710,
-  403455,
-  401530,
-  401540,
-  401057,
-  401059,
-  401060,
-  401061,
-  401062,
-  401063,
-  401064,
-  401065,
-  401066,
-  401067,
-  401068,
-  401069,
-  401070,
-  401071,
-  401072,
-  401073,
-  401074,
-  401075,
-  401076,
-  401077,
-  401079,
-  401080,
-  401081,
-  401082,
-  401340,
-  401341,
-  401600,
-  401610,
-  400924,
-  400925,
-  400926,
-  400927,
-  400928,
-  400929,
-  400930,
-  400931,
-  400932,
-  400933,
-  400934,
-  400935,
-  400936,
-  400937,
-  400938,
-  400939,
-  400960,
-  400961,
-  400962,
-  400963,
-  400964,
-  400965,
-  400966,
-  400967,
-  400968,
-  400969,
-  400970,
-  400971,
-  400972,
-  400973,
-  400974,
-  400975,
-  400976,
-  400977,
-  400978,
-  400979,
-  400980,
-  400981,
-  400982,
-  400983,
-  400984,
-  400985,
-  400986,
-  400987,
-  400988,
-  400989,
-  400990,
-  400991,
-  400992,
-  400993,
-  400994,
-  400995,
-  400996,
-  400997,
-  400998,
-  400999,
-  401000,
-  401001,
-  401002,
-  401003,
-  401004,
-  401005,
-  401006,
-  401007,
-  401008,
-  401009,
-  401010,
-  401011,
-  401012,
-  401013,
-  401014,
-  401015,
-  401016,
-  401017,
-  401018,
-  401019,
-  401020,
-  401021,
-  401022,
-  401023,
-  401024,
-  401025,
-  401026,
-  401027,
-  401028,
-  401029,
-  401030,
-  401031,
-  401032,
-  401033,
-  401034,
-  401035,
-  401036,
-  401037,
-  401038,
-  401039,
-  401040,
-  401041,
-  401042,
-  401043,
-  401044,
-  401045,
-  401046,
-  401047,
-  401048,
-  401049,
-  401050,
-  401051,
-  401052,
-  401053,
-  401054,
-  401055,
-  401056,
-  400896,
-  400897,
-  400898,
-  400899,
-  400900,
-  400901,
-  400902,
-  400903,
-  400904,
-  400905,
-  400906,
-  400907,
-  400908,
-  400909,
-  400400,
-  400920,
-  400921,
-  400922,
-  400923,
-  399930,
-  399931,
-  400210,
-  400480,
-  400050,
-  400830,
-  400590,
-  400591,
-  400850,
-  399830,
-  399831,
-  399832,
-  399833,
-  399834,
-  399835,
-  399836,
-  399837,
-  400610,
-  400611,
-  400612,
-  400891,
-  400893,
-  400894,
-  400895,
-  398910,
-  396300,
-  396301,
-  396180,
-  397010,
-  396760,
-  395280,
-  395281,
-  395290,
-  394780,
-  394781,
-  394782,
-  394783,
-  395050,
-  395051,
-  394560,
-  394561,
-  394060,
-  394061,
-  393840,
-  393850,
-  394620,
-  394621,
-  394622,
-  394640,
-  393900,
-  395440,
-  395441,
-  394200,
-  394201,
-  394210,
-  394211,
-  394212,
-  395000,
-  394750,
-  392760,
-  392390,
-  393690,
-  393440,
-  393441,
-  393700,
-  393450,
-  393710,
-  393720,
-  393470,
-  390790,
-  390791,
-  390792,
-  391360,
-  391370,
-  389950,
-  389960,
-  389509,
-  389600,
-  387981,
-  387982,
-  387983,
-  387984,
-  389291,
-  388810,
-  385550,
-  386830,
-  386831,
-  387150,
-  384620,
-  384621,
-  385170,
-  386450,
-  385180,
-  385181,
-  386720,
-  386730,
-  386230,
-  385720,
-  386790,
-  386791,
-  386792,
-  386794,
-  387050,
-  386795,
-  386796,
-  386797,
-  383760,
-  383040,
-  382810,
-  382811,
-  384370,
-  382840,
-  383901,
-  383902,
-  383903,
-  383904,
-  383905,
-  383906,
-  383907,
-  383908,
-  383909,
-  383910,
-  383911,
-  383990,
-  381190,
-  381191,
-  381960,
-  381970,
-  381715,
-  381717,
-  381650,
-  380900,
-  380901,
-  379820,
-  378650,
-  379191,
-  379220,
-  378470,
-  378471,
-  378472,
-  378473,
-  378474,
-  378475,
-  378476,
-  378477,
-  378478,
-  379280,
-  377370,
-  377640,
-  377641,
-  377440,
-  377700,
-  377990,
-  376070,
-  376370,
-  376371,
-  376372,
-  376373,
-  376380,
-  376900,
-  376901,
-  376420,
-  376430,
-  376440,
-  376010,
-  376020,
-  376540,
-  376800,
-  376050,
-  375060,
-  374590,
-  374600,
-  374601,
-  374602,
-  375380,
-  375381,
-  375382,
-  375383,
-  375384,
-  375385,
-  375920,
-  374430,
-  375490,
-  373780,
-  373300,
-  372630,
-  373910,
-  372400,
-  373170,
-  373171,
-  373430,
-  371740,
-  371560,
-  371844,
-  371848,
-  371849,
-  371160,
-  371170,
-  370930,
-  370931,
-  370720,
-  370261,
-  370262,
-  370263,
-  369320,
-  369321,
-  368810,
-  369322,
-  368300,
-  369324,
-  368301,
-  369325,
-  368302,
-  369090,
-  369091,
-  369092,
-  367620,
-  367621,
-  367390,
-  367400,
-  367410,
-  367411,
-  367412,
-  367413,
-  367414,
-  367415,
-  367416,
-  367417,
-  367420,
-  367421,
-  367422,
-  367560,
-  367561,
-  367562,
-  368110,
-  367610,
-  366170,
-  366171,
-  366172,
-  366173,
-  366174,
-  365970,
-  365470,
-  366520,
-  366521,
-  366522,
-  366523,
-  366524,
-  366525,
-  366526,
-  366527,
-  366528,
-  366529,
-  365010,
-  366300,
-  365030,
-  365031,
-  365032,
-  365550,
-  366330,
-  363031,
-  363820,
-  362840,
-  362850,
-  363370,
-  363710,
-  362690,
-  363720,
-  364490,
-  363760,
-  363000,
-  363260,
-  362500,
-  361480,
-  361481,
-  361482,
-  361483,
-  361484,
-  361485,
-  361490,
-  361491,
-  361492,
-  361493,
-  361494,
-  361495,
-  362520,
-  362530,
-  362540,
-  362550,
-  362560,
-  362570,
-  362580,
-  362590,
-  361171,
-  361172,
-  361173,
-  361180,
-  360210,
-  360220,
-  359540,
-  360070,
-  359590,
-  359180,
-  358670,
-  358671,
-  358672,
-  358673,
-  358674,
-  358675,
-  358940,
-  358970,
-  358980,
-  358981,
-  358982,
-  358983,
-  358984,
-  358985,
-  358986,
-  358987,
-  358988,
-  358989,
-  358990,
-  358991,
-  358992,
-  359000,
-  359001,
-  359010,
-  359030,
-  359031,
-  359032,
-  359033,
-  359034,
-  359035,
-  359036,
-  358850,
-  357210,
-  357980,
-  356740,
-  356741,
-  356742,
-  356743,
-  356744,
-  357261,
-  356751,
-  357820,
-  357060,
-  358100,
-  358101,
-  358102,
-  356590,
-  356592,
-  356593,
-  355610,
-  355611,
-  355612,
-  355200,
-  355201,
-  355202,
-  355203,
-  355204,
-  355205,
-  355206,
-  355207,
-  355209,
-  355210,
-  355730,
-  355770,
-  356300,
-  356301,
-  355830,
-  355580,
-  353860,
-  354170,
-  354171,
-  354190,
-  354460,
-  354470,
-  353761,
-  353770,
-  353040,
-  353041,
-  352820,
-  352325,
-  352326,
-  353350,
-  352327,
-  352328,
-  352329,
-  352330,
-  352331,
-  352332,
-  353100,
-  352333,
-  353101,
-  352334,
-  352335,
-  352336,
-  352337,
-  352338,
-  352339,
-  352340,
-  352341,
-  352342,
-  352343,
-  352390,
-  352391,
-  352920,
-  352921,
-  352922,
-  352923,
-  352924,
-  352925,
-  352926,
-  352927,
-  352928,
-  352940,
-  352941,
-  352942,
-  352943,
-  352944,
-  353250,
-  353251,
-  353252,
-  352490,
-  350980,
-  351760,
-  351770,
-  352320,
-  352321,
-  352322,
-  352323,
-  352324,
-  351580,
-  351581,
-  351582,
-  351583,
-  351584,
-  351590,
-  351591,
-  351460,
-  351461,
-  350730,
-  350790,
-  350130,
-  350410,
-  350412,
-  350413,
-  350414,
-  350415,
-  350420,
-  349430,
-  349431,
-  347970,
-  348370,
-  347650,
-  347651,
-  347652,
-  347653,
-  347654,
-  347655,
-  347180,
-  347182,
-  347183,
-  346980,
-  346990,
-  346740,
-  346741,
-  346743,
-  346600,
-  347640,
-  347641,
-  347642,
-  347643,
-  346620,
-  347644,
-  347645,
-  345170,
-  345940,
-  346230,
-  346280,
-  345551,
-  345552,
-  345553,
-  345554,
-  345810,
-  345555,
-  345556,
-  345557,
-  345558,
-  345559,
-  345560,
-  345561,
-  345562,
-  345563,
-  345564,
-  345570,
-  345830,
-  344600,
-  344396,
-  344397,
-  344398,
-  344399,
-  344420,
-  344421,
-  344422,
-  344423,
-  344424,
-  344730,
-  344530,
-  344350,
-  344351,
-  344352,
-  343612,
-  343613,
-  343614,
-  343615,
-  343940,
-  344210,
-  344250,
-  344251,
-  344253,
-  344254,
-  344255,
-  344256,
-  344257,
-  344258,
-  344259,
-  343591,
-  343592,
-  343593,
-  343596,
-  343598,
-  343599,
-  343420,
-  343421,
-  343422,
-  343423,
-  343424,
-  343425,
-  343426,
-  343510,
-  341840,
-  341842,
-  341843,
-  341844,
-  341845,
-  341846,
-  341847,
-  341848,
-  341849,
-  341850,
-  342680,
-  339970,
-  338950,
-  339980,
-  339990,
-  339490,
-  340010,
-  338745,
-  338746,
-  338850,
-  339380,
-  339381,
-  339382,
-  339383,
-  339384,
-  339385,
-  339386,
-  339387,
-  339388,
-  339389,
-  339391,
-  339392,
-  339393,
-  339394,
-  339395,
-  339140,
-  339397,
-  339398,
-  339399,
-  339150,
-  339151,
-  339960,
-  339961,
-  338690,
-  338700,
-  338200,
-  338201,
-  338210,
-  338741,
-  338230,
-  338743,
-  338240,
-  337740,
-  338510,
-  338511,
-  338512,
-  338513,
-  338514,
-  338515,
-  338516,
-  338517,
-  337750,
-  338518,
-  338519,
-  338520,
-  338521,
-  338522,
-  338523,
-  338524,
-  338525,
-  337870,
-  337871,
-  337872,
-  337910,
-  336900,
-  336650,
-  336450,
-  337020,
-  336810,
-  336050,
-  336310,
-  337090,
-  336620,
-  335110,
-  334611,
-  335650,
-  335160,
-  335473,
-  335474,
-  335475,
-  335476,
-  335477,
-  335478,
-  335483,
-  335484,
-  335485,
-  335486,
-  335487,
-  335488,
-  334530,
-  334590,
-  334090,
-  333840,
-  333850,
-  334380,
-  334400,
-  334402,
-  333150,
-  333160,
-  333170,
-  333180,
-  333182,
-  333190,
-  333191,
-  333192,
-  333193,
-  333450,
-  334220,
-  334221,
-  333710,
-  333460,
-  334020,
-  333780,
-  334050,
-  334060,
-  333060,
-  333070,
-  333071,
-  332560,
-  333080,
-  333081,
-  333082,
-  333083,
-  333084,
-  333087,
-  333088,
-  332170,
-  332180,
-  331950,
-  332210,
-  332220,
-  332222,
-  332223,
-  332224,
-  332225,
-  332226,
-  332227,
-  332228,
-  332229,
-  332230,
-  332231,
-  332232,
-  333030,
-  333050,
-  333051,
-  333052,
-  331800,
-  331040,
-  331310,
-  331061,
-  331062,
-  331063,
-  331064,
-  331065,
-  331066,
-  331067,
-  331069,
-  331103,
-  331104,
-  331105,
-  331106,
-  331107,
-  331108,
-  331113,
-  331114,
-  331115,
-  331116,
-  331117,
-  331118,
-  331130,
-  331420,
-  330960,
-  330961,
-  330970,
-  330980,
-  330981,
-  330982,
-  330983,
-  330984,
-  330985,
-  330986,
-  330987,
-  330988,
-  331250,
-  329510,
-  330030,
-  330290,
-  329850,
-  329600,
-  330380,
-  329940,
-  330750,
-  328750,
-  328260,
-  328030,
-  328031,
-  328802,
-  328803,
-  328804,
-  328040,
-  328041,
-  328811,
-  328812,
-  328813,
-  328814,
-  328815,
-  328816,
-  328817,
-  328818,
-  329080,
-  328860,
-  328861,
-  328401,
-  328402,
-  328150,
-  328170,
-  327970,
-  327971,
-  327972,
-  327973,
-  327480,
-  327230,
-  327231,
-  327232,
-  326750,
-  327530,
-  327040,
-  327050,
-  326400,
-  326170,
-  326451,
-  326452,
-  326240,
-  326500,
-  326050,
-  326600,
-  326610,
-  325144,
-  325670,
-  325170,
-  325693,
-  325440,
-  325460,
-  325461,
-  325717,
-  325720,
-  325721,
-  325722,
-  325270,
-  325130,
-  325131,
-  325132,
-  325133,
-  325134,
-  325135,
-  325136,
-  325137,
-  325138,
-  325139,
-  325140,
-  325142,
-  325143,
-  323932,
-  323940,
-  324480,
-  324230,
-  324780,
-  324333,
-  324341,
-  324601,
-  324602,
-  323110,
-  323390,
-  322200,
-  323750,
-  322490,
-  323010,
-  323570,
-  322050,
-  321650,
-  321690,
-  321460,
-  321470,
-  321472,
-  321473,
-  321474,
-  321730,
-  321475,
-  321476,
-  321478,
-  321740,
-  320530,
-  320551,
-  320552,
-  320553,
-  320554,
-  320555,
-  320600,
-  320601,
-  320602,
-  320364,
-  320373,
-  320374,
-  320420,
-  320170,
-  320940,
-  320180,
-  320190,
-  320200,
-  320210,
-  320220,
-  320010,
-  319790,
-  319800,
-  319290,
-  318796,
-  319820,
-  318797,
-  319821,
-  318798,
-  319310,
-  318799,
-  318800,
-  318801,
-  318802,
-  318803,
-  318804,
-  318805,
-  318810,
-  319070,
-  319920,
-  318940,
-  318960,
-  319220,
-  318720,
-  318490,
-  317740,
-  318770,
-  318050,
-  317592,
-  318140,
-  317690,
-  317450,
-  317451,
-  317454,
-  317455,
-  317460,
-  317461,
-  317462,
-  317540,
-  317550,
-  316550,
-  317070,
-  316590,
-  315907,
-  315908,
-  315909,
-  315916,
-  315917,
-  315918,
-  315919,
-  315420,
-  315720,
-  315990,
-  316000,
-  316280,
-  315010,
-  316290,
-  315380,
-  315381,
-  315382,
-  315383,
-  315384,
-  315385,
-  315386,
-  315387,
-  315388,
-  315389,
-  314130,
-  313670,
-  313710,
-  313711,
-  313712,
-  313713,
-  313721,
-  314550,
-  314551,
-  314552,
-  314553,
-  314080,
-  314090,
-  314091,
-  314092,
-  314093,
-  314100,
-  314101,
-  313850,
-  314110,
-  312090,
-  311990,
-  312000,
-  311320,
-  311360,
-  311362,
-  310090,
-  311370,
-  310091,
-  311160,
-  311162,
-  310400,
-  310410,
-  310420,
-  310680,
-  310440,
-  310750,
-  310751,
-  310752,
-  311550,
-  311551,
-  307820,
-  307821,
-  307822,
-  309870,
-  307823,
-  309871,
-  307824,
-  309872,
-  307825,
-  308340,
-  308341,
-  307911,
-  309970,
-  309971,
-  309972,
-  309973,
-  307456,
-  307457,
-  307458,
-  307459,
-  306180,
-  307460,
-  307461,
-  307462,
-  307463,
-  307464,
-  307465,
-  306720,
-  306721,
-  306722,
-  306723,
-  306470,
-  307500,
-  307540,
-  306300,
-  306320,
-  306890,
-  306650,
-  307450,
-  307451,
-  307452,
-  307453,
-  307454,
-  305221,
-  305530,
-  305531,
-  305532,
-  305300,
-  305310,
-  305311,
-  305320,
-  305321,
-  305322,
-  305323,
-  305324,
-  305325,
-  305326,
-  305327,
-  305328,
-  305329,
-  305330,
-  305331,
-  305332,
-  305333,
-  305334,
-  305335,
-  305336,
-  305337,
-  305338,
-  305339,
-  305340,
-  305341,
-  305342,
-  306110,
-  304360,
-  304130,
-  304131,
-  304132,
-  304133,
-  303890,
-  303640,
-  303641,
-  303642,
-  303643,
-  303644,
-  303645,
-  303646,
-  303647,
-  303920,
-  303960,
-  302450,
-  302451,
-  302452,
-  302453,
-  303280,
-  303281,
-  303282,
-  301110,
-  301111,
-  301112,
-  301113,
-  301114,
-  301116,
-  301710,
-  300980,
-  300981,
-  300982,
-  300990,
-  300991,
-  300992,
-  302050,
-  302051,
-  300640,
-  300641,
-  300642,
-  299370,
-  300140,
-  300662,
-  298981,
-  298982,
-  298983,
-  298984,
-  298985,
-  298987,
-  298991,
-  299000,
-  299001,
-  299002,
-  299003,
-  299004,
-  298782,
-  298786,
-  298788,
-  297770,
-  297780,
-  297548,
-  297549,
-  298620,
-  297600,
-  298880,
-  297601,
-  297610,
-  298640,
-  297630,
-  298910,
-  298911,
-  298913,
-  297900,
-  297910,
-  297911,
-  298690,
-  297950,
-  297517,
-  297518,
-  297521,
-  297522,
-  297523,
-  297524,
-  297525,
-  297526,
-  297527,
-  297529,
-  297530,
-  297531,
-  297532,
-  297533,
-  297534,
-  297535,
-  297536,
-  297537,
-  297538,
-  297539,
-  297540,
-  297541,
-  297542,
-  297543,
-  297544,
-  297545,
-  297546,
-  297547,
-  296270,
-  296271,
-  296093,
-  296360,
-  296441,
-  295430,
-  295431,
-  295432,
-  295433,
-  295434,
-  295435,
-  295436,
-  295438,
-  295439,
-  295440,
-  294850,
-  294300,
-  294301,
-  294302,
-  294303,
-  294304,
-  294310,
-  294311,
-  294312,
-  294330,
-  293120,
-  293130,
-  293131,
-  293132,
-  293133,
-  293134,
-  292950,
-  292951,
-  292720,
-  292721,
-  292722,
-  292471,
-  292472,
-  292473,
-  292474,
-  293080,
-  293090,
-  293091,
-  293092,
-  293093,
-  293094,
-  293095,
-  293096,
-  293097,
-  293098,
-  293099,
-  293100,
-  293101,
-  293110,
-  290404,
-  291500,
-  291501,
-  291502,
-  291503,
-  291504,
-  291505,
-  291506,
-  291507,
-  291508,
-  292020,
-  291509,
-  291520,
-  291521,
-  291522,
-  291523,
-  291524,
-  291525,
-  291540,
-  291541,
-  291542,
-  291543,
-  291544,
-  291545,
-  291820,
-  291821,
-  291822,
-  291830,
-  291831,
-  291832,
-  289026,
-  289027,
-  289028,
-  289029,
-  289030,
-  289031,
-  288320,
-  288321,
-  289110,
-  289111,
-  289112,
-  289113,
-  289114,
-  289641,
-  289170,
-  289010,
-  287531,
-  287280,
-  287540,
-  286630,
-  286631,
-  286632,
-  286633,
-  286640,
-  287411,
-  287670,
-  287671,
-  287672,
-  287673,
-  286910,
-  286911,
-  286912,
-  286913,
-  286914,
-  286915,
-  286670,
-  284672,
-  284442,
-  284443,
-  285470,
-  284510,
-  284511,
-  284512,
-  283810,
-  283811,
-  283812,
-  283813,
-  285610,
-  285611,
-  285612,
-  285613,
-  285614,
-  285615,
-  285616,
-  285617,
-  285618,
-  285619,
-  285620,
-  285621,
-  285622,
-  285623,
-  285625,
-  285626,
-  285630,
-  285660,
-  285661,
-  285662,
-  285663,
-  283900,
-  284670,
-  284671,
-  281607,
-  282130,
-  282131,
-  282132,
-  281630,
-  281960,
-  281970,
-  281720,
-  281721,
-  281722,
-  281723,
-  281724,
-  281980,
-  281725,
-  281981,
-  282500,
-  281344,
-  281600,
-  281345,
-  281601,
-  281346,
-  281602,
-  281347,
-  281603,
-  281604,
-  279820,
-  279830,
-  280760,
-  280761,
-  280762,
-  280763,
-  280030,
-  280031,
-  280032,
-  281341,
-  281342,
-  278610,
-  278700,
-  278701,
-  278730,
-  278731,
-  278732,
-  278733,
-  278734,
-  278735,
-  278480,
-  278736,
-  278481,
-  278737,
-  277970,
-  277971,
-  277972,
-  277973,
-  277974,
-  277975,
-  277976,
-  277977,
-  277670,
-  277671,
-  277672,
-  277673,
-  277675,
-  277676,
-  277677,
-  277678,
-  277679,
-  277580,
-  277581,
-  275550,
-  275551,
-  275552,
-  275553,
-  275554,
-  276210,
-  274471,
-  274470,
-  273520,
-  273521,
-  273522,
-  273523,
-  273524,
-  273525,
-  273526,
-  273527,
-  274100,
-  274150,
-  272640,
-  272910,
-  272260,
-  272261,
-  271530,
-  271540,
-  271801,
-  272830,
-  271810,
-  271387,
-  271388,
-  271389,
-  271380,
-  271000,
-  271001,
-  271002,
-  271003,
-  271004,
-  271005,
-  271333,
-  271334,
-  271080,
-  271090,
-  271100,
-  267520,
-  267521,
-  268290,
-  268291,
-  268292,
-  268293,
-  268294,
-  268295,
-  268296,
-  268297,
-  268310,
-  268311,
-  268312,
-  268313,
-  268314,
-  268315,
-  268070,
-  268071,
-  267820,
-  268590,
-  267570,
-  268600,
-  267580,
-  268610,
-  267590,
-  267591,
-  268110,
-  268111,
-  268112,
-  268114,
-  268115,
-  267860,
-  267861,
-  267862,
-  267863,
-  267864,
-  267620,
-  267651,
-  267654,
-  267710,
-  267711,
-  267712,
-  267713,
-  267714,
-  268280,
-  268281,
-  266800,
-  265280,
-  265290,
-  265291,
-  265292,
-  265293,
-  265320,
-  266862,
-  266864,
-  266868,
-  266870,
-  266873,
-  266874,
-  266880,
-  265200,
-  267510,
-  267511,
-  267000,
-  267512,
-  267001,
-  264800,
-  264801,
-  264810,
-  264811,
-  264820,
-  265090,
-  264840,
-  264841,
-  265149,
-  261130,
-  260881,
-  261420,
-  261421,
-  261300,
-  261301,
-  261302,
-  262350,
-  261070,
-  262351,
-  262352,
-  261330,
-  261331,
-  261341,
-  260100,
-  260101,
-  260400,
-  260401,
-  260402,
-  260403,
-  260460,
-  260461,
-  260294,
-  260300,
-  260302,
-  260303,
-  260306,
-  260307,
-  260313,
-  260314,
-  260321,
-  260322,
-  260323,
-  260324,
-  260325,
-  260326,
-  259120,
-  259121,
-  259122,
-  258940,
-  258941,
-  258942,
-  259220,
-  259230,
-  259240,
-  259260,
-  259270,
-  259271,
-  258570,
-  258450,
-  257910,
-  258260,
-  258261,
-  258262,
-  258263,
-  258264,
-  256512,
-  257280,
-  256513,
-  257281,
-  256514,
-  257210,
-  255780,
-  256100,
-  255860,
-  255160,
-  255161,
-  255162,
-  255164,
-  255165,
-  255166,
-  255167,
-  255168,
-  255169,
-  256480,
-  256490,
-  256501,
-  256502,
-  256503,
-  256505,
-  256506,
-  256507,
-  256508,
-  256509,
-  256510,
-  256511,
-  254270,
-  254620,
-  252590,
-  254670,
-  254671,
-  250891,
-  250892,
-  250893,
-  250930,
-  249911,
-  249912,
-  249913,
-  250220,
-  250230,
-  251080,
-  251081,
-  249120,
-  249121,
-  249400,
-  249780,
-  249800,
-  249820,
-  247560,
-  247852,
-  247640,
-  247390,
-  247180,
-  247190,
-  247450,
-  244061,
-  244064,
-  243831,
-  244350,
-  244370,
-  244650,
-  245191,
-  245192,
-  245193,
-  243440,
-  243441,
-  243442,
-  243959,
-  241950,
-  241951,
-  241960,
-  241970,
-  242270,
-  242280,
-  242290,
-  242090,
-  242630,
-  240130,
-  239880,
-  240140,
-  240910,
-  239890,
-  240150,
-  239900,
-  240930,
-  240940,
-  239920,
-  240950,
-  239940,
-  239950,
-  241230,
-  241490,
-  240990,
-  241040,
-  240020,
-  241050,
-  240800,
-  241060,
-  240040,
-  240060,
-  241090,
-  240070,
-  240840,
-  240080,
-  240850,
-  240860,
-  241120,
-  240100,
-  240870,
-  241130,
-  240110,
-  240880,
-  239860,
-  241140,
-  240120,
-  240890,
-  241150,
-  239392,
-  239393,
-  238650,
-  238670,
-  239240,
-  238250,
-  238251,
-  238270,
-  238271,
-  238272,
-  238273,
-  239590,
-  236570,
-  236640,
-  236641,
-  236642,
-  236645,
-  236650,
-  237680,
-  237700,
-  236951,
-  237720,
-  237210,
-  237230,
-  236990,
-  237250,
-  237270,
-  234773,
-  234774,
-  234778,
-  234779,
-  234780,
-  234783,
-  234786,
-  234788,
-  234789,
-  234790,
-  235560,
-  234793,
-  235610,
-  234860,
-  235884,
-  234880,
-  234730,
-  234731,
-  234250,
-  232640,
-  233920,
-  232644,
-  234180,
-  232646,
-  233940,
-  233431,
-  233432,
-  232673,
-  234210,
-  233960,
-  234230,
-  232192,
-  232490,
-  232491,
-  232510,
-  231508,
-  231512,
-  231513,
-  231811,
-  231571,
-  232191,
-  231340,
-  230830,
-  230880,
-  230882,
-  230883,
-  230884,
-  230885,
-  230886,
-  230887,
-  230888,
-  230889,
-  230890,
-  230892,
-  229757,
-  229758,
-  229790,
-  229791,
-  229792,
-  227133,
-  228422,
-  228423,
-  227146,
-  227147,
-  227148,
-  227660,
-  227661,
-  228460,
-  226992,
-  226996,
-  226997,
-  226999,
-  226330,
-  226331,
-  226332,
-  226333,
-  226334,
-  226335,
-  226336,
-  226337,
-  226338,
-  226191,
-  226453,
-  226458,
-  225700,
-  226260,
-  225370,
-  225423,
-  225428,
-  224242,
-  224243,
-  224244,
-  224245,
-  223260,
-  223311,
-  223312,
-  223313,
-  223314,
-  223315,
-  223316,
-  223317,
-  223318,
-  223319,
-  223320,
-  223321,
-  223590,
-  223691,
-  222960,
-  222961,
-  222962,
-  223732,
-  222970,
-  222971,
-  222972,
-  222973,
-  222220,
-  222240,
-  222530,
-  222531,
-  222532,
-  222360,
-  222381,
-  222382,
-  222383,
-  221445,
-  221710,
-  222020,
-  220180,
-  219448,
-  219970,
-  219480,
-  219500,
-  220819,
-  220140,
-  219630,
-  220400,
-  220159,
-  218180,
-  217940,
-  217942,
-  218455,
-  218461,
-  218462,
-  218463,
-  217960,
-  218781,
-  218782,
-  218530,
-  218571,
-  218572,
-  218573,
-  218574,
-  218575,
-  218064,
-  218576,
-  218577,
-  218578,
-  218579,
-  219093,
-  218582,
-  219094,
-  219095,
-  219096,
-  218841,
-  218842,
-  218843,
-  219099,
-  218844,
-  219102,
-  217390,
-  217221,
-  217222,
-  217760,
-  217810,
-  217811,
-  215811,
-  216330,
-  215821,
-  215822,
-  215823,
-  215824,
-  216170,
-  216171,
-  215973,
-  215974,
-  216010,
-  215302,
-  215304,
-  215305,
-  215306,
-  215307,
-  215308,
-  215312,
-  215313,
-  215315,
-  215316,
-  215318,
-  215319,
-  215320,
-  215321,
-  215372,
-  214980,
-  214982,
-  214983,
-  214984,
-  214985,
-  215250,
-  215252,
-  215254,
-  215261,
-  215263,
-  215532,
-  215537,
-  215291,
-  214290,
-  214291,
-  214120,
-  214644,
-  214647,
-  214648,
-  214652,
-  214653,
-  213661,
-  213662,
-  213663,
-  213664,
-  213665,
-  213666,
-  213667,
-  213668,
-  213669,
-  213931,
-  213932,
-  213933,
-  214269,
-  212530,
-  212531,
-  212532,
-  212540,
-  212541,
-  213310,
-  212601,
-  212602,
-  212603,
-  212604,
-  212890,
-  212891,
-  213151,
-  213152,
-  213153,
-  213154,
-  213155,
-  212671,
-  212673,
-  212676,
-  212677,
-  212679,
-  211990,
-  211991,
-  211992,
-  211994,
-  211775,
-  211776,
-  211777,
-  211320,
-  211132,
-  212433,
-  212434,
-  212435,
-  212436,
-  212437,
-  212438,
-  212439,
-  212446,
-  212447,
-  212448,
-  212449,
-  212450,
-  211691,
-  211692,
-  211693,
-  211950,
-  211951,
-  211952,
-  211953,
-  211954,
-  210999,
-  211000,
-  211001,
-  210510,
-  210089,
-  210090,
-  210091,
-  210092,
-  210093,
-  210094,
-  210095,
-  210096,
-  210097,
-  210098,
-  211131,
-  210939,
-  210942,
-  209720,
-  209721,
-  210010,
-  210030,
-  210031,
-  210032,
-  210033,
-  210034,
-  210035,
-  210036,
-  210037,
-  210038,
-  210039,
-  210040,
-  210041,
-  210042,
-  210043,
-  210044,
-  210047,
-  210049,
-  210050,
-  210052,
-  210053,
-  210054,
-  210055,
-  210056,
-  209545,
-  209546,
-  210058,
-  209547,
-  210059,
-  209548,
-  210060,
-  210061,
-  210062,
-  210063,
-  210064,
-  210065,
-  210066,
-  210067,
-  210068,
-  210069,
-  210072,
-  210073,
-  210076,
-  210077,
-  210083,
-  210084,
-  210085,
-  210086,
-  210087,
-  210088,
-  208911,
-  209181,
-  209182,
-  209470,
-  208982,
-  208983,
-  208984,
-  208985,
-  208740,
-  209300,
-  209301,
-  209302,
-  209303,
-  209304,
-  209305,
-  209306,
-  209307,
-  209308,
-  209309,
-  209310,
-  208881,
-  208482,
-  208483,
-  208484,
-  208485,
-  208487,
-  208488,
-  208489,
-  208492,
-  208519,
-  208540,
-  208542,
-  208545,
-  208358,
-  208359,
-  208360,
-  208368,
-  208372,
-  208291,
-  208100,
-  208101,
-  208102,
-  208103,
-  206600,
-  207385,
-  206880,
-  206881,
-  206882,
-  207655,
-  207660,
-  207405,
-  206713,
-  206714,
-  206715,
-  206717,
-  207012,
-  206520,
-  206524,
-  206415,
-  206416,
-  204800,
-  204802,
-  204803,
-  204820,
-  205093,
-  204851,
-  205631,
-  205130,
-  205150,
-  205160,
-  205170,
-  205215,
-  205216,
-  205217,
-  205218,
-  204734,
-  204735,
-  204736,
-  204737,
-  204738,
-  205252,
-  205272,
-  205541,
-  204288,
-  204289,
-  204304,
-  204305,
-  204306,
-  204307,
-  204309,
-  204313,
-  204314,
-  204315,
-  204317,
-  204319,
-  204085,
-  204086,
-  204382,
-  203871,
-  203872,
-  203873,
-  203874,
-  203875,
-  203876,
-  203877,
-  203878,
-  203879,
-  203880,
-  203881,
-  203882,
-  204470,
-  204732,
-  204482,
-  204483,
-  204521,
-  204522,
-  204523,
-  204524,
-  204525,
-  204280,
-  204281,
-  204282,
-  204283,
-  204284,
-  204285,
-  204286,
-  202521,
-  202524,
-  203050,
-  203342,
-  203344,
-  203345,
-  203710,
-  202950,
-  202960,
-  202450,
-  202452,
-  202454,
-  202988,
-  202240,
-  202010,
-  202020,
-  202030,
-  202040,
-  201801,
-  201803,
-  201807,
-  201808,
-  202087,
-  202092,
-  202093,
-  202094,
-  202095,
-  201878,
-  201879,
-  201880,
-  202190,
-  202192,
-  202194,
-  202195,
-  202196,
-  202197,
-  202198,
-  202199,
-  201951,
-  201952,
-  201953,
-  201954,
-  201955,
-  201956,
-  201957,
-  201958,
-  201959,
-  201960,
-  201961,
-  201962,
-  201963,
-  201964,
-  202220,
-  201965,
-  201967,
-  201968,
-  201969,
-  201970,
-  201971,
-  201972,
-  201973,
-  202230,
-  200460,
-  200730,
-  200770,
-  200780,
-  200790,
-  200800,
-  200810,
-  200820,
-  200830,
-  200320,
-  200321,
-  200323,
-  200840,
-  200850,
-  200181,
-  200182,
-  200183,
-  200187,
-  106020,
-  106021,
-  115308,
-  115107,
-  115117,
-  105412,
-  105414,
-  105415,
-  98821,
-  98822,
-  98420,
-  98212,
-  98213,
-  98214,
-  102822,
-  99502,
-  99508,
-  99509,
-  102621,
-  98203,
-  98204,
-  98205,
-  91342,
-  91345,
-  91605,
-  98005,
-  91606,
-  91607,
-  91608,
-  91613,
-  91614,
-  91615,
-  73034,
-  73038,
-  73056,
-  73088,
-  73089,
-  73094,
-  73099,
-  73108,
-  73109,
-  73110,
-  73111,
-  73112,
-  73113,
-  73114,
-  73121,
-  73180,
-  73181,
-  73182,
-  73184,
-  73186,
-  73188,
-  72705,
-  72713,
-  67379,
-  73016,
-  73017,
-  67400,
-  67401,
-  67402,
-  70608,
-  70609,
-  70610,
-  70611,
-  70631,
-  72701,
-  65811,
-  66003,
-  63391,
-  58529,
-  57980,
-  56490,
-  56491,
-  56492,
-  48804,
-  55204,
-  48805,
-  55206,
-  55207,
-  55208,
-  55215,
-  55216,
-  55217,
-  55218,
-  48830,
-  48128,
-  48131,
-  48132,
-  48166,
-  48167,
-  48185,
-  48186,
-  48187,
-  47933,
-  47934,
-  47423,
-  47935,
-  47424,
-  48195,
-  48197,
-  48218,
-  48219,
-  48224,
-  48226,
-  48227,
-  48228,
-  48229,
-  47721,
-  48233,
-  48234,
-  48259,
-  48124,
-  48127,
-  43011,
-  43012,
-  43013,
-  43014,
-  42919,
-  42925,
-  42926,
-  42929,
-  46523,
-  45772,
-  45777,
-  45778,
-  43005,
-  43006,
-  41802,
-  41803,
-  41804,
-  41805,
-  41807,
-  41808,
-  41809,
-  41813,
-  41046,
-  41814,
-  41815,
-  41816,
-  42840,
-  41817,
-  42841,
-  42842,
-  42843,
-  42844,
-  42845,
-  42846,
-  42847,
-  42848,
-  42849,
-  42860,
-  42895,
-  42129,
-  42901,
-  42916,
-  42917,
-  42180,
-  42715,
-  42717,
-  39184,
-  39185,
-  41017,
-  41018,
-  39251,
-  41045,
-  38743,
-  40130,
-  40131,
-  40132,
-  40133,
-  40134,
-  40136,
-  39122,
-  39123,
-  39124,
-  39125,
-  39127,
-  39128,
-  39129,
-  36632,
-  36633,
-  35418,
-  35426,
-  35427,
-  34611,
-  34612,
-  34613,
-  34614,
-  33288,
-  33326,
-  33360,
-  33361,
-  33362,
-  33933,
-  34189,
-  33428,
-  33446,
-  33447,
-  33448,
-  33960,
-  33456,
-  33457,
-  33242,
-  29710,
-  29600,
-  29610,
-  29630,
-  31713,
-  24936,
-  24939,
-  28013,
-  28014,
-  28015,
-  28017,
-  25985,
-  26005,
-  26006,
-  26007,
-  28060,
-  28061,
-  24994,
-  24995,
-  26803,
-  24634,
-  24635,
-  24637,
-  24673,
-  24674,
-  24675,
-  24676,
-  24677,
-  24678,
-  24448,
-  24451,
-  24483,
-  24486,
-  24487,
-  24497,
-  24064,
-  24063,
-  22333,
-  22641,
-  21960,
-  21963,
-  21964,
-  21995,
-  21996,
-  21999,
-  18507,
-  18520,
-  18521,
-  18523,
-  18534,
-  18403,
-  18407,
-  18408,
-  17096,
-  10605,
-  10609,
-  9905,
-  9932,
-  8955,
-  4930,
-  4931,
-  6122,
-  2826,
-  2767,
-  2768,
-  1255,
-  576,
-  581,
-  582,
-  583,
-  584,
-  585,
-  586,
-  456,
-  458020,
-  376090,
-  325480,
-  325560,
-  42800,
-  42820,
-  25940,
-  427008,
-  688970,
-  688980,
-  877450,
-  903870,
-  688860,
-  679890,
-  513040,
-  916361,
-  916360,
-  598303,
-  598301,
-  598300,
-  813100,
-  774301,
-  754590,
-  912780,
-  907910,
-  898600,
-  909140,
-  854230,
-  913920,
-  891030,
-  650610,
-  905470,
-  821600,
-  885071,
-  891060,
-  857040,
-  863790,
-  911970,
-  911860,
-  629190,
-  655330,
-  893830,
-  631292,
-  850420,
-  656390,
-  837450,
-  634016,
-  492580,
-  477942,
-  477941,
-  492581,
-  515990,
-  234690,
-  905990,
-  897180,
-  894640,
-  894650,
-  906040,
-  903090,
-  905840,
-  894660,
-  820160,
-  841630,
-  650170,
-  898640,
-  894860,
-  775031,
-  828611,
-  896101,
-  209375,
-  898230,
-  628260,
-  828620,
-  828621,
-  828622,
-  828624,
-  828615,
-  828616,
-  828626,
-  828614,
-  828625,
-  828613,
-  828623,
-  828612,
-  828560,
-  864080,
-  897310,
-  890650,
-  890651,
-  890652,
-  890653,
-  903960,
-  899650,
-  899640,
-  649031,
-  649200,
-  896910,
-  827600,
-  862560,
-  318591,
-  898300,
-  821601,
-  896290,
-  895790,
-  495790,
-  896100,
-  891033,
-  890850,
-  894230,
-  843600,
-  711950,
-  805490,
-  888440,
-  890980,
-  852800,
-  894300,
-  352690,
-  890540,
-  798897,
-  872520,
-  854490,
-  891140,
-  383610,
-  414710,
-  436430,
-  408940,
-  888590,
-  866120,
-  889200,
-  847850,
-  731540,
-  651131,
-  651132,
-  651140,
-  853390,
-  650522,
-  686540,
-  664790,
-  660410,
-  654177,
-  654178,
-  654182,
-  654184,
-  650244,
-  649030,
-  638540,
-  638422,
-  630661,
-  629950,
-  837060,
-  682870,
-  683860,
-  666237,
-  666235,
-  666236,
-  666234,
-  662356,
-  662355,
-  662354,
-  648285,
-  648284,
-  648283,
-  648282,
-  648281,
-  648280,
-  643855,
-  643854,
-  643852,
-  643853,
-  643851,
-  643850,
-  642201,
-  641385,
-  641383,
-  641381,
-  638541,
-  638030,
-  623780,
-  623291,
-  623290,
-  682600,
-  419660,
-  687700,
-  881840,
-  881841,
-  821930,
-  804140,
-  804020,
-  804040,
-  800790,
-  800791,
-  796543,
-  791440,
-  791450,
-  791710,
-  791730,
-  791480,
-  790720,
-  760480,
-  742770,
-  739900,
-  725000,
-  717590,
-  695670,
-  695671,
-  687701,
-  687702,
-  671010,
-  671020,
-  671030,
-  670990,
-  671000,
-  654175,
-  643800,
-  643380,
-  638580,
-  632611,
-  626620,
-  626490,
-  625850,
-  625851,
-  625852,
-  625853,
-  625870,
-  625871,
-  625872,
-  625873,
-  625874,
-  625876,
-  625877,
-  625878,
-  625879,
-  625880,
-  625881,
-  623760,
-  623790,
-  617900,
-  614621,
-  614540,
-  613520,
-  605430,
-  601260,
-  594070,
-  587350,
-  585470,
-  585471,
-  582470,
-  570120,
-  567740,
-  555360,
-  544070,
-  542800,
-  541430,
-  538530,
-  538531,
-  538532,
-  538533,
-  538534,
-  538536,
-  538537,
-  538538,
-  538539,
-  536240,
-  536241,
-  528780,
-  526010,
-  524950,
-  507280,
-  500700,
-  498560,
-  498060,
-  485140,
-  485141,
-  485142,
-  485143,
-  485144,
-  485145,
-  485146,
-  478036,
-  478037,
-  478038,
-  478039,
-  478040,
-  478041,
-  478042,
-  478043,
-  478044,
-  478045,
-  478046,
-  478049,
-  478050,
-  478051,
-  478052,
-  478053,
-  478054,
-  478055,
-  478056,
-  478057,
-  478058,
-  478034,
-  478035,
-  477020,
-  466880,
-  457740,
-  448210,
-  448211,
-  448213,
-  448214,
-  444310,
-  444311,
-  444312,
-  429990,
-  429670,
-  428300,
-  402140,
-  402141,
-  402142,
-  402143,
-  396630,
-  396631,
-  396632,
-  389590,
-  371960,
-  366120,
-  366121,
-  366122,
-  363730,
-  363731,
-  363732,
-  362640,
-  362641,
-  355590,
-  351670,
-  351671,
-  351672,
-  351673,
-  351674,
-  351675,
-  351676,
-  349330,
-  349331,
-  346260,
-  344200,
-  341140,
-  341141,
-  336320,
-  333771,
-  333772,
-  331300,
-  329180,
-  328520,
-  327200,
-  326250,
-  326290,
-  324920,
-  324911,
-  323440,
-  323441,
-  323442,
-  323443,
-  322860,
-  321250,
-  321510,
-  318072,
-  318073,
-  318074,
-  318075,
-  318077,
-  313610,
-  313611,
-  311440,
-  306280,
-  305410,
-  305420,
-  305430,
-  305431,
-  305130,
-  305131,
-  303930,
-  301770,
-  298971,
-  285550,
-  284520,
-  284521,
-  284522,
-  284641,
-  279840,
-  278720,
-  276051,
-  273370,
-  272690,
-  272080,
-  272090,
-  270870,
-  270871,
-  270900,
-  250150,
-  250160,
-  250170,
-  218491,
-  207241,
-  96831,
-  844680,
-  845130,
-  862930,
-  862915,
-  862914,
-  862911,
-  862912,
-  638810,
-  635750,
-  635751,
-  635761,
-  635762,
-  661890,
-  621560,
-  880740,
-  800261,
-  877120,
-  877110,
-  877100,
-  876440,
-  880820,
-  872500,
-  856930,
-  856950,
-  856960,
-  858230,
-  876400,
-  876401,
-  865340,
-  874480,
-  866880,
-  801930,
-  801460,
-  801461,
-  801462,
-  857970,
-  696211,
-  870810,
-  867710,
-  820980,
-  538500,
-  865890,
-  865014,
-  865012,
-  865013,
-  865010,
-  865011,
-  870461,
-  870462,
-  865120,
-  870460,
-  851275,
-  851278,
-  851312,
-  851313,
-  872420,
-  866320,
-  870470,
-  873540,
-  873541,
-  872370,
-  867780,
-  868530,
-  839110,
-  594080,
-  868650,
-  866840,
-  869530,
-  868140,
-  864750,
-  630910,
-  630911,
-  630916,
-  630917,
-  630918,
-  630912,
-  630913,
-  630914,
-  630915,
-  630919,
-  869240,
-  449604,
-  449600,
-  449605,
-  449602,
-  449601,
-  520030,
-  676050,
-  727400,
-  866560,
-  866530,
-  791872,
-  858450,
-  460440,
-  821470,
-  821450,
-  836380,
-  792620,
-  627581,
-  853871,
-  853872,
-  853886,
-  853874,
-  853870,
-  853370,
-  853887,
-  853885,
-  853883,
-  853882,
-  853881,
-  853876,
-  853877,
-  853873,
-  853875,
-  853884,
-  863320,
-  863740,
-  854180,
-  684290,
-  684241,
-  859470,
-  859490,
-  859540,
-  817670,
-  809690,
-  857720,
-  850540,
-  850560,
-  855380,
-  860840,
-  800090,
-  832410,
-  832412,
-  832411,
-  851279,
-  775210,
-  850570,
-  850670,
-  850680,
-  850620,
-  850640,
-  850650,
-  850660,
-  850600,
-  850610,
-  593932,
-  551300,
-  859600,
-  469740,
-  788950,
-  731970,
-  850700,
-  368480,
-  631291,
-  851272,
-  851273,
-  851274,
-  851271,
-  858130,
-  859290,
-  856530,
-  852850,
-  838600,
-  378462,
-  818180,
-  449370,
-  814720,
-  854370,
-  817750,
-  828650,
-  463610,
-  856000,
-  856001,
-  857260,
-  853730,
-  596160,
-  823110,
-  695700,
-  790000,
-  224240,
-  224241,
-  840670,
-  640221,
-  640222,
-  640220,
-  647634,
-  854130,
-  850470,
-  850530,
-  850430,
-  839860,
-  850400,
-  850410,
-  842951,
-  842952,
-  842950,
-  812030,
-  830740,
-  850390,
-  850360,
-  850380,
-  778790,
-  847540,
-  810280,
-  846840,
-  731903,
-  850240,
-  850350,
-  850150,
-  850200,
-  849950,
-  850130,
-  850160,
-  850220,
-  824870,
-  829330,
-  825290,
-  385520,
-  831890,
-  849130,
-  822170,
-  838850,
-  848440,
-  796850,
-  848850,
-  786160,
-  647631,
-  647632,
-  781340,
-  836090,
-  640870,
-  839400,
-  731960,
-  538690,
-  828180,
-  843770,
-  831550,
-  844120,
-  649487,
-  649488,
-  649489,
-  649491,
-  649940,
-  639430,
-  767530,
-  836040,
-  842670,
-  825180,
-  820370,
-  696331,
-  456120,
-  804310,
-  839360,
-  838970,
-  414235,
-  414236,
-  832640,
-  819200,
-  831760,
-  731980,
-  821340,
-  648710,
-  822690,
-  733170,
-  832100,
-  833420,
-  833450,
-  724100,
-  772010,
-  414237,
-  458800,
-  456250,
-  458870,
-  460690,
-  806320,
-  573870,
-  827440,
-  831170,
-  816620,
-  830420,
-  819300,
-  774251,
-  819105,
-  819100,
-  819101,
-  819102,
-  819103,
-  819104,
-  207166,
-  207169,
-  207167,
-  207168,
-  739830,
-  829360,
-  774342,
-  774341,
-  828920,
-  792360,
-  593931,
-  661311,
-  661312,
-  661313,
-  789650,
-  826360,
-  610510,
-  803100,
-  366190,
-  700290,
-  751310,
-  810390,
-  817730,
-  823520,
-  778970,
-  793020,
-  802590,
-  817880,
-  647633,
-  650300,
-  823410,
-  699000,
-  783030,
-  783040,
-  782770,
-  455451,
-  823010,
-  783580,
-  808230,
-  814760,
-  787000,
-  750880,
-  796680,
-  795670,
-  795690,
-  795700,
-  795710,
-  795770,
-  795780,
-  796670,
-  804100,
-  804110,
-  796690,
-  796700,
-  796720,
-  804150,
-  804060,
-  804090,
-  804160,
-  810240,
-  813320,
-  817850,
-  635020,
-  669801,
-  669870,
-  669900,
-  669820,
-  669840,
-  669860,
-  669800,
-  669880,
-  669890,
-  397560,
-  791980,
-  812000,
-  401670,
-  817902,
-  817901,
-  817900,
-  798360,
-  818600,
-  336831,
-  336830,
-  412630,
-  813570,
-  794890,
-  631290,
-  696892,
-  797460,
-  807040,
-  778890,
-  802470,
-  791670,
-  804630,
-  555960,
-  786530,
-  803580,
-  631803,
-  631802,
-  631801,
-  631800,
-  805510,
-  805730,
-  555270,
-  804950,
-  810140,
-  810290,
-  810320,
-  688870,
-  802280,
-  757520,
-  483300,
-  273700,
-  765600,
-  765050,
-  785080,
-  803340,
-  697210,
-  717570,
-  717580,
-  774841,
-  787280,
-  682581,
-  682582,
-  716540,
-  731900,
-  731901,
-  731902,
-  588670,
-  591720,
-  777700,
-  802770,
-  784990,
-  486050,
-  455320,
-  754100,
-  651930,
-  800260,
-  801830,
-  784120,
-  387260,
-  794320,
-  798800,
-  781870,
-  592816,
-  746060,
-  787770,
-  584192,
-  584190,
-  584191,
-  672510,
-  739255,
-  772280,
-  662010,
-  786600,
-  694700,
-  791130,
-  787500,
-  791460,
-  488991,
-  488994,
-  780960,
-  710730,
-  428710,
-  531750,
-  711940,
-  498730,
-  459590,
-  778090,
-  592814,
-  788620,
-  782680,
-  785820,
-  694800,
-  694780,
-  594540,
-  707100,
-  789230,
-  592810,
-  717260,
-  592812,
-  790200,
-  779210,
-  783800,
-  654190,
-  778210,
-  637150,
-  777230,
-  789032,
-  789031,
-  789030,
-  789020,
-  787630,
-  787380,
-  779512,
-  785440,
-  737790,
-  514600,
-  777450,
-  783750,
-  768010,
-  730340,
-  541170,
-  739250,
-  738630,
-  781410,
-  729800,
-  779530,
-  741711,
-  741710,
-  741470,
-  773971,
-  775880,
-  775881,
-  702100,
-  741380,
-  758130,
-  758450,
-  764340,
-  755480,
-  775390,
-  694820,
-  729200,
-  771900,
-  759810,
-  430061,
-  692150,
-  692153,
-  696570,
-  692152,
-  716082,
-  716080,
-  716081,
-  715740,
-  749810,
-  726850,
-  722930,
-  729880,
-  729890,
-  729900,
-  771290,
-  612000,
-  764350,
-  771780,
-  769570,
-  677600,
-  677660,
-  768380,
-  748350,
-  501890,
-  414238,
-  593930,
-  770590,
-  762070,
-  766580,
-  748030,
-  650523,
-  767510,
-  581990,
-  760573,
-  765420,
-  765440,
-  768690,
-  767990,
-  769010,
-  762390,
-  555770,
-  762140,
-  369340,
-  414232,
-  754700,
-  682980,
-  760572,
-  760571,
-  760570,
-  764660,
-  764661,
-  644720,
-  437650,
-  764600,
-  629191,
-  764750,
-  674970,
-  634014,
-  711064,
-  755160,
-  328790,
-  757980,
-  742280,
-  745770,
-  758910,
-  756540,
-  751890,
-  665130,
-  758040,
-  675430,
-  635870,
-  489090,
-  688100,
-  638190,
-  757750,
-  677670,
-  746080,
-  712350,
-  757120,
-  757280,
-  716910,
-  750640,
-  639525,
-  688273,
-  688258,
-  688259,
-  688270,
-  688271,
-  688272,
-  533880,
-  756120,
-  756121,
-  756130,
-  756140,
-  638890,
-  638891,
-  639521,
-  639522,
-  639523,
-  639524,
-  406520,
-  406521,
-  752350,
-  350680,
-  742020,
-  752230,
-  717430,
-  706121,
-  706120,
-  706122,
-  696891,
-  696890,
-  684360,
-  750342,
-  746450,
-  726410,
-  748473,
-  748472,
-  748470,
-  748471,
-  753530,
-  746180,
-  639940,
-  723470,
-  749590,
-  750300,
-  738850,
-  572750,
-  751700,
-  751701,
-  751702,
-  436990,
-  749610,
-  579890,
-  544230,
-  717130,
-  718290,
-  719920,
-  738980,
-  736550,
-  742060,
-  741660,
-  734810,
-  742310,
-  600320,
-  650240,
-  650243,
-  650239,
-  650241,
-  650242,
-  650231,
-  650235,
-  650232,
-  650233,
-  650234,
-  650236,
-  650237,
-  650238,
-  650230,
-  742320,
-  745610,
-  385420,
-  745320,
-  710790,
-  520970,
-  689390,
-  729620,
-  726140,
-  719010,
-  719000,
-  740630,
-  737120,
-  624510,
-  619120,
-  701710,
-  741020,
-  725420,
-  705950,
-  740020,
-  691441,
-  696350,
-  688274,
-  741090,
-  733880,
-  717080,
-  738870,
-  672810,
-  672800,
-  680760,
-  717160,
-  717180,
-  717210,
-  714810,
-  723260,
-  730070,
-  729260,
-  732760,
-  624390,
-  715540,
-  704610,
-  683270,
-  648080,
-  630092,
-  695580,
-  534931,
-  688253,
-  688254,
-  688255,
-  688256,
-  688257,
-  688248,
-  688249,
-  688250,
-  688251,
-  688252,
-  683120,
-  730903,
-  730902,
-  730900,
-  730901,
-  730960,
-  734460,
-  734461,
-  730905,
-  730904,
-  734462,
-  722270,
-  549940,
-  679710,
-  689630,
-  697920,
-  729540,
-  728980,
-  677090,
-  723770,
-  725030,
-  709500,
-  726660,
-  729250,
-  701690,
-  727630,
-  722362,
-  722360,
-  722361,
-  722770,
-  684730,
-  713960,
-  720170,
-  714320,
-  711580,
-  717620,
-  693510,
-  432450,
-  715770,
-  723170,
-  491610,
-  491611,
-  491612,
-  491613,
-  722720,
-  435370,
-  712330,
-  602280,
-  723040,
-  656870,
-  704340,
-  705200,
-  688244,
-  688245,
-  688241,
-  688242,
-  688243,
-  721750,
-  704730,
-  703671,
-  716470,
-  714720,
-  713110,
-  720340,
-  694380,
-  624960,
-  409570,
-  699090,
-  707740,
-  403260,
-  707360,
-  683990,
-  709960,
-  698390,
-  703170,
-  715260,
-  488999,
-  651530,
-  676860,
-  714710,
-  714600,
-  631040,
-  688230,
-  638630,
-  713240,
-  712251,
-  704600,
-  715180,
-  604610,
-  604602,
-  604601,
-  604091,
-  604090,
-  691500,
-  692240,
-  699520,
-  629680,
-  646140,
-  687660,
-  687661,
-  683140,
-  639070,
-  686350,
-  686351,
-  574730,
-  415760,
-  529170,
-  622110,
-  469540,
-  639550,
-  497990,
-  514630,
-  538780,
-  543660,
-  594620,
-  512970,
-  610280,
-  700420,
-  564770,
-  648470,
-  648460,
-  693618,
-  693621,
-  693612,
-  693603,
-  693604,
-  693605,
-  693608,
-  693613,
-  693617,
-  693622,
-  693623,
-  693628,
-  693633,
-  693637,
-  693606,
-  693614,
-  693615,
-  693616,
-  693635,
-  693641,
-  693600,
-  693607,
-  693620,
-  693624,
-  693625,
-  693629,
-  693631,
-  693632,
-  693636,
-  693609,
-  693611,
-  693626,
-  693639,
-  693642,
-  693643,
-  693590,
-  693602,
-  693610,
-  693619,
-  693627,
-  693630,
-  693638,
-  689430,
-  693634,
-  693601,
-  693644,
-  656420,
-  633330,
-  690660,
-  673320,
-  645250,
-  700690,
-  700710,
-  700700,
-  700670,
-  700680,
-  704390,
-  658271,
-  658302,
-  658303,
-  658294,
-  658295,
-  658296,
-  658297,
-  658298,
-  658299,
-  658300,
-  658301,
-  658277,
-  658278,
-  658279,
-  658290,
-  658291,
-  658293,
-  658292,
-  658272,
-  658273,
-  658274,
-  658276,
-  658275,
-  346540,
-  346541,
-  346542,
-  691510,
-  682950,
-  690780,
-  678270,
-  678280,
-  702040,
-  650140,
-  698470,
-  461020,
-  686070,
-  414230,
-  414234,
-  414233,
-  649840,
-  649861,
-  22365,
-  689490,
-  50412,
-  50413,
-  50415,
-  50416,
-  685830,
-  414231,
-  696210,
-  622000,
-  701700,
-  697420,
-  691480,
-  681510,
-  681511,
-  681512,
-  681513,
-  681514,
-  681516,
-  681515,
-  634012,
-  683740,
-  650790,
-  675420,
-  650910,
-  675600,
-  577100,
-  694080,
-  662490,
-  652840,
-  642270,
-  691950,
-  694940,
-  654140,
-  598770,
-  645180,
-  626520,
-  626521,
-  626523,
-  626530,
-  626531,
-  626532,
-  626533,
-  626534,
-  626535,
-  626536,
-  626540,
-  626541,
-  626542,
-  626543,
-  626544,
-  626545,
-  626546,
-  626547,
-  626548,
-  626560,
-  626562,
-  689890,
-  692140,
-  693910,
-  680210,
-  686670,
-  675802,
-  675804,
-  675806,
-  675807,
-  675809,
-  675780,
-  675820,
-  675821,
-  675800,
-  674100,
-  675770,
-  675805,
-  675790,
-  675801,
-  675803,
-  675808,
-  644960,
-  645910,
-  644962,
-  644961,
-  692300,
-  679350,
-  658410,
-  505451,
-  690880,
-  536380,
-  688030,
-  678600,
-  689550,
-  649431,
-  665170,
-  567970,
-  525471,
-  620381,
-  686130,
-  658910,
-  687620,
-  671820,
-  683420,
-  685820,
-  682410,
-  682400,
-  682390,
-  682380,
-  675860,
-  663680,
-  682840,
-  682850,
-  682830,
-  684010,
-  671950,
-  649690,
-  669590,
-  669940,
-  428820,
-  428821,
-  428840,
-  426980,
-  436920,
-  426960,
-  542440,
-  413570,
-  680840,
-  679950,
-  678324,
-  678323,
-  678322,
-  678320,
-  678321,
-  679320,
-  679880,
-  659800,
-  674300,
-  581750,
-  405460,
-  653790,
-  652932,
-  657960,
-  652931,
-  667650,
-  646930,
-  668120,
-  668121,
-  668130,
-  632160,
-  492590,
-  665070,
-  674290,
-  579650,
-  667980,
-  544561,
-  544560,
-  651400,
-  660930,
-  510820,
-  663420,
-  639050,
-  629010,
-  668881,
-  668880,
-  668871,
-  668870,
-  669100,
-  647071,
-  447250,
-  665530,
-  642500,
-  471450,
-  659710,
-  639260,
-  639261,
-  639262,
-  639263,
-  639264,
-  639265,
-  639266,
-  639250,
-  662866,
-  662860,
-  662863,
-  662861,
-  662862,
-  662864,
-  662865,
-  661142,
-  621190,
-  642590,
-  660060,
-  660050,
-  660250,
-  637910,
-  526410,
-  647400,
-  636410,
-  498760,
-  653000,
-  657190,
-  615981,
-  649430,
-  636530,
-  630590,
-  634010,
-  324910,
-  324912,
-  324913,
-  301771,
-  298970,
-  653200,
-  653570,
-  636380,
-  516622,
-  645220,
-  644820,
-  605050,
-  647920,
-  643010,
-  468360,
-  449080,
-  639750,
-  645870,
-  581880,
-  648960,
-  642510,
-  648330,
-  571170,
-  393560,
-  647620,
-  429760,
-  648850,
-  648840,
-  640770,
-  640670,
-  623490,
-  645170,
-  643420,
-  628790,
-  645960,
-  584690,
-  626180,
-  604600,
-  646161,
-  635540,
-  543310,
-  591730,
-  592790,
-  569740,
-  562790,
-  532050,
-  644210,
-  639891,
-  639890,
-  642540,
-  643460,
-  641440,
-  640910,
-  631970,
-  639030,
-  638860,
-  635080,
-  632740,
-  616500,
-  637350,
-  629070,
-  637030,
-  414360,
-  627470,
-  627500,
-  574750,
-  635780,
-  622760,
-  625330,
-  366130,
-  636670,
-  632940,
-  631610,
-  637140,
-  591030,
-  555250,
-  545290,
-  388480,
-  632060,
-  632660,
-  633470,
-  486830,
-  615500,
-  572500,
-  633410,
-  632910,
-  571470,
-  629470,
-  362120,
-  620382,
-  632630,
-  633280,
-  456410,
-  630290,
-  580120,
-  631330,
-  631331,
-  631332,
-  615140,
-  383510,
-  589600,
-  628930,
-  629920,
-  631310,
-  630300,
-  624282,
-  624281,
-  624280,
-  446650,
-  627400,
-  625610,
-  492330,
-  629620,
-  629630,
-  628280,
-  628600,
-  225999,
-  621040,
-  625710,
-  626820,
-  622130,
-  620820,
-  587980,
-  568700,
-  568590,
-  624360,
-  584630,
-  340230,
-  340231,
-  340232,
-  340233,
-  470150,
-  470151,
-  586940,
-  622390,
-  587740,
-  622580,
-  615130,
-  622500,
-  615300,
-  607100,
-  617890,
-  618980,
-  609120,
-  494410,
-  619980,
-  604930,
-  618180,
-  488640,
-  605930,
-  609830,
-  349990,
-  470200,
-  553720,
-  617760,
-  570652,
-  613680,
-  561350,
-  601190,
-  595980,
-  582100,
-  424860,
-  595020,
-  542900,
-  610330,
-  607840,
-  608650,
-  570655,
-  570654,
-  570653,
-  570651,
-  570619,
-  570617,
-  570616,
-  570615,
-  570614,
-  570613,
-  570612,
-  570611,
-  570610,
-  529120,
-  561460,
-  466360,
-  570320,
-  437300,
-  437301,
-  437303,
-  422290,
-  437302,
-  594420,
-  584030,
-  604480,
-  434180,
-  602780,
-  597690,
-  606210,
-  605880,
-  583670,
-  488120,
-  568760,
-  600240,
-  590540,
-  572530,
-  573190,
-  594060,
-  590470,
-  588570,
-  598290,
-  589310,
-  357440,
-  561800,
-  590400,
-  530152,
-  530151,
-  530150,
-  600070,
-  385930,
-  598510,
-  591063,
-  591062,
-  591061,
-  591060,
-  591050,
-  591160,
-  543200,
-  230790,
-  230791,
-  505100,
-  589230,
-  577220,
-  581830,
-  581831,
-  495620,
-  297690,
-  588150,
-  523910,
-  590500,
-  590882,
-  590883,
-  590884,
-  590880,
-  590881,
-  585472,
-  569310,
-  543690,
-  572370,
-  543691,
-  543692,
-  543693,
-  543700,
-  559390,
-  559391,
-  589330,
-  494200,
-  488996,
-  587800,
-  492040,
-  492050,
-  492060,
-  491940,
-  491960,
-  491460,
-  491980,
-  491480,
-  491500,
-  492030,
-  587780,
-  588840,
-  586500,
-  505340,
-  502590,
-  587891,
-  587890,
-  587882,
-  587881,
-  587880,
-  212751,
-  212752,
-  555380,
-  574880,
-  533310,
-  586490,
-  587760,
-  497910,
-  584620,
-  573010,
-  503660,
-  584700,
-  582930,
-  584050,
-  441710,
-  549750,
-  582090,
-  570430,
-  105802,
-  533810,
-  445340,
-  503310,
-  24450,
-  578400,
-  444611,
-  574020,
-  556570,
-  571120,
-  576210,
-  578770,
-  401860,
-  421860,
-  574972,
-  574971,
-  574970,
-  524020,
-  555550,
-  544320,
-  486420,
-  565310,
-  543340,
-  327610,
-  258850,
-  258852,
-  258851,
-  575610,
-  574770,
-  431340,
-  448212,
-  492640,
-  362420,
-  572340,
-  575190,
-  567422,
-  567421,
-  270990,
-  567420,
-  569820,
-  445341,
-  573140,
-  450341,
-  450340,
-  450350,
-  571750,
-  476570,
-  571440,
-  457221,
-  457222,
-  457224,
-  499220,
-  499224,
-  431780,
-  437980,
-  446364,
-  446365,
-  446367,
-  446368,
-  446369,
-  437970,
-  446360,
-  446361,
-  446362,
-  446363,
-  567850,
-  446366,
-  445780,
-  437940,
-  437950,
-  499223,
-  437990,
-  540850,
-  499221,
-  499222,
-  431790,
-  431800,
-  437960,
-  457220,
-  457223,
-  352991,
-  570920,
-  571220,
-  559950,
-  567050,
-  477890,
-  563440,
-  570010,
-  567610,
-  511131,
-  554200,
-  505650,
-  511130,
-  552760,
-  568710,
-  569190,
-  567180,
-  509500,
-  569250,
-  560580,
-  560581,
-  560582,
-  547630,
-  452201,
-  459740,
-  459744,
-  459741,
-  459743,
-  459742,
-  336260,
-  314750,
-  332190,
-  332191,
-  318070,
-  318071,
-  566340,
-  563880,
-  566330,
-  417230,
-  544060,
-  557200,
-  561240,
-  563590,
-  551250,
-  538370,
-  541810,
-  541940,
-  558460,
-  418320,
-  493330,
-  333770,
-  333773,
-  561130,
-  560590,
-  517640,
-  549630,
-  559880,
-  469670,
-  480600,
-  465230,
-  407460,
-  470500,
-  558310,
-  560240,
-  558880,
-  556810,
-  505015,
-  522170,
-  547240,
-  466960,
-  552850,
-  550850,
-  558120,
-  435340,
-  550070,
-  389630,
-  388670,
-  389620,
-  385160,
-  408260,
-  547562,
-  547561,
-  473590,
-  556100,
-  383680,
-  526420,
-  546140,
-  556420,
-  549800,
-  463600,
-  406421,
-  406422,
-  406420,
-  532100,
-  538640,
-  456110,
-  456230,
-  456231,
-  543090,
-  387080,
-  523470,
-  521170,
-  523460,
-  400810,
-  464560,
-  516380,
-  520200,
-  509890,
-  402690,
-  548440,
-  492250,
-  492260,
-  439470,
-  327470,
-  342270,
-  386580,
-  361880,
-  380170,
-  460260,
-  411410,
-  409110,
-  409111,
-  413000,
-  413001,
-  411020,
-  405930,
-  408450,
-  346261,
-  489780,
-  455740,
-  287550,
-  316671,
-  407400,
-  377170,
-  549640,
-  551030,
-  464860,
-  500860,
-  485090,
-  546690,
-  499650,
-  541280,
-  530030,
-  519216,
-  519214,
-  519215,
-  519217,
-  461110,
-  461090,
-  431060,
-  485190,
-  428770,
-  485180,
-  485170,
-  461120,
-  542840,
-  546480,
-  546860,
-  464330,
-  545120,
-  494640,
-  353000,
-  528220,
-  418090,
-  328200,
-  522830,
-  217310,
-  538570,
-  451440,
-  451443,
-  451442,
-  477260,
-  253830,
-  253831,
-  253832,
-  531120,
-  543220,
-  543230,
-  525550,
-  532060,
-  333680,
-  533750,
-  543490,
-  499260,
-  92502,
-  92503,
-  92504,
-  92505,
-  92506,
-  92507,
-  92508,
-  254423,
-  254420,
-  254421,
-  254422,
-  488320,
-  469780,
-  532610,
-  539030,
-  372920,
-  496330,
-  532310,
-  275171,
-  536790,
-  538610,
-  535510,
-  501151,
-  395690,
-  528040,
-  529200,
-  537900,
-  509300,
-  533230,
-  527405,
-  527407,
-  527404,
-  527402,
-  527403,
-  527406,
-  527401,
-  527400,
-  523040,
-  537410,
-  524450,
-  521120,
-  520580,
-  521121,
-  521962,
-  523581,
-  531720,
-  522930,
-  523580,
-  523583,
-  523582,
-  537190,
-  528290,
-  535731,
-  535730,
-  516370,
-  534590,
-  531940,
-  534830,
-  476561,
-  534420,
-  529750,
-  503270,
-  525580,
-  533491,
-  533490,
-  533492,
-  492010,
-  491990,
-  491970,
-  492000,
-  521850,
-  514690,
-  522980,
-  524870,
-  525220,
-  525221,
-  332750,
-  403330,
-  527170,
-  508430,
-  523590,
-  516930,
-  527000,
-  470180,
-  519210,
-  519211,
-  519212,
-  519213,
-  519218,
-  519219,
-  505470,
-  520830,
-  524190,
-  524360,
-  523560,
-  516090,
-  516910,
-  49310,
-  49311,
-  522630,
-  515970,
-  512670,
-  518080,
-  511240,
-  519136,
-  519135,
-  519134,
-  519132,
-  519131,
-  506120,
-  509200,
-  516320,
-  503990,
-  499570,
-  499571,
-  499572,
-  499573,
-  499670,
-  498410,
-  495510,
-  438970,
-  511200,
-  500250,
-  497930,
-  511300,
-  511301,
-  512990,
-  510600,
-  510400,
-  494300,
-  504120,
-  511870,
-  510310,
-  506600,
-  506350,
-  504070,
-  477760,
-  506620,
-  503890,
-  501460,
-  468790,
-  432840,
-  503880,
-  497521,
-  502310,
-  500770,
-  497010,
-  487610,
-  494074,
-  500160,
-  500840,
-  475210,
-  488560,
-  498400,
-  435961,
-  486040,
-  497540,
-  464180,
-  457560,
-  477810,
-  492331,
-  473870,
-  489990,
-  270930,
-  292960,
-  316920,
-  488190,
-  487010,
-  249700,
-  482410,
-  404060,
-  488620,
-  433180,
-  485960,
-  470610,
-  473871,
-  488700,
-  470870,
-  456910,
-  374180,
-  373450,
-  432600,
-  487480,
-  477840,
-  384531,
-  384532,
-  352980,
-  384850,
-  486210,
-  485720,
-  486520,
-  340661,
-  487050,
-  479270,
-  321230,
-  321232,
-  321231,
-  465410,
-  465570,
-  484340,
-  470670,
-  450342,
-  376860,
-  471320,
-  477830,
-  461440,
-  463902,
-  463901,
-  463904,
-  463903,
-  463900,
-  473420,
-  456640,
-  470770,
-  49314,
-  49315,
-  49313,
-  49312,
-  471750,
-  469880,
-  463990,
-  465834,
-  458100,
-  335580,
-  315490,
-  430060,
-  459890,
-  465833,
-  458810,
-  460880,
-  408390,
-  425420,
-  465832,
-  463360,
-  425130,
-  465831,
-  465830,
-  322152,
-  322151,
-  322150,
-  465730,
-  463200,
-  465691,
-  465530,
-  464640,
-  464460,
-  462351,
-  452200,
-  461060,
-  449970,
-  408210,
-  287381,
-  457100,
-  450070,
-  456560,
-  451730,
-  448270,
-  448760,
-  449400,
-  446882,
-  450870,
-  450890,
-  455900,
-  449990,
-  454010,
-  454791,
-  454450,
-  430250,
-  20004,
-  20005,
-  30010,
-  30040,
-  93305,
-  454340,
-  454660,
-  412030,
-  425630,
-  436910,
-  440040,
-  371870,
-  451241,
-  372310,
-  372301,
-  446080,
-  430050,
-  445660,
-  446880,
-  446350,
-  384520,
-  384340,
-  386910,
-  386911,
-  386913,
-  383370,
-  371930,
-  339870,
-  444540,
-  354270,
-  319020,
-  319030,
-  311030,
-  311031,
-  442510,
-  445080,
-  446900,
-  287380,
-  442020,
-  438830,
-  426060,
-  440530,
-  443780,
-  439390,
-  430330,
-  443400,
-  444820,
-  430400,
-  273540,
-  443710,
-  288780,
-  436190,
-  432580,
-  428320,
-  394040,
-  340670,
-  376530,
-  424880,
-  428140,
-  397230,
-  436710,
-  419890,
-  327461,
-  327460,
-  435240,
-  281810,
-  281811,
-  281812,
-  318150,
-  423240,
-  426120,
-  418580,
-  433390,
-  352540,
-  432650,
-  431820,
-  369710,
-  412950,
-  412820,
-  412821,
-  421720,
-  425490,
-  430940,
-  21150,
-  21160,
-  430200,
-  357970,
-  430000,
-  357450,
-  408550,
-  427650,
-  219210,
-  219212,
-  420340,
-  420450,
-  325660,
-  425710,
-  412951,
-  322090,
-  409330,
-  372300,
-  425910,
-  425930,
-  425750,
-  425920,
-  425940,
-  426220,
-  402640,
-  402650,
-  424240,
-  348210,
-  230320,
-  288940,
-  264920,
-  413340,
-  374874,
-  374872,
-  374873,
-  424800,
-  425100,
-  421780,
-  410140,
-  421130,
-  421131,
-  403550,
-  422280,
-  420250,
-  411050,
-  96308,
-  421200,
-  400600,
-  410460,
-  407800,
-  410450,
-  417080,
-  412900,
-  317050,
-  367760,
-  367770,
-  318880,
-  304110,
-  346870,
-  405940,
-  400120,
-  392090,
-  391010,
-  390690,
-  387230,
-  386300,
-  382151,
-  380760,
-  375860,
-  375610,
-  375590,
-  373711,
-  373220,
-  373190,
-  372910,
-  372550,
-  372520,
-  372100,
-  370880,
-  370820,
-  370830,
-  370110,
-  369980,
-  369960,
-  369970,
-  369950,
-  369930,
-  369940,
-  369920,
-  369910,
-  369740,
-  369510,
-  369511,
-  369507,
-  369508,
-  369509,
-  369505,
-  369506,
-  369503,
-  369504,
-  369502,
-  369500,
-  369501,
-  369450,
-  369130,
-  369131,
-  368550,
-  368350,
-  367750,
-  367730,
-  367740,
-  367380,
-  363540,
-  362970,
-  362760,
-  362720,
-  361542,
-  361540,
-  361541,
-  359130,
-  358880,
-  357710,
-  357711,
-  356780,
-  356124,
-  356123,
-  356122,
-  356120,
-  356121,
-  355260,
-  355262,
-  354940,
-  354890,
-  353930,
-  353740,
-  353741,
-  353742,
-  352680,
-  349810,
-  341790,
-  331892,
-  331890,
-  331891,
-  326690,
-  326691,
-  316710,
-  316540,
-  316541,
-  316530,
-  316500,
-  316510,
-  316520,
-  313310,
-  313311,
-  313300,
-  296340,
-  284070,
-  236555,
-  236556,
-  236557,
-  236558,
-  236551,
-  236552,
-  236553,
-  236554,
-  60602,
-  399021,
-  322690,
-  409241,
-  409253,
-  409194,
-  344970,
-  409193,
-  409200,
-  409201,
-  409202,
-  409203,
-  409190,
-  409192,
-  414030,
-  415730,
-  415580,
-  388070,
-  414674,
-  414675,
-  414672,
-  414671,
-  414673,
-  415040,
-  415340,
-  408070,
-  411170,
-  275440,
-  412870,
-  374660,
-  371350,
-  395530,
-  411150,
-  411850,
-  389750,
-  410260,
-  49337,
-  307660,
-  408660,
-  227740,
-  409430,
-  400420,
-  403540,
-  401500,
-  355360,
-  404650,
-  405660,
-  401110,
-  8960,
-  303360,
-  376320,
-  50432,
-  99841,
-  50433,
-  99842,
-  107010,
-  374530,
-  50434,
-  379650,
-  99843,
-  107011,
-  50435,
-  50436,
-  385540,
-  99845,
-  50437,
-  402950,
-  207110,
-  273670,
-  99846,
-  50438,
-  313350,
-  33287,
-  43015,
-  50439,
-  333320,
-  38920,
-  43016,
-  50440,
-  325640,
-  38921,
-  64009,
-  346890,
-  354570,
-  38922,
-  378890,
-  38923,
-  201740,
-  268300,
-  38924,
-  38925,
-  335630,
-  95502,
-  38926,
-  371470,
-  307470,
-  335631,
-  38927,
-  371471,
-  261391,
-  335632,
-  222224,
-  91920,
-  371472,
-  261392,
-  335633,
-  222225,
-  371473,
-  261393,
-  335634,
-  227090,
-  370450,
-  383250,
-  261394,
-  219411,
-  261395,
-  219412,
-  261396,
-  219413,
-  261397,
-  201750,
-  261398,
-  261399,
-  363800,
-  42520,
-  261400,
-  363801,
-  42521,
-  261401,
-  91930,
-  363802,
-  261402,
-  200731,
-  50203,
-  261403,
-  200732,
-  361500,
-  50204,
-  261404,
-  200733,
-  50205,
-  63005,
-  261405,
-  200734,
-  232990,
-  50206,
-  261406,
-  200735,
-  50207,
-  261407,
-  328480,
-  395040,
-  50208,
-  314400,
-  261408,
-  50209,
-  261409,
-  371490,
-  50210,
-  261410,
-  371491,
-  261411,
-  371492,
-  374820,
-  50212,
-  261412,
-  203813,
-  371493,
-  48165,
-  50213,
-  393510,
-  40230,
-  50214,
-  50215,
-  34344,
-  238120,
-  238121,
-  334890,
-  238122,
-  111402,
-  50219,
-  367150,
-  338480,
-  361520,
-  98609,
-  34610,
-  55346,
-  395060,
-  334900,
-  325940,
-  55349,
-  267830,
-  334390,
-  110902,
-  99895,
-  34615,
-  99896,
-  34616,
-  363320,
-  50233,
-  330810,
-  270650,
-  17210,
-  50234,
-  63802,
-  50235,
-  63803,
-  366140,
-  50236,
-  384060,
-  389180,
-  50237,
-  203070,
-  32830,
-  50238,
-  32831,
-  50239,
-  399680,
-  32832,
-  32833,
-  32834,
-  40002,
-  40003,
-  17220,
-  40004,
-  40005,
-  209990,
-  224326,
-  40006,
-  209991,
-  24135,
-  224327,
-  341320,
-  221000,
-  55112,
-  80202,
-  383050,
-  386890,
-  219211,
-  80204,
-  359500,
-  80205,
-  219213,
-  50253,
-  332110,
-  208462,
-  80206,
-  219214,
-  50254,
-  80207,
-  50255,
-  73040,
-  403280,
-  50256,
-  50257,
-  50513,
-  203090,
-  401490,
-  50258,
-  379730,
-  50259,
-  374100,
-  208470,
-  268120,
-  383320,
-  268121,
-  49497,
-  265050,
-  268122,
-  22618,
-  297050,
-  201563,
-  268123,
-  201564,
-  268124,
-  203100,
-  201565,
-  268125,
-  270941,
-  39261,
-  201566,
-  270942,
-  80222,
-  201567,
-  201568,
-  48225,
-  50273,
-  332130,
-  406370,
-  18530,
-  361570,
-  50274,
-  67683,
-  73059,
-  18531,
-  361571,
-  50275,
-  67684,
-  399460,
-  18532,
-  24932,
-  50276,
-  18533,
-  50277,
-  203110,
-  24422,
-  24934,
-  50278,
-  388710,
-  24935,
-  50279,
-  47720,
-  24937,
-  275050,
-  341610,
-  359530,
-  71275,
-  115307,
-  273260,
-  22637,
-  100973,
-  115309,
-  335982,
-  344430,
-  22638,
-  318830,
-  22639,
-  352111,
-  203120,
-  22640,
-  364400,
-  383600,
-  41073,
-  283250,
-  22642,
-  237170,
-  237171,
-  362100,
-  236660,
-  335990,
-  273270,
-  216950,
-  375670,
-  335991,
-  330360,
-  403320,
-  330361,
-  231801,
-  330362,
-  203130,
-  334970,
-  349050,
-  218490,
-  364410,
-  55162,
-  330363,
-  55163,
-  283260,
-  218492,
-  361340,
-  55164,
-  42110,
-  318590,
-  282240,
-  202113,
-  209793,
-  335490,
-  22658,
-  24962,
-  204419,
-  335491,
-  204420,
-  335492,
-  320900,
-  215430,
-  109702,
-  381830,
-  215431,
-  403080,
-  215432,
-  295560,
-  392840,
-  209801,
-  215433,
-  650,
-  67210,
-  80010,
-  215434,
-  306570,
-  651,
-  215435,
-  652,
-  215436,
-  321420,
-  653,
-  215437,
-  321421,
-  654,
-  334990,
-  92302,
-  55182,
-  92303,
-  329360,
-  24208,
-  24209,
-  209810,
-  298130,
-  303250,
-  303251,
-  334740,
-  364180,
-  383380,
-  209814,
-  22678,
-  25750,
-  313750,
-  315030,
-  391830,
-  209815,
-  25751,
-  333720,
-  209816,
-  25752,
-  25753,
-  202650,
-  25754,
-  384410,
-  202651,
-  25755,
-  33435,
-  202652,
-  25756,
-  33436,
-  368540,
-  326300,
-  327580,
-  669,
-  25757,
-  227741,
-  327581,
-  25758,
-  227742,
-  327582,
-  25759,
-  327583,
-  327840,
-  267680,
-  335520,
-  18080,
-  24992,
-  25760,
-  309920,
-  391840,
-  327584,
-  18081,
-  24993,
-  25761,
-  57505,
-  341410,
-  351650,
-  221090,
-  25762,
-  57506,
-  221091,
-  25763,
-  11172,
-  219300,
-  221092,
-  25764,
-  311460,
-  221093,
-  25765,
-  2726,
-  3750,
-  221094,
-  316070,
-  258470,
-  221095,
-  327080,
-  344490,
-  57515,
-  202412,
-  57516,
-  390060,
-  57517,
-  203182,
-  57518,
-  255150,
-  203183,
-  203184,
-  367280,
-  239280,
-  318640,
-  67250,
-  9906,
-  9907,
-  395700,
-  217780,
-  361140,
-  377780,
-  55220,
-  256180,
-  217781,
-  55221,
-  9910,
-  217782,
-  107702,
-  55222,
-  55223,
-  22456,
-  219320,
-  317880,
-  320440,
-  395450,
-  349370,
-  351930,
-  373690,
-  108220,
-  40125,
-  330430,
-  381630,
-  390590,
-  351680,
-  330690,
-  207810,
-  221890,
-  105410,
-  386500,
-  49605,
-  384710,
-  320710,
-  330440,
-  362440,
-  46792,
-  458,
-  368330,
-  370890,
-  200396,
-  92620,
-  360140,
-  200397,
-  9933,
-  214989,
-  92621,
-  92622,
-  258510,
-  92623,
-  258511,
-  386000,
-  258512,
-  98001,
-  63953,
-  272082,
-  209362,
-  91602,
-  98002,
-  91603,
-  98003,
-  217812,
-  98004,
-  317140,
-  392660,
-  10197,
-  9942,
-  98006,
-  63958,
-  98007,
-  389591,
-  63959,
-  220120,
-  220121,
-  355290,
-  378330,
-  382170,
-  98012,
-  362460,
-  102620,
-  315100,
-  315101,
-  214750,
-  98014,
-  98015,
-  102624,
-  316640,
-  387040,
-  404450,
-  275170,
-  47842,
-  1507,
-  91619,
-  401380,
-  406500,
-  341220,
-  369380,
-  47844,
-  91621,
-  212710,
-  91622,
-  91623,
-  16872,
-  91624,
-  313320,
-  390120,
-  42729,
-  50410,
-  389610,
-  1515,
-  227563,
-  50411,
-  67310,
-  401390,
-  50414,
-  401391,
-  16879,
-  226800,
-  226801,
-  50417,
-  219380,
-  317430,
-  1528,
-  375800,
-  361210,
-  391930,
-  354300,
-  332030,
-  305150,
-  50430,
-  1535,
-  50431,
-  1842460,
-  1357690,
-  1115790,
-  488050,
-  1795700,
-  1688560,
-  1832360,
-  1828620,
-  1804830,
-  1635360,
-  1256810,
-  1833740,
-  1786650,
-  1638640,
-  457840,
-  1824920,
-  1663690,
-  1260680,
-  1817690,
-  1585900,
-  1652760,
-  1843510,
-  1837860,
-  1661120,
-  1813450,
-  1817050,
-  858970,
-  471740,
-  1715200,
-  1715100,
-  1714890,
-  1715150,
-  1715180,
-  1809600,
-  1796160,
-  1040700,
-  1802770,
-  1467440,
-  1564610,
-  1663760,
-  1229370,
-  1828150,
-  1659770,
-  1829860,
-  642240,
-  1722900,
-  1567610,
-  1429280,
-  1619010,
-  1253280,
-  642630,
-  1790460,
-  1318160,
-  1241930,
-  1747420,
-  1610400,
-  919450,
-  1759110,
-  1637330,
-  1270140,
-  720530,
-  1734720,
-  1426700,
-  1646690,
-  1229040,
-  1796880,
-  1557570,
-  1474600,
-  1670100,
-  1244560,
-  323180,
-  1646720,
-  492822,
-  1341970,
-  1281500,
-  1828670,
-  1620250,
-  1833520,
-  1832460,
-  1832470,
-  1832450,
-  1832440,
-  1816580,
-  1832430,
-  1832400,
-  1832390,
-  1832410,
-  1832420,
-  411400,
-  411401,
-  492820,
-  492821,
-  1767341,
-  1558810,
-  1558820,
-  1776180,
-  1692260,
-  1546840,
-  1606200,
-  1448240,
-  1568780,
-  1574280,
-  332740,
-  1297600,
-  804590,
-  1836000,
-  782580,
-  1831000,
-  1778440,
-  1701310,
-  1727830,
-  306601,
-  1726840,
-  961400,
-  1802540,
-  1802480,
-  1496130,
-  1337510,
-  687140,
-  1593450,
-  1431390,
-  1357900,
-  1234950,
-  1540620,
-  1830880,
-  1768120,
-  1658570,
-  1458660,
-  1744160,
-  1781130,
-  1663680,
-  1286760,
-  1796120,
-  1770090,
-  1646700,
-  1817410,
-  1754810,
-  1523190,
-  1759770,
-  1593020,
-  1764200,
-  1768130,
-  1793540,
-  1402630,
-  1816840,
-  1702920,
-  1764620,
-  1812750,
-  1395730,
-  1239060,
-  1437460,
-  1547800,
-  1814040,
-  1516830,
-  1817630,
-  1770530,
-  1711140,
-  1791780,
-  1284900,
-  1527850,
-  1536810,
-  1439020,
-  1661230,
-  1573680,
-  1318960,
-  1717040,
-  1275440,
-  1823280,
-  1720630,
-  1287480,
-  1814840,
-  1647930,
-  1399610,
-  1752380,
-  1543230,
-  1563200,
-  1275460,
-  1611080,
-  1661770,
-  1811530,
-  1752910,
-  1763920,
-  1608280,
-  1829720,
-  1720410,
-  1281120,
-  1638240,
-  1795940,
-  1260650,
-  1614700,
-  1365870,
-  1435510,
-  1830010,
-  1806720,
-  1238660,
-  1468550,
-  1832840,
-  1640330,
-  1594250,
-  1744010,
-  1554570,
-  1488270,
-  1770640,
-  1600150,
-  1247130,
-  1833370,
-  1401760,
-  1777570,
-  1314470,
-  1830310,
-  1413800,
-  1249450,
-  1400490,
-  1702570,
-  1815470,
-  1794480,
-  1827510,
-  1289400,
-  1774010,
-  1797050,
-  1749690,
-  1455810,
-  1787330,
-  1617350,
-  1822150,
-  1717450,
-  1703630,
-  1472210,
-  1286610,
-  1820370,
-  1708500,
-  1646550,
-  1818070,
-  1396440,
-  1486040,
-  1408990,
-  1619170,
-  1372130,
-  1744870,
-  1492970,
-  1611500,
-  1616620,
-  1424880,
-  1823230,
-  1436670,
-  1635070,
-  1144180,
-  1685040,
-  1279750,
-  862810,
-  1446360,
-  1669810,
-  440820,
-  509100,
-  1726740,
-  1316670,
-  1240360,
-  1142470,
-  335370,
-  1245700,
-  921640,
-  1197980,
-  406470,
-  1258500,
-  295510,
-  420690,
-  1244160,
-  323150,
-  323170,
-  211262,
-  584381,
-  584383,
-  467300,
-  366080,
-  314680,
-  1280900,
-  452070,
-  1573650,
-  459280,
-  554790,
-  323120,
-  335350,
-  652720,
-  1409690,
-  738710,
-  1308030,
-  1061760,
-  1162380,
-  1015990,
-  1627830,
-  1555810,
-  1353960,
-  578000,
-  334580,
-  343300,
-  1616120,
-  721620,
-  1275500,
-  1275580,
-  1275570,
-  1783990,
-  1556830,
-  1543640,
-  1236440,
-  1224590,
-  365380,
-  1075710,
-  1803520,
-  1701120,
-  1585670,
-  1570580,
-  1713430,
-  1812000,
-  1793830,
-  1532220,
-  1456450,
-  1595980,
-  1749590,
-  1257570,
-  1818210,
-  1440100,
-  1721190,
-  1695590,
-  1519720,
-  1709930,
-  1821040,
-  1813620,
-  1511030,
-  1416310,
-  1397370,
-  1789320,
-  1730440,
-  1528460,
-  1385870,
-  1830030,
-  1267600,
-  1816720,
-  1738900,
-  1633940,
-  1802140,
-  1258910,
-  1475230,
-  1611170,
-  1573030,
-  1801900,
-  1801390,
-  1824190,
-  1595840,
-  1816260,
-  1447880,
-  1632200,
-  1818850,
-  1664600,
-  1722480,
-  1143852,
-  1294690,
-  1195480,
-  1226450,
-  1159580,
-  973740,
-  329760,
-  1238310,
-  1769070,
-  721711,
-  721710,
-  219152,
-  436090,
-  1249770,
-  1343540,
-  964370,
-  1188090,
-  873030,
-  1581931,
-  1802030,
-  1518170,
-  1601710,
-  1605060,
-  1259090,
-  1707860,
-  1812360,
-  391570,
-  1813580,
-  1822570,
-  1649840,
-  1233220,
-  1032760,
-  1133130,
-  1187881,
-  533240,
-  585730,
-  955710,
-  1802380,
-  1159710,
-  1623600,
-  389830,
-  1634910,
-  1788250,
-  598190,
-  1761280,
-  1540870,
-  433430,
-  1616150,
-  1689110,
-  1818650,
-  1814300,
-  1657380,
-  1301540,
-  1328170,
-  1313840,
-  1643830,
-  1790520,
-  1765190,
-  1247560,
-  1820490,
-  1562200,
-  1817180,
-  1784670,
-  1788010,
-  1810800,
-  1457010,
-  1652370,
-  1781660,
-  1806260,
-  1300410,
-  1815490,
-  511170,
-  1553350,
-  1762770,
-  1569490,
-  1814740,
-  1529820,
-  1490170,
-  1550970,
-  1796090,
-  1822260,
-  613230,
-  1343360,
-  1332420,
-  1789290,
-  1799510,
-  416920,
-  1686180,
-  538860,
-  990430,
-  315960,
-  1284640,
-  837830,
-  1310460,
-  1238761,
-  1360630,
-  553670,
-  1481390,
-  1766880,
-  895720,
-  743880,
-  1782240,
-  1117030,
-  1228810,
-  928500,
-  458740,
-  1804560,
-  1427750,
-  1486150,
-  1800530,
-  1716620,
-  1506780,
-  1309670,
-  1579760,
-  1421480,
-  775260,
-  1629750,
-  1291400,
-  1811850,
-  1787570,
-  1678800,
-  1779700,
-  1395720,
-  209771,
-  1215620,
-  1187240,
-  1235330,
-  1496960,
-  1809670,
-  1622790,
-  1567510,
-  1522720,
-  1568800,
-  1568810,
-  1756980,
-  1648950,
-  1737540,
-  1781600,
-  1244270,
-  1811570,
-  1412490,
-  1812110,
-  1786000,
-  1670040,
-  1801380,
-  1802150,
-  1279670,
-  1731770,
-  1786560,
-  1544130,
-  1440710,
-  1542600,
-  1801930,
-  1573840,
-  1728210,
-  1557970,
-  1753060,
-  1755370,
-  1765100,
-  1699060,
-  1783550,
-  571010,
-  461740,
-  994820,
-  358800,
-  1755440,
-  1791320,
-  1798450,
-  1777720,
-  1793570,
-  1724110,
-  1798440,
-  1412200,
-  497760,
-  1676250,
-  799331,
-  449570,
-  1794100,
-  1457830,
-  770780,
-  1590610,
-  1800710,
-  1772040,
-  1466890,
-  1566730,
-  1738770,
-  1747990,
-  1744410,
-  1801510,
-  1782060,
-  1784620,
-  1335090,
-  1701170,
-  1803320,
-  1729850,
-  1588810,
-  1797200,
-  1755730,
-  1726810,
-  1420390,
-  1783400,
-  1677160,
-  1478510,
-  1416560,
-  1387380,
-  1654400,
-  1271680,
-  1772420,
-  1774480,
-  1770130,
-  1357970,
-  1468310,
-  1795990,
-  1747350,
-  1747620,
-  1781420,
-  1722540,
-  1792940,
-  1798830,
-  1792950,
-  1795000,
-  1741240,
-  1383610,
-  1784770,
-  1787340,
-  1765580,
-  1802960,
-  1643480,
-  1798360,
-  1268450,
-  1620450,
-  1643750,
-  1549040,
-  1635470,
-  1586580,
-  1702110,
-  1252660,
-  1269980,
-  1801250,
-  1658720,
-  919050,
-  1239510,
-  632870,
-  345800,
-  1476780,
-  1595700,
-  1050450,
-  1787750,
-  1782140,
-  571210,
-  620370,
-  1263560,
-  974540,
-  1508300,
-  1206330,
-  1799070,
-  403990,
-  1786140,
-  1719840,
-  1395240,
-  1308200,
-  1785130,
-  1759530,
-  1752110,
-  1761330,
-  1774660,
-  1793860,
-  1790790,
-  1777240,
-  1414750,
-  1595240,
-  1735530,
-  1709690,
-  1628290,
-  1795460,
-  1702020,
-  1470640,
-  1377720,
-  1766600,
-  1771470,
-  1632720,
-  1287890,
-  1368790,
-  1634010,
-  1796320,
-  1561830,
-  1785070,
-  1611260,
-  967400,
-  697760,
-  1451180,
-  449480,
-  1138490,
-  609440,
-  962920,
-  962921,
-  962922,
-  962923,
-  962924,
-  962925,
-  428010,
-  1781690,
-  461160,
-  431620,
-  447410,
-  916000,
-  564180,
-  339330,
-  1260510,
-  1784270,
-  1787260,
-  1164530,
-  1748000,
-  1632700,
-  1435650,
-  1741580,
-  1536030,
-  1738020,
-  1546020,
-  1252910,
-  1684540,
-  1315140,
-  1649220,
-  1422660,
-  1696870,
-  1752680,
-  1279850,
-  1468270,
-  1566320,
-  1529980,
-  1753470,
-  1400720,
-  1487510,
-  1749910,
-  1773980,
-  1792930,
-  1770150,
-  1772200,
-  1586600,
-  1371830,
-  1742520,
-  1700280,
-  477881,
-  1727170,
-  1274050,
-  1765570,
-  1747140,
-  1514440,
-  1784010,
-  1769940,
-  1462230,
-  1789400,
-  1790430,
-  1466080,
-  1785570,
-  1793770,
-  1784050,
-  882890,
-  1315150,
-  1298720,
-  408710,
-  249860,
-  257290,
-  237780,
-  91604,
-  1670522,
-  492140,
-  1567220,
-  1520930,
-  767890,
-  868800,
-  1619300,
-  1018320,
-  354350,
-  1771790,
-  1247760,
-  1394870,
-  1786090,
-  1203790,
-  1102480,
-  1747700,
-  1720080,
-  1766950,
-  1691710,
-  1770560,
-  1436230,
-  1275470,
-  1739090,
-  1439620,
-  1741460,
-  1747100,
-  1778080,
-  1544610,
-  1654180,
-  1723310,
-  1710270,
-  1776830,
-  1484480,
-  1653960,
-  1560270,
-  1269470,
-  1686750,
-  1293790,
-  1715170,
-  1749230,
-  1775090,
-  1778420,
-  1720820,
-  1430520,
-  931960,
-  583260,
-  1229320,
-  1234490,
-  1776740,
-  1358280,
-  1637590,
-  984920,
-  918470,
-  1224940,
-  1643780,
-  1782020,
-  1766670,
-  65302,
-  1391140,
-  1740330,
-  1668910,
-  1770290,
-  1682740,
-  1376570,
-  1335100,
-  1614140,
-  1556030,
-  1653570,
-  1701700,
-  1766220,
-  1715790,
-  1266770,
-  1737810,
-  1412690,
-  1688920,
-  1778540,
-  1762430,
-  1717380,
-  1417860,
-  1774470,
-  1641610,
-  1269130,
-  1575850,
-  1767850,
-  1744560,
-  1418170,
-  1428940,
-  1772760,
-  1725920,
-  1250550,
-  1717750,
-  1703420,
-  809600,
-  1206890,
-  1529320,
-  690180,
-  1355600,
-  1368740,
-  1013090,
-  726050,
-  1354670,
-  1234170,
-  462391,
-  1631300,
-  1396060,
-  1761580,
-  1657310,
-  1270810,
-  1256200,
-  1735250,
-  633910,
-  313260,
-  1231220,
-  1161410,
-  1473280,
-  1725700,
-  1765900,
-  1643790,
-  1546510,
-  1646370,
-  1554990,
-  1295160,
-  1751620,
-  1248070,
-  1567820,
-  1748820,
-  1754220,
-  1527150,
-  1769110,
-  1703320,
-  1729960,
-  1753770,
-  1665710,
-  1746610,
-  1758130,
-  1243570,
-  1716410,
-  1662400,
-  1731530,
-  1310430,
-  1373160,
-  1609970,
-  1723380,
-  1723130,
-  997360,
-  459290,
-  1425430,
-  395020,
-  322420,
-  1207610,
-  380800,
-  1224140,
-  374250,
-  1654382,
-  776560,
-  1480360,
-  1279740,
-  1357950,
-  1268460,
-  1266760,
-  1613040,
-  1330380,
-  1556810,
-  723000,
-  1611010,
-  1450770,
-  1713180,
-  1752860,
-  1457440,
-  1678370,
-  1725760,
-  1239620,
-  1582920,
-  1752670,
-  1731430,
-  1730410,
-  1694060,
-  1484410,
-  1694080,
-  1484420,
-  1452170,
-  1282450,
-  1378980,
-  1763500,
-  1730230,
-  1279680,
-  1525720,
-  1402840,
-  1597410,
-  1748450,
-  1447910,
-  1741310,
-  1393790,
-  875371,
-  800020,
-  493070,
-  1247270,
-  1729350,
-  1320600,
-  1562460,
-  1515440,
-  1413880,
-  492740,
-  1225720,
-  650250,
-  1263790,
-  1584400,
-  1746550,
-  1450130,
-  1517980,
-  811300,
-  1749000,
-  1584650,
-  1741330,
-  1484820,
-  1295380,
-  1679390,
-  1621040,
-  1732150,
-  1319750,
-  1249360,
-  1668440,
-  1739110,
-  1386600,
-  1740650,
-  1241450,
-  1413230,
-  1735290,
-  1730430,
-  1648770,
-  1259650,
-  1730730,
-  1731500,
-  1746350,
-  1570230,
-  1358520,
-  1751740,
-  1524420,
-  1649100,
-  1415390,
-  1737700,
-  1744360,
-  1738730,
-  451410,
-  1740560,
-  1225450,
-  1003800,
-  1206340,
-  390740,
-  328210,
-  209772,
-  629930,
-  1406840,
-  1479510,
-  1490300,
-  457161,
-  925660,
-  1069730,
-  422220,
-  1263830,
-  1700100,
-  1251590,
-  1681680,
-  1609240,
-  1709340,
-  1707810,
-  1724710,
-  1288490,
-  1429290,
-  1593150,
-  1630040,
-  1511770,
-  1727330,
-  1737570,
-  1497720,
-  1650050,
-  1528210,
-  1723810,
-  1303970,
-  1737410,
-  1444040,
-  1675980,
-  1717460,
-  1512150,
-  1600740,
-  1712620,
-  1428720,
-  1288690,
-  1701110,
-  1476090,
-  1578030,
-  457193,
-  610222,
-  610221,
-  610220,
-  593140,
-  1745830,
-  1431050,
-  1431060,
-  1150930,
-  1236710,
-  1130870,
-  1670600,
-  1159920,
-  1178320,
-  1197651,
-  945010,
-  1341580,
-  393580,
-  1727480,
-  1371030,
-  835580,
-  1647880,
-  1440610,
-  1377130,
-  1721500,
-  1434020,
-  1739740,
-  1390780,
-  748680,
-  1124030,
-  1532930,
-  1511180,
-  1645080,
-  1241880,
-  1707300,
-  1247280,
-  1696560,
-  1256000,
-  1282160,
-  1315700,
-  1245310,
-  1239680,
-  1713540,
-  1475980,
-  1731990,
-  1713560,
-  1228740,
-  1733580,
-  1711570,
-  1531860,
-  1612760,
-  1584620,
-  1315830,
-  522620,
-  1601560,
-  1378680,
-  414110,
-  1403090,
-  1105750,
-  1430560,
-  1253420,
-  1299770,
-  1721920,
-  1683780,
-  1304900,
-  503110,
-  1250890,
-  1707340,
-  1377870,
-  1442920,
-  1708910,
-  1445760,
-  1278610,
-  1408660,
-  1456030,
-  1714600,
-  1316540,
-  1715920,
-  1731280,
-  1438160,
-  1572820,
-  1732570,
-  1440480,
-  1687270,
-  1722350,
-  1308910,
-  1486320,
-  1562360,
-  1205120,
-  1556630,
-  1192110,
-  1640382,
-  219750,
-  1265350,
-  1377090,
-  880250,
-  794220,
-  1202470,
-  1138570,
-  931370,
-  1241190,
-  1514520,
-  941900,
-  421940,
-  838860,
-  646780,
-  1691440,
-  455050,
-  966350,
-  1279730,
-  1501860,
-  386860,
-  322660,
-  1410460,
-  848820,
-  1718030,
-  1685540,
-  1716010,
-  1254700,
-  1698370,
-  1411430,
-  1716840,
-  1510260,
-  1377660,
-  1639550,
-  1649590,
-  1464760,
-  937411,
-  1681630,
-  1423840,
-  1241580,
-  1635690,
-  1496890,
-  271010,
-  1236640,
-  467620,
-  368190,
-  271950,
-  1619880,
-  1453930,
-  905290,
-  1622650,
-  1354600,
-  529190,
-  425170,
-  941550,
-  454740,
-  1705740,
-  1481510,
-  1611310,
-  1503840,
-  1692040,
-  1709270,
-  1717980,
-  1706730,
-  417380,
-  1547020,
-  1712660,
-  1666330,
-  1688860,
-  1697840,
-  1460280,
-  1654850,
-  1314660,
-  1575530,
-  1709680,
-  1307000,
-  1525670,
-  1548990,
-  1534400,
-  1272790,
-  1571290,
-  1695980,
-  1706230,
-  1316600,
-  1714780,
-  1101300,
-  323160,
-  1238762,
-  706870,
-  1543580,
-  1361170,
-  1312940,
-  1360060,
-  572910,
-  1248400,
-  1713280,
-  1715620,
-  1710350,
-  1700970,
-  1693880,
-  1443660,
-  1691090,
-  1226390,
-  1296640,
-  1674290,
-  1564780,
-  1277600,
-  1696180,
-  1346500,
-  1692880,
-  1247200,
-  1455340,
-  1576430,
-  1681660,
-  665380,
-  1446570,
-  644360,
-  458790,
-  1517080,
-  1450030,
-  1273420,
-  1703270,
-  1634160,
-  1699700,
-  1695630,
-  1613200,
-  1707420,
-  1475490,
-  1625770,
-  1701550,
-  1706680,
-  1516220,
-  1642180,
-  1691080,
-  1279950,
-  1664480,
-  1680200,
-  1375550,
-  695380,
-  712420,
-  281780,
-  1408950,
-  1351390,
-  1698150,
-  1692660,
-  1586440,
-  1691430,
-  1658670,
-  1670710,
-  1480780,
-  1681750,
-  1637980,
-  1642080,
-  1638250,
-  1614470,
-  1464980,
-  1427610,
-  1299630,
-  1693110,
-  1693120,
-  1661400,
-  1684200,
-  1584110,
-  1346760,
-  1223960,
-  1677530,
-  815330,
-  1223860,
-  448100,
-  1261600,
-  1649160,
-  1681180,
-  1666080,
-  1556020,
-  1503550,
-  1377100,
-  1688410,
-  1548380,
-  1672290,
-  1530730,
-  1630090,
-  1312930,
-  1491620,
-  1594050,
-  1290180,
-  1688260,
-  1313480,
-  1674970,
-  1690850,
-  1689330,
-  1092840,
-  619690,
-  1232750,
-  1293620,
-  1224800,
-  1231980,
-  1273200,
-  1236890,
-  1244060,
-  1271470,
-  925970,
-  612210,
-  298720,
-  40703,
-  1101351,
-  735433,
-  689920,
-  523820,
-  544670,
-  1377740,
-  1021900,
-  445920,
-  1665960,
-  1258740,
-  1665940,
-  1155030,
-  322020,
-  310660,
-  1597190,
-  1629760,
-  1550930,
-  1435730,
-  1668700,
-  1379480,
-  1687720,
-  1605810,
-  1278680,
-  1640420,
-  1497840,
-  1524980,
-  1467290,
-  977370,
-  1111180,
-  556900,
-  1336610,
-  1585190,
-  1570090,
-  1266230,
-  1483070,
-  1557320,
-  1403470,
-  1518160,
-  1418580,
-  1507680,
-  1417580,
-  1288050,
-  1403510,
-  1685160,
-  1666220,
-  1680820,
-  1674450,
-  1680850,
-  1618400,
-  1245180,
-  711860,
-  323410,
-  409552,
-  1233280,
-  1233340,
-  977360,
-  1597370,
-  1244510,
-  435910,
-  949250,
-  489530,
-  461150,
-  686430,
-  395460,
-  405260,
-  469520,
-  1322020,
-  1055410,
-  1340280,
-  1227310,
-  1501590,
-  1654540,
-  1496360,
-  1511470,
-  1664560,
-  1496630,
-  1636670,
-  1275740,
-  1667940,
-  1401190,
-  1629800,
-  1367150,
-  1675890,
-  1243000,
-  1325690,
-  1660030,
-  1247380,
-  1266580,
-  1643930,
-  1567130,
-  1654430,
-  1268130,
-  1376680,
-  1664700,
-  1660100,
-  1619140,
-  1611210,
-  1294540,
-  1651920,
-  1607120,
-  1432530,
-  1674460,
-  1280510,
-  1655760,
-  714170,
-  893130,
-  328230,
-  497890,
-  698760,
-  1364650,
-  353850,
-  1323320,
-  1659290,
-  343720,
-  1641640,
-  1404590,
-  359890,
-  1375100,
-  788060,
-  1325700,
-  1071480,
-  1611250,
-  1611240,
-  1611230,
-  1611220,
-  1611200,
-  1611190,
-  1611180,
-  1451790,
-  1665470,
-  1663830,
-  1663820,
-  1246090,
-  1253530,
-  964590,
-  619710,
-  1631840,
-  721410,
-  1110800,
-  1364550,
-  526860,
-  1231610,
-  1608510,
-  740370,
-  1173030,
-  1554351,
-  1671270,
-  1669250,
-  1634930,
-  1441700,
-  1422310,
-  449360,
-  1666550,
-  1335190,
-  1647180,
-  1335150,
-  1653690,
-  1643810,
-  1032190,
-  1396570,
-  1396410,
-  1431260,
-  1169811,
-  1653940,
-  1651100,
-  1142840,
-  536590,
-  1451260,
-  340080,
-  1655070,
-  1665720,
-  1634610,
-  1128580,
-  1517950,
-  1658330,
-  1658340,
-  1670000,
-  1241600,
-  1640740,
-  1335110,
-  1517910,
-  1377880,
-  1522780,
-  1335170,
-  1442180,
-  1643140,
-  1455240,
-  1643410,
-  1535380,
-  1626320,
-  1465320,
-  1506800,
-  1426680,
-  301600,
-  681700,
-  1176120,
-  717630,
-  580700,
-  1650030,
-  1283530,
-  1052530,
-  1150060,
-  800740,
-  736320,
-  730210,
-  1544200,
-  1626660,
-  1638180,
-  1532730,
-  1652570,
-  519070,
-  1224440,
-  442090,
-  1224060,
-  1507370,
-  1403620,
-  1608790,
-  1190680,
-  1240760,
-  1103370,
-  1320820,
-  1117610,
-  1456310,
-  1658060,
-  1288780,
-  1292200,
-  107104,
-  1533100,
-  1650510,
-  1408640,
-  1636330,
-  1623980,
-  1643360,
-  1652440,
-  1506670,
-  1651270,
-  1647130,
-  1634580,
-  1634570,
-  1607230,
-  1631520,
-  1585620,
-  1232080,
-  1555370,
-  1640530,
-  1630870,
-  1607690,
-  1243190,
-  1223950,
-  1238270,
-  1608300,
-  1624810,
-  1604990,
-  1630410,
-  453020,
-  1204590,
-  1389290,
-  1230380,
-  1506700,
-  659970,
-  1362370,
-  1463770,
-  1600850,
-  1587310,
-  1335160,
-  1556620,
-  1403540,
-  1607830,
-  1389940,
-  1648220,
-  1265180,
-  1265190,
-  1629580,
-  1452640,
-  1449740,
-  1629280,
-  1648850,
-  1642200,
-  1053800,
-  802860,
-  821030,
-  538460,
-  1623810,
-  1642770,
-  1257770,
-  1617470,
-  1370190,
-  1640280,
-  1611630,
-  1585010,
-  1244550,
-  1642380,
-  1642900,
-  1620630,
-  1605800,
-  1346520,
-  1286630,
-  1537790,
-  946940,
-  1640680,
-  733400,
-  463190,
-  378061,
-  1046420,
-  200496,
-  1077070,
-  20828,
-  433640,
-  1060200,
-  458530,
-  1621700,
-  940010,
-  1236370,
-  1606170,
-  1607540,
-  1630150,
-  1407360,
-  1315600,
-  1568770,
-  1635860,
-  1278250,
-  1460270,
-  1617720,
-  1627500,
-  1302900,
-  1600920,
-  1497260,
-  1575600,
-  1385400,
-  1609920,
-  1629120,
-  1632460,
-  1585110,
-  1237160,
-  1567470,
-  950430,
-  950680,
-  736090,
-  578680,
-  1065150,
-  712900,
-  361440,
-  810530,
-  316360,
-  745160,
-  1060642,
-  1622730,
-  1612740,
-  776650,
-  1625660,
-  1574430,
-  1496160,
-  1621730,
-  1432040,
-  1416470,
-  1266130,
-  1454460,
-  1440820,
-  1374520,
-  1519430,
-  1617260,
-  1557370,
-  1519500,
-  1612940,
-  1627020,
-  1519510,
-  1423800,
-  1618370,
-  1608390,
-  1628380,
-  1629410,
-  846100,
-  943240,
-  945780,
-  201809,
-  802980,
-  409210,
-  1410720,
-  914540,
-  1574460,
-  1485930,
-  1594770,
-  1602720,
-  1316080,
-  1291760,
-  735330,
-  1225310,
-  657270,
-  656760,
-  656810,
-  657360,
-  657361,
-  536520,
-  1232520,
-  1573000,
-  997620,
-  497690,
-  860140,
-  947820,
-  359760,
-  1577220,
-  1389060,
-  1618950,
-  1614630,
-  1489750,
-  1285220,
-  1432030,
-  1342460,
-  1218160,
-  1239511,
-  1239512,
-  1239513,
-  1239514,
-  567070,
-  608720,
-  869140,
-  488520,
-  797370,
-  739640,
-  554780,
-  331620,
-  846420,
-  846421,
-  1619090,
-  715970,
-  385670,
-  1594930,
-  1103240,
-  819390,
-  1367140,
-  1133290,
-  721870,
-  367090,
-  1451330,
-  1576520,
-  1599100,
-  1584260,
-  1287300,
-  1578140,
-  1593000,
-  1614760,
-  1562280,
-  1239210,
-  1594820,
-  1595080,
-  1562570,
-  1587150,
-  1602270,
-  1342440,
-  1455860,
-  1366090,
-  941440,
-  368920,
-  376230,
-  1235660,
-  1235670,
-  1236210,
-  1452390,
-  975530,
-  817090,
-  744870,
-  1482570,
-  1420550,
-  509050,
-  451290,
-  992770,
-  1402910,
-  1248050,
-  1454920,
-  1568840,
-  1606220,
-  1439060,
-  1599840,
-  1568640,
-  1585550,
-  1567150,
-  1259250,
-  490260,
-  1031420,
-  1031421,
-  1261380,
-  1568690,
-  1382550,
-  955780,
-  1419810,
-  1510220,
-  1550670,
-  1335140,
-  1436020,
-  1376900,
-  1496480,
-  1604330,
-  1105380,
-  819111,
-  819110,
-  819112,
-  956900,
-  1115480,
-  1185640,
-  1108330,
-  623720,
-  1063880,
-  770330,
-  888390,
-  1292780,
-  673090,
-  623710,
-  543250,
-  578070,
-  512880,
-  1145920,
-  802640,
-  1590960,
-  1225630,
-  1426710,
-  1599350,
-  1547180,
-  1419470,
-  1205230,
-  1579520,
-  1442060,
-  1599500,
-  1592350,
-  778020,
-  1381180,
-  1589310,
-  1568830,
-  1568850,
-  1568860,
-  1591390,
-  1588320,
-  1582690,
-  1568870,
-  1585770,
-  1553040,
-  1576100,
-  1597860,
-  1480100,
-  1594070,
-  1549790,
-  1593580,
-  1583860,
-  1187810,
-  612330,
-  1065221,
-  753700,
-  767220,
-  753710,
-  860690,
-  1559030,
-  1213320,
-  520190,
-  1596280,
-  1280520,
-  1126650,
-  1589620,
-  862070,
-  506080,
-  1506050,
-  1334030,
-  1256620,
-  793040,
-  1220050,
-  959840,
-  829690,
-  667090,
-  1237230,
-  1127590,
-  1587730,
-  1456160,
-  1555000,
-  1407290,
-  1564990,
-  1555010,
-  1579080,
-  1327700,
-  1529450,
-  1573490,
-  1239170,
-  1332640,
-  1551790,
-  1585600,
-  1590510,
-  1374190,
-  1225390,
-  1239890,
-  328110,
-  1338400,
-  1592800,
-  933020,
-  867070,
-  1247980,
-  1012810,
-  1156340,
-  1266010,
-  1188210,
-  874520,
-  1266020,
-  1572160,
-  1324660,
-  1452930,
-  1586060,
-  1254030,
-  1583250,
-  1382560,
-  1284520,
-  1579960,
-  1572280,
-  1365440,
-  1522380,
-  1579220,
-  1573600,
-  1557750,
-  911610,
-  1010210,
-  1266520,
-  1521440,
-  1376240,
-  1223800,
-  1257420,
-  1156390,
-  1128250,
-  1165240,
-  584790,
-  1533930,
-  1157590,
-  1580110,
-  971600,
-  425440,
-  1333010,
-  848970,
-  638090,
-  1330601,
-  1231960,
-  1546780,
-  1520450,
-  1419080,
-  1303880,
-  1571410,
-  1239390,
-  1539440,
-  1265840,
-  1238200,
-  1342650,
-  1535440,
-  1560290,
-  942070,
-  1452560,
-  1356570,
-  991870,
-  544150,
-  1237770,
-  1314720,
-  504510,
-  408050,
-  409470,
-  1232740,
-  608620,
-  1518500,
-  1228580,
-  1224240,
-  1227410,
-  1227420,
-  1375610,
-  1346040,
-  1558540,
-  1443110,
-  1241640,
-  1238570,
-  487240,
-  1545300,
-  1299050,
-  1319050,
-  1557920,
-  1484450,
-  1556900,
-  1244840,
-  1548470,
-  1573050,
-  1501670,
-  1257450,
-  1515510,
-  924330,
-  1270120,
-  453400,
-  698890,
-  584380,
-  584382,
-  768950,
-  1334490,
-  800150,
-  1158340,
-  1231250,
-  713690,
-  1359200,
-  1130960,
-  747140,
-  1556510,
-  1173570,
-  1431010,
-  1500630,
-  1436520,
-  1548720,
-  1310920,
-  401270,
-  1245190,
-  1565460,
-  1286440,
-  1252140,
-  1284910,
-  1476670,
-  1569600,
-  1251660,
-  1561690,
-  1285980,
-  1249650,
-  449920,
-  1553050,
-  1253560,
-  1423560,
-  1545950,
-  1547510,
-  1350460,
-  1103910,
-  1295830,
-  1234270,
-  1029810,
-  506910,
-  1553620,
-  1466330,
-  257020,
-  698430,
-  698510,
-  1499170,
-  1549880,
-  1520960,
-  1402690,
-  1544770,
-  1383530,
-  1548140,
-  1535860,
-  1445770,
-  1460890,
-  1545630,
-  1555360,
-  1562530,
-  1247140,
-  1548710,
-  1423550,
-  1553860,
-  1260270,
-  1562350,
-  1477620,
-  587990,
-  1236230,
-  1232350,
-  988620,
-  988621,
-  888820,
-  1517040,
-  1245880,
-  1560810,
-  1236260,
-  1165050,
-  1003790,
-  936120,
-  1539850,
-  1552910,
-  1238290,
-  1545760,
-  1385860,
-  1522390,
-  1554930,
-  1558520,
-  1088280,
-  694510,
-  910931,
-  1512670,
-  1482560,
-  1267060,
-  639700,
-  317890,
-  548850,
-  1327730,
-  1254340,
-  1453810,
-  1546610,
-  1413510,
-  1554900,
-  1554880,
-  1548460,
-  789870,
-  1500560,
-  1272810,
-  1239830,
-  1532500,
-  1207660,
-  1466730,
-  1494020,
-  1231160,
-  1190950,
-  1406010,
-  529050,
-  1415350,
-  1523910,
-  1210950,
-  1473860,
-  1101160,
-  1534560,
-  624840,
-  1537860,
-  1499910,
-  1492760,
-  1494820,
-  1452090,
-  1500770,
-  1545400,
-  1105060,
-  1543180,
-  1501220,
-  1548080,
-  1548100,
-  1316710,
-  1263260,
-  1472670,
-  220822,
-  323140,
-  1445460,
-  1346590,
-  1532470,
-  1519700,
-  1527440,
-  1510080,
-  1457860,
-  466390,
-  1467150,
-  1475640,
-  1238590,
-  1458060,
-  1434530,
-  1027920,
-  1202450,
-  1202460,
-  798540,
-  1294560,
-  1516800,
-  1534210,
-  413720,
-  1498920,
-  1526830,
-  1458240,
-  1291360,
-  1311600,
-  1535600,
-  1507460,
-  1521540,
-  1522060,
-  1377960,
-  1380030,
-  1516230,
-  1487310,
-  1374420,
-  1495520,
-  701060,
-  387160,
-  1231870,
-  1207350,
-  540220,
-  723340,
-  258990,
-  258991,
-  1113040,
-  790010,
-  1384780,
-  1196730,
-  942980,
-  1527340,
-  1525300,
-  1515360,
-  1310060,
-  1379440,
-  1410220,
-  1495980,
-  1455330,
-  445890,
-  1527760,
-  1046190,
-  1354350,
-  1524480,
-  1008360,
-  847750,
-  1469790,
-  813510,
-  1277680,
-  1316780,
-  1452750,
-  1478110,
-  1516270,
-  1475060,
-  1361340,
-  652440,
-  1280050,
-  1167840,
-  335170,
-  383140,
-  1159270,
-  1160350,
-  788400,
-  510800,
-  424950,
-  419210,
-  704710,
-  1474920,
-  399110,
-  1467710,
-  1521710,
-  1418240,
-  1274660,
-  1508700,
-  1277550,
-  1495150,
-  1451390,
-  1388680,
-  1247150,
-  1447370,
-  1518290,
-  1495030,
-  228600,
-  1357470,
-  1171380,
-  1216830,
-  1244070,
-  445380,
-  1477350,
-  1318270,
-  492480,
-  1056730,
-  817260,
-  390630,
-  1306140,
-  1452590,
-  1496140,
-  441950,
-  1465760,
-  1501630,
-  1455820,
-  1346510,
-  1505660,
-  1275730,
-  1122540,
-  285370,
-  491290,
-  1332560,
-  1384140,
-  1352940,
-  1426690,
-  1511430,
-  1469210,
-  1439050,
-  1413200,
-  1499760,
-  1501070,
-  1483170,
-  1486770,
-  1495750,
-  1507540,
-  1500640,
-  1511420,
-  387921,
-  1225960,
-  1358680,
-  557470,
-  1080230,
-  853270,
-  643390,
-  1498260,
-  1106260,
-  1252260,
-  1250110,
-  1250710,
-  1231080,
-  1197470,
-  1413380,
-  1484300,
-  1430300,
-  1484330,
-  1499440,
-  1484350,
-  1494590,
-  1254730,
-  1484370,
-  1484380,
-  1494620,
-  1484390,
-  1483120,
-  1488260,
-  1484430,
-  1484440,
-  1484460,
-  1496010,
-  1498610,
-  980550,
-  629830,
-  426580,
-  947800,
-  933790,
-  206450,
-  1428000,
-  1163780,
-  1019360,
-  1271780,
-  1490720,
-  1498390,
-  1464890,
-  1440920,
-  1379100,
-  1364770,
-  1364790,
-  1489790,
-  1477340,
-  1426670,
-  1426650,
-  1282750,
-  1485040,
-  1480200,
-  712720,
-  1459350,
-  1406380,
-  1041000,
-  630380,
-  1465840,
-  1453120,
-  1381220,
-  1480550,
-  1236610,
-  1249990,
-  1488870,
-  1438970,
-  1366460,
-  1481130,
-  1337950,
-  1459420,
-  355890,
-  1472000,
-  1484590,
-  1439810,
-  1418070,
-  1404290,
-  1471370,
-  1467100,
-  1487070,
-  1445350,
-  1425650,
-  1004340,
-  1019660,
-  733200,
-  919100,
-  1475790,
-  1270290,
-  1282870,
-  1434690,
-  1455940,
-  1469770,
-  1460060,
-  1488770,
-  1425570,
-  1245400,
-  1253340,
-  1252080,
-  1047880,
-  1208060,
-  432630,
-  687570,
-  696230,
-  1327300,
-  804030,
-  1473310,
-  680910,
-  1385470,
-  1459110,
-  1418150,
-  1390660,
-  1471340,
-  1314490,
-  1293500,
-  1463520,
-  398911,
-  1457770,
-  1339320,
-  1031450,
-  1464070,
-  1313180,
-  1368370,
-  1232780,
-  1431670,
-  1050360,
-  1456890,
-  911080,
-  1470500,
-  1467510,
-  1454610,
-  1445390,
-  536850,
-  1395050,
-  543210,
-  1058900,
-  1291620,
-  1420030,
-  1458160,
-  1411680,
-  1335080,
-  1321360,
-  583810,
-  1466670,
-  1464230,
-  1293580,
-  452470,
-  1446820,
-  823300,
-  578560,
-  312340,
-  262141,
-  1279530,
-  1291920,
-  1456670,
-  1438070,
-  323130,
-  209373,
-  1379180,
-  1444500,
-  1447680,
-  1229550,
-  1425150,
-  1445160,
-  1262810,
-  1330350,
-  570930,
-  1248690,
-  1463990,
-  1461380,
-  1450470,
-  912540,
-  1048910,
-  1453830,
-  1224190,
-  1180160,
-  1239780,
-  1045031,
-  1342580,
-  903460,
-  1278740,
-  1283150,
-  1441490,
-  1441030,
-  1441510,
-  1384340,
-  1442340,
-  882800,
-  1275900,
-  1450510,
-  459851,
-  1442541,
-  1399420,
-  1452140,
-  1342450,
-  1426000,
-  355450,
-  355440,
-  1358040,
-  1430370,
-  1459680,
-  1342980,
-  1347740,
-  1431820,
-  1442370,
-  1441820,
-  1451850,
-  716930,
-  1454810,
-  1403070,
-  1452570,
-  1445450,
-  1270860,
-  1114010,
-  1108260,
-  924331,
-  924332,
-  1446760,
-  1050460,
-  1454070,
-  3838,
-  1432790,
-  1451910,
-  436790,
-  1420360,
-  1442420,
-  1396040,
-  1437310,
-  1364590,
-  1390610,
-  1449870,
-  1434570,
-  1434590,
-  1403880,
-  1434580,
-  1434560,
-  1434600,
-  1430000,
-  1187360,
-  1415970,
-  988320,
-  1447930,
-  1390100,
-  503800,
-  788580,
-  1406220,
-  1368090,
-  1331520,
-  1422920,
-  1246990,
-  1450630,
-  1428890,
-  1279840,
-  1427310,
-  1239310,
-  1426020,
-  1320540,
-  1381800,
-  1415340,
-  1445380,
-  1427430,
-  1406230,
-  1442600,
-  1380550,
-  1412450,
-  390580,
-  1224550,
-  1117720,
-  1407700,
-  645890,
-  1370930,
-  1226040,
-  1436690,
-  1375590,
-  1347990,
-  550710,
-  510530,
-  349740,
-  1344850,
-  1429090,
-  1402560,
-  462170,
-  1286800,
-  1251420,
-  1426510,
-  1424580,
-  1411610,
-  1373340,
-  640360,
-  1266740,
-  1423510,
-  712201,
-  692510,
-  1391480,
-  415070,
-  414250,
-  419050,
-  1435290,
-  1417510,
-  1435050,
-  1391440,
-  1388180,
-  1314360,
-  1096320,
-  468280,
-  1265700,
-  918150,
-  1425210,
-  1425290,
-  1408690,
-  1229630,
-  1383710,
-  1386613,
-  1386614,
-  1386615,
-  1233500,
-  971930,
-  823220,
-  1413620,
-  1388630,
-  1410900,
-  1009140,
-  1225620,
-  1382140,
-  520641,
-  1422070,
-  1250830,
-  887200,
-  1241210,
-  1265450,
-  1216070,
-  321990,
-  629330,
-  693170,
-  1381860,
-  627370,
-  926800,
-  1421500,
-  465980,
-  1395140,
-  1420670,
-  1374710,
-  268090,
-  299240,
-  1395130,
-  1250140,
-  1346140,
-  1382040,
-  596460,
-  756180,
-  1341590,
-  732790,
-  770950,
-  548831,
-  548821,
-  535971,
-  570481,
-  578281,
-  516331,
-  1329070,
-  1161450,
-  661710,
-  1297850,
-  1267880,
-  955182,
-  1355890,
-  414620,
-  331520,
-  1299740,
-  1342510,
-  924170,
-  1077610,
-  1364190,
-  1346150,
-  1350750,
-  1330450,
-  973370,
-  1385010,
-  1413280,
-  950200,
-  1032390,
-  1401180,
-  1397320,
-  1252590,
-  1410010,
-  1395110,
-  645610,
-  1216180,
-  1408330,
-  1218240,
-  1225480,
-  1225490,
-  1280870,
-  1225470,
-  1400590,
-  408360,
-  1355080,
-  837840,
-  459790,
-  1406450,
-  812530,
-  1284040,
-  1402330,
-  1110660,
-  421950,
-  912470,
-  296170,
-  356831,
-  1243070,
-  1381140,
-  489590,
-  1264810,
-  1247300,
-  958870,
-  1008670,
-  1319580,
-  509120,
-  774871,
-  1392160,
-  1364520,
-  1405510,
-  1231320,
-  1349580,
-  1379720,
-  1381920,
-  1381910,
-  1381900,
-  1361030,
-  224763,
-  649020,
-  1382930,
-  1382740,
-  1109860,
-  453260,
-  622400,
-  898420,
-  1389770,
-  885040,
-  418600,
-  1354290,
-  1391230,
-  1239640,
-  1331280,
-  1332700,
-  1366050,
-  1382780,
-  1095720,
-  507020,
-  1382760,
-  1389220,
-  1360020,
-  1347270,
-  749190,
-  1379690,
-  1377730,
-  1374620,
-  1378600,
-  1384860,
-  1377670,
-  1226870,
-  1253790,
-  1231010,
-  720110,
-  1383950,
-  584180,
-  806630,
-  1385000,
-  1384240,
-  1375600,
-  837910,
-  1089320,
-  1295110,
-  1382820,
-  1379420,
-  587660,
-  1380580,
-  1223830,
-  1328690,
-  643650,
-  633980,
-  1378740,
-  1356980,
-  1124140,
-  1066320,
-  1128790,
-  1063270,
-  1080000,
-  221829,
-  1370740,
-  1335070,
-  460280,
-  455370,
-  556500,
-  1367400,
-  979730,
-  938430,
-  1310280,
-  1318380,
-  1281210,
-  729020,
-  407920,
-  1357730,
-  1344060,
-  1264860,
-  895800,
-  272100,
-  882550,
-  1370240,
-  1346880,
-  1346050,
-  1358240,
-  1373490,
-  1373480,
-  225270,
-  1337570,
-  1302380,
-  1369020,
-  558140,
-  471870,
-  1308070,
-  600590,
-  946530,
-  1353770,
-  1352360,
-  712920,
-  1329580,
-  1368380,
-  1360540,
-  523690,
-  384270,
-  1165650,
-  1218960,
-  1309310,
-  375160,
-  1336740,
-  604430,
-  1330130,
-  979280,
-  408590,
-  699290,
-  537670,
-  1359460,
-  445680,
-  649250,
-  1136300,
-  1138430,
-  1363110,
-  1363100,
-  1363070,
-  1363060,
-  1345970,
-  303780,
-  459210,
-  1335130,
-  937830,
-  1357910,
-  1276380,
-  1111550,
-  1199210,
-  1313710,
-  1323360,
-  1308900,
-  1335120,
-  1319410,
-  1166720,
-  1116970,
-  1245100,
-  1342680,
-  442820,
-  1280400,
-  972360,
-  1340070,
-  1334770,
-  1287990,
-  1349480,
-  1295890,
-  1295100,
-  1341180,
-  1339060,
-  1345840,
-  1302410,
-  1343530,
-  1343000,
-  1290730,
-  1341380,
-  1026090,
-  1289110,
-  1302210,
-  1232910,
-  1094750,
-  605030,
-  1108930,
-  1346930,
-  1347830,
-  532730,
-  444390,
-  1335980,
-  682240,
-  1056250,
-  1340750,
-  1334480,
-  1348650,
-  1295880,
-  1329380,
-  665460,
-  1258170,
-  1336270,
-  1313690,
-  1332230,
-  1318360,
-  1233080,
-  1226650,
-  1327240,
-  1251810,
-  1078100,
-  1298650,
-  1335990,
-  432800,
-  1304020,
-  1315260,
-  586070,
-  1309930,
-  1313380,
-  1289710,
-  1336390,
-  1249050,
-  1266000,
-  527010,
-  942170,
-  1322320,
-  1332020,
-  1316350,
-  1311820,
-  1312530,
-  1289460,
-  1325940,
-  1315970,
-  1329020,
-  889350,
-  1287780,
-  1313300,
-  1330910,
-  1316250,
-  566710,
-  907480,
-  1225340,
-  1229350,
-  1290030,
-  1304190,
-  1314850,
-  771640,
-  822093,
-  744990,
-  1107220,
-  1300990,
-  203733,
-  1314440,
-  1292890,
-  1284270,
-  1094200,
-  733080,
-  443660,
-  443740,
-  443670,
-  1292231,
-  1298780,
-  351430,
-  517050,
-  435810,
-  316680,
-  1237420,
-  1248310,
-  846360,
-  1319000,
-  1317380,
-  1147290,
-  1252890,
-  1170240,
-  346480,
-  1316450,
-  1298030,
-  1295120,
-  1126250,
-  1297410,
-  1284500,
-  1172610,
-  602330,
-  682760,
-  681560,
-  297550,
-  1308640,
-  929130,
-  273290,
-  1293590,
-  1195750,
-  1294610,
-  544980,
-  1146260,
-  429920,
-  1290660,
-  1249100,
-  1280800,
-  1278590,
-  428400,
-  1281110,
-  1306130,
-  1306120,
-  1298940,
-  1284310,
-  1068760,
-  1224260,
-  1287720,
-  893982,
-  1007250,
-  577930,
-  1066101,
-  1133160,
-  1286750,
-  1284250,
-  731130,
-  1252180,
-  1290840,
-  954690,
-  1282980,
-  1292590,
-  1261560,
-  1194020,
-  1282030,
-  1276560,
-  1280170,
-  1164090,
-  1265560,
-  1288520,
-  1277540,
-  1289360,
-  434350,
-  714760,
-  1011020,
-  1276050,
-  577810,
-  1285680,
-  1262220,
-  809930,
-  1106960,
-  1249570,
-  1286290,
-  1285290,
-  1275950,
-  468020,
-  532000,
-  550382,
-  550381,
-  1268980,
-  368820,
-  433020,
-  1268610,
-  470000,
-  372140,
-  914310,
-  550380,
-  530490,
-  1288860,
-  441910,
-  441260,
-  1179380,
-  858800,
-  442101,
-  442100,
-  903120,
-  1025280,
-  1274680,
-  1278280,
-  1269360,
-  1229140,
-  362900,
-  508270,
-  1181630,
-  1158080,
-  1176900,
-  1267460,
-  1274950,
-  1276030,
-  203060,
-  1255280,
-  1261050,
-  267720,
-  1280830,
-  1252700,
-  944240,
-  1260290,
-  1238790,
-  1248040,
-  1262480,
-  1264150,
-  1256910,
-  916280,
-  396690,
-  1273030,
-  1218880,
-  397220,
-  1263270,
-  1263280,
-  1263290,
-  1263300,
-  1263310,
-  1273910,
-  357040,
-  1237030,
-  1226800,
-  1266250,
-  1273850,
-  1270770,
-  898330,
-  1015460,
-  434840,
-  1249760,
-  1261460,
-  599890,
-  1160601,
-  1259680,
-  1085590,
-  1243800,
-  738711,
-  1261420,
-  1260260,
-  1248020,
-  1018050,
-  977000,
-  457830,
-  786870,
-  1256930,
-  1244080,
-  1242810,
-  1257680,
-  1257730,
-  566280,
-  612980,
-  566260,
-  674780,
-  1236010,
-  1224740,
-  1238350,
-  301950,
-  415320,
-  444680,
-  1242920,
-  738960,
-  1244310,
-  1060390,
-  1251180,
-  1252820,
-  598420,
-  1252340,
-  419290,
-  357800,
-  1255470,
-  1261940,
-  1239820,
-  1244250,
-  1179130,
-  284040,
-  1249020,
-  1254600,
-  1260280,
-  865701,
-  865590,
-  1251720,
-  1151850,
-  1257630,
-  1249030,
-  315520,
-  1224620,
-  1238530,
-  1241820,
-  1080480,
-  1240650,
-  1255440,
-  1154190,
-  1132700,
-  1232320,
-  1080900,
-  1245330,
-  1254910,
-  640400,
-  393400,
-  1221740,
-  917080,
-  898990,
-  1040300,
-  1110920,
-  1044710,
-  1225750,
-  1240260,
-  1085700,
-  823260,
-  916690,
-  1225030,
-  820990,
-  1233330,
-  406490,
-  1219350,
-  1224570,
-  615260,
-  425330,
-  1230960,
-  627310,
-  1071750,
-  910821,
-  910820,
-  464790,
-  865970,
-  332460,
-  3839,
-  570800,
-  572280,
-  944090,
-  1007340,
-  1246500,
-  1223710,
-  1238460,
-  848370,
-  1090550,
-  534930,
-  1173880,
-  615210,
-  755270,
-  441760,
-  669480,
-  509590,
-  1042640,
-  877950,
-  1232690,
-  1232200,
-  948590,
-  459490,
-  1207430,
-  1214390,
-  1161460,
-  1209180,
-  1212590,
-  1225190,
-  1211820,
-  1189960,
-  865960,
-  923300,
-  686880,
-  673890,
-  828200,
-  1210280,
-  845800,
-  890530,
-  1180240,
-  562891,
-  562890,
-  890610,
-  626850,
-  1075920,
-  938721,
-  579960,
-  632670,
-  862000,
-  594100,
-  632120,
-  632690,
-  820490,
-  589840,
-  1034770,
-  942100,
-  497200,
-  1003570,
-  1162810,
-  533840,
-  570450,
-  1036380,
-  1140590,
-  887430,
-  1072520,
-  1183630,
-  1225360,
-  847760,
-  1153960,
-  372660,
-  1086650,
-  575930,
-  1217240,
-  730850,
-  1241830,
-  1004540,
-  754820,
-  1092520,
-  588280,
-  630340,
-  1047710,
-  406480,
-  593430,
-  1227670,
-  351280,
-  433710,
-  415430,
-  415431,
-  419951,
-  1225000,
-  1221370,
-  558210,
-  906632,
-  906633,
-  906634,
-  906636,
-  906637,
-  906635,
-  906638,
-  556600,
-  574320,
-  1182320,
-  1242650,
-  856840,
-  432510,
-  1055650,
-  844530,
-  563670,
-  946930,
-  331550,
-  715420,
-  635580,
-  1067160,
-  1237020,
-  700180,
-  985190,
-  382190,
-  927660,
-  1195630,
-  922580,
-  1078740,
-  1009710,
-  1079360,
-  1128050,
-  765430,
-  1080720,
-  473090,
-  544760,
-  370500,
-  449950,
-  999680,
-  558190,
-  1009530,
-  395950,
-  1175410,
-  857880,
-  1215760,
-  384170,
-  925590,
-  541800,
-  399020,
-  1230580,
-  1159110,
-  1203880,
-  1172490,
-  396910,
-  865290,
-  1211770,
-  1224580,
-  1147060,
-  1180170,
-  1082330,
-  1201030,
-  824590,
-  896270,
-  837140,
-  932840,
-  1181250,
-  1197050,
-  923560,
-  1221090,
-  966130,
-  1160000,
-  1185690,
-  995040,
-  1115730,
-  891035,
-  449900,
-  449910,
-  1232390,
-  297150,
-  1244710,
-  838120,
-  1224100,
-  1236790,
-  386570,
-  1226930,
-  587820,
-  576920,
-  889440,
-  376820,
-  806460,
-  1242970,
-  493150,
-  1239290,
-  473110,
-  467870,
-  358870,
-  905210,
-  301880,
-  906630,
-  1103420,
-  1119400,
-  1224680,
-  1174080,
-  909530,
-  1167720,
-  1175110,
-  537510,
-  922740,
-  1229970,
-  449930,
-  1231700,
-  1234610,
-  1233650,
-  1159200,
-  1131130,
-  1160390,
-  1180570,
-  1090570,
-  558220,
-  1228480,
-  661140,
-  1247000,
-  426820,
-  807290,
-  633331,
-  556290,
-  706000,
-  979650,
-  753450,
-  884030,
-  558200,
-  411730,
-  577030,
-  957610,
-  844070,
-  661870,
-  650630,
-  975260,
-  1110500,
-  1131090,
-  594700,
-  760180,
-  850281,
-  1066570,
-  436420,
-  975261,
-  317350,
-  621520,
-  387170,
-  378910,
-  604890,
-  946180,
-  372510,
-  844320,
-  1062620,
-  391900,
-  743160,
-  807800,
-  380640,
-  742240,
-  407070,
-  1211900,
-  461050,
-  455560,
-  860540,
-  958250,
-  837150,
-  1082310,
-  558150,
-  1074600,
-  676150,
-  467518,
-  467517,
-  467516,
-  443440,
-  922741,
-  367640,
-  675080,
-  467600,
-  460760,
-  444610,
-  1224390,
-  639760,
-  880240,
-  970410,
-  806570,
-  943350,
-  1080430,
-  1080580,
-  909600,
-  1082070,
-  932550,
-  1103230,
-  552360,
-  823030,
-  1105180,
-  1143410,
-  854961,
-  446950,
-  659971,
-  392810,
-  808720,
-  962820,
-  989900,
-  972380,
-  1001110,
-  558160,
-  473100,
-  950580,
-  903610,
-  931740,
-  1073200,
-  1017620,
-  289540,
-  1077180,
-  1023920,
-  947910,
-  1149160,
-  418080,
-  885720,
-  900350,
-  382220,
-  948670,
-  1185771,
-  936121,
-  386760,
-  466530,
-  811230,
-  305370,
-  420810,
-  300780,
-  997040,
-  1011350,
-  917190,
-  719710,
-  285150,
-  328850,
-  473120,
-  997540,
-  906631,
-  349080,
-  666670,
-  748700,
-  859300,
-  683090,
-  579510,
-  815640,
-  707160,
-  1159570,
-  837170,
-  1080520,
-  983300,
-  909590,
-  1060610,
-  1045880,
-  1080610,
-  993590,
-  1109930,
-  348100,
-  396510,
-  786890,
-  409480,
-  452290,
-  840070,
-  890420,
-  1237650,
-  913480,
-  1026140,
-  912980,
-  1093060,
-  946130,
-  796160,
-  1020140,
-  1179470,
-  1065510,
-  515240,
-  816110,
-  1087290,
-  204075,
-  464810,
-  1141310,
-  427790,
-  534030,
-  505480,
-  684240,
-  969100,
-  927180,
-  911450,
-  347110,
-  700300,
-  1179960,
-  1197250,
-  1223690,
-  874300,
-  455030,
-  748080,
-  1115010,
-  528630,
-  1207160,
-  799710,
-  529470,
-  646420,
-  864560,
-  490310,
-  584120,
-  579090,
-  468420,
-  827340,
-  481490,
-  994740,
-  1670340,
-  739590,
-  996560,
-  1624070,
-  884110,
-  1794810,
-  412680,
-  746200,
-  380870,
-  742650,
-  774961,
-  1169370,
-  710560,
-  4940,
-  1316480,
-  1356310,
-  1088320,
-  343050,
-  294420,
-  1042420,
-  443030,
-  376030,
-  643090,
-  1207110,
-  1652070,
-  728470,
-  439660,
-  530870,
-  622970,
-  1110390,
-  1362540,
-  1222650,
-  1081770,
-  581330,
-  613220,
-  424970,
-  424980,
-  870490,
-  870500,
-  1192040,
-  460040,
-  1827330,
-  994150,
-  1064780,
-  629800,
-  1391110,
-  1047650,
-  1612970,
-  361580,
-  4020,
-  822500,
-  844650,
-  1141420,
-  1827320,
-  1624110,
-  749070,
-  1812770,
-  233780,
-  636750,
-  906940,
-  1246770,
-  1045940,
-  920720,
-  223350,
-  830640,
-  882430,
-  1665030,
-  1493710,
-  336400,
-  1502300,
-  293030,
-  339010,
-  232150,
-  232130,
-  1247090,
-  1061710,
-  1580130,
-  1822380,
-  1380950,
-  1362640,
-  523390,
-  378670,
-  475370,
-  1757540,
-  400300,
-  295230,
-  1686460,
-  1573820,
-  1830410,
-  538480,
-  222860,
-  1750680,
-  1292030,
-  17505,
-  1290,
-  232250,
-  1123110,
-  1061720,
-  1338040,
-  463690,
-  869800,
-  869810,
-  1480080,
-  326880,
-  298740,
-  1479670,
-  1336240,
-  1189160,
-  317800,
-  1690800,
-  1430110,
-  896660,
-  1722130,
-  299990,
-  1498880,
-  1393600,
-  1821720,
-  668390,
-  403240,
-  1688010,
-  1057910,
-  250820,
-  601660,
-  563,
-  734880,
-  824360,
-  1319980,
-  1811210,
-  685100,
-  673990,
-  1603250,
-  1695791,
-  282160,
-  1790530,
-  1750890,
-  568660,
-  1136190,
-  1801280,
-  1602470,
-  1613450,
-  245850,
-  943930,
-  1303430,
-  1424230,
-  33935,
-  1420710,
-  1827750,
-  651460,
-  298860,
-  228780,
-  953860,
-  1252670,
-  5,
-  762880,
-  313600,
-  582400,
-  689410,
-  526340,
-  490500,
-  312070,
-  338440,
-  377610,
-  329740,
-  764940,
-  587020,
-  447760,
-  928530,
-  863250,
-  676370,
-  1404690,
-  950290,
-  1382420,
-  1280020,
-  1035540,
-  988950,
-  736790,
-  881430,
-  763670,
-  587030,
-  864280,
-  763160,
-  764440,
-  335130,
-  590620,
-  1486110,
-  460320,
-  556320,
-  1348640,
-  562720,
-  393250,
-  723490,
-  993570,
-  1427490,
-  799780,
-  1680420,
-  1026340,
-  770340,
-  1717030,
-  1440550,
-  1664300,
-  453420,
-  790320,
-  548400,
-  1738800,
-  904240,
-  1301040,
-  945970,
-  958770,
-  896050,
-  974130,
-  897590,
-  41015,
-  789560,
-  950840,
-  696120,
-  831800,
-  967480,
-  792890,
-  748090,
-  965690,
-  248890,
-  1757500,
-  1292350,
-  791360,
-  696640,
-  598850,
-  601410,
-  1413700,
-  565060,
-  815430,
-  1475910,
-  1231430,
-  777030,
-  382280,
-  1099850,
-  525900,
-  1136460,
-  612940,
-  628300,
-  891980,
-  383820,
-  851020,
-  609870,
-  1010510,
-  1460560,
-  559440,
-  1149520,
-  699730,
-  320850,
-  1184340,
-  680020,
-  319060,
-  730200,
-  429400,
-  904280,
-  90,
-  276060,
-  345950,
-  946270,
-  111710,
-  557920,
-  871010,
-  367970,
-  237410,
-  854630,
-  661350,
-  549990,
-  827750,
-  643430,
-  988520,
-  994920,
-  610920,
-  944490,
-  848490,
-  405100,
-  1197420,
-  604270,
-  1129070,
-  1071470,
-  416880,
-  1360240,
-  840560,
-  936050,
-  311410,
-  706930,
-  774771,
-  689780,
-  222840,
-  559480,
-  930170,
-  557690,
-  844410,
-  1697660,
-  460670,
-  988290,
-  859010,
-  485250,
-  1720710,
-  550790,
-  1026440,
-  1183370,
-  1653130,
-  913290,
-  786830,
-  1086350,
-  1223310,
-  916110,
-  1418640,
-  746130,
-  493970,
-  817300,
-  638100,
-  395670,
-  1315990,
-  646040,
-  712860,
-  947870,
-  840350,
-  955040,
-  928930,
-  349090,
-  556450,
-  426660,
-  824740,
-  450980,
-  1521830,
-  220070,
-  680870,
-  564390,
-  895910,
-  989610,
-  443050,
-  1307050,
-  578220,
-  1503660,
-  1375660,
-  774061,
-  809390,
-  463280,
-  926640,
-  679600,
-  824240,
-  697520,
-  773040,
-  1297840,
-  582320,
-  553650,
-  489650,
-  989620,
-  1433270,
-  407480,
-  1663160,
-  619960,
-  730810,
-  703930,
-  684220,
-  764860,
-  402370,
-  1405890,
-  463300,
-  604100,
-  374980,
-  1279430,
-  683720,
-  1748680,
-  793290,
-  1204170,
-  1612490,
-  894410,
-  781770,
-  1003980,
-  449740,
-  1006030,
-  419790,
-  561870,
-  1110990,
-  743120,
-  892370,
-  704980,
-  672470,
-  497110,
-  630230,
-  445400,
-  563930,
-  842970,
-  395740,
-  692700,
-  332510,
-  369630,
-  929760,
-  685280,
-  755170,
-  1084900,
-  462310,
-  700390,
-  786920,
-  767210,
-  677100,
-  1075180,
-  616940,
-  714990,
-  1007,
-  476400,
-  423410,
-  713970,
-  593910,
-  734710,
-  1534710,
-  761080,
-  1170680,
-  598010,
-  934140,
-  1549820,
-  756990,
-  892670,
-  838910,
-  17585,
-  783710,
-  1816310,
-  740,
-  745,
-  317670,
-  931580,
-  660470,
-  1532190,
-  1349320,
-  1690230,
-  1435710,
-  233800,
-  1650090,
-  638380,
-  638400,
-  1018630,
-  421800,
-  1277220,
-  1810100,
-  597260,
-  404350,
-  1808290,
-  574250,
-  1624120,
-  302200,
-  1161040,
-  1718880,
-  1698830,
-  321900,
-  808040,
-  600760,
-  1017070,
-  1628350,
-  1282290,
-  229950,
-  1275530,
-  1041860,
-  839510,
-  1171790,
-  1409670,
-  1133110,
-  983360,
-  349110,
-  526760,
-  1399100,
-  950900,
-  276160,
-  17575,
-  1284600,
-  693060,
-  1220790,
-  418500,
-  1260,
-  350570,
-  1471280,
-  354060,
-  203300,
-  1758730,
-  346680,
-  354080,
-  1106760,
-  1626960,
-  648600,
-  1070560,
-  745150,
-  1574860,
-  223540,
-  227040,
-  227050,
-  912100,
-  1400890,
-  1504280,
-  12880,
-  332670,
-  513,
-  530910,
-  510,
-  313220,
-  379800,
-  1070910,
-  226470,
-  1711890,
-  41090,
-  41040,
-  1685200,
-  1339700,
-  1329140,
-  396050,
-  1136510,
-  593000,
-  1311340,
-  46390,
-  63920,
-  1366270,
-  1672540,
-  1481590,
-  243750,
-  244310,
-  255470,
-  232290,
-  232370,
-  232330,
-  1329740,
-  959190,
-  996600,
-  1613460,
-  1674390,
-  1420170,
-  1485390,
-  1485470,
-  975940,
-  904710,
-  211,
-  215,
-  218,
-  1453860,
-  663000,
-  629,
-  1645310,
-  418480,
-  379680,
-  1203110,
-  1012260,
-  228980,
-  376040,
-  390500,
-  33905,
-  1365980,
-  814090,
-  391750,
-  204350,
-  529640,
-  254430,
-  494770,
-  866060,
-  1180760,
-  1337740,
-  380880,
-  1262090,
-  1602410,
-  1602400,
-  1598000,
-  711030,
-  588870,
-  1585150,
-  1316470,
-  16830,
-  202480,
-  1215190,
-  202920,
-  202930,
-  1436120,
-  951210,
-  1255430,
-  1201660,
-  711850,
-  242150,
-  1090310,
-  602410,
-  347380,
-  316570,
-  323910,
-  605710,
-  1175740,
-  1493270,
-  266760,
-  266780,
-  482850,
-  400690,
-  482870,
-  817480,
-  343660,
-  267180,
-  295350,
-  343480,
-  679870,
-  1436110,
-  1100760,
-  295390,
-  1100770,
-  872940,
-  1536970,
-  328950,
-  379700,
-  667230,
-  1274240,
-  39580,
-  230030,
-  1527130,
-  997390,
-  983370,
-  815050,
-  664940,
-  774581,
-  1481320,
-  955080,
-  1498480,
-  716020,
-  508320,
-  976380,
-  1465960,
-  273530,
-  697840,
-  41005,
-  70004,
-  201890,
-  261660,
-  299310,
-  1336810,
-  208050,
-  41080,
-  223070,
-  564380,
-  568880,
-  257560,
-  266910,
-  1245040,
-  1441650,
-  42750,
-  1311360,
-  834190,
-  237530,
-  1284580,
-  982260,
-  1453510,
-  621240,
-  723520,
-  460300,
-  986740,
-  1339270,
-  661020,
-  1170690,
-  1173360,
-  1174160,
-  640,
-  635,
-  1408910,
-  223240,
-  223250,
-  1220,
-  1240,
-  1645,
-  8610,
-  8680,
-  302550,
-  41520,
-  57910,
-  17705,
-  1635,
-  2505,
-  1317,
-  40810,
-  9370,
-  322310,
-  70010,
-  47430,
-  1199380,
-  17515,
-  17525,
-  17535,
-  42740,
-  39570,
-  17555,
-  19970,
-  366360,
-  2460,
-  1069790,
-  2145,
-  709930,
-  985050,
-  1370890,
-  455130,
-  1356140,
-  927010,
-  298150,
-  1178410,
-  785490,
-  1107240,
-  912440,
-  847980,
-  7270,
-  986430,
-  31720,
-  619920,
-  8730,
-  4240,
-  4270,
-  1376400,
-  4480,
-  491380,
-  1013330,
-  1363640,
-  958410,
-  1354950,
-  230630,
-  3205,
-  1136920,
-  1091610,
-  1340510,
-  1136500,
-  1350520,
-  541790,
-  986750,
-  1348620,
-  1318140,
-  915070,
-  1291180,
-  805210,
-  1328700,
-  1277960,
-  218430,
-  216280,
-  979200,
-  869890,
-  951300,
-  982280,
-  741130,
-  793870,
-  737550,
-  759310,
-  857360,
-  584720,
-  726290,
-  776980,
-  745240,
-  947480,
-  879130,
-  730140,
-  672540,
-  807970,
-  852260,
-  985380,
-  963620,
-  710180,
-  723240,
-  905000,
-  891690,
-  588330,
-  649260,
-  654380,
-  707120,
-  841520,
-  991540,
-  841780,
-  750390,
-  978230,
-  740920,
-  676920,
-  551480,
-  648760,
-  1116730,
-  784700,
-  926270,
-  913470,
-  968000,
-  702530,
-  956740,
-  960840,
-  795980,
-  811600,
-  556630,
-  794200,
-  869720,
-  949850,
-  761690,
-  997980,
-  922720,
-  560480,
-  913760,
-  853090,
-  584290,
-  990820,
-  602980,
-  935780,
-  674660,
-  690020,
-  764260,
-  797030,
-  1148520,
-  749930,
-  736620,
-  878190,
-  979570,
-  1070200,
-  647800,
-  583550,
-  980350,
-  791680,
-  985220,
-  816520,
-  930190,
-  685710,
-  843150,
-  960400,
-  956050,
-  790420,
-  701590,
-  896920,
-  898970,
-  787870,
-  723870,
-  922270,
-  989600,
-  744100,
-  814500,
-  755620,
-  1229220,
-  674470,
-  667560,
-  697770,
-  773290,
-  841130,
-  761260,
-  966060,
-  1032620,
-  941230,
-  724400,
-  545460,
-  678580,
-  833460,
-  767670,
-  1032630,
-  822200,
-  977850,
-  848830,
-  684480,
-  549060,
-  733640,
-  818120,
-  633290,
-  828110,
-  584910,
-  601040,
-  930000,
-  852950,
-  928470,
-  872150,
-  685270,
-  922840,
-  559320,
-  846810,
-  724700,
-  935900,
-  595170,
-  578530,
-  962790,
-  856810,
-  546540,
-  707820,
-  981740,
-  553710,
-  965870,
-  660720,
-  793840,
-  766960,
-  684790,
-  972790,
-  921080,
-  825340,
-  934910,
-  694270,
-  705790,
-  1327530,
-  374930,
-  638500,
-  301070,
-  599310,
-  1260950,
-  1231920,
-  916500,
-  1151040,
-  382990,
-  980000,
-  360230,
-  1148800,
-  620110,
-  1113280,
-  704770,
-  297700,
-  646980,
-  1133680,
-  460090,
-  294500,
-  827740,
-  1110300,
-  545990,
-  288250,
-  224620,
-  443600,
-  1203250,
-  2860,
-  805140,
-  445900,
-  367690,
-  730150,
-  664400,
-  806890,
-  552890,
-  213040,
-  1104820,
-  617740,
-  617720,
-  1019830,
-  240580,
-  428790,
-  1171510,
-  488270,
-  488030,
-  1106190,
-  1111260,
-  907840,
-  1040760,
-  788170,
-  1144890,
-  1119550,
-  685720,
-  1139720,
-  756760,
-  1050410,
-  414570,
-  381690,
-  533830,
-  599370,
-  886440,
-  410950,
-  487710,
-  800800,
-  532330,
-  1125850,
-  599270,
-  1124820,
-  996510,
-  961940,
-  599350,
-  930400,
-  329710,
-  1116510,
-  1054830,
-  842720,
-  1023990,
-  601370,
-  840850,
-  633750,
-  595900,
-  668440,
-  346570,
-  599330,
-  692250,
-  1007130,
-  1006890,
-  354750,
-  599290,
-  599250,
-  599210,
-  599190,
-  599230,
-  919670,
-  1057350,
-  1057290,
-  624220,
-  624240,
-  683360,
-  413770,
-  22480,
-  872950,
-  563080,
-  1023620,
-  534080,
-  674720,
-  550140,
-  318620,
-  667490,
-  823850,
-  875120,
-  859550,
-  574390,
-  881600,
-  801230,
-  950080,
-  261140,
-  985230,
-  858280,
-  990120,
-  757000,
-  737560,
-  963630,
-  922730,
-  557930,
-  840570,
-  583560,
-  922850,
-  956040,
-  888520,
-  764380,
-  813520,
-  925420,
-  911720,
-  19940,
-  406800,
-  771730,
-  935620,
-  20930,
-  451330,
-  313900,
-  231220,
-  248670,
-  450970,
-  369140,
-  329720,
-  516860,
-  585650,
-  883420,
-  718610,
-  619240,
-  566110,
-  562960,
-  562980,
-  563000,
-  563020,
-  563040,
-  563060,
-  562900,
-  487940,
-  487960,
-  487780,
-  487800,
-  487820,
-  487840,
-  487860,
-  487880,
-  487900,
-  487920,
-  469960,
-  444450,
-  444510,
-  439050,
-  439070,
-  439090,
-  439110,
-  439130,
-  439150,
-  439170,
-  438990,
-  439010,
-  439030,
-  418130,
-  417280,
-  396210,
-  396220,
-  393160,
-  389380,
-  389340,
-  389350,
-  389370,
-  378200,
-  378220,
-  369170,
-  324870,
-  324890,
-  316980,
-  313540,
-  312800,
-  307400,
-  302530,
-  292640,
-  291570,
-  285710,
-  277000,
-  272320,
-  265070,
-  261020,
-  258680,
-  255190,
-  243730,
-  244270,
-  242460,
-  242480,
-  239780,
-  234740,
-  231390,
-  220600,
-  220620,
-  216840,
-  210370,
-  205860,
-  104310,
-  91720,
-  98210,
-  71400,
-  71410,
-  63220,
-  55280,
-  44720,
-  42720,
-  34850,
-  34120,
-  28110,
-  22208,
-  19890,
-  17595,
-  18112,
-  19950,
-  19960,
-  17040,
-  13260,
-  2150,
-  2770,
-  644,
-  916420,
-  11070,
-  668110,
-  821110,
-  848140,
-  653750,
-  633380,
-  628250,
-  813120,
-  739120,
-  544030,
-  432060,
-  412060,
-  382010,
-  382030,
-  380060,
-  350820,
-  319350,
-  216070,
-  43210,
-  640060,
-  759350,
-  824320,
-  691530,
-  796230,
-  786320,
-  743930,
-  754370,
-  383410,
-  42320,
-  681870,
-  615320,
-  8710,
-  96810,
-  332850,
-  310,
-  42300,
-  8770,
-  72780,
-  2403,
-  72310,
-  13180,
-  265360,
-  223160,
-  1213,
-  205,
-  1273,
-  611990,
-  591690,
-  598250,
-  532640,
-  13160,
-  245640,
-  503970,
-  25350,
-  26120,
-  25360,
-  26130,
-  90900,
-  25370,
-  540,
-  26140,
-  25380,
-  10030,
-  25390,
-  26160,
-  26170,
-  26180,
-  37709,
-  4207,
-  105610,
-  25740,
-  200340,
-  2725,
-  2740,
-  2754,
-  2755,
-  25300,
-  25310,
-  25320,
-  25330,
-  225010,
-  26100,
-  35060,
-  25340,
-  26110
-};
+#include <cstdint>
+
+// True for app IDs that are not games (apps, DLCs, music, tools) and should be skipped
+bool SKIF_Steam_isIgnorableAppID (uint32_t appid);
 
 #endif
@@ -0,0 +1,83 @@
+//
+// Copyright 2020 Andon "Kaldaien" Coleman
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+//
+
+#pragma once
+
+#include <string>
+#include <string_view>
+#include <cstdint>
+#include <vector>
+#include <initializer_list>
+
+// Text KeyValues (.acf/.vdf) parsed once into a flat tree
+//   -> Nodes refer to the text by offset, so the tree can be copied/moved freely
+//   -> Sections and keys are matched case-insensitively, like the Steam client does
+//   -> Escaped quotes and backslashes (\" and \\) in quoted strings are resolved as they are read
+//   -> Malformed input (unbalanced braces, unterminated strings) leaves the tree empty
+//   -> Parsing can be limited to a few paths of interest, see parse (text, wanted)
+class SK_Steam_KeyValueTree
+{
+public:
+  static constexpr
+    uint32_t npos = UINT32_MAX;
+
+  // Names of the sections leading up to a section or key, starting from the top level; "*" matches any name
+  using path_t = std::vector <std::string_view>;
+
+  struct node_s {
+    uint32_t key_offset   = 0;
+    uint32_t key_length   = 0;
+    uint32_t value_offset = 0;
+    uint32_t value_length = 0;
+    uint32_t first_child  = npos; // Sections only
+    uint32_t next_sibling = npos;
+    bool     section      = false;
+  };
+
+  bool             parse       (std::string text);
+
+  // Only keeps the wanted sections/keys along with the sections leading up to them, and skips over everything
+  //   else as it is read, so large files (e.g. localconfig.vdf) never materialize more than what is used
+  //   -> The text of whatever was kept is copied out, so the rest of the text does not linger in memory
+  bool             parse       (std::string text, const std::vector <path_t>& wanted);
+  void             clear       (void);
+  bool             empty       (void) const { return _nodes.empty (); }
+
+  // Sections are looked up one level at a time, starting from the top level (npos)
+  uint32_t         findChild   (uint32_t parent, std::string_view key) const;
+  uint32_t         findSection (std::initializer_list <std::string_view> path) const;
+
+  // Empty if either the section or the key does not exist
+  std::string_view getValue    (std::initializer_list <std::string_view> path, std::string_view key) const;
+
+  uint32_t         firstChild  (uint32_t parent) const { return (parent == npos) ? _first : _nodes [parent].first_child;  }
+  uint32_t         nextSibling (uint32_t node)   const { return                            _nodes [node].next_sibling;    }
+  bool             isSection   (uint32_t node)   const { return                            _nodes [node].section;         }
+
+  std::string_view key         (uint32_t node)   const { return { _text.data () + _nodes [node].key_offset,   _nodes [node].key_length   }; }
+  std::string_view value       (uint32_t node)   const { return { _text.data () + _nodes [node].value_offset, _nodes [node].value_length }; }
+
+private:
+  std::string          _text;
+  std::vector <node_s> _nodes;
+  uint32_t             _first = npos; // First node of the top level
+};
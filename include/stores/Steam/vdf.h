@@ -3,9 +3,13 @@
 #include <string>
 #include <cstdint>
 #include <vector>
+#include <span>
+#include <unordered_map>
+#include <mutex>
 #include <wtypes.h>
 //#include <steam/isteamuser.h>
 #include "app_record.h"
+#include <utility/fsutil.h>
 
 // Steamworks API definitions
 typedef unsigned __int32 uint32;
@@ -21,7 +25,13 @@ typedef uint64 UGCHandle_t;
 class skValveDataFile
 {
 public:
-  skValveDataFile (std::wstring source);
+  skValveDataFile (std::wstring source); // Maps and indexes the file
+
+  // The view keeps Steam from rewriting the file, so it should be closed once the library has been decoded
+  //   -> getAppInfo still works afterwards, by mapping the file again for the duration of the call;
+  //        the index and string table are reused as long as the size and last write time of the file are unchanged
+  bool open  (void);
+  void close (void);
 
   static constexpr
     uint32_t _LastSteamApp = 0;
@@ -64,24 +74,70 @@ public:
       using _kv_pair =
         std::pair <const char*, std::pair <_TokenOp, void *>>;
 
+      static constexpr
+        uint32_t npos = UINT32_MAX;
+
+      // Names point straight into the file (legacy) or its string table (0x29+),
+      //   the full path of a section is only known through its parents
       struct section_data_s {
-        std::string            name;
-        section_desc_s         desc;
-        std::vector <_kv_pair> keys;
+        const char*              name;
+        uint32_t                 parent;
+        uint32_t                 depth;
+        section_desc_s           desc;
+        std::span <_kv_pair>     keys;
       };
 
-      std::vector <
-        section_data_s
-      > finished_sections;
+      // Precompiled path query, e.g. { "appinfo", "config", "launch" }
+      struct path_s {
+        const char* parts [8] = { };
+        uint32_t    count     =  0;
 
-      void parse (section_desc_s& desc);
+        constexpr path_s (std::initializer_list <const char*> list)
+        {
+          for (auto part : list)
+            parts [count++] = part;
+        }
+      };
+
+      // Storage is reused between parses, so a warmed up section_s does not allocate
+      std::vector <section_data_s> sections;          // In order of appearance
+      std::vector <uint32_t>       finished_sections; // Indices, in order of completion
+      std::vector <_kv_pair>       keys;              // Grouped by section after parsing
+      std::vector <_kv_pair>       _unsorted_keys;
+      std::vector <uint32_t>       _key_owners;
+      std::vector <uint32_t>       _key_firsts;
+
+      bool parse  (section_desc_s& desc);
+      void clear  (void);
+
+      const section_data_s&
+           at     (uint32_t idx) const { return sections [idx]; }
+
+      // Exact match
+      bool is     (const section_data_s& sec, const path_s& path) const;
+      // The section itself or any section nested within it
+      bool within (const section_data_s& sec, const path_s& path) const;
+      // Only sections nested within it
+      bool under  (const section_data_s& sec, const path_s& path) const;
+
+      const section_data_s*
+           ancestor (const section_data_s& sec, uint32_t depth) const;
+      std::string
+           getPath  (const section_data_s& sec, uint32_t first_depth = 0) const;
     };
 
     void*      getRootSection (size_t* pSize = nullptr);
     appinfo_s* getNextApp     (void);
   };
 
-  appinfo_s* getAppInfo ( uint32_t     appid, std::vector <std::pair < std::string, app_record_s > > *apps );
+  // False if the app was not decoded (already processed, not in the file, or malformed)
+  bool       getAppInfo  ( uint32_t     appid, std::vector <std::pair < std::string, app_record_s > > *apps );
+  bool       getAppInfo  ( uint32_t     appid, app_record_s* pAppRecord );
+  appinfo_s* findAppInfo ( uint32_t     appid ); // Only while the file is open
+
+  // Decodes all unprocessed Steam apps across all cores and returns how many were decoded;
+  //   the vector must not be resized meanwhile
+  size_t     getAppInfoParallel ( std::vector <std::pair < std::string, app_record_s > > *apps );
 
   struct header_s
   {
@@ -103,10 +159,28 @@ public:
   str_tbl_s* table = nullptr;
 
 protected:
+  // Offset/size of a single app's record within the file, validated once
+  struct app_index_s
+  {
+    size_t offset;
+    size_t size;
+  };
+
+  void buildIndex    (void);
+  bool openView      (void);
+  void closeView     (void);
+  bool decodeAppInfo (uint32_t appid, app_record_s* pAppRecord);
+
 private:
   std::wstring          path;
-  std::vector <BYTE>   _data;
-  std::vector <char *>  strs; // Preparsed array of pointers
+  SK_MappedFile        _data; // Read-only view of the file, nothing is copied
+  std::vector <size_t>  strs; // Preparsed offsets of the strings, relative to the string table
+  std::unordered_map <
+    AppId_t, app_index_s
+  >                    _index; // appid -> record, built whenever the file has changed since it was last mapped
+  uint64_t             _size  = 0; // Size and last write time of the file that was indexed
+  uint64_t             _mtime = 0;
+  std::mutex           _lock;  // Guards the view; held by getAppInfoParallel for all of its workers
 };
 
 #pragma pack(pop)
\ No newline at end of file
@@ -0,0 +1,77 @@
+//
+// Copyright 2020 Andon "Kaldaien" Coleman
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+//
+
+#pragma once
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+#include <stores/Steam/app_record.h>
+
+// Apps are identified by their store along with a store key: the AppName for Epic, the package name
+//   for Xbox, and the app ID for everything else (the same key db.json and lc.json use)
+std::string SKIF_AppKey_GetKey  (const app_record_s& app);
+
+// Deterministic 64-bit ID of a store key (FNV-1a), which unlike std::hash is the same across builds and sessions
+uint64_t    SKIF_AppKey_Hash    (app_record_s::Store store, std::string_view key);
+uint64_t    SKIF_AppKey_Hash    (const app_record_s& app);
+
+// 32-bit app ID for the stores that identify apps by name (Epic, Xbox), folded from SKIF_AppKey_Hash
+//   -> Never 0, as that is used to signal an invalid app
+//   -> Only used for app_record_s::id (selection, ImGui IDs); two names may fold to the same ID,
+//        so anything that has to tell apps apart matches on the store key instead
+uint32_t    SKIF_AppKey_ToAppId (uint64_t hash);
+
+// Store keys of an app list mapped to positions in that list, built for a single pass over the list
+//   (deduplicating a scan, or matching a scan against the current library) and thrown away afterwards
+//   -> Lookups go through the 64-bit ID of the key, and only compare the key itself to rule out collisions
+//   -> The keys are copied into the table, so it stays valid while the apps themselves are moved around
+class SKIF_AppKeyTable
+{
+public:
+  static constexpr size_t npos = static_cast <size_t> (-1);
+
+  void     reserve (size_t count);
+  void     clear   (void);
+  size_t   size    (void) const { return _entries.size (); }
+
+  // False if the key of the app is already in the table, in which case index is left as is
+  bool     insert  (const app_record_s& app, size_t index);
+
+  size_t   find    (const app_record_s& app) const;
+  size_t   find    (app_record_s::Store store, std::string_view key) const;
+
+private:
+  struct entry_s {
+    app_record_s::Store store;
+    std::string         key;
+    uint64_t            hash  = 0;
+    size_t              index = npos;
+  };
+
+  size_t   lookup  (app_record_s::Store store, std::string_view key, uint64_t hash) const;
+
+  std::vector             <entry_s>          _entries;
+  std::unordered_multimap <uint64_t, size_t> _by_hash; // ID -> entry; only holds more than one entry per ID on a collision
+};
@@ -9,11 +9,17 @@
 #include <d3d11.h>
 #include <vector>
 #include <atomic>
+#include <memory>
+#include <mutex>
+#include <shared_mutex>
+#include <string_view>
+#include <unordered_set>
 
 #include "Steam/app_record.h"
 #include <imgui/imgui.h>
 
 #include "DirectXTex.h"
+#include <utility/fsutil.h>
 
 enum class LibraryTexture
 {
@@ -41,3 +47,103 @@ LoadLibraryTexture (
       //ImVec2&                             vCoverUv0,
       //ImVec2&                             vCoverUv1,
         app_record_s*                       pApp = nullptr);
+
+struct SKIF_DirectoryChangeWatch;
+
+// In-memory index of all files below <userdata>\Assets\, built with a single
+//   directory enumeration and then kept up to date with the changes the folder reports
+struct SKIF_AssetIndex
+{
+  // Relative to the Assets folder, e.g. LR"(Steam\620\cover.png)"
+  bool                exists   (std::wstring_view relative_path);
+
+  // Change notifications arrive asynchronously, so SKIF reports the assets it writes or deletes itself
+  //   through this right away; full path, the file system is checked for whether it exists
+  void                update   (const std::wstring& path);
+
+  // Picks up any changes reported by the directory watch since the last call
+  void                refresh  (void);
+
+  const std::wstring& getRoot  (void) const { return m_root; }
+
+  SKIF_AssetIndex (SKIF_AssetIndex const&) = delete; // Delete copy constructor
+  SKIF_AssetIndex (SKIF_AssetIndex&&)      = delete; // Delete move constructor
+
+  static SKIF_AssetIndex& GetInstance (void)
+  {
+      static SKIF_AssetIndex instance;
+      return instance;
+  }
+
+private:
+  SKIF_AssetIndex  (void);
+  ~SKIF_AssetIndex (void);
+
+  void rebuild     (void);
+
+  std::shared_mutex                           m_lock;
+  std::unordered_set <std::wstring>           m_files; // Lower case
+  std::unique_ptr <SKIF_DirectoryChangeWatch> m_watch;
+  std::wstring                                m_root;
+  bool                                        m_watching = false;
+};
+
+struct SKIF_AssetMatch
+{
+  std::wstring path;              // Full path
+  bool         isCustom  = false; // Provided by the user
+  bool         isManaged = false; // Can be refreshed by SKIF
+};
+
+// Finds the asset to use from the folder of an app below Assets\ (e.g. LR"(Steam\620\)"),
+//   following the order of precedence laid out by the asset rule table
+bool
+SKIF_Assets_Resolve (
+        LibraryTexture                      libTexToLoad,
+        app_record_s::Store                 store,
+        const std::wstring&                 folder,
+        bool                                allowPCGW,
+        SKIF_AssetMatch&                    match);
+
+// Height covers are shown at when the default cover scaling is used (900 px, scaled by DPI), or 0 if
+//   the scaling in use can show covers at any size; larger covers are downscaled to it when loaded
+uint32_t
+SKIF_Assets_GetCoverDisplayHeight (void);
+
+// On-disk cache of decoded (and downscaled) library textures, so they can be
+//   uploaded straight from a memory-mapped file instead of being decoded again
+struct SKIF_TextureCache
+{
+  struct entry_s {
+    SK_MappedFile        file;  // Must outlive any use of image.pixels
+    DirectX::TexMetadata meta  = { };
+    DirectX::Image       image = { };
+  };
+
+  // Entries are keyed on the path of the source image and a variant (how it was processed),
+  //   and are only valid for as long as the size and last write time of the source are unchanged
+  bool load  (const std::wstring& source, uint32_t variant, entry_s& entry);
+  void store (const std::wstring& source, uint32_t variant, const DirectX::TexMetadata& meta, const DirectX::Image& image);
+
+  SKIF_TextureCache (SKIF_TextureCache const&) = delete; // Delete copy constructor
+  SKIF_TextureCache (SKIF_TextureCache&&)      = delete; // Delete move constructor
+
+  static SKIF_TextureCache& GetInstance (void)
+  {
+      static SKIF_TextureCache instance;
+      return instance;
+  }
+
+private:
+  SKIF_TextureCache (void);
+
+  std::wstring getEntryPath (const std::wstring& source, uint32_t variant) const;
+  void         trim         (void);
+
+  static constexpr uint64_t MaxSize = 256ULL * 1024 * 1024; // Least recently used entries are evicted beyond this
+
+  std::mutex   m_lock;
+  std::wstring m_root;
+  uint64_t     m_total   = 0;
+  bool         m_scanned = false;
+};
@@ -0,0 +1,45 @@
+//
+// Copyright 2020 Andon "Kaldaien" Coleman
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+//
+
+#pragma once
+#include <cstdint>
+#include <set>
+#include <string>
+#include <vector>
+
+#include <stores/Steam/app_record.h>
+
+// Binary snapshot of the fully processed library, written by the library worker once it
+//   has finished and used on the next launch to show the library before it has been rebuilt
+//
+//   -> Records the state (size + last write time) of every source the library was built from:
+//        Steam manifests/appinfo.vdf/user configs, the Epic manifest folder, the GOG/Xbox/custom
+//          registry keys, as well as lc.json, lc_user.json and db.json
+//   -> Loading fails if any of those have changed, or if the context (enabled stores,
+//        Steam user, etc.) differs from when the snapshot was written
+//   -> A loaded snapshot is only a stand-in; the library is still rebuilt in the background
+bool SKIF_LibrarySnapshot_Load (uint64_t context,       std::vector <std::pair <std::string, app_record_s>>& apps,       std::set <std::string>& apptickets);
+void SKIF_LibrarySnapshot_Save (uint64_t context, const std::vector <std::pair <std::string, app_record_s>>& apps, const std::set <std::string>& apptickets);
+
+// Hash of everything the library worker produces for an app (what the snapshot keeps, as well as
+//   the appinfo.vdf data it leaves out), used to tell which apps have actually changed when the library is rebuilt
+uint64_t SKIF_LibrarySnapshot_Fingerprint (const std::pair <std::string, app_record_s>& app);
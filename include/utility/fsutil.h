@@ -108,6 +108,41 @@ private:
   SKIF_CommonPathsCache (void);
 };
 
+// Read-only memory-mapped view of an entire file
+//   Pages are only faulted in when touched, so large files (e.g. appinfo.vdf)
+//     can be accessed without first copying them into memory.
+class SK_MappedFile
+{
+public:
+   SK_MappedFile (void) = default;
+  ~SK_MappedFile (void) { close (); }
+
+  SK_MappedFile            (SK_MappedFile const&) = delete; // Delete copy constructor
+  SK_MappedFile& operator= (SK_MappedFile const&) = delete; // Delete copy assignment
+
+  bool        open     (const wchar_t* wszPath);
+  void        close    (void);
+
+  const BYTE* data     (void) const { return _view;         }
+  size_t      size     (void) const { return _size;         }
+  bool        empty    (void) const { return _size == 0;    }
+  const BYTE* end      (void) const { return _view + _size; }
+
+  // Bounds check for reads of len bytes starting at ptr
+  bool        contains (const void* ptr, size_t len = 1) const
+  {
+    auto p = static_cast <const BYTE *> (ptr);
+
+    return _view != nullptr && p >= _view && p <= end ()
+                            && len <= (size_t)(end () - p);
+  }
+
+private:
+  HANDLE _mapping = nullptr;
+  BYTE*  _view    = nullptr;
+  size_t _size    = 0;
+};
+
 HRESULT
 SK_Shell32_GetKnownFolderPath ( _In_ REFKNOWNFOLDERID rfid,
                                      std::wstring&     dir,
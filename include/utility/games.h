@@ -2,38 +2,64 @@
 
 #include <vector>
 #include <string>
+#include <string_view>
 #include <atomic>
 #include <memory>
 #include <stores/generic_library2.h>
 #include <nlohmann/json.hpp>
 
-// define character size
-#define CHAR_SIZE 128
-
-// A Class representing a Trie node
-class Trie
+// Search index over the names of a list of apps
+//   -> A sorted prefix index over the search names (names.all_upper_alnum), one entry per app
+//   -> A trigram index over the full names (names.all_upper, names.original) and store IDs
+//   -> Lookups return the positions of the apps in the list the index was built from,
+//        so it goes stale whenever that list is replaced or sorted
+class SKIF_SearchIndex
 {
 public:
-  bool  isLeaf                = false;
-  Trie* character [CHAR_SIZE] = {   };
+  struct match_s {
+    uint32_t index = 0; // Position in the app list
+    uint32_t rank  = 0; // Lower is better
+    uint32_t pos   = 0; // Of the match within names.all_upper, if it was found there
+    uint32_t len   = 0;
+  };
 
-  // Constructor
-  Trie (void)
-  {
-    this->isLeaf = false;
+  void build   (const std::vector <std::pair <std::string, app_record_s> >& apps);
+  void clear   (void);
 
-    for (int i = 0; i < CHAR_SIZE; i++)
-      this->character [i] = nullptr;
-  }
+  // Positions of all apps whose search name begins with the prefix, in ascending order
+  bool find    (std::string_view prefix, std::vector <uint32_t>& matches) const;
+
+  // Case-insensitive substring search, best matches first
+  //   -> Names beginning with the query rank first, then matches at the start of a word, then anywhere
+  //   -> Names within one typo (two for longer queries) are only returned if nothing matches exactly
+  bool search  (std::string_view query,  std::vector <match_s>&  matches) const;
+
+  // False if the index has been cleared, or g_apps has been sorted since it was built
+  bool current (void) const;
+
+private:
+  struct entry_s {
+    uint32_t offset      = 0; // Into m_keys
+    uint32_t length      = 0;
+    uint32_t index       = 0; // Position in the app list
+    uint32_t text_offset = 0; // Into m_text
+    uint32_t text_length = 0;
+    uint32_t name_length = 0; // Of names.all_upper, which the text starts with
+  };
+
+  std::string_view key  (const entry_s& entry) const { return { m_keys.data () + entry.offset,      entry.length      }; }
+  std::string_view text (const entry_s& entry) const { return { m_text.data () + entry.text_offset, entry.text_length }; }
 
-  void insert       (        const std::string&);
-  bool deletion     (Trie*&, const std::string&);
-  bool search       (        const std::string&);
-  bool haveChildren (Trie const*);
+  std::string            m_keys;
+  std::string            m_text;    // Lines of names.all_upper, the folded names.original, and the (folded) store IDs
+  std::vector <entry_s>  m_entries;
+  std::vector <uint64_t> m_grams;   // Trigram << 32 | entry, sorted
+  uint32_t               m_generation = 0;
+  bool                   m_built      = false;
 };
 
 // Helper functions
-void InsertTrieKey (std::pair <std::string, app_record_s>* app, Trie* labels);
+void PrepareSearchNames (std::pair <std::string, app_record_s>* app);
 
 // Singleton struct
 struct SKIF_GamingCollection {
@@ -45,13 +71,13 @@ struct SKIF_GamingCollection {
   }
   static void RefreshRunningApps (std::vector <std::pair <std::string, app_record_s> > *apps, bool forced = false);
   static void SortApps (std::vector <std::pair <std::string, app_record_s> > *apps);
+  static std::atomic <uint32_t> SortCounter;    // Incremented by SortApps when sorting g_apps, see SKIF_SearchIndex
+  static std::atomic <uint32_t> AppsGeneration; // Incremented whenever apps are added to or removed from g_apps, or their launch configs are rebuilt
   SKIF_GamingCollection (SKIF_GamingCollection const&) = delete; // Delete copy constructor
   SKIF_GamingCollection (SKIF_GamingCollection&&)      = delete; // Delete move constructor
 
 private:
   SKIF_GamingCollection (void);
-  Trie           m_tLabels;
-  Trie           m_tLabelsFiltered;
   nlohmann::json m_jsonMetaDB;
 
   ID3D11ShaderResourceView* m_pPatTexSRV;
@@ -0,0 +1,94 @@
+#pragma once
+#include <Windows.h>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+// A single process, identified by its PID and creation time so PID reuse is never mistaken for the same process
+struct SKIF_ProcessInfo
+{
+  DWORD        pid           = 0;
+  DWORD        parent_pid    = 0;
+  uint64_t     creation_time = 0;     // FILETIME as a 64-bit value, 0 if the process could not be opened
+  std::wstring name;                  // Executable file name, as reported by the snapshot
+  std::wstring path;                  // Full image path, empty if it could not be resolved
+  std::wstring name_folded;           // Lower case copies used for lookups
+  std::wstring path_folded;
+  bool         x86           = false;
+  bool         accessible    = false; // false if the process could not be opened at all
+};
+
+using SKIF_ProcessInfoPtr =
+  std::shared_ptr <const SKIF_ProcessInfo>;
+
+// Platform backend that enumerates and resolves processes; the tracker only ever
+//   resolves processes it has not seen before, and only identifies the rest
+//   -> No handle is kept open, so exited processes are never held on to as zombies
+struct SKIF_ProcessSource
+{
+  struct entry_s {
+    DWORD        pid;
+    DWORD        parent_pid;
+    std::wstring name;
+  };
+
+  virtual ~SKIF_ProcessSource (void) = default;
+
+  virtual bool enumerate (std::vector <entry_s>& entries)                       = 0; // List all running processes (cheap)
+  virtual bool identify  (DWORD pid, uint64_t& creation_time, bool& terminated) = 0; // Creation time and exit state; false if the process could not be opened
+  virtual void resolve   (SKIF_ProcessInfo& process)                            = 0; // Fill in path and architecture
+};
+
+// Win32 backend built on Toolhelp snapshots
+struct SKIF_ProcessSource_Win32 : SKIF_ProcessSource
+{
+  bool enumerate (std::vector <entry_s>& entries)                       override;
+  bool identify  (DWORD pid, uint64_t& creation_time, bool& terminated) override;
+  void resolve   (SKIF_ProcessInfo& process)                            override;
+};
+
+// Singleton struct
+struct SKIF_ProcessTracker
+{
+  // Refreshes the process table, unless it was already refreshed within the last max_age ms
+  void                              Refresh       (DWORD max_age = 0);
+
+  // All running processes, in the order they were enumerated; processes that could not be opened are included, but not resolved
+  std::vector <SKIF_ProcessInfoPtr> GetProcesses  (void);
+
+  // Case folding used for name_folded/path_folded, so consumers can build matching keys
+  static std::wstring               Fold          (const wchar_t* wszStr, size_t len);
+
+  SKIF_ProcessTracker (SKIF_ProcessTracker const&) = delete; // Delete copy constructor
+  SKIF_ProcessTracker (SKIF_ProcessTracker&&)      = delete; // Delete move constructor
+
+  static SKIF_ProcessTracker& GetInstance (void)
+  {
+      static SKIF_ProcessTracker instance (std::make_unique <SKIF_ProcessSource_Win32> ( ));
+      return instance;
+  }
+
+  // Exposed for use with other backends
+  explicit SKIF_ProcessTracker (std::unique_ptr <SKIF_ProcessSource> source);
+
+private:
+  struct tracked_s {
+    SKIF_ProcessInfoPtr process;
+    uint32_t            generation;
+  };
+
+  std::mutex                        m_mutex;
+  std::unique_ptr <SKIF_ProcessSource>
+                                    m_source;
+  std::unordered_map <DWORD, tracked_s>
+                                    m_processes;  // pid -> record, for accessible processes only
+  std::vector <SKIF_ProcessInfoPtr> m_running;    // Non-zombies, in enumeration order
+  std::vector <SKIF_ProcessSource::entry_s>
+                                    m_entries;    // Reused between refreshes
+  uint32_t                          m_generation  = 0;
+  DWORD                             m_dwLastRefresh = 0;
+  bool                              m_bRefreshed  = false;
+};
@@ -0,0 +1,109 @@
+//
+// Copyright 2020 Andon "Kaldaien" Coleman
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+//
+
+#pragma once
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+enum class SKIF_TaskPriority {
+  Interactive = 0, // Work for the current selection, always picked ahead of background work
+  Background  = 1  // Prefetching (icons etc.)
+};
+
+// Tasks can be grouped so that stale requests can be cancelled all at once, e.g. when the selection changes
+enum SKIF_TaskGroup {
+  SKIF_TaskGroup_None      = 0, // Never cancelled
+  SKIF_TaskGroup_Cover     = 1, // Loading the cover of the selected game
+  SKIF_TaskGroup_GameIcons = 2, // Loading the icons of the library
+  SKIF_TaskGroup_COUNT
+};
+
+// Handed to every task, to let it check whether it has been cancelled
+class SKIF_TaskToken
+{
+public:
+  SKIF_TaskToken (const std::atomic <uint32_t>& current, uint32_t generation, const std::atomic <bool>& stopping)
+    : _current (current), _generation (generation), _stopping (stopping) { }
+
+  bool cancelled (void) const { return _stopping.load () || _current.load () != _generation; }
+
+private:
+  const std::atomic <uint32_t>& _current;
+  const uint32_t                _generation;
+  const std::atomic <bool>&     _stopping;
+};
+
+// Bounded pool of worker threads running queued tasks by priority
+//   -> One worker only ever runs interactive tasks, so those never wait behind a pool full of background work
+//   -> Every task is run exactly once, even when cancelled; a cancelled task is handed a cancelled
+//        token (and moved to the front of the queue) so it can release whatever it holds and bail out
+//   -> The core only relies on the standard library; the Win32 specifics (the shared instance,
+//        thread setup and completion events) live at the bottom of task_scheduler.cpp
+class SKIF_TaskScheduler
+{
+public:
+  using task_fn = std::function <void (const SKIF_TaskToken&)>;
+
+  SKIF_TaskScheduler  (size_t threads, std::function <void (void)> thread_init = nullptr);
+  ~SKIF_TaskScheduler (void); // Runs anything still queued as cancelled, then joins the threads
+
+  void   submit  (SKIF_TaskPriority priority, SKIF_TaskGroup group, task_fn task);
+  void   cancel  (SKIF_TaskGroup group);
+  size_t pending (void) const;
+
+  SKIF_TaskScheduler (SKIF_TaskScheduler const&) = delete; // Delete copy constructor
+  SKIF_TaskScheduler (SKIF_TaskScheduler&&)      = delete; // Delete move constructor
+
+#ifdef _WIN32
+  static SKIF_TaskScheduler& GetInstance (void);
+#endif
+
+private:
+  struct task_s {
+    task_fn        fn;
+    SKIF_TaskGroup group      = SKIF_TaskGroup_None;
+    uint32_t       generation = 0;
+  };
+
+  void worker (bool interactive_only, std::function <void (void)> thread_init);
+
+  mutable std::mutex        _lock;
+  std::condition_variable   _signal;
+  std::deque <task_s>       _queues [2]; // Indexed by SKIF_TaskPriority
+  std::atomic <uint32_t>    _generations [SKIF_TaskGroup_COUNT] = { };
+  std::atomic <bool>        _stopping = false;
+  std::vector <std::thread> _threads;
+};
+
+#ifdef _WIN32
+// Queues the task on the shared scheduler, returning an event that is signaled once the task
+//   has finished (or been cancelled), for call sites that keep track of their workers through handles
+//   -> Background tasks are run with EcoQoS and in the background processing mode of the thread
+//   -> The caller is responsible for closing the event; NULL if it could not be created
+void* SKIF_Util_QueueTask (SKIF_TaskPriority priority, SKIF_TaskGroup group, SKIF_TaskScheduler::task_fn task);
+#endif
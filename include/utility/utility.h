@@ -2,6 +2,7 @@
 
 #include <string>
 #include <map>
+#include <unordered_map>
 #include <atomic>
 #include <Windows.h>
 #include <wtypes.h>
@@ -10,6 +11,7 @@
 #include <Tlhelp32.h>
 #include <processthreadsapi.h>
 #include <vector>
+#include <future>
 #include <shellapi.h>
 #include <stdexcept>
 #include <shobjidl_core.h>
@@ -79,6 +81,7 @@ std:: string    SKIF_Util_ToLower                     (std:: string_view input);
 std::wstring    SKIF_Util_ToLowerW                    (std::wstring_view input);
 std:: string    SKIF_Util_ToUpper                     (std:: string_view input);
 std::wstring    SKIF_Util_ToUpperW                    (std::wstring_view input);
+std:: string    SKIF_Util_FoldCase                    (std:: string_view input);
 void            SKIF_Util_CleanString                 (std:: string&     input);
 void            SKIF_Util_CleanStringW                (std::wstring&     input);
 void            SKIF_Util_StripNulls                  (std:: string&     input);
@@ -169,6 +172,7 @@ BOOL    WINAPI  SKIF_Util_GetSystemCpuSetInformation  (PSYSTEM_CPU_SET_INFORMATI
 bool            SKIF_Util_SetThreadPrefersECores      (void);
 BOOL    WINAPI  SKIF_Util_SetThreadInformation        (HANDLE hThread,  THREAD_INFORMATION_CLASS ThreadInformationClass, LPVOID ThreadInformation, DWORD ThreadInformationSize);
 HRESULT WINAPI  SKIF_Util_SetThreadDescription        (HANDLE hThread,  PCWSTR lpThreadDescription);
+bool            SKIF_Util_JoinTask                    (std::future <void>& task, const std::string& description);
 BOOL    WINAPI  SKIF_Util_SetThreadSelectedCpuSets    (HANDLE hThread,  const ULONG *CpuSetIds, ULONG CpuSetIdCount);
 bool            SKIF_Util_SetThreadPowerThrottling    (HANDLE threadHandle, INT state);
 bool            SKIF_Util_SetThreadMemoryPriority     (HANDLE threadHandle, ULONG memoryPriority);
@@ -292,6 +296,76 @@ private:
                                     DWORD dwNotifyFilter = FILE_NOTIFY_CHANGE_FILE_NAME | FILE_NOTIFY_CHANGE_LAST_WRITE);
 };
 
+// Same as SKIF_DirectoryWatch, but reports which files changed (using ReadDirectoryChangesW)
+//   so consumers can act on the individual files instead of rescanning the whole folder
+//   -> Bursts of changes are coalesced per file (e.g. Steam rewriting a manifest several times
+//        during an update), and only handed out once the folder has been quiet for dwSettleTime ms
+//   -> If the change buffer overflowed, overflowed is set and the consumer has to rescan everything
+
+struct SKIF_DirectoryChange
+{
+  enum class Action {
+    Added,
+    Removed,
+    Modified,
+    Renamed
+  };
+
+  Action       action;
+  std::wstring path;     // Relative to the watched folder
+  std::wstring old_path; // Relative to the watched folder, only set for Renamed
+};
+
+struct SKIF_DirectoryChangeWatch
+{
+  SKIF_DirectoryChangeWatch  (void) { };
+  ~SKIF_DirectoryChangeWatch (void);
+
+  // Registers the watch on the first call (and again should the path change), and returns true once
+  //   any changes have settled and are ready to be retrieved through getChanges ( )
+  bool isSignaled            (std::wstring_view wstrPath,
+                                          UITab waitTab        = UITab_None,
+                                           BOOL bWatchSubtree  = FALSE,
+                                          DWORD dwNotifyFilter = FILE_NOTIFY_CHANGE_FILE_NAME | FILE_NOTIFY_CHANGE_LAST_WRITE,
+                                          DWORD dwSettleTime   = 0);
+
+  // Hands out the settled changes, oldest first, and clears the overflow state
+  std::vector <SKIF_DirectoryChange>
+       getChanges            (bool* overflowed = nullptr);
+
+  bool  isWatching          (void) const { return _hDirectory != INVALID_HANDLE_VALUE; }
+  DWORD getLastChange       (void) const { return _lastChange; } // SKIF_Util_timeGetTime ( ) of the most recent change
+  void reset                 (void);
+
+  SKIF_DirectoryChangeWatch (SKIF_DirectoryChangeWatch const&) = delete; // Delete copy constructor
+  SKIF_DirectoryChangeWatch (SKIF_DirectoryChangeWatch&&)      = delete; // Delete move constructor
+
+  HANDLE       _hDirectory  = INVALID_HANDLE_VALUE; // If the CreateFile function fails, the return value is INVALID_HANDLE_VALUE.
+  OVERLAPPED   _overlapped  = { };                  // _overlapped.hEvent doubles as the wait object
+  UITab        _waitTab     = UITab_None;
+  std::wstring _path        = L"";
+
+private:
+  void registerNotify        (std::wstring_view wstrPath, UITab waitTab, BOOL bWatchSubtree, DWORD dwNotifyFilter);
+  void readChanges           (void);
+  bool issueRead             (void);
+  void record                (SKIF_DirectoryChange::Action action, std::wstring path, std::wstring old_path = L"");
+
+  SKIF_DirectoryChange*
+       findPending           (const std::wstring& path);
+  void addPending            (SKIF_DirectoryChange::Action action, std::wstring path, std::wstring old_path = L"");
+  void dropPending           (SKIF_DirectoryChange* change);
+
+  DWORD        _lastChange  = 0;
+  BOOL         _subtree     = FALSE;
+  DWORD        _filter      = 0;
+  bool         _overflowed  = false;
+  std::vector <DWORD>                _buffer;  // DWORD aligned, as ReadDirectoryChangesW requires
+  std::vector <SKIF_DirectoryChange> _pending; // Coalesced, one entry per file; entries coalesced away are left with an empty path
+  std::unordered_map <std::wstring, size_t>
+                                     _pending_index; // Case-folded path -> live entry in _pending
+};
+
 
 // Registry Watch
 
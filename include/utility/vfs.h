@@ -168,6 +168,17 @@ public:
         vfsNewFile;
     }
 
+    bool removeFile   (const wchar_t* wszName)
+    {
+      if (! containsFile (wszName))
+        return false;
+
+      delete children [wszName];
+             children.erase (wszName);
+
+      return true;
+    }
+
     bool containsDirectory (const wchar_t* wszName)
     {
       if ( children.count (wszName)        &&
@@ -273,6 +284,14 @@ public:
            name =  L"Uninitialized VFS";
   }
 
+  // Exchanges the contents of two virtual filesystems, so one can be built
+  //   without holding up readers of the other
+  void swap (SK_VirtualFS& other)
+  {
+    std::swap (root, other.root);
+    std::swap (name, other.name);
+  }
+
   operator vfsNode* (void) { return root; };
 
 protected:
@@ -3,11 +3,16 @@
 #include <wtypes.h>
 #include <fstream>
 #include <filesystem>
+#include <future>
+#include <atomic>
+#include <set>
+#include <unordered_map>
 
 #include <comdef.h>
 #include <process.h>
 
 #include <utility/registry.h>
+#include <stores/app_key.h>
 
 /*
 Epic registry / folder struture
@@ -44,6 +49,174 @@ it's enough to launch the game through Epic like the start menu shortcuts does,
 
 std::wstring SKIF_Epic_AppDataPath;
 
+#pragma region Manifests
+
+// The parameters of an .item file used by the library, see the list above
+struct SKIF_Epic_ItemManifest {
+  std::string LaunchExecutable;
+  std::string InstallLocation;
+  std::string DisplayName;
+  std::string ManifestLocation;
+  std::string InstallationGuid;
+  std::string CatalogNamespace;
+  std::string CatalogItemId;
+  std::string AppName;
+  bool        isGame    = false; // AppCategories contains "games"
+  bool        discarded = true;  // The file could not be read or is not valid JSON
+  bool        valid     = false; // All of the parameters above were present
+};
+
+// SAX handler that only keeps the top-level parameters listed in SKIF_Epic_ItemManifest,
+//   skipping over everything else without building a DOM, and stopping once all have been seen
+class SKIF_Epic_ItemParser : public nlohmann::json_sax <nlohmann::json>
+{
+public:
+  explicit SKIF_Epic_ItemParser (SKIF_Epic_ItemManifest& item) : _item (item) { }
+
+  bool key (string_t& val) override
+  {
+    _field      = nullptr;
+    _categories = false;
+
+    if (_depth != 1)
+      return true;
+
+    // Every parameter has been found, so no need to look at the rest of the file
+    if (_found == Found_All)
+      return false;
+
+    static const std::pair <const char*, std::string SKIF_Epic_ItemManifest::*> fields [] = {
+      { "LaunchExecutable", &SKIF_Epic_ItemManifest::LaunchExecutable },
+      { "InstallLocation",  &SKIF_Epic_ItemManifest::InstallLocation  },
+      { "DisplayName",      &SKIF_Epic_ItemManifest::DisplayName      },
+      { "ManifestLocation", &SKIF_Epic_ItemManifest::ManifestLocation },
+      { "InstallationGuid", &SKIF_Epic_ItemManifest::InstallationGuid },
+      { "CatalogNamespace", &SKIF_Epic_ItemManifest::CatalogNamespace },
+      { "CatalogItemId",    &SKIF_Epic_ItemManifest::CatalogItemId    },
+      { "AppName",          &SKIF_Epic_ItemManifest::AppName          }
+    };
+
+    for (uint32_t i = 0; i < _countof (fields); i++)
+    {
+      if (val == fields [i].first)
+      {
+        _field = &(_item.*fields [i].second);
+        _bit   = 1U << i;
+        break;
+      }
+    }
+
+    _categories = (val == "AppCategories");
+
+    return true;
+  }
+
+  bool string (string_t& val) override
+  {
+    if (_depth == 1 && _field != nullptr)
+    {
+      *_field  = std::move (val);
+      _found  |= _bit;
+    }
+
+    else if (_depth == 2 && _inCategories && val == "games")
+      _item.isGame = true;
+
+    return true;
+  }
+
+  bool start_object (std::size_t) override { _depth++; return true; }
+  bool end_object   (void)        override { _depth--; return true; }
+  bool start_array  (std::size_t) override
+  {
+    if (_depth == 1 && _categories)
+    {
+      _inCategories = true;
+      _found       |= Found_Categories;
+    }
+
+    _depth++;
+    return true;
+  }
+  bool end_array    (void)        override
+  {
+    if (--_depth == 1)
+      _inCategories = false;
+
+    return true;
+  }
+
+  bool null            (void)                            override { return true; }
+  bool boolean         (bool)                            override { return true; }
+  bool number_integer  (number_integer_t)                override { return true; }
+  bool number_unsigned (number_unsigned_t)               override { return true; }
+  bool number_float    (number_float_t, const string_t&) override { return true; }
+  bool binary          (binary_t&)                       override { return true; }
+
+  bool parse_error (std::size_t, const std::string&, const nlohmann::detail::exception&) override
+  {
+    _failed = true;
+    return false;
+  }
+
+  bool failed   (void) const { return _failed;              }
+  bool complete (void) const { return _found == Found_All;  }
+
+private:
+  static constexpr uint32_t Found_Categories = 1U << 8;
+  static constexpr uint32_t Found_All        = (Found_Categories << 1) - 1;
+
+  SKIF_Epic_ItemManifest& _item;
+  std::string*            _field        = nullptr;
+  uint32_t                _bit          = 0;
+  uint32_t                _found        = 0;
+  int                     _depth        = 0;
+  bool                    _categories   = false;
+  bool                    _inCategories = false;
+  bool                    _failed       = false;
+};
+
+// Reads and parses a single .item manifest
+static void
+SKIF_Epic_ReadItemManifest (const wchar_t* wszManifestFullPath, SKIF_Epic_ItemManifest& item)
+{
+  CHandle hManifest (
+    CreateFileW ( wszManifestFullPath,
+                    GENERIC_READ,
+                      FILE_SHARE_READ | FILE_SHARE_WRITE,
+                        nullptr,        OPEN_EXISTING,
+                          FILE_ATTRIBUTE_NORMAL | FILE_FLAG_SEQUENTIAL_SCAN,
+                            nullptr ) );
+
+  if (hManifest == INVALID_HANDLE_VALUE)
+    return;
+
+  DWORD dwSizeHigh = 0,
+        dwRead     = 0,
+        dwSize     =
+    GetFileSize (hManifest, &dwSizeHigh);
+
+  if (dwSize == INVALID_FILE_SIZE || dwSizeHigh != 0)
+    return;
+
+  std::string manifest_data (dwSize, '\0');
+
+  if (! ReadFile (hManifest, manifest_data.data (), dwSize, &dwRead, nullptr) || ! dwRead)
+    return;
+
+  manifest_data.resize (dwRead);
+
+  SKIF_Epic_ItemParser parser (item);
+
+  // Returns false both on errors and when the parser stops early, once it has found everything
+  nlohmann::json::sax_parse (manifest_data, &parser);
+
+  item.discarded = parser.failed   ( );
+  item.valid     = parser.complete ( ) && ! item.discarded;
+}
+
+#pragma endregion
+
 void
 SKIF_Epic_GetInstalledAppIDs (std::vector <std::pair < std::string, app_record_s > > *apps)
 {
@@ -89,129 +262,171 @@ SKIF_Epic_GetInstalledAppIDs (std::vector <std::pair < std::string, app_record_s
     return;
   }
 
-  for (const auto& entry : std::filesystem::directory_iterator(SKIF_Epic_AppDataPath))
+  // Gather the manifests up front so they can be parsed concurrently
+  std::vector <std::filesystem::path> item_paths;
+
+  std::error_code ec;
+  for (const auto& entry : std::filesystem::directory_iterator (SKIF_Epic_AppDataPath, ec))
   {
     if (entry.is_directory()               == false    &&
         entry.path().extension().wstring() == L".item" )
-    {
-      try {
-        PLOG_DEBUG << "Parsing " << entry.path();
-
-        std::ifstream file(entry.path());
-        nlohmann::json jf = nlohmann::json::parse(file, nullptr, false);
-        file.close();
+      item_paths.emplace_back (entry.path());
+  }
 
-        // Skip if we're dealing with a broken manifest
-        if (jf.is_discarded ( ))
-          continue;
+  if (item_paths.empty())
+    return;
 
-        // Skip if a launch executable does not exist (easiest way to filter out Borderlands 3's DLCs, I guess?)
-        if (jf.at ("LaunchExecutable").get <std::string_view>().empty())
-          continue;
+  std::vector <SKIF_Epic_ItemManifest> items (item_paths.size());
 
-        bool isGame = false;
+  const size_t workers =
+    std::min <size_t> ( item_paths.size (),
+      std::max <size_t> (1, std::thread::hardware_concurrency ()) );
 
-        for (auto& categories : jf["AppCategories"])
-        {
-          if (categories.get <std::string_view>()._Equal(R"(games)"))
-            isGame = true;
-        }
+  // Each manifest is only ever touched by the one worker that claimed it
+  std::atomic <size_t>             next = 0;
+  std::vector <std::future <void>> tasks;
 
-        if (isGame)
-        {
-          std::wstring egsstore_manifest =
-            SK_FormatStringW  (LR"(%ws\%ws.manifest)",
-            SK_UTF8ToWideChar (jf.at ("ManifestLocation")).c_str(),
-            SK_UTF8ToWideChar (jf.at ("InstallationGuid")).c_str()
-          );
-
-          // Skip if a corresponding manifest file does not reside in the expected .egstore folder
-          if (! PathFileExists (egsstore_manifest.c_str()))
-            continue;
-
-          std::string CatalogNamespace    = jf.at("CatalogNamespace"),
-                      CatalogItemId       = jf.at("CatalogItemId"),
-                      AppName             = jf.at("AppName");
-
-          // Hash the AppName into a unique integer we use for internal tracking purposes
-          std::hash <std::string> stoi_hasher;
-          size_t int_hash = stoi_hasher (AppName);
-
-          app_record_s record(static_cast<uint32_t>(int_hash));
-
-          //record.install_dir.erase(std::find(record.install_dir.begin(), record.install_dir.end(), '\0'), record.install_dir.end());
-
-          record.store                = app_record_s::Store::Epic;
-          record.store_utf8           = "Epic";
-          record._status.installed    = true;
-          record.install_dir          = SK_UTF8ToWideChar (jf.at ("InstallLocation"));
-          record.install_dir          = std::filesystem::path (record.install_dir).lexically_normal();
-          record.names.normal         = jf.at ("DisplayName");
-          record.names.original       = record.names.normal;
-
-
-          app_record_s::launch_config_s lc;
-          lc.id                       = 0;
-          lc.valid                    = 1;
-          lc.executable               = SK_UTF8ToWideChar(jf.at("LaunchExecutable")); // record.install_dir + L"\\" +
-          lc.executable_path          = record.install_dir + LR"(\)" + lc.executable;
-          lc.install_dir              = record.install_dir;
-          std::replace(lc.executable_path.begin(), lc.executable_path.end(), '/', '\\'); // Replaces all / with \
-
-          // Strip out the subfolders from the executable variable
-          std::wstring
-             substr = lc.executable;
-          auto npos = substr.find_last_of(L"/\\");
-          if (npos != std::wstring::npos)
-            substr  = substr.substr(npos + 1);
-          if (! substr.empty() )
-            lc.executable = substr;
-
-          lc.working_dir               = record.install_dir;
-          //lc.launch_options = SK_UTF8ToWideChar(app.at("LaunchCommand"));
-
-          // com.epicgames.launcher://apps/CatalogNamespace%3ACatalogItemId%3AAppName?action=launch&silent=true
-          lc.launch_options = SK_UTF8ToWideChar(CatalogNamespace + "%3A" + CatalogItemId + "%3A" + AppName);
-          lc.launch_options.erase(std::find(lc.launch_options.begin(), lc.launch_options.end(), '\0'), lc.launch_options.end());
-
-          record.launch_configs.emplace (0, lc);
-
-          record.epic.catalog_namespace = CatalogNamespace;
-          record.epic.catalog_item_id   = CatalogItemId;
-          record.epic.name_app          = AppName;
-          record.epic.name_display      = record.names.normal;
-
-          record.specialk.injection.injection.type = InjectionType::Global;
-
-          // Strip invalid filename characters
-          record.specialk.profile_dir_utf8 = SKIF_Util_StripInvalidFilenameChars (record.epic.name_display);
-          record.specialk.profile_dir      = SK_UTF8ToWideChar (record.specialk.profile_dir_utf8);
-            
-          std::pair <std::string, app_record_s>
-            Epic(record.names.normal, record);
-
-          apps->emplace_back(Epic);
-
-          // Documents\My Mods\SpecialK\Profiles\AppCache\#EpicApps\<AppName>
-          std::wstring AppCacheDir = SK_FormatStringW(LR"(%ws\Profiles\AppCache\#EpicApps\%ws)", _path_cache.specialk_userdata, SK_UTF8ToWideChar(AppName).c_str());
-
-          std::error_code ec;
-          // Create any missing directories
-          if (! std::filesystem::exists (            AppCacheDir, ec))
-                std::filesystem::create_directories (AppCacheDir, ec);
-
-          // Copy manifest to AppCache directory
-          CopyFile (entry.path().c_str(), (AppCacheDir + LR"(\manifest.json)").c_str(), false);
-        }
-      }
-      catch (const std::exception&)
+  for (size_t i = 0; i < workers; ++i)
+  {
+    tasks.emplace_back (
+      std::async (std::launch::async, [&](void)
       {
-        PLOG_ERROR << "Failed to parse manifest: " << entry.path();
-      }
+        SKIF_Util_SetThreadDescription (GetCurrentThread (), L"SKIF_EpicManifestWorker");
+
+        for (size_t idx = next++; idx < item_paths.size (); idx = next++)
+          SKIF_Epic_ReadItemManifest (item_paths [idx].c_str(), items [idx]);
+      })
+    );
+  }
+
+  for (auto& task : tasks)
+    SKIF_Util_JoinTask (task, "An Epic manifest worker");
+
+  // The .egstore folders, and the .manifest files they contain, of all games that are left
+  //   -> Each folder is only enumerated once, instead of checking every file on its own
+  std::unordered_map <std::wstring, std::set <std::wstring>> egstore_folders;
+
+  for (auto& item : items)
+  {
+    // Skip if we're dealing with a broken manifest
+    if (item.discarded)
+      continue;
+
+    // Skip if a launch executable does not exist (easiest way to filter out Borderlands 3's DLCs, I guess?)
+    if (item.LaunchExecutable.empty() || ! item.isGame)
+      continue;
+
+    if (! item.valid)
+    {
+      PLOG_ERROR << "Failed to parse manifest: " << item_paths [&item - items.data()];
+      continue;
     }
+
+    egstore_folders.emplace (SKIF_Util_ToLowerW (SK_UTF8ToWideChar (item.ManifestLocation)), std::set <std::wstring> { });
   }
-}
 
+  for (auto& folder : egstore_folders)
+  {
+    WIN32_FIND_DATA ffd   = { };
+    HANDLE          hFind =
+      FindFirstFileExW ((folder.first + LR"(\*.manifest)").c_str(), FindExInfoBasic, &ffd, FindExSearchNameMatch, NULL, FIND_FIRST_EX_LARGE_FETCH);
+
+    if (hFind == INVALID_HANDLE_VALUE)
+      continue;
+
+    do
+    {
+      if ((ffd.dwFileAttributes & FILE_ATTRIBUTE_DIRECTORY) == 0)
+        folder.second.emplace (SKIF_Util_ToLowerW (ffd.cFileName));
+    } while (FindNextFile (hFind, &ffd));
+
+    FindClose (hFind);
+  }
+
+  for (size_t idx = 0; idx < items.size(); idx++)
+  {
+    auto& item = items [idx];
+
+    if (! item.valid || item.LaunchExecutable.empty() || ! item.isGame)
+      continue;
+
+    // Skip if a corresponding manifest file does not reside in the expected .egstore folder
+    auto egstore_folder = egstore_folders.find (SKIF_Util_ToLowerW (SK_UTF8ToWideChar (item.ManifestLocation)));
+    if ( egstore_folder == egstore_folders.end() ||
+        ! egstore_folder->second.count (SKIF_Util_ToLowerW (SK_UTF8ToWideChar (item.InstallationGuid) + L".manifest")))
+      continue;
+
+    const std::string& CatalogNamespace = item.CatalogNamespace,
+                       CatalogItemId    = item.CatalogItemId,
+                       AppName          = item.AppName;
+
+    // Hash the AppName into a unique integer we use for internal tracking purposes
+    app_record_s record (SKIF_AppKey_ToAppId (SKIF_AppKey_Hash (app_record_s::Store::Epic, AppName)));
+
+    //record.install_dir.erase(std::find(record.install_dir.begin(), record.install_dir.end(), '\0'), record.install_dir.end());
+
+    record.store                = app_record_s::Store::Epic;
+    record.store_utf8           = "Epic";
+    record._status.installed    = true;
+    record.install_dir          = SK_UTF8ToWideChar (item.InstallLocation);
+    record.install_dir          = std::filesystem::path (record.install_dir).lexically_normal();
+    record.names.normal         = item.DisplayName;
+    record.names.original       = record.names.normal;
+
+
+    app_record_s::launch_config_s lc;
+    lc.id                       = 0;
+    lc.valid                    = 1;
+    lc.executable               = SK_UTF8ToWideChar(item.LaunchExecutable); // record.install_dir + L"\\" +
+    lc.executable_path          = record.install_dir + LR"(\)" + lc.executable;
+    lc.install_dir              = record.install_dir;
+    std::replace(lc.executable_path.begin(), lc.executable_path.end(), '/', '\\'); // Replaces all / with \
+
+    // Strip out the subfolders from the executable variable
+    std::wstring
+       substr = lc.executable;
+    auto npos = substr.find_last_of(L"/\\");
+    if (npos != std::wstring::npos)
+      substr  = substr.substr(npos + 1);
+    if (! substr.empty() )
+      lc.executable = substr;
+
+    lc.working_dir               = record.install_dir;
+    //lc.launch_options = SK_UTF8ToWideChar(app.at("LaunchCommand"));
+
+    // com.epicgames.launcher://apps/CatalogNamespace%3ACatalogItemId%3AAppName?action=launch&silent=true
+    lc.launch_options = SK_UTF8ToWideChar(CatalogNamespace + "%3A" + CatalogItemId + "%3A" + AppName);
+    lc.launch_options.erase(std::find(lc.launch_options.begin(), lc.launch_options.end(), '\0'), lc.launch_options.end());
+
+    record.launch_configs.emplace (0, lc);
+
+    record.epic.catalog_namespace = CatalogNamespace;
+    record.epic.catalog_item_id   = CatalogItemId;
+    record.epic.name_app          = AppName;
+    record.epic.name_display      = record.names.normal;
+
+    record.specialk.injection.injection.type = InjectionType::Global;
+
+    // Strip invalid filename characters
+    record.specialk.profile_dir_utf8 = SKIF_Util_StripInvalidFilenameChars (record.epic.name_display);
+    record.specialk.profile_dir      = SK_UTF8ToWideChar (record.specialk.profile_dir_utf8);
+      
+    std::pair <std::string, app_record_s>
+      Epic(record.names.normal, record);
+
+    apps->emplace_back(Epic);
+
+    // Documents\My Mods\SpecialK\Profiles\AppCache\#EpicApps\<AppName>
+    std::wstring AppCacheDir = SK_FormatStringW(LR"(%ws\Profiles\AppCache\#EpicApps\%ws)", _path_cache.specialk_userdata, SK_UTF8ToWideChar(AppName).c_str());
+
+    // Create any missing directories
+    if (! std::filesystem::exists (            AppCacheDir, ec))
+          std::filesystem::create_directories (AppCacheDir, ec);
+
+    // Copy manifest to AppCache directory
+    CopyFile (item_paths [idx].c_str(), (AppCacheDir + LR"(\manifest.json)").c_str(), false);
+  }
+}
 
 void
 SKIF_Epic_IdentifyAssetNew (std::string CatalogNamespace, std::string CatalogItemId, std::string AppName, std::string DisplayName)
@@ -287,6 +502,7 @@ SKIF_Epic_IdentifyAssetNew (std::string CatalogNamespace, std::string CatalogIte
             PLOG_DEBUG << "Downloading cover asset: " << assetUrl;
 
             SKIF_Util_GetWebResource (SK_UTF8ToWideChar (assetUrl), targetAssetPath + L"cover-original.jpg");
+            SKIF_AssetIndex::GetInstance ( ).update (targetAssetPath + L"cover-original.jpg");
           }
         }
       }
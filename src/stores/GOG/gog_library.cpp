@@ -1,5 +1,6 @@
 
 #include <stores/gog/gog_library.h>
+#include <stores/generic_library2.h>
 #include <wtypes.h>
 #include <fstream>
 #include <filesystem>
@@ -303,6 +304,7 @@ SKIF_GOG_IdentifyAssetPCGW (uint32_t app_id)
               PLOG_DEBUG << "Downloading cover asset: " << assetUrl;
 
               SKIF_Util_GetWebResource (SK_UTF8ToWideChar (assetUrl), targetAssetPath + L"cover-pcgw.png");
+              SKIF_AssetIndex::GetInstance ( ).update (targetAssetPath + L"cover-pcgw.png");
             }
           }
         }
@@ -0,0 +1,52578 @@
+//
+// Copyright 2020 Andon "Kaldaien" Coleman
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+//
+
+#include <stores/Steam/apps_ignore.h>
+#include <algorithm>
+#include <iterator>
+
+// IDs related to apps, DLCs, music, and tools that should never be listed as games.
+//   Kept sorted so membership is a binary search, and only ever compiled once.
+static constexpr uint32_t steam_apps_ignorable[] = {
+  5,
+  90,
+  205,
+  211,
+  215,
+  218,
+  310,
+  456,
+  457,
+  458,
+  459,
+  510,
+  513,
+  540,
+  563,
+  565,
+  576,
+  581,
+  582,
+  583,
+  584,
+  585,
+  586,
+  629,
+  635,
+  640,
+  644,
+  650,
+  651,
+  652,
+  653,
+  654,
+  660,
+  669,
+  740,
+  745,
+  1007,
+  1213,
+  1220,
+  1240,
+  1255,
+  1256,
+  1257,
+  1260,
+  1273,
+  1290,
+  1317,
+  1507,
+  1515,
+  1528,
+  1535,
+  1635,
+  1645,
+  1840,
+  2145,
+  2150,
+  2403,
+  2460,
+  2505,
+  2725,
+  2726,
+  2740,
+  2754,
+  2755,
+  2767,
+  2768,
+  2770,
+  2826,
+  2827,
+  2860,
+  3205,
+  3750,
+  3838,
+  3839,
+  4020,
+  4207,
+  4240,
+  4270,
+  4480,
+  4856,
+  4930,
+  4931,
+  4932,
+  4940,
+  6122,
+  7270,
+  8610,
+  8680,
+  8710,
+  8730,
+  8770,
+  8955,
+  8960,
+  8990,
+  9240,
+  9241,
+  9370,
+  9905,
+  9906,
+  9907,
+  9908,
+  9910,
+  9932,
+  9933,
+  9942,
+  9992,
+  10030,
+  10195,
+  10196,
+  10197,
+  10600,
+  10601,
+  10602,
+  10603,
+  10604,
+  10605,
+  10606,
+  10607,
+  10608,
+  10609,
+  10695,
+  10696,
+  10697,
+  11070,
+  11172,
+  12880,
+  13160,
+  13180,
+  13260,
+  15522,
+  16465,
+  16830,
+  16860,
+  16861,
+  16862,
+  16863,
+  16864,
+  16865,
+  16866,
+  16867,
+  16868,
+  16870,
+  16872,
+  16879,
+  17040,
+  17095,
+  17096,
+  17097,
+  17210,
+  17220,
+  17505,
+  17515,
+  17525,
+  17535,
+  17555,
+  17575,
+  17585,
+  17595,
+  17705,
+  17714,
+  18052,
+  18053,
+  18060,
+  18061,
+  18080,
+  18081,
+  18112,
+  18403,
+  18407,
+  18408,
+  18507,
+  18508,
+  18509,
+  18520,
+  18521,
+  18522,
+  18523,
+  18530,
+  18531,
+  18532,
+  18533,
+  18534,
+  19890,
+  19940,
+  19950,
+  19960,
+  19970,
+  20004,
+  20005,
+  20828,
+  20902,
+  20930,
+  21150,
+  21160,
+  21200,
+  21201,
+  21202,
+  21203,
+  21204,
+  21205,
+  21206,
+  21207,
+  21208,
+  21209,
+  21210,
+  21211,
+  21212,
+  21213,
+  21214,
+  21215,
+  21216,
+  21217,
+  21218,
+  21219,
+  21220,
+  21221,
+  21222,
+  21223,
+  21224,
+  21225,
+  21226,
+  21227,
+  21228,
+  21960,
+  21963,
+  21964,
+  21995,
+  21996,
+  21999,
+  22208,
+  22333,
+  22360,
+  22361,
+  22362,
+  22363,
+  22364,
+  22365,
+  22400,
+  22410,
+  22420,
+  22430,
+  22440,
+  22456,
+  22460,
+  22465,
+  22470,
+  22475,
+  22480,
+  22510,
+  22520,
+  22521,
+  22618,
+  22630,
+  22631,
+  22632,
+  22633,
+  22634,
+  22635,
+  22636,
+  22637,
+  22638,
+  22639,
+  22640,
+  22641,
+  22642,
+  22658,
+  22678,
+  23455,
+  23550,
+  23551,
+  23552,
+  23553,
+  24012,
+  24021,
+  24022,
+  24023,
+  24024,
+  24025,
+  24026,
+  24027,
+  24028,
+  24029,
+  24030,
+  24031,
+  24032,
+  24033,
+  24034,
+  24035,
+  24036,
+  24037,
+  24038,
+  24039,
+  24040,
+  24041,
+  24042,
+  24043,
+  24044,
+  24045,
+  24046,
+  24047,
+  24048,
+  24049,
+  24050,
+  24051,
+  24052,
+  24053,
+  24054,
+  24055,
+  24056,
+  24057,
+  24058,
+  24059,
+  24060,
+  24061,
+  24062,
+  24063,
+  24064,
+  24065,
+  24066,
+  24067,
+  24068,
+  24069,
+  24070,
+  24071,
+  24072,
+  24073,
+  24074,
+  24075,
+  24076,
+  24077,
+  24078,
+  24079,
+  24080,
+  24081,
+  24082,
+  24083,
+  24084,
+  24085,
+  24086,
+  24087,
+  24088,
+  24089,
+  24090,
+  24091,
+  24092,
+  24093,
+  24094,
+  24095,
+  24096,
+  24097,
+  24098,
+  24099,
+  24100,
+  24110,
+  24135,
+  24190,
+  24208,
+  24209,
+  24230,
+  24422,
+  24440,
+  24441,
+  24447,
+  24448,
+  24449,
+  24450,
+  24451,
+  24483,
+  24486,
+  24487,
+  24488,
+  24496,
+  24497,
+  24634,
+  24635,
+  24637,
+  24673,
+  24674,
+  24675,
+  24676,
+  24677,
+  24678,
+  24679,
+  24932,
+  24934,
+  24935,
+  24936,
+  24937,
+  24938,
+  24939,
+  24962,
+  24963,
+  24992,
+  24993,
+  24994,
+  24995,
+  24996,
+  24997,
+  24998,
+  25300,
+  25310,
+  25320,
+  25330,
+  25340,
+  25350,
+  25360,
+  25370,
+  25380,
+  25390,
+  25740,
+  25750,
+  25751,
+  25752,
+  25753,
+  25754,
+  25755,
+  25756,
+  25757,
+  25758,
+  25759,
+  25760,
+  25761,
+  25762,
+  25763,
+  25764,
+  25765,
+  25806,
+  25808,
+  25809,
+  25810,
+  25811,
+  25812,
+  25813,
+  25814,
+  25815,
+  25816,
+  25817,
+  25892,
+  25893,
+  25896,
+  25897,
+  25898,
+  25899,
+  25940,
+  25960,
+  25962,
+  25985,
+  26005,
+  26006,
+  26007,
+  26100,
+  26110,
+  26120,
+  26130,
+  26140,
+  26160,
+  26170,
+  26180,
+  26803,
+  28010,
+  28011,
+  28012,
+  28013,
+  28014,
+  28015,
+  28017,
+  28060,
+  28061,
+  28110,
+  29540,
+  29560,
+  29570,
+  29580,
+  29600,
+  29610,
+  29620,
+  29630,
+  29700,
+  29710,
+  30010,
+  30040,
+  31420,
+  31713,
+  31720,
+  32472,
+  32830,
+  32831,
+  32832,
+  32833,
+  32834,
+  33242,
+  33245,
+  33246,
+  33287,
+  33288,
+  33325,
+  33326,
+  33360,
+  33361,
+  33362,
+  33370,
+  33371,
+  33372,
+  33428,
+  33435,
+  33436,
+  33446,
+  33447,
+  33448,
+  33456,
+  33457,
+  33905,
+  33933,
+  33934,
+  33935,
+  33936,
+  33960,
+  34120,
+  34170,
+  34171,
+  34172,
+  34173,
+  34174,
+  34175,
+  34176,
+  34177,
+  34178,
+  34179,
+  34184,
+  34189,
+  34272,
+  34273,
+  34274,
+  34275,
+  34276,
+  34277,
+  34278,
+  34279,
+  34280,
+  34281,
+  34282,
+  34283,
+  34284,
+  34285,
+  34286,
+  34287,
+  34288,
+  34289,
+  34310,
+  34311,
+  34312,
+  34313,
+  34314,
+  34315,
+  34316,
+  34317,
+  34318,
+  34319,
+  34342,
+  34343,
+  34344,
+  34345,
+  34346,
+  34347,
+  34348,
+  34490,
+  34491,
+  34492,
+  34493,
+  34494,
+  34495,
+  34496,
+  34497,
+  34498,
+  34610,
+  34611,
+  34612,
+  34613,
+  34614,
+  34615,
+  34616,
+  34841,
+  34842,
+  34850,
+  35060,
+  35080,
+  35081,
+  35082,
+  35083,
+  35084,
+  35085,
+  35086,
+  35087,
+  35088,
+  35089,
+  35090,
+  35091,
+  35092,
+  35093,
+  35094,
+  35095,
+  35096,
+  35097,
+  35098,
+  35099,
+  35100,
+  35101,
+  35102,
+  35103,
+  35134,
+  35135,
+  35136,
+  35137,
+  35138,
+  35417,
+  35418,
+  35419,
+  35425,
+  35426,
+  35427,
+  35429,
+  35485,
+  35723,
+  35725,
+  36632,
+  36633,
+  37709,
+  38185,
+  38743,
+  38920,
+  38921,
+  38922,
+  38923,
+  38924,
+  38925,
+  38926,
+  38927,
+  39122,
+  39123,
+  39124,
+  39125,
+  39126,
+  39127,
+  39128,
+  39129,
+  39180,
+  39181,
+  39182,
+  39183,
+  39184,
+  39185,
+  39251,
+  39261,
+  39270,
+  39570,
+  39580,
+  40002,
+  40003,
+  40004,
+  40005,
+  40006,
+  40125,
+  40130,
+  40131,
+  40132,
+  40133,
+  40134,
+  40135,
+  40136,
+  40230,
+  40391,
+  40392,
+  40393,
+  40403,
+  40406,
+  40407,
+  40408,
+  40703,
+  40810,
+  40940,
+  41005,
+  41014,
+  41015,
+  41017,
+  41018,
+  41019,
+  41040,
+  41045,
+  41046,
+  41073,
+  41074,
+  41080,
+  41090,
+  41520,
+  41802,
+  41803,
+  41804,
+  41805,
+  41807,
+  41808,
+  41809,
+  41813,
+  41814,
+  41815,
+  41816,
+  41817,
+  42110,
+  42129,
+  42147,
+  42180,
+  42300,
+  42320,
+  42520,
+  42521,
+  42695,
+  42696,
+  42697,
+  42698,
+  42715,
+  42716,
+  42717,
+  42718,
+  42719,
+  42720,
+  42722,
+  42723,
+  42729,
+  42740,
+  42750,
+  42800,
+  42820,
+  42840,
+  42841,
+  42842,
+  42843,
+  42844,
+  42845,
+  42846,
+  42847,
+  42848,
+  42849,
+  42860,
+  42881,
+  42895,
+  42900,
+  42901,
+  42902,
+  42903,
+  42904,
+  42905,
+  42914,
+  42916,
+  42917,
+  42918,
+  42919,
+  42925,
+  42926,
+  42929,
+  42964,
+  42965,
+  42966,
+  42967,
+  42968,
+  43005,
+  43006,
+  43011,
+  43012,
+  43013,
+  43014,
+  43015,
+  43016,
+  43120,
+  43130,
+  43140,
+  43163,
+  43210,
+  44720,
+  45302,
+  45772,
+  45773,
+  45774,
+  45775,
+  45776,
+  45777,
+  45778,
+  45790,
+  45791,
+  45792,
+  45793,
+  45794,
+  45795,
+  45796,
+  45797,
+  45798,
+  46342,
+  46362,
+  46390,
+  46523,
+  46792,
+  47420,
+  47421,
+  47422,
+  47423,
+  47424,
+  47426,
+  47430,
+  47720,
+  47721,
+  47722,
+  47723,
+  47749,
+  47815,
+  47842,
+  47843,
+  47844,
+  47880,
+  47892,
+  47893,
+  47894,
+  47895,
+  47896,
+  47897,
+  47898,
+  47899,
+  47911,
+  47912,
+  47930,
+  47931,
+  47932,
+  47933,
+  47934,
+  47935,
+  47936,
+  48124,
+  48127,
+  48128,
+  48131,
+  48132,
+  48136,
+  48137,
+  48138,
+  48140,
+  48165,
+  48166,
+  48167,
+  48173,
+  48185,
+  48186,
+  48187,
+  48195,
+  48196,
+  48197,
+  48198,
+  48218,
+  48219,
+  48224,
+  48225,
+  48226,
+  48227,
+  48228,
+  48229,
+  48231,
+  48232,
+  48233,
+  48234,
+  48258,
+  48259,
+  48705,
+  48802,
+  48803,
+  48804,
+  48805,
+  48806,
+  48830,
+  49310,
+  49311,
+  49312,
+  49313,
+  49314,
+  49315,
+  49337,
+  49402,
+  49403,
+  49404,
+  49406,
+  49407,
+  49408,
+  49409,
+  49410,
+  49411,
+  49412,
+  49413,
+  49414,
+  49415,
+  49416,
+  49417,
+  49418,
+  49419,
+  49421,
+  49422,
+  49423,
+  49424,
+  49425,
+  49426,
+  49427,
+  49428,
+  49429,
+  49430,
+  49431,
+  49432,
+  49433,
+  49434,
+  49435,
+  49436,
+  49437,
+  49438,
+  49439,
+  49440,
+  49441,
+  49442,
+  49443,
+  49473,
+  49474,
+  49475,
+  49476,
+  49477,
+  49478,
+  49479,
+  49490,
+  49491,
+  49492,
+  49493,
+  49494,
+  49495,
+  49496,
+  49497,
+  49498,
+  49499,
+  49603,
+  49604,
+  49605,
+  50110,
+  50140,
+  50141,
+  50142,
+  50143,
+  50144,
+  50145,
+  50146,
+  50147,
+  50203,
+  50204,
+  50205,
+  50206,
+  50207,
+  50208,
+  50209,
+  50210,
+  50212,
+  50213,
+  50214,
+  50215,
+  50219,
+  50233,
+  50234,
+  50235,
+  50236,
+  50237,
+  50238,
+  50239,
+  50253,
+  50254,
+  50255,
+  50256,
+  50257,
+  50258,
+  50259,
+  50273,
+  50274,
+  50275,
+  50276,
+  50277,
+  50278,
+  50279,
+  50410,
+  50411,
+  50412,
+  50413,
+  50414,
+  50415,
+  50416,
+  50417,
+  50430,
+  50431,
+  50432,
+  50433,
+  50434,
+  50435,
+  50436,
+  50437,
+  50438,
+  50439,
+  50440,
+  50513,
+  55112,
+  55113,
+  55114,
+  55115,
+  55162,
+  55163,
+  55164,
+  55182,
+  55203,
+  55204,
+  55205,
+  55206,
+  55207,
+  55208,
+  55215,
+  55216,
+  55217,
+  55218,
+  55220,
+  55221,
+  55222,
+  55223,
+  55280,
+  55340,
+  55341,
+  55342,
+  55343,
+  55344,
+  55345,
+  55346,
+  55347,
+  55348,
+  55349,
+  55380,
+  55381,
+  55382,
+  55383,
+  55384,
+  55385,
+  55386,
+  55387,
+  55388,
+  55389,
+  55390,
+  55391,
+  55392,
+  55393,
+  55394,
+  55395,
+  55396,
+  55397,
+  55398,
+  55399,
+  55400,
+  55409,
+  55470,
+  55471,
+  55472,
+  55473,
+  55474,
+  55475,
+  55476,
+  56431,
+  56432,
+  56433,
+  56434,
+  56435,
+  56436,
+  56437,
+  56438,
+  56439,
+  56480,
+  56481,
+  56482,
+  56483,
+  56484,
+  56485,
+  56486,
+  56487,
+  56488,
+  56489,
+  56490,
+  56491,
+  56492,
+  56493,
+  56536,
+  56537,
+  56538,
+  57505,
+  57506,
+  57515,
+  57516,
+  57517,
+  57518,
+  57655,
+  57656,
+  57695,
+  57696,
+  57697,
+  57910,
+  57920,
+  57921,
+  57922,
+  57923,
+  57924,
+  57925,
+  57980,
+  58529,
+  58625,
+  58643,
+  58645,
+  58646,
+  58647,
+  58648,
+  58649,
+  60602,
+  61710,
+  63003,
+  63004,
+  63005,
+  63210,
+  63211,
+  63212,
+  63213,
+  63220,
+  63391,
+  63392,
+  63398,
+  63399,
+  63802,
+  63803,
+  63920,
+  63942,
+  63953,
+  63958,
+  63959,
+  64002,
+  64005,
+  64008,
+  64009,
+  64013,
+  64014,
+  64016,
+  64017,
+  65110,
+  65210,
+  65211,
+  65212,
+  65213,
+  65214,
+  65215,
+  65216,
+  65217,
+  65218,
+  65219,
+  65220,
+  65221,
+  65222,
+  65223,
+  65224,
+  65225,
+  65226,
+  65227,
+  65228,
+  65229,
+  65230,
+  65231,
+  65232,
+  65233,
+  65234,
+  65235,
+  65236,
+  65237,
+  65238,
+  65239,
+  65240,
+  65241,
+  65242,
+  65243,
+  65244,
+  65245,
+  65246,
+  65247,
+  65248,
+  65249,
+  65250,
+  65251,
+  65252,
+  65253,
+  65254,
+  65255,
+  65256,
+  65257,
+  65258,
+  65259,
+  65302,
+  65732,
+  65733,
+  65734,
+  65735,
+  65810,
+  65811,
+  65920,
+  65959,
+  66000,
+  66001,
+  66002,
+  66003,
+  67210,
+  67250,
+  67310,
+  67350,
+  67379,
+  67400,
+  67401,
+  67402,
+  67683,
+  67684,
+  70004,
+  70010,
+  70603,
+  70604,
+  70605,
+  70606,
+  70607,
+  70608,
+  70609,
+  70610,
+  70611,
+  70615,
+  70616,
+  70617,
+  70631,
+  71110,
+  71111,
+  71112,
+  71113,
+  71114,
+  71115,
+  71116,
+  71117,
+  71118,
+  71119,
+  71120,
+  71160,
+  71161,
+  71162,
+  71163,
+  71164,
+  71165,
+  71166,
+  71167,
+  71168,
+  71275,
+  71400,
+  71410,
+  72310,
+  72701,
+  72705,
+  72709,
+  72713,
+  72730,
+  72740,
+  72750,
+  72760,
+  72770,
+  72771,
+  72772,
+  72773,
+  72774,
+  72780,
+  72840,
+  72902,
+  72903,
+  72904,
+  72905,
+  72906,
+  72907,
+  73012,
+  73013,
+  73014,
+  73016,
+  73017,
+  73018,
+  73030,
+  73031,
+  73032,
+  73033,
+  73034,
+  73035,
+  73036,
+  73037,
+  73038,
+  73039,
+  73040,
+  73041,
+  73054,
+  73055,
+  73056,
+  73057,
+  73058,
+  73059,
+  73071,
+  73088,
+  73089,
+  73091,
+  73092,
+  73093,
+  73094,
+  73095,
+  73096,
+  73097,
+  73098,
+  73099,
+  73108,
+  73109,
+  73110,
+  73111,
+  73112,
+  73113,
+  73114,
+  73115,
+  73118,
+  73119,
+  73120,
+  73121,
+  73179,
+  73180,
+  73181,
+  73182,
+  73183,
+  73184,
+  73185,
+  73186,
+  73187,
+  73188,
+  73192,
+  73193,
+  73194,
+  73195,
+  80010,
+  80202,
+  80204,
+  80205,
+  80206,
+  80207,
+  80222,
+  90207,
+  90208,
+  90209,
+  90210,
+  90503,
+  90504,
+  90900,
+  91104,
+  91106,
+  91333,
+  91342,
+  91345,
+  91346,
+  91602,
+  91603,
+  91604,
+  91605,
+  91606,
+  91607,
+  91608,
+  91609,
+  91612,
+  91613,
+  91614,
+  91615,
+  91616,
+  91617,
+  91618,
+  91619,
+  91621,
+  91622,
+  91623,
+  91624,
+  91720,
+  91920,
+  91930,
+  92302,
+  92303,
+  92502,
+  92503,
+  92504,
+  92505,
+  92506,
+  92507,
+  92508,
+  92620,
+  92621,
+  92622,
+  92623,
+  92803,
+  93206,
+  93207,
+  93305,
+  94202,
+  94203,
+  94205,
+  94303,
+  94304,
+  95502,
+  96308,
+  96810,
+  96831,
+  97106,
+  97107,
+  97108,
+  97300,
+  97301,
+  97302,
+  97303,
+  97304,
+  97305,
+  97306,
+  97307,
+  97308,
+  97309,
+  97310,
+  97311,
+  97312,
+  97313,
+  97314,
+  97315,
+  97316,
+  97317,
+  97318,
+  97319,
+  97320,
+  97321,
+  97322,
+  97323,
+  97324,
+  97325,
+  97326,
+  97327,
+  97328,
+  97350,
+  97360,
+  97361,
+  97362,
+  97363,
+  97364,
+  97365,
+  97366,
+  97367,
+  97368,
+  97369,
+  97370,
+  97371,
+  97372,
+  97373,
+  97374,
+  97375,
+  97376,
+  97377,
+  97378,
+  97379,
+  97380,
+  97381,
+  97382,
+  97383,
+  97384,
+  97385,
+  97386,
+  97387,
+  97388,
+  97389,
+  98001,
+  98002,
+  98003,
+  98004,
+  98005,
+  98006,
+  98007,
+  98008,
+  98009,
+  98011,
+  98012,
+  98014,
+  98015,
+  98203,
+  98204,
+  98205,
+  98210,
+  98211,
+  98212,
+  98213,
+  98214,
+  98420,
+  98421,
+  98609,
+  98820,
+  98821,
+  98822,
+  99502,
+  99508,
+  99509,
+  99610,
+  99611,
+  99612,
+  99613,
+  99841,
+  99842,
+  99843,
+  99845,
+  99846,
+  99895,
+  99896,
+  99909,
+  100400,
+  100410,
+  100940,
+  100970,
+  100973,
+  100980,
+  102000,
+  102001,
+  102002,
+  102003,
+  102020,
+  102028,
+  102029,
+  102030,
+  102031,
+  102032,
+  102033,
+  102034,
+  102035,
+  102510,
+  102511,
+  102620,
+  102621,
+  102622,
+  102623,
+  102624,
+  102625,
+  102822,
+  102842,
+  104310,
+  105410,
+  105411,
+  105412,
+  105413,
+  105414,
+  105415,
+  105610,
+  105802,
+  106020,
+  106021,
+  107010,
+  107011,
+  107104,
+  107702,
+  107820,
+  107821,
+  108220,
+  108230,
+  108231,
+  108232,
+  108233,
+  108726,
+  108727,
+  109702,
+  110810,
+  110902,
+  111402,
+  111403,
+  111500,
+  111710,
+  111910,
+  111911,
+  111912,
+  111913,
+  111914,
+  111915,
+  111916,
+  112400,
+  112800,
+  112810,
+  113203,
+  113204,
+  113205,
+  113402,
+  113403,
+  113404,
+  113405,
+  115000,
+  115010,
+  115107,
+  115117,
+  115307,
+  115308,
+  115309,
+  115340,
+  115900,
+  115910,
+  115920,
+  116000,
+  116410,
+  200172,
+  200173,
+  200174,
+  200175,
+  200176,
+  200177,
+  200178,
+  200179,
+  200180,
+  200181,
+  200182,
+  200183,
+  200185,
+  200186,
+  200187,
+  200188,
+  200189,
+  200300,
+  200310,
+  200320,
+  200321,
+  200322,
+  200323,
+  200340,
+  200396,
+  200397,
+  200440,
+  200460,
+  200496,
+  200530,
+  200590,
+  200610,
+  200620,
+  200730,
+  200731,
+  200732,
+  200733,
+  200734,
+  200735,
+  200770,
+  200780,
+  200790,
+  200800,
+  200810,
+  200820,
+  200830,
+  200840,
+  200850,
+  200860,
+  200870,
+  200880,
+  200890,
+  200891,
+  201100,
+  201270,
+  201271,
+  201272,
+  201273,
+  201274,
+  201275,
+  201276,
+  201277,
+  201278,
+  201279,
+  201563,
+  201564,
+  201565,
+  201566,
+  201567,
+  201568,
+  201740,
+  201750,
+  201801,
+  201802,
+  201803,
+  201804,
+  201805,
+  201806,
+  201807,
+  201808,
+  201809,
+  201878,
+  201879,
+  201880,
+  201881,
+  201882,
+  201890,
+  201951,
+  201952,
+  201953,
+  201954,
+  201955,
+  201956,
+  201957,
+  201958,
+  201959,
+  201960,
+  201961,
+  201962,
+  201963,
+  201964,
+  201965,
+  201966,
+  201967,
+  201968,
+  201969,
+  201970,
+  201971,
+  201972,
+  201973,
+  202010,
+  202020,
+  202030,
+  202040,
+  202085,
+  202086,
+  202087,
+  202092,
+  202093,
+  202094,
+  202095,
+  202113,
+  202181,
+  202190,
+  202191,
+  202192,
+  202193,
+  202194,
+  202195,
+  202196,
+  202197,
+  202198,
+  202199,
+  202220,
+  202230,
+  202240,
+  202412,
+  202450,
+  202452,
+  202454,
+  202480,
+  202485,
+  202520,
+  202521,
+  202522,
+  202523,
+  202524,
+  202650,
+  202651,
+  202652,
+  202920,
+  202930,
+  202941,
+  202950,
+  202951,
+  202960,
+  202961,
+  202988,
+  203050,
+  203060,
+  203070,
+  203090,
+  203100,
+  203110,
+  203120,
+  203130,
+  203180,
+  203181,
+  203182,
+  203183,
+  203184,
+  203186,
+  203187,
+  203188,
+  203300,
+  203340,
+  203341,
+  203342,
+  203343,
+  203344,
+  203345,
+  203353,
+  203358,
+  203550,
+  203600,
+  203700,
+  203701,
+  203702,
+  203710,
+  203733,
+  203765,
+  203766,
+  203772,
+  203773,
+  203774,
+  203775,
+  203776,
+  203777,
+  203778,
+  203813,
+  203871,
+  203872,
+  203873,
+  203874,
+  203875,
+  203876,
+  203877,
+  203878,
+  203879,
+  203880,
+  203881,
+  203882,
+  204075,
+  204085,
+  204086,
+  204106,
+  204107,
+  204108,
+  204109,
+  204110,
+  204111,
+  204112,
+  204160,
+  204182,
+  204185,
+  204200,
+  204280,
+  204281,
+  204282,
+  204283,
+  204284,
+  204285,
+  204286,
+  204287,
+  204288,
+  204289,
+  204290,
+  204291,
+  204292,
+  204303,
+  204304,
+  204305,
+  204306,
+  204307,
+  204308,
+  204309,
+  204310,
+  204311,
+  204312,
+  204313,
+  204314,
+  204315,
+  204317,
+  204318,
+  204319,
+  204350,
+  204371,
+  204372,
+  204380,
+  204381,
+  204382,
+  204383,
+  204384,
+  204385,
+  204386,
+  204387,
+  204388,
+  204419,
+  204420,
+  204470,
+  204482,
+  204483,
+  204521,
+  204522,
+  204523,
+  204524,
+  204525,
+  204600,
+  204731,
+  204732,
+  204733,
+  204734,
+  204735,
+  204736,
+  204737,
+  204738,
+  204800,
+  204802,
+  204803,
+  204820,
+  204851,
+  204900,
+  204901,
+  204902,
+  205063,
+  205073,
+  205083,
+  205093,
+  205120,
+  205130,
+  205140,
+  205150,
+  205160,
+  205170,
+  205215,
+  205216,
+  205217,
+  205218,
+  205250,
+  205252,
+  205270,
+  205272,
+  205541,
+  205630,
+  205631,
+  205632,
+  205633,
+  205634,
+  205635,
+  205636,
+  205637,
+  205638,
+  205860,
+  206010,
+  206080,
+  206081,
+  206082,
+  206083,
+  206084,
+  206085,
+  206086,
+  206087,
+  206088,
+  206089,
+  206090,
+  206091,
+  206092,
+  206093,
+  206094,
+  206095,
+  206096,
+  206097,
+  206098,
+  206099,
+  206100,
+  206101,
+  206102,
+  206103,
+  206104,
+  206105,
+  206106,
+  206107,
+  206108,
+  206109,
+  206110,
+  206111,
+  206112,
+  206113,
+  206114,
+  206115,
+  206116,
+  206117,
+  206118,
+  206119,
+  206120,
+  206121,
+  206122,
+  206123,
+  206124,
+  206125,
+  206126,
+  206127,
+  206128,
+  206129,
+  206130,
+  206131,
+  206132,
+  206133,
+  206134,
+  206135,
+  206136,
+  206137,
+  206138,
+  206139,
+  206140,
+  206141,
+  206142,
+  206143,
+  206144,
+  206145,
+  206146,
+  206147,
+  206148,
+  206149,
+  206150,
+  206151,
+  206152,
+  206153,
+  206154,
+  206155,
+  206156,
+  206157,
+  206158,
+  206159,
+  206160,
+  206161,
+  206162,
+  206163,
+  206164,
+  206165,
+  206166,
+  206167,
+  206168,
+  206169,
+  206170,
+  206171,
+  206172,
+  206173,
+  206174,
+  206175,
+  206176,
+  206177,
+  206178,
+  206179,
+  206193,
+  206195,
+  206415,
+  206416,
+  206435,
+  206450,
+  206520,
+  206521,
+  206522,
+  206523,
+  206524,
+  206525,
+  206526,
+  206550,
+  206560,
+  206570,
+  206580,
+  206590,
+  206600,
+  206710,
+  206711,
+  206712,
+  206713,
+  206714,
+  206715,
+  206716,
+  206717,
+  206718,
+  206720,
+  206721,
+  206743,
+  206744,
+  206745,
+  206746,
+  206747,
+  206748,
+  206749,
+  206750,
+  206751,
+  206752,
+  206753,
+  206880,
+  206881,
+  206882,
+  207010,
+  207011,
+  207012,
+  207090,
+  207110,
+  207111,
+  207112,
+  207113,
+  207114,
+  207115,
+  207165,
+  207166,
+  207167,
+  207168,
+  207169,
+  207221,
+  207241,
+  207340,
+  207375,
+  207385,
+  207405,
+  207620,
+  207655,
+  207660,
+  207760,
+  207810,
+  207811,
+  207812,
+  207813,
+  207814,
+  207815,
+  207816,
+  207870,
+  208050,
+  208100,
+  208101,
+  208102,
+  208103,
+  208151,
+  208152,
+  208153,
+  208154,
+  208155,
+  208156,
+  208157,
+  208158,
+  208159,
+  208280,
+  208281,
+  208282,
+  208283,
+  208284,
+  208285,
+  208286,
+  208287,
+  208288,
+  208289,
+  208290,
+  208291,
+  208292,
+  208293,
+  208294,
+  208295,
+  208296,
+  208298,
+  208299,
+  208300,
+  208301,
+  208302,
+  208303,
+  208304,
+  208305,
+  208306,
+  208307,
+  208311,
+  208312,
+  208313,
+  208314,
+  208315,
+  208316,
+  208317,
+  208318,
+  208319,
+  208320,
+  208321,
+  208323,
+  208340,
+  208341,
+  208342,
+  208343,
+  208344,
+  208345,
+  208346,
+  208347,
+  208348,
+  208349,
+  208350,
+  208351,
+  208352,
+  208353,
+  208354,
+  208355,
+  208356,
+  208357,
+  208358,
+  208359,
+  208360,
+  208361,
+  208362,
+  208363,
+  208364,
+  208365,
+  208366,
+  208367,
+  208368,
+  208369,
+  208370,
+  208371,
+  208372,
+  208373,
+  208374,
+  208375,
+  208376,
+  208377,
+  208378,
+  208379,
+  208462,
+  208470,
+  208482,
+  208483,
+  208484,
+  208485,
+  208487,
+  208488,
+  208489,
+  208491,
+  208492,
+  208519,
+  208540,
+  208541,
+  208542,
+  208543,
+  208544,
+  208545,
+  208546,
+  208570,
+  208575,
+  208690,
+  208691,
+  208740,
+  208741,
+  208742,
+  208743,
+  208744,
+  208745,
+  208746,
+  208747,
+  208748,
+  208749,
+  208790,
+  208791,
+  208792,
+  208793,
+  208795,
+  208796,
+  208797,
+  208798,
+  208799,
+  208800,
+  208801,
+  208802,
+  208803,
+  208804,
+  208805,
+  208806,
+  208807,
+  208808,
+  208809,
+  208810,
+  208811,
+  208812,
+  208813,
+  208814,
+  208816,
+  208817,
+  208818,
+  208830,
+  208831,
+  208832,
+  208833,
+  208834,
+  208835,
+  208836,
+  208837,
+  208838,
+  208839,
+  208840,
+  208841,
+  208842,
+  208843,
+  208844,
+  208881,
+  208911,
+  208980,
+  208981,
+  208982,
+  208983,
+  208984,
+  208985,
+  209181,
+  209182,
+  209201,
+  209202,
+  209300,
+  209301,
+  209302,
+  209303,
+  209304,
+  209305,
+  209306,
+  209307,
+  209308,
+  209309,
+  209310,
+  209343,
+  209362,
+  209373,
+  209375,
+  209421,
+  209422,
+  209423,
+  209424,
+  209425,
+  209426,
+  209427,
+  209428,
+  209429,
+  209460,
+  209470,
+  209545,
+  209546,
+  209547,
+  209548,
+  209720,
+  209721,
+  209771,
+  209772,
+  209793,
+  209801,
+  209810,
+  209811,
+  209812,
+  209813,
+  209814,
+  209815,
+  209816,
+  209817,
+  209872,
+  209873,
+  209874,
+  209875,
+  209876,
+  209877,
+  209990,
+  209991,
+  210010,
+  210011,
+  210012,
+  210013,
+  210014,
+  210015,
+  210016,
+  210017,
+  210018,
+  210019,
+  210030,
+  210031,
+  210032,
+  210033,
+  210034,
+  210035,
+  210036,
+  210037,
+  210038,
+  210039,
+  210040,
+  210041,
+  210042,
+  210043,
+  210044,
+  210045,
+  210046,
+  210047,
+  210048,
+  210049,
+  210050,
+  210051,
+  210052,
+  210053,
+  210054,
+  210055,
+  210056,
+  210057,
+  210058,
+  210059,
+  210060,
+  210061,
+  210062,
+  210063,
+  210064,
+  210065,
+  210066,
+  210067,
+  210068,
+  210069,
+  210070,
+  210071,
+  210072,
+  210073,
+  210074,
+  210075,
+  210076,
+  210077,
+  210078,
+  210079,
+  210080,
+  210081,
+  210082,
+  210083,
+  210084,
+  210085,
+  210086,
+  210087,
+  210088,
+  210089,
+  210090,
+  210091,
+  210092,
+  210093,
+  210094,
+  210095,
+  210096,
+  210097,
+  210098,
+  210099,
+  210100,
+  210101,
+  210102,
+  210103,
+  210104,
+  210105,
+  210106,
+  210107,
+  210108,
+  210109,
+  210110,
+  210111,
+  210112,
+  210113,
+  210370,
+  210450,
+  210510,
+  210560,
+  210561,
+  210562,
+  210580,
+  210600,
+  210620,
+  210640,
+  210660,
+  210680,
+  210892,
+  210893,
+  210894,
+  210895,
+  210896,
+  210897,
+  210898,
+  210899,
+  210900,
+  210901,
+  210902,
+  210903,
+  210904,
+  210905,
+  210906,
+  210907,
+  210908,
+  210931,
+  210932,
+  210933,
+  210934,
+  210936,
+  210937,
+  210938,
+  210939,
+  210942,
+  210943,
+  210944,
+  210945,
+  210999,
+  211000,
+  211001,
+  211131,
+  211132,
+  211200,
+  211201,
+  211202,
+  211203,
+  211204,
+  211205,
+  211206,
+  211207,
+  211208,
+  211209,
+  211262,
+  211320,
+  211321,
+  211322,
+  211419,
+  211520,
+  211521,
+  211522,
+  211523,
+  211691,
+  211692,
+  211693,
+  211720,
+  211775,
+  211776,
+  211777,
+  211950,
+  211951,
+  211952,
+  211953,
+  211954,
+  211990,
+  211991,
+  211992,
+  211994,
+  212041,
+  212170,
+  212171,
+  212172,
+  212210,
+  212211,
+  212301,
+  212432,
+  212433,
+  212434,
+  212435,
+  212436,
+  212437,
+  212438,
+  212439,
+  212440,
+  212441,
+  212442,
+  212443,
+  212444,
+  212445,
+  212446,
+  212447,
+  212448,
+  212449,
+  212450,
+  212520,
+  212521,
+  212530,
+  212531,
+  212532,
+  212540,
+  212541,
+  212601,
+  212602,
+  212603,
+  212604,
+  212671,
+  212672,
+  212673,
+  212675,
+  212676,
+  212677,
+  212679,
+  212710,
+  212751,
+  212752,
+  212753,
+  212890,
+  212891,
+  212892,
+  212893,
+  212894,
+  213040,
+  213151,
+  213152,
+  213153,
+  213154,
+  213155,
+  213170,
+  213171,
+  213172,
+  213173,
+  213174,
+  213175,
+  213176,
+  213177,
+  213178,
+  213179,
+  213190,
+  213191,
+  213192,
+  213193,
+  213194,
+  213195,
+  213196,
+  213197,
+  213198,
+  213199,
+  213210,
+  213230,
+  213231,
+  213250,
+  213310,
+  213311,
+  213312,
+  213370,
+  213661,
+  213662,
+  213663,
+  213664,
+  213665,
+  213666,
+  213667,
+  213668,
+  213669,
+  213780,
+  213781,
+  213782,
+  213860,
+  213890,
+  213891,
+  213892,
+  213893,
+  213894,
+  213895,
+  213896,
+  213897,
+  213898,
+  213899,
+  213900,
+  213901,
+  213902,
+  213903,
+  213904,
+  213905,
+  213906,
+  213907,
+  213908,
+  213909,
+  213930,
+  213931,
+  213932,
+  213933,
+  214120,
+  214269,
+  214290,
+  214291,
+  214292,
+  214330,
+  214331,
+  214332,
+  214440,
+  214441,
+  214442,
+  214530,
+  214531,
+  214643,
+  214644,
+  214645,
+  214646,
+  214647,
+  214648,
+  214649,
+  214652,
+  214653,
+  214750,
+  214850,
+  214930,
+  214931,
+  214932,
+  214933,
+  214934,
+  214935,
+  214936,
+  214937,
+  214980,
+  214981,
+  214982,
+  214983,
+  214984,
+  214985,
+  214986,
+  214987,
+  214988,
+  214989,
+  214990,
+  214991,
+  215000,
+  215001,
+  215002,
+  215003,
+  215004,
+  215005,
+  215200,
+  215240,
+  215241,
+  215242,
+  215243,
+  215244,
+  215245,
+  215246,
+  215247,
+  215248,
+  215249,
+  215250,
+  215251,
+  215252,
+  215253,
+  215254,
+  215255,
+  215256,
+  215257,
+  215258,
+  215259,
+  215261,
+  215263,
+  215291,
+  215301,
+  215302,
+  215303,
+  215304,
+  215305,
+  215306,
+  215307,
+  215308,
+  215309,
+  215310,
+  215311,
+  215312,
+  215313,
+  215314,
+  215315,
+  215316,
+  215317,
+  215318,
+  215319,
+  215320,
+  215321,
+  215370,
+  215371,
+  215372,
+  215373,
+  215374,
+  215430,
+  215431,
+  215432,
+  215433,
+  215434,
+  215435,
+  215436,
+  215437,
+  215532,
+  215533,
+  215534,
+  215535,
+  215536,
+  215537,
+  215772,
+  215811,
+  215812,
+  215813,
+  215814,
+  215815,
+  215816,
+  215817,
+  215818,
+  215819,
+  215820,
+  215821,
+  215822,
+  215823,
+  215824,
+  215825,
+  215826,
+  215827,
+  215850,
+  215851,
+  215852,
+  215853,
+  215854,
+  215855,
+  215856,
+  215857,
+  215858,
+  215859,
+  215860,
+  215910,
+  215911,
+  215912,
+  215913,
+  215914,
+  215915,
+  215916,
+  215917,
+  215918,
+  215919,
+  215920,
+  215921,
+  215922,
+  215923,
+  215924,
+  215970,
+  215971,
+  215972,
+  215973,
+  215974,
+  215990,
+  215991,
+  215992,
+  215993,
+  215994,
+  215995,
+  215996,
+  215997,
+  215998,
+  216010,
+  216070,
+  216152,
+  216153,
+  216170,
+  216171,
+  216172,
+  216173,
+  216174,
+  216280,
+  216330,
+  216331,
+  216332,
+  216333,
+  216334,
+  216335,
+  216411,
+  216412,
+  216413,
+  216414,
+  216415,
+  216416,
+  216417,
+  216418,
+  216419,
+  216420,
+  216421,
+  216429,
+  216430,
+  216431,
+  216432,
+  216433,
+  216434,
+  216435,
+  216436,
+  216437,
+  216438,
+  216439,
+  216440,
+  216441,
+  216442,
+  216443,
+  216444,
+  216445,
+  216446,
+  216447,
+  216448,
+  216449,
+  216450,
+  216451,
+  216452,
+  216453,
+  216454,
+  216455,
+  216456,
+  216457,
+  216458,
+  216459,
+  216460,
+  216461,
+  216462,
+  216463,
+  216464,
+  216465,
+  216466,
+  216467,
+  216468,
+  216469,
+  216630,
+  216631,
+  216632,
+  216633,
+  216840,
+  216950,
+  217115,
+  217221,
+  217222,
+  217300,
+  217310,
+  217350,
+  217370,
+  217390,
+  217410,
+  217430,
+  217450,
+  217507,
+  217508,
+  217510,
+  217530,
+  217550,
+  217570,
+  217590,
+  217610,
+  217630,
+  217650,
+  217670,
+  217760,
+  217780,
+  217781,
+  217782,
+  217810,
+  217811,
+  217812,
+  217850,
+  217900,
+  217940,
+  217941,
+  217942,
+  217960,
+  217961,
+  217962,
+  218064,
+  218065,
+  218100,
+  218180,
+  218240,
+  218241,
+  218242,
+  218430,
+  218455,
+  218461,
+  218462,
+  218463,
+  218490,
+  218491,
+  218492,
+  218530,
+  218550,
+  218560,
+  218571,
+  218572,
+  218573,
+  218574,
+  218575,
+  218576,
+  218577,
+  218578,
+  218579,
+  218582,
+  218630,
+  218760,
+  218780,
+  218781,
+  218782,
+  218783,
+  218784,
+  218785,
+  218786,
+  218841,
+  218842,
+  218843,
+  218844,
+  219091,
+  219092,
+  219093,
+  219094,
+  219095,
+  219096,
+  219097,
+  219098,
+  219099,
+  219101,
+  219102,
+  219103,
+  219104,
+  219130,
+  219131,
+  219133,
+  219134,
+  219135,
+  219136,
+  219152,
+  219210,
+  219211,
+  219212,
+  219213,
+  219214,
+  219300,
+  219320,
+  219380,
+  219411,
+  219412,
+  219413,
+  219440,
+  219441,
+  219442,
+  219443,
+  219444,
+  219445,
+  219446,
+  219447,
+  219448,
+  219480,
+  219500,
+  219620,
+  219621,
+  219622,
+  219623,
+  219624,
+  219625,
+  219626,
+  219627,
+  219628,
+  219629,
+  219630,
+  219750,
+  219970,
+  220070,
+  220120,
+  220121,
+  220140,
+  220159,
+  220180,
+  220280,
+  220285,
+  220400,
+  220600,
+  220620,
+  220640,
+  220700,
+  220760,
+  220800,
+  220801,
+  220802,
+  220803,
+  220804,
+  220805,
+  220806,
+  220807,
+  220808,
+  220809,
+  220810,
+  220811,
+  220812,
+  220813,
+  220819,
+  220822,
+  220823,
+  220824,
+  220825,
+  220960,
+  220980,
+  221000,
+  221001,
+  221090,
+  221091,
+  221092,
+  221093,
+  221094,
+  221095,
+  221160,
+  221161,
+  221162,
+  221164,
+  221165,
+  221166,
+  221167,
+  221168,
+  221169,
+  221200,
+  221220,
+  221445,
+  221500,
+  221710,
+  221829,
+  221890,
+  221931,
+  222020,
+  222021,
+  222041,
+  222042,
+  222043,
+  222044,
+  222045,
+  222046,
+  222047,
+  222048,
+  222049,
+  222050,
+  222051,
+  222052,
+  222053,
+  222054,
+  222055,
+  222056,
+  222057,
+  222058,
+  222059,
+  222060,
+  222061,
+  222062,
+  222063,
+  222064,
+  222065,
+  222066,
+  222067,
+  222068,
+  222069,
+  222070,
+  222071,
+  222072,
+  222073,
+  222074,
+  222075,
+  222076,
+  222077,
+  222078,
+  222079,
+  222080,
+  222081,
+  222082,
+  222083,
+  222084,
+  222085,
+  222086,
+  222087,
+  222088,
+  222089,
+  222090,
+  222091,
+  222092,
+  222093,
+  222094,
+  222095,
+  222096,
+  222097,
+  222098,
+  222099,
+  222100,
+  222101,
+  222102,
+  222103,
+  222104,
+  222105,
+  222106,
+  222107,
+  222108,
+  222109,
+  222110,
+  222111,
+  222112,
+  222113,
+  222114,
+  222115,
+  222116,
+  222117,
+  222118,
+  222119,
+  222120,
+  222121,
+  222122,
+  222138,
+  222139,
+  222220,
+  222221,
+  222222,
+  222223,
+  222224,
+  222225,
+  222240,
+  222280,
+  222281,
+  222282,
+  222283,
+  222284,
+  222285,
+  222360,
+  222380,
+  222381,
+  222382,
+  222383,
+  222530,
+  222531,
+  222532,
+  222540,
+  222541,
+  222542,
+  222543,
+  222544,
+  222545,
+  222546,
+  222547,
+  222548,
+  222549,
+  222550,
+  222551,
+  222554,
+  222555,
+  222556,
+  222557,
+  222558,
+  222561,
+  222562,
+  222564,
+  222565,
+  222566,
+  222567,
+  222568,
+  222569,
+  222570,
+  222571,
+  222572,
+  222573,
+  222574,
+  222575,
+  222576,
+  222577,
+  222578,
+  222579,
+  222580,
+  222581,
+  222582,
+  222583,
+  222584,
+  222585,
+  222586,
+  222587,
+  222588,
+  222589,
+  222590,
+  222591,
+  222593,
+  222594,
+  222595,
+  222596,
+  222597,
+  222598,
+  222599,
+  222601,
+  222602,
+  222603,
+  222604,
+  222605,
+  222606,
+  222607,
+  222608,
+  222609,
+  222610,
+  222611,
+  222612,
+  222613,
+  222615,
+  222616,
+  222617,
+  222618,
+  222619,
+  222621,
+  222622,
+  222623,
+  222624,
+  222625,
+  222626,
+  222627,
+  222628,
+  222629,
+  222630,
+  222631,
+  222632,
+  222633,
+  222634,
+  222635,
+  222636,
+  222637,
+  222638,
+  222639,
+  222680,
+  222710,
+  222801,
+  222802,
+  222803,
+  222804,
+  222805,
+  222806,
+  222807,
+  222840,
+  222860,
+  222890,
+  222960,
+  222961,
+  222962,
+  222970,
+  222971,
+  222972,
+  222973,
+  223031,
+  223032,
+  223070,
+  223160,
+  223180,
+  223181,
+  223240,
+  223250,
+  223260,
+  223261,
+  223262,
+  223311,
+  223312,
+  223313,
+  223314,
+  223315,
+  223316,
+  223317,
+  223318,
+  223319,
+  223320,
+  223321,
+  223350,
+  223540,
+  223590,
+  223591,
+  223592,
+  223593,
+  223594,
+  223595,
+  223597,
+  223598,
+  223691,
+  223732,
+  223770,
+  223790,
+  223791,
+  223792,
+  223793,
+  223794,
+  223850,
+  223852,
+  224140,
+  224141,
+  224142,
+  224143,
+  224144,
+  224145,
+  224160,
+  224161,
+  224162,
+  224163,
+  224164,
+  224165,
+  224166,
+  224167,
+  224168,
+  224180,
+  224200,
+  224240,
+  224241,
+  224242,
+  224243,
+  224244,
+  224245,
+  224325,
+  224326,
+  224327,
+  224380,
+  224462,
+  224560,
+  224610,
+  224611,
+  224612,
+  224613,
+  224614,
+  224615,
+  224616,
+  224620,
+  224763,
+  224840,
+  225010,
+  225270,
+  225340,
+  225370,
+  225423,
+  225424,
+  225426,
+  225428,
+  225429,
+  225430,
+  225431,
+  225432,
+  225434,
+  225700,
+  225780,
+  225820,
+  225821,
+  225822,
+  225823,
+  225824,
+  225825,
+  225826,
+  225827,
+  225828,
+  225829,
+  225830,
+  225831,
+  225832,
+  225833,
+  225834,
+  225999,
+  226190,
+  226191,
+  226192,
+  226193,
+  226194,
+  226195,
+  226196,
+  226197,
+  226198,
+  226260,
+  226330,
+  226331,
+  226332,
+  226333,
+  226334,
+  226335,
+  226336,
+  226337,
+  226338,
+  226350,
+  226370,
+  226390,
+  226451,
+  226452,
+  226453,
+  226454,
+  226457,
+  226458,
+  226459,
+  226470,
+  226490,
+  226491,
+  226660,
+  226662,
+  226663,
+  226664,
+  226665,
+  226666,
+  226667,
+  226668,
+  226669,
+  226670,
+  226671,
+  226672,
+  226673,
+  226800,
+  226801,
+  226880,
+  226990,
+  226991,
+  226992,
+  226993,
+  226994,
+  226995,
+  226996,
+  226997,
+  226998,
+  226999,
+  227040,
+  227050,
+  227090,
+  227129,
+  227130,
+  227131,
+  227132,
+  227133,
+  227146,
+  227147,
+  227148,
+  227240,
+  227260,
+  227310,
+  227320,
+  227440,
+  227563,
+  227660,
+  227661,
+  227662,
+  227740,
+  227741,
+  227742,
+  227980,
+  228000,
+  228180,
+  228221,
+  228222,
+  228223,
+  228421,
+  228422,
+  228423,
+  228460,
+  228580,
+  228600,
+  228601,
+  228740,
+  228750,
+  228780,
+  228980,
+  229080,
+  229150,
+  229151,
+  229152,
+  229153,
+  229154,
+  229155,
+  229156,
+  229157,
+  229158,
+  229159,
+  229160,
+  229161,
+  229162,
+  229163,
+  229164,
+  229170,
+  229190,
+  229210,
+  229230,
+  229250,
+  229270,
+  229290,
+  229310,
+  229621,
+  229622,
+  229626,
+  229627,
+  229628,
+  229629,
+  229630,
+  229631,
+  229632,
+  229660,
+  229750,
+  229751,
+  229752,
+  229753,
+  229754,
+  229755,
+  229757,
+  229758,
+  229771,
+  229790,
+  229791,
+  229792,
+  229950,
+  230010,
+  230030,
+  230090,
+  230320,
+  230630,
+  230690,
+  230691,
+  230692,
+  230780,
+  230790,
+  230791,
+  230830,
+  230880,
+  230882,
+  230883,
+  230884,
+  230885,
+  230886,
+  230887,
+  230888,
+  230889,
+  230890,
+  230891,
+  230892,
+  230900,
+  230920,
+  230940,
+  231180,
+  231220,
+  231340,
+  231390,
+  231451,
+  231452,
+  231453,
+  231454,
+  231455,
+  231456,
+  231457,
+  231458,
+  231459,
+  231460,
+  231461,
+  231462,
+  231463,
+  231464,
+  231465,
+  231466,
+  231467,
+  231468,
+  231469,
+  231470,
+  231471,
+  231472,
+  231473,
+  231474,
+  231475,
+  231476,
+  231477,
+  231478,
+  231479,
+  231480,
+  231481,
+  231482,
+  231483,
+  231484,
+  231485,
+  231486,
+  231487,
+  231488,
+  231489,
+  231490,
+  231491,
+  231492,
+  231493,
+  231494,
+  231495,
+  231496,
+  231497,
+  231498,
+  231499,
+  231500,
+  231501,
+  231502,
+  231503,
+  231504,
+  231505,
+  231506,
+  231507,
+  231508,
+  231509,
+  231510,
+  231511,
+  231512,
+  231513,
+  231571,
+  231801,
+  231811,
+  231970,
+  232130,
+  232150,
+  232191,
+  232192,
+  232250,
+  232290,
+  232330,
+  232370,
+  232490,
+  232491,
+  232510,
+  232530,
+  232550,
+  232570,
+  232590,
+  232634,
+  232640,
+  232644,
+  232646,
+  232647,
+  232673,
+  232830,
+  232990,
+  233010,
+  233431,
+  233432,
+  233570,
+  233590,
+  233591,
+  233592,
+  233680,
+  233780,
+  233800,
+  233870,
+  233920,
+  233940,
+  233960,
+  234021,
+  234022,
+  234023,
+  234024,
+  234040,
+  234180,
+  234210,
+  234230,
+  234250,
+  234430,
+  234431,
+  234432,
+  234433,
+  234510,
+  234570,
+  234690,
+  234730,
+  234731,
+  234740,
+  234770,
+  234771,
+  234772,
+  234773,
+  234774,
+  234775,
+  234776,
+  234777,
+  234778,
+  234779,
+  234780,
+  234781,
+  234782,
+  234783,
+  234784,
+  234785,
+  234786,
+  234787,
+  234788,
+  234789,
+  234790,
+  234791,
+  234792,
+  234793,
+  234794,
+  234820,
+  234860,
+  234880,
+  235130,
+  235140,
+  235150,
+  235230,
+  235560,
+  235580,
+  235584,
+  235585,
+  235610,
+  235611,
+  235883,
+  235884,
+  235900,
+  235920,
+  235940,
+  235960,
+  236080,
+  236551,
+  236552,
+  236553,
+  236554,
+  236555,
+  236556,
+  236557,
+  236558,
+  236570,
+  236590,
+  236591,
+  236640,
+  236641,
+  236642,
+  236645,
+  236650,
+  236660,
+  236890,
+  236951,
+  236990,
+  237010,
+  237030,
+  237050,
+  237070,
+  237090,
+  237151,
+  237170,
+  237171,
+  237190,
+  237210,
+  237230,
+  237250,
+  237270,
+  237370,
+  237410,
+  237450,
+  237491,
+  237530,
+  237613,
+  237615,
+  237616,
+  237617,
+  237618,
+  237619,
+  237620,
+  237621,
+  237622,
+  237623,
+  237680,
+  237700,
+  237720,
+  237780,
+  237800,
+  237810,
+  238120,
+  238121,
+  238122,
+  238230,
+  238250,
+  238251,
+  238270,
+  238271,
+  238272,
+  238273,
+  238300,
+  238301,
+  238302,
+  238303,
+  238304,
+  238305,
+  238340,
+  238450,
+  238480,
+  238481,
+  238482,
+  238570,
+  238650,
+  238652,
+  238670,
+  238710,
+  238900,
+  238950,
+  238991,
+  239180,
+  239181,
+  239182,
+  239240,
+  239280,
+  239370,
+  239380,
+  239390,
+  239391,
+  239392,
+  239393,
+  239550,
+  239570,
+  239590,
+  239680,
+  239681,
+  239682,
+  239683,
+  239684,
+  239685,
+  239686,
+  239687,
+  239688,
+  239780,
+  239860,
+  239880,
+  239890,
+  239900,
+  239920,
+  239940,
+  239950,
+  240020,
+  240040,
+  240060,
+  240070,
+  240080,
+  240100,
+  240110,
+  240120,
+  240130,
+  240140,
+  240150,
+  240280,
+  240300,
+  240420,
+  240480,
+  240500,
+  240580,
+  240610,
+  240611,
+  240612,
+  240613,
+  240800,
+  240820,
+  240840,
+  240850,
+  240860,
+  240870,
+  240880,
+  240890,
+  240910,
+  240930,
+  240940,
+  240950,
+  240990,
+  241040,
+  241050,
+  241060,
+  241070,
+  241090,
+  241120,
+  241130,
+  241140,
+  241150,
+  241230,
+  241280,
+  241340,
+  241360,
+  241361,
+  241362,
+  241363,
+  241364,
+  241365,
+  241366,
+  241367,
+  241368,
+  241369,
+  241370,
+  241371,
+  241372,
+  241373,
+  241430,
+  241490,
+  241660,
+  241680,
+  241790,
+  241950,
+  241951,
+  241960,
+  241970,
+  242070,
+  242090,
+  242120,
+  242150,
+  242203,
+  242204,
+  242270,
+  242280,
+  242290,
+  242300,
+  242310,
+  242460,
+  242480,
+  242520,
+  242630,
+  243411,
+  243412,
+  243413,
+  243414,
+  243415,
+  243440,
+  243441,
+  243442,
+  243580,
+  243730,
+  243750,
+  243831,
+  243890,
+  243959,
+  244060,
+  244061,
+  244062,
+  244063,
+  244064,
+  244065,
+  244066,
+  244230,
+  244270,
+  244290,
+  244310,
+  244350,
+  244370,
+  244390,
+  244610,
+  244650,
+  244830,
+  245030,
+  245172,
+  245173,
+  245174,
+  245175,
+  245176,
+  245177,
+  245190,
+  245191,
+  245192,
+  245193,
+  245220,
+  245340,
+  245570,
+  245580,
+  245640,
+  245660,
+  245810,
+  245850,
+  245890,
+  245910,
+  245930,
+  245950,
+  245970,
+  246010,
+  246030,
+  246050,
+  246250,
+  246251,
+  246252,
+  246253,
+  246254,
+  246255,
+  246256,
+  246257,
+  246260,
+  246561,
+  246562,
+  246563,
+  246564,
+  246600,
+  247180,
+  247190,
+  247290,
+  247291,
+  247292,
+  247293,
+  247294,
+  247295,
+  247296,
+  247297,
+  247298,
+  247299,
+  247300,
+  247301,
+  247302,
+  247303,
+  247304,
+  247305,
+  247306,
+  247307,
+  247308,
+  247309,
+  247390,
+  247450,
+  247560,
+  247620,
+  247640,
+  247811,
+  247852,
+  248160,
+  248170,
+  248670,
+  248750,
+  248751,
+  248752,
+  248753,
+  248754,
+  248755,
+  248756,
+  248757,
+  248890,
+  249070,
+  249080,
+  249081,
+  249082,
+  249083,
+  249084,
+  249085,
+  249086,
+  249087,
+  249088,
+  249089,
+  249090,
+  249091,
+  249092,
+  249093,
+  249094,
+  249100,
+  249101,
+  249102,
+  249103,
+  249104,
+  249105,
+  249106,
+  249107,
+  249108,
+  249109,
+  249110,
+  249111,
+  249112,
+  249113,
+  249114,
+  249115,
+  249116,
+  249117,
+  249120,
+  249121,
+  249122,
+  249170,
+  249180,
+  249181,
+  249250,
+  249270,
+  249290,
+  249310,
+  249320,
+  249400,
+  249540,
+  249700,
+  249730,
+  249740,
+  249750,
+  249760,
+  249770,
+  249780,
+  249800,
+  249820,
+  249860,
+  249861,
+  249862,
+  249910,
+  249911,
+  249912,
+  249913,
+  249920,
+  249921,
+  249922,
+  249923,
+  250150,
+  250160,
+  250170,
+  250220,
+  250230,
+  250300,
+  250310,
+  250360,
+  250810,
+  250820,
+  250890,
+  250891,
+  250892,
+  250893,
+  250930,
+  250990,
+  251080,
+  251081,
+  251810,
+  252590,
+  252990,
+  253050,
+  253070,
+  253370,
+  253670,
+  253830,
+  253831,
+  253832,
+  254170,
+  254180,
+  254181,
+  254182,
+  254183,
+  254184,
+  254185,
+  254260,
+  254270,
+  254290,
+  254291,
+  254420,
+  254421,
+  254422,
+  254423,
+  254430,
+  254580,
+  254581,
+  254582,
+  254583,
+  254584,
+  254585,
+  254610,
+  254620,
+  254670,
+  254671,
+  254672,
+  254673,
+  254674,
+  255000,
+  255010,
+  255050,
+  255140,
+  255150,
+  255160,
+  255161,
+  255162,
+  255163,
+  255164,
+  255165,
+  255166,
+  255167,
+  255168,
+  255169,
+  255190,
+  255210,
+  255240,
+  255250,
+  255251,
+  255253,
+  255470,
+  255550,
+  255551,
+  255580,
+  255690,
+  255691,
+  255692,
+  255750,
+  255780,
+  255860,
+  255890,
+  255910,
+  255980,
+  256100,
+  256180,
+  256230,
+  256240,
+  256270,
+  256280,
+  256320,
+  256321,
+  256480,
+  256490,
+  256500,
+  256501,
+  256502,
+  256503,
+  256504,
+  256505,
+  256506,
+  256507,
+  256508,
+  256509,
+  256510,
+  256511,
+  256512,
+  256513,
+  256514,
+  256520,
+  256521,
+  256522,
+  256523,
+  256524,
+  256525,
+  256526,
+  256527,
+  256529,
+  256530,
+  256531,
+  256532,
+  256533,
+  256534,
+  256535,
+  256539,
+  256546,
+  256549,
+  256552,
+  256554,
+  256555,
+  256556,
+  256568,
+  256570,
+  256576,
+  256611,
+  256614,
+  257020,
+  257070,
+  257210,
+  257280,
+  257281,
+  257290,
+  257300,
+  257301,
+  257302,
+  257310,
+  257320,
+  257330,
+  257331,
+  257332,
+  257333,
+  257334,
+  257370,
+  257371,
+  257400,
+  257560,
+  257610,
+  257650,
+  257910,
+  258260,
+  258261,
+  258262,
+  258263,
+  258264,
+  258270,
+  258341,
+  258342,
+  258343,
+  258344,
+  258345,
+  258346,
+  258347,
+  258348,
+  258349,
+  258350,
+  258351,
+  258352,
+  258353,
+  258354,
+  258355,
+  258356,
+  258357,
+  258358,
+  258359,
+  258360,
+  258361,
+  258362,
+  258363,
+  258364,
+  258365,
+  258366,
+  258367,
+  258368,
+  258369,
+  258370,
+  258371,
+  258372,
+  258373,
+  258374,
+  258375,
+  258376,
+  258377,
+  258378,
+  258379,
+  258380,
+  258381,
+  258382,
+  258383,
+  258384,
+  258385,
+  258386,
+  258388,
+  258389,
+  258390,
+  258391,
+  258392,
+  258393,
+  258394,
+  258395,
+  258396,
+  258397,
+  258398,
+  258399,
+  258400,
+  258401,
+  258402,
+  258403,
+  258404,
+  258405,
+  258406,
+  258407,
+  258408,
+  258409,
+  258410,
+  258411,
+  258412,
+  258413,
+  258414,
+  258415,
+  258416,
+  258417,
+  258418,
+  258419,
+  258420,
+  258450,
+  258460,
+  258470,
+  258500,
+  258501,
+  258502,
+  258510,
+  258511,
+  258512,
+  258540,
+  258541,
+  258542,
+  258543,
+  258570,
+  258580,
+  258640,
+  258641,
+  258642,
+  258643,
+  258644,
+  258645,
+  258646,
+  258647,
+  258648,
+  258650,
+  258652,
+  258653,
+  258654,
+  258655,
+  258656,
+  258657,
+  258658,
+  258659,
+  258661,
+  258662,
+  258663,
+  258666,
+  258668,
+  258671,
+  258674,
+  258677,
+  258678,
+  258679,
+  258680,
+  258740,
+  258741,
+  258742,
+  258743,
+  258744,
+  258745,
+  258750,
+  258751,
+  258752,
+  258800,
+  258803,
+  258804,
+  258810,
+  258811,
+  258812,
+  258813,
+  258814,
+  258815,
+  258816,
+  258817,
+  258850,
+  258851,
+  258852,
+  258860,
+  258930,
+  258940,
+  258941,
+  258942,
+  258990,
+  258991,
+  258992,
+  258993,
+  258994,
+  259040,
+  259041,
+  259110,
+  259120,
+  259121,
+  259122,
+  259210,
+  259211,
+  259220,
+  259230,
+  259240,
+  259250,
+  259251,
+  259252,
+  259253,
+  259260,
+  259270,
+  259271,
+  259380,
+  259381,
+  259590,
+  259591,
+  259592,
+  259800,
+  259900,
+  260100,
+  260101,
+  260290,
+  260291,
+  260292,
+  260293,
+  260294,
+  260300,
+  260301,
+  260302,
+  260303,
+  260304,
+  260305,
+  260306,
+  260307,
+  260308,
+  260309,
+  260310,
+  260311,
+  260312,
+  260313,
+  260314,
+  260315,
+  260316,
+  260317,
+  260318,
+  260319,
+  260320,
+  260321,
+  260322,
+  260323,
+  260324,
+  260325,
+  260326,
+  260327,
+  260328,
+  260329,
+  260400,
+  260401,
+  260402,
+  260403,
+  260460,
+  260461,
+  260470,
+  260471,
+  260472,
+  260473,
+  260474,
+  260476,
+  260477,
+  260478,
+  260850,
+  260860,
+  260880,
+  260881,
+  260950,
+  260960,
+  260990,
+  261020,
+  261050,
+  261060,
+  261070,
+  261130,
+  261140,
+  261160,
+  261161,
+  261200,
+  261210,
+  261220,
+  261300,
+  261301,
+  261302,
+  261330,
+  261331,
+  261340,
+  261341,
+  261390,
+  261391,
+  261392,
+  261393,
+  261394,
+  261395,
+  261396,
+  261397,
+  261398,
+  261399,
+  261400,
+  261401,
+  261402,
+  261403,
+  261404,
+  261405,
+  261406,
+  261407,
+  261408,
+  261409,
+  261410,
+  261411,
+  261412,
+  261420,
+  261421,
+  261590,
+  261620,
+  261660,
+  261920,
+  262140,
+  262141,
+  262142,
+  262230,
+  262340,
+  262341,
+  262342,
+  262350,
+  262351,
+  262352,
+  262360,
+  262361,
+  262362,
+  262490,
+  262610,
+  262650,
+  263600,
+  264020,
+  264420,
+  264600,
+  264610,
+  264680,
+  264681,
+  264682,
+  264683,
+  264750,
+  264800,
+  264801,
+  264802,
+  264803,
+  264804,
+  264805,
+  264810,
+  264811,
+  264812,
+  264813,
+  264820,
+  264830,
+  264840,
+  264841,
+  264920,
+  264970,
+  264990,
+  264991,
+  264992,
+  264993,
+  264994,
+  264995,
+  264996,
+  265050,
+  265060,
+  265061,
+  265070,
+  265090,
+  265130,
+  265131,
+  265132,
+  265140,
+  265141,
+  265142,
+  265143,
+  265144,
+  265145,
+  265146,
+  265149,
+  265150,
+  265190,
+  265191,
+  265192,
+  265193,
+  265200,
+  265280,
+  265290,
+  265291,
+  265292,
+  265293,
+  265320,
+  265360,
+  265410,
+  265420,
+  265460,
+  265461,
+  265462,
+  265463,
+  265464,
+  265465,
+  265490,
+  266310,
+  266590,
+  266720,
+  266730,
+  266740,
+  266750,
+  266760,
+  266780,
+  266800,
+  266810,
+  266862,
+  266864,
+  266868,
+  266870,
+  266873,
+  266874,
+  266880,
+  266910,
+  266930,
+  266931,
+  267000,
+  267001,
+  267130,
+  267180,
+  267191,
+  267230,
+  267380,
+  267381,
+  267382,
+  267440,
+  267480,
+  267510,
+  267511,
+  267512,
+  267520,
+  267521,
+  267570,
+  267580,
+  267590,
+  267591,
+  267620,
+  267630,
+  267650,
+  267651,
+  267652,
+  267653,
+  267654,
+  267655,
+  267660,
+  267680,
+  267710,
+  267711,
+  267712,
+  267713,
+  267714,
+  267720,
+  267770,
+  267771,
+  267772,
+  267773,
+  267774,
+  267775,
+  267776,
+  267777,
+  267778,
+  267780,
+  267781,
+  267782,
+  267783,
+  267784,
+  267785,
+  267786,
+  267787,
+  267788,
+  267789,
+  267810,
+  267820,
+  267830,
+  267860,
+  267861,
+  267862,
+  267863,
+  267864,
+  267870,
+  267880,
+  268070,
+  268071,
+  268080,
+  268081,
+  268082,
+  268090,
+  268100,
+  268101,
+  268110,
+  268111,
+  268112,
+  268113,
+  268114,
+  268115,
+  268120,
+  268121,
+  268122,
+  268123,
+  268124,
+  268125,
+  268280,
+  268281,
+  268290,
+  268291,
+  268292,
+  268293,
+  268294,
+  268295,
+  268296,
+  268297,
+  268300,
+  268310,
+  268311,
+  268312,
+  268313,
+  268314,
+  268315,
+  268560,
+  268590,
+  268600,
+  268610,
+  268611,
+  268612,
+  268613,
+  268614,
+  268620,
+  268850,
+  269290,
+  269450,
+  269470,
+  269550,
+  269570,
+  270650,
+  270700,
+  270740,
+  270741,
+  270742,
+  270743,
+  270744,
+  270745,
+  270870,
+  270871,
+  270900,
+  270930,
+  270940,
+  270941,
+  270942,
+  270990,
+  271000,
+  271001,
+  271002,
+  271003,
+  271004,
+  271005,
+  271010,
+  271030,
+  271080,
+  271090,
+  271100,
+  271110,
+  271331,
+  271332,
+  271333,
+  271334,
+  271380,
+  271381,
+  271382,
+  271383,
+  271384,
+  271385,
+  271386,
+  271387,
+  271388,
+  271389,
+  271390,
+  271400,
+  271410,
+  271411,
+  271412,
+  271413,
+  271414,
+  271415,
+  271416,
+  271417,
+  271418,
+  271419,
+  271420,
+  271421,
+  271422,
+  271423,
+  271424,
+  271425,
+  271426,
+  271427,
+  271428,
+  271429,
+  271430,
+  271431,
+  271432,
+  271433,
+  271438,
+  271439,
+  271440,
+  271441,
+  271442,
+  271443,
+  271444,
+  271445,
+  271446,
+  271447,
+  271448,
+  271449,
+  271450,
+  271451,
+  271452,
+  271453,
+  271454,
+  271455,
+  271456,
+  271457,
+  271458,
+  271459,
+  271460,
+  271461,
+  271462,
+  271463,
+  271464,
+  271465,
+  271466,
+  271467,
+  271468,
+  271469,
+  271470,
+  271471,
+  271472,
+  271473,
+  271474,
+  271475,
+  271476,
+  271477,
+  271478,
+  271479,
+  271480,
+  271481,
+  271489,
+  271490,
+  271491,
+  271492,
+  271497,
+  271498,
+  271499,
+  271520,
+  271530,
+  271540,
+  271750,
+  271800,
+  271801,
+  271802,
+  271810,
+  271840,
+  271850,
+  271940,
+  271941,
+  271942,
+  271943,
+  271944,
+  271950,
+  271960,
+  271961,
+  271962,
+  271963,
+  271964,
+  272030,
+  272080,
+  272082,
+  272083,
+  272084,
+  272090,
+  272100,
+  272260,
+  272261,
+  272290,
+  272300,
+  272320,
+  272640,
+  272680,
+  272690,
+  272700,
+  272710,
+  272770,
+  272830,
+  272880,
+  272910,
+  272950,
+  272960,
+  272970,
+  273150,
+  273151,
+  273152,
+  273153,
+  273260,
+  273261,
+  273270,
+  273290,
+  273300,
+  273370,
+  273380,
+  273381,
+  273390,
+  273480,
+  273490,
+  273520,
+  273521,
+  273522,
+  273523,
+  273524,
+  273525,
+  273526,
+  273527,
+  273530,
+  273540,
+  273550,
+  273670,
+  273680,
+  273700,
+  274050,
+  274100,
+  274110,
+  274111,
+  274112,
+  274120,
+  274121,
+  274122,
+  274123,
+  274150,
+  274160,
+  274161,
+  274430,
+  274431,
+  274440,
+  274470,
+  274471,
+  274800,
+  274920,
+  275020,
+  275030,
+  275050,
+  275124,
+  275125,
+  275127,
+  275128,
+  275134,
+  275138,
+  275139,
+  275144,
+  275163,
+  275170,
+  275171,
+  275240,
+  275440,
+  275550,
+  275551,
+  275552,
+  275553,
+  275554,
+  275560,
+  275590,
+  275600,
+  275690,
+  275700,
+  275800,
+  275804,
+  275805,
+  275806,
+  275807,
+  275809,
+  276050,
+  276051,
+  276060,
+  276160,
+  276190,
+  276200,
+  276210,
+  276550,
+  276551,
+  276552,
+  277000,
+  277150,
+  277170,
+  277210,
+  277230,
+  277250,
+  277530,
+  277531,
+  277580,
+  277581,
+  277670,
+  277671,
+  277672,
+  277673,
+  277674,
+  277675,
+  277676,
+  277677,
+  277678,
+  277679,
+  277720,
+  277721,
+  277730,
+  277731,
+  277732,
+  277733,
+  277734,
+  277735,
+  277736,
+  277737,
+  277739,
+  277740,
+  277741,
+  277742,
+  277743,
+  277745,
+  277747,
+  277748,
+  277749,
+  277751,
+  277752,
+  277753,
+  277754,
+  277755,
+  277756,
+  277757,
+  277758,
+  277759,
+  277760,
+  277761,
+  277762,
+  277763,
+  277764,
+  277765,
+  277767,
+  277768,
+  277769,
+  277770,
+  277771,
+  277773,
+  277774,
+  277775,
+  277776,
+  277777,
+  277778,
+  277779,
+  277820,
+  277821,
+  277830,
+  277840,
+  277841,
+  277842,
+  277843,
+  277844,
+  277845,
+  277846,
+  277970,
+  277971,
+  277972,
+  277973,
+  277974,
+  277975,
+  277976,
+  277977,
+  278030,
+  278031,
+  278120,
+  278130,
+  278131,
+  278140,
+  278150,
+  278190,
+  278210,
+  278480,
+  278481,
+  278610,
+  278611,
+  278700,
+  278701,
+  278710,
+  278711,
+  278712,
+  278720,
+  278730,
+  278731,
+  278732,
+  278733,
+  278734,
+  278735,
+  278736,
+  278737,
+  279090,
+  279100,
+  279110,
+  279111,
+  279112,
+  279130,
+  279131,
+  279132,
+  279280,
+  279600,
+  279601,
+  279602,
+  279603,
+  279620,
+  279621,
+  279622,
+  279623,
+  279740,
+  279820,
+  279830,
+  279840,
+  279960,
+  279961,
+  279962,
+  279963,
+  279964,
+  279965,
+  279966,
+  279967,
+  279968,
+  280030,
+  280031,
+  280032,
+  280680,
+  280760,
+  280761,
+  280762,
+  280763,
+  281050,
+  281100,
+  281102,
+  281103,
+  281340,
+  281341,
+  281342,
+  281343,
+  281344,
+  281345,
+  281346,
+  281347,
+  281510,
+  281511,
+  281600,
+  281601,
+  281602,
+  281603,
+  281604,
+  281606,
+  281607,
+  281630,
+  281720,
+  281721,
+  281722,
+  281723,
+  281724,
+  281725,
+  281770,
+  281780,
+  281810,
+  281811,
+  281812,
+  281900,
+  281960,
+  281970,
+  281980,
+  281981,
+  282090,
+  282091,
+  282092,
+  282130,
+  282131,
+  282132,
+  282160,
+  282201,
+  282240,
+  282280,
+  282470,
+  282500,
+  282510,
+  282511,
+  282512,
+  282513,
+  282514,
+  282515,
+  282516,
+  282520,
+  282550,
+  282580,
+  282660,
+  283250,
+  283260,
+  283530,
+  283540,
+  283541,
+  283542,
+  283550,
+  283551,
+  283552,
+  283740,
+  283750,
+  283810,
+  283811,
+  283812,
+  283813,
+  283900,
+  284040,
+  284070,
+  284430,
+  284440,
+  284441,
+  284442,
+  284443,
+  284450,
+  284500,
+  284510,
+  284511,
+  284512,
+  284520,
+  284521,
+  284522,
+  284640,
+  284641,
+  284670,
+  284671,
+  284672,
+  284680,
+  284700,
+  285150,
+  285370,
+  285460,
+  285461,
+  285462,
+  285470,
+  285550,
+  285610,
+  285611,
+  285612,
+  285613,
+  285614,
+  285615,
+  285616,
+  285617,
+  285618,
+  285619,
+  285620,
+  285621,
+  285622,
+  285623,
+  285625,
+  285626,
+  285630,
+  285660,
+  285661,
+  285662,
+  285663,
+  285710,
+  285730,
+  286630,
+  286631,
+  286632,
+  286633,
+  286634,
+  286635,
+  286636,
+  286640,
+  286670,
+  286671,
+  286910,
+  286911,
+  286912,
+  286913,
+  286914,
+  286915,
+  286920,
+  286960,
+  286961,
+  286962,
+  286963,
+  286964,
+  286965,
+  286966,
+  286970,
+  286971,
+  286972,
+  286990,
+  286991,
+  287090,
+  287091,
+  287092,
+  287093,
+  287094,
+  287095,
+  287280,
+  287330,
+  287360,
+  287370,
+  287371,
+  287380,
+  287381,
+  287410,
+  287411,
+  287530,
+  287531,
+  287540,
+  287550,
+  287620,
+  287670,
+  287671,
+  287672,
+  287673,
+  287760,
+  287770,
+  287771,
+  288240,
+  288250,
+  288270,
+  288310,
+  288320,
+  288321,
+  288322,
+  288420,
+  288520,
+  288780,
+  288810,
+  288811,
+  288812,
+  288813,
+  288814,
+  288815,
+  288816,
+  288817,
+  288818,
+  288819,
+  288820,
+  288822,
+  288823,
+  288824,
+  288850,
+  288900,
+  288940,
+  288980,
+  289010,
+  289020,
+  289021,
+  289022,
+  289023,
+  289024,
+  289025,
+  289026,
+  289027,
+  289028,
+  289029,
+  289030,
+  289031,
+  289110,
+  289111,
+  289112,
+  289113,
+  289114,
+  289120,
+  289121,
+  289122,
+  289170,
+  289540,
+  289550,
+  289570,
+  289641,
+  289730,
+  289731,
+  289733,
+  289734,
+  289880,
+  289881,
+  290400,
+  290401,
+  290402,
+  290403,
+  290404,
+  290405,
+  290406,
+  291470,
+  291471,
+  291472,
+  291473,
+  291474,
+  291500,
+  291501,
+  291502,
+  291503,
+  291504,
+  291505,
+  291506,
+  291507,
+  291508,
+  291509,
+  291520,
+  291521,
+  291522,
+  291523,
+  291524,
+  291525,
+  291540,
+  291541,
+  291542,
+  291543,
+  291544,
+  291545,
+  291570,
+  291790,
+  291820,
+  291821,
+  291822,
+  291830,
+  291831,
+  291832,
+  291900,
+  291901,
+  291902,
+  292020,
+  292021,
+  292050,
+  292114,
+  292116,
+  292117,
+  292118,
+  292119,
+  292220,
+  292230,
+  292320,
+  292350,
+  292470,
+  292471,
+  292472,
+  292473,
+  292474,
+  292640,
+  292700,
+  292701,
+  292702,
+  292710,
+  292711,
+  292712,
+  292720,
+  292721,
+  292722,
+  292900,
+  292950,
+  292951,
+  292960,
+  292980,
+  292981,
+  292982,
+  292983,
+  292984,
+  292985,
+  293030,
+  293054,
+  293055,
+  293057,
+  293059,
+  293061,
+  293080,
+  293090,
+  293091,
+  293092,
+  293093,
+  293094,
+  293095,
+  293096,
+  293097,
+  293098,
+  293099,
+  293100,
+  293101,
+  293110,
+  293120,
+  293130,
+  293131,
+  293132,
+  293133,
+  293134,
+  293140,
+  294180,
+  294300,
+  294301,
+  294302,
+  294303,
+  294304,
+  294310,
+  294311,
+  294312,
+  294330,
+  294340,
+  294420,
+  294500,
+  294560,
+  294600,
+  294850,
+  294900,
+  294901,
+  294902,
+  294903,
+  294904,
+  294905,
+  294906,
+  294907,
+  294908,
+  294909,
+  294910,
+  294911,
+  294912,
+  294913,
+  294914,
+  294915,
+  294916,
+  294917,
+  294918,
+  294919,
+  294920,
+  294921,
+  294922,
+  294923,
+  294924,
+  294925,
+  294926,
+  294927,
+  294928,
+  294929,
+  294930,
+  294931,
+  294932,
+  294934,
+  294935,
+  294936,
+  294937,
+  294938,
+  294939,
+  294940,
+  294941,
+  294942,
+  294943,
+  294944,
+  294945,
+  294946,
+  294947,
+  294948,
+  294953,
+  294954,
+  294955,
+  294956,
+  294957,
+  294958,
+  294959,
+  294960,
+  294961,
+  294962,
+  294963,
+  294964,
+  294965,
+  294966,
+  294967,
+  294968,
+  294969,
+  294970,
+  294971,
+  294972,
+  294973,
+  294974,
+  294975,
+  294976,
+  294977,
+  294978,
+  294979,
+  294980,
+  294981,
+  294982,
+  294983,
+  294984,
+  294985,
+  294990,
+  294992,
+  294993,
+  294994,
+  294995,
+  294996,
+  294997,
+  294998,
+  294999,
+  295000,
+  295001,
+  295002,
+  295003,
+  295004,
+  295005,
+  295006,
+  295007,
+  295008,
+  295009,
+  295010,
+  295011,
+  295012,
+  295013,
+  295014,
+  295015,
+  295016,
+  295017,
+  295018,
+  295019,
+  295020,
+  295021,
+  295022,
+  295023,
+  295024,
+  295025,
+  295026,
+  295027,
+  295028,
+  295029,
+  295030,
+  295031,
+  295032,
+  295033,
+  295034,
+  295035,
+  295036,
+  295037,
+  295038,
+  295039,
+  295040,
+  295041,
+  295042,
+  295043,
+  295044,
+  295045,
+  295046,
+  295047,
+  295048,
+  295049,
+  295050,
+  295051,
+  295052,
+  295053,
+  295054,
+  295055,
+  295056,
+  295057,
+  295058,
+  295059,
+  295060,
+  295061,
+  295062,
+  295063,
+  295064,
+  295065,
+  295066,
+  295067,
+  295068,
+  295069,
+  295070,
+  295071,
+  295072,
+  295073,
+  295074,
+  295075,
+  295076,
+  295077,
+  295078,
+  295079,
+  295080,
+  295081,
+  295082,
+  295083,
+  295084,
+  295085,
+  295086,
+  295087,
+  295088,
+  295089,
+  295090,
+  295091,
+  295092,
+  295093,
+  295094,
+  295095,
+  295096,
+  295097,
+  295098,
+  295099,
+  295100,
+  295162,
+  295173,
+  295174,
+  295177,
+  295178,
+  295181,
+  295182,
+  295183,
+  295184,
+  295185,
+  295188,
+  295190,
+  295191,
+  295192,
+  295193,
+  295194,
+  295196,
+  295197,
+  295198,
+  295199,
+  295200,
+  295201,
+  295202,
+  295203,
+  295204,
+  295205,
+  295206,
+  295207,
+  295208,
+  295209,
+  295220,
+  295221,
+  295222,
+  295230,
+  295350,
+  295390,
+  295430,
+  295431,
+  295432,
+  295433,
+  295434,
+  295435,
+  295436,
+  295437,
+  295438,
+  295439,
+  295440,
+  295510,
+  295511,
+  295520,
+  295530,
+  295560,
+  296093,
+  296103,
+  296170,
+  296270,
+  296271,
+  296320,
+  296340,
+  296360,
+  296440,
+  296441,
+  296450,
+  296610,
+  296990,
+  297050,
+  297140,
+  297141,
+  297142,
+  297143,
+  297150,
+  297510,
+  297511,
+  297512,
+  297513,
+  297514,
+  297515,
+  297517,
+  297518,
+  297519,
+  297520,
+  297521,
+  297522,
+  297523,
+  297524,
+  297525,
+  297526,
+  297527,
+  297529,
+  297530,
+  297531,
+  297532,
+  297533,
+  297534,
+  297535,
+  297536,
+  297537,
+  297538,
+  297539,
+  297540,
+  297541,
+  297542,
+  297543,
+  297544,
+  297545,
+  297546,
+  297547,
+  297548,
+  297549,
+  297550,
+  297600,
+  297601,
+  297610,
+  297630,
+  297640,
+  297641,
+  297642,
+  297643,
+  297644,
+  297645,
+  297650,
+  297651,
+  297652,
+  297690,
+  297700,
+  297770,
+  297780,
+  297790,
+  297791,
+  297792,
+  297793,
+  297800,
+  297830,
+  297831,
+  297840,
+  297841,
+  297842,
+  297880,
+  297890,
+  297891,
+  297892,
+  297893,
+  297894,
+  297895,
+  297896,
+  297897,
+  297898,
+  297900,
+  297910,
+  297911,
+  297940,
+  297950,
+  297960,
+  297970,
+  297980,
+  297990,
+  298130,
+  298150,
+  298620,
+  298640,
+  298641,
+  298670,
+  298671,
+  298672,
+  298680,
+  298690,
+  298720,
+  298740,
+  298770,
+  298771,
+  298781,
+  298782,
+  298783,
+  298784,
+  298785,
+  298786,
+  298788,
+  298810,
+  298860,
+  298880,
+  298910,
+  298911,
+  298913,
+  298970,
+  298971,
+  298980,
+  298981,
+  298982,
+  298983,
+  298984,
+  298985,
+  298986,
+  298987,
+  298990,
+  298991,
+  299000,
+  299001,
+  299002,
+  299003,
+  299004,
+  299140,
+  299190,
+  299230,
+  299240,
+  299270,
+  299280,
+  299290,
+  299300,
+  299301,
+  299310,
+  299350,
+  299370,
+  299990,
+  300120,
+  300140,
+  300150,
+  300440,
+  300441,
+  300442,
+  300450,
+  300460,
+  300600,
+  300640,
+  300641,
+  300642,
+  300660,
+  300661,
+  300662,
+  300663,
+  300780,
+  300860,
+  300870,
+  300960,
+  300980,
+  300981,
+  300982,
+  300990,
+  300991,
+  300992,
+  301060,
+  301070,
+  301110,
+  301111,
+  301112,
+  301113,
+  301114,
+  301115,
+  301116,
+  301140,
+  301180,
+  301210,
+  301240,
+  301241,
+  301242,
+  301243,
+  301244,
+  301245,
+  301246,
+  301247,
+  301248,
+  301249,
+  301600,
+  301610,
+  301660,
+  301710,
+  301720,
+  301770,
+  301771,
+  301820,
+  301880,
+  301890,
+  301891,
+  301892,
+  301893,
+  301894,
+  301895,
+  301896,
+  301897,
+  301900,
+  301950,
+  302020,
+  302030,
+  302050,
+  302051,
+  302100,
+  302101,
+  302102,
+  302103,
+  302200,
+  302280,
+  302281,
+  302282,
+  302300,
+  302450,
+  302451,
+  302452,
+  302453,
+  302530,
+  302550,
+  303250,
+  303251,
+  303280,
+  303281,
+  303282,
+  303330,
+  303331,
+  303332,
+  303360,
+  303640,
+  303641,
+  303642,
+  303643,
+  303644,
+  303645,
+  303646,
+  303647,
+  303730,
+  303780,
+  303890,
+  303920,
+  303930,
+  303960,
+  304000,
+  304010,
+  304020,
+  304070,
+  304071,
+  304072,
+  304080,
+  304081,
+  304082,
+  304110,
+  304120,
+  304121,
+  304130,
+  304131,
+  304132,
+  304133,
+  304134,
+  304140,
+  304210,
+  304211,
+  304212,
+  304213,
+  304214,
+  304220,
+  304300,
+  304301,
+  304310,
+  304320,
+  304330,
+  304360,
+  304380,
+  304400,
+  304450,
+  304480,
+  304490,
+  304491,
+  304590,
+  304620,
+  304970,
+  305130,
+  305131,
+  305150,
+  305180,
+  305181,
+  305182,
+  305183,
+  305184,
+  305185,
+  305186,
+  305187,
+  305200,
+  305221,
+  305280,
+  305300,
+  305310,
+  305311,
+  305320,
+  305321,
+  305322,
+  305323,
+  305324,
+  305325,
+  305326,
+  305327,
+  305328,
+  305329,
+  305330,
+  305331,
+  305332,
+  305333,
+  305334,
+  305335,
+  305336,
+  305337,
+  305338,
+  305339,
+  305340,
+  305341,
+  305342,
+  305360,
+  305370,
+  305400,
+  305410,
+  305420,
+  305430,
+  305431,
+  305470,
+  305471,
+  305472,
+  305530,
+  305531,
+  305532,
+  305540,
+  305570,
+  305860,
+  306100,
+  306110,
+  306150,
+  306160,
+  306170,
+  306171,
+  306180,
+  306190,
+  306240,
+  306280,
+  306300,
+  306320,
+  306330,
+  306340,
+  306390,
+  306391,
+  306392,
+  306393,
+  306394,
+  306395,
+  306396,
+  306397,
+  306398,
+  306399,
+  306401,
+  306460,
+  306470,
+  306510,
+  306530,
+  306531,
+  306540,
+  306541,
+  306570,
+  306601,
+  306610,
+  306650,
+  306690,
+  306720,
+  306721,
+  306722,
+  306723,
+  306850,
+  306880,
+  306890,
+  307330,
+  307390,
+  307400,
+  307420,
+  307450,
+  307451,
+  307452,
+  307453,
+  307454,
+  307456,
+  307457,
+  307458,
+  307459,
+  307460,
+  307461,
+  307462,
+  307463,
+  307464,
+  307465,
+  307470,
+  307500,
+  307540,
+  307550,
+  307610,
+  307650,
+  307660,
+  307740,
+  307750,
+  307800,
+  307820,
+  307821,
+  307822,
+  307823,
+  307824,
+  307825,
+  307911,
+  307970,
+  307971,
+  308010,
+  308020,
+  308030,
+  308140,
+  308160,
+  308161,
+  308162,
+  308163,
+  308164,
+  308170,
+  308171,
+  308172,
+  308261,
+  308262,
+  308263,
+  308264,
+  308265,
+  308266,
+  308267,
+  308268,
+  308269,
+  308300,
+  308310,
+  308340,
+  308341,
+  309870,
+  309871,
+  309872,
+  309920,
+  309940,
+  309970,
+  309971,
+  309972,
+  309973,
+  309990,
+  309991,
+  310030,
+  310031,
+  310032,
+  310033,
+  310034,
+  310040,
+  310050,
+  310090,
+  310091,
+  310100,
+  310240,
+  310260,
+  310280,
+  310300,
+  310400,
+  310410,
+  310420,
+  310430,
+  310440,
+  310580,
+  310600,
+  310660,
+  310680,
+  310690,
+  310750,
+  310751,
+  310752,
+  311020,
+  311030,
+  311031,
+  311050,
+  311160,
+  311161,
+  311162,
+  311163,
+  311164,
+  311320,
+  311330,
+  311360,
+  311361,
+  311362,
+  311370,
+  311380,
+  311410,
+  311430,
+  311431,
+  311440,
+  311450,
+  311460,
+  311500,
+  311540,
+  311550,
+  311551,
+  311580,
+  311590,
+  311600,
+  311660,
+  311670,
+  311920,
+  311921,
+  311990,
+  312000,
+  312070,
+  312090,
+  312290,
+  312340,
+  312380,
+  312580,
+  312680,
+  312690,
+  312740,
+  312800,
+  313070,
+  313100,
+  313101,
+  313102,
+  313220,
+  313250,
+  313260,
+  313280,
+  313281,
+  313300,
+  313310,
+  313311,
+  313320,
+  313350,
+  313370,
+  313371,
+  313372,
+  313373,
+  313374,
+  313375,
+  313380,
+  313381,
+  313420,
+  313430,
+  313520,
+  313540,
+  313560,
+  313600,
+  313610,
+  313611,
+  313670,
+  313710,
+  313711,
+  313712,
+  313713,
+  313720,
+  313721,
+  313750,
+  313760,
+  313790,
+  313800,
+  313850,
+  313900,
+  313930,
+  313931,
+  313932,
+  314080,
+  314090,
+  314091,
+  314092,
+  314093,
+  314100,
+  314101,
+  314110,
+  314130,
+  314170,
+  314400,
+  314500,
+  314550,
+  314551,
+  314552,
+  314553,
+  314580,
+  314680,
+  314720,
+  314730,
+  314750,
+  314780,
+  314781,
+  314782,
+  314783,
+  315010,
+  315030,
+  315050,
+  315100,
+  315101,
+  315120,
+  315150,
+  315151,
+  315160,
+  315190,
+  315200,
+  315220,
+  315240,
+  315380,
+  315381,
+  315382,
+  315383,
+  315384,
+  315385,
+  315386,
+  315387,
+  315388,
+  315389,
+  315392,
+  315393,
+  315394,
+  315395,
+  315396,
+  315397,
+  315410,
+  315411,
+  315412,
+  315420,
+  315490,
+  315520,
+  315560,
+  315630,
+  315720,
+  315730,
+  315800,
+  315880,
+  315890,
+  315906,
+  315907,
+  315908,
+  315909,
+  315916,
+  315917,
+  315918,
+  315919,
+  315960,
+  315970,
+  315980,
+  315990,
+  316000,
+  316060,
+  316070,
+  316120,
+  316121,
+  316130,
+  316131,
+  316280,
+  316290,
+  316360,
+  316400,
+  316410,
+  316440,
+  316441,
+  316442,
+  316443,
+  316444,
+  316445,
+  316446,
+  316447,
+  316448,
+  316460,
+  316470,
+  316490,
+  316491,
+  316500,
+  316510,
+  316520,
+  316530,
+  316540,
+  316541,
+  316542,
+  316550,
+  316560,
+  316570,
+  316590,
+  316591,
+  316620,
+  316630,
+  316640,
+  316650,
+  316651,
+  316670,
+  316671,
+  316680,
+  316710,
+  316820,
+  316821,
+  316830,
+  316860,
+  316861,
+  316862,
+  316863,
+  316864,
+  316865,
+  316866,
+  316867,
+  316868,
+  316869,
+  316880,
+  316910,
+  316920,
+  316960,
+  316961,
+  316962,
+  316963,
+  316964,
+  316965,
+  316966,
+  316967,
+  316980,
+  317050,
+  317070,
+  317090,
+  317140,
+  317150,
+  317190,
+  317200,
+  317201,
+  317202,
+  317203,
+  317208,
+  317230,
+  317240,
+  317350,
+  317430,
+  317450,
+  317451,
+  317452,
+  317453,
+  317454,
+  317455,
+  317460,
+  317461,
+  317462,
+  317463,
+  317464,
+  317465,
+  317480,
+  317490,
+  317500,
+  317501,
+  317540,
+  317550,
+  317590,
+  317591,
+  317592,
+  317660,
+  317670,
+  317690,
+  317740,
+  317770,
+  317800,
+  317830,
+  317831,
+  317832,
+  317833,
+  317850,
+  317860,
+  317880,
+  317890,
+  317960,
+  318010,
+  318050,
+  318070,
+  318071,
+  318072,
+  318073,
+  318074,
+  318075,
+  318077,
+  318110,
+  318111,
+  318140,
+  318150,
+  318240,
+  318270,
+  318271,
+  318272,
+  318280,
+  318281,
+  318290,
+  318390,
+  318400,
+  318401,
+  318402,
+  318410,
+  318411,
+  318412,
+  318413,
+  318414,
+  318420,
+  318490,
+  318500,
+  318510,
+  318511,
+  318520,
+  318521,
+  318550,
+  318590,
+  318591,
+  318620,
+  318640,
+  318710,
+  318720,
+  318750,
+  318751,
+  318770,
+  318790,
+  318791,
+  318792,
+  318793,
+  318794,
+  318795,
+  318796,
+  318797,
+  318798,
+  318799,
+  318800,
+  318801,
+  318802,
+  318803,
+  318804,
+  318805,
+  318810,
+  318830,
+  318850,
+  318870,
+  318871,
+  318872,
+  318873,
+  318874,
+  318875,
+  318880,
+  318940,
+  318960,
+  318980,
+  318990,
+  319000,
+  319010,
+  319011,
+  319012,
+  319013,
+  319014,
+  319015,
+  319016,
+  319017,
+  319018,
+  319020,
+  319030,
+  319060,
+  319070,
+  319090,
+  319120,
+  319220,
+  319240,
+  319290,
+  319310,
+  319350,
+  319360,
+  319361,
+  319580,
+  319790,
+  319800,
+  319810,
+  319820,
+  319821,
+  319840,
+  319880,
+  319920,
+  319930,
+  319980,
+  319990,
+  320000,
+  320010,
+  320030,
+  320050,
+  320051,
+  320052,
+  320170,
+  320180,
+  320190,
+  320200,
+  320210,
+  320220,
+  320350,
+  320351,
+  320352,
+  320353,
+  320360,
+  320361,
+  320362,
+  320363,
+  320364,
+  320370,
+  320371,
+  320372,
+  320373,
+  320374,
+  320380,
+  320381,
+  320382,
+  320383,
+  320384,
+  320385,
+  320386,
+  320387,
+  320388,
+  320390,
+  320420,
+  320440,
+  320530,
+  320550,
+  320551,
+  320552,
+  320553,
+  320554,
+  320555,
+  320560,
+  320570,
+  320600,
+  320601,
+  320602,
+  320710,
+  320720,
+  320721,
+  320730,
+  320740,
+  320750,
+  320830,
+  320850,
+  320860,
+  320900,
+  320920,
+  320940,
+  320986,
+  320987,
+  320988,
+  320989,
+  320990,
+  320991,
+  320992,
+  320993,
+  320994,
+  320995,
+  321000,
+  321070,
+  321100,
+  321140,
+  321141,
+  321142,
+  321170,
+  321180,
+  321181,
+  321182,
+  321230,
+  321231,
+  321232,
+  321250,
+  321300,
+  321380,
+  321420,
+  321421,
+  321430,
+  321440,
+  321460,
+  321470,
+  321471,
+  321472,
+  321473,
+  321474,
+  321475,
+  321476,
+  321478,
+  321510,
+  321540,
+  321580,
+  321620,
+  321640,
+  321641,
+  321642,
+  321643,
+  321644,
+  321645,
+  321646,
+  321647,
+  321648,
+  321649,
+  321650,
+  321690,
+  321700,
+  321730,
+  321740,
+  321900,
+  321990,
+  322000,
+  322020,
+  322021,
+  322022,
+  322050,
+  322060,
+  322070,
+  322090,
+  322100,
+  322140,
+  322141,
+  322150,
+  322151,
+  322152,
+  322153,
+  322200,
+  322310,
+  322360,
+  322361,
+  322410,
+  322420,
+  322480,
+  322490,
+  322510,
+  322660,
+  322690,
+  322700,
+  322740,
+  322820,
+  322830,
+  322840,
+  322860,
+  322960,
+  323010,
+  323110,
+  323120,
+  323130,
+  323140,
+  323150,
+  323160,
+  323170,
+  323180,
+  323210,
+  323230,
+  323290,
+  323340,
+  323341,
+  323360,
+  323390,
+  323410,
+  323420,
+  323440,
+  323441,
+  323442,
+  323443,
+  323500,
+  323510,
+  323520,
+  323530,
+  323560,
+  323570,
+  323620,
+  323650,
+  323660,
+  323730,
+  323740,
+  323750,
+  323870,
+  323871,
+  323872,
+  323910,
+  323930,
+  323931,
+  323932,
+  323933,
+  323934,
+  323935,
+  323936,
+  323940,
+  324020,
+  324030,
+  324040,
+  324130,
+  324180,
+  324200,
+  324230,
+  324250,
+  324290,
+  324300,
+  324330,
+  324331,
+  324332,
+  324333,
+  324340,
+  324341,
+  324342,
+  324343,
+  324344,
+  324350,
+  324351,
+  324352,
+  324480,
+  324590,
+  324600,
+  324601,
+  324602,
+  324720,
+  324780,
+  324870,
+  324890,
+  324910,
+  324911,
+  324912,
+  324913,
+  324920,
+  325040,
+  325041,
+  325042,
+  325043,
+  325044,
+  325070,
+  325080,
+  325100,
+  325130,
+  325131,
+  325132,
+  325133,
+  325134,
+  325135,
+  325136,
+  325137,
+  325138,
+  325139,
+  325140,
+  325141,
+  325142,
+  325143,
+  325144,
+  325170,
+  325180,
+  325270,
+  325330,
+  325340,
+  325350,
+  325440,
+  325460,
+  325461,
+  325462,
+  325480,
+  325500,
+  325501,
+  325502,
+  325503,
+  325504,
+  325560,
+  325570,
+  325580,
+  325590,
+  325640,
+  325660,
+  325670,
+  325680,
+  325690,
+  325691,
+  325692,
+  325693,
+  325710,
+  325711,
+  325712,
+  325713,
+  325714,
+  325715,
+  325716,
+  325717,
+  325720,
+  325721,
+  325722,
+  325723,
+  325724,
+  325910,
+  325940,
+  325950,
+  325951,
+  325952,
+  325953,
+  325954,
+  325955,
+  325956,
+  325957,
+  325958,
+  325959,
+  325960,
+  325961,
+  325962,
+  325963,
+  325964,
+  325965,
+  325966,
+  325967,
+  325968,
+  325969,
+  325970,
+  325971,
+  325972,
+  325973,
+  325974,
+  325975,
+  325976,
+  325977,
+  325978,
+  325979,
+  325981,
+  325982,
+  325983,
+  325987,
+  325988,
+  325989,
+  325990,
+  325991,
+  325992,
+  325993,
+  325994,
+  325996,
+  326001,
+  326002,
+  326003,
+  326004,
+  326005,
+  326006,
+  326007,
+  326008,
+  326009,
+  326010,
+  326011,
+  326012,
+  326013,
+  326014,
+  326015,
+  326016,
+  326017,
+  326018,
+  326019,
+  326020,
+  326021,
+  326022,
+  326023,
+  326024,
+  326025,
+  326026,
+  326027,
+  326028,
+  326029,
+  326030,
+  326031,
+  326033,
+  326034,
+  326035,
+  326036,
+  326037,
+  326038,
+  326039,
+  326040,
+  326041,
+  326042,
+  326043,
+  326044,
+  326045,
+  326046,
+  326047,
+  326049,
+  326050,
+  326070,
+  326170,
+  326210,
+  326240,
+  326250,
+  326270,
+  326290,
+  326300,
+  326310,
+  326370,
+  326390,
+  326391,
+  326400,
+  326430,
+  326431,
+  326451,
+  326452,
+  326500,
+  326510,
+  326530,
+  326600,
+  326610,
+  326620,
+  326621,
+  326622,
+  326623,
+  326624,
+  326690,
+  326691,
+  326750,
+  326760,
+  326770,
+  326771,
+  326772,
+  326790,
+  326810,
+  326880,
+  327040,
+  327050,
+  327080,
+  327130,
+  327170,
+  327171,
+  327172,
+  327173,
+  327174,
+  327175,
+  327176,
+  327177,
+  327180,
+  327191,
+  327200,
+  327230,
+  327231,
+  327232,
+  327270,
+  327280,
+  327340,
+  327460,
+  327461,
+  327470,
+  327480,
+  327490,
+  327530,
+  327580,
+  327581,
+  327582,
+  327583,
+  327584,
+  327610,
+  327810,
+  327830,
+  327831,
+  327840,
+  327850,
+  327970,
+  327971,
+  327972,
+  327973,
+  328020,
+  328021,
+  328022,
+  328030,
+  328031,
+  328040,
+  328041,
+  328110,
+  328120,
+  328130,
+  328150,
+  328160,
+  328170,
+  328171,
+  328200,
+  328210,
+  328230,
+  328260,
+  328280,
+  328290,
+  328400,
+  328401,
+  328402,
+  328480,
+  328520,
+  328690,
+  328700,
+  328750,
+  328790,
+  328802,
+  328803,
+  328804,
+  328810,
+  328811,
+  328812,
+  328813,
+  328814,
+  328815,
+  328816,
+  328817,
+  328818,
+  328820,
+  328821,
+  328850,
+  328860,
+  328861,
+  328950,
+  329010,
+  329011,
+  329012,
+  329013,
+  329080,
+  329081,
+  329100,
+  329150,
+  329180,
+  329230,
+  329270,
+  329360,
+  329370,
+  329510,
+  329530,
+  329550,
+  329551,
+  329580,
+  329590,
+  329600,
+  329710,
+  329720,
+  329740,
+  329760,
+  329820,
+  329821,
+  329822,
+  329823,
+  329840,
+  329850,
+  329880,
+  329890,
+  329910,
+  329920,
+  329930,
+  329940,
+  329990,
+  329991,
+  330010,
+  330030,
+  330040,
+  330070,
+  330130,
+  330160,
+  330230,
+  330240,
+  330260,
+  330280,
+  330290,
+  330340,
+  330360,
+  330361,
+  330362,
+  330363,
+  330380,
+  330430,
+  330440,
+  330480,
+  330490,
+  330491,
+  330510,
+  330511,
+  330630,
+  330631,
+  330650,
+  330690,
+  330730,
+  330750,
+  330810,
+  330860,
+  330950,
+  330960,
+  330961,
+  330970,
+  330980,
+  330981,
+  330982,
+  330983,
+  330984,
+  330985,
+  330986,
+  330987,
+  330988,
+  331000,
+  331040,
+  331060,
+  331061,
+  331062,
+  331063,
+  331064,
+  331065,
+  331066,
+  331067,
+  331068,
+  331069,
+  331070,
+  331071,
+  331072,
+  331103,
+  331104,
+  331105,
+  331106,
+  331107,
+  331108,
+  331113,
+  331114,
+  331115,
+  331116,
+  331117,
+  331118,
+  331130,
+  331180,
+  331181,
+  331230,
+  331240,
+  331250,
+  331260,
+  331300,
+  331310,
+  331330,
+  331350,
+  331351,
+  331352,
+  331353,
+  331354,
+  331355,
+  331356,
+  331357,
+  331358,
+  331380,
+  331420,
+  331490,
+  331491,
+  331492,
+  331520,
+  331550,
+  331620,
+  331740,
+  331800,
+  331890,
+  331891,
+  331892,
+  331900,
+  331930,
+  331950,
+  331960,
+  332000,
+  332001,
+  332010,
+  332011,
+  332020,
+  332030,
+  332110,
+  332120,
+  332130,
+  332170,
+  332180,
+  332190,
+  332191,
+  332210,
+  332220,
+  332221,
+  332222,
+  332223,
+  332224,
+  332225,
+  332226,
+  332227,
+  332228,
+  332229,
+  332230,
+  332231,
+  332232,
+  332240,
+  332290,
+  332291,
+  332292,
+  332293,
+  332340,
+  332350,
+  332360,
+  332420,
+  332430,
+  332460,
+  332510,
+  332560,
+  332670,
+  332740,
+  332750,
+  332820,
+  332850,
+  332890,
+  332990,
+  333000,
+  333030,
+  333040,
+  333050,
+  333051,
+  333052,
+  333060,
+  333070,
+  333071,
+  333080,
+  333081,
+  333082,
+  333083,
+  333084,
+  333087,
+  333088,
+  333090,
+  333091,
+  333110,
+  333150,
+  333160,
+  333170,
+  333180,
+  333181,
+  333182,
+  333190,
+  333191,
+  333192,
+  333193,
+  333230,
+  333320,
+  333400,
+  333410,
+  333440,
+  333441,
+  333450,
+  333460,
+  333470,
+  333480,
+  333481,
+  333520,
+  333560,
+  333630,
+  333680,
+  333700,
+  333710,
+  333720,
+  333770,
+  333771,
+  333772,
+  333773,
+  333780,
+  333790,
+  333800,
+  333810,
+  333811,
+  333812,
+  333813,
+  333814,
+  333815,
+  333816,
+  333817,
+  333840,
+  333850,
+  333890,
+  333891,
+  333892,
+  333900,
+  333910,
+  333920,
+  333921,
+  334010,
+  334020,
+  334050,
+  334060,
+  334080,
+  334090,
+  334110,
+  334111,
+  334112,
+  334113,
+  334150,
+  334160,
+  334161,
+  334180,
+  334220,
+  334221,
+  334330,
+  334340,
+  334380,
+  334390,
+  334400,
+  334401,
+  334402,
+  334430,
+  334440,
+  334441,
+  334442,
+  334450,
+  334510,
+  334520,
+  334530,
+  334580,
+  334590,
+  334610,
+  334611,
+  334740,
+  334770,
+  334771,
+  334772,
+  334773,
+  334774,
+  334780,
+  334781,
+  334782,
+  334790,
+  334791,
+  334792,
+  334793,
+  334810,
+  334890,
+  334900,
+  334970,
+  334990,
+  335020,
+  335030,
+  335060,
+  335110,
+  335130,
+  335160,
+  335170,
+  335250,
+  335260,
+  335290,
+  335350,
+  335370,
+  335473,
+  335474,
+  335475,
+  335476,
+  335477,
+  335478,
+  335483,
+  335484,
+  335485,
+  335486,
+  335487,
+  335488,
+  335490,
+  335491,
+  335492,
+  335510,
+  335520,
+  335580,
+  335610,
+  335611,
+  335630,
+  335631,
+  335632,
+  335633,
+  335634,
+  335640,
+  335650,
+  335800,
+  335810,
+  335930,
+  335981,
+  335982,
+  335990,
+  335991,
+  336050,
+  336070,
+  336170,
+  336180,
+  336260,
+  336270,
+  336290,
+  336310,
+  336320,
+  336370,
+  336400,
+  336450,
+  336460,
+  336530,
+  336620,
+  336650,
+  336660,
+  336661,
+  336800,
+  336810,
+  336830,
+  336831,
+  336850,
+  336851,
+  336860,
+  336870,
+  336900,
+  337020,
+  337070,
+  337090,
+  337100,
+  337101,
+  337102,
+  337103,
+  337104,
+  337105,
+  337120,
+  337160,
+  337400,
+  337570,
+  337660,
+  337661,
+  337740,
+  337750,
+  337810,
+  337840,
+  337870,
+  337871,
+  337872,
+  337900,
+  337901,
+  337902,
+  337910,
+  338160,
+  338161,
+  338162,
+  338163,
+  338200,
+  338201,
+  338202,
+  338210,
+  338230,
+  338240,
+  338250,
+  338360,
+  338370,
+  338371,
+  338372,
+  338440,
+  338450,
+  338451,
+  338452,
+  338453,
+  338470,
+  338480,
+  338510,
+  338511,
+  338512,
+  338513,
+  338514,
+  338515,
+  338516,
+  338517,
+  338518,
+  338519,
+  338520,
+  338521,
+  338522,
+  338523,
+  338524,
+  338525,
+  338580,
+  338600,
+  338620,
+  338650,
+  338661,
+  338690,
+  338700,
+  338720,
+  338721,
+  338722,
+  338723,
+  338740,
+  338741,
+  338743,
+  338744,
+  338745,
+  338746,
+  338770,
+  338850,
+  338882,
+  338900,
+  338920,
+  338950,
+  338951,
+  339010,
+  339030,
+  339031,
+  339032,
+  339033,
+  339034,
+  339070,
+  339080,
+  339140,
+  339150,
+  339151,
+  339300,
+  339301,
+  339302,
+  339303,
+  339330,
+  339380,
+  339381,
+  339382,
+  339383,
+  339384,
+  339385,
+  339386,
+  339387,
+  339388,
+  339389,
+  339390,
+  339391,
+  339392,
+  339393,
+  339394,
+  339395,
+  339396,
+  339397,
+  339398,
+  339399,
+  339410,
+  339430,
+  339480,
+  339490,
+  339550,
+  339620,
+  339630,
+  339760,
+  339770,
+  339810,
+  339870,
+  339960,
+  339961,
+  339970,
+  339980,
+  339990,
+  340010,
+  340080,
+  340110,
+  340160,
+  340230,
+  340231,
+  340232,
+  340233,
+  340260,
+  340610,
+  340620,
+  340640,
+  340661,
+  340670,
+  341140,
+  341141,
+  341190,
+  341220,
+  341320,
+  341410,
+  341610,
+  341790,
+  341810,
+  341840,
+  341841,
+  341842,
+  341843,
+  341844,
+  341845,
+  341846,
+  341847,
+  341848,
+  341849,
+  341850,
+  341960,
+  341990,
+  342000,
+  342010,
+  342050,
+  342051,
+  342160,
+  342270,
+  342290,
+  342330,
+  342590,
+  342600,
+  342680,
+  342750,
+  342751,
+  342752,
+  342753,
+  342754,
+  342755,
+  342756,
+  342757,
+  342758,
+  342759,
+  342760,
+  342761,
+  342762,
+  342763,
+  342764,
+  342765,
+  342766,
+  342767,
+  342768,
+  342769,
+  342770,
+  342771,
+  342772,
+  342773,
+  342774,
+  342775,
+  342776,
+  342777,
+  342778,
+  342779,
+  342780,
+  342781,
+  342782,
+  342783,
+  342784,
+  342785,
+  342786,
+  342787,
+  342788,
+  342789,
+  342790,
+  342791,
+  342792,
+  342793,
+  342794,
+  342795,
+  342796,
+  342797,
+  342798,
+  342799,
+  342800,
+  342801,
+  342802,
+  342803,
+  342804,
+  342805,
+  342806,
+  342807,
+  342808,
+  342809,
+  342810,
+  342811,
+  342812,
+  342813,
+  342814,
+  342815,
+  342816,
+  342817,
+  342818,
+  342819,
+  342820,
+  342821,
+  342822,
+  342823,
+  342824,
+  342825,
+  342826,
+  342827,
+  342828,
+  342829,
+  342830,
+  342831,
+  342832,
+  342833,
+  342834,
+  342835,
+  342836,
+  342837,
+  342838,
+  342839,
+  342840,
+  342841,
+  342842,
+  342843,
+  342844,
+  342845,
+  342846,
+  342847,
+  342848,
+  342849,
+  342850,
+  342851,
+  342852,
+  342853,
+  342854,
+  342855,
+  342856,
+  342857,
+  342858,
+  342859,
+  343010,
+  343050,
+  343290,
+  343300,
+  343420,
+  343421,
+  343422,
+  343423,
+  343424,
+  343425,
+  343426,
+  343460,
+  343461,
+  343462,
+  343463,
+  343464,
+  343480,
+  343510,
+  343580,
+  343590,
+  343591,
+  343592,
+  343593,
+  343594,
+  343595,
+  343596,
+  343597,
+  343598,
+  343599,
+  343600,
+  343610,
+  343611,
+  343612,
+  343613,
+  343614,
+  343615,
+  343660,
+  343700,
+  343720,
+  343760,
+  343940,
+  343950,
+  343951,
+  343952,
+  343953,
+  343955,
+  343956,
+  343959,
+  343961,
+  343962,
+  343980,
+  343981,
+  343982,
+  344050,
+  344060,
+  344070,
+  344080,
+  344090,
+  344110,
+  344120,
+  344121,
+  344122,
+  344123,
+  344140,
+  344170,
+  344171,
+  344172,
+  344173,
+  344174,
+  344175,
+  344176,
+  344177,
+  344178,
+  344200,
+  344210,
+  344250,
+  344251,
+  344252,
+  344253,
+  344254,
+  344255,
+  344256,
+  344257,
+  344258,
+  344259,
+  344290,
+  344350,
+  344351,
+  344352,
+  344353,
+  344354,
+  344355,
+  344358,
+  344359,
+  344380,
+  344381,
+  344382,
+  344383,
+  344384,
+  344385,
+  344386,
+  344387,
+  344388,
+  344389,
+  344390,
+  344391,
+  344392,
+  344393,
+  344394,
+  344395,
+  344396,
+  344397,
+  344398,
+  344399,
+  344420,
+  344421,
+  344422,
+  344423,
+  344424,
+  344430,
+  344450,
+  344460,
+  344461,
+  344462,
+  344463,
+  344490,
+  344510,
+  344530,
+  344550,
+  344551,
+  344600,
+  344650,
+  344662,
+  344730,
+  344970,
+  345040,
+  345050,
+  345150,
+  345170,
+  345190,
+  345191,
+  345300,
+  345310,
+  345370,
+  345380,
+  345470,
+  345551,
+  345552,
+  345553,
+  345554,
+  345555,
+  345556,
+  345557,
+  345558,
+  345559,
+  345560,
+  345561,
+  345562,
+  345563,
+  345564,
+  345570,
+  345670,
+  345680,
+  345681,
+  345720,
+  345740,
+  345741,
+  345800,
+  345810,
+  345830,
+  345870,
+  345900,
+  345910,
+  345930,
+  345940,
+  345950,
+  345980,
+  346070,
+  346071,
+  346170,
+  346230,
+  346260,
+  346261,
+  346280,
+  346310,
+  346311,
+  346360,
+  346480,
+  346540,
+  346541,
+  346542,
+  346570,
+  346590,
+  346600,
+  346620,
+  346660,
+  346680,
+  346720,
+  346740,
+  346741,
+  346742,
+  346743,
+  346791,
+  346870,
+  346890,
+  346980,
+  346990,
+  347070,
+  347090,
+  347100,
+  347101,
+  347102,
+  347103,
+  347104,
+  347105,
+  347110,
+  347150,
+  347152,
+  347153,
+  347154,
+  347155,
+  347180,
+  347181,
+  347182,
+  347183,
+  347190,
+  347210,
+  347211,
+  347212,
+  347213,
+  347380,
+  347400,
+  347450,
+  347490,
+  347491,
+  347492,
+  347493,
+  347494,
+  347570,
+  347640,
+  347641,
+  347642,
+  347643,
+  347644,
+  347645,
+  347650,
+  347651,
+  347652,
+  347653,
+  347654,
+  347655,
+  347880,
+  347890,
+  347900,
+  347970,
+  347980,
+  347981,
+  347990,
+  348040,
+  348070,
+  348080,
+  348090,
+  348091,
+  348100,
+  348190,
+  348200,
+  348210,
+  348310,
+  348330,
+  348370,
+  348560,
+  348561,
+  348680,
+  348681,
+  348682,
+  348683,
+  348684,
+  348685,
+  348686,
+  348687,
+  348690,
+  348750,
+  348760,
+  348880,
+  348900,
+  348940,
+  348970,
+  348990,
+  349000,
+  349050,
+  349080,
+  349090,
+  349110,
+  349130,
+  349160,
+  349170,
+  349171,
+  349172,
+  349173,
+  349174,
+  349175,
+  349176,
+  349177,
+  349180,
+  349181,
+  349182,
+  349183,
+  349184,
+  349185,
+  349230,
+  349231,
+  349280,
+  349310,
+  349330,
+  349331,
+  349350,
+  349370,
+  349430,
+  349431,
+  349660,
+  349740,
+  349770,
+  349810,
+  349820,
+  349830,
+  349930,
+  349931,
+  349932,
+  349933,
+  349934,
+  349935,
+  349936,
+  349937,
+  349938,
+  349939,
+  349940,
+  349941,
+  349960,
+  349961,
+  349970,
+  349990,
+  350060,
+  350130,
+  350170,
+  350171,
+  350172,
+  350260,
+  350270,
+  350271,
+  350272,
+  350410,
+  350412,
+  350413,
+  350414,
+  350415,
+  350420,
+  350460,
+  350520,
+  350560,
+  350570,
+  350680,
+  350690,
+  350730,
+  350750,
+  350790,
+  350820,
+  350980,
+  351070,
+  351130,
+  351131,
+  351132,
+  351280,
+  351390,
+  351430,
+  351460,
+  351461,
+  351462,
+  351550,
+  351551,
+  351552,
+  351553,
+  351554,
+  351555,
+  351556,
+  351557,
+  351558,
+  351559,
+  351560,
+  351561,
+  351562,
+  351563,
+  351564,
+  351580,
+  351581,
+  351582,
+  351583,
+  351584,
+  351590,
+  351591,
+  351650,
+  351660,
+  351670,
+  351671,
+  351672,
+  351673,
+  351674,
+  351675,
+  351676,
+  351680,
+  351740,
+  351760,
+  351770,
+  351890,
+  351930,
+  352000,
+  352021,
+  352111,
+  352150,
+  352181,
+  352182,
+  352183,
+  352184,
+  352185,
+  352186,
+  352187,
+  352188,
+  352189,
+  352200,
+  352230,
+  352280,
+  352290,
+  352310,
+  352320,
+  352321,
+  352322,
+  352323,
+  352324,
+  352325,
+  352326,
+  352327,
+  352328,
+  352329,
+  352330,
+  352331,
+  352332,
+  352333,
+  352334,
+  352335,
+  352336,
+  352337,
+  352338,
+  352339,
+  352340,
+  352341,
+  352342,
+  352343,
+  352380,
+  352390,
+  352391,
+  352490,
+  352510,
+  352511,
+  352512,
+  352540,
+  352560,
+  352570,
+  352590,
+  352680,
+  352690,
+  352710,
+  352730,
+  352820,
+  352830,
+  352840,
+  352860,
+  352861,
+  352862,
+  352870,
+  352871,
+  352872,
+  352873,
+  352874,
+  352875,
+  352920,
+  352921,
+  352922,
+  352923,
+  352924,
+  352925,
+  352926,
+  352927,
+  352928,
+  352940,
+  352941,
+  352942,
+  352943,
+  352944,
+  352980,
+  352990,
+  352991,
+  353000,
+  353040,
+  353041,
+  353050,
+  353051,
+  353052,
+  353053,
+  353060,
+  353100,
+  353101,
+  353120,
+  353140,
+  353250,
+  353251,
+  353252,
+  353310,
+  353311,
+  353350,
+  353570,
+  353571,
+  353590,
+  353620,
+  353740,
+  353741,
+  353742,
+  353760,
+  353761,
+  353770,
+  353820,
+  353830,
+  353850,
+  353860,
+  353870,
+  353930,
+  353970,
+  354020,
+  354060,
+  354080,
+  354170,
+  354171,
+  354190,
+  354260,
+  354270,
+  354300,
+  354330,
+  354331,
+  354350,
+  354390,
+  354410,
+  354411,
+  354412,
+  354413,
+  354414,
+  354415,
+  354416,
+  354417,
+  354418,
+  354419,
+  354420,
+  354421,
+  354425,
+  354426,
+  354427,
+  354428,
+  354429,
+  354460,
+  354461,
+  354462,
+  354463,
+  354464,
+  354465,
+  354466,
+  354467,
+  354468,
+  354469,
+  354470,
+  354570,
+  354700,
+  354701,
+  354702,
+  354710,
+  354750,
+  354790,
+  354800,
+  354890,
+  354940,
+  355000,
+  355030,
+  355200,
+  355201,
+  355202,
+  355203,
+  355204,
+  355205,
+  355206,
+  355207,
+  355208,
+  355209,
+  355210,
+  355260,
+  355262,
+  355290,
+  355300,
+  355340,
+  355341,
+  355360,
+  355390,
+  355440,
+  355450,
+  355500,
+  355580,
+  355590,
+  355600,
+  355610,
+  355611,
+  355612,
+  355640,
+  355641,
+  355700,
+  355730,
+  355740,
+  355770,
+  355830,
+  355880,
+  355890,
+  355900,
+  355950,
+  355960,
+  356120,
+  356121,
+  356122,
+  356123,
+  356124,
+  356140,
+  356230,
+  356231,
+  356240,
+  356300,
+  356301,
+  356410,
+  356440,
+  356470,
+  356471,
+  356472,
+  356473,
+  356474,
+  356590,
+  356591,
+  356592,
+  356593,
+  356620,
+  356630,
+  356740,
+  356741,
+  356742,
+  356743,
+  356744,
+  356750,
+  356751,
+  356780,
+  356830,
+  356831,
+  356900,
+  356940,
+  356950,
+  356960,
+  356970,
+  356980,
+  357040,
+  357060,
+  357080,
+  357090,
+  357100,
+  357110,
+  357130,
+  357131,
+  357160,
+  357161,
+  357162,
+  357163,
+  357170,
+  357171,
+  357180,
+  357210,
+  357240,
+  357250,
+  357260,
+  357261,
+  357262,
+  357350,
+  357360,
+  357440,
+  357450,
+  357660,
+  357710,
+  357711,
+  357760,
+  357790,
+  357800,
+  357810,
+  357820,
+  357850,
+  357970,
+  357980,
+  358020,
+  358100,
+  358101,
+  358102,
+  358120,
+  358140,
+  358141,
+  358142,
+  358143,
+  358144,
+  358150,
+  358470,
+  358620,
+  358660,
+  358661,
+  358662,
+  358670,
+  358671,
+  358672,
+  358673,
+  358674,
+  358675,
+  358800,
+  358820,
+  358850,
+  358870,
+  358880,
+  358940,
+  358970,
+  358980,
+  358981,
+  358982,
+  358983,
+  358984,
+  358985,
+  358986,
+  358987,
+  358988,
+  358989,
+  358990,
+  358991,
+  358992,
+  359000,
+  359001,
+  359010,
+  359030,
+  359031,
+  359032,
+  359033,
+  359034,
+  359035,
+  359036,
+  359130,
+  359180,
+  359380,
+  359480,
+  359490,
+  359491,
+  359492,
+  359493,
+  359494,
+  359495,
+  359496,
+  359497,
+  359498,
+  359500,
+  359520,
+  359521,
+  359522,
+  359530,
+  359540,
+  359570,
+  359590,
+  359760,
+  359780,
+  359781,
+  359790,
+  359860,
+  359890,
+  359930,
+  360020,
+  360070,
+  360080,
+  360090,
+  360091,
+  360092,
+  360093,
+  360094,
+  360095,
+  360096,
+  360097,
+  360098,
+  360099,
+  360110,
+  360111,
+  360112,
+  360113,
+  360114,
+  360115,
+  360120,
+  360140,
+  360210,
+  360220,
+  360230,
+  360240,
+  360270,
+  360280,
+  360340,
+  360350,
+  360360,
+  360420,
+  360421,
+  360422,
+  360423,
+  360424,
+  360425,
+  360426,
+  360427,
+  360428,
+  360770,
+  360790,
+  360820,
+  360860,
+  360920,
+  360930,
+  360931,
+  360960,
+  361060,
+  361140,
+  361170,
+  361171,
+  361172,
+  361173,
+  361180,
+  361181,
+  361182,
+  361183,
+  361210,
+  361240,
+  361290,
+  361310,
+  361311,
+  361312,
+  361313,
+  361314,
+  361340,
+  361440,
+  361470,
+  361480,
+  361481,
+  361482,
+  361483,
+  361484,
+  361485,
+  361490,
+  361491,
+  361492,
+  361493,
+  361494,
+  361495,
+  361500,
+  361520,
+  361530,
+  361540,
+  361541,
+  361542,
+  361570,
+  361571,
+  361580,
+  361820,
+  361840,
+  361841,
+  361842,
+  361843,
+  361870,
+  361880,
+  362000,
+  362001,
+  362002,
+  362003,
+  362010,
+  362100,
+  362110,
+  362120,
+  362170,
+  362320,
+  362330,
+  362360,
+  362420,
+  362440,
+  362460,
+  362500,
+  362520,
+  362530,
+  362540,
+  362550,
+  362560,
+  362570,
+  362580,
+  362590,
+  362600,
+  362640,
+  362641,
+  362650,
+  362690,
+  362700,
+  362720,
+  362750,
+  362760,
+  362820,
+  362840,
+  362850,
+  362870,
+  362900,
+  362950,
+  362970,
+  362980,
+  363000,
+  363010,
+  363020,
+  363030,
+  363031,
+  363040,
+  363170,
+  363230,
+  363250,
+  363251,
+  363253,
+  363260,
+  363261,
+  363320,
+  363350,
+  363351,
+  363370,
+  363540,
+  363550,
+  363590,
+  363591,
+  363630,
+  363640,
+  363700,
+  363701,
+  363702,
+  363703,
+  363710,
+  363720,
+  363730,
+  363731,
+  363732,
+  363760,
+  363770,
+  363780,
+  363781,
+  363800,
+  363801,
+  363802,
+  363820,
+  363830,
+  363890,
+  363910,
+  363911,
+  363990,
+  364020,
+  364170,
+  364180,
+  364220,
+  364240,
+  364280,
+  364281,
+  364282,
+  364320,
+  364321,
+  364322,
+  364323,
+  364324,
+  364325,
+  364326,
+  364327,
+  364328,
+  364329,
+  364340,
+  364400,
+  364410,
+  364490,
+  364730,
+  364970,
+  365010,
+  365030,
+  365031,
+  365032,
+  365033,
+  365040,
+  365380,
+  365381,
+  365382,
+  365440,
+  365470,
+  365520,
+  365530,
+  365540,
+  365550,
+  365570,
+  365670,
+  365820,
+  365840,
+  365940,
+  365950,
+  365970,
+  366080,
+  366120,
+  366121,
+  366122,
+  366130,
+  366140,
+  366150,
+  366170,
+  366171,
+  366172,
+  366173,
+  366174,
+  366190,
+  366300,
+  366330,
+  366331,
+  366360,
+  366420,
+  366450,
+  366520,
+  366521,
+  366522,
+  366523,
+  366524,
+  366525,
+  366526,
+  366527,
+  366528,
+  366529,
+  366530,
+  366550,
+  366650,
+  366660,
+  366710,
+  366730,
+  366740,
+  366750,
+  366840,
+  366841,
+  366842,
+  366843,
+  366844,
+  366845,
+  366846,
+  366847,
+  366848,
+  366849,
+  366850,
+  366930,
+  367090,
+  367150,
+  367180,
+  367210,
+  367250,
+  367280,
+  367290,
+  367310,
+  367330,
+  367380,
+  367390,
+  367400,
+  367410,
+  367411,
+  367412,
+  367413,
+  367414,
+  367415,
+  367416,
+  367417,
+  367420,
+  367421,
+  367422,
+  367480,
+  367530,
+  367560,
+  367561,
+  367562,
+  367590,
+  367591,
+  367592,
+  367610,
+  367620,
+  367621,
+  367640,
+  367670,
+  367680,
+  367681,
+  367682,
+  367690,
+  367720,
+  367730,
+  367740,
+  367750,
+  367760,
+  367770,
+  367810,
+  367850,
+  367870,
+  367871,
+  367872,
+  367890,
+  367970,
+  368010,
+  368060,
+  368061,
+  368110,
+  368190,
+  368300,
+  368301,
+  368302,
+  368330,
+  368350,
+  368400,
+  368401,
+  368410,
+  368470,
+  368480,
+  368510,
+  368520,
+  368540,
+  368550,
+  368670,
+  368810,
+  368820,
+  368840,
+  368870,
+  368910,
+  368920,
+  368960,
+  368961,
+  369050,
+  369090,
+  369091,
+  369092,
+  369130,
+  369131,
+  369140,
+  369150,
+  369170,
+  369190,
+  369210,
+  369320,
+  369321,
+  369322,
+  369324,
+  369325,
+  369340,
+  369350,
+  369380,
+  369410,
+  369430,
+  369450,
+  369470,
+  369490,
+  369500,
+  369501,
+  369502,
+  369503,
+  369504,
+  369505,
+  369506,
+  369507,
+  369508,
+  369509,
+  369510,
+  369511,
+  369610,
+  369630,
+  369650,
+  369660,
+  369670,
+  369710,
+  369720,
+  369740,
+  369760,
+  369761,
+  369762,
+  369763,
+  369764,
+  369765,
+  369766,
+  369767,
+  369768,
+  369769,
+  369770,
+  369771,
+  369772,
+  369773,
+  369774,
+  369775,
+  369776,
+  369777,
+  369778,
+  369779,
+  369780,
+  369781,
+  369782,
+  369783,
+  369784,
+  369785,
+  369786,
+  369787,
+  369788,
+  369789,
+  369790,
+  369791,
+  369792,
+  369793,
+  369794,
+  369795,
+  369796,
+  369797,
+  369798,
+  369799,
+  369800,
+  369801,
+  369802,
+  369803,
+  369804,
+  369805,
+  369806,
+  369807,
+  369808,
+  369809,
+  369810,
+  369811,
+  369812,
+  369813,
+  369814,
+  369815,
+  369816,
+  369817,
+  369818,
+  369819,
+  369820,
+  369821,
+  369822,
+  369823,
+  369824,
+  369825,
+  369826,
+  369827,
+  369828,
+  369829,
+  369910,
+  369920,
+  369930,
+  369940,
+  369950,
+  369960,
+  369970,
+  369980,
+  370000,
+  370001,
+  370002,
+  370003,
+  370110,
+  370230,
+  370250,
+  370261,
+  370262,
+  370263,
+  370340,
+  370341,
+  370370,
+  370371,
+  370400,
+  370401,
+  370402,
+  370430,
+  370450,
+  370500,
+  370580,
+  370650,
+  370720,
+  370810,
+  370820,
+  370830,
+  370880,
+  370890,
+  370930,
+  370931,
+  370960,
+  371020,
+  371060,
+  371110,
+  371160,
+  371170,
+  371350,
+  371470,
+  371471,
+  371472,
+  371473,
+  371490,
+  371491,
+  371492,
+  371493,
+  371560,
+  371740,
+  371840,
+  371841,
+  371842,
+  371843,
+  371844,
+  371845,
+  371846,
+  371847,
+  371848,
+  371849,
+  371870,
+  371930,
+  371960,
+  372020,
+  372060,
+  372100,
+  372110,
+  372112,
+  372140,
+  372170,
+  372200,
+  372270,
+  372280,
+  372300,
+  372301,
+  372310,
+  372390,
+  372400,
+  372440,
+  372470,
+  372510,
+  372511,
+  372512,
+  372520,
+  372550,
+  372590,
+  372630,
+  372650,
+  372660,
+  372710,
+  372810,
+  372870,
+  372900,
+  372910,
+  372920,
+  372980,
+  373000,
+  373090,
+  373150,
+  373160,
+  373170,
+  373171,
+  373190,
+  373200,
+  373220,
+  373300,
+  373340,
+  373370,
+  373380,
+  373400,
+  373430,
+  373450,
+  373490,
+  373491,
+  373540,
+  373550,
+  373551,
+  373560,
+  373590,
+  373690,
+  373711,
+  373740,
+  373780,
+  373890,
+  373910,
+  373940,
+  373950,
+  373951,
+  373980,
+  374100,
+  374160,
+  374180,
+  374250,
+  374260,
+  374300,
+  374301,
+  374352,
+  374353,
+  374354,
+  374355,
+  374390,
+  374400,
+  374430,
+  374500,
+  374530,
+  374590,
+  374600,
+  374601,
+  374602,
+  374660,
+  374690,
+  374750,
+  374760,
+  374770,
+  374792,
+  374800,
+  374810,
+  374820,
+  374840,
+  374850,
+  374851,
+  374860,
+  374870,
+  374871,
+  374872,
+  374873,
+  374874,
+  374880,
+  374930,
+  374980,
+  375050,
+  375060,
+  375160,
+  375161,
+  375380,
+  375381,
+  375382,
+  375383,
+  375384,
+  375385,
+  375470,
+  375490,
+  375590,
+  375610,
+  375630,
+  375670,
+  375800,
+  375840,
+  375860,
+  375920,
+  376010,
+  376011,
+  376020,
+  376030,
+  376040,
+  376050,
+  376070,
+  376090,
+  376200,
+  376230,
+  376270,
+  376320,
+  376340,
+  376360,
+  376370,
+  376371,
+  376372,
+  376373,
+  376380,
+  376390,
+  376391,
+  376420,
+  376430,
+  376440,
+  376530,
+  376540,
+  376550,
+  376610,
+  376611,
+  376660,
+  376700,
+  376800,
+  376810,
+  376820,
+  376860,
+  376900,
+  376901,
+  376930,
+  376931,
+  376932,
+  376933,
+  376934,
+  376935,
+  376936,
+  376937,
+  376938,
+  376939,
+  376940,
+  376941,
+  376942,
+  376943,
+  376944,
+  376945,
+  376946,
+  376947,
+  376948,
+  376949,
+  376950,
+  376951,
+  376952,
+  376953,
+  376954,
+  376955,
+  376956,
+  376957,
+  376958,
+  376959,
+  376960,
+  376961,
+  376962,
+  376963,
+  376964,
+  376965,
+  376966,
+  376967,
+  376968,
+  376969,
+  376970,
+  376971,
+  376972,
+  376973,
+  376974,
+  376975,
+  376976,
+  376977,
+  376978,
+  376979,
+  376980,
+  376990,
+  377000,
+  377010,
+  377030,
+  377040,
+  377050,
+  377170,
+  377180,
+  377210,
+  377340,
+  377350,
+  377370,
+  377410,
+  377420,
+  377440,
+  377540,
+  377560,
+  377590,
+  377610,
+  377640,
+  377641,
+  377700,
+  377730,
+  377780,
+  377790,
+  377920,
+  377930,
+  377990,
+  378040,
+  378041,
+  378061,
+  378200,
+  378220,
+  378330,
+  378400,
+  378460,
+  378461,
+  378462,
+  378470,
+  378471,
+  378472,
+  378473,
+  378474,
+  378475,
+  378476,
+  378477,
+  378478,
+  378500,
+  378501,
+  378502,
+  378503,
+  378504,
+  378505,
+  378520,
+  378521,
+  378550,
+  378551,
+  378552,
+  378620,
+  378621,
+  378640,
+  378641,
+  378642,
+  378643,
+  378644,
+  378645,
+  378646,
+  378647,
+  378648,
+  378649,
+  378650,
+  378670,
+  378710,
+  378730,
+  378731,
+  378890,
+  378910,
+  378950,
+  379190,
+  379191,
+  379220,
+  379230,
+  379231,
+  379232,
+  379233,
+  379234,
+  379235,
+  379240,
+  379241,
+  379242,
+  379243,
+  379280,
+  379310,
+  379400,
+  379540,
+  379541,
+  379542,
+  379543,
+  379544,
+  379545,
+  379546,
+  379547,
+  379548,
+  379549,
+  379550,
+  379551,
+  379552,
+  379553,
+  379554,
+  379555,
+  379556,
+  379557,
+  379558,
+  379559,
+  379560,
+  379561,
+  379562,
+  379563,
+  379564,
+  379565,
+  379566,
+  379567,
+  379568,
+  379569,
+  379570,
+  379571,
+  379572,
+  379575,
+  379576,
+  379577,
+  379578,
+  379579,
+  379582,
+  379583,
+  379584,
+  379585,
+  379586,
+  379587,
+  379588,
+  379589,
+  379590,
+  379620,
+  379650,
+  379660,
+  379680,
+  379700,
+  379730,
+  379750,
+  379800,
+  379820,
+  380060,
+  380080,
+  380170,
+  380230,
+  380231,
+  380232,
+  380640,
+  380710,
+  380740,
+  380760,
+  380800,
+  380850,
+  380870,
+  380880,
+  380900,
+  380901,
+  380910,
+  381150,
+  381151,
+  381152,
+  381160,
+  381161,
+  381162,
+  381190,
+  381191,
+  381200,
+  381201,
+  381240,
+  381630,
+  381650,
+  381670,
+  381671,
+  381690,
+  381710,
+  381711,
+  381712,
+  381713,
+  381715,
+  381716,
+  381717,
+  381720,
+  381721,
+  381730,
+  381731,
+  381760,
+  381790,
+  381791,
+  381792,
+  381830,
+  381840,
+  381960,
+  381970,
+  382010,
+  382030,
+  382110,
+  382151,
+  382170,
+  382190,
+  382200,
+  382210,
+  382220,
+  382280,
+  382390,
+  382400,
+  382410,
+  382450,
+  382451,
+  382452,
+  382460,
+  382461,
+  382462,
+  382463,
+  382464,
+  382465,
+  382466,
+  382467,
+  382468,
+  382469,
+  382470,
+  382510,
+  382810,
+  382811,
+  382840,
+  382870,
+  382910,
+  382950,
+  382990,
+  383040,
+  383050,
+  383130,
+  383140,
+  383250,
+  383310,
+  383320,
+  383370,
+  383380,
+  383400,
+  383410,
+  383450,
+  383490,
+  383510,
+  383600,
+  383610,
+  383660,
+  383680,
+  383730,
+  383760,
+  383820,
+  383860,
+  383900,
+  383901,
+  383902,
+  383903,
+  383904,
+  383905,
+  383906,
+  383907,
+  383908,
+  383909,
+  383910,
+  383911,
+  383990,
+  384020,
+  384021,
+  384060,
+  384140,
+  384170,
+  384171,
+  384220,
+  384221,
+  384222,
+  384223,
+  384224,
+  384225,
+  384226,
+  384227,
+  384228,
+  384229,
+  384240,
+  384270,
+  384300,
+  384340,
+  384370,
+  384380,
+  384410,
+  384520,
+  384530,
+  384531,
+  384532,
+  384540,
+  384560,
+  384620,
+  384621,
+  384650,
+  384710,
+  384720,
+  384850,
+  385120,
+  385160,
+  385170,
+  385180,
+  385181,
+  385320,
+  385420,
+  385430,
+  385510,
+  385511,
+  385520,
+  385540,
+  385550,
+  385570,
+  385640,
+  385650,
+  385660,
+  385670,
+  385720,
+  385721,
+  385870,
+  385930,
+  385970,
+  386000,
+  386130,
+  386230,
+  386270,
+  386300,
+  386310,
+  386450,
+  386500,
+  386550,
+  386570,
+  386580,
+  386720,
+  386721,
+  386730,
+  386760,
+  386790,
+  386791,
+  386792,
+  386793,
+  386794,
+  386795,
+  386796,
+  386797,
+  386798,
+  386820,
+  386830,
+  386831,
+  386860,
+  386890,
+  386910,
+  386911,
+  386913,
+  386920,
+  387020,
+  387040,
+  387050,
+  387080,
+  387120,
+  387150,
+  387160,
+  387170,
+  387190,
+  387230,
+  387250,
+  387260,
+  387440,
+  387740,
+  387741,
+  387742,
+  387743,
+  387744,
+  387745,
+  387770,
+  387780,
+  387790,
+  387800,
+  387810,
+  387910,
+  387920,
+  387921,
+  387940,
+  387980,
+  387981,
+  387982,
+  387983,
+  387984,
+  387985,
+  387986,
+  387987,
+  388020,
+  388030,
+  388070,
+  388080,
+  388280,
+  388290,
+  388291,
+  388292,
+  388293,
+  388294,
+  388470,
+  388471,
+  388472,
+  388473,
+  388474,
+  388475,
+  388476,
+  388477,
+  388478,
+  388479,
+  388480,
+  388600,
+  388670,
+  388700,
+  388710,
+  388760,
+  388780,
+  388790,
+  388810,
+  388820,
+  388980,
+  389150,
+  389180,
+  389240,
+  389291,
+  389340,
+  389350,
+  389370,
+  389380,
+  389420,
+  389421,
+  389509,
+  389590,
+  389591,
+  389600,
+  389610,
+  389620,
+  389630,
+  389720,
+  389750,
+  389770,
+  389830,
+  389910,
+  389911,
+  389912,
+  389913,
+  389914,
+  389915,
+  389916,
+  389917,
+  389920,
+  389921,
+  389922,
+  389930,
+  389950,
+  389960,
+  389980,
+  389990,
+  390060,
+  390120,
+  390180,
+  390320,
+  390360,
+  390361,
+  390362,
+  390363,
+  390364,
+  390365,
+  390366,
+  390367,
+  390368,
+  390369,
+  390370,
+  390371,
+  390372,
+  390373,
+  390374,
+  390375,
+  390376,
+  390377,
+  390378,
+  390379,
+  390380,
+  390381,
+  390382,
+  390383,
+  390384,
+  390385,
+  390386,
+  390387,
+  390388,
+  390389,
+  390390,
+  390391,
+  390392,
+  390393,
+  390394,
+  390395,
+  390396,
+  390397,
+  390398,
+  390399,
+  390400,
+  390401,
+  390402,
+  390403,
+  390404,
+  390405,
+  390406,
+  390407,
+  390408,
+  390409,
+  390410,
+  390411,
+  390412,
+  390413,
+  390414,
+  390415,
+  390416,
+  390417,
+  390418,
+  390419,
+  390420,
+  390421,
+  390422,
+  390423,
+  390424,
+  390425,
+  390426,
+  390427,
+  390428,
+  390429,
+  390430,
+  390431,
+  390432,
+  390433,
+  390434,
+  390435,
+  390436,
+  390437,
+  390438,
+  390439,
+  390440,
+  390441,
+  390442,
+  390443,
+  390444,
+  390445,
+  390446,
+  390447,
+  390448,
+  390449,
+  390450,
+  390451,
+  390452,
+  390453,
+  390454,
+  390455,
+  390456,
+  390457,
+  390458,
+  390459,
+  390470,
+  390480,
+  390490,
+  390500,
+  390580,
+  390590,
+  390630,
+  390650,
+  390651,
+  390652,
+  390653,
+  390654,
+  390655,
+  390656,
+  390657,
+  390658,
+  390659,
+  390690,
+  390740,
+  390750,
+  390760,
+  390790,
+  390791,
+  390792,
+  390980,
+  391010,
+  391050,
+  391080,
+  391360,
+  391370,
+  391430,
+  391431,
+  391432,
+  391433,
+  391470,
+  391570,
+  391610,
+  391621,
+  391680,
+  391750,
+  391830,
+  391840,
+  391860,
+  391880,
+  391900,
+  391930,
+  391940,
+  391950,
+  392090,
+  392170,
+  392171,
+  392230,
+  392250,
+  392390,
+  392400,
+  392420,
+  392430,
+  392440,
+  392630,
+  392640,
+  392641,
+  392642,
+  392643,
+  392644,
+  392645,
+  392646,
+  392647,
+  392660,
+  392670,
+  392760,
+  392810,
+  392840,
+  392860,
+  392880,
+  392900,
+  392980,
+  393000,
+  393010,
+  393020,
+  393021,
+  393022,
+  393023,
+  393024,
+  393025,
+  393026,
+  393040,
+  393041,
+  393042,
+  393043,
+  393044,
+  393057,
+  393060,
+  393160,
+  393250,
+  393320,
+  393330,
+  393340,
+  393400,
+  393440,
+  393441,
+  393450,
+  393470,
+  393480,
+  393510,
+  393560,
+  393580,
+  393640,
+  393650,
+  393690,
+  393700,
+  393710,
+  393720,
+  393830,
+  393831,
+  393840,
+  393850,
+  393900,
+  393910,
+  393960,
+  393990,
+  394000,
+  394040,
+  394050,
+  394060,
+  394061,
+  394080,
+  394090,
+  394200,
+  394201,
+  394210,
+  394211,
+  394212,
+  394320,
+  394321,
+  394340,
+  394370,
+  394400,
+  394410,
+  394420,
+  394421,
+  394422,
+  394423,
+  394424,
+  394425,
+  394426,
+  394427,
+  394560,
+  394561,
+  394620,
+  394621,
+  394622,
+  394640,
+  394650,
+  394730,
+  394750,
+  394780,
+  394781,
+  394782,
+  394783,
+  394810,
+  394811,
+  395000,
+  395020,
+  395040,
+  395050,
+  395051,
+  395060,
+  395180,
+  395230,
+  395231,
+  395232,
+  395233,
+  395234,
+  395235,
+  395236,
+  395237,
+  395238,
+  395239,
+  395260,
+  395280,
+  395281,
+  395290,
+  395410,
+  395440,
+  395441,
+  395450,
+  395460,
+  395530,
+  395670,
+  395690,
+  395700,
+  395740,
+  395760,
+  395950,
+  395990,
+  396050,
+  396170,
+  396171,
+  396172,
+  396173,
+  396180,
+  396210,
+  396220,
+  396250,
+  396300,
+  396301,
+  396430,
+  396431,
+  396432,
+  396433,
+  396434,
+  396435,
+  396440,
+  396460,
+  396470,
+  396510,
+  396520,
+  396620,
+  396630,
+  396631,
+  396632,
+  396690,
+  396760,
+  396780,
+  396810,
+  396910,
+  396920,
+  396940,
+  396960,
+  396990,
+  397000,
+  397010,
+  397030,
+  397120,
+  397121,
+  397122,
+  397123,
+  397124,
+  397125,
+  397126,
+  397220,
+  397230,
+  397370,
+  397380,
+  397381,
+  397490,
+  397560,
+  397910,
+  397920,
+  397930,
+  398240,
+  398310,
+  398470,
+  398471,
+  398472,
+  398473,
+  398520,
+  398810,
+  398820,
+  398860,
+  398910,
+  398911,
+  398912,
+  398913,
+  398915,
+  398916,
+  398917,
+  399020,
+  399021,
+  399050,
+  399110,
+  399460,
+  399550,
+  399560,
+  399570,
+  399610,
+  399620,
+  399680,
+  399730,
+  399830,
+  399831,
+  399832,
+  399833,
+  399834,
+  399835,
+  399836,
+  399837,
+  399840,
+  399860,
+  399870,
+  399930,
+  399931,
+  400040,
+  400050,
+  400120,
+  400210,
+  400300,
+  400400,
+  400420,
+  400480,
+  400490,
+  400551,
+  400590,
+  400591,
+  400600,
+  400610,
+  400611,
+  400612,
+  400650,
+  400690,
+  400720,
+  400721,
+  400770,
+  400780,
+  400810,
+  400820,
+  400821,
+  400822,
+  400830,
+  400840,
+  400841,
+  400842,
+  400850,
+  400890,
+  400891,
+  400892,
+  400893,
+  400894,
+  400895,
+  400896,
+  400897,
+  400898,
+  400899,
+  400900,
+  400901,
+  400902,
+  400903,
+  400904,
+  400905,
+  400906,
+  400907,
+  400908,
+  400909,
+  400920,
+  400921,
+  400922,
+  400923,
+  400924,
+  400925,
+  400926,
+  400927,
+  400928,
+  400929,
+  400930,
+  400931,
+  400932,
+  400933,
+  400934,
+  400935,
+  400936,
+  400937,
+  400938,
+  400939,
+  400950,
+  400960,
+  400961,
+  400962,
+  400963,
+  400964,
+  400965,
+  400966,
+  400967,
+  400968,
+  400969,
+  400970,
+  400971,
+  400972,
+  400973,
+  400974,
+  400975,
+  400976,
+  400977,
+  400978,
+  400979,
+  400980,
+  400981,
+  400982,
+  400983,
+  400984,
+  400985,
+  400986,
+  400987,
+  400988,
+  400989,
+  400990,
+  400991,
+  400992,
+  400993,
+  400994,
+  400995,
+  400996,
+  400997,
+  400998,
+  400999,
+  401000,
+  401001,
+  401002,
+  401003,
+  401004,
+  401005,
+  401006,
+  401007,
+  401008,
+  401009,
+  401010,
+  401011,
+  401012,
+  401013,
+  401014,
+  401015,
+  401016,
+  401017,
+  401018,
+  401019,
+  401020,
+  401021,
+  401022,
+  401023,
+  401024,
+  401025,
+  401026,
+  401027,
+  401028,
+  401029,
+  401030,
+  401031,
+  401032,
+  401033,
+  401034,
+  401035,
+  401036,
+  401037,
+  401038,
+  401039,
+  401040,
+  401041,
+  401042,
+  401043,
+  401044,
+  401045,
+  401046,
+  401047,
+  401048,
+  401049,
+  401050,
+  401051,
+  401052,
+  401053,
+  401054,
+  401055,
+  401056,
+  401057,
+  401058,
+  401059,
+  401060,
+  401061,
+  401062,
+  401063,
+  401064,
+  401065,
+  401066,
+  401067,
+  401068,
+  401069,
+  401070,
+  401071,
+  401072,
+  401073,
+  401074,
+  401075,
+  401076,
+  401077,
+  401078,
+  401079,
+  401080,
+  401081,
+  401082,
+  401090,
+  401110,
+  401260,
+  401270,
+  401320,
+  401340,
+  401341,
+  401380,
+  401390,
+  401391,
+  401430,
+  401440,
+  401450,
+  401460,
+  401470,
+  401490,
+  401500,
+  401530,
+  401540,
+  401580,
+  401590,
+  401600,
+  401610,
+  401620,
+  401621,
+  401622,
+  401623,
+  401624,
+  401625,
+  401626,
+  401627,
+  401628,
+  401629,
+  401630,
+  401631,
+  401632,
+  401633,
+  401634,
+  401635,
+  401640,
+  401650,
+  401660,
+  401670,
+  401700,
+  401740,
+  401850,
+  401860,
+  401920,
+  402110,
+  402140,
+  402141,
+  402142,
+  402143,
+  402230,
+  402240,
+  402270,
+  402290,
+  402350,
+  402370,
+  402460,
+  402520,
+  402550,
+  402551,
+  402640,
+  402650,
+  402660,
+  402680,
+  402690,
+  402700,
+  402740,
+  402950,
+  402990,
+  403030,
+  403040,
+  403050,
+  403051,
+  403052,
+  403060,
+  403061,
+  403062,
+  403063,
+  403080,
+  403140,
+  403150,
+  403151,
+  403152,
+  403153,
+  403220,
+  403240,
+  403260,
+  403280,
+  403320,
+  403330,
+  403350,
+  403351,
+  403450,
+  403451,
+  403452,
+  403453,
+  403454,
+  403455,
+  403456,
+  403457,
+  403470,
+  403480,
+  403500,
+  403520,
+  403540,
+  403550,
+  403630,
+  403710,
+  403730,
+  403731,
+  403750,
+  403760,
+  403761,
+  403762,
+  403763,
+  403764,
+  403765,
+  403766,
+  403767,
+  403768,
+  403769,
+  403770,
+  403790,
+  403870,
+  403890,
+  403910,
+  403930,
+  403990,
+  404010,
+  404011,
+  404012,
+  404013,
+  404014,
+  404015,
+  404020,
+  404060,
+  404090,
+  404130,
+  404131,
+  404140,
+  404141,
+  404142,
+  404190,
+  404210,
+  404211,
+  404212,
+  404213,
+  404214,
+  404215,
+  404216,
+  404217,
+  404218,
+  404219,
+  404220,
+  404230,
+  404240,
+  404250,
+  404280,
+  404281,
+  404282,
+  404283,
+  404284,
+  404285,
+  404286,
+  404287,
+  404288,
+  404289,
+  404320,
+  404340,
+  404350,
+  404430,
+  404450,
+  404570,
+  404610,
+  404650,
+  404670,
+  404790,
+  404800,
+  404840,
+  404910,
+  404930,
+  404980,
+  404981,
+  404982,
+  404990,
+  405030,
+  405031,
+  405032,
+  405033,
+  405080,
+  405100,
+  405130,
+  405170,
+  405210,
+  405220,
+  405230,
+  405260,
+  405360,
+  405390,
+  405430,
+  405450,
+  405460,
+  405470,
+  405510,
+  405511,
+  405512,
+  405513,
+  405514,
+  405515,
+  405520,
+  405580,
+  405660,
+  405690,
+  405700,
+  405730,
+  405840,
+  405920,
+  405930,
+  405940,
+  406030,
+  406040,
+  406050,
+  406060,
+  406071,
+  406072,
+  406073,
+  406074,
+  406075,
+  406076,
+  406077,
+  406078,
+  406100,
+  406140,
+  406190,
+  406230,
+  406240,
+  406320,
+  406321,
+  406322,
+  406323,
+  406324,
+  406325,
+  406326,
+  406370,
+  406420,
+  406421,
+  406422,
+  406440,
+  406450,
+  406460,
+  406470,
+  406480,
+  406490,
+  406500,
+  406510,
+  406520,
+  406521,
+  406540,
+  406560,
+  406570,
+  406580,
+  406590,
+  406600,
+  406610,
+  406620,
+  406700,
+  406770,
+  406800,
+  406830,
+  406840,
+  406950,
+  406960,
+  407010,
+  407011,
+  407070,
+  407080,
+  407140,
+  407200,
+  407210,
+  407280,
+  407400,
+  407450,
+  407451,
+  407460,
+  407470,
+  407471,
+  407472,
+  407473,
+  407474,
+  407475,
+  407480,
+  407540,
+  407760,
+  407800,
+  407820,
+  407821,
+  407822,
+  407823,
+  407870,
+  407920,
+  408040,
+  408041,
+  408050,
+  408070,
+  408100,
+  408101,
+  408102,
+  408140,
+  408150,
+  408160,
+  408210,
+  408220,
+  408260,
+  408270,
+  408300,
+  408350,
+  408360,
+  408370,
+  408380,
+  408381,
+  408390,
+  408430,
+  408450,
+  408500,
+  408510,
+  408550,
+  408560,
+  408580,
+  408590,
+  408600,
+  408610,
+  408630,
+  408660,
+  408680,
+  408690,
+  408710,
+  408730,
+  408930,
+  408940,
+  408950,
+  408970,
+  408980,
+  408982,
+  408983,
+  408984,
+  409020,
+  409050,
+  409060,
+  409080,
+  409110,
+  409111,
+  409140,
+  409141,
+  409142,
+  409143,
+  409144,
+  409145,
+  409146,
+  409180,
+  409190,
+  409191,
+  409192,
+  409193,
+  409194,
+  409200,
+  409201,
+  409202,
+  409203,
+  409204,
+  409210,
+  409230,
+  409240,
+  409241,
+  409250,
+  409251,
+  409252,
+  409253,
+  409254,
+  409255,
+  409256,
+  409257,
+  409330,
+  409430,
+  409470,
+  409480,
+  409500,
+  409550,
+  409551,
+  409552,
+  409570,
+  409650,
+  409651,
+  409652,
+  409653,
+  409740,
+  409750,
+  409760,
+  409840,
+  409841,
+  409842,
+  409843,
+  410100,
+  410140,
+  410160,
+  410170,
+  410250,
+  410260,
+  410280,
+  410300,
+  410301,
+  410302,
+  410303,
+  410310,
+  410311,
+  410400,
+  410410,
+  410420,
+  410450,
+  410460,
+  410480,
+  410530,
+  410531,
+  410620,
+  410630,
+  410640,
+  410641,
+  410650,
+  410651,
+  410652,
+  410653,
+  410654,
+  410690,
+  410750,
+  410760,
+  410780,
+  410790,
+  410810,
+  410940,
+  410950,
+  411010,
+  411020,
+  411030,
+  411040,
+  411050,
+  411100,
+  411110,
+  411150,
+  411170,
+  411340,
+  411350,
+  411380,
+  411400,
+  411401,
+  411410,
+  411420,
+  411460,
+  411470,
+  411510,
+  411650,
+  411700,
+  411701,
+  411702,
+  411703,
+  411730,
+  411850,
+  411890,
+  411891,
+  411892,
+  411893,
+  411894,
+  411900,
+  411901,
+  411910,
+  411911,
+  411920,
+  411930,
+  411950,
+  412000,
+  412030,
+  412060,
+  412080,
+  412090,
+  412240,
+  412241,
+  412242,
+  412243,
+  412330,
+  412331,
+  412332,
+  412333,
+  412350,
+  412351,
+  412352,
+  412430,
+  412500,
+  412501,
+  412502,
+  412503,
+  412550,
+  412580,
+  412590,
+  412630,
+  412680,
+  412820,
+  412821,
+  412870,
+  412900,
+  412920,
+  412950,
+  412951,
+  412960,
+  412980,
+  412990,
+  413000,
+  413001,
+  413050,
+  413051,
+  413052,
+  413060,
+  413070,
+  413160,
+  413180,
+  413330,
+  413340,
+  413360,
+  413370,
+  413380,
+  413390,
+  413570,
+  413590,
+  413661,
+  413662,
+  413663,
+  413720,
+  413770,
+  413790,
+  413800,
+  413801,
+  413810,
+  413811,
+  413812,
+  413813,
+  413814,
+  413815,
+  413816,
+  413817,
+  413840,
+  413990,
+  413991,
+  414010,
+  414030,
+  414100,
+  414110,
+  414150,
+  414180,
+  414210,
+  414230,
+  414231,
+  414232,
+  414233,
+  414234,
+  414235,
+  414236,
+  414237,
+  414238,
+  414240,
+  414250,
+  414300,
+  414301,
+  414310,
+  414360,
+  414390,
+  414480,
+  414520,
+  414570,
+  414590,
+  414600,
+  414601,
+  414602,
+  414603,
+  414610,
+  414620,
+  414640,
+  414650,
+  414651,
+  414670,
+  414671,
+  414672,
+  414673,
+  414674,
+  414675,
+  414680,
+  414710,
+  414780,
+  414790,
+  415000,
+  415040,
+  415070,
+  415100,
+  415101,
+  415102,
+  415103,
+  415104,
+  415105,
+  415106,
+  415107,
+  415110,
+  415111,
+  415112,
+  415113,
+  415120,
+  415140,
+  415220,
+  415221,
+  415310,
+  415320,
+  415340,
+  415360,
+  415370,
+  415410,
+  415430,
+  415431,
+  415440,
+  415460,
+  415540,
+  415550,
+  415560,
+  415570,
+  415580,
+  415650,
+  415680,
+  415690,
+  415700,
+  415710,
+  415720,
+  415730,
+  415750,
+  415760,
+  415800,
+  416400,
+  416410,
+  416420,
+  416421,
+  416422,
+  416423,
+  416424,
+  416480,
+  416710,
+  416711,
+  416712,
+  416713,
+  416750,
+  416880,
+  416900,
+  416920,
+  416930,
+  417080,
+  417160,
+  417190,
+  417230,
+  417260,
+  417280,
+  417300,
+  417330,
+  417340,
+  417380,
+  417390,
+  417460,
+  417461,
+  417462,
+  417463,
+  417464,
+  417465,
+  417540,
+  417740,
+  417770,
+  417850,
+  417851,
+  417960,
+  417961,
+  417962,
+  417963,
+  417964,
+  417965,
+  417966,
+  417967,
+  417968,
+  417970,
+  417971,
+  417972,
+  417973,
+  417974,
+  417975,
+  417976,
+  418080,
+  418090,
+  418130,
+  418140,
+  418200,
+  418220,
+  418221,
+  418290,
+  418320,
+  418350,
+  418480,
+  418500,
+  418550,
+  418566,
+  418580,
+  418600,
+  418680,
+  418690,
+  418700,
+  418710,
+  418720,
+  418750,
+  418760,
+  418770,
+  418780,
+  418790,
+  418800,
+  418810,
+  418820,
+  418880,
+  418881,
+  418890,
+  418900,
+  418930,
+  418990,
+  419040,
+  419050,
+  419070,
+  419110,
+  419120,
+  419210,
+  419290,
+  419410,
+  419411,
+  419412,
+  419420,
+  419440,
+  419450,
+  419470,
+  419471,
+  419472,
+  419473,
+  419474,
+  419475,
+  419476,
+  419477,
+  419478,
+  419479,
+  419490,
+  419540,
+  419560,
+  419660,
+  419670,
+  419690,
+  419720,
+  419730,
+  419750,
+  419760,
+  419770,
+  419780,
+  419790,
+  419820,
+  419830,
+  419840,
+  419850,
+  419860,
+  419870,
+  419880,
+  419890,
+  419930,
+  419931,
+  419932,
+  419933,
+  419934,
+  419935,
+  419936,
+  419937,
+  419938,
+  419939,
+  419940,
+  419941,
+  419942,
+  419943,
+  419944,
+  419945,
+  419946,
+  419947,
+  419948,
+  419949,
+  419951,
+  419960,
+  419961,
+  419962,
+  419963,
+  419964,
+  419965,
+  419966,
+  419967,
+  419980,
+  420030,
+  420050,
+  420130,
+  420200,
+  420240,
+  420250,
+  420310,
+  420320,
+  420322,
+  420340,
+  420390,
+  420410,
+  420450,
+  420460,
+  420461,
+  420462,
+  420463,
+  420490,
+  420491,
+  420492,
+  420493,
+  420494,
+  420540,
+  420610,
+  420630,
+  420640,
+  420650,
+  420680,
+  420690,
+  420730,
+  420731,
+  420750,
+  420751,
+  420752,
+  420753,
+  420754,
+  420755,
+  420756,
+  420757,
+  420758,
+  420780,
+  420781,
+  420810,
+  420820,
+  420821,
+  420822,
+  420823,
+  420824,
+  420825,
+  420826,
+  420828,
+  420829,
+  420830,
+  420890,
+  421070,
+  421080,
+  421081,
+  421090,
+  421100,
+  421130,
+  421131,
+  421160,
+  421161,
+  421162,
+  421163,
+  421164,
+  421165,
+  421166,
+  421200,
+  421270,
+  421271,
+  421272,
+  421273,
+  421274,
+  421275,
+  421720,
+  421760,
+  421770,
+  421771,
+  421780,
+  421800,
+  421860,
+  421920,
+  421940,
+  421950,
+  422120,
+  422180,
+  422181,
+  422182,
+  422190,
+  422191,
+  422192,
+  422193,
+  422200,
+  422201,
+  422220,
+  422230,
+  422280,
+  422290,
+  422310,
+  422400,
+  422470,
+  422471,
+  422472,
+  422473,
+  422474,
+  422480,
+  422580,
+  422670,
+  422690,
+  422691,
+  422950,
+  422960,
+  422961,
+  423000,
+  423110,
+  423240,
+  423310,
+  423360,
+  423361,
+  423362,
+  423363,
+  423364,
+  423365,
+  423366,
+  423367,
+  423368,
+  423369,
+  423410,
+  423630,
+  423850,
+  423851,
+  423852,
+  423853,
+  423854,
+  423960,
+  424120,
+  424240,
+  424580,
+  424800,
+  424860,
+  424880,
+  424950,
+  424970,
+  424980,
+  425020,
+  425030,
+  425060,
+  425090,
+  425100,
+  425110,
+  425120,
+  425130,
+  425140,
+  425141,
+  425170,
+  425180,
+  425181,
+  425182,
+  425190,
+  425200,
+  425270,
+  425330,
+  425360,
+  425370,
+  425380,
+  425420,
+  425440,
+  425490,
+  425500,
+  425530,
+  425540,
+  425541,
+  425542,
+  425544,
+  425550,
+  425560,
+  425570,
+  425620,
+  425630,
+  425690,
+  425710,
+  425750,
+  425780,
+  425790,
+  425791,
+  425840,
+  425910,
+  425920,
+  425930,
+  425940,
+  425960,
+  425961,
+  425980,
+  425981,
+  425982,
+  426060,
+  426080,
+  426081,
+  426100,
+  426120,
+  426180,
+  426181,
+  426200,
+  426220,
+  426230,
+  426270,
+  426280,
+  426281,
+  426320,
+  426321,
+  426580,
+  426610,
+  426660,
+  426700,
+  426710,
+  426720,
+  426730,
+  426740,
+  426741,
+  426742,
+  426743,
+  426810,
+  426820,
+  426860,
+  426920,
+  426921,
+  426922,
+  426923,
+  426924,
+  426925,
+  426926,
+  426927,
+  426928,
+  426929,
+  426951,
+  426952,
+  426960,
+  426980,
+  426990,
+  426991,
+  426992,
+  426993,
+  426994,
+  426995,
+  426996,
+  426997,
+  426998,
+  426999,
+  427000,
+  427001,
+  427002,
+  427003,
+  427004,
+  427005,
+  427006,
+  427007,
+  427008,
+  427020,
+  427080,
+  427560,
+  427561,
+  427601,
+  427602,
+  427603,
+  427604,
+  427605,
+  427650,
+  427670,
+  427671,
+  427672,
+  427673,
+  427674,
+  427675,
+  427676,
+  427677,
+  427678,
+  427679,
+  427750,
+  427790,
+  428010,
+  428140,
+  428300,
+  428310,
+  428311,
+  428312,
+  428320,
+  428340,
+  428400,
+  428480,
+  428481,
+  428482,
+  428500,
+  428501,
+  428520,
+  428560,
+  428561,
+  428562,
+  428563,
+  428564,
+  428600,
+  428601,
+  428602,
+  428603,
+  428604,
+  428605,
+  428620,
+  428650,
+  428651,
+  428652,
+  428653,
+  428710,
+  428720,
+  428730,
+  428770,
+  428780,
+  428790,
+  428800,
+  428810,
+  428820,
+  428821,
+  428840,
+  428890,
+  428970,
+  429010,
+  429011,
+  429110,
+  429310,
+  429400,
+  429450,
+  429460,
+  429461,
+  429462,
+  429590,
+  429670,
+  429710,
+  429711,
+  429730,
+  429760,
+  429810,
+  429820,
+  429870,
+  429871,
+  429872,
+  429880,
+  429881,
+  429890,
+  429900,
+  429901,
+  429902,
+  429903,
+  429904,
+  429905,
+  429906,
+  429907,
+  429908,
+  429920,
+  429960,
+  429990,
+  430000,
+  430050,
+  430060,
+  430061,
+  430090,
+  430091,
+  430092,
+  430093,
+  430094,
+  430110,
+  430120,
+  430180,
+  430181,
+  430182,
+  430200,
+  430220,
+  430250,
+  430260,
+  430261,
+  430310,
+  430311,
+  430312,
+  430313,
+  430314,
+  430315,
+  430316,
+  430317,
+  430318,
+  430319,
+  430320,
+  430321,
+  430322,
+  430323,
+  430324,
+  430325,
+  430326,
+  430327,
+  430328,
+  430329,
+  430330,
+  430340,
+  430341,
+  430342,
+  430343,
+  430344,
+  430345,
+  430346,
+  430347,
+  430348,
+  430349,
+  430350,
+  430351,
+  430352,
+  430353,
+  430354,
+  430370,
+  430390,
+  430400,
+  430480,
+  430890,
+  430940,
+  431030,
+  431050,
+  431060,
+  431190,
+  431191,
+  431340,
+  431350,
+  431430,
+  431490,
+  431570,
+  431620,
+  431621,
+  431730,
+  431780,
+  431790,
+  431800,
+  431820,
+  431960,
+  431980,
+  432030,
+  432060,
+  432090,
+  432200,
+  432330,
+  432440,
+  432450,
+  432510,
+  432580,
+  432600,
+  432630,
+  432650,
+  432670,
+  432710,
+  432800,
+  432840,
+  432880,
+  433020,
+  433021,
+  433040,
+  433080,
+  433090,
+  433091,
+  433180,
+  433200,
+  433240,
+  433241,
+  433242,
+  433390,
+  433420,
+  433430,
+  433460,
+  433520,
+  433560,
+  433640,
+  433680,
+  433690,
+  433710,
+  433730,
+  433740,
+  433741,
+  433742,
+  433743,
+  433744,
+  433745,
+  433746,
+  433747,
+  433780,
+  433800,
+  433930,
+  434040,
+  434041,
+  434060,
+  434061,
+  434062,
+  434063,
+  434064,
+  434065,
+  434066,
+  434067,
+  434068,
+  434069,
+  434180,
+  434350,
+  434400,
+  434630,
+  434631,
+  434632,
+  434633,
+  434840,
+  434900,
+  434901,
+  434910,
+  434940,
+  434941,
+  434942,
+  434943,
+  434944,
+  434950,
+  435060,
+  435110,
+  435111,
+  435160,
+  435170,
+  435171,
+  435172,
+  435173,
+  435174,
+  435175,
+  435176,
+  435177,
+  435180,
+  435190,
+  435200,
+  435240,
+  435330,
+  435340,
+  435370,
+  435450,
+  435470,
+  435500,
+  435510,
+  435511,
+  435512,
+  435519,
+  435550,
+  435570,
+  435610,
+  435690,
+  435740,
+  435750,
+  435760,
+  435770,
+  435810,
+  435820,
+  435870,
+  435880,
+  435881,
+  435890,
+  435910,
+  435960,
+  435961,
+  435963,
+  436030,
+  436040,
+  436050,
+  436080,
+  436081,
+  436082,
+  436083,
+  436090,
+  436120,
+  436121,
+  436190,
+  436250,
+  436251,
+  436420,
+  436430,
+  436450,
+  436460,
+  436550,
+  436570,
+  436571,
+  436572,
+  436573,
+  436574,
+  436575,
+  436576,
+  436577,
+  436578,
+  436579,
+  436580,
+  436581,
+  436582,
+  436583,
+  436584,
+  436585,
+  436586,
+  436587,
+  436588,
+  436589,
+  436590,
+  436591,
+  436592,
+  436593,
+  436594,
+  436595,
+  436596,
+  436597,
+  436598,
+  436599,
+  436600,
+  436601,
+  436602,
+  436603,
+  436604,
+  436605,
+  436606,
+  436607,
+  436608,
+  436609,
+  436610,
+  436611,
+  436612,
+  436613,
+  436614,
+  436615,
+  436616,
+  436617,
+  436618,
+  436619,
+  436620,
+  436621,
+  436622,
+  436623,
+  436624,
+  436625,
+  436626,
+  436627,
+  436628,
+  436629,
+  436630,
+  436631,
+  436632,
+  436633,
+  436634,
+  436635,
+  436636,
+  436637,
+  436638,
+  436639,
+  436640,
+  436641,
+  436642,
+  436643,
+  436644,
+  436645,
+  436646,
+  436647,
+  436648,
+  436649,
+  436650,
+  436651,
+  436652,
+  436653,
+  436654,
+  436655,
+  436656,
+  436657,
+  436658,
+  436659,
+  436660,
+  436661,
+  436662,
+  436663,
+  436664,
+  436665,
+  436666,
+  436667,
+  436668,
+  436669,
+  436710,
+  436740,
+  436790,
+  436910,
+  436920,
+  436990,
+  437070,
+  437110,
+  437120,
+  437121,
+  437122,
+  437140,
+  437230,
+  437231,
+  437232,
+  437233,
+  437280,
+  437281,
+  437282,
+  437300,
+  437301,
+  437302,
+  437303,
+  437350,
+  437351,
+  437360,
+  437410,
+  437430,
+  437560,
+  437580,
+  437590,
+  437620,
+  437640,
+  437641,
+  437642,
+  437650,
+  437660,
+  437700,
+  437701,
+  437702,
+  437790,
+  437800,
+  437930,
+  437940,
+  437950,
+  437960,
+  437970,
+  437980,
+  437990,
+  438060,
+  438061,
+  438062,
+  438070,
+  438071,
+  438110,
+  438150,
+  438390,
+  438450,
+  438470,
+  438500,
+  438550,
+  438690,
+  438700,
+  438710,
+  438800,
+  438801,
+  438802,
+  438810,
+  438830,
+  438831,
+  438840,
+  438850,
+  438860,
+  438870,
+  438890,
+  438900,
+  438901,
+  438902,
+  438903,
+  438904,
+  438905,
+  438906,
+  438950,
+  438951,
+  438960,
+  438970,
+  438980,
+  438990,
+  439010,
+  439030,
+  439050,
+  439070,
+  439090,
+  439110,
+  439130,
+  439150,
+  439170,
+  439230,
+  439231,
+  439232,
+  439240,
+  439241,
+  439330,
+  439360,
+  439390,
+  439410,
+  439450,
+  439470,
+  439480,
+  439500,
+  439501,
+  439510,
+  439540,
+  439541,
+  439660,
+  439680,
+  439690,
+  439710,
+  439790,
+  439830,
+  439860,
+  439870,
+  439890,
+  439900,
+  439990,
+  439991,
+  439992,
+  439993,
+  439994,
+  439995,
+  440030,
+  440040,
+  440050,
+  440130,
+  440290,
+  440300,
+  440360,
+  440370,
+  440390,
+  440400,
+  440500,
+  440520,
+  440530,
+  440820,
+  440860,
+  440910,
+  440911,
+  440912,
+  440913,
+  440914,
+  440915,
+  440920,
+  440921,
+  440930,
+  440940,
+  440960,
+  440961,
+  440962,
+  440970,
+  440971,
+  440972,
+  440980,
+  441040,
+  441240,
+  441260,
+  441270,
+  441290,
+  441300,
+  441301,
+  441340,
+  441470,
+  441480,
+  441600,
+  441610,
+  441651,
+  441700,
+  441710,
+  441720,
+  441730,
+  441740,
+  441760,
+  441770,
+  441780,
+  441781,
+  441782,
+  441810,
+  441850,
+  441910,
+  441930,
+  441940,
+  441950,
+  442010,
+  442020,
+  442050,
+  442051,
+  442052,
+  442090,
+  442100,
+  442101,
+  442130,
+  442150,
+  442160,
+  442230,
+  442240,
+  442360,
+  442510,
+  442820,
+  442830,
+  442840,
+  442900,
+  442990,
+  443030,
+  443050,
+  443100,
+  443180,
+  443200,
+  443201,
+  443202,
+  443203,
+  443204,
+  443205,
+  443206,
+  443207,
+  443240,
+  443300,
+  443320,
+  443390,
+  443400,
+  443430,
+  443440,
+  443470,
+  443550,
+  443600,
+  443620,
+  443660,
+  443670,
+  443690,
+  443691,
+  443692,
+  443710,
+  443720,
+  443730,
+  443740,
+  443750,
+  443780,
+  443970,
+  444030,
+  444031,
+  444032,
+  444040,
+  444120,
+  444300,
+  444310,
+  444311,
+  444312,
+  444360,
+  444390,
+  444450,
+  444510,
+  444540,
+  444610,
+  444611,
+  444680,
+  444700,
+  444760,
+  444780,
+  444820,
+  444890,
+  444970,
+  445080,
+  445150,
+  445200,
+  445240,
+  445250,
+  445260,
+  445261,
+  445262,
+  445270,
+  445271,
+  445272,
+  445280,
+  445320,
+  445321,
+  445330,
+  445340,
+  445341,
+  445380,
+  445400,
+  445450,
+  445460,
+  445470,
+  445471,
+  445472,
+  445473,
+  445474,
+  445475,
+  445476,
+  445477,
+  445478,
+  445479,
+  445480,
+  445481,
+  445482,
+  445483,
+  445484,
+  445485,
+  445500,
+  445501,
+  445502,
+  445510,
+  445511,
+  445512,
+  445513,
+  445530,
+  445560,
+  445630,
+  445660,
+  445661,
+  445680,
+  445690,
+  445700,
+  445710,
+  445780,
+  445850,
+  445890,
+  445900,
+  445920,
+  445930,
+  445931,
+  445990,
+  445991,
+  445992,
+  446060,
+  446080,
+  446090,
+  446130,
+  446131,
+  446132,
+  446133,
+  446134,
+  446135,
+  446140,
+  446141,
+  446142,
+  446350,
+  446360,
+  446361,
+  446362,
+  446363,
+  446364,
+  446365,
+  446366,
+  446367,
+  446368,
+  446369,
+  446370,
+  446520,
+  446570,
+  446650,
+  446740,
+  446830,
+  446860,
+  446880,
+  446882,
+  446890,
+  446900,
+  446920,
+  446950,
+  446980,
+  447130,
+  447220,
+  447250,
+  447260,
+  447261,
+  447300,
+  447340,
+  447410,
+  447440,
+  447480,
+  447490,
+  447510,
+  447660,
+  447680,
+  447681,
+  447682,
+  447683,
+  447684,
+  447685,
+  447686,
+  447687,
+  447740,
+  447750,
+  447760,
+  447870,
+  448100,
+  448180,
+  448181,
+  448182,
+  448183,
+  448184,
+  448185,
+  448186,
+  448187,
+  448188,
+  448189,
+  448190,
+  448191,
+  448192,
+  448193,
+  448194,
+  448195,
+  448196,
+  448197,
+  448198,
+  448199,
+  448200,
+  448201,
+  448202,
+  448203,
+  448204,
+  448205,
+  448206,
+  448207,
+  448208,
+  448209,
+  448210,
+  448211,
+  448212,
+  448213,
+  448214,
+  448270,
+  448760,
+  448830,
+  449010,
+  449011,
+  449080,
+  449130,
+  449360,
+  449370,
+  449380,
+  449390,
+  449391,
+  449392,
+  449393,
+  449394,
+  449400,
+  449480,
+  449570,
+  449600,
+  449601,
+  449602,
+  449603,
+  449604,
+  449605,
+  449670,
+  449671,
+  449720,
+  449740,
+  449870,
+  449871,
+  449880,
+  449900,
+  449910,
+  449920,
+  449930,
+  449950,
+  449970,
+  449980,
+  449981,
+  449990,
+  450000,
+  450001,
+  450010,
+  450070,
+  450080,
+  450090,
+  450091,
+  450092,
+  450093,
+  450094,
+  450095,
+  450096,
+  450097,
+  450098,
+  450099,
+  450100,
+  450130,
+  450340,
+  450341,
+  450342,
+  450350,
+  450360,
+  450470,
+  450480,
+  450530,
+  450550,
+  450660,
+  450710,
+  450730,
+  450750,
+  450780,
+  450790,
+  450810,
+  450811,
+  450812,
+  450820,
+  450830,
+  450870,
+  450880,
+  450881,
+  450890,
+  450960,
+  450970,
+  450980,
+  451030,
+  451040,
+  451050,
+  451110,
+  451160,
+  451241,
+  451270,
+  451280,
+  451290,
+  451320,
+  451330,
+  451370,
+  451410,
+  451420,
+  451421,
+  451422,
+  451430,
+  451440,
+  451442,
+  451443,
+  451450,
+  451460,
+  451461,
+  451462,
+  451463,
+  451464,
+  451465,
+  451466,
+  451467,
+  451468,
+  451469,
+  451530,
+  451531,
+  451532,
+  451533,
+  451534,
+  451535,
+  451536,
+  451537,
+  451538,
+  451539,
+  451550,
+  451560,
+  451580,
+  451650,
+  451680,
+  451690,
+  451710,
+  451730,
+  451890,
+  452050,
+  452070,
+  452190,
+  452191,
+  452192,
+  452193,
+  452200,
+  452201,
+  452250,
+  452251,
+  452290,
+  452430,
+  452470,
+  452520,
+  452521,
+  452522,
+  452523,
+  452530,
+  452770,
+  452771,
+  452890,
+  452900,
+  452940,
+  452950,
+  452960,
+  452980,
+  452981,
+  452982,
+  453020,
+  453060,
+  453150,
+  453160,
+  453200,
+  453210,
+  453240,
+  453250,
+  453260,
+  453280,
+  453330,
+  453360,
+  453361,
+  453370,
+  453380,
+  453400,
+  453410,
+  453420,
+  453460,
+  453490,
+  453561,
+  453562,
+  453563,
+  453590,
+  453600,
+  453620,
+  453630,
+  454010,
+  454110,
+  454340,
+  454450,
+  454510,
+  454550,
+  454640,
+  454660,
+  454740,
+  454790,
+  454791,
+  454800,
+  454810,
+  454960,
+  455010,
+  455030,
+  455040,
+  455041,
+  455042,
+  455050,
+  455060,
+  455061,
+  455062,
+  455070,
+  455130,
+  455160,
+  455170,
+  455220,
+  455221,
+  455222,
+  455223,
+  455224,
+  455250,
+  455270,
+  455280,
+  455320,
+  455330,
+  455350,
+  455360,
+  455370,
+  455380,
+  455410,
+  455411,
+  455451,
+  455460,
+  455470,
+  455520,
+  455521,
+  455530,
+  455560,
+  455561,
+  455562,
+  455570,
+  455571,
+  455572,
+  455573,
+  455574,
+  455575,
+  455576,
+  455577,
+  455578,
+  455579,
+  455580,
+  455581,
+  455610,
+  455611,
+  455612,
+  455670,
+  455740,
+  455750,
+  455760,
+  455810,
+  455890,
+  455900,
+  456040,
+  456050,
+  456110,
+  456120,
+  456150,
+  456200,
+  456220,
+  456221,
+  456230,
+  456231,
+  456250,
+  456270,
+  456271,
+  456280,
+  456281,
+  456310,
+  456350,
+  456370,
+  456410,
+  456450,
+  456470,
+  456480,
+  456510,
+  456560,
+  456590,
+  456600,
+  456630,
+  456640,
+  456730,
+  456770,
+  456800,
+  456801,
+  456802,
+  456820,
+  456821,
+  456880,
+  456890,
+  456891,
+  456910,
+  456960,
+  457070,
+  457080,
+  457082,
+  457083,
+  457084,
+  457085,
+  457086,
+  457087,
+  457088,
+  457090,
+  457100,
+  457120,
+  457160,
+  457161,
+  457162,
+  457180,
+  457190,
+  457191,
+  457192,
+  457193,
+  457194,
+  457195,
+  457196,
+  457197,
+  457198,
+  457199,
+  457200,
+  457201,
+  457220,
+  457221,
+  457222,
+  457223,
+  457224,
+  457360,
+  457390,
+  457430,
+  457470,
+  457560,
+  457610,
+  457620,
+  457630,
+  457670,
+  457720,
+  457740,
+  457830,
+  457840,
+  457841,
+  457842,
+  457843,
+  457990,
+  458020,
+  458100,
+  458130,
+  458160,
+  458200,
+  458220,
+  458360,
+  458400,
+  458440,
+  458441,
+  458442,
+  458443,
+  458444,
+  458445,
+  458460,
+  458530,
+  458620,
+  458640,
+  458670,
+  458740,
+  458750,
+  458790,
+  458800,
+  458810,
+  458840,
+  458841,
+  458860,
+  458870,
+  458890,
+  458910,
+  459070,
+  459110,
+  459120,
+  459140,
+  459210,
+  459240,
+  459280,
+  459290,
+  459330,
+  459360,
+  459361,
+  459362,
+  459363,
+  459450,
+  459460,
+  459480,
+  459490,
+  459500,
+  459501,
+  459590,
+  459600,
+  459660,
+  459670,
+  459740,
+  459741,
+  459742,
+  459743,
+  459744,
+  459750,
+  459790,
+  459850,
+  459851,
+  459852,
+  459853,
+  459870,
+  459890,
+  460010,
+  460030,
+  460040,
+  460070,
+  460090,
+  460110,
+  460240,
+  460260,
+  460280,
+  460300,
+  460320,
+  460390,
+  460420,
+  460440,
+  460460,
+  460470,
+  460550,
+  460551,
+  460552,
+  460553,
+  460554,
+  460555,
+  460556,
+  460557,
+  460558,
+  460559,
+  460600,
+  460610,
+  460670,
+  460690,
+  460760,
+  460830,
+  460840,
+  460880,
+  460890,
+  461020,
+  461050,
+  461060,
+  461070,
+  461071,
+  461073,
+  461090,
+  461110,
+  461120,
+  461130,
+  461150,
+  461160,
+  461200,
+  461240,
+  461241,
+  461242,
+  461243,
+  461244,
+  461245,
+  461246,
+  461247,
+  461248,
+  461249,
+  461250,
+  461440,
+  461461,
+  461530,
+  461540,
+  461550,
+  461610,
+  461740,
+  461770,
+  461800,
+  461900,
+  461930,
+  461931,
+  461932,
+  461933,
+  461934,
+  461935,
+  461960,
+  461961,
+  462050,
+  462081,
+  462082,
+  462083,
+  462084,
+  462085,
+  462086,
+  462087,
+  462088,
+  462089,
+  462140,
+  462150,
+  462170,
+  462190,
+  462210,
+  462211,
+  462212,
+  462213,
+  462214,
+  462260,
+  462261,
+  462270,
+  462280,
+  462290,
+  462300,
+  462310,
+  462351,
+  462390,
+  462391,
+  462540,
+  462550,
+  462600,
+  462601,
+  462603,
+  462604,
+  462605,
+  462610,
+  462611,
+  462660,
+  462720,
+  462740,
+  462880,
+  462920,
+  462970,
+  462971,
+  462972,
+  462973,
+  463090,
+  463190,
+  463200,
+  463280,
+  463300,
+  463310,
+  463360,
+  463490,
+  463590,
+  463600,
+  463610,
+  463630,
+  463640,
+  463650,
+  463690,
+  463720,
+  463740,
+  463780,
+  463790,
+  463791,
+  463792,
+  463794,
+  463795,
+  463796,
+  463797,
+  463798,
+  463799,
+  463810,
+  463900,
+  463901,
+  463902,
+  463903,
+  463904,
+  463950,
+  463951,
+  463990,
+  464120,
+  464130,
+  464160,
+  464170,
+  464180,
+  464200,
+  464201,
+  464202,
+  464203,
+  464204,
+  464205,
+  464206,
+  464210,
+  464220,
+  464270,
+  464290,
+  464300,
+  464310,
+  464320,
+  464330,
+  464370,
+  464460,
+  464510,
+  464511,
+  464512,
+  464513,
+  464520,
+  464521,
+  464522,
+  464523,
+  464524,
+  464525,
+  464560,
+  464580,
+  464590,
+  464591,
+  464640,
+  464680,
+  464681,
+  464720,
+  464730,
+  464790,
+  464810,
+  464840,
+  464860,
+  464890,
+  464940,
+  464970,
+  464980,
+  465040,
+  465210,
+  465220,
+  465230,
+  465250,
+  465290,
+  465291,
+  465292,
+  465320,
+  465340,
+  465350,
+  465410,
+  465480,
+  465530,
+  465570,
+  465600,
+  465610,
+  465630,
+  465680,
+  465691,
+  465730,
+  465830,
+  465831,
+  465832,
+  465833,
+  465834,
+  465980,
+  466150,
+  466200,
+  466250,
+  466260,
+  466360,
+  466380,
+  466390,
+  466530,
+  466540,
+  466541,
+  466542,
+  466543,
+  466544,
+  466545,
+  466546,
+  466547,
+  466548,
+  466549,
+  466550,
+  466551,
+  466710,
+  466880,
+  466960,
+  466970,
+  467030,
+  467031,
+  467032,
+  467033,
+  467034,
+  467035,
+  467036,
+  467037,
+  467038,
+  467039,
+  467040,
+  467041,
+  467042,
+  467043,
+  467044,
+  467045,
+  467046,
+  467047,
+  467048,
+  467049,
+  467050,
+  467051,
+  467150,
+  467260,
+  467300,
+  467500,
+  467510,
+  467511,
+  467512,
+  467513,
+  467514,
+  467515,
+  467516,
+  467517,
+  467518,
+  467600,
+  467620,
+  467770,
+  467870,
+  467890,
+  467970,
+  467980,
+  468010,
+  468020,
+  468040,
+  468140,
+  468190,
+  468270,
+  468280,
+  468360,
+  468390,
+  468410,
+  468420,
+  468460,
+  468510,
+  468520,
+  468550,
+  468580,
+  468600,
+  468610,
+  468720,
+  468721,
+  468722,
+  468723,
+  468724,
+  468725,
+  468726,
+  468727,
+  468728,
+  468729,
+  468730,
+  468731,
+  468732,
+  468733,
+  468734,
+  468735,
+  468736,
+  468737,
+  468738,
+  468739,
+  468790,
+  468900,
+  469050,
+  469520,
+  469530,
+  469540,
+  469570,
+  469580,
+  469650,
+  469670,
+  469740,
+  469780,
+  469810,
+  469850,
+  469880,
+  469910,
+  469940,
+  469960,
+  470000,
+  470011,
+  470012,
+  470070,
+  470080,
+  470150,
+  470151,
+  470180,
+  470190,
+  470200,
+  470230,
+  470290,
+  470291,
+  470292,
+  470500,
+  470540,
+  470610,
+  470620,
+  470670,
+  470680,
+  470690,
+  470691,
+  470750,
+  470770,
+  470870,
+  470930,
+  471240,
+  471250,
+  471310,
+  471320,
+  471350,
+  471390,
+  471410,
+  471420,
+  471450,
+  471520,
+  471560,
+  471580,
+  471590,
+  471650,
+  471740,
+  471741,
+  471750,
+  471760,
+  471800,
+  471870,
+  471890,
+  471891,
+  471893,
+  471894,
+  471895,
+  471896,
+  471897,
+  471898,
+  471899,
+  472030,
+  472070,
+  472350,
+  472410,
+  472490,
+  472630,
+  472670,
+  472671,
+  472750,
+  472810,
+  472811,
+  472820,
+  472821,
+  472822,
+  472823,
+  472824,
+  472825,
+  472826,
+  472827,
+  472828,
+  472840,
+  472841,
+  472860,
+  472861,
+  473090,
+  473100,
+  473110,
+  473120,
+  473130,
+  473390,
+  473410,
+  473420,
+  473430,
+  473440,
+  473441,
+  473442,
+  473443,
+  473444,
+  473445,
+  473446,
+  473447,
+  473590,
+  473600,
+  473660,
+  473850,
+  473870,
+  473871,
+  473960,
+  474260,
+  474720,
+  474740,
+  474760,
+  474761,
+  474762,
+  474763,
+  474764,
+  474765,
+  474766,
+  474800,
+  474801,
+  474802,
+  474803,
+  474804,
+  474930,
+  475000,
+  475010,
+  475030,
+  475031,
+  475130,
+  475131,
+  475132,
+  475170,
+  475180,
+  475210,
+  475230,
+  475370,
+  475420,
+  475450,
+  475460,
+  476010,
+  476040,
+  476041,
+  476050,
+  476051,
+  476052,
+  476350,
+  476351,
+  476352,
+  476353,
+  476354,
+  476355,
+  476356,
+  476357,
+  476390,
+  476391,
+  476392,
+  476400,
+  476440,
+  476470,
+  476520,
+  476560,
+  476561,
+  476570,
+  476580,
+  476860,
+  476861,
+  476862,
+  476863,
+  476864,
+  476865,
+  476866,
+  476867,
+  476868,
+  476869,
+  476870,
+  476871,
+  476940,
+  476950,
+  476951,
+  476952,
+  477000,
+  477020,
+  477030,
+  477040,
+  477050,
+  477150,
+  477151,
+  477240,
+  477260,
+  477760,
+  477780,
+  477781,
+  477790,
+  477810,
+  477820,
+  477821,
+  477830,
+  477840,
+  477880,
+  477881,
+  477890,
+  477940,
+  477941,
+  477942,
+  477990,
+  478000,
+  478030,
+  478031,
+  478032,
+  478033,
+  478034,
+  478035,
+  478036,
+  478037,
+  478038,
+  478039,
+  478040,
+  478041,
+  478042,
+  478043,
+  478044,
+  478045,
+  478046,
+  478047,
+  478048,
+  478049,
+  478050,
+  478051,
+  478052,
+  478053,
+  478054,
+  478055,
+  478056,
+  478057,
+  478058,
+  478300,
+  478301,
+  478960,
+  478970,
+  478990,
+  479010,
+  479060,
+  479061,
+  479120,
+  479130,
+  479230,
+  479240,
+  479270,
+  479580,
+  480400,
+  480510,
+  480520,
+  480530,
+  480540,
+  480550,
+  480560,
+  480580,
+  480590,
+  480591,
+  480592,
+  480593,
+  480594,
+  480595,
+  480600,
+  480610,
+  480630,
+  480631,
+  480710,
+  480720,
+  480721,
+  480722,
+  481080,
+  481090,
+  481120,
+  481121,
+  481122,
+  481170,
+  481171,
+  481172,
+  481360,
+  481490,
+  481750,
+  482200,
+  482220,
+  482221,
+  482222,
+  482223,
+  482224,
+  482340,
+  482410,
+  482420,
+  482720,
+  482850,
+  482870,
+  483280,
+  483300,
+  483450,
+  483670,
+  483760,
+  483790,
+  483800,
+  483810,
+  483840,
+  483940,
+  483941,
+  483950,
+  484340,
+  484580,
+  484810,
+  484820,
+  484840,
+  484850,
+  484860,
+  484910,
+  484920,
+  484940,
+  484970,
+  485010,
+  485020,
+  485090,
+  485140,
+  485141,
+  485142,
+  485143,
+  485144,
+  485145,
+  485146,
+  485150,
+  485170,
+  485180,
+  485190,
+  485200,
+  485210,
+  485250,
+  485280,
+  485300,
+  485301,
+  485302,
+  485320,
+  485321,
+  485720,
+  485810,
+  485840,
+  485930,
+  485960,
+  485990,
+  486000,
+  486001,
+  486002,
+  486003,
+  486004,
+  486005,
+  486006,
+  486007,
+  486008,
+  486009,
+  486010,
+  486011,
+  486012,
+  486040,
+  486050,
+  486090,
+  486100,
+  486110,
+  486190,
+  486200,
+  486210,
+  486220,
+  486270,
+  486420,
+  486520,
+  486530,
+  486560,
+  486570,
+  486571,
+  486590,
+  486610,
+  486670,
+  486710,
+  486770,
+  486830,
+  486950,
+  486960,
+  486970,
+  487010,
+  487050,
+  487130,
+  487150,
+  487170,
+  487210,
+  487240,
+  487280,
+  487300,
+  487310,
+  487320,
+  487460,
+  487480,
+  487490,
+  487520,
+  487540,
+  487550,
+  487560,
+  487570,
+  487610,
+  487680,
+  487710,
+  487780,
+  487800,
+  487820,
+  487840,
+  487860,
+  487880,
+  487900,
+  487920,
+  487940,
+  487960,
+  488000,
+  488010,
+  488030,
+  488040,
+  488050,
+  488060,
+  488090,
+  488100,
+  488120,
+  488130,
+  488140,
+  488170,
+  488190,
+  488270,
+  488320,
+  488340,
+  488470,
+  488520,
+  488530,
+  488560,
+  488620,
+  488630,
+  488640,
+  488650,
+  488700,
+  488750,
+  488810,
+  488811,
+  488812,
+  488820,
+  488821,
+  488822,
+  488823,
+  488824,
+  488830,
+  488831,
+  488850,
+  488870,
+  488930,
+  488970,
+  488980,
+  488981,
+  488990,
+  488991,
+  488992,
+  488993,
+  488994,
+  488995,
+  488996,
+  488997,
+  488998,
+  488999,
+  489010,
+  489090,
+  489180,
+  489200,
+  489250,
+  489300,
+  489320,
+  489330,
+  489390,
+  489391,
+  489393,
+  489410,
+  489450,
+  489490,
+  489500,
+  489530,
+  489590,
+  489650,
+  489670,
+  489750,
+  489780,
+  489840,
+  489841,
+  489842,
+  489843,
+  489844,
+  489845,
+  489846,
+  489847,
+  489848,
+  489849,
+  489850,
+  489851,
+  489852,
+  489860,
+  489920,
+  489950,
+  489960,
+  489970,
+  489971,
+  489972,
+  489973,
+  489974,
+  489975,
+  489976,
+  489977,
+  489978,
+  489980,
+  489990,
+  490060,
+  490070,
+  490071,
+  490072,
+  490073,
+  490074,
+  490075,
+  490076,
+  490190,
+  490191,
+  490192,
+  490240,
+  490260,
+  490270,
+  490310,
+  490320,
+  490330,
+  490350,
+  490410,
+  490411,
+  490412,
+  490480,
+  490500,
+  490650,
+  490680,
+  491290,
+  491300,
+  491310,
+  491340,
+  491380,
+  491400,
+  491401,
+  491402,
+  491403,
+  491410,
+  491460,
+  491480,
+  491490,
+  491491,
+  491492,
+  491493,
+  491494,
+  491495,
+  491496,
+  491498,
+  491499,
+  491500,
+  491550,
+  491570,
+  491610,
+  491611,
+  491612,
+  491613,
+  491640,
+  491680,
+  491740,
+  491760,
+  491780,
+  491840,
+  491940,
+  491960,
+  491970,
+  491980,
+  491990,
+  492000,
+  492010,
+  492020,
+  492030,
+  492040,
+  492050,
+  492060,
+  492140,
+  492210,
+  492250,
+  492260,
+  492320,
+  492330,
+  492331,
+  492360,
+  492390,
+  492391,
+  492392,
+  492420,
+  492480,
+  492520,
+  492580,
+  492581,
+  492590,
+  492620,
+  492640,
+  492670,
+  492680,
+  492690,
+  492700,
+  492740,
+  492750,
+  492790,
+  492810,
+  492820,
+  492821,
+  492822,
+  492890,
+  492891,
+  492892,
+  492940,
+  492941,
+  492942,
+  492943,
+  492944,
+  492945,
+  492946,
+  492947,
+  492948,
+  492949,
+  492950,
+  492951,
+  492952,
+  492953,
+  492954,
+  492955,
+  492956,
+  492957,
+  492958,
+  492959,
+  492960,
+  492961,
+  492962,
+  492963,
+  492964,
+  492965,
+  492966,
+  492967,
+  492968,
+  492969,
+  492970,
+  492971,
+  492972,
+  492973,
+  492974,
+  492975,
+  492976,
+  492977,
+  492978,
+  492979,
+  492980,
+  492981,
+  492982,
+  492983,
+  492984,
+  492985,
+  492986,
+  492987,
+  492988,
+  492989,
+  493070,
+  493120,
+  493130,
+  493150,
+  493160,
+  493190,
+  493210,
+  493230,
+  493240,
+  493300,
+  493301,
+  493330,
+  493420,
+  493430,
+  493530,
+  493560,
+  493590,
+  493610,
+  493630,
+  493640,
+  493850,
+  493880,
+  493950,
+  493970,
+  494074,
+  494080,
+  494110,
+  494140,
+  494200,
+  494260,
+  494270,
+  494300,
+  494390,
+  494391,
+  494392,
+  494410,
+  494420,
+  494510,
+  494520,
+  494521,
+  494522,
+  494523,
+  494524,
+  494525,
+  494526,
+  494527,
+  494529,
+  494560,
+  494570,
+  494630,
+  494640,
+  494650,
+  494770,
+  494880,
+  494881,
+  494882,
+  494883,
+  495000,
+  495160,
+  495170,
+  495330,
+  495360,
+  495361,
+  495370,
+  495371,
+  495380,
+  495450,
+  495480,
+  495510,
+  495590,
+  495620,
+  495640,
+  495790,
+  495800,
+  495920,
+  495930,
+  495950,
+  495951,
+  495953,
+  495954,
+  496100,
+  496101,
+  496102,
+  496103,
+  496104,
+  496220,
+  496330,
+  496430,
+  496431,
+  496432,
+  496433,
+  496434,
+  496435,
+  496436,
+  496437,
+  496438,
+  496439,
+  496450,
+  496490,
+  496580,
+  496840,
+  496900,
+  496910,
+  496970,
+  496971,
+  496972,
+  497010,
+  497110,
+  497140,
+  497150,
+  497160,
+  497170,
+  497200,
+  497310,
+  497340,
+  497520,
+  497521,
+  497540,
+  497610,
+  497611,
+  497620,
+  497621,
+  497660,
+  497690,
+  497740,
+  497750,
+  497760,
+  497890,
+  497910,
+  497930,
+  497970,
+  497990,
+  498020,
+  498060,
+  498200,
+  498220,
+  498221,
+  498222,
+  498223,
+  498310,
+  498400,
+  498410,
+  498520,
+  498540,
+  498560,
+  498590,
+  498670,
+  498730,
+  498760,
+  498770,
+  498790,
+  498810,
+  498811,
+  498870,
+  498890,
+  498900,
+  499060,
+  499150,
+  499220,
+  499221,
+  499222,
+  499223,
+  499224,
+  499260,
+  499270,
+  499360,
+  499410,
+  499484,
+  499500,
+  499530,
+  499550,
+  499570,
+  499571,
+  499572,
+  499573,
+  499590,
+  499650,
+  499670,
+  500080,
+  500160,
+  500201,
+  500202,
+  500203,
+  500204,
+  500205,
+  500206,
+  500208,
+  500210,
+  500211,
+  500212,
+  500213,
+  500214,
+  500215,
+  500216,
+  500217,
+  500218,
+  500219,
+  500230,
+  500232,
+  500233,
+  500234,
+  500235,
+  500236,
+  500237,
+  500238,
+  500239,
+  500240,
+  500241,
+  500242,
+  500243,
+  500244,
+  500245,
+  500246,
+  500247,
+  500248,
+  500249,
+  500250,
+  500270,
+  500271,
+  500272,
+  500280,
+  500290,
+  500310,
+  500370,
+  500390,
+  500391,
+  500392,
+  500400,
+  500410,
+  500460,
+  500461,
+  500470,
+  500500,
+  500530,
+  500540,
+  500620,
+  500700,
+  500770,
+  500780,
+  500840,
+  500850,
+  500860,
+  500890,
+  500910,
+  500970,
+  501040,
+  501150,
+  501151,
+  501170,
+  501171,
+  501172,
+  501200,
+  501230,
+  501250,
+  501260,
+  501280,
+  501290,
+  501460,
+  501510,
+  501520,
+  501521,
+  501540,
+  501550,
+  501560,
+  501570,
+  501580,
+  501600,
+  501610,
+  501620,
+  501630,
+  501640,
+  501650,
+  501660,
+  501670,
+  501671,
+  501730,
+  501750,
+  501770,
+  501780,
+  501820,
+  501890,
+  501891,
+  501960,
+  501961,
+  501962,
+  501963,
+  501964,
+  501965,
+  501966,
+  501967,
+  501968,
+  501969,
+  502010,
+  502310,
+  502340,
+  502360,
+  502361,
+  502480,
+  502490,
+  502510,
+  502560,
+  502570,
+  502580,
+  502590,
+  502610,
+  502630,
+  502790,
+  502830,
+  502840,
+  502841,
+  502842,
+  502850,
+  502860,
+  502870,
+  502890,
+  502891,
+  502900,
+  502930,
+  502960,
+  502970,
+  502980,
+  503000,
+  503110,
+  503270,
+  503310,
+  503380,
+  503440,
+  503470,
+  503590,
+  503660,
+  503720,
+  503800,
+  503850,
+  503880,
+  503890,
+  503970,
+  503990,
+  504010,
+  504070,
+  504120,
+  504170,
+  504220,
+  504270,
+  504350,
+  504510,
+  504520,
+  504640,
+  504650,
+  504710,
+  504720,
+  504790,
+  504870,
+  504890,
+  504960,
+  504970,
+  504990,
+  505015,
+  505100,
+  505150,
+  505180,
+  505200,
+  505201,
+  505240,
+  505250,
+  505260,
+  505340,
+  505410,
+  505420,
+  505430,
+  505450,
+  505451,
+  505470,
+  505480,
+  505510,
+  505540,
+  505550,
+  505620,
+  505650,
+  506030,
+  506040,
+  506080,
+  506100,
+  506120,
+  506160,
+  506190,
+  506350,
+  506460,
+  506600,
+  506620,
+  506720,
+  506750,
+  506780,
+  506800,
+  506801,
+  506802,
+  506803,
+  506804,
+  506850,
+  506910,
+  506920,
+  506940,
+  506970,
+  506971,
+  507020,
+  507040,
+  507070,
+  507090,
+  507180,
+  507280,
+  507290,
+  507510,
+  507530,
+  507580,
+  507630,
+  507680,
+  507730,
+  507750,
+  507770,
+  507830,
+  507850,
+  507870,
+  507990,
+  508010,
+  508030,
+  508090,
+  508120,
+  508150,
+  508160,
+  508161,
+  508162,
+  508163,
+  508165,
+  508270,
+  508271,
+  508320,
+  508340,
+  508400,
+  508401,
+  508402,
+  508403,
+  508404,
+  508405,
+  508420,
+  508430,
+  508510,
+  508560,
+  508561,
+  508570,
+  508690,
+  508770,
+  508771,
+  508772,
+  508780,
+  508800,
+  508810,
+  508830,
+  508860,
+  508970,
+  509020,
+  509030,
+  509031,
+  509032,
+  509040,
+  509050,
+  509060,
+  509061,
+  509080,
+  509081,
+  509090,
+  509100,
+  509120,
+  509200,
+  509300,
+  509350,
+  509370,
+  509410,
+  509430,
+  509500,
+  509510,
+  509520,
+  509521,
+  509522,
+  509590,
+  509630,
+  509631,
+  509632,
+  509633,
+  509634,
+  509635,
+  509636,
+  509637,
+  509638,
+  509639,
+  509640,
+  509641,
+  509642,
+  509643,
+  509644,
+  509645,
+  509646,
+  509647,
+  509648,
+  509649,
+  509650,
+  509651,
+  509652,
+  509653,
+  509654,
+  509655,
+  509656,
+  509657,
+  509658,
+  509659,
+  509660,
+  509661,
+  509662,
+  509663,
+  509664,
+  509665,
+  509666,
+  509667,
+  509668,
+  509669,
+  509670,
+  509671,
+  509672,
+  509673,
+  509674,
+  509675,
+  509676,
+  509677,
+  509678,
+  509679,
+  509680,
+  509681,
+  509682,
+  509683,
+  509684,
+  509685,
+  509686,
+  509687,
+  509688,
+  509689,
+  509690,
+  509691,
+  509692,
+  509693,
+  509694,
+  509695,
+  509696,
+  509697,
+  509698,
+  509699,
+  509700,
+  509701,
+  509702,
+  509703,
+  509704,
+  509705,
+  509706,
+  509707,
+  509708,
+  509709,
+  509710,
+  509711,
+  509712,
+  509713,
+  509714,
+  509715,
+  509716,
+  509717,
+  509718,
+  509719,
+  509720,
+  509721,
+  509722,
+  509723,
+  509724,
+  509725,
+  509726,
+  509727,
+  509728,
+  509729,
+  509730,
+  509731,
+  509732,
+  509733,
+  509734,
+  509735,
+  509736,
+  509737,
+  509738,
+  509739,
+  509740,
+  509741,
+  509742,
+  509743,
+  509744,
+  509745,
+  509746,
+  509747,
+  509748,
+  509749,
+  509890,
+  509900,
+  510090,
+  510100,
+  510120,
+  510140,
+  510150,
+  510200,
+  510270,
+  510271,
+  510310,
+  510350,
+  510400,
+  510450,
+  510530,
+  510600,
+  510610,
+  510670,
+  510800,
+  510820,
+  510940,
+  511130,
+  511131,
+  511170,
+  511200,
+  511210,
+  511240,
+  511300,
+  511301,
+  511310,
+  511360,
+  511450,
+  511480,
+  511640,
+  511650,
+  511720,
+  511780,
+  511781,
+  511782,
+  511840,
+  511850,
+  511870,
+  511890,
+  511891,
+  511892,
+  511930,
+  512030,
+  512031,
+  512032,
+  512033,
+  512034,
+  512035,
+  512100,
+  512190,
+  512290,
+  512310,
+  512311,
+  512312,
+  512313,
+  512314,
+  512315,
+  512340,
+  512350,
+  512380,
+  512400,
+  512480,
+  512510,
+  512540,
+  512620,
+  512621,
+  512622,
+  512630,
+  512670,
+  512780,
+  512810,
+  512820,
+  512840,
+  512850,
+  512860,
+  512870,
+  512880,
+  512910,
+  512911,
+  512912,
+  512913,
+  512930,
+  512940,
+  512970,
+  512990,
+  513010,
+  513030,
+  513031,
+  513032,
+  513033,
+  513034,
+  513040,
+  513090,
+  513091,
+  513092,
+  513093,
+  513094,
+  513095,
+  513096,
+  513097,
+  513098,
+  513099,
+  513100,
+  513101,
+  513102,
+  513103,
+  513104,
+  513105,
+  513106,
+  513107,
+  513108,
+  513109,
+  513110,
+  513111,
+  513112,
+  513113,
+  513114,
+  513115,
+  513116,
+  513117,
+  513118,
+  513119,
+  513130,
+  513150,
+  513200,
+  513430,
+  513500,
+  513520,
+  513730,
+  513760,
+  513800,
+  514320,
+  514330,
+  514331,
+  514332,
+  514450,
+  514590,
+  514600,
+  514630,
+  514683,
+  514684,
+  514685,
+  514690,
+  514800,
+  515090,
+  515100,
+  515110,
+  515120,
+  515130,
+  515140,
+  515150,
+  515160,
+  515170,
+  515171,
+  515190,
+  515191,
+  515240,
+  515270,
+  515300,
+  515640,
+  515641,
+  515642,
+  515680,
+  515710,
+  515800,
+  515950,
+  515970,
+  515990,
+  516060,
+  516090,
+  516100,
+  516320,
+  516330,
+  516331,
+  516370,
+  516380,
+  516400,
+  516620,
+  516621,
+  516622,
+  516710,
+  516760,
+  516770,
+  516780,
+  516860,
+  516910,
+  516930,
+  517050,
+  517170,
+  517290,
+  517291,
+  517292,
+  517450,
+  517560,
+  517640,
+  517730,
+  517750,
+  517751,
+  517752,
+  517760,
+  517761,
+  517762,
+  517830,
+  517831,
+  518080,
+  518370,
+  518630,
+  518690,
+  518710,
+  518760,
+  518910,
+  519040,
+  519070,
+  519110,
+  519131,
+  519132,
+  519134,
+  519135,
+  519136,
+  519210,
+  519211,
+  519212,
+  519213,
+  519214,
+  519215,
+  519216,
+  519217,
+  519218,
+  519219,
+  519230,
+  519250,
+  519270,
+  519290,
+  519310,
+  519330,
+  519350,
+  519370,
+  519390,
+  519410,
+  519430,
+  519450,
+  519910,
+  519950,
+  520030,
+  520040,
+  520190,
+  520200,
+  520210,
+  520310,
+  520320,
+  520340,
+  520350,
+  520360,
+  520390,
+  520430,
+  520480,
+  520500,
+  520550,
+  520560,
+  520561,
+  520580,
+  520620,
+  520630,
+  520640,
+  520641,
+  520642,
+  520643,
+  520644,
+  520645,
+  520646,
+  520710,
+  520780,
+  520790,
+  520830,
+  520840,
+  520870,
+  520871,
+  520872,
+  520873,
+  520900,
+  520970,
+  520980,
+  521010,
+  521020,
+  521030,
+  521120,
+  521121,
+  521160,
+  521170,
+  521220,
+  521600,
+  521610,
+  521770,
+  521840,
+  521850,
+  521880,
+  521960,
+  521961,
+  521962,
+  521970,
+  522120,
+  522170,
+  522330,
+  522331,
+  522332,
+  522333,
+  522334,
+  522335,
+  522500,
+  522620,
+  522630,
+  522650,
+  522651,
+  522652,
+  522750,
+  522830,
+  522930,
+  522980,
+  523010,
+  523011,
+  523040,
+  523050,
+  523110,
+  523120,
+  523130,
+  523220,
+  523380,
+  523390,
+  523410,
+  523460,
+  523470,
+  523500,
+  523501,
+  523502,
+  523503,
+  523504,
+  523505,
+  523506,
+  523507,
+  523508,
+  523510,
+  523511,
+  523521,
+  523530,
+  523531,
+  523532,
+  523533,
+  523534,
+  523560,
+  523580,
+  523581,
+  523582,
+  523583,
+  523590,
+  523600,
+  523690,
+  523820,
+  523821,
+  523840,
+  523850,
+  523851,
+  523852,
+  523910,
+  523920,
+  523980,
+  523990,
+  524020,
+  524040,
+  524041,
+  524042,
+  524043,
+  524080,
+  524170,
+  524171,
+  524172,
+  524173,
+  524174,
+  524175,
+  524176,
+  524190,
+  524260,
+  524270,
+  524280,
+  524290,
+  524300,
+  524310,
+  524320,
+  524330,
+  524360,
+  524390,
+  524420,
+  524450,
+  524490,
+  524590,
+  524591,
+  524592,
+  524593,
+  524594,
+  524595,
+  524596,
+  524630,
+  524660,
+  524870,
+  524920,
+  524950,
+  524990,
+  525000,
+  525010,
+  525011,
+  525012,
+  525013,
+  525014,
+  525015,
+  525016,
+  525017,
+  525018,
+  525019,
+  525020,
+  525030,
+  525031,
+  525032,
+  525033,
+  525034,
+  525035,
+  525036,
+  525037,
+  525100,
+  525180,
+  525181,
+  525182,
+  525183,
+  525184,
+  525185,
+  525186,
+  525187,
+  525188,
+  525220,
+  525221,
+  525280,
+  525281,
+  525282,
+  525283,
+  525284,
+  525390,
+  525410,
+  525412,
+  525413,
+  525420,
+  525430,
+  525440,
+  525441,
+  525442,
+  525470,
+  525471,
+  525520,
+  525550,
+  525580,
+  525720,
+  525730,
+  525750,
+  525900,
+  525940,
+  525960,
+  525970,
+  525971,
+  526000,
+  526001,
+  526002,
+  526010,
+  526020,
+  526040,
+  526060,
+  526070,
+  526120,
+  526121,
+  526122,
+  526150,
+  526280,
+  526300,
+  526301,
+  526340,
+  526350,
+  526410,
+  526411,
+  526420,
+  526520,
+  526530,
+  526531,
+  526532,
+  526560,
+  526561,
+  526562,
+  526570,
+  526571,
+  526572,
+  526610,
+  526611,
+  526612,
+  526640,
+  526660,
+  526670,
+  526760,
+  526830,
+  526850,
+  526860,
+  526910,
+  526950,
+  527000,
+  527010,
+  527020,
+  527021,
+  527022,
+  527070,
+  527080,
+  527170,
+  527180,
+  527200,
+  527201,
+  527202,
+  527203,
+  527204,
+  527205,
+  527220,
+  527350,
+  527370,
+  527390,
+  527400,
+  527401,
+  527402,
+  527403,
+  527404,
+  527405,
+  527406,
+  527407,
+  527410,
+  527440,
+  527500,
+  527610,
+  527630,
+  527680,
+  527780,
+  528040,
+  528050,
+  528051,
+  528052,
+  528053,
+  528055,
+  528056,
+  528057,
+  528058,
+  528100,
+  528140,
+  528200,
+  528220,
+  528290,
+  528310,
+  528320,
+  528321,
+  528322,
+  528323,
+  528324,
+  528330,
+  528440,
+  528480,
+  528490,
+  528570,
+  528620,
+  528630,
+  528780,
+  528790,
+  528890,
+  528891,
+  528892,
+  529010,
+  529030,
+  529050,
+  529120,
+  529170,
+  529190,
+  529200,
+  529350,
+  529390,
+  529400,
+  529430,
+  529470,
+  529530,
+  529531,
+  529540,
+  529550,
+  529620,
+  529640,
+  529690,
+  529750,
+  529830,
+  529930,
+  530030,
+  530060,
+  530140,
+  530150,
+  530151,
+  530152,
+  530180,
+  530280,
+  530380,
+  530480,
+  530490,
+  530580,
+  530590,
+  530591,
+  530592,
+  530593,
+  530594,
+  530595,
+  530596,
+  530597,
+  530598,
+  530599,
+  530610,
+  530611,
+  530640,
+  530641,
+  530660,
+  530661,
+  530670,
+  530671,
+  530690,
+  530710,
+  530711,
+  530730,
+  530760,
+  530770,
+  530780,
+  530870,
+  530910,
+  531120,
+  531130,
+  531131,
+  531150,
+  531151,
+  531152,
+  531153,
+  531154,
+  531155,
+  531156,
+  531157,
+  531158,
+  531159,
+  531160,
+  531161,
+  531162,
+  531163,
+  531164,
+  531165,
+  531166,
+  531167,
+  531168,
+  531169,
+  531170,
+  531171,
+  531172,
+  531330,
+  531600,
+  531601,
+  531650,
+  531720,
+  531750,
+  531810,
+  531940,
+  531980,
+  532000,
+  532021,
+  532040,
+  532050,
+  532060,
+  532100,
+  532240,
+  532250,
+  532251,
+  532310,
+  532330,
+  532550,
+  532610,
+  532620,
+  532621,
+  532640,
+  532710,
+  532720,
+  532730,
+  532810,
+  532850,
+  532940,
+  533110,
+  533190,
+  533220,
+  533230,
+  533240,
+  533310,
+  533490,
+  533491,
+  533492,
+  533550,
+  533551,
+  533552,
+  533553,
+  533554,
+  533555,
+  533556,
+  533557,
+  533558,
+  533559,
+  533560,
+  533570,
+  533590,
+  533591,
+  533592,
+  533600,
+  533601,
+  533602,
+  533650,
+  533670,
+  533750,
+  533810,
+  533830,
+  533840,
+  533870,
+  533880,
+  534030,
+  534080,
+  534130,
+  534131,
+  534260,
+  534280,
+  534330,
+  534331,
+  534340,
+  534341,
+  534420,
+  534430,
+  534580,
+  534590,
+  534640,
+  534650,
+  534670,
+  534690,
+  534830,
+  534840,
+  534850,
+  534860,
+  534930,
+  534931,
+  534940,
+  534950,
+  534990,
+  535130,
+  535180,
+  535200,
+  535201,
+  535202,
+  535310,
+  535420,
+  535510,
+  535540,
+  535550,
+  535570,
+  535580,
+  535590,
+  535600,
+  535710,
+  535720,
+  535730,
+  535731,
+  535732,
+  535733,
+  535734,
+  535735,
+  535736,
+  535737,
+  535738,
+  535739,
+  535740,
+  535741,
+  535770,
+  535771,
+  535780,
+  535820,
+  535830,
+  535880,
+  535950,
+  535970,
+  535971,
+  536150,
+  536240,
+  536241,
+  536310,
+  536380,
+  536520,
+  536540,
+  536541,
+  536543,
+  536544,
+  536545,
+  536546,
+  536547,
+  536548,
+  536549,
+  536570,
+  536571,
+  536572,
+  536573,
+  536574,
+  536575,
+  536576,
+  536577,
+  536578,
+  536579,
+  536580,
+  536590,
+  536600,
+  536610,
+  536650,
+  536651,
+  536700,
+  536710,
+  536720,
+  536730,
+  536740,
+  536741,
+  536760,
+  536790,
+  536850,
+  536910,
+  537030,
+  537070,
+  537080,
+  537120,
+  537150,
+  537151,
+  537152,
+  537153,
+  537154,
+  537155,
+  537156,
+  537157,
+  537158,
+  537159,
+  537160,
+  537161,
+  537190,
+  537210,
+  537230,
+  537250,
+  537260,
+  537261,
+  537262,
+  537263,
+  537264,
+  537265,
+  537266,
+  537267,
+  537268,
+  537269,
+  537270,
+  537271,
+  537300,
+  537320,
+  537321,
+  537322,
+  537323,
+  537324,
+  537325,
+  537330,
+  537390,
+  537391,
+  537392,
+  537400,
+  537410,
+  537510,
+  537670,
+  537770,
+  537780,
+  537790,
+  537820,
+  537821,
+  537822,
+  537823,
+  537824,
+  537825,
+  537826,
+  537827,
+  537828,
+  537829,
+  537890,
+  537900,
+  537930,
+  537940,
+  537980,
+  537981,
+  538020,
+  538021,
+  538080,
+  538090,
+  538190,
+  538350,
+  538351,
+  538352,
+  538353,
+  538360,
+  538370,
+  538400,
+  538430,
+  538460,
+  538480,
+  538500,
+  538520,
+  538530,
+  538531,
+  538532,
+  538533,
+  538534,
+  538535,
+  538536,
+  538537,
+  538538,
+  538539,
+  538570,
+  538600,
+  538610,
+  538640,
+  538690,
+  538720,
+  538750,
+  538760,
+  538770,
+  538780,
+  538820,
+  538821,
+  538822,
+  538823,
+  538824,
+  538825,
+  538826,
+  538827,
+  538828,
+  538829,
+  538830,
+  538831,
+  538860,
+  538910,
+  538930,
+  539001,
+  539010,
+  539030,
+  539040,
+  539060,
+  539070,
+  539100,
+  539101,
+  539102,
+  539103,
+  539104,
+  539240,
+  539260,
+  539310,
+  539420,
+  539430,
+  539590,
+  539591,
+  539592,
+  539593,
+  539594,
+  539595,
+  539710,
+  539760,
+  539780,
+  539790,
+  539800,
+  539810,
+  539820,
+  539830,
+  539840,
+  539850,
+  539860,
+  539870,
+  539880,
+  539890,
+  539900,
+  539910,
+  539920,
+  539930,
+  539940,
+  539950,
+  539960,
+  539970,
+  540000,
+  540040,
+  540070,
+  540071,
+  540090,
+  540220,
+  540330,
+  540340,
+  540380,
+  540520,
+  540680,
+  540681,
+  540682,
+  540710,
+  540711,
+  540720,
+  540721,
+  540730,
+  540750,
+  540751,
+  540752,
+  540760,
+  540800,
+  540801,
+  540802,
+  540803,
+  540804,
+  540805,
+  540810,
+  540820,
+  540850,
+  541170,
+  541220,
+  541260,
+  541280,
+  541360,
+  541361,
+  541400,
+  541430,
+  541580,
+  541630,
+  541750,
+  541790,
+  541800,
+  541810,
+  541830,
+  541860,
+  541880,
+  541900,
+  541940,
+  541980,
+  542021,
+  542040,
+  542080,
+  542130,
+  542160,
+  542170,
+  542190,
+  542300,
+  542320,
+  542330,
+  542380,
+  542440,
+  542450,
+  542470,
+  542490,
+  542491,
+  542500,
+  542501,
+  542540,
+  542541,
+  542542,
+  542600,
+  542610,
+  542611,
+  542612,
+  542640,
+  542760,
+  542761,
+  542800,
+  542830,
+  542840,
+  542890,
+  542900,
+  542950,
+  543090,
+  543190,
+  543191,
+  543192,
+  543193,
+  543200,
+  543210,
+  543220,
+  543230,
+  543250,
+  543310,
+  543330,
+  543331,
+  543340,
+  543470,
+  543490,
+  543510,
+  543520,
+  543550,
+  543560,
+  543610,
+  543620,
+  543630,
+  543640,
+  543660,
+  543670,
+  543690,
+  543691,
+  543692,
+  543693,
+  543700,
+  543730,
+  543750,
+  543810,
+  543811,
+  543820,
+  543821,
+  543822,
+  543823,
+  543840,
+  543860,
+  543890,
+  544030,
+  544060,
+  544070,
+  544071,
+  544080,
+  544120,
+  544150,
+  544210,
+  544230,
+  544240,
+  544250,
+  544260,
+  544320,
+  544420,
+  544460,
+  544490,
+  544500,
+  544560,
+  544561,
+  544570,
+  544571,
+  544620,
+  544670,
+  544671,
+  544760,
+  544770,
+  544830,
+  544831,
+  544832,
+  544850,
+  544880,
+  544890,
+  544900,
+  544960,
+  544980,
+  545020,
+  545070,
+  545090,
+  545100,
+  545110,
+  545120,
+  545140,
+  545160,
+  545170,
+  545210,
+  545260,
+  545290,
+  545310,
+  545460,
+  545500,
+  545610,
+  545740,
+  545741,
+  545742,
+  545743,
+  545760,
+  545990,
+  546140,
+  546190,
+  546191,
+  546192,
+  546193,
+  546194,
+  546195,
+  546196,
+  546260,
+  546310,
+  546311,
+  546312,
+  546320,
+  546360,
+  546370,
+  546371,
+  546372,
+  546373,
+  546374,
+  546480,
+  546520,
+  546540,
+  546590,
+  546690,
+  546720,
+  546730,
+  546850,
+  546860,
+  546880,
+  546890,
+  546970,
+  547020,
+  547030,
+  547060,
+  547070,
+  547100,
+  547120,
+  547170,
+  547230,
+  547240,
+  547280,
+  547400,
+  547420,
+  547430,
+  547500,
+  547501,
+  547502,
+  547530,
+  547560,
+  547561,
+  547562,
+  547570,
+  547620,
+  547630,
+  547660,
+  547720,
+  547760,
+  547800,
+  547830,
+  548010,
+  548070,
+  548120,
+  548180,
+  548190,
+  548200,
+  548210,
+  548250,
+  548380,
+  548400,
+  548410,
+  548420,
+  548421,
+  548422,
+  548440,
+  548510,
+  548660,
+  548690,
+  548700,
+  548730,
+  548750,
+  548760,
+  548770,
+  548820,
+  548821,
+  548830,
+  548831,
+  548850,
+  548870,
+  548880,
+  548920,
+  549060,
+  549070,
+  549071,
+  549110,
+  549111,
+  549112,
+  549113,
+  549200,
+  549230,
+  549250,
+  549360,
+  549370,
+  549380,
+  549610,
+  549620,
+  549630,
+  549640,
+  549650,
+  549750,
+  549800,
+  549830,
+  549840,
+  549940,
+  549960,
+  549970,
+  549971,
+  549990,
+  550030,
+  550050,
+  550060,
+  550070,
+  550130,
+  550140,
+  550210,
+  550260,
+  550300,
+  550330,
+  550331,
+  550332,
+  550333,
+  550334,
+  550335,
+  550380,
+  550381,
+  550382,
+  550460,
+  550461,
+  550540,
+  550640,
+  550680,
+  550710,
+  550790,
+  550800,
+  550850,
+  550880,
+  550910,
+  551030,
+  551240,
+  551250,
+  551290,
+  551300,
+  551310,
+  551370,
+  551480,
+  551510,
+  551560,
+  551590,
+  551660,
+  551780,
+  551790,
+  551810,
+  551820,
+  551821,
+  551850,
+  551880,
+  551910,
+  551911,
+  551912,
+  551913,
+  551914,
+  551915,
+  551916,
+  551917,
+  551918,
+  551919,
+  551960,
+  551970,
+  551971,
+  552010,
+  552011,
+  552020,
+  552050,
+  552070,
+  552090,
+  552360,
+  552490,
+  552640,
+  552641,
+  552642,
+  552643,
+  552650,
+  552651,
+  552652,
+  552653,
+  552680,
+  552760,
+  552770,
+  552820,
+  552830,
+  552850,
+  552860,
+  552890,
+  552950,
+  553070,
+  553071,
+  553072,
+  553073,
+  553074,
+  553075,
+  553120,
+  553160,
+  553170,
+  553190,
+  553270,
+  553271,
+  553280,
+  553360,
+  553620,
+  553650,
+  553670,
+  553700,
+  553710,
+  553720,
+  553770,
+  553771,
+  553861,
+  553920,
+  553930,
+  553980,
+  554000,
+  554130,
+  554200,
+  554260,
+  554270,
+  554271,
+  554272,
+  554273,
+  554320,
+  554321,
+  554340,
+  554350,
+  554360,
+  554370,
+  554371,
+  554380,
+  554381,
+  554390,
+  554480,
+  554500,
+  554540,
+  554780,
+  554790,
+  554791,
+  554820,
+  554840,
+  554880,
+  554950,
+  554960,
+  555030,
+  555120,
+  555240,
+  555250,
+  555270,
+  555300,
+  555360,
+  555380,
+  555390,
+  555420,
+  555530,
+  555531,
+  555532,
+  555550,
+  555590,
+  555680,
+  555740,
+  555770,
+  555790,
+  555810,
+  555840,
+  555860,
+  555861,
+  555862,
+  555863,
+  555864,
+  555865,
+  555960,
+  556030,
+  556100,
+  556150,
+  556210,
+  556212,
+  556213,
+  556214,
+  556217,
+  556218,
+  556219,
+  556220,
+  556221,
+  556222,
+  556223,
+  556224,
+  556225,
+  556226,
+  556229,
+  556270,
+  556290,
+  556320,
+  556350,
+  556352,
+  556360,
+  556370,
+  556371,
+  556390,
+  556391,
+  556392,
+  556420,
+  556450,
+  556460,
+  556470,
+  556500,
+  556570,
+  556600,
+  556610,
+  556630,
+  556650,
+  556670,
+  556690,
+  556750,
+  556760,
+  556800,
+  556810,
+  556850,
+  556880,
+  556900,
+  556950,
+  556970,
+  557000,
+  557001,
+  557003,
+  557020,
+  557070,
+  557140,
+  557150,
+  557200,
+  557210,
+  557230,
+  557250,
+  557280,
+  557290,
+  557300,
+  557350,
+  557380,
+  557390,
+  557450,
+  557470,
+  557510,
+  557640,
+  557690,
+  557920,
+  557930,
+  558000,
+  558080,
+  558081,
+  558082,
+  558083,
+  558084,
+  558085,
+  558120,
+  558130,
+  558140,
+  558150,
+  558160,
+  558190,
+  558200,
+  558210,
+  558220,
+  558240,
+  558241,
+  558242,
+  558243,
+  558244,
+  558245,
+  558270,
+  558290,
+  558300,
+  558301,
+  558302,
+  558310,
+  558370,
+  558380,
+  558381,
+  558382,
+  558390,
+  558391,
+  558400,
+  558460,
+  558480,
+  558510,
+  558511,
+  558512,
+  558513,
+  558514,
+  558540,
+  558630,
+  558640,
+  558641,
+  558690,
+  558760,
+  558761,
+  558762,
+  558830,
+  558831,
+  558832,
+  558833,
+  558834,
+  558835,
+  558836,
+  558840,
+  558860,
+  558880,
+  558970,
+  559040,
+  559220,
+  559240,
+  559320,
+  559370,
+  559380,
+  559381,
+  559382,
+  559390,
+  559391,
+  559430,
+  559440,
+  559470,
+  559480,
+  559520,
+  559540,
+  559560,
+  559570,
+  559580,
+  559590,
+  559670,
+  559780,
+  559790,
+  559800,
+  559840,
+  559860,
+  559880,
+  559890,
+  559950,
+  560090,
+  560100,
+  560101,
+  560102,
+  560110,
+  560140,
+  560240,
+  560360,
+  560390,
+  560400,
+  560410,
+  560440,
+  560441,
+  560442,
+  560480,
+  560500,
+  560560,
+  560580,
+  560581,
+  560582,
+  560590,
+  560630,
+  560670,
+  560680,
+  560900,
+  560910,
+  560920,
+  560940,
+  560941,
+  560990,
+  561030,
+  561040,
+  561050,
+  561130,
+  561140,
+  561150,
+  561240,
+  561290,
+  561310,
+  561330,
+  561350,
+  561390,
+  561400,
+  561460,
+  561470,
+  561490,
+  561522,
+  561527,
+  561530,
+  561531,
+  561532,
+  561533,
+  561534,
+  561535,
+  561536,
+  561537,
+  561538,
+  561539,
+  561540,
+  561541,
+  561542,
+  561543,
+  561544,
+  561545,
+  561546,
+  561547,
+  561548,
+  561549,
+  561550,
+  561551,
+  561552,
+  561553,
+  561554,
+  561555,
+  561556,
+  561557,
+  561558,
+  561559,
+  561560,
+  561561,
+  561566,
+  561567,
+  561620,
+  561630,
+  561631,
+  561650,
+  561720,
+  561730,
+  561800,
+  561810,
+  561811,
+  561812,
+  561813,
+  561814,
+  561815,
+  561816,
+  561830,
+  561860,
+  561870,
+  561890,
+  561900,
+  561920,
+  561950,
+  561990,
+  562000,
+  562040,
+  562060,
+  562130,
+  562140,
+  562142,
+  562143,
+  562144,
+  562145,
+  562151,
+  562370,
+  562372,
+  562373,
+  562374,
+  562375,
+  562376,
+  562378,
+  562379,
+  562380,
+  562381,
+  562382,
+  562384,
+  562385,
+  562386,
+  562387,
+  562388,
+  562389,
+  562390,
+  562391,
+  562392,
+  562393,
+  562394,
+  562395,
+  562397,
+  562398,
+  562399,
+  562510,
+  562630,
+  562720,
+  562780,
+  562790,
+  562820,
+  562830,
+  562850,
+  562870,
+  562890,
+  562891,
+  562900,
+  562960,
+  562980,
+  563000,
+  563020,
+  563040,
+  563060,
+  563080,
+  563100,
+  563101,
+  563102,
+  563103,
+  563104,
+  563105,
+  563106,
+  563107,
+  563210,
+  563280,
+  563281,
+  563282,
+  563283,
+  563284,
+  563285,
+  563286,
+  563287,
+  563288,
+  563289,
+  563300,
+  563440,
+  563590,
+  563640,
+  563650,
+  563670,
+  563720,
+  563780,
+  563790,
+  563820,
+  563850,
+  563880,
+  563890,
+  563900,
+  563920,
+  563930,
+  564020,
+  564030,
+  564120,
+  564130,
+  564170,
+  564180,
+  564190,
+  564200,
+  564250,
+  564251,
+  564260,
+  564270,
+  564290,
+  564300,
+  564320,
+  564321,
+  564322,
+  564323,
+  564324,
+  564360,
+  564380,
+  564390,
+  564400,
+  564410,
+  564411,
+  564412,
+  564413,
+  564414,
+  564415,
+  564416,
+  564440,
+  564500,
+  564501,
+  564502,
+  564503,
+  564504,
+  564505,
+  564506,
+  564507,
+  564508,
+  564509,
+  564670,
+  564680,
+  564681,
+  564690,
+  564730,
+  564770,
+  564780,
+  564790,
+  564791,
+  564792,
+  564793,
+  564794,
+  564830,
+  564840,
+  564850,
+  564870,
+  564890,
+  564910,
+  565000,
+  565001,
+  565002,
+  565040,
+  565050,
+  565060,
+  565070,
+  565090,
+  565210,
+  565220,
+  565230,
+  565240,
+  565250,
+  565261,
+  565280,
+  565310,
+  565320,
+  565321,
+  565322,
+  565323,
+  565324,
+  565350,
+  565351,
+  565352,
+  565353,
+  565400,
+  565450,
+  565460,
+  565470,
+  565500,
+  565610,
+  565620,
+  565621,
+  565622,
+  565770,
+  565800,
+  565810,
+  565820,
+  565830,
+  565840,
+  565970,
+  566010,
+  566040,
+  566110,
+  566130,
+  566260,
+  566280,
+  566300,
+  566330,
+  566340,
+  566390,
+  566450,
+  566460,
+  566470,
+  566480,
+  566500,
+  566510,
+  566590,
+  566710,
+  566720,
+  566760,
+  566790,
+  566890,
+  566960,
+  567050,
+  567070,
+  567110,
+  567180,
+  567230,
+  567360,
+  567420,
+  567421,
+  567422,
+  567610,
+  567740,
+  567810,
+  567820,
+  567850,
+  567900,
+  567960,
+  567970,
+  567990,
+  568010,
+  568011,
+  568012,
+  568013,
+  568080,
+  568110,
+  568120,
+  568170,
+  568290,
+  568380,
+  568540,
+  568590,
+  568630,
+  568640,
+  568660,
+  568700,
+  568710,
+  568760,
+  568850,
+  568880,
+  568940,
+  568950,
+  568960,
+  568970,
+  568980,
+  568990,
+  569000,
+  569160,
+  569180,
+  569190,
+  569240,
+  569241,
+  569242,
+  569243,
+  569244,
+  569245,
+  569246,
+  569247,
+  569248,
+  569249,
+  569250,
+  569310,
+  569320,
+  569400,
+  569410,
+  569600,
+  569680,
+  569681,
+  569682,
+  569683,
+  569684,
+  569685,
+  569686,
+  569687,
+  569688,
+  569689,
+  569690,
+  569691,
+  569692,
+  569700,
+  569710,
+  569711,
+  569712,
+  569713,
+  569714,
+  569715,
+  569716,
+  569717,
+  569730,
+  569740,
+  569790,
+  569820,
+  569850,
+  569930,
+  569950,
+  569980,
+  570010,
+  570020,
+  570030,
+  570090,
+  570120,
+  570160,
+  570170,
+  570180,
+  570181,
+  570190,
+  570200,
+  570210,
+  570220,
+  570240,
+  570250,
+  570260,
+  570270,
+  570280,
+  570300,
+  570310,
+  570320,
+  570360,
+  570361,
+  570362,
+  570363,
+  570430,
+  570450,
+  570480,
+  570481,
+  570560,
+  570610,
+  570611,
+  570612,
+  570613,
+  570614,
+  570615,
+  570616,
+  570617,
+  570619,
+  570651,
+  570652,
+  570653,
+  570654,
+  570655,
+  570660,
+  570670,
+  570720,
+  570750,
+  570800,
+  570801,
+  570830,
+  570920,
+  570930,
+  570960,
+  571010,
+  571030,
+  571031,
+  571040,
+  571120,
+  571150,
+  571160,
+  571170,
+  571190,
+  571210,
+  571220,
+  571250,
+  571290,
+  571300,
+  571360,
+  571361,
+  571362,
+  571410,
+  571440,
+  571470,
+  571570,
+  571580,
+  571610,
+  571650,
+  571651,
+  571670,
+  571690,
+  571710,
+  571730,
+  571750,
+  571760,
+  571761,
+  571770,
+  571810,
+  571820,
+  571850,
+  571890,
+  571900,
+  571960,
+  572030,
+  572060,
+  572070,
+  572120,
+  572190,
+  572210,
+  572280,
+  572310,
+  572311,
+  572340,
+  572350,
+  572370,
+  572380,
+  572381,
+  572382,
+  572390,
+  572400,
+  572420,
+  572470,
+  572490,
+  572500,
+  572530,
+  572750,
+  572770,
+  572780,
+  572790,
+  572840,
+  572910,
+  572930,
+  573010,
+  573140,
+  573150,
+  573160,
+  573161,
+  573180,
+  573190,
+  573230,
+  573240,
+  573290,
+  573350,
+  573470,
+  573500,
+  573510,
+  573511,
+  573512,
+  573513,
+  573540,
+  573541,
+  573542,
+  573543,
+  573544,
+  573545,
+  573546,
+  573547,
+  573548,
+  573570,
+  573580,
+  573620,
+  573640,
+  573820,
+  573821,
+  573830,
+  573831,
+  573832,
+  573850,
+  573870,
+  573880,
+  573900,
+  573920,
+  573940,
+  573960,
+  574020,
+  574110,
+  574250,
+  574280,
+  574300,
+  574320,
+  574330,
+  574390,
+  574400,
+  574450,
+  574460,
+  574490,
+  574570,
+  574670,
+  574671,
+  574672,
+  574673,
+  574674,
+  574675,
+  574676,
+  574677,
+  574680,
+  574730,
+  574750,
+  574770,
+  574790,
+  574880,
+  574960,
+  574961,
+  574962,
+  574963,
+  574964,
+  574965,
+  574966,
+  574967,
+  574968,
+  574970,
+  574971,
+  574972,
+  574990,
+  575190,
+  575230,
+  575240,
+  575250,
+  575260,
+  575270,
+  575290,
+  575291,
+  575300,
+  575301,
+  575310,
+  575500,
+  575501,
+  575610,
+  575930,
+  576180,
+  576200,
+  576210,
+  576220,
+  576250,
+  576270,
+  576300,
+  576350,
+  576450,
+  576520,
+  576530,
+  576570,
+  576580,
+  576600,
+  576610,
+  576611,
+  576612,
+  576613,
+  576614,
+  576615,
+  576616,
+  576617,
+  576790,
+  576920,
+  576930,
+  577020,
+  577030,
+  577060,
+  577100,
+  577110,
+  577130,
+  577131,
+  577220,
+  577250,
+  577310,
+  577311,
+  577312,
+  577350,
+  577351,
+  577352,
+  577353,
+  577354,
+  577355,
+  577356,
+  577357,
+  577358,
+  577359,
+  577400,
+  577401,
+  577402,
+  577403,
+  577404,
+  577405,
+  577450,
+  577540,
+  577590,
+  577600,
+  577610,
+  577620,
+  577630,
+  577810,
+  577840,
+  577900,
+  577901,
+  577930,
+  578000,
+  578020,
+  578030,
+  578070,
+  578110,
+  578140,
+  578160,
+  578200,
+  578201,
+  578220,
+  578240,
+  578270,
+  578280,
+  578281,
+  578290,
+  578340,
+  578380,
+  578400,
+  578480,
+  578500,
+  578530,
+  578560,
+  578580,
+  578680,
+  578770,
+  578970,
+  578980,
+  579090,
+  579100,
+  579140,
+  579270,
+  579320,
+  579410,
+  579504,
+  579505,
+  579506,
+  579507,
+  579508,
+  579510,
+  579530,
+  579531,
+  579532,
+  579533,
+  579534,
+  579535,
+  579536,
+  579537,
+  579538,
+  579539,
+  579540,
+  579541,
+  579620,
+  579640,
+  579650,
+  579670,
+  579671,
+  579672,
+  579690,
+  579730,
+  579740,
+  579750,
+  579790,
+  579860,
+  579890,
+  579900,
+  579901,
+  579910,
+  579911,
+  579920,
+  579930,
+  579960,
+  580020,
+  580030,
+  580050,
+  580051,
+  580080,
+  580081,
+  580090,
+  580100,
+  580120,
+  580160,
+  580180,
+  580192,
+  580210,
+  580231,
+  580240,
+  580290,
+  580310,
+  580430,
+  580440,
+  580460,
+  580500,
+  580530,
+  580600,
+  580610,
+  580620,
+  580660,
+  580661,
+  580700,
+  580730,
+  580731,
+  580740,
+  580760,
+  580790,
+  580830,
+  580831,
+  580832,
+  580833,
+  581080,
+  581330,
+  581390,
+  581400,
+  581450,
+  581750,
+  581770,
+  581771,
+  581772,
+  581773,
+  581830,
+  581831,
+  581880,
+  581940,
+  581950,
+  581951,
+  581990,
+  582040,
+  582070,
+  582071,
+  582072,
+  582090,
+  582100,
+  582130,
+  582150,
+  582170,
+  582171,
+  582172,
+  582220,
+  582230,
+  582240,
+  582250,
+  582320,
+  582340,
+  582380,
+  582381,
+  582382,
+  582400,
+  582470,
+  582510,
+  582520,
+  582540,
+  582570,
+  582571,
+  582572,
+  582573,
+  582574,
+  582575,
+  582576,
+  582577,
+  582578,
+  582600,
+  582650,
+  582880,
+  582930,
+  583010,
+  583070,
+  583110,
+  583140,
+  583200,
+  583220,
+  583230,
+  583260,
+  583510,
+  583550,
+  583560,
+  583620,
+  583630,
+  583631,
+  583632,
+  583633,
+  583634,
+  583635,
+  583640,
+  583670,
+  583680,
+  583681,
+  583690,
+  583691,
+  583720,
+  583730,
+  583800,
+  583810,
+  583850,
+  583860,
+  583870,
+  583990,
+  583991,
+  583992,
+  583993,
+  583994,
+  584030,
+  584050,
+  584060,
+  584090,
+  584091,
+  584092,
+  584093,
+  584094,
+  584095,
+  584096,
+  584097,
+  584120,
+  584140,
+  584141,
+  584180,
+  584190,
+  584191,
+  584192,
+  584200,
+  584240,
+  584250,
+  584260,
+  584270,
+  584290,
+  584380,
+  584381,
+  584382,
+  584383,
+  584390,
+  584620,
+  584630,
+  584690,
+  584700,
+  584720,
+  584770,
+  584790,
+  584820,
+  584910,
+  584950,
+  584960,
+  584970,
+  585060,
+  585070,
+  585110,
+  585120,
+  585130,
+  585160,
+  585210,
+  585410,
+  585440,
+  585460,
+  585470,
+  585471,
+  585472,
+  585480,
+  585481,
+  585482,
+  585510,
+  585520,
+  585540,
+  585600,
+  585610,
+  585620,
+  585640,
+  585650,
+  585700,
+  585730,
+  585870,
+  585930,
+  585980,
+  586000,
+  586010,
+  586070,
+  586210,
+  586220,
+  586410,
+  586420,
+  586490,
+  586500,
+  586550,
+  586560,
+  586730,
+  586731,
+  586732,
+  586760,
+  586870,
+  586900,
+  586910,
+  586940,
+  587020,
+  587030,
+  587080,
+  587120,
+  587150,
+  587170,
+  587200,
+  587230,
+  587270,
+  587350,
+  587380,
+  587410,
+  587411,
+  587412,
+  587413,
+  587414,
+  587500,
+  587510,
+  587550,
+  587610,
+  587640,
+  587660,
+  587700,
+  587740,
+  587760,
+  587780,
+  587800,
+  587820,
+  587880,
+  587881,
+  587882,
+  587890,
+  587891,
+  587910,
+  587980,
+  587990,
+  588130,
+  588150,
+  588260,
+  588261,
+  588262,
+  588263,
+  588270,
+  588280,
+  588300,
+  588301,
+  588330,
+  588350,
+  588390,
+  588510,
+  588570,
+  588580,
+  588600,
+  588660,
+  588670,
+  588720,
+  588780,
+  588790,
+  588810,
+  588830,
+  588840,
+  588870,
+  588960,
+  588961,
+  588962,
+  588963,
+  588964,
+  589010,
+  589020,
+  589021,
+  589090,
+  589130,
+  589140,
+  589141,
+  589142,
+  589230,
+  589310,
+  589330,
+  589560,
+  589600,
+  589610,
+  589650,
+  589651,
+  589700,
+  589790,
+  589810,
+  589811,
+  589812,
+  589813,
+  589840,
+  590160,
+  590161,
+  590162,
+  590170,
+  590171,
+  590172,
+  590173,
+  590174,
+  590175,
+  590176,
+  590177,
+  590178,
+  590179,
+  590180,
+  590181,
+  590182,
+  590183,
+  590184,
+  590185,
+  590186,
+  590187,
+  590188,
+  590189,
+  590190,
+  590191,
+  590192,
+  590193,
+  590194,
+  590195,
+  590196,
+  590197,
+  590198,
+  590199,
+  590200,
+  590201,
+  590202,
+  590203,
+  590204,
+  590205,
+  590206,
+  590207,
+  590208,
+  590209,
+  590210,
+  590211,
+  590212,
+  590213,
+  590214,
+  590215,
+  590216,
+  590217,
+  590218,
+  590219,
+  590220,
+  590221,
+  590222,
+  590223,
+  590224,
+  590225,
+  590226,
+  590227,
+  590228,
+  590229,
+  590230,
+  590231,
+  590232,
+  590233,
+  590234,
+  590235,
+  590236,
+  590237,
+  590238,
+  590239,
+  590240,
+  590241,
+  590242,
+  590243,
+  590244,
+  590245,
+  590246,
+  590247,
+  590248,
+  590249,
+  590290,
+  590350,
+  590360,
+  590361,
+  590390,
+  590391,
+  590392,
+  590393,
+  590400,
+  590410,
+  590450,
+  590460,
+  590470,
+  590480,
+  590490,
+  590500,
+  590520,
+  590540,
+  590610,
+  590620,
+  590630,
+  590640,
+  590650,
+  590750,
+  590760,
+  590810,
+  590860,
+  590880,
+  590881,
+  590882,
+  590883,
+  590884,
+  591030,
+  591040,
+  591050,
+  591060,
+  591061,
+  591062,
+  591063,
+  591070,
+  591121,
+  591160,
+  591430,
+  591490,
+  591491,
+  591492,
+  591493,
+  591494,
+  591495,
+  591496,
+  591497,
+  591498,
+  591499,
+  591500,
+  591501,
+  591502,
+  591503,
+  591504,
+  591505,
+  591506,
+  591507,
+  591508,
+  591509,
+  591520,
+  591600,
+  591620,
+  591690,
+  591700,
+  591710,
+  591720,
+  591730,
+  591770,
+  591771,
+  591772,
+  591773,
+  591774,
+  591775,
+  591776,
+  591777,
+  591778,
+  591779,
+  591780,
+  591781,
+  591800,
+  591810,
+  591811,
+  591812,
+  591813,
+  591820,
+  591870,
+  591871,
+  591872,
+  591880,
+  591890,
+  591900,
+  591970,
+  591971,
+  591980,
+  591981,
+  591982,
+  591983,
+  591984,
+  591985,
+  591986,
+  591987,
+  592110,
+  592260,
+  592290,
+  592291,
+  592292,
+  592350,
+  592370,
+  592371,
+  592372,
+  592373,
+  592374,
+  592420,
+  592421,
+  592422,
+  592423,
+  592450,
+  592460,
+  592461,
+  592470,
+  592471,
+  592472,
+  592473,
+  592474,
+  592475,
+  592531,
+  592670,
+  592671,
+  592700,
+  592790,
+  592800,
+  592810,
+  592811,
+  592812,
+  592813,
+  592814,
+  592815,
+  592816,
+  592820,
+  592830,
+  592840,
+  592850,
+  592860,
+  592920,
+  592960,
+  592980,
+  592981,
+  593000,
+  593040,
+  593050,
+  593051,
+  593052,
+  593053,
+  593054,
+  593055,
+  593056,
+  593057,
+  593090,
+  593130,
+  593140,
+  593170,
+  593270,
+  593271,
+  593272,
+  593273,
+  593360,
+  593370,
+  593380,
+  593390,
+  593420,
+  593430,
+  593431,
+  593450,
+  593480,
+  593500,
+  593501,
+  593502,
+  593503,
+  593550,
+  593910,
+  593920,
+  593930,
+  593931,
+  593932,
+  593990,
+  594060,
+  594070,
+  594080,
+  594100,
+  594180,
+  594182,
+  594183,
+  594184,
+  594270,
+  594400,
+  594420,
+  594430,
+  594431,
+  594432,
+  594433,
+  594440,
+  594450,
+  594451,
+  594452,
+  594453,
+  594454,
+  594460,
+  594461,
+  594462,
+  594463,
+  594464,
+  594470,
+  594480,
+  594540,
+  594560,
+  594561,
+  594590,
+  594591,
+  594592,
+  594593,
+  594594,
+  594595,
+  594596,
+  594597,
+  594598,
+  594599,
+  594600,
+  594601,
+  594602,
+  594603,
+  594610,
+  594620,
+  594630,
+  594700,
+  594970,
+  595020,
+  595050,
+  595170,
+  595180,
+  595200,
+  595230,
+  595290,
+  595330,
+  595331,
+  595332,
+  595333,
+  595350,
+  595490,
+  595510,
+  595700,
+  595750,
+  595751,
+  595752,
+  595753,
+  595754,
+  595755,
+  595756,
+  595757,
+  595830,
+  595900,
+  595940,
+  595970,
+  595980,
+  596110,
+  596120,
+  596130,
+  596140,
+  596160,
+  596190,
+  596230,
+  596231,
+  596460,
+  596480,
+  596520,
+  596760,
+  596820,
+  596821,
+  596822,
+  596823,
+  596830,
+  596860,
+  596880,
+  596960,
+  597050,
+  597070,
+  597071,
+  597072,
+  597073,
+  597074,
+  597075,
+  597076,
+  597077,
+  597078,
+  597079,
+  597100,
+  597101,
+  597102,
+  597103,
+  597260,
+  597270,
+  597290,
+  597310,
+  597420,
+  597600,
+  597610,
+  597660,
+  597690,
+  597780,
+  597840,
+  597870,
+  597890,
+  597910,
+  597930,
+  597940,
+  597950,
+  598010,
+  598020,
+  598021,
+  598022,
+  598110,
+  598120,
+  598150,
+  598180,
+  598190,
+  598210,
+  598250,
+  598290,
+  598300,
+  598301,
+  598302,
+  598303,
+  598390,
+  598420,
+  598510,
+  598540,
+  598580,
+  598660,
+  598710,
+  598770,
+  598800,
+  598850,
+  598860,
+  598870,
+  598890,
+  598900,
+  598910,
+  598920,
+  598921,
+  598930,
+  598950,
+  599020,
+  599021,
+  599022,
+  599023,
+  599050,
+  599190,
+  599210,
+  599230,
+  599250,
+  599270,
+  599290,
+  599310,
+  599330,
+  599350,
+  599370,
+  599400,
+  599440,
+  599441,
+  599520,
+  599530,
+  599540,
+  599640,
+  599660,
+  599690,
+  599740,
+  599760,
+  599810,
+  599850,
+  599851,
+  599860,
+  599890,
+  599910,
+  599930,
+  599931,
+  599932,
+  599933,
+  599980,
+  600070,
+  600240,
+  600320,
+  600470,
+  600560,
+  600590,
+  600591,
+  600592,
+  600620,
+  600760,
+  600770,
+  601040,
+  601100,
+  601190,
+  601260,
+  601270,
+  601290,
+  601291,
+  601292,
+  601293,
+  601294,
+  601295,
+  601296,
+  601297,
+  601298,
+  601300,
+  601301,
+  601302,
+  601303,
+  601310,
+  601350,
+  601370,
+  601390,
+  601410,
+  601620,
+  601660,
+  601670,
+  601690,
+  601710,
+  601730,
+  601780,
+  601800,
+  601820,
+  601850,
+  601890,
+  602060,
+  602210,
+  602230,
+  602231,
+  602260,
+  602280,
+  602290,
+  602310,
+  602330,
+  602340,
+  602350,
+  602370,
+  602380,
+  602390,
+  602400,
+  602410,
+  602440,
+  602441,
+  602450,
+  602451,
+  602460,
+  602461,
+  602470,
+  602471,
+  602472,
+  602580,
+  602581,
+  602582,
+  602583,
+  602584,
+  602620,
+  602621,
+  602622,
+  602623,
+  602690,
+  602720,
+  602730,
+  602740,
+  602750,
+  602780,
+  602800,
+  602801,
+  602810,
+  602811,
+  602812,
+  602813,
+  602814,
+  602815,
+  602816,
+  602817,
+  602818,
+  602819,
+  602820,
+  602870,
+  602950,
+  602980,
+  603170,
+  603300,
+  603301,
+  603302,
+  603303,
+  603305,
+  603306,
+  603307,
+  603308,
+  603310,
+  603510,
+  603520,
+  603590,
+  603760,
+  604070,
+  604090,
+  604091,
+  604100,
+  604180,
+  604210,
+  604270,
+  604280,
+  604290,
+  604310,
+  604350,
+  604360,
+  604430,
+  604480,
+  604600,
+  604601,
+  604602,
+  604610,
+  604650,
+  604730,
+  604800,
+  604840,
+  604860,
+  604870,
+  604890,
+  604930,
+  605020,
+  605030,
+  605050,
+  605090,
+  605240,
+  605270,
+  605280,
+  605320,
+  605321,
+  605322,
+  605323,
+  605324,
+  605325,
+  605326,
+  605327,
+  605328,
+  605330,
+  605331,
+  605332,
+  605333,
+  605334,
+  605335,
+  605350,
+  605351,
+  605352,
+  605353,
+  605354,
+  605360,
+  605361,
+  605400,
+  605430,
+  605460,
+  605480,
+  605540,
+  605550,
+  605560,
+  605590,
+  605650,
+  605670,
+  605690,
+  605700,
+  605710,
+  605780,
+  605880,
+  605930,
+  605940,
+  605951,
+  605953,
+  605954,
+  605955,
+  605956,
+  605957,
+  605958,
+  605959,
+  605960,
+  605961,
+  606010,
+  606080,
+  606090,
+  606100,
+  606180,
+  606210,
+  606240,
+  606320,
+  606321,
+  606920,
+  606970,
+  606971,
+  607010,
+  607100,
+  607143,
+  607250,
+  607300,
+  607310,
+  607320,
+  607340,
+  607380,
+  607450,
+  607480,
+  607500,
+  607510,
+  607550,
+  607560,
+  607570,
+  607580,
+  607690,
+  607830,
+  607840,
+  608000,
+  608020,
+  608090,
+  608100,
+  608140,
+  608150,
+  608160,
+  608170,
+  608180,
+  608200,
+  608210,
+  608220,
+  608420,
+  608590,
+  608600,
+  608620,
+  608650,
+  608680,
+  608720,
+  608730,
+  608840,
+  608980,
+  609120,
+  609200,
+  609220,
+  609240,
+  609250,
+  609260,
+  609270,
+  609280,
+  609290,
+  609300,
+  609310,
+  609311,
+  609370,
+  609430,
+  609440,
+  609460,
+  609480,
+  609700,
+  609730,
+  609790,
+  609791,
+  609792,
+  609793,
+  609794,
+  609795,
+  609796,
+  609800,
+  609820,
+  609821,
+  609822,
+  609823,
+  609824,
+  609825,
+  609826,
+  609827,
+  609828,
+  609829,
+  609830,
+  609860,
+  609870,
+  609880,
+  609950,
+  609951,
+  609952,
+  609953,
+  609954,
+  609955,
+  609956,
+  609957,
+  609970,
+  610010,
+  610040,
+  610050,
+  610051,
+  610060,
+  610070,
+  610100,
+  610150,
+  610220,
+  610221,
+  610222,
+  610270,
+  610280,
+  610290,
+  610330,
+  610340,
+  610400,
+  610420,
+  610490,
+  610510,
+  610520,
+  610690,
+  610691,
+  610692,
+  610693,
+  610694,
+  610695,
+  610696,
+  610697,
+  610698,
+  610699,
+  610700,
+  610701,
+  610702,
+  610703,
+  610704,
+  610705,
+  610706,
+  610707,
+  610708,
+  610709,
+  610760,
+  610820,
+  610830,
+  610850,
+  610870,
+  610910,
+  610920,
+  610970,
+  611110,
+  611210,
+  611250,
+  611270,
+  611310,
+  611370,
+  611400,
+  611420,
+  611421,
+  611740,
+  611920,
+  611921,
+  611922,
+  611923,
+  611924,
+  611925,
+  611940,
+  611941,
+  611942,
+  611950,
+  611990,
+  612000,
+  612200,
+  612210,
+  612260,
+  612261,
+  612320,
+  612330,
+  612340,
+  612341,
+  612350,
+  612480,
+  612490,
+  612491,
+  612500,
+  612550,
+  612560,
+  612580,
+  612630,
+  612631,
+  612650,
+  612860,
+  612870,
+  612900,
+  612940,
+  612960,
+  612980,
+  613000,
+  613220,
+  613230,
+  613260,
+  613430,
+  613520,
+  613550,
+  613630,
+  613660,
+  613680,
+  613690,
+  613700,
+  613710,
+  613870,
+  613950,
+  614000,
+  614001,
+  614002,
+  614003,
+  614004,
+  614005,
+  614006,
+  614007,
+  614008,
+  614009,
+  614020,
+  614080,
+  614110,
+  614111,
+  614170,
+  614180,
+  614190,
+  614200,
+  614240,
+  614270,
+  614280,
+  614290,
+  614300,
+  614330,
+  614340,
+  614350,
+  614370,
+  614410,
+  614420,
+  614540,
+  614580,
+  614581,
+  614582,
+  614610,
+  614620,
+  614621,
+  614680,
+  614720,
+  614740,
+  614750,
+  614760,
+  614780,
+  614820,
+  614870,
+  615130,
+  615140,
+  615170,
+  615190,
+  615200,
+  615210,
+  615260,
+  615300,
+  615320,
+  615380,
+  615420,
+  615500,
+  615510,
+  615520,
+  615540,
+  615710,
+  615920,
+  615930,
+  615981,
+  615990,
+  616020,
+  616060,
+  616130,
+  616150,
+  616160,
+  616170,
+  616180,
+  616190,
+  616191,
+  616200,
+  616210,
+  616260,
+  616280,
+  616290,
+  616300,
+  616350,
+  616370,
+  616430,
+  616440,
+  616480,
+  616500,
+  616510,
+  616530,
+  616540,
+  616550,
+  616590,
+  616600,
+  616720,
+  616840,
+  616850,
+  616901,
+  616940,
+  616950,
+  616960,
+  616970,
+  616980,
+  616990,
+  617000,
+  617001,
+  617040,
+  617050,
+  617051,
+  617090,
+  617100,
+  617110,
+  617120,
+  617130,
+  617140,
+  617150,
+  617340,
+  617360,
+  617380,
+  617400,
+  617410,
+  617470,
+  617490,
+  617500,
+  617510,
+  617520,
+  617530,
+  617550,
+  617560,
+  617570,
+  617580,
+  617720,
+  617740,
+  617760,
+  617780,
+  617810,
+  617870,
+  617890,
+  617900,
+  617960,
+  617961,
+  617962,
+  618090,
+  618180,
+  618280,
+  618320,
+  618460,
+  618480,
+  618520,
+  618660,
+  618661,
+  618662,
+  618663,
+  618664,
+  618680,
+  618681,
+  618682,
+  618700,
+  618730,
+  618770,
+  618771,
+  618940,
+  618980,
+  619050,
+  619070,
+  619120,
+  619160,
+  619170,
+  619180,
+  619190,
+  619200,
+  619240,
+  619250,
+  619420,
+  619440,
+  619460,
+  619510,
+  619550,
+  619570,
+  619580,
+  619582,
+  619583,
+  619584,
+  619585,
+  619586,
+  619630,
+  619680,
+  619690,
+  619710,
+  619711,
+  619720,
+  619790,
+  619800,
+  619801,
+  619920,
+  619940,
+  619960,
+  619970,
+  619980,
+  620000,
+  620040,
+  620050,
+  620090,
+  620110,
+  620150,
+  620151,
+  620230,
+  620260,
+  620270,
+  620290,
+  620320,
+  620321,
+  620322,
+  620323,
+  620324,
+  620325,
+  620326,
+  620370,
+  620381,
+  620382,
+  620460,
+  620470,
+  620480,
+  620490,
+  620500,
+  620520,
+  620540,
+  620560,
+  620610,
+  620680,
+  620730,
+  620740,
+  620741,
+  620742,
+  620743,
+  620744,
+  620745,
+  620746,
+  620780,
+  620810,
+  620820,
+  620830,
+  620850,
+  620880,
+  620910,
+  620920,
+  620930,
+  620950,
+  620970,
+  620990,
+  621040,
+  621100,
+  621110,
+  621160,
+  621180,
+  621190,
+  621200,
+  621210,
+  621240,
+  621300,
+  621320,
+  621440,
+  621460,
+  621461,
+  621500,
+  621520,
+  621560,
+  621840,
+  621870,
+  621920,
+  621921,
+  621922,
+  621923,
+  621924,
+  621925,
+  621926,
+  621927,
+  621928,
+  621929,
+  621960,
+  621980,
+  621981,
+  621990,
+  622000,
+  622030,
+  622070,
+  622090,
+  622110,
+  622120,
+  622130,
+  622160,
+  622210,
+  622240,
+  622260,
+  622280,
+  622290,
+  622300,
+  622330,
+  622331,
+  622350,
+  622351,
+  622352,
+  622353,
+  622354,
+  622355,
+  622356,
+  622357,
+  622358,
+  622360,
+  622390,
+  622400,
+  622450,
+  622500,
+  622520,
+  622580,
+  622660,
+  622661,
+  622690,
+  622710,
+  622730,
+  622740,
+  622750,
+  622760,
+  622850,
+  622851,
+  622960,
+  622970,
+  622990,
+  622991,
+  623000,
+  623010,
+  623020,
+  623100,
+  623110,
+  623130,
+  623131,
+  623132,
+  623133,
+  623134,
+  623140,
+  623150,
+  623190,
+  623191,
+  623192,
+  623193,
+  623194,
+  623195,
+  623196,
+  623197,
+  623198,
+  623200,
+  623230,
+  623250,
+  623260,
+  623261,
+  623262,
+  623263,
+  623264,
+  623265,
+  623266,
+  623267,
+  623268,
+  623270,
+  623290,
+  623291,
+  623350,
+  623490,
+  623530,
+  623560,
+  623590,
+  623611,
+  623613,
+  623616,
+  623617,
+  623619,
+  623620,
+  623690,
+  623710,
+  623720,
+  623760,
+  623780,
+  623781,
+  623790,
+  623830,
+  623890,
+  623970,
+  624030,
+  624110,
+  624220,
+  624240,
+  624280,
+  624281,
+  624282,
+  624330,
+  624360,
+  624370,
+  624371,
+  624390,
+  624510,
+  624530,
+  624531,
+  624540,
+  624590,
+  624620,
+  624621,
+  624622,
+  624642,
+  624643,
+  624740,
+  624760,
+  624840,
+  624850,
+  624940,
+  624960,
+  625030,
+  625050,
+  625060,
+  625080,
+  625100,
+  625110,
+  625170,
+  625171,
+  625172,
+  625190,
+  625200,
+  625330,
+  625350,
+  625450,
+  625480,
+  625500,
+  625610,
+  625660,
+  625710,
+  625850,
+  625851,
+  625852,
+  625853,
+  625870,
+  625871,
+  625872,
+  625873,
+  625874,
+  625875,
+  625876,
+  625877,
+  625878,
+  625879,
+  625880,
+  625881,
+  625920,
+  626180,
+  626240,
+  626470,
+  626490,
+  626491,
+  626520,
+  626521,
+  626522,
+  626523,
+  626530,
+  626531,
+  626532,
+  626533,
+  626534,
+  626535,
+  626536,
+  626540,
+  626541,
+  626542,
+  626543,
+  626544,
+  626545,
+  626546,
+  626547,
+  626548,
+  626560,
+  626561,
+  626562,
+  626620,
+  626650,
+  626740,
+  626750,
+  626790,
+  626800,
+  626820,
+  626830,
+  626850,
+  626900,
+  626930,
+  626940,
+  626950,
+  627030,
+  627310,
+  627370,
+  627390,
+  627400,
+  627430,
+  627440,
+  627470,
+  627500,
+  627510,
+  627530,
+  627580,
+  627581,
+  627582,
+  627700,
+  627980,
+  628240,
+  628250,
+  628260,
+  628280,
+  628300,
+  628310,
+  628600,
+  628790,
+  628930,
+  628970,
+  628980,
+  629010,
+  629020,
+  629021,
+  629070,
+  629190,
+  629191,
+  629310,
+  629330,
+  629370,
+  629470,
+  629490,
+  629500,
+  629520,
+  629580,
+  629620,
+  629630,
+  629680,
+  629700,
+  629710,
+  629750,
+  629751,
+  629790,
+  629791,
+  629792,
+  629793,
+  629794,
+  629795,
+  629796,
+  629800,
+  629830,
+  629880,
+  629890,
+  629900,
+  629920,
+  629930,
+  629940,
+  629950,
+  629990,
+  630010,
+  630090,
+  630091,
+  630092,
+  630110,
+  630180,
+  630190,
+  630200,
+  630230,
+  630270,
+  630280,
+  630290,
+  630300,
+  630330,
+  630340,
+  630380,
+  630420,
+  630430,
+  630480,
+  630500,
+  630590,
+  630661,
+  630662,
+  630663,
+  630780,
+  630850,
+  630890,
+  630900,
+  630910,
+  630911,
+  630912,
+  630913,
+  630914,
+  630915,
+  630916,
+  630917,
+  630918,
+  630919,
+  630920,
+  630940,
+  630950,
+  630970,
+  631040,
+  631041,
+  631110,
+  631130,
+  631290,
+  631291,
+  631292,
+  631293,
+  631310,
+  631320,
+  631330,
+  631331,
+  631332,
+  631450,
+  631500,
+  631550,
+  631551,
+  631552,
+  631553,
+  631554,
+  631560,
+  631580,
+  631610,
+  631690,
+  631800,
+  631801,
+  631802,
+  631803,
+  631970,
+  632060,
+  632120,
+  632140,
+  632160,
+  632190,
+  632210,
+  632310,
+  632320,
+  632340,
+  632370,
+  632440,
+  632520,
+  632610,
+  632611,
+  632620,
+  632630,
+  632650,
+  632660,
+  632670,
+  632690,
+  632740,
+  632750,
+  632790,
+  632870,
+  632910,
+  632940,
+  633020,
+  633280,
+  633290,
+  633300,
+  633310,
+  633330,
+  633331,
+  633380,
+  633410,
+  633470,
+  633490,
+  633750,
+  633890,
+  633910,
+  633960,
+  633961,
+  633963,
+  633980,
+  633981,
+  633990,
+  634010,
+  634012,
+  634014,
+  634016,
+  634030,
+  634040,
+  634050,
+  634170,
+  634420,
+  634421,
+  634580,
+  635020,
+  635030,
+  635080,
+  635120,
+  635140,
+  635160,
+  635180,
+  635290,
+  635300,
+  635330,
+  635340,
+  635341,
+  635350,
+  635370,
+  635380,
+  635510,
+  635530,
+  635540,
+  635570,
+  635580,
+  635750,
+  635751,
+  635761,
+  635762,
+  635780,
+  635820,
+  635870,
+  635890,
+  636080,
+  636130,
+  636131,
+  636132,
+  636133,
+  636134,
+  636210,
+  636240,
+  636290,
+  636380,
+  636410,
+  636440,
+  636500,
+  636501,
+  636502,
+  636530,
+  636600,
+  636610,
+  636630,
+  636670,
+  636710,
+  636750,
+  636780,
+  636880,
+  636890,
+  636900,
+  637000,
+  637001,
+  637030,
+  637130,
+  637140,
+  637150,
+  637350,
+  637370,
+  637380,
+  637690,
+  637691,
+  637692,
+  637693,
+  637694,
+  637695,
+  637696,
+  637697,
+  637698,
+  637699,
+  637700,
+  637701,
+  637702,
+  637703,
+  637704,
+  637705,
+  637706,
+  637707,
+  637708,
+  637709,
+  637710,
+  637711,
+  637712,
+  637713,
+  637714,
+  637715,
+  637716,
+  637717,
+  637718,
+  637719,
+  637720,
+  637721,
+  637722,
+  637723,
+  637724,
+  637725,
+  637726,
+  637727,
+  637728,
+  637729,
+  637730,
+  637731,
+  637732,
+  637733,
+  637734,
+  637735,
+  637736,
+  637737,
+  637738,
+  637739,
+  637740,
+  637741,
+  637742,
+  637743,
+  637744,
+  637745,
+  637746,
+  637747,
+  637748,
+  637749,
+  637750,
+  637751,
+  637752,
+  637753,
+  637754,
+  637755,
+  637756,
+  637757,
+  637758,
+  637759,
+  637760,
+  637761,
+  637762,
+  637763,
+  637764,
+  637765,
+  637766,
+  637767,
+  637768,
+  637769,
+  637770,
+  637771,
+  637772,
+  637773,
+  637774,
+  637775,
+  637776,
+  637777,
+  637778,
+  637779,
+  637780,
+  637781,
+  637782,
+  637783,
+  637784,
+  637785,
+  637786,
+  637787,
+  637788,
+  637789,
+  637790,
+  637791,
+  637792,
+  637793,
+  637794,
+  637795,
+  637796,
+  637797,
+  637798,
+  637799,
+  637800,
+  637801,
+  637802,
+  637803,
+  637804,
+  637805,
+  637806,
+  637807,
+  637808,
+  637809,
+  637810,
+  637811,
+  637812,
+  637813,
+  637814,
+  637815,
+  637816,
+  637817,
+  637818,
+  637819,
+  637820,
+  637821,
+  637822,
+  637823,
+  637824,
+  637825,
+  637826,
+  637827,
+  637828,
+  637829,
+  637830,
+  637831,
+  637832,
+  637833,
+  637834,
+  637835,
+  637836,
+  637837,
+  637838,
+  637839,
+  637840,
+  637841,
+  637842,
+  637843,
+  637844,
+  637845,
+  637846,
+  637847,
+  637848,
+  637849,
+  637910,
+  637990,
+  638010,
+  638011,
+  638030,
+  638050,
+  638090,
+  638100,
+  638120,
+  638180,
+  638190,
+  638280,
+  638310,
+  638330,
+  638380,
+  638400,
+  638410,
+  638422,
+  638460,
+  638500,
+  638540,
+  638541,
+  638550,
+  638580,
+  638610,
+  638620,
+  638630,
+  638760,
+  638790,
+  638810,
+  638860,
+  638890,
+  638891,
+  638950,
+  638980,
+  638981,
+  639000,
+  639001,
+  639030,
+  639050,
+  639060,
+  639061,
+  639062,
+  639063,
+  639064,
+  639065,
+  639066,
+  639067,
+  639070,
+  639080,
+  639150,
+  639190,
+  639250,
+  639260,
+  639261,
+  639262,
+  639263,
+  639264,
+  639265,
+  639266,
+  639310,
+  639370,
+  639430,
+  639431,
+  639432,
+  639433,
+  639434,
+  639435,
+  639436,
+  639437,
+  639438,
+  639520,
+  639521,
+  639522,
+  639523,
+  639524,
+  639525,
+  639530,
+  639531,
+  639532,
+  639540,
+  639550,
+  639570,
+  639600,
+  639620,
+  639680,
+  639700,
+  639701,
+  639710,
+  639750,
+  639760,
+  639850,
+  639860,
+  639890,
+  639891,
+  639940,
+  639950,
+  639960,
+  640040,
+  640060,
+  640070,
+  640080,
+  640140,
+  640180,
+  640190,
+  640200,
+  640220,
+  640221,
+  640222,
+  640230,
+  640350,
+  640360,
+  640390,
+  640400,
+  640401,
+  640410,
+  640610,
+  640630,
+  640670,
+  640680,
+  640720,
+  640770,
+  640810,
+  640870,
+  640900,
+  640910,
+  640920,
+  640940,
+  640960,
+  641000,
+  641010,
+  641020,
+  641030,
+  641280,
+  641380,
+  641381,
+  641382,
+  641383,
+  641384,
+  641385,
+  641430,
+  641440,
+  641450,
+  641580,
+  641740,
+  641880,
+  641970,
+  642010,
+  642080,
+  642160,
+  642180,
+  642200,
+  642201,
+  642240,
+  642250,
+  642270,
+  642280,
+  642500,
+  642510,
+  642530,
+  642540,
+  642590,
+  642630,
+  642640,
+  642720,
+  642750,
+  642770,
+  642780,
+  642790,
+  642800,
+  642801,
+  642802,
+  642803,
+  642804,
+  642805,
+  642806,
+  642807,
+  642808,
+  642900,
+  643010,
+  643090,
+  643130,
+  643380,
+  643390,
+  643420,
+  643430,
+  643460,
+  643630,
+  643640,
+  643650,
+  643670,
+  643671,
+  643680,
+  643681,
+  643682,
+  643683,
+  643684,
+  643685,
+  643686,
+  643687,
+  643688,
+  643689,
+  643690,
+  643692,
+  643693,
+  643694,
+  643695,
+  643696,
+  643697,
+  643698,
+  643699,
+  643730,
+  643731,
+  643740,
+  643760,
+  643800,
+  643850,
+  643851,
+  643852,
+  643853,
+  643854,
+  643855,
+  643910,
+  644210,
+  644300,
+  644360,
+  644520,
+  644690,
+  644700,
+  644720,
+  644780,
+  644820,
+  644900,
+  644910,
+  644920,
+  644921,
+  644922,
+  644960,
+  644961,
+  644962,
+  645040,
+  645050,
+  645100,
+  645170,
+  645171,
+  645172,
+  645180,
+  645220,
+  645250,
+  645370,
+  645400,
+  645401,
+  645402,
+  645430,
+  645610,
+  645620,
+  645660,
+  645670,
+  645671,
+  645700,
+  645770,
+  645771,
+  645840,
+  645850,
+  645870,
+  645880,
+  645890,
+  645900,
+  645910,
+  645911,
+  645960,
+  645970,
+  646040,
+  646110,
+  646140,
+  646160,
+  646161,
+  646260,
+  646320,
+  646400,
+  646420,
+  646480,
+  646490,
+  646550,
+  646560,
+  646660,
+  646661,
+  646662,
+  646663,
+  646664,
+  646665,
+  646666,
+  646667,
+  646668,
+  646669,
+  646670,
+  646671,
+  646672,
+  646673,
+  646730,
+  646780,
+  646800,
+  646810,
+  646860,
+  646900,
+  646920,
+  646921,
+  646922,
+  646930,
+  646950,
+  646951,
+  646952,
+  646953,
+  646970,
+  646980,
+  647070,
+  647071,
+  647170,
+  647171,
+  647340,
+  647350,
+  647370,
+  647371,
+  647400,
+  647560,
+  647620,
+  647630,
+  647631,
+  647632,
+  647633,
+  647634,
+  647670,
+  647760,
+  647790,
+  647800,
+  647810,
+  647860,
+  647920,
+  648010,
+  648080,
+  648110,
+  648111,
+  648112,
+  648113,
+  648200,
+  648240,
+  648280,
+  648281,
+  648282,
+  648283,
+  648284,
+  648285,
+  648290,
+  648291,
+  648292,
+  648293,
+  648300,
+  648301,
+  648310,
+  648330,
+  648400,
+  648420,
+  648450,
+  648460,
+  648470,
+  648500,
+  648600,
+  648650,
+  648690,
+  648710,
+  648730,
+  648760,
+  648770,
+  648790,
+  648840,
+  648850,
+  648870,
+  648930,
+  648940,
+  648960,
+  648980,
+  649020,
+  649030,
+  649031,
+  649032,
+  649140,
+  649160,
+  649200,
+  649250,
+  649260,
+  649270,
+  649271,
+  649272,
+  649280,
+  649310,
+  649320,
+  649330,
+  649340,
+  649390,
+  649410,
+  649430,
+  649431,
+  649480,
+  649481,
+  649482,
+  649483,
+  649484,
+  649485,
+  649486,
+  649487,
+  649488,
+  649489,
+  649490,
+  649491,
+  649550,
+  649690,
+  649700,
+  649720,
+  649840,
+  649860,
+  649861,
+  649920,
+  649940,
+  650090,
+  650140,
+  650170,
+  650190,
+  650230,
+  650231,
+  650232,
+  650233,
+  650234,
+  650235,
+  650236,
+  650237,
+  650238,
+  650239,
+  650240,
+  650241,
+  650242,
+  650243,
+  650244,
+  650250,
+  650260,
+  650261,
+  650270,
+  650280,
+  650290,
+  650291,
+  650300,
+  650320,
+  650360,
+  650370,
+  650390,
+  650410,
+  650460,
+  650520,
+  650521,
+  650522,
+  650523,
+  650524,
+  650610,
+  650611,
+  650630,
+  650790,
+  650840,
+  650900,
+  650910,
+  650920,
+  650930,
+  651020,
+  651130,
+  651131,
+  651132,
+  651140,
+  651320,
+  651400,
+  651430,
+  651440,
+  651460,
+  651480,
+  651481,
+  651510,
+  651530,
+  651630,
+  651930,
+  652150,
+  652280,
+  652440,
+  652490,
+  652491,
+  652720,
+  652840,
+  652930,
+  652931,
+  652932,
+  652960,
+  653000,
+  653090,
+  653200,
+  653230,
+  653570,
+  653580,
+  653720,
+  653721,
+  653722,
+  653723,
+  653724,
+  653725,
+  653726,
+  653727,
+  653728,
+  653750,
+  653790,
+  653860,
+  653861,
+  653890,
+  653891,
+  653892,
+  654120,
+  654140,
+  654170,
+  654171,
+  654172,
+  654173,
+  654174,
+  654175,
+  654176,
+  654177,
+  654178,
+  654179,
+  654180,
+  654181,
+  654182,
+  654183,
+  654184,
+  654185,
+  654186,
+  654187,
+  654188,
+  654189,
+  654190,
+  654330,
+  654340,
+  654360,
+  654380,
+  654510,
+  654540,
+  654590,
+  655330,
+  656110,
+  656390,
+  656420,
+  656670,
+  656760,
+  656770,
+  656810,
+  656870,
+  656930,
+  656990,
+  657130,
+  657140,
+  657150,
+  657160,
+  657180,
+  657190,
+  657270,
+  657280,
+  657350,
+  657360,
+  657361,
+  657420,
+  657421,
+  657422,
+  657423,
+  657424,
+  657430,
+  657431,
+  657960,
+  658000,
+  658001,
+  658270,
+  658271,
+  658272,
+  658273,
+  658274,
+  658275,
+  658276,
+  658277,
+  658278,
+  658279,
+  658290,
+  658291,
+  658292,
+  658293,
+  658294,
+  658295,
+  658296,
+  658297,
+  658298,
+  658299,
+  658300,
+  658301,
+  658302,
+  658303,
+  658304,
+  658305,
+  658306,
+  658370,
+  658380,
+  658381,
+  658382,
+  658383,
+  658384,
+  658385,
+  658386,
+  658410,
+  658640,
+  658650,
+  658670,
+  658720,
+  658860,
+  658900,
+  658910,
+  659230,
+  659290,
+  659710,
+  659800,
+  659930,
+  659970,
+  659971,
+  659990,
+  660000,
+  660050,
+  660060,
+  660080,
+  660090,
+  660220,
+  660240,
+  660250,
+  660410,
+  660470,
+  660720,
+  660770,
+  660850,
+  660930,
+  661020,
+  661140,
+  661141,
+  661142,
+  661310,
+  661311,
+  661312,
+  661313,
+  661350,
+  661540,
+  661710,
+  661770,
+  661870,
+  661890,
+  662010,
+  662140,
+  662150,
+  662160,
+  662250,
+  662251,
+  662290,
+  662350,
+  662351,
+  662352,
+  662353,
+  662354,
+  662355,
+  662356,
+  662357,
+  662450,
+  662490,
+  662710,
+  662860,
+  662861,
+  662862,
+  662863,
+  662864,
+  662865,
+  662866,
+  662970,
+  663000,
+  663230,
+  663280,
+  663310,
+  663420,
+  663580,
+  663620,
+  663660,
+  663680,
+  663700,
+  663770,
+  663800,
+  663801,
+  663802,
+  663803,
+  663804,
+  663820,
+  664270,
+  664280,
+  664330,
+  664360,
+  664390,
+  664400,
+  664770,
+  664790,
+  664940,
+  665040,
+  665070,
+  665100,
+  665130,
+  665150,
+  665170,
+  665200,
+  665300,
+  665380,
+  665450,
+  665460,
+  665500,
+  665520,
+  665530,
+  665580,
+  665680,
+  665690,
+  665920,
+  665970,
+  665990,
+  666030,
+  666200,
+  666230,
+  666231,
+  666232,
+  666233,
+  666234,
+  666235,
+  666236,
+  666237,
+  666300,
+  666350,
+  666370,
+  666670,
+  666840,
+  667090,
+  667110,
+  667200,
+  667230,
+  667250,
+  667290,
+  667291,
+  667370,
+  667470,
+  667490,
+  667560,
+  667650,
+  667680,
+  667710,
+  667750,
+  667860,
+  667980,
+  668030,
+  668040,
+  668050,
+  668060,
+  668090,
+  668110,
+  668120,
+  668121,
+  668130,
+  668390,
+  668440,
+  668490,
+  668660,
+  668710,
+  668714,
+  668870,
+  668871,
+  668880,
+  668881,
+  668950,
+  669010,
+  669100,
+  669480,
+  669590,
+  669640,
+  669800,
+  669801,
+  669820,
+  669840,
+  669860,
+  669870,
+  669880,
+  669890,
+  669900,
+  669940,
+  670030,
+  670450,
+  670460,
+  670470,
+  670560,
+  670570,
+  670580,
+  670581,
+  670582,
+  670583,
+  670584,
+  670590,
+  670591,
+  670592,
+  670640,
+  670700,
+  670740,
+  670741,
+  670742,
+  670743,
+  670840,
+  670870,
+  670960,
+  670961,
+  670980,
+  670990,
+  671000,
+  671010,
+  671020,
+  671030,
+  671070,
+  671110,
+  671160,
+  671190,
+  671360,
+  671820,
+  671950,
+  672060,
+  672170,
+  672270,
+  672271,
+  672470,
+  672510,
+  672530,
+  672540,
+  672550,
+  672760,
+  672800,
+  672810,
+  672830,
+  672840,
+  672870,
+  673020,
+  673090,
+  673120,
+  673170,
+  673320,
+  673340,
+  673400,
+  673440,
+  673500,
+  673690,
+  673730,
+  673890,
+  673990,
+  674000,
+  674100,
+  674240,
+  674290,
+  674300,
+  674470,
+  674660,
+  674670,
+  674700,
+  674720,
+  674780,
+  674880,
+  674920,
+  674950,
+  674970,
+  675060,
+  675080,
+  675200,
+  675280,
+  675290,
+  675340,
+  675350,
+  675351,
+  675354,
+  675355,
+  675356,
+  675357,
+  675358,
+  675359,
+  675390,
+  675400,
+  675420,
+  675430,
+  675570,
+  675590,
+  675600,
+  675770,
+  675780,
+  675790,
+  675800,
+  675801,
+  675802,
+  675803,
+  675804,
+  675805,
+  675806,
+  675807,
+  675808,
+  675809,
+  675820,
+  675821,
+  675860,
+  675930,
+  676040,
+  676050,
+  676080,
+  676110,
+  676150,
+  676151,
+  676160,
+  676250,
+  676251,
+  676252,
+  676253,
+  676254,
+  676255,
+  676256,
+  676257,
+  676258,
+  676370,
+  676380,
+  676670,
+  676750,
+  676780,
+  676810,
+  676860,
+  676890,
+  676920,
+  677090,
+  677100,
+  677130,
+  677150,
+  677250,
+  677290,
+  677310,
+  677320,
+  677360,
+  677370,
+  677530,
+  677540,
+  677550,
+  677600,
+  677640,
+  677660,
+  677670,
+  677690,
+  677691,
+  677692,
+  677900,
+  677930,
+  677940,
+  677950,
+  677951,
+  677960,
+  677990,
+  677991,
+  677992,
+  677993,
+  677994,
+  677995,
+  677996,
+  677997,
+  677998,
+  677999,
+  678000,
+  678001,
+  678002,
+  678003,
+  678004,
+  678005,
+  678006,
+  678008,
+  678009,
+  678080,
+  678130,
+  678160,
+  678180,
+  678181,
+  678182,
+  678183,
+  678185,
+  678186,
+  678187,
+  678188,
+  678220,
+  678270,
+  678280,
+  678320,
+  678321,
+  678322,
+  678323,
+  678324,
+  678580,
+  678600,
+  678710,
+  678730,
+  678731,
+  678732,
+  678733,
+  678734,
+  678740,
+  679010,
+  679020,
+  679040,
+  679150,
+  679160,
+  679290,
+  679310,
+  679320,
+  679340,
+  679350,
+  679540,
+  679550,
+  679560,
+  679570,
+  679580,
+  679590,
+  679600,
+  679610,
+  679710,
+  679790,
+  679850,
+  679870,
+  679880,
+  679890,
+  679940,
+  679950,
+  680010,
+  680020,
+  680160,
+  680210,
+  680440,
+  680720,
+  680760,
+  680790,
+  680840,
+  680870,
+  680910,
+  681510,
+  681511,
+  681512,
+  681513,
+  681514,
+  681515,
+  681516,
+  681560,
+  681570,
+  681680,
+  681700,
+  681701,
+  681870,
+  682130,
+  682200,
+  682240,
+  682300,
+  682310,
+  682380,
+  682390,
+  682400,
+  682410,
+  682460,
+  682520,
+  682540,
+  682560,
+  682580,
+  682581,
+  682582,
+  682600,
+  682750,
+  682760,
+  682830,
+  682840,
+  682850,
+  682870,
+  682890,
+  682900,
+  682950,
+  682980,
+  683060,
+  683090,
+  683100,
+  683120,
+  683140,
+  683270,
+  683360,
+  683420,
+  683500,
+  683610,
+  683720,
+  683740,
+  683850,
+  683860,
+  683880,
+  683990,
+  683991,
+  683992,
+  683993,
+  683994,
+  684010,
+  684110,
+  684140,
+  684220,
+  684240,
+  684241,
+  684290,
+  684330,
+  684360,
+  684380,
+  684480,
+  684610,
+  684630,
+  684670,
+  684690,
+  684730,
+  684780,
+  684790,
+  684850,
+  684851,
+  685070,
+  685080,
+  685100,
+  685220,
+  685250,
+  685270,
+  685280,
+  685300,
+  685470,
+  685480,
+  685710,
+  685720,
+  685820,
+  685830,
+  685840,
+  685850,
+  686070,
+  686130,
+  686210,
+  686220,
+  686280,
+  686350,
+  686351,
+  686390,
+  686400,
+  686401,
+  686402,
+  686403,
+  686404,
+  686405,
+  686410,
+  686420,
+  686430,
+  686540,
+  686670,
+  686700,
+  686710,
+  686711,
+  686790,
+  686800,
+  686880,
+  686890,
+  686970,
+  686980,
+  686990,
+  687000,
+  687010,
+  687020,
+  687030,
+  687040,
+  687050,
+  687060,
+  687070,
+  687080,
+  687090,
+  687100,
+  687110,
+  687120,
+  687130,
+  687140,
+  687150,
+  687160,
+  687170,
+  687180,
+  687190,
+  687200,
+  687210,
+  687220,
+  687230,
+  687251,
+  687330,
+  687500,
+  687570,
+  687620,
+  687660,
+  687661,
+  687700,
+  687701,
+  687702,
+  687820,
+  687870,
+  687910,
+  688030,
+  688040,
+  688090,
+  688100,
+  688230,
+  688240,
+  688241,
+  688242,
+  688243,
+  688244,
+  688245,
+  688246,
+  688247,
+  688248,
+  688249,
+  688250,
+  688251,
+  688252,
+  688253,
+  688254,
+  688255,
+  688256,
+  688257,
+  688258,
+  688259,
+  688270,
+  688271,
+  688272,
+  688273,
+  688274,
+  688280,
+  688290,
+  688300,
+  688310,
+  688410,
+  688460,
+  688510,
+  688520,
+  688530,
+  688700,
+  688810,
+  688820,
+  688830,
+  688860,
+  688870,
+  688890,
+  688960,
+  688970,
+  688980,
+  689390,
+  689410,
+  689430,
+  689490,
+  689550,
+  689580,
+  689590,
+  689630,
+  689780,
+  689790,
+  689800,
+  689810,
+  689850,
+  689860,
+  689870,
+  689890,
+  689920,
+  689950,
+  690020,
+  690030,
+  690160,
+  690180,
+  690190,
+  690270,
+  690280,
+  690300,
+  690330,
+  690380,
+  690430,
+  690450,
+  690540,
+  690660,
+  690690,
+  690700,
+  690730,
+  690770,
+  690780,
+  690880,
+  691110,
+  691120,
+  691140,
+  691170,
+  691190,
+  691300,
+  691310,
+  691440,
+  691441,
+  691480,
+  691490,
+  691500,
+  691510,
+  691520,
+  691530,
+  691560,
+  691670,
+  691671,
+  691870,
+  691871,
+  691872,
+  691873,
+  691874,
+  691950,
+  692040,
+  692050,
+  692080,
+  692120,
+  692140,
+  692150,
+  692151,
+  692152,
+  692153,
+  692220,
+  692240,
+  692250,
+  692300,
+  692500,
+  692510,
+  692670,
+  692700,
+  692770,
+  693000,
+  693060,
+  693160,
+  693170,
+  693510,
+  693590,
+  693600,
+  693601,
+  693602,
+  693603,
+  693604,
+  693605,
+  693606,
+  693607,
+  693608,
+  693609,
+  693610,
+  693611,
+  693612,
+  693613,
+  693614,
+  693615,
+  693616,
+  693617,
+  693618,
+  693619,
+  693620,
+  693621,
+  693622,
+  693623,
+  693624,
+  693625,
+  693626,
+  693627,
+  693628,
+  693629,
+  693630,
+  693631,
+  693632,
+  693633,
+  693634,
+  693635,
+  693636,
+  693637,
+  693638,
+  693639,
+  693641,
+  693642,
+  693643,
+  693644,
+  693760,
+  693910,
+  693990,
+  694050,
+  694080,
+  694190,
+  694200,
+  694210,
+  694270,
+  694300,
+  694330,
+  694380,
+  694390,
+  694510,
+  694590,
+  694700,
+  694780,
+  694800,
+  694820,
+  694880,
+  694940,
+  695000,
+  695080,
+  695370,
+  695371,
+  695380,
+  695410,
+  695500,
+  695530,
+  695580,
+  695670,
+  695671,
+  695680,
+  695700,
+  695740,
+  695741,
+  695742,
+  695743,
+  695820,
+  695860,
+  695870,
+  696030,
+  696120,
+  696210,
+  696211,
+  696230,
+  696240,
+  696300,
+  696331,
+  696340,
+  696350,
+  696570,
+  696620,
+  696640,
+  696670,
+  696680,
+  696750,
+  696830,
+  696890,
+  696891,
+  696892,
+  697180,
+  697210,
+  697290,
+  697291,
+  697292,
+  697293,
+  697300,
+  697301,
+  697350,
+  697380,
+  697400,
+  697410,
+  697420,
+  697480,
+  697510,
+  697520,
+  697560,
+  697570,
+  697620,
+  697760,
+  697770,
+  697840,
+  697860,
+  697920,
+  698060,
+  698090,
+  698130,
+  698140,
+  698180,
+  698190,
+  698200,
+  698201,
+  698202,
+  698203,
+  698204,
+  698205,
+  698206,
+  698207,
+  698208,
+  698209,
+  698210,
+  698211,
+  698212,
+  698213,
+  698214,
+  698215,
+  698216,
+  698217,
+  698218,
+  698219,
+  698220,
+  698221,
+  698222,
+  698223,
+  698224,
+  698225,
+  698226,
+  698240,
+  698250,
+  698280,
+  698350,
+  698351,
+  698352,
+  698353,
+  698354,
+  698355,
+  698356,
+  698357,
+  698358,
+  698359,
+  698390,
+  698430,
+  698440,
+  698470,
+  698510,
+  698560,
+  698690,
+  698760,
+  698810,
+  698840,
+  698890,
+  698940,
+  699000,
+  699060,
+  699070,
+  699090,
+  699200,
+  699250,
+  699290,
+  699350,
+  699380,
+  699520,
+  699730,
+  700010,
+  700020,
+  700040,
+  700041,
+  700042,
+  700043,
+  700044,
+  700045,
+  700046,
+  700047,
+  700048,
+  700080,
+  700081,
+  700082,
+  700083,
+  700084,
+  700085,
+  700086,
+  700087,
+  700180,
+  700230,
+  700280,
+  700282,
+  700290,
+  700300,
+  700320,
+  700350,
+  700390,
+  700420,
+  700430,
+  700670,
+  700680,
+  700690,
+  700700,
+  700710,
+  700800,
+  700850,
+  700851,
+  700860,
+  700870,
+  700900,
+  700930,
+  700950,
+  700980,
+  701060,
+  701180,
+  701230,
+  701270,
+  701310,
+  701311,
+  701312,
+  701320,
+  701490,
+  701531,
+  701590,
+  701690,
+  701700,
+  701710,
+  701840,
+  701980,
+  702040,
+  702100,
+  702230,
+  702240,
+  702250,
+  702330,
+  702350,
+  702410,
+  702411,
+  702412,
+  702413,
+  702414,
+  702415,
+  702530,
+  702540,
+  702560,
+  702561,
+  702660,
+  702750,
+  702800,
+  702840,
+  702850,
+  702950,
+  702960,
+  702961,
+  702962,
+  702963,
+  702964,
+  702965,
+  702967,
+  702968,
+  702980,
+  702990,
+  703060,
+  703160,
+  703170,
+  703300,
+  703350,
+  703420,
+  703440,
+  703441,
+  703460,
+  703461,
+  703470,
+  703471,
+  703480,
+  703560,
+  703640,
+  703671,
+  703770,
+  703930,
+  704080,
+  704100,
+  704130,
+  704150,
+  704160,
+  704180,
+  704250,
+  704260,
+  704280,
+  704281,
+  704282,
+  704283,
+  704285,
+  704286,
+  704287,
+  704288,
+  704289,
+  704320,
+  704321,
+  704322,
+  704325,
+  704326,
+  704327,
+  704328,
+  704340,
+  704390,
+  704410,
+  704540,
+  704600,
+  704610,
+  704620,
+  704630,
+  704710,
+  704730,
+  704740,
+  704770,
+  704810,
+  704900,
+  704930,
+  704980,
+  705080,
+  705160,
+  705200,
+  705460,
+  705520,
+  705540,
+  705560,
+  705720,
+  705790,
+  705830,
+  705850,
+  705880,
+  705950,
+  705990,
+  706000,
+  706060,
+  706070,
+  706080,
+  706090,
+  706100,
+  706110,
+  706120,
+  706121,
+  706122,
+  706140,
+  706150,
+  706180,
+  706230,
+  706260,
+  706261,
+  706262,
+  706290,
+  706450,
+  706580,
+  706590,
+  706600,
+  706650,
+  706700,
+  706770,
+  706780,
+  706800,
+  706870,
+  706910,
+  706930,
+  706970,
+  707070,
+  707080,
+  707090,
+  707100,
+  707120,
+  707160,
+  707170,
+  707172,
+  707173,
+  707174,
+  707175,
+  707176,
+  707177,
+  707178,
+  707179,
+  707180,
+  707181,
+  707182,
+  707183,
+  707184,
+  707185,
+  707186,
+  707187,
+  707188,
+  707189,
+  707190,
+  707191,
+  707192,
+  707193,
+  707194,
+  707195,
+  707240,
+  707280,
+  707330,
+  707340,
+  707360,
+  707390,
+  707410,
+  707480,
+  707490,
+  707620,
+  707670,
+  707690,
+  707730,
+  707740,
+  707820,
+  707890,
+  708120,
+  708170,
+  708171,
+  708172,
+  708173,
+  708180,
+  708270,
+  708490,
+  708500,
+  708520,
+  708521,
+  708522,
+  708523,
+  708530,
+  708620,
+  708621,
+  708622,
+  708650,
+  708770,
+  708880,
+  708900,
+  709060,
+  709090,
+  709130,
+  709150,
+  709170,
+  709171,
+  709172,
+  709173,
+  709174,
+  709175,
+  709210,
+  709300,
+  709500,
+  709580,
+  709600,
+  709650,
+  709680,
+  709690,
+  709830,
+  709831,
+  709930,
+  709960,
+  709980,
+  709990,
+  710000,
+  710010,
+  710040,
+  710050,
+  710060,
+  710180,
+  710300,
+  710350,
+  710360,
+  710410,
+  710430,
+  710490,
+  710500,
+  710530,
+  710560,
+  710580,
+  710730,
+  710790,
+  710800,
+  710830,
+  711020,
+  711021,
+  711022,
+  711023,
+  711030,
+  711040,
+  711064,
+  711170,
+  711171,
+  711172,
+  711220,
+  711270,
+  711280,
+  711490,
+  711510,
+  711580,
+  711680,
+  711681,
+  711730,
+  711731,
+  711732,
+  711733,
+  711734,
+  711735,
+  711736,
+  711737,
+  711738,
+  711739,
+  711740,
+  711741,
+  711742,
+  711743,
+  711744,
+  711745,
+  711746,
+  711850,
+  711860,
+  711940,
+  711950,
+  711960,
+  712130,
+  712160,
+  712200,
+  712201,
+  712251,
+  712270,
+  712330,
+  712340,
+  712350,
+  712420,
+  712550,
+  712590,
+  712630,
+  712640,
+  712720,
+  712860,
+  712900,
+  712920,
+  713110,
+  713130,
+  713150,
+  713240,
+  713270,
+  713280,
+  713560,
+  713630,
+  713690,
+  713700,
+  713770,
+  713900,
+  713960,
+  713970,
+  714030,
+  714100,
+  714170,
+  714230,
+  714270,
+  714320,
+  714330,
+  714331,
+  714332,
+  714333,
+  714334,
+  714335,
+  714336,
+  714337,
+  714380,
+  714600,
+  714660,
+  714710,
+  714720,
+  714740,
+  714760,
+  714810,
+  714830,
+  714831,
+  714850,
+  714860,
+  714861,
+  714960,
+  714990,
+  715070,
+  715080,
+  715110,
+  715150,
+  715180,
+  715190,
+  715191,
+  715192,
+  715193,
+  715194,
+  715260,
+  715390,
+  715420,
+  715480,
+  715540,
+  715670,
+  715740,
+  715770,
+  715780,
+  715850,
+  715860,
+  715870,
+  715890,
+  715900,
+  715910,
+  715920,
+  715940,
+  715950,
+  715970,
+  716020,
+  716080,
+  716081,
+  716082,
+  716140,
+  716220,
+  716270,
+  716440,
+  716450,
+  716470,
+  716510,
+  716540,
+  716580,
+  716660,
+  716670,
+  716690,
+  716691,
+  716790,
+  716840,
+  716910,
+  716930,
+  716960,
+  716970,
+  716980,
+  716990,
+  717030,
+  717031,
+  717032,
+  717080,
+  717090,
+  717100,
+  717130,
+  717160,
+  717180,
+  717210,
+  717250,
+  717260,
+  717340,
+  717430,
+  717490,
+  717530,
+  717550,
+  717570,
+  717580,
+  717590,
+  717600,
+  717620,
+  717630,
+  717650,
+  717900,
+  718100,
+  718130,
+  718150,
+  718230,
+  718290,
+  718390,
+  718420,
+  718460,
+  718480,
+  718520,
+  718570,
+  718600,
+  718610,
+  718630,
+  718690,
+  718700,
+  718800,
+  719000,
+  719010,
+  719150,
+  719260,
+  719270,
+  719330,
+  719530,
+  719670,
+  719710,
+  719790,
+  719900,
+  719920,
+  719940,
+  719950,
+  719980,
+  719990,
+  720110,
+  720130,
+  720170,
+  720330,
+  720340,
+  720370,
+  720400,
+  720440,
+  720450,
+  720460,
+  720530,
+  720680,
+  720690,
+  720700,
+  720710,
+  720720,
+  720740,
+  720750,
+  720760,
+  720770,
+  720780,
+  720790,
+  720800,
+  720810,
+  720860,
+  720900,
+  720930,
+  720960,
+  721050,
+  721051,
+  721052,
+  721053,
+  721054,
+  721060,
+  721090,
+  721100,
+  721101,
+  721102,
+  721103,
+  721104,
+  721105,
+  721106,
+  721107,
+  721108,
+  721109,
+  721110,
+  721111,
+  721112,
+  721113,
+  721114,
+  721115,
+  721116,
+  721117,
+  721118,
+  721119,
+  721130,
+  721131,
+  721132,
+  721133,
+  721140,
+  721141,
+  721142,
+  721143,
+  721144,
+  721145,
+  721146,
+  721147,
+  721148,
+  721149,
+  721150,
+  721151,
+  721260,
+  721270,
+  721280,
+  721290,
+  721320,
+  721340,
+  721341,
+  721410,
+  721620,
+  721710,
+  721711,
+  721750,
+  721870,
+  721880,
+  721980,
+  722090,
+  722120,
+  722130,
+  722270,
+  722300,
+  722310,
+  722360,
+  722361,
+  722362,
+  722530,
+  722550,
+  722690,
+  722710,
+  722720,
+  722740,
+  722770,
+  722800,
+  722820,
+  722850,
+  722851,
+  722880,
+  722881,
+  722900,
+  722930,
+  722950,
+  723000,
+  723040,
+  723080,
+  723170,
+  723200,
+  723240,
+  723250,
+  723260,
+  723280,
+  723320,
+  723340,
+  723430,
+  723440,
+  723460,
+  723470,
+  723490,
+  723520,
+  723530,
+  723620,
+  723650,
+  723700,
+  723770,
+  723800,
+  723870,
+  724020,
+  724060,
+  724070,
+  724100,
+  724400,
+  724410,
+  724420,
+  724440,
+  724460,
+  724590,
+  724650,
+  724700,
+  724720,
+  724840,
+  725000,
+  725030,
+  725260,
+  725350,
+  725351,
+  725352,
+  725353,
+  725420,
+  725610,
+  725880,
+  726050,
+  726140,
+  726180,
+  726190,
+  726290,
+  726370,
+  726380,
+  726410,
+  726480,
+  726560,
+  726660,
+  726690,
+  726700,
+  726850,
+  727030,
+  727050,
+  727080,
+  727400,
+  727440,
+  727630,
+  727650,
+  727670,
+  727810,
+  727820,
+  727870,
+  727880,
+  727890,
+  727940,
+  727980,
+  727990,
+  728000,
+  728030,
+  728032,
+  728060,
+  728180,
+  728300,
+  728301,
+  728302,
+  728460,
+  728461,
+  728462,
+  728463,
+  728470,
+  728550,
+  728600,
+  728640,
+  728700,
+  728780,
+  728781,
+  728810,
+  728850,
+  728910,
+  728920,
+  728930,
+  728970,
+  728980,
+  729020,
+  729160,
+  729200,
+  729230,
+  729240,
+  729250,
+  729260,
+  729360,
+  729410,
+  729420,
+  729440,
+  729450,
+  729490,
+  729500,
+  729540,
+  729560,
+  729590,
+  729600,
+  729620,
+  729630,
+  729690,
+  729730,
+  729760,
+  729770,
+  729771,
+  729800,
+  729850,
+  729880,
+  729890,
+  729900,
+  730000,
+  730040,
+  730070,
+  730080,
+  730140,
+  730150,
+  730200,
+  730210,
+  730260,
+  730261,
+  730262,
+  730340,
+  730350,
+  730360,
+  730470,
+  730480,
+  730490,
+  730500,
+  730510,
+  730520,
+  730530,
+  730550,
+  730570,
+  730611,
+  730612,
+  730613,
+  730614,
+  730615,
+  730616,
+  730617,
+  730618,
+  730619,
+  730630,
+  730631,
+  730632,
+  730720,
+  730750,
+  730770,
+  730810,
+  730850,
+  730900,
+  730901,
+  730902,
+  730903,
+  730904,
+  730905,
+  730960,
+  731000,
+  731010,
+  731020,
+  731030,
+  731080,
+  731090,
+  731100,
+  731101,
+  731110,
+  731130,
+  731140,
+  731150,
+  731160,
+  731170,
+  731171,
+  731172,
+  731210,
+  731220,
+  731240,
+  731390,
+  731460,
+  731540,
+  731570,
+  731610,
+  731630,
+  731750,
+  731780,
+  731810,
+  731850,
+  731900,
+  731901,
+  731902,
+  731903,
+  731904,
+  731960,
+  731970,
+  731980,
+  732100,
+  732120,
+  732170,
+  732180,
+  732190,
+  732200,
+  732220,
+  732230,
+  732270,
+  732280,
+  732380,
+  732381,
+  732410,
+  732460,
+  732500,
+  732560,
+  732570,
+  732580,
+  732590,
+  732600,
+  732610,
+  732620,
+  732630,
+  732640,
+  732650,
+  732700,
+  732710,
+  732760,
+  732790,
+  732791,
+  732860,
+  732890,
+  732960,
+  733080,
+  733100,
+  733140,
+  733170,
+  733200,
+  733220,
+  733390,
+  733391,
+  733400,
+  733490,
+  733640,
+  733700,
+  733880,
+  733960,
+  733970,
+  734070,
+  734230,
+  734280,
+  734281,
+  734282,
+  734283,
+  734400,
+  734430,
+  734460,
+  734461,
+  734462,
+  734500,
+  734710,
+  734740,
+  734770,
+  734790,
+  734810,
+  734830,
+  734860,
+  734861,
+  734862,
+  734863,
+  734864,
+  734865,
+  734866,
+  734867,
+  734868,
+  734869,
+  734880,
+  735000,
+  735050,
+  735070,
+  735080,
+  735090,
+  735100,
+  735120,
+  735130,
+  735140,
+  735150,
+  735160,
+  735170,
+  735180,
+  735190,
+  735200,
+  735210,
+  735220,
+  735230,
+  735270,
+  735300,
+  735330,
+  735360,
+  735370,
+  735420,
+  735433,
+  735470,
+  735480,
+  735510,
+  735630,
+  735640,
+  735730,
+  736090,
+  736100,
+  736210,
+  736280,
+  736320,
+  736330,
+  736370,
+  736450,
+  736530,
+  736550,
+  736580,
+  736620,
+  736630,
+  736640,
+  736650,
+  736660,
+  736670,
+  736680,
+  736690,
+  736700,
+  736750,
+  736770,
+  736790,
+  736800,
+  736940,
+  736941,
+  736942,
+  736990,
+  737000,
+  737001,
+  737002,
+  737040,
+  737120,
+  737250,
+  737270,
+  737272,
+  737320,
+  737350,
+  737400,
+  737550,
+  737560,
+  737590,
+  737740,
+  737760,
+  737780,
+  737790,
+  737820,
+  737850,
+  737860,
+  737990,
+  738050,
+  738100,
+  738110,
+  738140,
+  738240,
+  738250,
+  738310,
+  738320,
+  738570,
+  738630,
+  738680,
+  738710,
+  738711,
+  738800,
+  738810,
+  738830,
+  738850,
+  738870,
+  738940,
+  738960,
+  738980,
+  739120,
+  739160,
+  739250,
+  739251,
+  739253,
+  739255,
+  739256,
+  739280,
+  739281,
+  739282,
+  739460,
+  739581,
+  739590,
+  739620,
+  739640,
+  739700,
+  739830,
+  739831,
+  739900,
+  740020,
+  740050,
+  740140,
+  740141,
+  740142,
+  740143,
+  740160,
+  740370,
+  740510,
+  740590,
+  740591,
+  740592,
+  740630,
+  740640,
+  740650,
+  740660,
+  740700,
+  740710,
+  740800,
+  740920,
+  740930,
+  740960,
+  741020,
+  741030,
+  741090,
+  741130,
+  741150,
+  741160,
+  741170,
+  741180,
+  741200,
+  741280,
+  741281,
+  741282,
+  741283,
+  741284,
+  741310,
+  741311,
+  741312,
+  741313,
+  741314,
+  741350,
+  741370,
+  741380,
+  741420,
+  741440,
+  741470,
+  741540,
+  741660,
+  741710,
+  741711,
+  741760,
+  741780,
+  742020,
+  742021,
+  742060,
+  742090,
+  742240,
+  742270,
+  742280,
+  742310,
+  742320,
+  742330,
+  742350,
+  742410,
+  742430,
+  742650,
+  742660,
+  742670,
+  742680,
+  742690,
+  742710,
+  742720,
+  742730,
+  742770,
+  742780,
+  742790,
+  742810,
+  742820,
+  742830,
+  742890,
+  742891,
+  742892,
+  743120,
+  743160,
+  743270,
+  743280,
+  743290,
+  743520,
+  743610,
+  743620,
+  743630,
+  743631,
+  743632,
+  743790,
+  743810,
+  743880,
+  743930,
+  743980,
+  744100,
+  744150,
+  744310,
+  744340,
+  744380,
+  744570,
+  744580,
+  744640,
+  744680,
+  744740,
+  744830,
+  744831,
+  744832,
+  744833,
+  744834,
+  744835,
+  744836,
+  744837,
+  744840,
+  744841,
+  744850,
+  744851,
+  744870,
+  744871,
+  744872,
+  744920,
+  744930,
+  744950,
+  744990,
+  745150,
+  745160,
+  745230,
+  745240,
+  745320,
+  745440,
+  745580,
+  745610,
+  745640,
+  745770,
+  745800,
+  745801,
+  745802,
+  745910,
+  745911,
+  745912,
+  746060,
+  746080,
+  746130,
+  746180,
+  746190,
+  746191,
+  746192,
+  746193,
+  746200,
+  746230,
+  746390,
+  746450,
+  746460,
+  746470,
+  746700,
+  746730,
+  746731,
+  746820,
+  746870,
+  746960,
+  746980,
+  747020,
+  747030,
+  747040,
+  747060,
+  747140,
+  747180,
+  747290,
+  747410,
+  747420,
+  747430,
+  747520,
+  747600,
+  747670,
+  747720,
+  747721,
+  747740,
+  747741,
+  747742,
+  747800,
+  747860,
+  747861,
+  747862,
+  747863,
+  747900,
+  747940,
+  747950,
+  747961,
+  748030,
+  748070,
+  748080,
+  748090,
+  748100,
+  748101,
+  748102,
+  748140,
+  748210,
+  748260,
+  748280,
+  748290,
+  748291,
+  748340,
+  748341,
+  748350,
+  748470,
+  748471,
+  748472,
+  748473,
+  748500,
+  748680,
+  748700,
+  748790,
+  748840,
+  748850,
+  749060,
+  749070,
+  749170,
+  749190,
+  749230,
+  749240,
+  749241,
+  749242,
+  749280,
+  749450,
+  749590,
+  749610,
+  749620,
+  749660,
+  749790,
+  749810,
+  749930,
+  750000,
+  750030,
+  750031,
+  750060,
+  750120,
+  750140,
+  750150,
+  750151,
+  750230,
+  750280,
+  750300,
+  750310,
+  750320,
+  750340,
+  750341,
+  750342,
+  750370,
+  750380,
+  750381,
+  750390,
+  750430,
+  750490,
+  750491,
+  750492,
+  750630,
+  750640,
+  750840,
+  750880,
+  750910,
+  750911,
+  750912,
+  750980,
+  751030,
+  751120,
+  751140,
+  751160,
+  751170,
+  751310,
+  751390,
+  751520,
+  751700,
+  751701,
+  751702,
+  751720,
+  751800,
+  751830,
+  751831,
+  751832,
+  751840,
+  751850,
+  751880,
+  751890,
+  751960,
+  752110,
+  752230,
+  752250,
+  752350,
+  752440,
+  752450,
+  752510,
+  752540,
+  752630,
+  752650,
+  752870,
+  752970,
+  752990,
+  753000,
+  753001,
+  753002,
+  753003,
+  753004,
+  753040,
+  753120,
+  753200,
+  753280,
+  753281,
+  753282,
+  753283,
+  753284,
+  753285,
+  753286,
+  753287,
+  753290,
+  753291,
+  753292,
+  753293,
+  753450,
+  753460,
+  753470,
+  753480,
+  753500,
+  753510,
+  753520,
+  753530,
+  753700,
+  753710,
+  753740,
+  753741,
+  753742,
+  753743,
+  753744,
+  753745,
+  753746,
+  753747,
+  753748,
+  753749,
+  753750,
+  753751,
+  753752,
+  753753,
+  753754,
+  753755,
+  753756,
+  753757,
+  753758,
+  753759,
+  753760,
+  753761,
+  753762,
+  753763,
+  753764,
+  753765,
+  753766,
+  753767,
+  753768,
+  753769,
+  753770,
+  753771,
+  753772,
+  753773,
+  753774,
+  753775,
+  753776,
+  753777,
+  753778,
+  753779,
+  753780,
+  753781,
+  753782,
+  753783,
+  753784,
+  753785,
+  753786,
+  753787,
+  753788,
+  753789,
+  753790,
+  753791,
+  753792,
+  753793,
+  753794,
+  753795,
+  753796,
+  753797,
+  753798,
+  753799,
+  753800,
+  753801,
+  753802,
+  753803,
+  753804,
+  753805,
+  753806,
+  753807,
+  753808,
+  753809,
+  753810,
+  753811,
+  753812,
+  753813,
+  753814,
+  753815,
+  753816,
+  753817,
+  753818,
+  753819,
+  753820,
+  753821,
+  753822,
+  753823,
+  753824,
+  753825,
+  753826,
+  753827,
+  753828,
+  753829,
+  753830,
+  753831,
+  753832,
+  753833,
+  753834,
+  753835,
+  753836,
+  753842,
+  753843,
+  753844,
+  753845,
+  753846,
+  753847,
+  753848,
+  753849,
+  753850,
+  753851,
+  753852,
+  753853,
+  753854,
+  753855,
+  753856,
+  753857,
+  753858,
+  753859,
+  753860,
+  753861,
+  753862,
+  753863,
+  753864,
+  753865,
+  753866,
+  753867,
+  753868,
+  753869,
+  753870,
+  753871,
+  753872,
+  753873,
+  753874,
+  753875,
+  753876,
+  753877,
+  753878,
+  753879,
+  753880,
+  753881,
+  753882,
+  753883,
+  753884,
+  753885,
+  753886,
+  753887,
+  753888,
+  753889,
+  753890,
+  753891,
+  753892,
+  753893,
+  753894,
+  753895,
+  753896,
+  754010,
+  754070,
+  754100,
+  754200,
+  754210,
+  754290,
+  754360,
+  754370,
+  754470,
+  754490,
+  754550,
+  754590,
+  754600,
+  754630,
+  754650,
+  754660,
+  754670,
+  754680,
+  754700,
+  754770,
+  754790,
+  754820,
+  754860,
+  754880,
+  754900,
+  754920,
+  754921,
+  754922,
+  754923,
+  755070,
+  755071,
+  755072,
+  755073,
+  755100,
+  755160,
+  755170,
+  755180,
+  755190,
+  755260,
+  755270,
+  755290,
+  755310,
+  755320,
+  755370,
+  755430,
+  755480,
+  755540,
+  755620,
+  755700,
+  755710,
+  755730,
+  755740,
+  755741,
+  755742,
+  755743,
+  755744,
+  755750,
+  755751,
+  755752,
+  755753,
+  755754,
+  755755,
+  755756,
+  755757,
+  755860,
+  756010,
+  756060,
+  756070,
+  756071,
+  756080,
+  756120,
+  756121,
+  756130,
+  756140,
+  756180,
+  756181,
+  756280,
+  756430,
+  756431,
+  756432,
+  756540,
+  756580,
+  756610,
+  756611,
+  756620,
+  756660,
+  756690,
+  756720,
+  756721,
+  756722,
+  756723,
+  756724,
+  756725,
+  756726,
+  756727,
+  756728,
+  756729,
+  756730,
+  756731,
+  756750,
+  756760,
+  756770,
+  756950,
+  756951,
+  756952,
+  756953,
+  756954,
+  756955,
+  756990,
+  757000,
+  757020,
+  757070,
+  757120,
+  757280,
+  757410,
+  757510,
+  757520,
+  757750,
+  757760,
+  757790,
+  757800,
+  757890,
+  757920,
+  757960,
+  757980,
+  758040,
+  758130,
+  758160,
+  758290,
+  758380,
+  758390,
+  758420,
+  758450,
+  758540,
+  758550,
+  758670,
+  758720,
+  758770,
+  758771,
+  758772,
+  758774,
+  758780,
+  758810,
+  758910,
+  759100,
+  759101,
+  759102,
+  759103,
+  759104,
+  759110,
+  759130,
+  759140,
+  759170,
+  759230,
+  759280,
+  759310,
+  759330,
+  759350,
+  759390,
+  759450,
+  759451,
+  759452,
+  759453,
+  759454,
+  759455,
+  759480,
+  759490,
+  759580,
+  759581,
+  759590,
+  759600,
+  759680,
+  759681,
+  759760,
+  759810,
+  759820,
+  759930,
+  760020,
+  760070,
+  760130,
+  760180,
+  760200,
+  760270,
+  760280,
+  760340,
+  760420,
+  760480,
+  760520,
+  760540,
+  760570,
+  760571,
+  760572,
+  760573,
+  760610,
+  760710,
+  760720,
+  760730,
+  760840,
+  760841,
+  760842,
+  760843,
+  760844,
+  760940,
+  760970,
+  761080,
+  761210,
+  761230,
+  761231,
+  761250,
+  761260,
+  761270,
+  761470,
+  761590,
+  761591,
+  761592,
+  761593,
+  761594,
+  761595,
+  761596,
+  761597,
+  761598,
+  761599,
+  761690,
+  761820,
+  761821,
+  761822,
+  761823,
+  761900,
+  762060,
+  762070,
+  762090,
+  762140,
+  762170,
+  762171,
+  762174,
+  762176,
+  762177,
+  762178,
+  762179,
+  762290,
+  762300,
+  762310,
+  762320,
+  762330,
+  762340,
+  762350,
+  762390,
+  762600,
+  762640,
+  762660,
+  762770,
+  762880,
+  762910,
+  762911,
+  762912,
+  762913,
+  762914,
+  762915,
+  762916,
+  762918,
+  762919,
+  762970,
+  763160,
+  763280,
+  763330,
+  763370,
+  763390,
+  763450,
+  763530,
+  763590,
+  763670,
+  763690,
+  763691,
+  763692,
+  763693,
+  763694,
+  763695,
+  763696,
+  763697,
+  763698,
+  763699,
+  763720,
+  763780,
+  763820,
+  763860,
+  764000,
+  764020,
+  764070,
+  764260,
+  764270,
+  764320,
+  764330,
+  764331,
+  764340,
+  764350,
+  764380,
+  764440,
+  764460,
+  764600,
+  764660,
+  764661,
+  764750,
+  764860,
+  764940,
+  764950,
+  765050,
+  765190,
+  765280,
+  765340,
+  765420,
+  765430,
+  765440,
+  765500,
+  765600,
+  765670,
+  765750,
+  765830,
+  765930,
+  765960,
+  765970,
+  766030,
+  766100,
+  766101,
+  766102,
+  766110,
+  766300,
+  766310,
+  766350,
+  766440,
+  766441,
+  766442,
+  766443,
+  766444,
+  766445,
+  766446,
+  766447,
+  766448,
+  766449,
+  766450,
+  766470,
+  766471,
+  766472,
+  766520,
+  766521,
+  766550,
+  766580,
+  766610,
+  766611,
+  766710,
+  766711,
+  766712,
+  766770,
+  766790,
+  766870,
+  766960,
+  767190,
+  767210,
+  767220,
+  767230,
+  767240,
+  767260,
+  767380,
+  767510,
+  767530,
+  767570,
+  767580,
+  767650,
+  767670,
+  767810,
+  767890,
+  767990,
+  768010,
+  768050,
+  768100,
+  768120,
+  768210,
+  768220,
+  768240,
+  768340,
+  768380,
+  768390,
+  768500,
+  768530,
+  768560,
+  768561,
+  768562,
+  768600,
+  768620,
+  768690,
+  768700,
+  768701,
+  768702,
+  768703,
+  768710,
+  768730,
+  768830,
+  768850,
+  768851,
+  768852,
+  768853,
+  768854,
+  768855,
+  768856,
+  768910,
+  768920,
+  768950,
+  768970,
+  769010,
+  769090,
+  769130,
+  769140,
+  769180,
+  769350,
+  769570,
+  769610,
+  769670,
+  769710,
+  769740,
+  769750,
+  769760,
+  769770,
+  769780,
+  769790,
+  769800,
+  769810,
+  769820,
+  769830,
+  769850,
+  769990,
+  770000,
+  770030,
+  770060,
+  770061,
+  770130,
+  770310,
+  770330,
+  770340,
+  770420,
+  770450,
+  770480,
+  770550,
+  770580,
+  770581,
+  770590,
+  770610,
+  770620,
+  770670,
+  770730,
+  770780,
+  770950,
+  770951,
+  770970,
+  770972,
+  770973,
+  770974,
+  770975,
+  770976,
+  770977,
+  771020,
+  771110,
+  771200,
+  771270,
+  771290,
+  771300,
+  771390,
+  771490,
+  771560,
+  771640,
+  771720,
+  771730,
+  771750,
+  771780,
+  771830,
+  771890,
+  771900,
+  771940,
+  772010,
+  772150,
+  772280,
+  772400,
+  772630,
+  773040,
+  773080,
+  773110,
+  773210,
+  773280,
+  773290,
+  773300,
+  773320,
+  773450,
+  773470,
+  773471,
+  773472,
+  773500,
+  773600,
+  773690,
+  773760,
+  773761,
+  773762,
+  773763,
+  773765,
+  773800,
+  773801,
+  773802,
+  773803,
+  773804,
+  773805,
+  773806,
+  773971,
+  773991,
+  774011,
+  774041,
+  774061,
+  774071,
+  774081,
+  774111,
+  774231,
+  774251,
+  774271,
+  774272,
+  774273,
+  774274,
+  774275,
+  774276,
+  774277,
+  774278,
+  774279,
+  774301,
+  774341,
+  774342,
+  774431,
+  774521,
+  774581,
+  774611,
+  774621,
+  774631,
+  774641,
+  774721,
+  774731,
+  774751,
+  774752,
+  774753,
+  774754,
+  774755,
+  774756,
+  774757,
+  774758,
+  774759,
+  774760,
+  774761,
+  774771,
+  774821,
+  774822,
+  774823,
+  774841,
+  774871,
+  774931,
+  774961,
+  774971,
+  775031,
+  775210,
+  775260,
+  775280,
+  775290,
+  775300,
+  775350,
+  775351,
+  775380,
+  775390,
+  775410,
+  775480,
+  775550,
+  775600,
+  775630,
+  775670,
+  775820,
+  775880,
+  775881,
+  776120,
+  776180,
+  776300,
+  776420,
+  776460,
+  776470,
+  776471,
+  776472,
+  776473,
+  776474,
+  776475,
+  776476,
+  776477,
+  776478,
+  776479,
+  776480,
+  776520,
+  776530,
+  776560,
+  776570,
+  776640,
+  776650,
+  776700,
+  776701,
+  776710,
+  776711,
+  776800,
+  776840,
+  776850,
+  776920,
+  776950,
+  776980,
+  776990,
+  777030,
+  777080,
+  777110,
+  777120,
+  777180,
+  777230,
+  777290,
+  777450,
+  777700,
+  777890,
+  777920,
+  777940,
+  777960,
+  777980,
+  778020,
+  778060,
+  778090,
+  778100,
+  778160,
+  778190,
+  778210,
+  778430,
+  778480,
+  778530,
+  778710,
+  778790,
+  778880,
+  778881,
+  778890,
+  778970,
+  779010,
+  779120,
+  779180,
+  779210,
+  779260,
+  779280,
+  779350,
+  779370,
+  779400,
+  779401,
+  779512,
+  779520,
+  779530,
+  779660,
+  779720,
+  779810,
+  779880,
+  779890,
+  779891,
+  779892,
+  779893,
+  779894,
+  779895,
+  779896,
+  779897,
+  779898,
+  779899,
+  779930,
+  779931,
+  779932,
+  779933,
+  779934,
+  779935,
+  779936,
+  779937,
+  779938,
+  779939,
+  779940,
+  779960,
+  780100,
+  780140,
+  780180,
+  780240,
+  780340,
+  780460,
+  780550,
+  780560,
+  780561,
+  780600,
+  780610,
+  780660,
+  780770,
+  780830,
+  780960,
+  780980,
+  780990,
+  781010,
+  781020,
+  781060,
+  781070,
+  781190,
+  781340,
+  781400,
+  781410,
+  781510,
+  781530,
+  781531,
+  781532,
+  781540,
+  781541,
+  781542,
+  781730,
+  781770,
+  781850,
+  781870,
+  782090,
+  782110,
+  782230,
+  782270,
+  782310,
+  782470,
+  782560,
+  782580,
+  782600,
+  782620,
+  782680,
+  782770,
+  782780,
+  783030,
+  783040,
+  783070,
+  783110,
+  783150,
+  783280,
+  783370,
+  783380,
+  783390,
+  783391,
+  783392,
+  783500,
+  783501,
+  783502,
+  783503,
+  783504,
+  783505,
+  783506,
+  783507,
+  783508,
+  783530,
+  783540,
+  783541,
+  783542,
+  783543,
+  783544,
+  783545,
+  783546,
+  783580,
+  783620,
+  783670,
+  783690,
+  783710,
+  783750,
+  783800,
+  783870,
+  783880,
+  783910,
+  783930,
+  783990,
+  784070,
+  784120,
+  784160,
+  784330,
+  784700,
+  784710,
+  784730,
+  784750,
+  784760,
+  784770,
+  784780,
+  784790,
+  784800,
+  784810,
+  784820,
+  784860,
+  784870,
+  784880,
+  784900,
+  784930,
+  784990,
+  785060,
+  785080,
+  785120,
+  785160,
+  785170,
+  785190,
+  785210,
+  785220,
+  785230,
+  785300,
+  785440,
+  785490,
+  785810,
+  785820,
+  785900,
+  785910,
+  785990,
+  786010,
+  786030,
+  786031,
+  786160,
+  786320,
+  786460,
+  786520,
+  786530,
+  786600,
+  786660,
+  786760,
+  786780,
+  786810,
+  786830,
+  786870,
+  786890,
+  786920,
+  786930,
+  787000,
+  787020,
+  787030,
+  787080,
+  787280,
+  787340,
+  787380,
+  787500,
+  787560,
+  787600,
+  787610,
+  787630,
+  787670,
+  787671,
+  787680,
+  787681,
+  787682,
+  787770,
+  787870,
+  787890,
+  787910,
+  788060,
+  788160,
+  788170,
+  788220,
+  788230,
+  788231,
+  788400,
+  788430,
+  788440,
+  788450,
+  788451,
+  788452,
+  788453,
+  788454,
+  788455,
+  788580,
+  788620,
+  788860,
+  788940,
+  788950,
+  788980,
+  788981,
+  788982,
+  788983,
+  789020,
+  789030,
+  789031,
+  789032,
+  789040,
+  789041,
+  789070,
+  789080,
+  789140,
+  789170,
+  789230,
+  789390,
+  789391,
+  789392,
+  789393,
+  789460,
+  789530,
+  789560,
+  789640,
+  789650,
+  789790,
+  789800,
+  789801,
+  789810,
+  789811,
+  789870,
+  790000,
+  790010,
+  790011,
+  790090,
+  790150,
+  790180,
+  790200,
+  790280,
+  790320,
+  790420,
+  790520,
+  790530,
+  790720,
+  790730,
+  790770,
+  790830,
+  790831,
+  790832,
+  790900,
+  790923,
+  790924,
+  791040,
+  791070,
+  791110,
+  791120,
+  791130,
+  791230,
+  791310,
+  791360,
+  791420,
+  791440,
+  791450,
+  791460,
+  791480,
+  791530,
+  791531,
+  791532,
+  791533,
+  791580,
+  791660,
+  791670,
+  791680,
+  791710,
+  791730,
+  791830,
+  791831,
+  791870,
+  791871,
+  791872,
+  791890,
+  791980,
+  792110,
+  792140,
+  792150,
+  792330,
+  792331,
+  792332,
+  792360,
+  792420,
+  792440,
+  792490,
+  792510,
+  792520,
+  792550,
+  792620,
+  792630,
+  792890,
+  792980,
+  793020,
+  793040,
+  793070,
+  793090,
+  793091,
+  793190,
+  793270,
+  793290,
+  793330,
+  793340,
+  793390,
+  793470,
+  793530,
+  793531,
+  793532,
+  793533,
+  793534,
+  793535,
+  793536,
+  793537,
+  793538,
+  793539,
+  793540,
+  793541,
+  793542,
+  793543,
+  793544,
+  793545,
+  793546,
+  793547,
+  793548,
+  793549,
+  793550,
+  793551,
+  793552,
+  793553,
+  793554,
+  793555,
+  793610,
+  793650,
+  793730,
+  793750,
+  793751,
+  793770,
+  793771,
+  793840,
+  793860,
+  793861,
+  793870,
+  793910,
+  794000,
+  794010,
+  794020,
+  794060,
+  794101,
+  794102,
+  794103,
+  794104,
+  794105,
+  794106,
+  794107,
+  794108,
+  794109,
+  794110,
+  794111,
+  794140,
+  794141,
+  794143,
+  794150,
+  794170,
+  794200,
+  794220,
+  794320,
+  794340,
+  794341,
+  794342,
+  794343,
+  794344,
+  794345,
+  794400,
+  794401,
+  794520,
+  794560,
+  794620,
+  794880,
+  794890,
+  794930,
+  794980,
+  795000,
+  795200,
+  795210,
+  795250,
+  795260,
+  795290,
+  795340,
+  795360,
+  795390,
+  795410,
+  795470,
+  795600,
+  795620,
+  795621,
+  795630,
+  795650,
+  795660,
+  795670,
+  795690,
+  795700,
+  795710,
+  795720,
+  795731,
+  795732,
+  795770,
+  795780,
+  795790,
+  795800,
+  795810,
+  795820,
+  795830,
+  795840,
+  795850,
+  795860,
+  795870,
+  795880,
+  795890,
+  795900,
+  795980,
+  796120,
+  796160,
+  796170,
+  796190,
+  796230,
+  796310,
+  796410,
+  796540,
+  796541,
+  796542,
+  796543,
+  796670,
+  796680,
+  796690,
+  796700,
+  796720,
+  796740,
+  796750,
+  796850,
+  797030,
+  797050,
+  797150,
+  797220,
+  797240,
+  797280,
+  797320,
+  797321,
+  797370,
+  797460,
+  797510,
+  797520,
+  797540,
+  797590,
+  797670,
+  797671,
+  797672,
+  797720,
+  797730,
+  797740,
+  797750,
+  797760,
+  797770,
+  797780,
+  797790,
+  797800,
+  797810,
+  797820,
+  797830,
+  797840,
+  797850,
+  797860,
+  797870,
+  797880,
+  797890,
+  797900,
+  797910,
+  797920,
+  797930,
+  797940,
+  797950,
+  797960,
+  797970,
+  797980,
+  797990,
+  798000,
+  798010,
+  798020,
+  798030,
+  798050,
+  798060,
+  798070,
+  798080,
+  798090,
+  798100,
+  798110,
+  798150,
+  798210,
+  798250,
+  798252,
+  798320,
+  798360,
+  798390,
+  798430,
+  798440,
+  798520,
+  798540,
+  798541,
+  798542,
+  798543,
+  798740,
+  798750,
+  798800,
+  798810,
+  798860,
+  798870,
+  798880,
+  798890,
+  798892,
+  798893,
+  798894,
+  798895,
+  798896,
+  798897,
+  798901,
+  798902,
+  798970,
+  798980,
+  798990,
+  799010,
+  799020,
+  799030,
+  799090,
+  799130,
+  799140,
+  799160,
+  799200,
+  799280,
+  799310,
+  799330,
+  799331,
+  799430,
+  799480,
+  799481,
+  799482,
+  799520,
+  799521,
+  799522,
+  799524,
+  799680,
+  799690,
+  799700,
+  799710,
+  799750,
+  799751,
+  799780,
+  799790,
+  799820,
+  799950,
+  800020,
+  800090,
+  800140,
+  800150,
+  800210,
+  800220,
+  800221,
+  800222,
+  800250,
+  800260,
+  800261,
+  800340,
+  800341,
+  800342,
+  800370,
+  800430,
+  800431,
+  800432,
+  800433,
+  800434,
+  800450,
+  800740,
+  800760,
+  800761,
+  800777,
+  800778,
+  800784,
+  800785,
+  800787,
+  800788,
+  800790,
+  800791,
+  800800,
+  800810,
+  800880,
+  800950,
+  800990,
+  800991,
+  800992,
+  800993,
+  801000,
+  801230,
+  801310,
+  801440,
+  801460,
+  801461,
+  801462,
+  801560,
+  801561,
+  801570,
+  801571,
+  801580,
+  801650,
+  801670,
+  801680,
+  801690,
+  801710,
+  801720,
+  801730,
+  801830,
+  801860,
+  801920,
+  801930,
+  801970,
+  801980,
+  802000,
+  802030,
+  802100,
+  802150,
+  802280,
+  802370,
+  802460,
+  802470,
+  802500,
+  802570,
+  802590,
+  802610,
+  802630,
+  802640,
+  802700,
+  802710,
+  802770,
+  802860,
+  802910,
+  802980,
+  803090,
+  803100,
+  803170,
+  803190,
+  803240,
+  803340,
+  803380,
+  803381,
+  803410,
+  803450,
+  803510,
+  803580,
+  803610,
+  803700,
+  804020,
+  804030,
+  804040,
+  804050,
+  804060,
+  804090,
+  804100,
+  804110,
+  804140,
+  804150,
+  804160,
+  804170,
+  804180,
+  804190,
+  804200,
+  804310,
+  804420,
+  804470,
+  804480,
+  804590,
+  804630,
+  804640,
+  804641,
+  804642,
+  804643,
+  804644,
+  804645,
+  804646,
+  804647,
+  804740,
+  804741,
+  804742,
+  804750,
+  804760,
+  804920,
+  804930,
+  804950,
+  804980,
+  805060,
+  805100,
+  805140,
+  805200,
+  805210,
+  805490,
+  805510,
+  805640,
+  805730,
+  805830,
+  805910,
+  805970,
+  806010,
+  806050,
+  806120,
+  806190,
+  806200,
+  806280,
+  806320,
+  806370,
+  806380,
+  806390,
+  806420,
+  806430,
+  806450,
+  806460,
+  806500,
+  806501,
+  806521,
+  806570,
+  806620,
+  806621,
+  806630,
+  806710,
+  806711,
+  806712,
+  806713,
+  806714,
+  806715,
+  806716,
+  806780,
+  806890,
+  806920,
+  807020,
+  807040,
+  807080,
+  807150,
+  807260,
+  807261,
+  807290,
+  807300,
+  807320,
+  807400,
+  807401,
+  807410,
+  807420,
+  807450,
+  807460,
+  807470,
+  807480,
+  807490,
+  807500,
+  807510,
+  807520,
+  807530,
+  807540,
+  807560,
+  807620,
+  807630,
+  807640,
+  807700,
+  807800,
+  807970,
+  808040,
+  808050,
+  808110,
+  808140,
+  808150,
+  808230,
+  808390,
+  808400,
+  808410,
+  808430,
+  808440,
+  808470,
+  808720,
+  808760,
+  808890,
+  808900,
+  808901,
+  808902,
+  808903,
+  808930,
+  808931,
+  808932,
+  808934,
+  808935,
+  808936,
+  808937,
+  808938,
+  808939,
+  808940,
+  808941,
+  809100,
+  809170,
+  809260,
+  809270,
+  809300,
+  809350,
+  809390,
+  809600,
+  809620,
+  809630,
+  809631,
+  809632,
+  809650,
+  809690,
+  809740,
+  809930,
+  809970,
+  809990,
+  810010,
+  810020,
+  810070,
+  810080,
+  810090,
+  810140,
+  810240,
+  810280,
+  810290,
+  810300,
+  810310,
+  810320,
+  810380,
+  810390,
+  810480,
+  810490,
+  810530,
+  810600,
+  810820,
+  810830,
+  810840,
+  810850,
+  810860,
+  810870,
+  810880,
+  810890,
+  810900,
+  810910,
+  810920,
+  810930,
+  810940,
+  810950,
+  810960,
+  810970,
+  810980,
+  810990,
+  811000,
+  811010,
+  811020,
+  811170,
+  811200,
+  811210,
+  811220,
+  811230,
+  811300,
+  811400,
+  811430,
+  811431,
+  811460,
+  811600,
+  811650,
+  811660,
+  811670,
+  811710,
+  811770,
+  811800,
+  811840,
+  812000,
+  812030,
+  812130,
+  812200,
+  812210,
+  812220,
+  812230,
+  812240,
+  812250,
+  812260,
+  812270,
+  812280,
+  812290,
+  812291,
+  812320,
+  812490,
+  812530,
+  812700,
+  812750,
+  812760,
+  812820,
+  812830,
+  812970,
+  813050,
+  813100,
+  813120,
+  813210,
+  813320,
+  813380,
+  813390,
+  813410,
+  813420,
+  813460,
+  813490,
+  813491,
+  813500,
+  813510,
+  813520,
+  813560,
+  813570,
+  813610,
+  813611,
+  813612,
+  813613,
+  813614,
+  813615,
+  813616,
+  813620,
+  813621,
+  813622,
+  813623,
+  813624,
+  813625,
+  813626,
+  813627,
+  813720,
+  813810,
+  813830,
+  813840,
+  813850,
+  813900,
+  814060,
+  814070,
+  814090,
+  814100,
+  814110,
+  814250,
+  814251,
+  814390,
+  814440,
+  814500,
+  814720,
+  814750,
+  814760,
+  814780,
+  815020,
+  815050,
+  815120,
+  815160,
+  815330,
+  815350,
+  815351,
+  815352,
+  815353,
+  815354,
+  815355,
+  815356,
+  815357,
+  815358,
+  815359,
+  815380,
+  815410,
+  815430,
+  815460,
+  815600,
+  815610,
+  815640,
+  815680,
+  815710,
+  815720,
+  815740,
+  815750,
+  815760,
+  815770,
+  815810,
+  815820,
+  816050,
+  816100,
+  816110,
+  816140,
+  816360,
+  816370,
+  816390,
+  816510,
+  816520,
+  816620,
+  816780,
+  816790,
+  816880,
+  816910,
+  816940,
+  816980,
+  816981,
+  816982,
+  817060,
+  817070,
+  817090,
+  817100,
+  817170,
+  817240,
+  817260,
+  817270,
+  817300,
+  817310,
+  817480,
+  817550,
+  817560,
+  817610,
+  817670,
+  817730,
+  817750,
+  817790,
+  817850,
+  817880,
+  817900,
+  817901,
+  817902,
+  817910,
+  818040,
+  818120,
+  818130,
+  818180,
+  818190,
+  818200,
+  818250,
+  818300,
+  818330,
+  818340,
+  818600,
+  818700,
+  818810,
+  818820,
+  818870,
+  818880,
+  818900,
+  818920,
+  818980,
+  818981,
+  818982,
+  819010,
+  819100,
+  819101,
+  819102,
+  819103,
+  819104,
+  819105,
+  819110,
+  819111,
+  819112,
+  819150,
+  819200,
+  819240,
+  819290,
+  819300,
+  819310,
+  819320,
+  819340,
+  819360,
+  819390,
+  819410,
+  819420,
+  819430,
+  819510,
+  819590,
+  819600,
+  819601,
+  819610,
+  819750,
+  819760,
+  819810,
+  819820,
+  819830,
+  819840,
+  819850,
+  819860,
+  820010,
+  820140,
+  820150,
+  820151,
+  820152,
+  820153,
+  820160,
+  820180,
+  820200,
+  820201,
+  820203,
+  820220,
+  820230,
+  820231,
+  820232,
+  820370,
+  820440,
+  820441,
+  820442,
+  820450,
+  820470,
+  820490,
+  820560,
+  820590,
+  820720,
+  820820,
+  820821,
+  820860,
+  820870,
+  820930,
+  820940,
+  820980,
+  820990,
+  821030,
+  821060,
+  821090,
+  821110,
+  821170,
+  821210,
+  821240,
+  821280,
+  821340,
+  821450,
+  821470,
+  821600,
+  821601,
+  821620,
+  821630,
+  821680,
+  821710,
+  821740,
+  821750,
+  821760,
+  821770,
+  821930,
+  821940,
+  821950,
+  821970,
+  821980,
+  821990,
+  822000,
+  822010,
+  822060,
+  822061,
+  822080,
+  822090,
+  822091,
+  822093,
+  822094,
+  822120,
+  822170,
+  822180,
+  822200,
+  822210,
+  822300,
+  822330,
+  822350,
+  822410,
+  822480,
+  822500,
+  822690,
+  822780,
+  822860,
+  823000,
+  823010,
+  823020,
+  823030,
+  823080,
+  823090,
+  823091,
+  823092,
+  823110,
+  823140,
+  823150,
+  823190,
+  823200,
+  823220,
+  823240,
+  823250,
+  823260,
+  823261,
+  823262,
+  823300,
+  823301,
+  823400,
+  823410,
+  823430,
+  823520,
+  823660,
+  823720,
+  823750,
+  823760,
+  823780,
+  823810,
+  823850,
+  823900,
+  823930,
+  823960,
+  823970,
+  823980,
+  823981,
+  823990,
+  824060,
+  824061,
+  824160,
+  824230,
+  824240,
+  824320,
+  824330,
+  824360,
+  824370,
+  824380,
+  824381,
+  824382,
+  824480,
+  824500,
+  824510,
+  824590,
+  824610,
+  824740,
+  824750,
+  824810,
+  824870,
+  824890,
+  825090,
+  825180,
+  825220,
+  825221,
+  825290,
+  825340,
+  825420,
+  825470,
+  825570,
+  825590,
+  825640,
+  825650,
+  825660,
+  825670,
+  825680,
+  825690,
+  825700,
+  825710,
+  826080,
+  826081,
+  826082,
+  826083,
+  826084,
+  826085,
+  826086,
+  826087,
+  826088,
+  826090,
+  826260,
+  826360,
+  826490,
+  826491,
+  826492,
+  826493,
+  826494,
+  826495,
+  826496,
+  826497,
+  826498,
+  826499,
+  826500,
+  826501,
+  826502,
+  826503,
+  826504,
+  826505,
+  826506,
+  826507,
+  826520,
+  826650,
+  827240,
+  827250,
+  827320,
+  827340,
+  827350,
+  827380,
+  827440,
+  827600,
+  827690,
+  827700,
+  827710,
+  827720,
+  827730,
+  827740,
+  827750,
+  827790,
+  827810,
+  827820,
+  827990,
+  828090,
+  828110,
+  828180,
+  828200,
+  828300,
+  828430,
+  828490,
+  828500,
+  828560,
+  828610,
+  828611,
+  828612,
+  828613,
+  828614,
+  828615,
+  828616,
+  828620,
+  828621,
+  828622,
+  828623,
+  828624,
+  828625,
+  828626,
+  828630,
+  828631,
+  828632,
+  828650,
+  828690,
+  828790,
+  828800,
+  828830,
+  828880,
+  828920,
+  829000,
+  829270,
+  829330,
+  829340,
+  829360,
+  829430,
+  829460,
+  829510,
+  829550,
+  829580,
+  829581,
+  829690,
+  829700,
+  829730,
+  829731,
+  829732,
+  829733,
+  829734,
+  829735,
+  829736,
+  829737,
+  829960,
+  830010,
+  830400,
+  830420,
+  830440,
+  830450,
+  830451,
+  830460,
+  830461,
+  830530,
+  830570,
+  830610,
+  830640,
+  830650,
+  830660,
+  830720,
+  830740,
+  830830,
+  830840,
+  830910,
+  830920,
+  830930,
+  830940,
+  830950,
+  831040,
+  831160,
+  831161,
+  831162,
+  831170,
+  831310,
+  831311,
+  831312,
+  831390,
+  831550,
+  831640,
+  831700,
+  831710,
+  831760,
+  831800,
+  831830,
+  831840,
+  831890,
+  831920,
+  832000,
+  832010,
+  832100,
+  832350,
+  832410,
+  832411,
+  832412,
+  832580,
+  832620,
+  832640,
+  832700,
+  832701,
+  832740,
+  832780,
+  832950,
+  833100,
+  833240,
+  833310,
+  833340,
+  833420,
+  833450,
+  833460,
+  833620,
+  833730,
+  833740,
+  833860,
+  834020,
+  834040,
+  834130,
+  834131,
+  834170,
+  834190,
+  834290,
+  834350,
+  834360,
+  834400,
+  834401,
+  834402,
+  834403,
+  834404,
+  834405,
+  834406,
+  834407,
+  834408,
+  834409,
+  834410,
+  834430,
+  834510,
+  835140,
+  835460,
+  835470,
+  835471,
+  835480,
+  835580,
+  835590,
+  835670,
+  835671,
+  835730,
+  835750,
+  835830,
+  836040,
+  836070,
+  836090,
+  836320,
+  836321,
+  836370,
+  836380,
+  836510,
+  836520,
+  836530,
+  836570,
+  836630,
+  836631,
+  836632,
+  836660,
+  836730,
+  836750,
+  836780,
+  836781,
+  836782,
+  836783,
+  836784,
+  836785,
+  836786,
+  836810,
+  836811,
+  836812,
+  836820,
+  836830,
+  836840,
+  836841,
+  836842,
+  836843,
+  836844,
+  836845,
+  836846,
+  836890,
+  836900,
+  836910,
+  836920,
+  836930,
+  837060,
+  837140,
+  837150,
+  837160,
+  837170,
+  837340,
+  837360,
+  837380,
+  837450,
+  837510,
+  837570,
+  837810,
+  837830,
+  837840,
+  837841,
+  837860,
+  837861,
+  837910,
+  837970,
+  837990,
+  838000,
+  838020,
+  838080,
+  838120,
+  838130,
+  838140,
+  838170,
+  838250,
+  838251,
+  838520,
+  838600,
+  838610,
+  838670,
+  838680,
+  838770,
+  838850,
+  838860,
+  838870,
+  838910,
+  838920,
+  838970,
+  839110,
+  839180,
+  839270,
+  839290,
+  839320,
+  839360,
+  839400,
+  839510,
+  839550,
+  839580,
+  839760,
+  839860,
+  839990,
+  840040,
+  840070,
+  840160,
+  840350,
+  840520,
+  840540,
+  840560,
+  840570,
+  840630,
+  840640,
+  840670,
+  840680,
+  840750,
+  840760,
+  840770,
+  840850,
+  840991,
+  841000,
+  841040,
+  841090,
+  841130,
+  841150,
+  841160,
+  841161,
+  841162,
+  841163,
+  841164,
+  841165,
+  841166,
+  841167,
+  841168,
+  841169,
+  841220,
+  841250,
+  841280,
+  841310,
+  841520,
+  841530,
+  841630,
+  841780,
+  841820,
+  841821,
+  841900,
+  841910,
+  842000,
+  842020,
+  842050,
+  842210,
+  842211,
+  842212,
+  842213,
+  842214,
+  842215,
+  842230,
+  842240,
+  842300,
+  842330,
+  842331,
+  842360,
+  842361,
+  842362,
+  842363,
+  842364,
+  842365,
+  842366,
+  842367,
+  842368,
+  842369,
+  842370,
+  842381,
+  842382,
+  842383,
+  842384,
+  842390,
+  842410,
+  842480,
+  842570,
+  842610,
+  842650,
+  842651,
+  842670,
+  842680,
+  842720,
+  842820,
+  842840,
+  842841,
+  842880,
+  842940,
+  842941,
+  842950,
+  842951,
+  842952,
+  842960,
+  842970,
+  843000,
+  843150,
+  843240,
+  843290,
+  843340,
+  843600,
+  843670,
+  843671,
+  843672,
+  843770,
+  843800,
+  843910,
+  844060,
+  844070,
+  844120,
+  844190,
+  844220,
+  844240,
+  844320,
+  844340,
+  844410,
+  844470,
+  844480,
+  844530,
+  844650,
+  844680,
+  844690,
+  844810,
+  844830,
+  844880,
+  844890,
+  845000,
+  845010,
+  845020,
+  845120,
+  845130,
+  845140,
+  845142,
+  845143,
+  845144,
+  845147,
+  845148,
+  845149,
+  845190,
+  845210,
+  845340,
+  845410,
+  845420,
+  845580,
+  845581,
+  845582,
+  845640,
+  845800,
+  845920,
+  845930,
+  845980,
+  846100,
+  846280,
+  846310,
+  846350,
+  846360,
+  846400,
+  846410,
+  846420,
+  846421,
+  846450,
+  846620,
+  846621,
+  846630,
+  846720,
+  846760,
+  846810,
+  846840,
+  846860,
+  847090,
+  847210,
+  847410,
+  847411,
+  847412,
+  847413,
+  847414,
+  847415,
+  847416,
+  847417,
+  847418,
+  847420,
+  847421,
+  847422,
+  847423,
+  847470,
+  847540,
+  847750,
+  847760,
+  847840,
+  847850,
+  847890,
+  847930,
+  847980,
+  847990,
+  848000,
+  848020,
+  848040,
+  848041,
+  848042,
+  848043,
+  848110,
+  848140,
+  848160,
+  848170,
+  848180,
+  848210,
+  848240,
+  848320,
+  848340,
+  848370,
+  848440,
+  848490,
+  848790,
+  848820,
+  848830,
+  848850,
+  848860,
+  848900,
+  848910,
+  848911,
+  848970,
+  848990,
+  848991,
+  849010,
+  849050,
+  849130,
+  849150,
+  849160,
+  849161,
+  849162,
+  849163,
+  849164,
+  849165,
+  849166,
+  849167,
+  849168,
+  849170,
+  849171,
+  849176,
+  849177,
+  849178,
+  849179,
+  849180,
+  849181,
+  849186,
+  849187,
+  849188,
+  849200,
+  849230,
+  849240,
+  849260,
+  849261,
+  849262,
+  849300,
+  849301,
+  849302,
+  849303,
+  849304,
+  849305,
+  849306,
+  849307,
+  849308,
+  849309,
+  849310,
+  849311,
+  849330,
+  849540,
+  849760,
+  849930,
+  849931,
+  849950,
+  850010,
+  850070,
+  850080,
+  850090,
+  850100,
+  850130,
+  850150,
+  850160,
+  850200,
+  850210,
+  850220,
+  850240,
+  850260,
+  850280,
+  850281,
+  850350,
+  850360,
+  850370,
+  850380,
+  850390,
+  850400,
+  850410,
+  850420,
+  850430,
+  850440,
+  850470,
+  850520,
+  850530,
+  850540,
+  850560,
+  850570,
+  850600,
+  850610,
+  850620,
+  850640,
+  850650,
+  850660,
+  850670,
+  850680,
+  850700,
+  850800,
+  850850,
+  850990,
+  851020,
+  851270,
+  851271,
+  851272,
+  851273,
+  851274,
+  851275,
+  851278,
+  851279,
+  851310,
+  851312,
+  851313,
+  851318,
+  851360,
+  851396,
+  851397,
+  851398,
+  851470,
+  851500,
+  851510,
+  851600,
+  851601,
+  851610,
+  851750,
+  851860,
+  851870,
+  851900,
+  851910,
+  851990,
+  852000,
+  852020,
+  852030,
+  852100,
+  852130,
+  852200,
+  852240,
+  852260,
+  852290,
+  852370,
+  852430,
+  852580,
+  852640,
+  852800,
+  852850,
+  852930,
+  852940,
+  852950,
+  852980,
+  852991,
+  852992,
+  852993,
+  852994,
+  852995,
+  852996,
+  853011,
+  853012,
+  853013,
+  853014,
+  853015,
+  853090,
+  853170,
+  853180,
+  853190,
+  853270,
+  853280,
+  853281,
+  853282,
+  853360,
+  853370,
+  853390,
+  853520,
+  853730,
+  853870,
+  853871,
+  853872,
+  853873,
+  853874,
+  853875,
+  853876,
+  853877,
+  853881,
+  853882,
+  853883,
+  853884,
+  853885,
+  853886,
+  853887,
+  854010,
+  854050,
+  854070,
+  854130,
+  854180,
+  854200,
+  854220,
+  854230,
+  854270,
+  854290,
+  854320,
+  854321,
+  854370,
+  854410,
+  854430,
+  854490,
+  854630,
+  854660,
+  854710,
+  854750,
+  854780,
+  854880,
+  854900,
+  854910,
+  854960,
+  854961,
+  854970,
+  854980,
+  855020,
+  855170,
+  855220,
+  855230,
+  855250,
+  855260,
+  855270,
+  855280,
+  855290,
+  855300,
+  855310,
+  855330,
+  855340,
+  855350,
+  855360,
+  855380,
+  855400,
+  855410,
+  855420,
+  855430,
+  855440,
+  855450,
+  855460,
+  855470,
+  855660,
+  855810,
+  855880,
+  855890,
+  855930,
+  856000,
+  856001,
+  856020,
+  856070,
+  856090,
+  856140,
+  856141,
+  856142,
+  856143,
+  856144,
+  856145,
+  856146,
+  856147,
+  856148,
+  856149,
+  856150,
+  856200,
+  856530,
+  856630,
+  856640,
+  856660,
+  856680,
+  856710,
+  856810,
+  856820,
+  856840,
+  856900,
+  856910,
+  856920,
+  856930,
+  856940,
+  856950,
+  856960,
+  856970,
+  856971,
+  856972,
+  857040,
+  857150,
+  857151,
+  857152,
+  857153,
+  857260,
+  857280,
+  857320,
+  857350,
+  857360,
+  857380,
+  857381,
+  857390,
+  857720,
+  857880,
+  857960,
+  857970,
+  858130,
+  858230,
+  858240,
+  858270,
+  858280,
+  858290,
+  858300,
+  858450,
+  858610,
+  858620,
+  858660,
+  858690,
+  858720,
+  858800,
+  858900,
+  858930,
+  858970,
+  858980,
+  859010,
+  859040,
+  859041,
+  859100,
+  859130,
+  859140,
+  859210,
+  859250,
+  859270,
+  859290,
+  859300,
+  859320,
+  859400,
+  859430,
+  859470,
+  859490,
+  859500,
+  859540,
+  859550,
+  859600,
+  859670,
+  860050,
+  860110,
+  860120,
+  860130,
+  860140,
+  860230,
+  860231,
+  860232,
+  860233,
+  860250,
+  860470,
+  860540,
+  860610,
+  860630,
+  860690,
+  860700,
+  860710,
+  860720,
+  860840,
+  860980,
+  860981,
+  861090,
+  861100,
+  861110,
+  861120,
+  861200,
+  861300,
+  861380,
+  861390,
+  861440,
+  861590,
+  861600,
+  861640,
+  861641,
+  861642,
+  861700,
+  861701,
+  861730,
+  861731,
+  861732,
+  861750,
+  861751,
+  861752,
+  861753,
+  861800,
+  861870,
+  861871,
+  861872,
+  861880,
+  861881,
+  861882,
+  861883,
+  861884,
+  861885,
+  861887,
+  861888,
+  861889,
+  861950,
+  861951,
+  861952,
+  861953,
+  861954,
+  861955,
+  862000,
+  862070,
+  862100,
+  862170,
+  862220,
+  862380,
+  862400,
+  862401,
+  862450,
+  862560,
+  862610,
+  862710,
+  862760,
+  862780,
+  862810,
+  862840,
+  862910,
+  862911,
+  862912,
+  862913,
+  862914,
+  862915,
+  862930,
+  862931,
+  862970,
+  863110,
+  863160,
+  863180,
+  863181,
+  863182,
+  863240,
+  863250,
+  863320,
+  863410,
+  863450,
+  863520,
+  863600,
+  863620,
+  863680,
+  863681,
+  863740,
+  863760,
+  863790,
+  863930,
+  863960,
+  864050,
+  864080,
+  864180,
+  864181,
+  864182,
+  864183,
+  864184,
+  864185,
+  864186,
+  864187,
+  864188,
+  864189,
+  864210,
+  864220,
+  864240,
+  864250,
+  864280,
+  864290,
+  864320,
+  864560,
+  864660,
+  864670,
+  864710,
+  864750,
+  864790,
+  864820,
+  864890,
+  864900,
+  864980,
+  865010,
+  865011,
+  865012,
+  865013,
+  865014,
+  865070,
+  865120,
+  865140,
+  865210,
+  865260,
+  865290,
+  865320,
+  865340,
+  865350,
+  865351,
+  865590,
+  865620,
+  865650,
+  865660,
+  865670,
+  865700,
+  865701,
+  865730,
+  865740,
+  865770,
+  865890,
+  865960,
+  865970,
+  866060,
+  866120,
+  866130,
+  866210,
+  866211,
+  866212,
+  866290,
+  866300,
+  866320,
+  866360,
+  866410,
+  866530,
+  866560,
+  866840,
+  866850,
+  866880,
+  866980,
+  866990,
+  867020,
+  867030,
+  867070,
+  867100,
+  867200,
+  867220,
+  867230,
+  867240,
+  867270,
+  867340,
+  867630,
+  867680,
+  867710,
+  867740,
+  867780,
+  867810,
+  867860,
+  867880,
+  867890,
+  867910,
+  867970,
+  867990,
+  868110,
+  868111,
+  868112,
+  868120,
+  868140,
+  868170,
+  868220,
+  868221,
+  868250,
+  868280,
+  868310,
+  868311,
+  868312,
+  868330,
+  868340,
+  868400,
+  868420,
+  868421,
+  868422,
+  868423,
+  868424,
+  868428,
+  868429,
+  868480,
+  868530,
+  868650,
+  868680,
+  868800,
+  868870,
+  868990,
+  869140,
+  869230,
+  869240,
+  869241,
+  869330,
+  869390,
+  869430,
+  869530,
+  869670,
+  869680,
+  869700,
+  869720,
+  869740,
+  869800,
+  869810,
+  869830,
+  869860,
+  869890,
+  869900,
+  869980,
+  870210,
+  870211,
+  870212,
+  870214,
+  870215,
+  870216,
+  870217,
+  870219,
+  870220,
+  870222,
+  870223,
+  870224,
+  870225,
+  870227,
+  870228,
+  870253,
+  870270,
+  870271,
+  870272,
+  870273,
+  870274,
+  870275,
+  870276,
+  870277,
+  870278,
+  870279,
+  870280,
+  870380,
+  870420,
+  870460,
+  870461,
+  870462,
+  870470,
+  870490,
+  870500,
+  870530,
+  870540,
+  870550,
+  870600,
+  870620,
+  870621,
+  870630,
+  870640,
+  870760,
+  870810,
+  870820,
+  870840,
+  870841,
+  870842,
+  870843,
+  870844,
+  870845,
+  870846,
+  870847,
+  870848,
+  870849,
+  870850,
+  870851,
+  870852,
+  870853,
+  870854,
+  870920,
+  870970,
+  871010,
+  871020,
+  871170,
+  871240,
+  871241,
+  871250,
+  871260,
+  871340,
+  871380,
+  871490,
+  871600,
+  871630,
+  871650,
+  871651,
+  871900,
+  871910,
+  872050,
+  872070,
+  872080,
+  872100,
+  872150,
+  872190,
+  872210,
+  872250,
+  872260,
+  872280,
+  872300,
+  872370,
+  872420,
+  872430,
+  872440,
+  872500,
+  872520,
+  872540,
+  872610,
+  872770,
+  872940,
+  872950,
+  873030,
+  873130,
+  873380,
+  873540,
+  873541,
+  873600,
+  873630,
+  873640,
+  873650,
+  873660,
+  873670,
+  873680,
+  873690,
+  873780,
+  873860,
+  873870,
+  873871,
+  873880,
+  873920,
+  874050,
+  874121,
+  874150,
+  874151,
+  874152,
+  874153,
+  874160,
+  874300,
+  874310,
+  874320,
+  874340,
+  874341,
+  874342,
+  874343,
+  874344,
+  874345,
+  874360,
+  874410,
+  874420,
+  874421,
+  874430,
+  874431,
+  874480,
+  874520,
+  874580,
+  874610,
+  874611,
+  874620,
+  874661,
+  874680,
+  874710,
+  874720,
+  874730,
+  874740,
+  874750,
+  874800,
+  874850,
+  874860,
+  874870,
+  874890,
+  874891,
+  874892,
+  874893,
+  874920,
+  875070,
+  875090,
+  875120,
+  875150,
+  875151,
+  875152,
+  875153,
+  875190,
+  875200,
+  875220,
+  875290,
+  875370,
+  875371,
+  875410,
+  875440,
+  875460,
+  875580,
+  875600,
+  875620,
+  875621,
+  875890,
+  875950,
+  875960,
+  875980,
+  875990,
+  876000,
+  876360,
+  876400,
+  876401,
+  876420,
+  876430,
+  876440,
+  876450,
+  876490,
+  876520,
+  876550,
+  876570,
+  876590,
+  876610,
+  876640,
+  876730,
+  876731,
+  876732,
+  876733,
+  876734,
+  876735,
+  876920,
+  876950,
+  876970,
+  876971,
+  876980,
+  877100,
+  877110,
+  877120,
+  877130,
+  877140,
+  877450,
+  877500,
+  877620,
+  877830,
+  877950,
+  878060,
+  878190,
+  878200,
+  878230,
+  878460,
+  878461,
+  878462,
+  878463,
+  878464,
+  878465,
+  878466,
+  878467,
+  878630,
+  878700,
+  878701,
+  878830,
+  878840,
+  878880,
+  878890,
+  878920,
+  879130,
+  879190,
+  879240,
+  879330,
+  879380,
+  879460,
+  879500,
+  879660,
+  879680,
+  879720,
+  879730,
+  879731,
+  879732,
+  879733,
+  879760,
+  879860,
+  879870,
+  880240,
+  880250,
+  880281,
+  880282,
+  880283,
+  880310,
+  880350,
+  880351,
+  880410,
+  880411,
+  880412,
+  880413,
+  880414,
+  880420,
+  880430,
+  880440,
+  880450,
+  880451,
+  880460,
+  880480,
+  880520,
+  880521,
+  880540,
+  880630,
+  880640,
+  880680,
+  880740,
+  880810,
+  880820,
+  880880,
+  880923,
+  880924,
+  881220,
+  881330,
+  881390,
+  881430,
+  881480,
+  881590,
+  881591,
+  881600,
+  881660,
+  881680,
+  881830,
+  881840,
+  881841,
+  881890,
+  881960,
+  882030,
+  882270,
+  882340,
+  882350,
+  882430,
+  882550,
+  882720,
+  882740,
+  882800,
+  882890,
+  883060,
+  883061,
+  883062,
+  883090,
+  883110,
+  883140,
+  883150,
+  883180,
+  883181,
+  883182,
+  883200,
+  883210,
+  883250,
+  883290,
+  883310,
+  883320,
+  883420,
+  883640,
+  883800,
+  883840,
+  883920,
+  883940,
+  884000,
+  884010,
+  884030,
+  884031,
+  884110,
+  884140,
+  884141,
+  884142,
+  884143,
+  884560,
+  884580,
+  884620,
+  884650,
+  884700,
+  884710,
+  884730,
+  884740,
+  884760,
+  884761,
+  884762,
+  884780,
+  884790,
+  884791,
+  884860,
+  884870,
+  884890,
+  884970,
+  885040,
+  885070,
+  885071,
+  885250,
+  885260,
+  885270,
+  885410,
+  885430,
+  885440,
+  885450,
+  885460,
+  885490,
+  885520,
+  885550,
+  885660,
+  885700,
+  885701,
+  885720,
+  885750,
+  885850,
+  885851,
+  885920,
+  885960,
+  886050,
+  886130,
+  886150,
+  886280,
+  886440,
+  886480,
+  886660,
+  886661,
+  886910,
+  886920,
+  886930,
+  887030,
+  887050,
+  887080,
+  887120,
+  887180,
+  887200,
+  887230,
+  887240,
+  887350,
+  887380,
+  887430,
+  887580,
+  887640,
+  887780,
+  887980,
+  888000,
+  888060,
+  888110,
+  888180,
+  888210,
+  888240,
+  888330,
+  888360,
+  888370,
+  888390,
+  888430,
+  888440,
+  888490,
+  888491,
+  888492,
+  888493,
+  888494,
+  888495,
+  888496,
+  888497,
+  888498,
+  888499,
+  888510,
+  888511,
+  888512,
+  888513,
+  888514,
+  888515,
+  888516,
+  888517,
+  888520,
+  888590,
+  888650,
+  888700,
+  888701,
+  888720,
+  888770,
+  888820,
+  888830,
+  888850,
+  888851,
+  888852,
+  888853,
+  888854,
+  888855,
+  888856,
+  888857,
+  888858,
+  888859,
+  888870,
+  888871,
+  888872,
+  889000,
+  889070,
+  889071,
+  889072,
+  889073,
+  889120,
+  889180,
+  889200,
+  889300,
+  889340,
+  889350,
+  889380,
+  889420,
+  889430,
+  889440,
+  889610,
+  889611,
+  889612,
+  889613,
+  889614,
+  889620,
+  889630,
+  889640,
+  889800,
+  889820,
+  889830,
+  889840,
+  889870,
+  889871,
+  889872,
+  889880,
+  889890,
+  889900,
+  889901,
+  889902,
+  889903,
+  889920,
+  889921,
+  889922,
+  889923,
+  890020,
+  890030,
+  890031,
+  890032,
+  890050,
+  890080,
+  890250,
+  890290,
+  890320,
+  890350,
+  890420,
+  890490,
+  890530,
+  890540,
+  890610,
+  890650,
+  890651,
+  890652,
+  890653,
+  890770,
+  890850,
+  890860,
+  890980,
+  891000,
+  891030,
+  891031,
+  891032,
+  891033,
+  891034,
+  891035,
+  891037,
+  891060,
+  891140,
+  891230,
+  891250,
+  891260,
+  891280,
+  891300,
+  891301,
+  891302,
+  891420,
+  891440,
+  891450,
+  891451,
+  891530,
+  891540,
+  891550,
+  891630,
+  891660,
+  891690,
+  891730,
+  891770,
+  891780,
+  891810,
+  891820,
+  891830,
+  891840,
+  891930,
+  891980,
+  892030,
+  892040,
+  892050,
+  892170,
+  892240,
+  892250,
+  892260,
+  892270,
+  892280,
+  892281,
+  892282,
+  892283,
+  892284,
+  892285,
+  892286,
+  892287,
+  892288,
+  892289,
+  892290,
+  892291,
+  892292,
+  892293,
+  892294,
+  892295,
+  892300,
+  892340,
+  892370,
+  892390,
+  892391,
+  892392,
+  892393,
+  892394,
+  892395,
+  892396,
+  892397,
+  892398,
+  892399,
+  892400,
+  892410,
+  892580,
+  892600,
+  892610,
+  892660,
+  892670,
+  892680,
+  892710,
+  892750,
+  892790,
+  892810,
+  892870,
+  892900,
+  892940,
+  892941,
+  892942,
+  893000,
+  893001,
+  893130,
+  893160,
+  893310,
+  893320,
+  893321,
+  893340,
+  893380,
+  893400,
+  893550,
+  893580,
+  893630,
+  893700,
+  893750,
+  893760,
+  893770,
+  893830,
+  893880,
+  893881,
+  893882,
+  893980,
+  893981,
+  893982,
+  893983,
+  893984,
+  894030,
+  894080,
+  894150,
+  894211,
+  894212,
+  894213,
+  894214,
+  894215,
+  894216,
+  894217,
+  894220,
+  894230,
+  894240,
+  894290,
+  894300,
+  894410,
+  894440,
+  894500,
+  894510,
+  894560,
+  894561,
+  894590,
+  894600,
+  894640,
+  894650,
+  894660,
+  894670,
+  894690,
+  894700,
+  894710,
+  894720,
+  894780,
+  894840,
+  894860,
+  894870,
+  894950,
+  894970,
+  895130,
+  895240,
+  895250,
+  895260,
+  895270,
+  895280,
+  895290,
+  895300,
+  895440,
+  895490,
+  895491,
+  895492,
+  895493,
+  895720,
+  895790,
+  895800,
+  895840,
+  895880,
+  895910,
+  896000,
+  896050,
+  896100,
+  896101,
+  896102,
+  896260,
+  896270,
+  896290,
+  896430,
+  896480,
+  896540,
+  896541,
+  896542,
+  896543,
+  896544,
+  896545,
+  896546,
+  896547,
+  896548,
+  896549,
+  896580,
+  896610,
+  896620,
+  896630,
+  896640,
+  896660,
+  896680,
+  896712,
+  896713,
+  896715,
+  896716,
+  896717,
+  896718,
+  896719,
+  896741,
+  896742,
+  896743,
+  896744,
+  896745,
+  896746,
+  896747,
+  896748,
+  896749,
+  896760,
+  896761,
+  896762,
+  896764,
+  896765,
+  896766,
+  896767,
+  896780,
+  896790,
+  896800,
+  896830,
+  896910,
+  896920,
+  896930,
+  897060,
+  897061,
+  897062,
+  897063,
+  897064,
+  897065,
+  897066,
+  897067,
+  897068,
+  897069,
+  897070,
+  897071,
+  897072,
+  897073,
+  897074,
+  897075,
+  897090,
+  897180,
+  897190,
+  897230,
+  897240,
+  897250,
+  897280,
+  897310,
+  897350,
+  897590,
+  897670,
+  897870,
+  898110,
+  898130,
+  898150,
+  898151,
+  898190,
+  898230,
+  898300,
+  898330,
+  898420,
+  898470,
+  898520,
+  898570,
+  898600,
+  898640,
+  898700,
+  898710,
+  898770,
+  898960,
+  898961,
+  898962,
+  898970,
+  898990,
+  899060,
+  899061,
+  899070,
+  899130,
+  899140,
+  899150,
+  899280,
+  899330,
+  899350,
+  899360,
+  899380,
+  899410,
+  899411,
+  899450,
+  899490,
+  899550,
+  899551,
+  899580,
+  899640,
+  899650,
+  899660,
+  899781,
+  899782,
+  899783,
+  899784,
+  899785,
+  899786,
+  899787,
+  899788,
+  899789,
+  899790,
+  899791,
+  899792,
+  899793,
+  899794,
+  899795,
+  899796,
+  899797,
+  899798,
+  899799,
+  899800,
+  899801,
+  899802,
+  899803,
+  899804,
+  899805,
+  899806,
+  899807,
+  899808,
+  899809,
+  899810,
+  899811,
+  899812,
+  899813,
+  899814,
+  899815,
+  899816,
+  899817,
+  899818,
+  899819,
+  899820,
+  899821,
+  899822,
+  899823,
+  899824,
+  899825,
+  899826,
+  899827,
+  899828,
+  899829,
+  899830,
+  899831,
+  899832,
+  899833,
+  899834,
+  899835,
+  899836,
+  899837,
+  899838,
+  899839,
+  899840,
+  899841,
+  899842,
+  899843,
+  899844,
+  899845,
+  899846,
+  899847,
+  899848,
+  899849,
+  899850,
+  899851,
+  899852,
+  899853,
+  899854,
+  899855,
+  899856,
+  899857,
+  899858,
+  899859,
+  899860,
+  899861,
+  899862,
+  899863,
+  899864,
+  899865,
+  899866,
+  899867,
+  899868,
+  899869,
+  899870,
+  899871,
+  899872,
+  899873,
+  899874,
+  899875,
+  899876,
+  899877,
+  899878,
+  899879,
+  899880,
+  899881,
+  899882,
+  899883,
+  899884,
+  899885,
+  899886,
+  899887,
+  899888,
+  899889,
+  899890,
+  899891,
+  899892,
+  899893,
+  899894,
+  899895,
+  899896,
+  899897,
+  899898,
+  899899,
+  899900,
+  899901,
+  899902,
+  899903,
+  899904,
+  899905,
+  899906,
+  899907,
+  899908,
+  899909,
+  899910,
+  899920,
+  900070,
+  900100,
+  900101,
+  900102,
+  900103,
+  900230,
+  900231,
+  900232,
+  900240,
+  900241,
+  900242,
+  900310,
+  900350,
+  900440,
+  900441,
+  900442,
+  900443,
+  900444,
+  900445,
+  900446,
+  900447,
+  900448,
+  900449,
+  900450,
+  900460,
+  900470,
+  900480,
+  900510,
+  900530,
+  900540,
+  900550,
+  900560,
+  900570,
+  900580,
+  900610,
+  900700,
+  900710,
+  900820,
+  903090,
+  903100,
+  903110,
+  903120,
+  903240,
+  903241,
+  903242,
+  903243,
+  903244,
+  903245,
+  903246,
+  903247,
+  903248,
+  903249,
+  903250,
+  903251,
+  903252,
+  903253,
+  903260,
+  903261,
+  903262,
+  903263,
+  903380,
+  903381,
+  903410,
+  903460,
+  903610,
+  903660,
+  903690,
+  903750,
+  903770,
+  903771,
+  903772,
+  903810,
+  903840,
+  903860,
+  903870,
+  903960,
+  903970,
+  903990,
+  904010,
+  904110,
+  904120,
+  904121,
+  904122,
+  904123,
+  904124,
+  904125,
+  904126,
+  904127,
+  904150,
+  904190,
+  904200,
+  904210,
+  904220,
+  904240,
+  904250,
+  904260,
+  904270,
+  904280,
+  904300,
+  904370,
+  904390,
+  904580,
+  904610,
+  904650,
+  904710,
+  904870,
+  904910,
+  904911,
+  904920,
+  905000,
+  905050,
+  905170,
+  905190,
+  905210,
+  905250,
+  905290,
+  905310,
+  905320,
+  905470,
+  905520,
+  905680,
+  905681,
+  905682,
+  905683,
+  905684,
+  905685,
+  905686,
+  905687,
+  905688,
+  905689,
+  905700,
+  905701,
+  905702,
+  905703,
+  905704,
+  905705,
+  905706,
+  905707,
+  905708,
+  905730,
+  905740,
+  905750,
+  905770,
+  905820,
+  905840,
+  905990,
+  906040,
+  906060,
+  906130,
+  906150,
+  906440,
+  906490,
+  906610,
+  906630,
+  906631,
+  906632,
+  906633,
+  906634,
+  906635,
+  906636,
+  906637,
+  906638,
+  906670,
+  906700,
+  906720,
+  906780,
+  906800,
+  906810,
+  906830,
+  906840,
+  906860,
+  906861,
+  906910,
+  906940,
+  907070,
+  907080,
+  907120,
+  907150,
+  907170,
+  907180,
+  907230,
+  907280,
+  907300,
+  907370,
+  907420,
+  907421,
+  907480,
+  907510,
+  907520,
+  907540,
+  907550,
+  907570,
+  907571,
+  907572,
+  907580,
+  907610,
+  907611,
+  907613,
+  907614,
+  907750,
+  907751,
+  907752,
+  907753,
+  907754,
+  907755,
+  907756,
+  907840,
+  907880,
+  907881,
+  907910,
+  908040,
+  908130,
+  908160,
+  908161,
+  908190,
+  908210,
+  908211,
+  908212,
+  908213,
+  908220,
+  908221,
+  908222,
+  908223,
+  908224,
+  908225,
+  908226,
+  908227,
+  908240,
+  908250,
+  908290,
+  908340,
+  908380,
+  908450,
+  908460,
+  908461,
+  908470,
+  908471,
+  908472,
+  908473,
+  908474,
+  908520,
+  908670,
+  908680,
+  908760,
+  908810,
+  908860,
+  908970,
+  909050,
+  909140,
+  909150,
+  909250,
+  909330,
+  909340,
+  909350,
+  909390,
+  909400,
+  909460,
+  909520,
+  909521,
+  909522,
+  909530,
+  909590,
+  909600,
+  909610,
+  909640,
+  909690,
+  909720,
+  909730,
+  909850,
+  909851,
+  910030,
+  910040,
+  910050,
+  910160,
+  910370,
+  910410,
+  910560,
+  910600,
+  910620,
+  910640,
+  910710,
+  910711,
+  910820,
+  910821,
+  910930,
+  910931,
+  910932,
+  910940,
+  911000,
+  911070,
+  911080,
+  911250,
+  911310,
+  911330,
+  911340,
+  911410,
+  911450,
+  911490,
+  911590,
+  911610,
+  911720,
+  911840,
+  911860,
+  911920,
+  911930,
+  911940,
+  911970,
+  911990,
+  912100,
+  912170,
+  912180,
+  912240,
+  912270,
+  912340,
+  912350,
+  912440,
+  912460,
+  912470,
+  912540,
+  912640,
+  912700,
+  912710,
+  912780,
+  912830,
+  912831,
+  912832,
+  912833,
+  912834,
+  912835,
+  912850,
+  912870,
+  912980,
+  913240,
+  913290,
+  913400,
+  913470,
+  913480,
+  913610,
+  913611,
+  913630,
+  913680,
+  913750,
+  913760,
+  913810,
+  913900,
+  913920,
+  913930,
+  914060,
+  914080,
+  914081,
+  914120,
+  914280,
+  914310,
+  914340,
+  914410,
+  914520,
+  914540,
+  914560,
+  914570,
+  914660,
+  914661,
+  914662,
+  914770,
+  914780,
+  914790,
+  914810,
+  914820,
+  914830,
+  914831,
+  914840,
+  914970,
+  914990,
+  915070,
+  915090,
+  915170,
+  915180,
+  915210,
+  915340,
+  915350,
+  915390,
+  915590,
+  915591,
+  915620,
+  915630,
+  915631,
+  915650,
+  915652,
+  915653,
+  915660,
+  915661,
+  915690,
+  915870,
+  915990,
+  916000,
+  916020,
+  916070,
+  916071,
+  916110,
+  916170,
+  916190,
+  916220,
+  916250,
+  916280,
+  916360,
+  916361,
+  916410,
+  916420,
+  916430,
+  916431,
+  916432,
+  916451,
+  916452,
+  916460,
+  916500,
+  916570,
+  916600,
+  916690,
+  916720,
+  916771,
+  916772,
+  916920,
+  917010,
+  917011,
+  917012,
+  917013,
+  917014,
+  917015,
+  917016,
+  917017,
+  917018,
+  917019,
+  917030,
+  917031,
+  917032,
+  917033,
+  917040,
+  917080,
+  917090,
+  917170,
+  917190,
+  917210,
+  917250,
+  917260,
+  917390,
+  917590,
+  917630,
+  917780,
+  917890,
+  917930,
+  918150,
+  918151,
+  918210,
+  918270,
+  918290,
+  918360,
+  918400,
+  918410,
+  918460,
+  918470,
+  918490,
+  918540,
+  918630,
+  918640,
+  918650,
+  918660,
+  918760,
+  918770,
+  918792,
+  918793,
+  918794,
+  918795,
+  918800,
+  918810,
+  918830,
+  918970,
+  919000,
+  919050,
+  919051,
+  919100,
+  919140,
+  919180,
+  919230,
+  919280,
+  919310,
+  919340,
+  919390,
+  919450,
+  919670,
+  919680,
+  919720,
+  919770,
+  920350,
+  920351,
+  920352,
+  920353,
+  920440,
+  920480,
+  920490,
+  920530,
+  920560,
+  920561,
+  920562,
+  920563,
+  920564,
+  920565,
+  920566,
+  920567,
+  920568,
+  920569,
+  920570,
+  920571,
+  920590,
+  920591,
+  920592,
+  920593,
+  920594,
+  920595,
+  920596,
+  920597,
+  920598,
+  920599,
+  920600,
+  920601,
+  920630,
+  920720,
+  920730,
+  920840,
+  920960,
+  920970,
+  920980,
+  920981,
+  920982,
+  921010,
+  921080,
+  921110,
+  921460,
+  921480,
+  921481,
+  921482,
+  921483,
+  921484,
+  921485,
+  921486,
+  921487,
+  921488,
+  921489,
+  921540,
+  921541,
+  921542,
+  921543,
+  921640,
+  921680,
+  921820,
+  921830,
+  921870,
+  921950,
+  922160,
+  922200,
+  922230,
+  922270,
+  922280,
+  922300,
+  922310,
+  922311,
+  922312,
+  922313,
+  922420,
+  922430,
+  922540,
+  922570,
+  922580,
+  922581,
+  922660,
+  922670,
+  922720,
+  922730,
+  922740,
+  922741,
+  922750,
+  922840,
+  922850,
+  923151,
+  923152,
+  923160,
+  923250,
+  923270,
+  923290,
+  923300,
+  923310,
+  923380,
+  923560,
+  923580,
+  923640,
+  923720,
+  923850,
+  923851,
+  923920,
+  923930,
+  924050,
+  924051,
+  924150,
+  924151,
+  924160,
+  924170,
+  924180,
+  924181,
+  924182,
+  924183,
+  924184,
+  924185,
+  924190,
+  924210,
+  924220,
+  924230,
+  924330,
+  924331,
+  924332,
+  924340,
+  924490,
+  924730,
+  924770,
+  924840,
+  924841,
+  924920,
+  924930,
+  924950,
+  925020,
+  925100,
+  925101,
+  925102,
+  925103,
+  925110,
+  925160,
+  925180,
+  925190,
+  925191,
+  925380,
+  925390,
+  925400,
+  925410,
+  925420,
+  925580,
+  925590,
+  925620,
+  925621,
+  925650,
+  925660,
+  925680,
+  925740,
+  925750,
+  925760,
+  925820,
+  925821,
+  925822,
+  925823,
+  925824,
+  925825,
+  925826,
+  925827,
+  925828,
+  925829,
+  925830,
+  925850,
+  925851,
+  925852,
+  925853,
+  925854,
+  925855,
+  925856,
+  925857,
+  925858,
+  925859,
+  925860,
+  925861,
+  925862,
+  925863,
+  925864,
+  925865,
+  925866,
+  925867,
+  925868,
+  925869,
+  925870,
+  925871,
+  925970,
+  926020,
+  926270,
+  926320,
+  926560,
+  926561,
+  926562,
+  926590,
+  926640,
+  926650,
+  926660,
+  926670,
+  926800,
+  926830,
+  926850,
+  926890,
+  926940,
+  926970,
+  926980,
+  927010,
+  927030,
+  927040,
+  927180,
+  927210,
+  927240,
+  927330,
+  927660,
+  927700,
+  927720,
+  927730,
+  927780,
+  927800,
+  927830,
+  927880,
+  927900,
+  927920,
+  928040,
+  928090,
+  928100,
+  928110,
+  928190,
+  928220,
+  928240,
+  928290,
+  928380,
+  928470,
+  928500,
+  928530,
+  928540,
+  928550,
+  928560,
+  928570,
+  928580,
+  928770,
+  928771,
+  928920,
+  928930,
+  929100,
+  929101,
+  929102,
+  929103,
+  929104,
+  929105,
+  929106,
+  929111,
+  929130,
+  929160,
+  929190,
+  929191,
+  929192,
+  929193,
+  929270,
+  929350,
+  929360,
+  929480,
+  929520,
+  929550,
+  929620,
+  929680,
+  929720,
+  929760,
+  929820,
+  929880,
+  930000,
+  930010,
+  930020,
+  930100,
+  930170,
+  930180,
+  930190,
+  930200,
+  930240,
+  930250,
+  930370,
+  930380,
+  930381,
+  930400,
+  930440,
+  930570,
+  930660,
+  930790,
+  930870,
+  930920,
+  930980,
+  930981,
+  930982,
+  930983,
+  930984,
+  930985,
+  930990,
+  930991,
+  931010,
+  931020,
+  931050,
+  931190,
+  931191,
+  931192,
+  931193,
+  931300,
+  931330,
+  931340,
+  931370,
+  931420,
+  931520,
+  931530,
+  931580,
+  931600,
+  931640,
+  931670,
+  931720,
+  931740,
+  931790,
+  931791,
+  931800,
+  931920,
+  931960,
+  931970,
+  931980,
+  932080,
+  932200,
+  932380,
+  932400,
+  932471,
+  932472,
+  932480,
+  932510,
+  932520,
+  932540,
+  932550,
+  932600,
+  932610,
+  932620,
+  932621,
+  932622,
+  932640,
+  932641,
+  932642,
+  932643,
+  932644,
+  932660,
+  932700,
+  932740,
+  932741,
+  932742,
+  932743,
+  932744,
+  932760,
+  932780,
+  932840,
+  932990,
+  933010,
+  933011,
+  933012,
+  933020,
+  933100,
+  933130,
+  933260,
+  933261,
+  933262,
+  933330,
+  933340,
+  933350,
+  933400,
+  933410,
+  933460,
+  933470,
+  933471,
+  933490,
+  933491,
+  933492,
+  933493,
+  933500,
+  933501,
+  933502,
+  933503,
+  933504,
+  933505,
+  933506,
+  933507,
+  933508,
+  933509,
+  933510,
+  933511,
+  933512,
+  933520,
+  933521,
+  933522,
+  933523,
+  933524,
+  933525,
+  933526,
+  933527,
+  933528,
+  933529,
+  933530,
+  933531,
+  933532,
+  933533,
+  933534,
+  933535,
+  933536,
+  933537,
+  933538,
+  933539,
+  933550,
+  933551,
+  933552,
+  933553,
+  933554,
+  933555,
+  933556,
+  933557,
+  933558,
+  933560,
+  933561,
+  933562,
+  933563,
+  933564,
+  933565,
+  933566,
+  933567,
+  933568,
+  933569,
+  933570,
+  933571,
+  933572,
+  933573,
+  933610,
+  933620,
+  933670,
+  933720,
+  933750,
+  933751,
+  933752,
+  933753,
+  933754,
+  933755,
+  933756,
+  933757,
+  933758,
+  933759,
+  933760,
+  933761,
+  933762,
+  933763,
+  933764,
+  933765,
+  933790,
+  933850,
+  933890,
+  933980,
+  933990,
+  934130,
+  934131,
+  934140,
+  934200,
+  934300,
+  934310,
+  934320,
+  934321,
+  934330,
+  934331,
+  934340,
+  934341,
+  934350,
+  934351,
+  934352,
+  934353,
+  934360,
+  934361,
+  934610,
+  934640,
+  934650,
+  934660,
+  934680,
+  934690,
+  934710,
+  934910,
+  934940,
+  934960,
+  934961,
+  935000,
+  935010,
+  935040,
+  935080,
+  935390,
+  935430,
+  935510,
+  935511,
+  935512,
+  935513,
+  935514,
+  935590,
+  935620,
+  935710,
+  935770,
+  935780,
+  935810,
+  935830,
+  935850,
+  935870,
+  935900,
+  936030,
+  936050,
+  936080,
+  936090,
+  936100,
+  936120,
+  936121,
+  936280,
+  936290,
+  936300,
+  936310,
+  936340,
+  936350,
+  936360,
+  936370,
+  936390,
+  936400,
+  936420,
+  936430,
+  936440,
+  936450,
+  936460,
+  936480,
+  936570,
+  936660,
+  936670,
+  936690,
+  936710,
+  936910,
+  937110,
+  937240,
+  937370,
+  937400,
+  937411,
+  937430,
+  937440,
+  937480,
+  937510,
+  937540,
+  937600,
+  937630,
+  937650,
+  937660,
+  937680,
+  937720,
+  937790,
+  937791,
+  937792,
+  937800,
+  937830,
+  937880,
+  937890,
+  937891,
+  937892,
+  938030,
+  938110,
+  938120,
+  938130,
+  938140,
+  938150,
+  938160,
+  938180,
+  938400,
+  938410,
+  938420,
+  938430,
+  938440,
+  938450,
+  938460,
+  938490,
+  938530,
+  938540,
+  938550,
+  938590,
+  938610,
+  938721,
+  938760,
+  938770,
+  938880,
+  938900,
+  938910,
+  938920,
+  938950,
+  938990,
+  938991,
+  939030,
+  939040,
+  939050,
+  939051,
+  939060,
+  939080,
+  939090,
+  939320,
+  939360,
+  939480,
+  939550,
+  939570,
+  939590,
+  939640,
+  939650,
+  939680,
+  939710,
+  939730,
+  939840,
+  939860,
+  939890,
+  939900,
+  939920,
+  939940,
+  940010,
+  940080,
+  940090,
+  940200,
+  940220,
+  940270,
+  940340,
+  940370,
+  940390,
+  940400,
+  940410,
+  940420,
+  940440,
+  940450,
+  940460,
+  940480,
+  940500,
+  940501,
+  940530,
+  940550,
+  940570,
+  940620,
+  940670,
+  940671,
+  940672,
+  940730,
+  940731,
+  940732,
+  940733,
+  940734,
+  940735,
+  940736,
+  940737,
+  940738,
+  940739,
+  940740,
+  940750,
+  940770,
+  940771,
+  940820,
+  940920,
+  940970,
+  941080,
+  941100,
+  941170,
+  941180,
+  941220,
+  941230,
+  941240,
+  941241,
+  941360,
+  941440,
+  941490,
+  941550,
+  941560,
+  941720,
+  941900,
+  941910,
+  941950,
+  941951,
+  941952,
+  941953,
+  941954,
+  941955,
+  941956,
+  941957,
+  941958,
+  941959,
+  941960,
+  941961,
+  941962,
+  941963,
+  941964,
+  941965,
+  941966,
+  941967,
+  941968,
+  941969,
+  941970,
+  941971,
+  941972,
+  941973,
+  942030,
+  942070,
+  942100,
+  942170,
+  942180,
+  942190,
+  942210,
+  942230,
+  942240,
+  942260,
+  942280,
+  942290,
+  942350,
+  942351,
+  942352,
+  942353,
+  942354,
+  942355,
+  942356,
+  942360,
+  942380,
+  942430,
+  942540,
+  942590,
+  942770,
+  942790,
+  942980,
+  943070,
+  943120,
+  943121,
+  943122,
+  943123,
+  943180,
+  943200,
+  943240,
+  943350,
+  943420,
+  943450,
+  943530,
+  943670,
+  943690,
+  943720,
+  943730,
+  943740,
+  943750,
+  943760,
+  943820,
+  943830,
+  943831,
+  943840,
+  943841,
+  943842,
+  943843,
+  943844,
+  943850,
+  943870,
+  943871,
+  943910,
+  943930,
+  944070,
+  944071,
+  944090,
+  944160,
+  944230,
+  944240,
+  944290,
+  944350,
+  944490,
+  944520,
+  944540,
+  944600,
+  944770,
+  944820,
+  944870,
+  944890,
+  944891,
+  944892,
+  944893,
+  944930,
+  944950,
+  944970,
+  944980,
+  945000,
+  945010,
+  945011,
+  945020,
+  945031,
+  945032,
+  945033,
+  945040,
+  945070,
+  945080,
+  945120,
+  945130,
+  945170,
+  945180,
+  945200,
+  945220,
+  945230,
+  945250,
+  945270,
+  945271,
+  945272,
+  945310,
+  945370,
+  945380,
+  945400,
+  945401,
+  945402,
+  945403,
+  945404,
+  945450,
+  945480,
+  945481,
+  945482,
+  945483,
+  945600,
+  945690,
+  945720,
+  945760,
+  945780,
+  945790,
+  945830,
+  945831,
+  945832,
+  945900,
+  945930,
+  945931,
+  945970,
+  945990,
+  946130,
+  946150,
+  946180,
+  946270,
+  946310,
+  946420,
+  946430,
+  946520,
+  946530,
+  946620,
+  946640,
+  946710,
+  946740,
+  946750,
+  946820,
+  946900,
+  946901,
+  946902,
+  946910,
+  946930,
+  946940,
+  946970,
+  947000,
+  947090,
+  947130,
+  947240,
+  947330,
+  947340,
+  947350,
+  947360,
+  947480,
+  947510,
+  947550,
+  947590,
+  947650,
+  947660,
+  947670,
+  947680,
+  947690,
+  947700,
+  947710,
+  947720,
+  947730,
+  947740,
+  947741,
+  947750,
+  947760,
+  947770,
+  947800,
+  947810,
+  947820,
+  947870,
+  947910,
+  947930,
+  947950,
+  947980,
+  948140,
+  948220,
+  948250,
+  948360,
+  948361,
+  948380,
+  948390,
+  948410,
+  948411,
+  948430,
+  948440,
+  948540,
+  948541,
+  948542,
+  948550,
+  948570,
+  948571,
+  948572,
+  948590,
+  948620,
+  948621,
+  948670,
+  948680,
+  948780,
+  948810,
+  948910,
+  948930,
+  948970,
+  949080,
+  949081,
+  949110,
+  949160,
+  949220,
+  949221,
+  949250,
+  949490,
+  949491,
+  949492,
+  949494,
+  949495,
+  949500,
+  949610,
+  949640,
+  949641,
+  949642,
+  949660,
+  949661,
+  949662,
+  949663,
+  949664,
+  949665,
+  949750,
+  949760,
+  949780,
+  949850,
+  949870,
+  949900,
+  950060,
+  950080,
+  950150,
+  950200,
+  950270,
+  950271,
+  950290,
+  950430,
+  950500,
+  950540,
+  950550,
+  950551,
+  950552,
+  950553,
+  950554,
+  950555,
+  950556,
+  950557,
+  950558,
+  950559,
+  950560,
+  950561,
+  950562,
+  950580,
+  950590,
+  950640,
+  950680,
+  950760,
+  950820,
+  950840,
+  950900,
+  951210,
+  951300,
+  951350,
+  951460,
+  951510,
+  951520,
+  951610,
+  951650,
+  951660,
+  951661,
+  951662,
+  951663,
+  951664,
+  951665,
+  951666,
+  951667,
+  951668,
+  951790,
+  951800,
+  951850,
+  951870,
+  951950,
+  952080,
+  952111,
+  952112,
+  952113,
+  952114,
+  952115,
+  952180,
+  952210,
+  952220,
+  952320,
+  952360,
+  952390,
+  952410,
+  952430,
+  952480,
+  952490,
+  952500,
+  952570,
+  952650,
+  952651,
+  952652,
+  952670,
+  952671,
+  952870,
+  952890,
+  952891,
+  952892,
+  952900,
+  952960,
+  953010,
+  953020,
+  953080,
+  953090,
+  953091,
+  953092,
+  953093,
+  953094,
+  953095,
+  953096,
+  953100,
+  953101,
+  953102,
+  953106,
+  953107,
+  953140,
+  953350,
+  953450,
+  953650,
+  953660,
+  953680,
+  953681,
+  953682,
+  953800,
+  953830,
+  953860,
+  953910,
+  953940,
+  953980,
+  953981,
+  954020,
+  954030,
+  954060,
+  954090,
+  954100,
+  954101,
+  954102,
+  954103,
+  954110,
+  954120,
+  954130,
+  954140,
+  954220,
+  954221,
+  954350,
+  954560,
+  954600,
+  954601,
+  954602,
+  954603,
+  954604,
+  954605,
+  954606,
+  954607,
+  954609,
+  954670,
+  954690,
+  954730,
+  954770,
+  954800,
+  954810,
+  954820,
+  954880,
+  954940,
+  954950,
+  954960,
+  955000,
+  955040,
+  955080,
+  955130,
+  955140,
+  955180,
+  955181,
+  955182,
+  955210,
+  955240,
+  955440,
+  955480,
+  955520,
+  955590,
+  955610,
+  955650,
+  955710,
+  955760,
+  955780,
+  955810,
+  955830,
+  955970,
+  955990,
+  956040,
+  956050,
+  956070,
+  956080,
+  956110,
+  956120,
+  956220,
+  956230,
+  956260,
+  956300,
+  956320,
+  956330,
+  956340,
+  956440,
+  956460,
+  956490,
+  956610,
+  956630,
+  956640,
+  956650,
+  956660,
+  956700,
+  956701,
+  956702,
+  956703,
+  956704,
+  956705,
+  956706,
+  956707,
+  956708,
+  956709,
+  956720,
+  956721,
+  956722,
+  956723,
+  956724,
+  956725,
+  956726,
+  956727,
+  956728,
+  956729,
+  956730,
+  956731,
+  956732,
+  956733,
+  956734,
+  956735,
+  956736,
+  956737,
+  956738,
+  956739,
+  956740,
+  956750,
+  956751,
+  956752,
+  956753,
+  956760,
+  956761,
+  956762,
+  956763,
+  956764,
+  956765,
+  956766,
+  956767,
+  956768,
+  956769,
+  956770,
+  956771,
+  956772,
+  956860,
+  956861,
+  956862,
+  956863,
+  956864,
+  956865,
+  956866,
+  956867,
+  956868,
+  956869,
+  956890,
+  956891,
+  956892,
+  956893,
+  956894,
+  956895,
+  956896,
+  956897,
+  956898,
+  956899,
+  956900,
+  956920,
+  956921,
+  956922,
+  956923,
+  956924,
+  956930,
+  956940,
+  956941,
+  956942,
+  956943,
+  956944,
+  956945,
+  956946,
+  956947,
+  956948,
+  956949,
+  957010,
+  957090,
+  957110,
+  957120,
+  957121,
+  957122,
+  957123,
+  957124,
+  957125,
+  957126,
+  957127,
+  957290,
+  957300,
+  957310,
+  957320,
+  957330,
+  957530,
+  957531,
+  957532,
+  957533,
+  957534,
+  957535,
+  957536,
+  957537,
+  957538,
+  957539,
+  957541,
+  957600,
+  957601,
+  957602,
+  957603,
+  957604,
+  957605,
+  957607,
+  957610,
+  957630,
+  957690,
+  957691,
+  957692,
+  957693,
+  957694,
+  957695,
+  957696,
+  957697,
+  957698,
+  957730,
+  957731,
+  957733,
+  957735,
+  957760,
+  957761,
+  957762,
+  957900,
+  957901,
+  957902,
+  957903,
+  957904,
+  957905,
+  957906,
+  957910,
+  957911,
+  957912,
+  957913,
+  957914,
+  957915,
+  957916,
+  957917,
+  957918,
+  957919,
+  957920,
+  957921,
+  957922,
+  958140,
+  958150,
+  958160,
+  958210,
+  958250,
+  958370,
+  958380,
+  958381,
+  958390,
+  958410,
+  958570,
+  958580,
+  958600,
+  958660,
+  958710,
+  958711,
+  958730,
+  958770,
+  958820,
+  958870,
+  958940,
+  958950,
+  958970,
+  959060,
+  959070,
+  959110,
+  959140,
+  959160,
+  959190,
+  959230,
+  959250,
+  959430,
+  959450,
+  959460,
+  959530,
+  959550,
+  959560,
+  959570,
+  959580,
+  959610,
+  959620,
+  959630,
+  959640,
+  959650,
+  959660,
+  959670,
+  959680,
+  959790,
+  959810,
+  959812,
+  959816,
+  959820,
+  959840,
+  959910,
+  959950,
+  960120,
+  960180,
+  960290,
+  960310,
+  960400,
+  960620,
+  960670,
+  960720,
+  960770,
+  960771,
+  960781,
+  960831,
+  960832,
+  960840,
+  960850,
+  960890,
+  960920,
+  961080,
+  961090,
+  961100,
+  961140,
+  961150,
+  961160,
+  961290,
+  961300,
+  961400,
+  961470,
+  961471,
+  961472,
+  961480,
+  961570,
+  961580,
+  961590,
+  961600,
+  961630,
+  961780,
+  961810,
+  961830,
+  961840,
+  961930,
+  961940,
+  961980,
+  961990,
+  962000,
+  962040,
+  962120,
+  962140,
+  962180,
+  962181,
+  962230,
+  962300,
+  962301,
+  962302,
+  962303,
+  962304,
+  962305,
+  962306,
+  962410,
+  962420,
+  962421,
+  962430,
+  962500,
+  962530,
+  962540,
+  962640,
+  962680,
+  962750,
+  962780,
+  962790,
+  962820,
+  962890,
+  962920,
+  962921,
+  962922,
+  962923,
+  962924,
+  962925,
+  962960,
+  962980,
+  962990,
+  963040,
+  963060,
+  963070,
+  963120,
+  963130,
+  963240,
+  963260,
+  963311,
+  963312,
+  963340,
+  963350,
+  963410,
+  963600,
+  963620,
+  963630,
+  963740,
+  963750,
+  964080,
+  964120,
+  964250,
+  964290,
+  964370,
+  964480,
+  964500,
+  964520,
+  964530,
+  964590,
+  964630,
+  964640,
+  964870,
+  964880,
+  964890,
+  964930,
+  964931,
+  964932,
+  964933,
+  964934,
+  964935,
+  964936,
+  964937,
+  964938,
+  965040,
+  965070,
+  965100,
+  965101,
+  965102,
+  965130,
+  965220,
+  965270,
+  965280,
+  965290,
+  965350,
+  965370,
+  965400,
+  965420,
+  965430,
+  965480,
+  965520,
+  965690,
+  965700,
+  965720,
+  965780,
+  965781,
+  965850,
+  965870,
+  965930,
+  965950,
+  965980,
+  966060,
+  966120,
+  966130,
+  966150,
+  966350,
+  966360,
+  966410,
+  966440,
+  966490,
+  966491,
+  966492,
+  966493,
+  966494,
+  966495,
+  966497,
+  966498,
+  966499,
+  966520,
+  966521,
+  966522,
+  966523,
+  966524,
+  966525,
+  966526,
+  966527,
+  966528,
+  966529,
+  966610,
+  966640,
+  966690,
+  966700,
+  966710,
+  966750,
+  966840,
+  966841,
+  966842,
+  966843,
+  966844,
+  966845,
+  967010,
+  967060,
+  967130,
+  967150,
+  967170,
+  967230,
+  967271,
+  967272,
+  967274,
+  967275,
+  967276,
+  967278,
+  967279,
+  967280,
+  967281,
+  967282,
+  967283,
+  967285,
+  967287,
+  967288,
+  967289,
+  967300,
+  967320,
+  967340,
+  967350,
+  967380,
+  967400,
+  967420,
+  967480,
+  967980,
+  967981,
+  968000,
+  968180,
+  968220,
+  968230,
+  968240,
+  968270,
+  968271,
+  968272,
+  968273,
+  968390,
+  968490,
+  968670,
+  968680,
+  968740,
+  968810,
+  968830,
+  968840,
+  968880,
+  968890,
+  968900,
+  968901,
+  968902,
+  968910,
+  968911,
+  968912,
+  968913,
+  969020,
+  969030,
+  969040,
+  969041,
+  969042,
+  969043,
+  969044,
+  969045,
+  969070,
+  969090,
+  969100,
+  969110,
+  969140,
+  969260,
+  969261,
+  969262,
+  969270,
+  969430,
+  969470,
+  969471,
+  969560,
+  969570,
+  969580,
+  969590,
+  969600,
+  969620,
+  969651,
+  969652,
+  969653,
+  969654,
+  969655,
+  969656,
+  969657,
+  969658,
+  969659,
+  969710,
+  969730,
+  969770,
+  969771,
+  969772,
+  969773,
+  969780,
+  969790,
+  969800,
+  969820,
+  969890,
+  969900,
+  969920,
+  970020,
+  970060,
+  970100,
+  970110,
+  970120,
+  970160,
+  970170,
+  970210,
+  970230,
+  970410,
+  970590,
+  970630,
+  970640,
+  970930,
+  970990,
+  971020,
+  971240,
+  971241,
+  971242,
+  971243,
+  971250,
+  971251,
+  971252,
+  971260,
+  971491,
+  971510,
+  971511,
+  971512,
+  971520,
+  971570,
+  971600,
+  971630,
+  971750,
+  971760,
+  971770,
+  971790,
+  971910,
+  971924,
+  971925,
+  971930,
+  971970,
+  971980,
+  971995,
+  971996,
+  971998,
+  971999,
+  972150,
+  972260,
+  972261,
+  972300,
+  972340,
+  972350,
+  972351,
+  972360,
+  972370,
+  972380,
+  972390,
+  972400,
+  972720,
+  972730,
+  972731,
+  972790,
+  972860,
+  972870,
+  972880,
+  973180,
+  973260,
+  973270,
+  973280,
+  973290,
+  973360,
+  973370,
+  973380,
+  973490,
+  973500,
+  973520,
+  973590,
+  973600,
+  973610,
+  973611,
+  973612,
+  973740,
+  973750,
+  973770,
+  973830,
+  973840,
+  973870,
+  973910,
+  973970,
+  974080,
+  974130,
+  974170,
+  974280,
+  974281,
+  974282,
+  974290,
+  974300,
+  974301,
+  974302,
+  974330,
+  974340,
+  974341,
+  974342,
+  974350,
+  974351,
+  974352,
+  974353,
+  974354,
+  974360,
+  974361,
+  974362,
+  974363,
+  974364,
+  974380,
+  974400,
+  974440,
+  974441,
+  974460,
+  974540,
+  974570,
+  974580,
+  974590,
+  974610,
+  974650,
+  974700,
+  974701,
+  974702,
+  974720,
+  974721,
+  974722,
+  974723,
+  974724,
+  974725,
+  974726,
+  974727,
+  974728,
+  974729,
+  974730,
+  974740,
+  974780,
+  974800,
+  974880,
+  975040,
+  975080,
+  975081,
+  975082,
+  975180,
+  975260,
+  975261,
+  975280,
+  975300,
+  975301,
+  975302,
+  975303,
+  975310,
+  975311,
+  975312,
+  975313,
+  975314,
+  975315,
+  975316,
+  975317,
+  975318,
+  975320,
+  975330,
+  975360,
+  975380,
+  975400,
+  975420,
+  975421,
+  975490,
+  975530,
+  975540,
+  975541,
+  975542,
+  975550,
+  975560,
+  975930,
+  975940,
+  976040,
+  976050,
+  976051,
+  976080,
+  976100,
+  976130,
+  976210,
+  976220,
+  976280,
+  976330,
+  976350,
+  976370,
+  976371,
+  976380,
+  976520,
+  976530,
+  976531,
+  976540,
+  976650,
+  976660,
+  976661,
+  976662,
+  976663,
+  976664,
+  976690,
+  976750,
+  977000,
+  977020,
+  977040,
+  977060,
+  977070,
+  977170,
+  977220,
+  977250,
+  977360,
+  977370,
+  977420,
+  977520,
+  977530,
+  977610,
+  977660,
+  977750,
+  977800,
+  977820,
+  977850,
+  977860,
+  977930,
+  977941,
+  977970,
+  978000,
+  978060,
+  978070,
+  978080,
+  978140,
+  978150,
+  978160,
+  978161,
+  978162,
+  978170,
+  978220,
+  978230,
+  978310,
+  978350,
+  978530,
+  978531,
+  978532,
+  978680,
+  978690,
+  978730,
+  978740,
+  978760,
+  978810,
+  978850,
+  978851,
+  978852,
+  978853,
+  978854,
+  978855,
+  978856,
+  978857,
+  978858,
+  978859,
+  978860,
+  978861,
+  978862,
+  978863,
+  978864,
+  978865,
+  978866,
+  978867,
+  978880,
+  978950,
+  978951,
+  978990,
+  979010,
+  979030,
+  979050,
+  979130,
+  979131,
+  979132,
+  979133,
+  979140,
+  979190,
+  979200,
+  979280,
+  979340,
+  979460,
+  979461,
+  979462,
+  979463,
+  979464,
+  979465,
+  979466,
+  979467,
+  979468,
+  979469,
+  979470,
+  979560,
+  979570,
+  979630,
+  979631,
+  979632,
+  979633,
+  979634,
+  979635,
+  979650,
+  979700,
+  979710,
+  979730,
+  979750,
+  979780,
+  979850,
+  979851,
+  979852,
+  979860,
+  979861,
+  979930,
+  979950,
+  980000,
+  980050,
+  980080,
+  980100,
+  980270,
+  980271,
+  980272,
+  980290,
+  980291,
+  980330,
+  980350,
+  980370,
+  980390,
+  980400,
+  980410,
+  980420,
+  980430,
+  980450,
+  980460,
+  980540,
+  980541,
+  980542,
+  980543,
+  980544,
+  980545,
+  980546,
+  980547,
+  980548,
+  980549,
+  980550,
+  980570,
+  980590,
+  980591,
+  980592,
+  980620,
+  980720,
+  980740,
+  980760,
+  980810,
+  980860,
+  980930,
+  981190,
+  981200,
+  981210,
+  981220,
+  981230,
+  981330,
+  981510,
+  981590,
+  981610,
+  981700,
+  981701,
+  981702,
+  981730,
+  981740,
+  981840,
+  982070,
+  982071,
+  982110,
+  982130,
+  982190,
+  982200,
+  982201,
+  982260,
+  982280,
+  982310,
+  982460,
+  982461,
+  982470,
+  982471,
+  982472,
+  982473,
+  982490,
+  982520,
+  982590,
+  982600,
+  982610,
+  982630,
+  982640,
+  982650,
+  982660,
+  982730,
+  982731,
+  982780,
+  982830,
+  982910,
+  982960,
+  982970,
+  983050,
+  983080,
+  983090,
+  983270,
+  983271,
+  983300,
+  983360,
+  983370,
+  983420,
+  983440,
+  983441,
+  983442,
+  983460,
+  983470,
+  983480,
+  983490,
+  983500,
+  983530,
+  983750,
+  983770,
+  983780,
+  983820,
+  983930,
+  984000,
+  984040,
+  984090,
+  984130,
+  984160,
+  984161,
+  984162,
+  984180,
+  984200,
+  984210,
+  984270,
+  984280,
+  984340,
+  984430,
+  984440,
+  984530,
+  984630,
+  984710,
+  984711,
+  984740,
+  984741,
+  984850,
+  984860,
+  984920,
+  984970,
+  985050,
+  985110,
+  985130,
+  985180,
+  985190,
+  985200,
+  985220,
+  985230,
+  985290,
+  985380,
+  985390,
+  985410,
+  985460,
+  985470,
+  985520,
+  985610,
+  985630,
+  985790,
+  985860,
+  985980,
+  986000,
+  986001,
+  986060,
+  986090,
+  986110,
+  986120,
+  986140,
+  986170,
+  986180,
+  986230,
+  986240,
+  986250,
+  986290,
+  986300,
+  986330,
+  986430,
+  986470,
+  986510,
+  986740,
+  986750,
+  986840,
+  986850,
+  986980,
+  987010,
+  987050,
+  987070,
+  987110,
+  987120,
+  987170,
+  987220,
+  987270,
+  987340,
+  987430,
+  987440,
+  987460,
+  987500,
+  987600,
+  987680,
+  987690,
+  987730,
+  988010,
+  988011,
+  988012,
+  988013,
+  988014,
+  988015,
+  988016,
+  988017,
+  988018,
+  988019,
+  988020,
+  988021,
+  988040,
+  988041,
+  988042,
+  988043,
+  988044,
+  988045,
+  988046,
+  988047,
+  988150,
+  988160,
+  988170,
+  988171,
+  988172,
+  988180,
+  988210,
+  988220,
+  988230,
+  988290,
+  988320,
+  988360,
+  988410,
+  988440,
+  988450,
+  988470,
+  988520,
+  988550,
+  988570,
+  988620,
+  988621,
+  988660,
+  988661,
+  988662,
+  988670,
+  988671,
+  988680,
+  988690,
+  988730,
+  988740,
+  988750,
+  988760,
+  988780,
+  988810,
+  988820,
+  988830,
+  988840,
+  988850,
+  988870,
+  988880,
+  988920,
+  988950,
+  988970,
+  989060,
+  989170,
+  989220,
+  989280,
+  989480,
+  989500,
+  989520,
+  989600,
+  989610,
+  989620,
+  989680,
+  989700,
+  989740,
+  989741,
+  989810,
+  989900,
+  989960,
+  989970,
+  990120,
+  990170,
+  990200,
+  990201,
+  990202,
+  990230,
+  990270,
+  990310,
+  990320,
+  990330,
+  990340,
+  990430,
+  990650,
+  990680,
+  990690,
+  990730,
+  990731,
+  990732,
+  990733,
+  990760,
+  990761,
+  990762,
+  990820,
+  990830,
+  990880,
+  990930,
+  990931,
+  990932,
+  991010,
+  991011,
+  991060,
+  991061,
+  991062,
+  991063,
+  991064,
+  991065,
+  991066,
+  991067,
+  991068,
+  991069,
+  991080,
+  991220,
+  991520,
+  991540,
+  991580,
+  991730,
+  991770,
+  991771,
+  991772,
+  991773,
+  991774,
+  991830,
+  991850,
+  991870,
+  991890,
+  991910,
+  992010,
+  992130,
+  992140,
+  992150,
+  992160,
+  992170,
+  992171,
+  992172,
+  992173,
+  992174,
+  992175,
+  992176,
+  992180,
+  992440,
+  992490,
+  992570,
+  992590,
+  992660,
+  992770,
+  992850,
+  992920,
+  993060,
+  993090,
+  993180,
+  993181,
+  993240,
+  993241,
+  993270,
+  993300,
+  993410,
+  993420,
+  993570,
+  993590,
+  993610,
+  993670,
+  993710,
+  993910,
+  993911,
+  993912,
+  993920,
+  993921,
+  993922,
+  993923,
+  993924,
+  993925,
+  993926,
+  993927,
+  993928,
+  993929,
+  993930,
+  993931,
+  993932,
+  993933,
+  993940,
+  993950,
+  994110,
+  994120,
+  994130,
+  994150,
+  994210,
+  994300,
+  994420,
+  994430,
+  994460,
+  994480,
+  994490,
+  994510,
+  994530,
+  994610,
+  994660,
+  994710,
+  994740,
+  994820,
+  994821,
+  994840,
+  994920,
+  994950,
+  995020,
+  995021,
+  995030,
+  995040,
+  995190,
+  995290,
+  995380,
+  995390,
+  995400,
+  995530,
+  995531,
+  995560,
+  995590,
+  995610,
+  995640,
+  995650,
+  995651,
+  995652,
+  995653,
+  995654,
+  995660,
+  995670,
+  995770,
+  995780,
+  995810,
+  995860,
+  995950,
+  995960,
+  995970,
+  996060,
+  996150,
+  996210,
+  996220,
+  996240,
+  996300,
+  996310,
+  996311,
+  996312,
+  996313,
+  996314,
+  996330,
+  996340,
+  996350,
+  996360,
+  996510,
+  996530,
+  996540,
+  996541,
+  996560,
+  996570,
+  996590,
+  996600,
+  996630,
+  996680,
+  996700,
+  996720,
+  996721,
+  996740,
+  996741,
+  996742,
+  996760,
+  996820,
+  996890,
+  996900,
+  996910,
+  996970,
+  996990,
+  997040,
+  997041,
+  997042,
+  997100,
+  997120,
+  997150,
+  997160,
+  997163,
+  997230,
+  997250,
+  997251,
+  997252,
+  997253,
+  997254,
+  997330,
+  997360,
+  997390,
+  997460,
+  997470,
+  997520,
+  997540,
+  997620,
+  997680,
+  997740,
+  997750,
+  997830,
+  997840,
+  997910,
+  997920,
+  997980,
+  998000,
+  998030,
+  998040,
+  998041,
+  998050,
+  998051,
+  998060,
+  998061,
+  998062,
+  998063,
+  998064,
+  998065,
+  998066,
+  998067,
+  998068,
+  998069,
+  998070,
+  998071,
+  998072,
+  998073,
+  998080,
+  998081,
+  998090,
+  998091,
+  998100,
+  998101,
+  998110,
+  998111,
+  998120,
+  998121,
+  998130,
+  998140,
+  998141,
+  998142,
+  998160,
+  998170,
+  998180,
+  998181,
+  998190,
+  998191,
+  998200,
+  998201,
+  998202,
+  998210,
+  998211,
+  998212,
+  998213,
+  998214,
+  998230,
+  998231,
+  998232,
+  998233,
+  998234,
+  998240,
+  998241,
+  998242,
+  998243,
+  998244,
+  998245,
+  998246,
+  998247,
+  998248,
+  998249,
+  998250,
+  998251,
+  998252,
+  998253,
+  998254,
+  998255,
+  998256,
+  998257,
+  998258,
+  998259,
+  998260,
+  998261,
+  998280,
+  998281,
+  998282,
+  998283,
+  998284,
+  998285,
+  998286,
+  998287,
+  998288,
+  998289,
+  998290,
+  998291,
+  998292,
+  998293,
+  998294,
+  998295,
+  998296,
+  998297,
+  998298,
+  998299,
+  998310,
+  998311,
+  998312,
+  998320,
+  998321,
+  998330,
+  998350,
+  998351,
+  998352,
+  998353,
+  998380,
+  998500,
+  998540,
+  998550,
+  998560,
+  998580,
+  998600,
+  998620,
+  998800,
+  998801,
+  998802,
+  998803,
+  998804,
+  998805,
+  998806,
+  998810,
+  998960,
+  998961,
+  998970,
+  999050,
+  999070,
+  999150,
+  999260,
+  999261,
+  999262,
+  999263,
+  999300,
+  999301,
+  999302,
+  999380,
+  999420,
+  999421,
+  999470,
+  999490,
+  999520,
+  999530,
+  999550,
+  999580,
+  999630,
+  999670,
+  999680,
+  999780,
+  999790,
+  999840,
+  999870,
+  999880,
+  999900,
+  999940,
+  999950,
+  999960,
+  999970,
+  999980,
+  1000120,
+  1000140,
+  1000150,
+  1000160,
+  1000170,
+  1000180,
+  1000190,
+  1000200,
+  1000210,
+  1000220,
+  1000230,
+  1000240,
+  1000250,
+  1000290,
+  1000400,
+  1000401,
+  1000420,
+  1000490,
+  1000510,
+  1000620,
+  1000621,
+  1000630,
+  1000680,
+  1000690,
+  1000710,
+  1000711,
+  1000712,
+  1000713,
+  1000714,
+  1000715,
+  1000716,
+  1000717,
+  1000718,
+  1000719,
+  1000720,
+  1000780,
+  1000781,
+  1000782,
+  1000783,
+  1000890,
+  1000910,
+  1000940,
+  1000970,
+  1001050,
+  1001060,
+  1001090,
+  1001110,
+  1001150,
+  1001160,
+  1001260,
+  1001280,
+  1001290,
+  1001291,
+  1001320,
+  1001321,
+  1001370,
+  1001371,
+  1001410,
+  1001420,
+  1001440,
+  1001580,
+  1001620,
+  1001720,
+  1001780,
+  1001783,
+  1001784,
+  1001920,
+  1002060,
+  1002090,
+  1002110,
+  1002130,
+  1002150,
+  1002250,
+  1002570,
+  1002571,
+  1002620,
+  1002710,
+  1002740,
+  1002760,
+  1002790,
+  1002810,
+  1002870,
+  1002871,
+  1002872,
+  1002873,
+  1002900,
+  1002940,
+  1003160,
+  1003170,
+  1003200,
+  1003220,
+  1003250,
+  1003270,
+  1003310,
+  1003410,
+  1003430,
+  1003540,
+  1003570,
+  1003660,
+  1003680,
+  1003681,
+  1003682,
+  1003740,
+  1003780,
+  1003790,
+  1003800,
+  1003870,
+  1003920,
+  1003980,
+  1003990,
+  1004060,
+  1004120,
+  1004130,
+  1004220,
+  1004260,
+  1004280,
+  1004290,
+  1004300,
+  1004301,
+  1004340,
+  1004440,
+  1004450,
+  1004480,
+  1004530,
+  1004540,
+  1004590,
+  1004680,
+  1004740,
+  1004760,
+  1004820,
+  1004830,
+  1004840,
+  1004870,
+  1004871,
+  1004880,
+  1004881,
+  1004890,
+  1004891,
+  1004892,
+  1004893,
+  1004894,
+  1004900,
+  1004910,
+  1004911,
+  1004912,
+  1004913,
+  1004914,
+  1004915,
+  1004916,
+  1004917,
+  1004918,
+  1004919,
+  1004920,
+  1004921,
+  1004930,
+  1004940,
+  1004950,
+  1004960,
+  1004970,
+  1004980,
+  1004990,
+  1005010,
+  1005020,
+  1005030,
+  1005040,
+  1005160,
+  1005350,
+  1005541,
+  1005550,
+  1005790,
+  1005970,
+  1005971,
+  1005972,
+  1006030,
+  1006080,
+  1006130,
+  1006210,
+  1006280,
+  1006290,
+  1006340,
+  1006350,
+  1006360,
+  1006370,
+  1006380,
+  1006630,
+  1006650,
+  1006710,
+  1006750,
+  1006820,
+  1006821,
+  1006822,
+  1006840,
+  1006850,
+  1006890,
+  1006960,
+  1006961,
+  1006962,
+  1006963,
+  1006964,
+  1006970,
+  1006971,
+  1006972,
+  1006973,
+  1006974,
+  1006980,
+  1006981,
+  1006982,
+  1006990,
+  1007060,
+  1007110,
+  1007111,
+  1007112,
+  1007113,
+  1007130,
+  1007170,
+  1007190,
+  1007250,
+  1007251,
+  1007340,
+  1007341,
+  1007420,
+  1007421,
+  1007510,
+  1007550,
+  1007570,
+  1007580,
+  1007590,
+  1007600,
+  1007640,
+  1007660,
+  1007670,
+  1007690,
+  1007910,
+  1007920,
+  1008160,
+  1008250,
+  1008300,
+  1008310,
+  1008350,
+  1008360,
+  1008400,
+  1008420,
+  1008440,
+  1008470,
+  1008540,
+  1008660,
+  1008670,
+  1008730,
+  1008750,
+  1008760,
+  1008770,
+  1008810,
+  1009080,
+  1009130,
+  1009140,
+  1009170,
+  1009310,
+  1009330,
+  1009400,
+  1009420,
+  1009480,
+  1009530,
+  1009540,
+  1009630,
+  1009670,
+  1009680,
+  1009710,
+  1009711,
+  1009820,
+  1009821,
+  1009830,
+  1009840,
+  1009850,
+  1009860,
+  1009970,
+  1009980,
+  1010020,
+  1010110,
+  1010130,
+  1010131,
+  1010132,
+  1010133,
+  1010134,
+  1010135,
+  1010136,
+  1010137,
+  1010138,
+  1010139,
+  1010170,
+  1010190,
+  1010210,
+  1010220,
+  1010280,
+  1010300,
+  1010320,
+  1010340,
+  1010350,
+  1010440,
+  1010510,
+  1010530,
+  1010531,
+  1010532,
+  1010680,
+  1010800,
+  1010820,
+  1010821,
+  1010940,
+  1011010,
+  1011020,
+  1011100,
+  1011110,
+  1011170,
+  1011171,
+  1011172,
+  1011173,
+  1011174,
+  1011175,
+  1011176,
+  1011177,
+  1011178,
+  1011179,
+  1011180,
+  1011210,
+  1011211,
+  1011212,
+  1011213,
+  1011214,
+  1011215,
+  1011216,
+  1011217,
+  1011218,
+  1011280,
+  1011350,
+  1011360,
+  1011400,
+  1011480,
+  1011520,
+  1011521,
+  1011522,
+  1011523,
+  1011524,
+  1011540,
+  1011640,
+  1011650,
+  1011730,
+  1011890,
+  1011900,
+  1011920,
+  1011950,
+  1012010,
+  1012080,
+  1012081,
+  1012100,
+  1012101,
+  1012102,
+  1012150,
+  1012200,
+  1012201,
+  1012202,
+  1012203,
+  1012220,
+  1012260,
+  1012270,
+  1012380,
+  1012381,
+  1012400,
+  1012401,
+  1012402,
+  1012403,
+  1012404,
+  1012405,
+  1012406,
+  1012407,
+  1012408,
+  1012420,
+  1012510,
+  1012620,
+  1012621,
+  1012760,
+  1012810,
+  1012890,
+  1012930,
+  1012960,
+  1012980,
+  1013030,
+  1013090,
+  1013110,
+  1013210,
+  1013211,
+  1013212,
+  1013213,
+  1013230,
+  1013300,
+  1013330,
+  1013420,
+  1013500,
+  1013550,
+  1013740,
+  1013780,
+  1013990,
+  1014000,
+  1014130,
+  1014290,
+  1014300,
+  1014410,
+  1014640,
+  1014700,
+  1014870,
+  1015030,
+  1015050,
+  1015110,
+  1015160,
+  1015170,
+  1015220,
+  1015221,
+  1015222,
+  1015460,
+  1015490,
+  1015590,
+  1015600,
+  1015680,
+  1015690,
+  1015840,
+  1015850,
+  1015860,
+  1015880,
+  1015900,
+  1015950,
+  1015960,
+  1015970,
+  1015980,
+  1015990,
+  1016070,
+  1016080,
+  1016130,
+  1016150,
+  1016190,
+  1016230,
+  1016300,
+  1016340,
+  1016480,
+  1016500,
+  1016510,
+  1016520,
+  1016530,
+  1016540,
+  1016550,
+  1016560,
+  1016590,
+  1016620,
+  1016810,
+  1016840,
+  1016870,
+  1016871,
+  1016872,
+  1016873,
+  1017030,
+  1017060,
+  1017070,
+  1017110,
+  1017220,
+  1017230,
+  1017260,
+  1017390,
+  1017391,
+  1017430,
+  1017510,
+  1017620,
+  1017680,
+  1017700,
+  1017730,
+  1017790,
+  1017810,
+  1017840,
+  1017850,
+  1017870,
+  1017890,
+  1017910,
+  1017920,
+  1018050,
+  1018150,
+  1018151,
+  1018210,
+  1018230,
+  1018320,
+  1018330,
+  1018350,
+  1018360,
+  1018361,
+  1018362,
+  1018363,
+  1018364,
+  1018370,
+  1018400,
+  1018440,
+  1018460,
+  1018470,
+  1018480,
+  1018530,
+  1018590,
+  1018630,
+  1018670,
+  1018680,
+  1018760,
+  1018761,
+  1018890,
+  1019000,
+  1019010,
+  1019110,
+  1019120,
+  1019130,
+  1019132,
+  1019133,
+  1019200,
+  1019201,
+  1019210,
+  1019211,
+  1019213,
+  1019280,
+  1019290,
+  1019300,
+  1019320,
+  1019360,
+  1019380,
+  1019480,
+  1019481,
+  1019490,
+  1019491,
+  1019510,
+  1019511,
+  1019512,
+  1019513,
+  1019514,
+  1019515,
+  1019520,
+  1019521,
+  1019530,
+  1019540,
+  1019560,
+  1019640,
+  1019660,
+  1019830,
+  1019850,
+  1019930,
+  1019931,
+  1019950,
+  1019960,
+  1019961,
+  1019962,
+  1019963,
+  1019964,
+  1019965,
+  1019966,
+  1019967,
+  1019968,
+  1019969,
+  1019970,
+  1019971,
+  1019980,
+  1019981,
+  1019982,
+  1019983,
+  1019984,
+  1019985,
+  1019986,
+  1019987,
+  1019988,
+  1019989,
+  1019990,
+  1019991,
+  1019992,
+  1019993,
+  1019994,
+  1020020,
+  1020040,
+  1020070,
+  1020100,
+  1020140,
+  1020230,
+  1020290,
+  1020320,
+  1020350,
+  1020370,
+  1020380,
+  1020400,
+  1020460,
+  1020570,
+  1020571,
+  1020572,
+  1020630,
+  1020631,
+  1020820,
+  1020880,
+  1020990,
+  1021010,
+  1021011,
+  1021030,
+  1021080,
+  1021090,
+  1021110,
+  1021150,
+  1021160,
+  1021170,
+  1021190,
+  1021250,
+  1021280,
+  1021580,
+  1021740,
+  1021741,
+  1021742,
+  1021790,
+  1021830,
+  1021900,
+  1021901,
+  1021910,
+  1022060,
+  1022120,
+  1022190,
+  1022200,
+  1022230,
+  1022330,
+  1022340,
+  1022343,
+  1022344,
+  1022345,
+  1022350,
+  1022360,
+  1022361,
+  1022362,
+  1022365,
+  1022366,
+  1022367,
+  1022391,
+  1022392,
+  1022393,
+  1022394,
+  1022395,
+  1022396,
+  1022397,
+  1022400,
+  1022401,
+  1022402,
+  1022410,
+  1022411,
+  1022412,
+  1022413,
+  1022414,
+  1022415,
+  1022416,
+  1022417,
+  1022418,
+  1022419,
+  1022420,
+  1022421,
+  1022422,
+  1022423,
+  1022424,
+  1022425,
+  1022426,
+  1022427,
+  1022428,
+  1022429,
+  1022430,
+  1022431,
+  1022432,
+  1022433,
+  1022435,
+  1022436,
+  1022437,
+  1022438,
+  1022439,
+  1022440,
+  1022441,
+  1022442,
+  1022443,
+  1022444,
+  1022445,
+  1022446,
+  1022447,
+  1022448,
+  1022449,
+  1022460,
+  1022461,
+  1022462,
+  1022463,
+  1022464,
+  1022465,
+  1022466,
+  1022467,
+  1022468,
+  1022469,
+  1022470,
+  1022471,
+  1022472,
+  1022473,
+  1022474,
+  1022475,
+  1022476,
+  1022477,
+  1022478,
+  1022479,
+  1022490,
+  1022491,
+  1022492,
+  1022493,
+  1022494,
+  1022495,
+  1022496,
+  1022497,
+  1022498,
+  1022499,
+  1022500,
+  1022501,
+  1022502,
+  1022503,
+  1022504,
+  1022505,
+  1022506,
+  1022507,
+  1022508,
+  1022509,
+  1022510,
+  1022511,
+  1022512,
+  1022513,
+  1022514,
+  1022520,
+  1022540,
+  1022570,
+  1022590,
+  1022620,
+  1022690,
+  1022700,
+  1022720,
+  1022790,
+  1022830,
+  1022850,
+  1022910,
+  1023080,
+  1023160,
+  1023240,
+  1023270,
+  1023330,
+  1023340,
+  1023400,
+  1023440,
+  1023450,
+  1023540,
+  1023580,
+  1023620,
+  1023660,
+  1023670,
+  1023710,
+  1023770,
+  1023780,
+  1023801,
+  1023802,
+  1023920,
+  1023930,
+  1023940,
+  1023950,
+  1023990,
+  1024040,
+  1024050,
+  1024090,
+  1024110,
+  1024170,
+  1024171,
+  1024190,
+  1024240,
+  1024270,
+  1024360,
+  1024410,
+  1024550,
+  1024551,
+  1024554,
+  1024610,
+  1024620,
+  1024640,
+  1024660,
+  1024700,
+  1024701,
+  1024702,
+  1024703,
+  1024704,
+  1024710,
+  1024760,
+  1024770,
+  1024810,
+  1024870,
+  1024910,
+  1024912,
+  1024913,
+  1024914,
+  1024915,
+  1024920,
+  1025020,
+  1025030,
+  1025040,
+  1025060,
+  1025061,
+  1025090,
+  1025100,
+  1025190,
+  1025220,
+  1025280,
+  1025290,
+  1025340,
+  1025370,
+  1025380,
+  1025400,
+  1025490,
+  1025590,
+  1025640,
+  1025660,
+  1025680,
+  1025700,
+  1025730,
+  1025820,
+  1025910,
+  1026010,
+  1026090,
+  1026140,
+  1026150,
+  1026170,
+  1026171,
+  1026240,
+  1026340,
+  1026350,
+  1026410,
+  1026440,
+  1026450,
+  1026520,
+  1026630,
+  1026631,
+  1026640,
+  1026650,
+  1026651,
+  1026660,
+  1026740,
+  1026750,
+  1026800,
+  1026920,
+  1026930,
+  1026970,
+  1027220,
+  1027280,
+  1027580,
+  1027590,
+  1027640,
+  1027670,
+  1027760,
+  1027880,
+  1027920,
+  1027950,
+  1028070,
+  1028120,
+  1028200,
+  1028240,
+  1028260,
+  1028270,
+  1028290,
+  1028400,
+  1028420,
+  1028430,
+  1028530,
+  1028580,
+  1028650,
+  1028700,
+  1028701,
+  1028702,
+  1028703,
+  1028704,
+  1028705,
+  1028710,
+  1028711,
+  1028712,
+  1028720,
+  1028721,
+  1028790,
+  1028791,
+  1028792,
+  1028793,
+  1028794,
+  1028795,
+  1028870,
+  1028890,
+  1028891,
+  1028892,
+  1028893,
+  1028894,
+  1028895,
+  1028920,
+  1028970,
+  1029010,
+  1029090,
+  1029280,
+  1029290,
+  1029300,
+  1029301,
+  1029310,
+  1029311,
+  1029312,
+  1029320,
+  1029321,
+  1029322,
+  1029323,
+  1029330,
+  1029331,
+  1029350,
+  1029351,
+  1029352,
+  1029360,
+  1029361,
+  1029362,
+  1029370,
+  1029371,
+  1029372,
+  1029390,
+  1029391,
+  1029392,
+  1029400,
+  1029401,
+  1029402,
+  1029410,
+  1029411,
+  1029412,
+  1029430,
+  1029431,
+  1029432,
+  1029440,
+  1029441,
+  1029450,
+  1029451,
+  1029480,
+  1029481,
+  1029680,
+  1029720,
+  1029810,
+  1029820,
+  1029940,
+  1030050,
+  1030220,
+  1030221,
+  1030222,
+  1030223,
+  1030230,
+  1030270,
+  1030400,
+  1030401,
+  1030402,
+  1030420,
+  1030500,
+  1030560,
+  1030561,
+  1030562,
+  1030563,
+  1030590,
+  1030610,
+  1030620,
+  1030630,
+  1030640,
+  1030650,
+  1030660,
+  1030670,
+  1030680,
+  1030690,
+  1030700,
+  1030710,
+  1030720,
+  1030800,
+  1030980,
+  1031030,
+  1031190,
+  1031300,
+  1031340,
+  1031410,
+  1031420,
+  1031421,
+  1031450,
+  1031520,
+  1031530,
+  1031600,
+  1031620,
+  1031680,
+  1031690,
+  1031720,
+  1031740,
+  1031750,
+  1031940,
+  1031950,
+  1032030,
+  1032050,
+  1032150,
+  1032180,
+  1032190,
+  1032200,
+  1032290,
+  1032300,
+  1032330,
+  1032370,
+  1032390,
+  1032410,
+  1032460,
+  1032490,
+  1032620,
+  1032630,
+  1032760,
+  1032800,
+  1032801,
+  1032840,
+  1032850,
+  1032860,
+  1032870,
+  1032880,
+  1032890,
+  1032900,
+  1032910,
+  1032920,
+  1032930,
+  1032940,
+  1032950,
+  1032960,
+  1033040,
+  1033050,
+  1033060,
+  1033070,
+  1033200,
+  1033260,
+  1033270,
+  1033460,
+  1033470,
+  1033471,
+  1033472,
+  1033473,
+  1033474,
+  1033475,
+  1033476,
+  1033477,
+  1033478,
+  1033479,
+  1033480,
+  1033481,
+  1033482,
+  1033483,
+  1033484,
+  1033485,
+  1033486,
+  1033487,
+  1033488,
+  1033489,
+  1033490,
+  1033491,
+  1033492,
+  1033500,
+  1033501,
+  1033502,
+  1033503,
+  1033520,
+  1033521,
+  1033522,
+  1033530,
+  1033620,
+  1033621,
+  1033760,
+  1033790,
+  1033800,
+  1033820,
+  1033840,
+  1033870,
+  1033890,
+  1033900,
+  1033920,
+  1034000,
+  1034010,
+  1034080,
+  1034090,
+  1034100,
+  1034290,
+  1034291,
+  1034292,
+  1034450,
+  1034470,
+  1034471,
+  1034480,
+  1034481,
+  1034482,
+  1034483,
+  1034484,
+  1034500,
+  1034510,
+  1034511,
+  1034550,
+  1034630,
+  1034640,
+  1034720,
+  1034760,
+  1034770,
+  1034780,
+  1034800,
+  1034970,
+  1035000,
+  1035020,
+  1035130,
+  1035150,
+  1035170,
+  1035180,
+  1035230,
+  1035340,
+  1035360,
+  1035380,
+  1035390,
+  1035391,
+  1035420,
+  1035480,
+  1035520,
+  1035540,
+  1035580,
+  1035670,
+  1035680,
+  1035720,
+  1035810,
+  1035910,
+  1036020,
+  1036040,
+  1036050,
+  1036090,
+  1036100,
+  1036110,
+  1036112,
+  1036114,
+  1036116,
+  1036117,
+  1036180,
+  1036181,
+  1036220,
+  1036380,
+  1036390,
+  1036410,
+  1036450,
+  1036470,
+  1036480,
+  1036510,
+  1036760,
+  1036770,
+  1036771,
+  1036790,
+  1036791,
+  1036792,
+  1036793,
+  1036794,
+  1036795,
+  1036796,
+  1036797,
+  1036798,
+  1036799,
+  1036810,
+  1037050,
+  1037060,
+  1037160,
+  1037180,
+  1037200,
+  1037300,
+  1037360,
+  1037370,
+  1037450,
+  1037451,
+  1037510,
+  1037520,
+  1037620,
+  1037630,
+  1037640,
+  1037650,
+  1037660,
+  1037670,
+  1037680,
+  1037700,
+  1037710,
+  1037720,
+  1037730,
+  1037860,
+  1037870,
+  1037890,
+  1038000,
+  1038040,
+  1038060,
+  1038090,
+  1038130,
+  1038140,
+  1038150,
+  1038170,
+  1038180,
+  1038190,
+  1038200,
+  1038210,
+  1038220,
+  1038240,
+  1038260,
+  1038330,
+  1038400,
+  1038500,
+  1038510,
+  1038530,
+  1038550,
+  1038560,
+  1038700,
+  1038710,
+  1038720,
+  1038730,
+  1038760,
+  1038770,
+  1038790,
+  1038800,
+  1038860,
+  1038870,
+  1038880,
+  1038890,
+  1038900,
+  1038910,
+  1038920,
+  1038930,
+  1038940,
+  1038950,
+  1038960,
+  1038970,
+  1038980,
+  1038990,
+  1039000,
+  1039010,
+  1039020,
+  1039030,
+  1039031,
+  1039090,
+  1039110,
+  1039130,
+  1039170,
+  1039210,
+  1039230,
+  1039250,
+  1039390,
+  1039420,
+  1039450,
+  1039490,
+  1039500,
+  1039520,
+  1039530,
+  1039640,
+  1039660,
+  1039670,
+  1039680,
+  1039700,
+  1039720,
+  1039730,
+  1039740,
+  1039760,
+  1039780,
+  1039811,
+  1039840,
+  1039850,
+  1039920,
+  1039930,
+  1039980,
+  1039990,
+  1040010,
+  1040020,
+  1040030,
+  1040040,
+  1040041,
+  1040042,
+  1040100,
+  1040110,
+  1040120,
+  1040130,
+  1040170,
+  1040180,
+  1040210,
+  1040300,
+  1040320,
+  1040330,
+  1040350,
+  1040360,
+  1040410,
+  1040500,
+  1040501,
+  1040640,
+  1040670,
+  1040680,
+  1040690,
+  1040700,
+  1040760,
+  1040880,
+  1040930,
+  1040950,
+  1041000,
+  1041010,
+  1041171,
+  1041172,
+  1041173,
+  1041240,
+  1041290,
+  1041350,
+  1041360,
+  1041370,
+  1041380,
+  1041430,
+  1041440,
+  1041460,
+  1041480,
+  1041490,
+  1041530,
+  1041540,
+  1041640,
+  1041740,
+  1041750,
+  1041790,
+  1041820,
+  1041830,
+  1041831,
+  1041860,
+  1042040,
+  1042050,
+  1042220,
+  1042360,
+  1042370,
+  1042390,
+  1042400,
+  1042420,
+  1042440,
+  1042450,
+  1042480,
+  1042540,
+  1042580,
+  1042640,
+  1042710,
+  1042720,
+  1042730,
+  1042731,
+  1042740,
+  1042741,
+  1042760,
+  1042770,
+  1042790,
+  1042791,
+  1042792,
+  1042810,
+  1042811,
+  1042812,
+  1042813,
+  1042850,
+  1042851,
+  1042870,
+  1042950,
+  1043010,
+  1043250,
+  1043270,
+  1043280,
+  1043290,
+  1043300,
+  1043420,
+  1043550,
+  1043660,
+  1043820,
+  1043930,
+  1043940,
+  1043950,
+  1043960,
+  1043970,
+  1043980,
+  1043990,
+  1044000,
+  1044140,
+  1044141,
+  1044160,
+  1044190,
+  1044230,
+  1044231,
+  1044232,
+  1044233,
+  1044234,
+  1044260,
+  1044270,
+  1044400,
+  1044430,
+  1044440,
+  1044500,
+  1044510,
+  1044560,
+  1044570,
+  1044580,
+  1044590,
+  1044600,
+  1044610,
+  1044660,
+  1044661,
+  1044662,
+  1044680,
+  1044710,
+  1045031,
+  1045100,
+  1045170,
+  1045190,
+  1045230,
+  1045240,
+  1045290,
+  1045291,
+  1045320,
+  1045360,
+  1045410,
+  1045420,
+  1045440,
+  1045450,
+  1045470,
+  1045490,
+  1045500,
+  1045540,
+  1045550,
+  1045560,
+  1045600,
+  1045630,
+  1045690,
+  1045810,
+  1045820,
+  1045860,
+  1045861,
+  1045862,
+  1045863,
+  1045864,
+  1045865,
+  1045866,
+  1045867,
+  1045868,
+  1045869,
+  1045870,
+  1045871,
+  1045872,
+  1045873,
+  1045874,
+  1045875,
+  1045876,
+  1045877,
+  1045878,
+  1045879,
+  1045880,
+  1045890,
+  1045940,
+  1045960,
+  1045970,
+  1045980,
+  1045990,
+  1046000,
+  1046050,
+  1046080,
+  1046081,
+  1046082,
+  1046083,
+  1046084,
+  1046085,
+  1046086,
+  1046087,
+  1046088,
+  1046089,
+  1046090,
+  1046091,
+  1046092,
+  1046100,
+  1046180,
+  1046190,
+  1046220,
+  1046260,
+  1046280,
+  1046290,
+  1046310,
+  1046311,
+  1046312,
+  1046320,
+  1046321,
+  1046322,
+  1046340,
+  1046341,
+  1046342,
+  1046420,
+  1046440,
+  1046500,
+  1046540,
+  1046550,
+  1046610,
+  1046640,
+  1046680,
+  1046681,
+  1046682,
+  1046690,
+  1046720,
+  1046730,
+  1046770,
+  1046800,
+  1046801,
+  1046880,
+  1046900,
+  1046910,
+  1047040,
+  1047070,
+  1047150,
+  1047180,
+  1047200,
+  1047201,
+  1047202,
+  1047230,
+  1047330,
+  1047400,
+  1047510,
+  1047650,
+  1047690,
+  1047710,
+  1047770,
+  1047880,
+  1047900,
+  1047940,
+  1047970,
+  1048050,
+  1048110,
+  1048140,
+  1048180,
+  1048340,
+  1048360,
+  1048380,
+  1048381,
+  1048430,
+  1048460,
+  1048770,
+  1048870,
+  1048871,
+  1048872,
+  1048873,
+  1048874,
+  1048875,
+  1048876,
+  1048877,
+  1048878,
+  1048879,
+  1048910,
+  1048930,
+  1048931,
+  1049020,
+  1049050,
+  1049120,
+  1049121,
+  1049170,
+  1049240,
+  1049290,
+  1049330,
+  1049340,
+  1049350,
+  1049430,
+  1049440,
+  1049460,
+  1049650,
+  1049700,
+  1049770,
+  1049790,
+  1049810,
+  1049900,
+  1049940,
+  1049980,
+  1049990,
+  1050040,
+  1050050,
+  1050060,
+  1050070,
+  1050090,
+  1050120,
+  1050121,
+  1050122,
+  1050330,
+  1050340,
+  1050360,
+  1050380,
+  1050390,
+  1050400,
+  1050401,
+  1050402,
+  1050410,
+  1050440,
+  1050450,
+  1050460,
+  1050480,
+  1050530,
+  1050550,
+  1050610,
+  1050611,
+  1050630,
+  1050640,
+  1050710,
+  1050711,
+  1050712,
+  1050713,
+  1050714,
+  1050715,
+  1050716,
+  1050717,
+  1050780,
+  1050790,
+  1050890,
+  1050920,
+  1050930,
+  1050940,
+  1050950,
+  1050960,
+  1050970,
+  1050980,
+  1050990,
+  1051000,
+  1051010,
+  1051020,
+  1051030,
+  1051050,
+  1051150,
+  1051380,
+  1051390,
+  1051391,
+  1051392,
+  1051430,
+  1051431,
+  1051432,
+  1051433,
+  1051434,
+  1051450,
+  1051460,
+  1051480,
+  1051520,
+  1051550,
+  1051620,
+  1051621,
+  1051650,
+  1051680,
+  1051700,
+  1051750,
+  1051770,
+  1051771,
+  1051780,
+  1051781,
+  1051790,
+  1051791,
+  1051910,
+  1051980,
+  1051981,
+  1051982,
+  1051983,
+  1051984,
+  1051985,
+  1051986,
+  1051987,
+  1051988,
+  1051989,
+  1052270,
+  1052271,
+  1052272,
+  1052273,
+  1052274,
+  1052275,
+  1052320,
+  1052330,
+  1052490,
+  1052520,
+  1052530,
+  1052570,
+  1052610,
+  1052620,
+  1052630,
+  1052680,
+  1052690,
+  1052700,
+  1052701,
+  1052730,
+  1052731,
+  1052740,
+  1052780,
+  1052820,
+  1052830,
+  1052860,
+  1052960,
+  1053050,
+  1053080,
+  1053130,
+  1053140,
+  1053180,
+  1053200,
+  1053210,
+  1053230,
+  1053240,
+  1053260,
+  1053310,
+  1053320,
+  1053550,
+  1053570,
+  1053580,
+  1053590,
+  1053760,
+  1053800,
+  1053810,
+  1053860,
+  1053980,
+  1053990,
+  1054000,
+  1054010,
+  1054020,
+  1054070,
+  1054071,
+  1054130,
+  1054140,
+  1054220,
+  1054230,
+  1054280,
+  1054330,
+  1054360,
+  1054480,
+  1054580,
+  1054670,
+  1054730,
+  1054780,
+  1054810,
+  1054830,
+  1054870,
+  1054871,
+  1054872,
+  1054873,
+  1054920,
+  1054921,
+  1054960,
+  1055010,
+  1055060,
+  1055061,
+  1055062,
+  1055063,
+  1055064,
+  1055065,
+  1055066,
+  1055067,
+  1055070,
+  1055071,
+  1055072,
+  1055073,
+  1055190,
+  1055200,
+  1055220,
+  1055230,
+  1055250,
+  1055260,
+  1055270,
+  1055290,
+  1055320,
+  1055331,
+  1055332,
+  1055333,
+  1055334,
+  1055335,
+  1055336,
+  1055338,
+  1055339,
+  1055390,
+  1055400,
+  1055410,
+  1055440,
+  1055550,
+  1055570,
+  1055580,
+  1055581,
+  1055582,
+  1055630,
+  1055650,
+  1055670,
+  1055680,
+  1055700,
+  1055710,
+  1055790,
+  1055810,
+  1055860,
+  1055861,
+  1055880,
+  1055900,
+  1055910,
+  1056090,
+  1056100,
+  1056150,
+  1056151,
+  1056152,
+  1056153,
+  1056154,
+  1056155,
+  1056156,
+  1056157,
+  1056158,
+  1056159,
+  1056190,
+  1056210,
+  1056220,
+  1056240,
+  1056241,
+  1056242,
+  1056243,
+  1056250,
+  1056270,
+  1056360,
+  1056400,
+  1056450,
+  1056530,
+  1056540,
+  1056620,
+  1056621,
+  1056622,
+  1056623,
+  1056624,
+  1056625,
+  1056626,
+  1056627,
+  1056628,
+  1056629,
+  1056630,
+  1056670,
+  1056730,
+  1056760,
+  1056761,
+  1056770,
+  1056780,
+  1056800,
+  1056950,
+  1056980,
+  1056990,
+  1057000,
+  1057020,
+  1057060,
+  1057070,
+  1057160,
+  1057220,
+  1057260,
+  1057261,
+  1057262,
+  1057263,
+  1057264,
+  1057265,
+  1057270,
+  1057271,
+  1057272,
+  1057273,
+  1057274,
+  1057275,
+  1057276,
+  1057277,
+  1057278,
+  1057279,
+  1057280,
+  1057281,
+  1057282,
+  1057283,
+  1057290,
+  1057320,
+  1057350,
+  1057470,
+  1057500,
+  1057670,
+  1057760,
+  1057840,
+  1057841,
+  1057880,
+  1057900,
+  1057910,
+  1057920,
+  1057970,
+  1058010,
+  1058011,
+  1058012,
+  1058013,
+  1058014,
+  1058015,
+  1058016,
+  1058017,
+  1058018,
+  1058120,
+  1058121,
+  1058170,
+  1058180,
+  1058190,
+  1058250,
+  1058260,
+  1058300,
+  1058360,
+  1058390,
+  1058420,
+  1058440,
+  1058460,
+  1058461,
+  1058462,
+  1058463,
+  1058520,
+  1058900,
+  1058960,
+  1058970,
+  1058990,
+  1059100,
+  1059140,
+  1059170,
+  1059250,
+  1059290,
+  1059291,
+  1059360,
+  1059480,
+  1059510,
+  1059590,
+  1059610,
+  1059630,
+  1059700,
+  1059720,
+  1059780,
+  1059790,
+  1059800,
+  1059820,
+  1059910,
+  1060120,
+  1060200,
+  1060270,
+  1060390,
+  1060391,
+  1060480,
+  1060481,
+  1060482,
+  1060483,
+  1060484,
+  1060485,
+  1060486,
+  1060487,
+  1060488,
+  1060489,
+  1060520,
+  1060610,
+  1060642,
+  1060650,
+  1060660,
+  1060680,
+  1060700,
+  1060730,
+  1060740,
+  1060780,
+  1060830,
+  1060860,
+  1060910,
+  1060990,
+  1061020,
+  1061030,
+  1061040,
+  1061050,
+  1061060,
+  1061070,
+  1061080,
+  1061081,
+  1061082,
+  1061083,
+  1061084,
+  1061140,
+  1061190,
+  1061310,
+  1061350,
+  1061380,
+  1061440,
+  1061441,
+  1061442,
+  1061443,
+  1061510,
+  1061511,
+  1061512,
+  1061513,
+  1061514,
+  1061515,
+  1061516,
+  1061517,
+  1061518,
+  1061520,
+  1061690,
+  1061700,
+  1061710,
+  1061720,
+  1061740,
+  1061750,
+  1061751,
+  1061752,
+  1061753,
+  1061754,
+  1061755,
+  1061756,
+  1061757,
+  1061760,
+  1061810,
+  1061820,
+  1061830,
+  1061960,
+  1062030,
+  1062150,
+  1062151,
+  1062152,
+  1062153,
+  1062154,
+  1062155,
+  1062156,
+  1062157,
+  1062158,
+  1062159,
+  1062170,
+  1062190,
+  1062230,
+  1062280,
+  1062281,
+  1062282,
+  1062283,
+  1062284,
+  1062300,
+  1062400,
+  1062410,
+  1062420,
+  1062440,
+  1062490,
+  1062491,
+  1062492,
+  1062510,
+  1062511,
+  1062512,
+  1062513,
+  1062514,
+  1062515,
+  1062570,
+  1062590,
+  1062610,
+  1062620,
+  1062980,
+  1062981,
+  1062982,
+  1062983,
+  1062984,
+  1062985,
+  1062986,
+  1062987,
+  1062988,
+  1062989,
+  1063150,
+  1063270,
+  1063400,
+  1063430,
+  1063450,
+  1063460,
+  1063480,
+  1063520,
+  1063640,
+  1063641,
+  1063642,
+  1063643,
+  1063644,
+  1063650,
+  1063651,
+  1063652,
+  1063653,
+  1063654,
+  1063780,
+  1063781,
+  1063880,
+  1063920,
+  1063921,
+  1063922,
+  1063923,
+  1064040,
+  1064180,
+  1064190,
+  1064191,
+  1064192,
+  1064210,
+  1064211,
+  1064212,
+  1064213,
+  1064214,
+  1064215,
+  1064216,
+  1064217,
+  1064218,
+  1064219,
+  1064220,
+  1064221,
+  1064230,
+  1064240,
+  1064270,
+  1064271,
+  1064272,
+  1064273,
+  1064500,
+  1064550,
+  1064560,
+  1064570,
+  1064630,
+  1064720,
+  1064740,
+  1064760,
+  1064780,
+  1064810,
+  1064820,
+  1064970,
+  1064980,
+  1064981,
+  1065120,
+  1065121,
+  1065122,
+  1065123,
+  1065130,
+  1065131,
+  1065132,
+  1065133,
+  1065134,
+  1065135,
+  1065140,
+  1065150,
+  1065220,
+  1065221,
+  1065240,
+  1065280,
+  1065290,
+  1065370,
+  1065490,
+  1065491,
+  1065500,
+  1065510,
+  1065540,
+  1065600,
+  1065620,
+  1065621,
+  1065622,
+  1065623,
+  1065624,
+  1065625,
+  1065660,
+  1065661,
+  1065730,
+  1065820,
+  1066050,
+  1066060,
+  1066100,
+  1066101,
+  1066110,
+  1066120,
+  1066121,
+  1066122,
+  1066150,
+  1066190,
+  1066250,
+  1066280,
+  1066300,
+  1066320,
+  1066330,
+  1066340,
+  1066350,
+  1066510,
+  1066540,
+  1066570,
+  1066710,
+  1066830,
+  1066850,
+  1066851,
+  1066852,
+  1066853,
+  1066860,
+  1066920,
+  1067010,
+  1067150,
+  1067160,
+  1067210,
+  1067230,
+  1067340,
+  1067471,
+  1067476,
+  1067530,
+  1067590,
+  1067630,
+  1067680,
+  1067690,
+  1067710,
+  1067750,
+  1067770,
+  1067830,
+  1067910,
+  1067920,
+  1067921,
+  1067980,
+  1067990,
+  1068000,
+  1068080,
+  1068081,
+  1068082,
+  1068083,
+  1068084,
+  1068085,
+  1068160,
+  1068260,
+  1068290,
+  1068300,
+  1068400,
+  1068550,
+  1068610,
+  1068620,
+  1068710,
+  1068740,
+  1068741,
+  1068742,
+  1068743,
+  1068744,
+  1068750,
+  1068751,
+  1068752,
+  1068753,
+  1068754,
+  1068760,
+  1068810,
+  1068820,
+  1068890,
+  1068930,
+  1068931,
+  1068940,
+  1068941,
+  1068950,
+  1068951,
+  1068960,
+  1068961,
+  1068962,
+  1068963,
+  1069020,
+  1069021,
+  1069022,
+  1069023,
+  1069024,
+  1069025,
+  1069026,
+  1069027,
+  1069028,
+  1069029,
+  1069040,
+  1069041,
+  1069042,
+  1069043,
+  1069044,
+  1069045,
+  1069046,
+  1069047,
+  1069048,
+  1069049,
+  1069090,
+  1069330,
+  1069410,
+  1069420,
+  1069421,
+  1069422,
+  1069450,
+  1069550,
+  1069552,
+  1069580,
+  1069581,
+  1069600,
+  1069630,
+  1069700,
+  1069730,
+  1069790,
+  1069990,
+  1070000,
+  1070040,
+  1070050,
+  1070051,
+  1070052,
+  1070053,
+  1070054,
+  1070055,
+  1070056,
+  1070057,
+  1070058,
+  1070059,
+  1070060,
+  1070120,
+  1070121,
+  1070122,
+  1070123,
+  1070130,
+  1070131,
+  1070132,
+  1070140,
+  1070141,
+  1070142,
+  1070170,
+  1070200,
+  1070470,
+  1070520,
+  1070560,
+  1070600,
+  1070601,
+  1070602,
+  1070603,
+  1070604,
+  1070605,
+  1070606,
+  1070610,
+  1070620,
+  1070630,
+  1070640,
+  1070650,
+  1070660,
+  1070661,
+  1070662,
+  1070663,
+  1070664,
+  1070670,
+  1070680,
+  1070700,
+  1070701,
+  1070702,
+  1070703,
+  1070704,
+  1070705,
+  1070706,
+  1070707,
+  1070720,
+  1070740,
+  1070910,
+  1071050,
+  1071051,
+  1071100,
+  1071110,
+  1071200,
+  1071210,
+  1071230,
+  1071340,
+  1071370,
+  1071371,
+  1071372,
+  1071373,
+  1071374,
+  1071375,
+  1071376,
+  1071377,
+  1071378,
+  1071379,
+  1071390,
+  1071391,
+  1071392,
+  1071393,
+  1071394,
+  1071395,
+  1071396,
+  1071400,
+  1071420,
+  1071430,
+  1071460,
+  1071470,
+  1071480,
+  1071560,
+  1071670,
+  1071690,
+  1071750,
+  1071780,
+  1071810,
+  1071820,
+  1071860,
+  1071930,
+  1071960,
+  1071980,
+  1072020,
+  1072063,
+  1072200,
+  1072220,
+  1072221,
+  1072222,
+  1072230,
+  1072360,
+  1072380,
+  1072410,
+  1072430,
+  1072450,
+  1072460,
+  1072520,
+  1072560,
+  1072561,
+  1072562,
+  1072630,
+  1072680,
+  1072681,
+  1072690,
+  1073000,
+  1073090,
+  1073160,
+  1073180,
+  1073200,
+  1073420,
+  1073520,
+  1073560,
+  1073570,
+  1073580,
+  1073630,
+  1073650,
+  1073660,
+  1073680,
+  1073681,
+  1073720,
+  1073730,
+  1073930,
+  1074050,
+  1074090,
+  1074100,
+  1074110,
+  1074200,
+  1074201,
+  1074202,
+  1074203,
+  1074204,
+  1074205,
+  1074206,
+  1074207,
+  1074208,
+  1074209,
+  1074210,
+  1074211,
+  1074212,
+  1074213,
+  1074214,
+  1074215,
+  1074216,
+  1074217,
+  1074218,
+  1074219,
+  1074260,
+  1074261,
+  1074262,
+  1074263,
+  1074264,
+  1074265,
+  1074266,
+  1074267,
+  1074270,
+  1074271,
+  1074272,
+  1074273,
+  1074274,
+  1074275,
+  1074276,
+  1074277,
+  1074320,
+  1074321,
+  1074360,
+  1074420,
+  1074560,
+  1074590,
+  1074600,
+  1074650,
+  1074660,
+  1074850,
+  1074870,
+  1074880,
+  1074900,
+  1074910,
+  1074920,
+  1074930,
+  1074980,
+  1075010,
+  1075040,
+  1075041,
+  1075100,
+  1075101,
+  1075102,
+  1075103,
+  1075104,
+  1075105,
+  1075150,
+  1075180,
+  1075210,
+  1075220,
+  1075230,
+  1075240,
+  1075250,
+  1075260,
+  1075270,
+  1075280,
+  1075290,
+  1075300,
+  1075310,
+  1075320,
+  1075330,
+  1075380,
+  1075381,
+  1075382,
+  1075410,
+  1075450,
+  1075451,
+  1075452,
+  1075453,
+  1075460,
+  1075470,
+  1075520,
+  1075521,
+  1075590,
+  1075600,
+  1075610,
+  1075620,
+  1075630,
+  1075640,
+  1075650,
+  1075660,
+  1075670,
+  1075680,
+  1075690,
+  1075700,
+  1075710,
+  1075720,
+  1075770,
+  1075820,
+  1075840,
+  1075850,
+  1075860,
+  1075870,
+  1075890,
+  1075920,
+  1075970,
+  1075990,
+  1075991,
+  1075993,
+  1075994,
+  1075995,
+  1075996,
+  1075997,
+  1075998,
+  1075999,
+  1076000,
+  1076010,
+  1076011,
+  1076012,
+  1076013,
+  1076014,
+  1076015,
+  1076080,
+  1076090,
+  1076091,
+  1076092,
+  1076150,
+  1076170,
+  1076190,
+  1076380,
+  1076420,
+  1076430,
+  1076460,
+  1076470,
+  1076580,
+  1076630,
+  1076650,
+  1076660,
+  1076670,
+  1076680,
+  1076690,
+  1076700,
+  1076710,
+  1076740,
+  1076741,
+  1076760,
+  1076761,
+  1076820,
+  1076840,
+  1076850,
+  1076860,
+  1076870,
+  1076890,
+  1076930,
+  1077060,
+  1077070,
+  1077170,
+  1077180,
+  1077240,
+  1077280,
+  1077370,
+  1077371,
+  1077372,
+  1077373,
+  1077610,
+  1077690,
+  1077700,
+  1077710,
+  1077780,
+  1077790,
+  1077800,
+  1077810,
+  1077820,
+  1077830,
+  1077840,
+  1077900,
+  1077910,
+  1077920,
+  1077930,
+  1077940,
+  1077950,
+  1077960,
+  1077980,
+  1077990,
+  1078010,
+  1078020,
+  1078030,
+  1078070,
+  1078100,
+  1078150,
+  1078170,
+  1078190,
+  1078220,
+  1078400,
+  1078740,
+  1078741,
+  1078810,
+  1078840,
+  1078850,
+  1078851,
+  1078852,
+  1078860,
+  1078890,
+  1079070,
+  1079090,
+  1079120,
+  1079180,
+  1079190,
+  1079220,
+  1079221,
+  1079240,
+  1079350,
+  1079360,
+  1079390,
+  1079400,
+  1079460,
+  1079490,
+  1079520,
+  1079670,
+  1079671,
+  1079690,
+  1079710,
+  1079750,
+  1079880,
+  1079920,
+  1079930,
+  1079990,
+  1080000,
+  1080001,
+  1080002,
+  1080030,
+  1080031,
+  1080032,
+  1080070,
+  1080080,
+  1080140,
+  1080190,
+  1080220,
+  1080230,
+  1080270,
+  1080280,
+  1080320,
+  1080420,
+  1080430,
+  1080460,
+  1080470,
+  1080480,
+  1080510,
+  1080520,
+  1080550,
+  1080570,
+  1080580,
+  1080590,
+  1080591,
+  1080600,
+  1080610,
+  1080710,
+  1080720,
+  1080770,
+  1080810,
+  1080840,
+  1080880,
+  1080890,
+  1080900,
+  1080910,
+  1080911,
+  1080940,
+  1080970,
+  1081000,
+  1081270,
+  1081520,
+  1081660,
+  1081690,
+  1081730,
+  1081750,
+  1081770,
+  1081920,
+  1081970,
+  1082020,
+  1082030,
+  1082031,
+  1082032,
+  1082040,
+  1082050,
+  1082070,
+  1082120,
+  1082150,
+  1082160,
+  1082161,
+  1082170,
+  1082171,
+  1082172,
+  1082210,
+  1082230,
+  1082250,
+  1082300,
+  1082310,
+  1082320,
+  1082330,
+  1082350,
+  1082351,
+  1082352,
+  1082353,
+  1082354,
+  1082355,
+  1082356,
+  1082357,
+  1082358,
+  1082359,
+  1082370,
+  1082390,
+  1082420,
+  1082570,
+  1082571,
+  1082572,
+  1082573,
+  1082574,
+  1082575,
+  1082576,
+  1082577,
+  1082578,
+  1082579,
+  1082580,
+  1082581,
+  1082582,
+  1082610,
+  1082660,
+  1082661,
+  1082662,
+  1082790,
+  1082800,
+  1082810,
+  1082820,
+  1082830,
+  1082840,
+  1082920,
+  1083020,
+  1083060,
+  1083090,
+  1083100,
+  1083130,
+  1083220,
+  1083250,
+  1083280,
+  1083281,
+  1083282,
+  1083283,
+  1083340,
+  1083590,
+  1083670,
+  1083770,
+  1083830,
+  1083831,
+  1083832,
+  1083833,
+  1083890,
+  1083900,
+  1083910,
+  1083970,
+  1083971,
+  1083980,
+  1084060,
+  1084070,
+  1084071,
+  1084072,
+  1084073,
+  1084100,
+  1084110,
+  1084210,
+  1084410,
+  1084430,
+  1084470,
+  1084510,
+  1084650,
+  1084651,
+  1084680,
+  1084700,
+  1084701,
+  1084820,
+  1084860,
+  1084900,
+  1084940,
+  1084950,
+  1084960,
+  1085200,
+  1085320,
+  1085360,
+  1085400,
+  1085410,
+  1085440,
+  1085450,
+  1085460,
+  1085470,
+  1085480,
+  1085490,
+  1085500,
+  1085550,
+  1085580,
+  1085590,
+  1085600,
+  1085650,
+  1085690,
+  1085700,
+  1085710,
+  1085740,
+  1085760,
+  1085960,
+  1086040,
+  1086190,
+  1086240,
+  1086320,
+  1086350,
+  1086480,
+  1086481,
+  1086570,
+  1086600,
+  1086610,
+  1086650,
+  1086730,
+  1086740,
+  1086760,
+  1086870,
+  1086890,
+  1086920,
+  1086930,
+  1087000,
+  1087010,
+  1087011,
+  1087080,
+  1087120,
+  1087121,
+  1087122,
+  1087123,
+  1087130,
+  1087131,
+  1087290,
+  1087300,
+  1087320,
+  1087340,
+  1087420,
+  1087421,
+  1087422,
+  1087423,
+  1087424,
+  1087425,
+  1087426,
+  1087427,
+  1087428,
+  1087429,
+  1087450,
+  1087451,
+  1087510,
+  1087590,
+  1087650,
+  1087680,
+  1087710,
+  1087740,
+  1087830,
+  1087840,
+  1087850,
+  1087860,
+  1087870,
+  1087890,
+  1087900,
+  1088000,
+  1088020,
+  1088080,
+  1088081,
+  1088120,
+  1088210,
+  1088220,
+  1088230,
+  1088280,
+  1088290,
+  1088310,
+  1088320,
+  1088330,
+  1088340,
+  1088350,
+  1088410,
+  1088450,
+  1088480,
+  1088481,
+  1088482,
+  1088483,
+  1088484,
+  1088485,
+  1088486,
+  1088487,
+  1088488,
+  1088489,
+  1088490,
+  1088491,
+  1088492,
+  1088493,
+  1088494,
+  1088495,
+  1088496,
+  1088497,
+  1088498,
+  1088499,
+  1088640,
+  1088680,
+  1088700,
+  1088740,
+  1088780,
+  1088820,
+  1088930,
+  1088940,
+  1088941,
+  1088942,
+  1088943,
+  1088944,
+  1088945,
+  1088946,
+  1088947,
+  1088948,
+  1088949,
+  1089000,
+  1089020,
+  1089040,
+  1089150,
+  1089160,
+  1089161,
+  1089162,
+  1089163,
+  1089164,
+  1089165,
+  1089166,
+  1089167,
+  1089168,
+  1089169,
+  1089170,
+  1089171,
+  1089172,
+  1089173,
+  1089174,
+  1089175,
+  1089176,
+  1089177,
+  1089178,
+  1089179,
+  1089180,
+  1089181,
+  1089182,
+  1089183,
+  1089184,
+  1089185,
+  1089186,
+  1089187,
+  1089188,
+  1089189,
+  1089190,
+  1089191,
+  1089192,
+  1089193,
+  1089194,
+  1089195,
+  1089196,
+  1089197,
+  1089198,
+  1089199,
+  1089200,
+  1089201,
+  1089202,
+  1089203,
+  1089204,
+  1089205,
+  1089206,
+  1089207,
+  1089208,
+  1089209,
+  1089210,
+  1089211,
+  1089212,
+  1089213,
+  1089214,
+  1089215,
+  1089216,
+  1089217,
+  1089218,
+  1089219,
+  1089220,
+  1089221,
+  1089222,
+  1089223,
+  1089225,
+  1089226,
+  1089227,
+  1089228,
+  1089229,
+  1089230,
+  1089231,
+  1089232,
+  1089233,
+  1089234,
+  1089235,
+  1089236,
+  1089237,
+  1089238,
+  1089239,
+  1089240,
+  1089241,
+  1089242,
+  1089243,
+  1089244,
+  1089245,
+  1089246,
+  1089270,
+  1089280,
+  1089281,
+  1089300,
+  1089320,
+  1089390,
+  1089410,
+  1089420,
+  1089421,
+  1089422,
+  1089440,
+  1089441,
+  1089442,
+  1089450,
+  1089560,
+  1089580,
+  1089581,
+  1089620,
+  1089670,
+  1089671,
+  1089672,
+  1089730,
+  1089740,
+  1089750,
+  1089850,
+  1089851,
+  1089852,
+  1089853,
+  1089910,
+  1089940,
+  1090090,
+  1090091,
+  1090092,
+  1090093,
+  1090094,
+  1090095,
+  1090096,
+  1090110,
+  1090130,
+  1090140,
+  1090141,
+  1090150,
+  1090151,
+  1090152,
+  1090160,
+  1090161,
+  1090162,
+  1090163,
+  1090164,
+  1090165,
+  1090166,
+  1090167,
+  1090170,
+  1090171,
+  1090180,
+  1090181,
+  1090182,
+  1090184,
+  1090200,
+  1090201,
+  1090202,
+  1090241,
+  1090310,
+  1090320,
+  1090330,
+  1090500,
+  1090550,
+  1090570,
+  1090600,
+  1090601,
+  1090602,
+  1090603,
+  1090604,
+  1090605,
+  1090606,
+  1090607,
+  1090608,
+  1090609,
+  1090610,
+  1090611,
+  1090612,
+  1090620,
+  1090640,
+  1090730,
+  1090830,
+  1090850,
+  1090860,
+  1090880,
+  1090950,
+  1090970,
+  1090990,
+  1091060,
+  1091120,
+  1091150,
+  1091160,
+  1091220,
+  1091290,
+  1091291,
+  1091300,
+  1091420,
+  1091430,
+  1091450,
+  1091480,
+  1091490,
+  1091610,
+  1091630,
+  1091650,
+  1091680,
+  1091760,
+  1091770,
+  1091780,
+  1091790,
+  1091800,
+  1091810,
+  1091820,
+  1091830,
+  1091850,
+  1091851,
+  1092030,
+  1092200,
+  1092240,
+  1092250,
+  1092291,
+  1092310,
+  1092330,
+  1092490,
+  1092520,
+  1092640,
+  1092690,
+  1092691,
+  1092692,
+  1092693,
+  1092694,
+  1092695,
+  1092820,
+  1092840,
+  1092860,
+  1092880,
+  1092890,
+  1093000,
+  1093040,
+  1093060,
+  1093190,
+  1093230,
+  1093250,
+  1093260,
+  1093310,
+  1093340,
+  1093400,
+  1093410,
+  1093430,
+  1093431,
+  1093530,
+  1093560,
+  1093570,
+  1093580,
+  1093590,
+  1093600,
+  1093610,
+  1093620,
+  1093630,
+  1093640,
+  1093700,
+  1093730,
+  1093880,
+  1093940,
+  1093941,
+  1093980,
+  1093990,
+  1094040,
+  1094160,
+  1094180,
+  1094181,
+  1094182,
+  1094183,
+  1094184,
+  1094185,
+  1094186,
+  1094187,
+  1094200,
+  1094210,
+  1094220,
+  1094280,
+  1094281,
+  1094282,
+  1094283,
+  1094284,
+  1094285,
+  1094300,
+  1094310,
+  1094350,
+  1094430,
+  1094480,
+  1094490,
+  1094500,
+  1094550,
+  1094560,
+  1094700,
+  1094740,
+  1094750,
+  1094800,
+  1094810,
+  1094840,
+  1094860,
+  1094900,
+  1094940,
+  1095030,
+  1095031,
+  1095050,
+  1095250,
+  1095330,
+  1095340,
+  1095410,
+  1095420,
+  1095430,
+  1095440,
+  1095470,
+  1095500,
+  1095621,
+  1095622,
+  1095624,
+  1095626,
+  1095690,
+  1095720,
+  1095721,
+  1095770,
+  1095780,
+  1095900,
+  1095930,
+  1095960,
+  1096020,
+  1096030,
+  1096040,
+  1096050,
+  1096080,
+  1096081,
+  1096190,
+  1096220,
+  1096320,
+  1096321,
+  1096350,
+  1096450,
+  1096451,
+  1096460,
+  1096540,
+  1096550,
+  1096580,
+  1096680,
+  1096830,
+  1096840,
+  1096850,
+  1096860,
+  1096890,
+  1096900,
+  1096940,
+  1097080,
+  1097140,
+  1097190,
+  1097220,
+  1097222,
+  1097223,
+  1097224,
+  1097290,
+  1097320,
+  1097390,
+  1097391,
+  1097392,
+  1097450,
+  1097510,
+  1097640,
+  1097890,
+  1097891,
+  1097892,
+  1097893,
+  1097894,
+  1097895,
+  1097896,
+  1097930,
+  1097970,
+  1097980,
+  1097990,
+  1098030,
+  1098120,
+  1098121,
+  1098160,
+  1098161,
+  1098162,
+  1098163,
+  1098164,
+  1098165,
+  1098166,
+  1098167,
+  1098240,
+  1098290,
+  1098291,
+  1098292,
+  1098293,
+  1098300,
+  1098301,
+  1098310,
+  1098350,
+  1098420,
+  1098520,
+  1098580,
+  1098820,
+  1098850,
+  1098860,
+  1098880,
+  1098950,
+  1098970,
+  1099120,
+  1099121,
+  1099122,
+  1099130,
+  1099190,
+  1099191,
+  1099200,
+  1099201,
+  1099202,
+  1099203,
+  1099210,
+  1099211,
+  1099212,
+  1099213,
+  1099214,
+  1099215,
+  1099216,
+  1099230,
+  1099231,
+  1099232,
+  1099233,
+  1099240,
+  1099241,
+  1099260,
+  1099261,
+  1099262,
+  1099263,
+  1099264,
+  1099270,
+  1099271,
+  1099272,
+  1099273,
+  1099280,
+  1099281,
+  1099282,
+  1099283,
+  1099290,
+  1099291,
+  1099292,
+  1099293,
+  1099294,
+  1099300,
+  1099301,
+  1099302,
+  1099303,
+  1099304,
+  1099305,
+  1099310,
+  1099311,
+  1099312,
+  1099313,
+  1099314,
+  1099315,
+  1099316,
+  1099320,
+  1099330,
+  1099340,
+  1099341,
+  1099342,
+  1099343,
+  1099344,
+  1099345,
+  1099350,
+  1099351,
+  1099352,
+  1099360,
+  1099361,
+  1099362,
+  1099363,
+  1099364,
+  1099365,
+  1099370,
+  1099371,
+  1099372,
+  1099373,
+  1099380,
+  1099390,
+  1099391,
+  1099392,
+  1099393,
+  1099400,
+  1099420,
+  1099421,
+  1099422,
+  1099550,
+  1099560,
+  1099561,
+  1099562,
+  1099563,
+  1099580,
+  1099581,
+  1099582,
+  1099583,
+  1099584,
+  1099585,
+  1099590,
+  1099591,
+  1099592,
+  1099593,
+  1099594,
+  1099595,
+  1099597,
+  1099600,
+  1099620,
+  1099850,
+  1099940,
+  1100020,
+  1100060,
+  1100090,
+  1100120,
+  1100130,
+  1100220,
+  1100250,
+  1100330,
+  1100380,
+  1100480,
+  1100550,
+  1100740,
+  1100741,
+  1100750,
+  1100760,
+  1100770,
+  1100780,
+  1100781,
+  1100782,
+  1100783,
+  1100784,
+  1100785,
+  1100787,
+  1100788,
+  1100789,
+  1100790,
+  1100791,
+  1100792,
+  1100793,
+  1100794,
+  1100795,
+  1100796,
+  1100797,
+  1100810,
+  1100820,
+  1100960,
+  1101110,
+  1101150,
+  1101160,
+  1101300,
+  1101350,
+  1101351,
+  1101500,
+  1101570,
+  1101590,
+  1101710,
+  1101711,
+  1101712,
+  1101720,
+  1101730,
+  1101740,
+  1101750,
+  1101810,
+  1101830,
+  1101870,
+  1101880,
+  1101890,
+  1101970,
+  1102090,
+  1102160,
+  1102310,
+  1102320,
+  1102321,
+  1102322,
+  1102323,
+  1102330,
+  1102360,
+  1102380,
+  1102420,
+  1102430,
+  1102440,
+  1102450,
+  1102480,
+  1102520,
+  1102530,
+  1102540,
+  1102590,
+  1102600,
+  1102610,
+  1102620,
+  1102630,
+  1102640,
+  1102660,
+  1102670,
+  1102671,
+  1102770,
+  1102840,
+  1102850,
+  1102860,
+  1102861,
+  1102900,
+  1102901,
+  1102910,
+  1102920,
+  1102921,
+  1102922,
+  1103140,
+  1103230,
+  1103240,
+  1103260,
+  1103270,
+  1103370,
+  1103420,
+  1103440,
+  1103441,
+  1103670,
+  1103680,
+  1103710,
+  1103711,
+  1103720,
+  1103740,
+  1103741,
+  1103742,
+  1103750,
+  1103751,
+  1103752,
+  1103830,
+  1103840,
+  1103910,
+  1103990,
+  1104070,
+  1104130,
+  1104260,
+  1104270,
+  1104360,
+  1104410,
+  1104420,
+  1104560,
+  1104680,
+  1104750,
+  1104760,
+  1104810,
+  1104820,
+  1104860,
+  1104880,
+  1104970,
+  1105010,
+  1105030,
+  1105050,
+  1105060,
+  1105180,
+  1105190,
+  1105290,
+  1105320,
+  1105321,
+  1105322,
+  1105323,
+  1105350,
+  1105360,
+  1105370,
+  1105371,
+  1105380,
+  1105400,
+  1105450,
+  1105541,
+  1105542,
+  1105630,
+  1105640,
+  1105750,
+  1105760,
+  1105790,
+  1105800,
+  1105820,
+  1105830,
+  1105840,
+  1105880,
+  1105890,
+  1105950,
+  1105951,
+  1106000,
+  1106010,
+  1106011,
+  1106012,
+  1106013,
+  1106020,
+  1106021,
+  1106022,
+  1106023,
+  1106070,
+  1106071,
+  1106072,
+  1106073,
+  1106100,
+  1106120,
+  1106130,
+  1106170,
+  1106180,
+  1106190,
+  1106220,
+  1106221,
+  1106222,
+  1106223,
+  1106224,
+  1106225,
+  1106226,
+  1106227,
+  1106228,
+  1106230,
+  1106231,
+  1106232,
+  1106233,
+  1106234,
+  1106235,
+  1106236,
+  1106237,
+  1106238,
+  1106239,
+  1106240,
+  1106241,
+  1106242,
+  1106243,
+  1106250,
+  1106251,
+  1106260,
+  1106280,
+  1106290,
+  1106300,
+  1106310,
+  1106320,
+  1106321,
+  1106360,
+  1106361,
+  1106362,
+  1106363,
+  1106370,
+  1106371,
+  1106380,
+  1106381,
+  1106390,
+  1106391,
+  1106400,
+  1106410,
+  1106420,
+  1106430,
+  1106440,
+  1106450,
+  1106451,
+  1106452,
+  1106460,
+  1106470,
+  1106480,
+  1106490,
+  1106500,
+  1106510,
+  1106520,
+  1106540,
+  1106550,
+  1106560,
+  1106570,
+  1106580,
+  1106590,
+  1106600,
+  1106610,
+  1106620,
+  1106630,
+  1106640,
+  1106650,
+  1106760,
+  1106820,
+  1106870,
+  1106900,
+  1106960,
+  1107090,
+  1107120,
+  1107180,
+  1107220,
+  1107240,
+  1107260,
+  1107290,
+  1107360,
+  1107380,
+  1107400,
+  1107420,
+  1107430,
+  1107460,
+  1107480,
+  1107500,
+  1107590,
+  1107600,
+  1107630,
+  1107700,
+  1107760,
+  1107810,
+  1107811,
+  1107812,
+  1107813,
+  1107814,
+  1107840,
+  1107880,
+  1107881,
+  1107890,
+  1107930,
+  1107950,
+  1107990,
+  1108070,
+  1108180,
+  1108260,
+  1108280,
+  1108330,
+  1108410,
+  1108450,
+  1108460,
+  1108461,
+  1108530,
+  1108580,
+  1108650,
+  1108700,
+  1108760,
+  1108761,
+  1108762,
+  1108763,
+  1108770,
+  1108790,
+  1108791,
+  1108792,
+  1108793,
+  1108794,
+  1108860,
+  1108870,
+  1108900,
+  1108910,
+  1108920,
+  1108930,
+  1109030,
+  1109050,
+  1109180,
+  1109190,
+  1109200,
+  1109202,
+  1109203,
+  1109204,
+  1109205,
+  1109206,
+  1109207,
+  1109208,
+  1109209,
+  1109240,
+  1109270,
+  1109290,
+  1109330,
+  1109331,
+  1109430,
+  1109480,
+  1109500,
+  1109510,
+  1109530,
+  1109560,
+  1109561,
+  1109562,
+  1109563,
+  1109564,
+  1109565,
+  1109620,
+  1109621,
+  1109630,
+  1109770,
+  1109780,
+  1109850,
+  1109860,
+  1109920,
+  1109930,
+  1109950,
+  1110110,
+  1110111,
+  1110112,
+  1110113,
+  1110120,
+  1110121,
+  1110122,
+  1110123,
+  1110124,
+  1110125,
+  1110130,
+  1110131,
+  1110140,
+  1110141,
+  1110142,
+  1110143,
+  1110150,
+  1110160,
+  1110170,
+  1110180,
+  1110190,
+  1110300,
+  1110320,
+  1110390,
+  1110410,
+  1110450,
+  1110500,
+  1110540,
+  1110541,
+  1110550,
+  1110551,
+  1110552,
+  1110553,
+  1110580,
+  1110590,
+  1110630,
+  1110631,
+  1110632,
+  1110660,
+  1110700,
+  1110710,
+  1110730,
+  1110750,
+  1110800,
+  1110810,
+  1110820,
+  1110880,
+  1110920,
+  1110930,
+  1110990,
+  1111000,
+  1111010,
+  1111011,
+  1111012,
+  1111013,
+  1111014,
+  1111015,
+  1111016,
+  1111020,
+  1111070,
+  1111140,
+  1111170,
+  1111180,
+  1111260,
+  1111350,
+  1111351,
+  1111352,
+  1111360,
+  1111440,
+  1111441,
+  1111442,
+  1111443,
+  1111444,
+  1111445,
+  1111446,
+  1111447,
+  1111448,
+  1111470,
+  1111471,
+  1111472,
+  1111473,
+  1111474,
+  1111475,
+  1111476,
+  1111477,
+  1111480,
+  1111481,
+  1111482,
+  1111490,
+  1111500,
+  1111510,
+  1111511,
+  1111512,
+  1111513,
+  1111514,
+  1111515,
+  1111516,
+  1111517,
+  1111518,
+  1111530,
+  1111550,
+  1111640,
+  1111670,
+  1111671,
+  1111720,
+  1111790,
+  1111950,
+  1112080,
+  1112081,
+  1112082,
+  1112083,
+  1112260,
+  1112420,
+  1112440,
+  1112460,
+  1112470,
+  1112480,
+  1112481,
+  1112482,
+  1112483,
+  1112484,
+  1112485,
+  1112520,
+  1112521,
+  1112590,
+  1112591,
+  1112660,
+  1112720,
+  1112810,
+  1112820,
+  1112850,
+  1112900,
+  1112970,
+  1112971,
+  1112980,
+  1113040,
+  1113140,
+  1113150,
+  1113250,
+  1113280,
+  1113410,
+  1113430,
+  1113440,
+  1113441,
+  1113442,
+  1113443,
+  1113444,
+  1113445,
+  1113450,
+  1113451,
+  1113452,
+  1113510,
+  1113550,
+  1113620,
+  1113700,
+  1113710,
+  1113740,
+  1113810,
+  1113820,
+  1113821,
+  1113822,
+  1113823,
+  1113824,
+  1113910,
+  1113990,
+  1114010,
+  1114040,
+  1114100,
+  1114180,
+  1114190,
+  1114200,
+  1114310,
+  1114320,
+  1114330,
+  1114420,
+  1114440,
+  1114441,
+  1114450,
+  1114550,
+  1114560,
+  1114561,
+  1114570,
+  1114580,
+  1114590,
+  1114591,
+  1114720,
+  1114750,
+  1114770,
+  1114800,
+  1115010,
+  1115120,
+  1115130,
+  1115140,
+  1115150,
+  1115160,
+  1115170,
+  1115180,
+  1115190,
+  1115200,
+  1115210,
+  1115220,
+  1115230,
+  1115240,
+  1115250,
+  1115260,
+  1115270,
+  1115280,
+  1115290,
+  1115300,
+  1115310,
+  1115320,
+  1115330,
+  1115340,
+  1115350,
+  1115360,
+  1115370,
+  1115390,
+  1115440,
+  1115460,
+  1115480,
+  1115490,
+  1115560,
+  1115600,
+  1115710,
+  1115720,
+  1115730,
+  1115750,
+  1115751,
+  1115752,
+  1115753,
+  1115790,
+  1115791,
+  1115900,
+  1115940,
+  1116060,
+  1116160,
+  1116270,
+  1116310,
+  1116330,
+  1116410,
+  1116450,
+  1116510,
+  1116610,
+  1116611,
+  1116612,
+  1116613,
+  1116620,
+  1116621,
+  1116622,
+  1116630,
+  1116640,
+  1116730,
+  1116740,
+  1116940,
+  1116970,
+  1117010,
+  1117030,
+  1117060,
+  1117140,
+  1117190,
+  1117191,
+  1117192,
+  1117230,
+  1117250,
+  1117270,
+  1117290,
+  1117300,
+  1117450,
+  1117520,
+  1117540,
+  1117541,
+  1117550,
+  1117610,
+  1117640,
+  1117641,
+  1117720,
+  1117721,
+  1117850,
+  1117860,
+  1117940,
+  1117950,
+  1118010,
+  1118012,
+  1118013,
+  1118014,
+  1118015,
+  1118017,
+  1118018,
+  1118019,
+  1118021,
+  1118022,
+  1118023,
+  1118024,
+  1118025,
+  1118026,
+  1118029,
+  1118120,
+  1118130,
+  1118140,
+  1118150,
+  1118160,
+  1118170,
+  1118180,
+  1118230,
+  1118250,
+  1118251,
+  1118260,
+  1118261,
+  1118262,
+  1118263,
+  1118264,
+  1118265,
+  1118270,
+  1118271,
+  1118272,
+  1118273,
+  1118274,
+  1118275,
+  1118280,
+  1118281,
+  1118282,
+  1118283,
+  1118284,
+  1118285,
+  1118286,
+  1118287,
+  1118288,
+  1118290,
+  1118291,
+  1118292,
+  1118293,
+  1118294,
+  1118380,
+  1118400,
+  1118430,
+  1118510,
+  1118540,
+  1118650,
+  1118660,
+  1118710,
+  1118900,
+  1118980,
+  1119120,
+  1119130,
+  1119140,
+  1119150,
+  1119160,
+  1119170,
+  1119180,
+  1119190,
+  1119200,
+  1119210,
+  1119220,
+  1119230,
+  1119240,
+  1119250,
+  1119260,
+  1119270,
+  1119280,
+  1119290,
+  1119300,
+  1119310,
+  1119320,
+  1119330,
+  1119340,
+  1119350,
+  1119360,
+  1119370,
+  1119390,
+  1119400,
+  1119410,
+  1119550,
+  1119570,
+  1119750,
+  1119850,
+  1119880,
+  1119900,
+  1119960,
+  1119990,
+  1119991,
+  1119992,
+  1119993,
+  1119994,
+  1119995,
+  1119996,
+  1119997,
+  1119998,
+  1119999,
+  1120020,
+  1120021,
+  1120022,
+  1120023,
+  1120024,
+  1120025,
+  1120060,
+  1120070,
+  1120180,
+  1120200,
+  1120250,
+  1120260,
+  1120290,
+  1120300,
+  1120301,
+  1120302,
+  1120304,
+  1120305,
+  1120310,
+  1120440,
+  1120450,
+  1120460,
+  1120461,
+  1120470,
+  1120490,
+  1120500,
+  1120540,
+  1120550,
+  1120570,
+  1120610,
+  1120620,
+  1120630,
+  1120670,
+  1120710,
+  1120711,
+  1120720,
+  1120730,
+  1120830,
+  1120840,
+  1120841,
+  1120842,
+  1120843,
+  1120844,
+  1120860,
+  1120990,
+  1121020,
+  1121030,
+  1121090,
+  1121130,
+  1121330,
+  1121370,
+  1121380,
+  1121390,
+  1121430,
+  1121540,
+  1121580,
+  1121600,
+  1121610,
+  1121620,
+  1121621,
+  1121622,
+  1121740,
+  1121790,
+  1121800,
+  1121810,
+  1121840,
+  1121870,
+  1121900,
+  1121930,
+  1121940,
+  1121960,
+  1121970,
+  1122080,
+  1122140,
+  1122200,
+  1122201,
+  1122202,
+  1122203,
+  1122204,
+  1122260,
+  1122300,
+  1122320,
+  1122370,
+  1122390,
+  1122391,
+  1122392,
+  1122393,
+  1122394,
+  1122395,
+  1122396,
+  1122397,
+  1122398,
+  1122399,
+  1122400,
+  1122530,
+  1122540,
+  1122551,
+  1122552,
+  1122553,
+  1122554,
+  1122555,
+  1122556,
+  1122557,
+  1122558,
+  1122559,
+  1122560,
+  1122561,
+  1122562,
+  1122563,
+  1122564,
+  1122565,
+  1122566,
+  1122567,
+  1122568,
+  1122569,
+  1122570,
+  1122571,
+  1122572,
+  1122573,
+  1122574,
+  1122575,
+  1122576,
+  1122577,
+  1122578,
+  1122579,
+  1122580,
+  1122581,
+  1122582,
+  1122583,
+  1122584,
+  1122585,
+  1122586,
+  1122587,
+  1122588,
+  1122593,
+  1122594,
+  1122595,
+  1122596,
+  1122597,
+  1122598,
+  1122599,
+  1122600,
+  1122601,
+  1122602,
+  1122603,
+  1122604,
+  1122605,
+  1122606,
+  1122607,
+  1122608,
+  1122609,
+  1122610,
+  1122611,
+  1122612,
+  1122613,
+  1122614,
+  1122615,
+  1122616,
+  1122617,
+  1122618,
+  1122619,
+  1122620,
+  1122621,
+  1122622,
+  1122623,
+  1122624,
+  1122625,
+  1122626,
+  1122627,
+  1122628,
+  1122629,
+  1122630,
+  1122631,
+  1122632,
+  1122633,
+  1122634,
+  1122635,
+  1122636,
+  1122637,
+  1122638,
+  1122639,
+  1122640,
+  1122641,
+  1122642,
+  1122643,
+  1122644,
+  1122645,
+  1122646,
+  1122647,
+  1122648,
+  1122649,
+  1122650,
+  1122651,
+  1122652,
+  1122653,
+  1122654,
+  1122655,
+  1122656,
+  1122657,
+  1122658,
+  1122659,
+  1122660,
+  1122661,
+  1122662,
+  1122663,
+  1122664,
+  1122790,
+  1122850,
+  1122890,
+  1123000,
+  1123110,
+  1123120,
+  1123170,
+  1123200,
+  1123220,
+  1123221,
+  1123222,
+  1123223,
+  1123224,
+  1123225,
+  1123270,
+  1123350,
+  1123390,
+  1123420,
+  1123430,
+  1123431,
+  1123432,
+  1123433,
+  1123434,
+  1123440,
+  1123441,
+  1123470,
+  1123471,
+  1123472,
+  1123473,
+  1123480,
+  1123481,
+  1123482,
+  1123540,
+  1123580,
+  1123630,
+  1123631,
+  1123632,
+  1123633,
+  1123634,
+  1123650,
+  1123700,
+  1123701,
+  1123760,
+  1123840,
+  1123860,
+  1123880,
+  1123890,
+  1123920,
+  1123950,
+  1123960,
+  1123980,
+  1124030,
+  1124040,
+  1124100,
+  1124110,
+  1124111,
+  1124113,
+  1124114,
+  1124115,
+  1124116,
+  1124140,
+  1124151,
+  1124152,
+  1124153,
+  1124154,
+  1124155,
+  1124156,
+  1124157,
+  1124158,
+  1124320,
+  1124440,
+  1124441,
+  1124540,
+  1124541,
+  1124590,
+  1124670,
+  1124700,
+  1124701,
+  1124702,
+  1124750,
+  1124760,
+  1124770,
+  1124780,
+  1124820,
+  1124910,
+  1124930,
+  1125020,
+  1125050,
+  1125090,
+  1125100,
+  1125120,
+  1125210,
+  1125220,
+  1125260,
+  1125270,
+  1125320,
+  1125430,
+  1125550,
+  1125580,
+  1125581,
+  1125582,
+  1125583,
+  1125584,
+  1125585,
+  1125610,
+  1125630,
+  1125640,
+  1125641,
+  1125642,
+  1125790,
+  1125791,
+  1125792,
+  1125793,
+  1125794,
+  1125795,
+  1125810,
+  1125850,
+  1125980,
+  1126050,
+  1126080,
+  1126120,
+  1126200,
+  1126250,
+  1126350,
+  1126380,
+  1126400,
+  1126530,
+  1126540,
+  1126560,
+  1126570,
+  1126610,
+  1126620,
+  1126650,
+  1126720,
+  1126740,
+  1126810,
+  1126910,
+  1126930,
+  1126940,
+  1126980,
+  1126981,
+  1127040,
+  1127160,
+  1127300,
+  1127340,
+  1127410,
+  1127411,
+  1127412,
+  1127420,
+  1127430,
+  1127490,
+  1127510,
+  1127590,
+  1127600,
+  1127750,
+  1127800,
+  1127860,
+  1127870,
+  1127880,
+  1127910,
+  1128020,
+  1128040,
+  1128050,
+  1128060,
+  1128070,
+  1128080,
+  1128090,
+  1128120,
+  1128130,
+  1128230,
+  1128250,
+  1128290,
+  1128300,
+  1128350,
+  1128391,
+  1128400,
+  1128460,
+  1128510,
+  1128530,
+  1128540,
+  1128550,
+  1128560,
+  1128580,
+  1128640,
+  1128700,
+  1128701,
+  1128702,
+  1128703,
+  1128790,
+  1128820,
+  1128850,
+  1128880,
+  1128940,
+  1129040,
+  1129050,
+  1129070,
+  1129141,
+  1129370,
+  1129470,
+  1129530,
+  1129740,
+  1129750,
+  1129770,
+  1129780,
+  1129790,
+  1129800,
+  1129840,
+  1129850,
+  1129860,
+  1129870,
+  1129880,
+  1129890,
+  1129900,
+  1129910,
+  1129930,
+  1129940,
+  1129950,
+  1129960,
+  1129970,
+  1129980,
+  1129990,
+  1130000,
+  1130010,
+  1130020,
+  1130030,
+  1130040,
+  1130050,
+  1130060,
+  1130070,
+  1130080,
+  1130090,
+  1130100,
+  1130110,
+  1130120,
+  1130130,
+  1130140,
+  1130150,
+  1130160,
+  1130170,
+  1130180,
+  1130190,
+  1130200,
+  1130210,
+  1130220,
+  1130230,
+  1130240,
+  1130250,
+  1130260,
+  1130270,
+  1130280,
+  1130290,
+  1130300,
+  1130310,
+  1130320,
+  1130330,
+  1130340,
+  1130350,
+  1130360,
+  1130370,
+  1130480,
+  1130481,
+  1130490,
+  1130491,
+  1130492,
+  1130500,
+  1130501,
+  1130520,
+  1130521,
+  1130530,
+  1130531,
+  1130532,
+  1130533,
+  1130540,
+  1130541,
+  1130550,
+  1130551,
+  1130600,
+  1130630,
+  1130670,
+  1130680,
+  1130690,
+  1130750,
+  1130770,
+  1130780,
+  1130790,
+  1130800,
+  1130810,
+  1130840,
+  1130850,
+  1130860,
+  1130870,
+  1130871,
+  1130872,
+  1130960,
+  1131010,
+  1131020,
+  1131030,
+  1131050,
+  1131090,
+  1131130,
+  1131150,
+  1131170,
+  1131200,
+  1131201,
+  1131320,
+  1131340,
+  1131350,
+  1131370,
+  1131440,
+  1131500,
+  1131630,
+  1131850,
+  1131910,
+  1131980,
+  1132060,
+  1132150,
+  1132200,
+  1132240,
+  1132250,
+  1132260,
+  1132270,
+  1132280,
+  1132330,
+  1132350,
+  1132370,
+  1132380,
+  1132390,
+  1132400,
+  1132550,
+  1132700,
+  1132780,
+  1132790,
+  1132870,
+  1132871,
+  1132872,
+  1132873,
+  1132920,
+  1132960,
+  1132962,
+  1132990,
+  1133000,
+  1133020,
+  1133090,
+  1133110,
+  1133130,
+  1133140,
+  1133160,
+  1133170,
+  1133220,
+  1133290,
+  1133380,
+  1133400,
+  1133410,
+  1133550,
+  1133551,
+  1133560,
+  1133640,
+  1133650,
+  1133660,
+  1133680,
+  1133820,
+  1133840,
+  1133850,
+  1133880,
+  1133960,
+  1134010,
+  1134160,
+  1134340,
+  1134350,
+  1134360,
+  1134380,
+  1134381,
+  1134382,
+  1134383,
+  1134384,
+  1134385,
+  1134386,
+  1134387,
+  1134400,
+  1134401,
+  1134402,
+  1134403,
+  1134404,
+  1134405,
+  1134406,
+  1134407,
+  1134408,
+  1134409,
+  1134410,
+  1134411,
+  1134412,
+  1134413,
+  1134414,
+  1134415,
+  1134416,
+  1134417,
+  1134418,
+  1134419,
+  1134420,
+  1134421,
+  1134422,
+  1134423,
+  1134430,
+  1134431,
+  1134432,
+  1134460,
+  1134490,
+  1134560,
+  1134561,
+  1134562,
+  1134620,
+  1134690,
+  1134740,
+  1134760,
+  1134770,
+  1134780,
+  1134790,
+  1134800,
+  1134810,
+  1134820,
+  1134830,
+  1134850,
+  1134860,
+  1134870,
+  1134880,
+  1134890,
+  1134900,
+  1134910,
+  1134920,
+  1134930,
+  1134940,
+  1134950,
+  1134960,
+  1134970,
+  1134980,
+  1134990,
+  1135000,
+  1135010,
+  1135020,
+  1135280,
+  1135290,
+  1135430,
+  1135431,
+  1135432,
+  1135433,
+  1135434,
+  1135435,
+  1135436,
+  1135437,
+  1135438,
+  1135490,
+  1135520,
+  1135540,
+  1135550,
+  1135580,
+  1135590,
+  1135591,
+  1135600,
+  1135610,
+  1135620,
+  1135630,
+  1135640,
+  1135650,
+  1135660,
+  1135661,
+  1135670,
+  1135720,
+  1135721,
+  1135960,
+  1135970,
+  1135971,
+  1135972,
+  1135980,
+  1136000,
+  1136001,
+  1136002,
+  1136060,
+  1136130,
+  1136140,
+  1136150,
+  1136170,
+  1136180,
+  1136190,
+  1136210,
+  1136300,
+  1136310,
+  1136311,
+  1136312,
+  1136313,
+  1136430,
+  1136460,
+  1136480,
+  1136500,
+  1136510,
+  1136520,
+  1136530,
+  1136540,
+  1136550,
+  1136560,
+  1136570,
+  1136580,
+  1136590,
+  1136600,
+  1136610,
+  1136620,
+  1136630,
+  1136640,
+  1136650,
+  1136660,
+  1136670,
+  1136750,
+  1136751,
+  1136840,
+  1136890,
+  1136920,
+  1136950,
+  1136970,
+  1136990,
+  1137000,
+  1137280,
+  1137281,
+  1137282,
+  1137283,
+  1137370,
+  1137440,
+  1137510,
+  1137520,
+  1137530,
+  1137531,
+  1137532,
+  1137533,
+  1137540,
+  1137560,
+  1137570,
+  1137580,
+  1137590,
+  1137600,
+  1137610,
+  1137640,
+  1137641,
+  1137770,
+  1137800,
+  1137801,
+  1137802,
+  1137890,
+  1137940,
+  1137950,
+  1138200,
+  1138340,
+  1138400,
+  1138430,
+  1138480,
+  1138490,
+  1138550,
+  1138560,
+  1138570,
+  1138670,
+  1138680,
+  1138690,
+  1138700,
+  1138710,
+  1138720,
+  1138730,
+  1138740,
+  1138750,
+  1138760,
+  1138770,
+  1138930,
+  1138931,
+  1139080,
+  1139110,
+  1139150,
+  1139260,
+  1139270,
+  1139290,
+  1139720,
+  1139852,
+  1139930,
+  1139990,
+  1140000,
+  1140001,
+  1140080,
+  1140081,
+  1140082,
+  1140120,
+  1140190,
+  1140200,
+  1140210,
+  1140220,
+  1140230,
+  1140240,
+  1140250,
+  1140320,
+  1140360,
+  1140370,
+  1140380,
+  1140420,
+  1140430,
+  1140470,
+  1140550,
+  1140551,
+  1140552,
+  1140553,
+  1140590,
+  1140600,
+  1140601,
+  1140602,
+  1140640,
+  1140660,
+  1140661,
+  1140662,
+  1140670,
+  1140690,
+  1140710,
+  1140910,
+  1140920,
+  1140990,
+  1140991,
+  1140992,
+  1140993,
+  1140994,
+  1140995,
+  1141000,
+  1141010,
+  1141011,
+  1141012,
+  1141013,
+  1141014,
+  1141015,
+  1141040,
+  1141110,
+  1141190,
+  1141310,
+  1141400,
+  1141401,
+  1141420,
+  1141500,
+  1141530,
+  1141670,
+  1141710,
+  1141711,
+  1141790,
+  1141800,
+  1141810,
+  1141811,
+  1141820,
+  1141960,
+  1141980,
+  1142110,
+  1142250,
+  1142330,
+  1142340,
+  1142350,
+  1142370,
+  1142470,
+  1142590,
+  1142600,
+  1142610,
+  1142630,
+  1142640,
+  1142650,
+  1142680,
+  1142800,
+  1142840,
+  1142880,
+  1142900,
+  1142910,
+  1142920,
+  1143160,
+  1143300,
+  1143360,
+  1143400,
+  1143410,
+  1143490,
+  1143500,
+  1143510,
+  1143520,
+  1143530,
+  1143580,
+  1143590,
+  1143650,
+  1143660,
+  1143750,
+  1143820,
+  1143840,
+  1143850,
+  1143851,
+  1143852,
+  1143853,
+  1143890,
+  1143961,
+  1143970,
+  1143971,
+  1143972,
+  1143973,
+  1143974,
+  1143975,
+  1143976,
+  1143977,
+  1143978,
+  1143979,
+  1143980,
+  1143981,
+  1143982,
+  1143983,
+  1143990,
+  1143991,
+  1143992,
+  1143993,
+  1143994,
+  1143995,
+  1144120,
+  1144180,
+  1144230,
+  1144231,
+  1144310,
+  1144410,
+  1144420,
+  1144480,
+  1144490,
+  1144500,
+  1144540,
+  1144541,
+  1144580,
+  1144581,
+  1144582,
+  1144640,
+  1144641,
+  1144642,
+  1144643,
+  1144644,
+  1144645,
+  1144646,
+  1144680,
+  1144681,
+  1144682,
+  1144683,
+  1144684,
+  1144685,
+  1144710,
+  1144750,
+  1144780,
+  1144890,
+  1144940,
+  1144941,
+  1144942,
+  1144943,
+  1144944,
+  1144960,
+  1145080,
+  1145170,
+  1145190,
+  1145250,
+  1145310,
+  1145500,
+  1145510,
+  1145540,
+  1145690,
+  1145710,
+  1145711,
+  1145760,
+  1145840,
+  1145850,
+  1145851,
+  1145920,
+  1145930,
+  1145990,
+  1146030,
+  1146050,
+  1146060,
+  1146061,
+  1146062,
+  1146063,
+  1146064,
+  1146080,
+  1146130,
+  1146131,
+  1146132,
+  1146140,
+  1146141,
+  1146142,
+  1146260,
+  1146320,
+  1146380,
+  1146400,
+  1146440,
+  1146460,
+  1146490,
+  1146520,
+  1146521,
+  1146522,
+  1146523,
+  1146540,
+  1146550,
+  1146610,
+  1146620,
+  1146650,
+  1146680,
+  1146690,
+  1146720,
+  1146790,
+  1146830,
+  1146870,
+  1146930,
+  1146960,
+  1146990,
+  1147010,
+  1147040,
+  1147060,
+  1147100,
+  1147120,
+  1147121,
+  1147122,
+  1147150,
+  1147151,
+  1147152,
+  1147153,
+  1147154,
+  1147155,
+  1147157,
+  1147158,
+  1147159,
+  1147230,
+  1147250,
+  1147290,
+  1147300,
+  1147310,
+  1147311,
+  1147312,
+  1147313,
+  1147314,
+  1147320,
+  1147380,
+  1147381,
+  1147382,
+  1147383,
+  1147410,
+  1147480,
+  1147540,
+  1147650,
+  1147680,
+  1147770,
+  1147780,
+  1147781,
+  1147830,
+  1148020,
+  1148021,
+  1148022,
+  1148180,
+  1148190,
+  1148250,
+  1148280,
+  1148340,
+  1148520,
+  1148580,
+  1148640,
+  1148800,
+  1148820,
+  1148910,
+  1148950,
+  1148960,
+  1148970,
+  1149110,
+  1149130,
+  1149150,
+  1149160,
+  1149240,
+  1149260,
+  1149261,
+  1149270,
+  1149360,
+  1149361,
+  1149362,
+  1149363,
+  1149364,
+  1149380,
+  1149381,
+  1149382,
+  1149383,
+  1149384,
+  1149390,
+  1149391,
+  1149392,
+  1149393,
+  1149394,
+  1149410,
+  1149411,
+  1149412,
+  1149413,
+  1149520,
+  1149540,
+  1149640,
+  1149650,
+  1149720,
+  1149740,
+  1149760,
+  1149780,
+  1149781,
+  1149810,
+  1149840,
+  1149990,
+  1150030,
+  1150031,
+  1150032,
+  1150033,
+  1150050,
+  1150060,
+  1150100,
+  1150101,
+  1150102,
+  1150190,
+  1150191,
+  1150192,
+  1150194,
+  1150195,
+  1150230,
+  1150240,
+  1150250,
+  1150280,
+  1150320,
+  1150370,
+  1150380,
+  1150680,
+  1150750,
+  1150830,
+  1150840,
+  1150860,
+  1150870,
+  1150930,
+  1150940,
+  1150970,
+  1151040,
+  1151070,
+  1151110,
+  1151111,
+  1151170,
+  1151270,
+  1151480,
+  1151540,
+  1151590,
+  1151660,
+  1151661,
+  1151700,
+  1151710,
+  1151730,
+  1151810,
+  1151811,
+  1151812,
+  1151813,
+  1151814,
+  1151820,
+  1151830,
+  1151831,
+  1151832,
+  1151833,
+  1151834,
+  1151850,
+  1151910,
+  1151950,
+  1151970,
+  1152010,
+  1152011,
+  1152012,
+  1152240,
+  1152420,
+  1152520,
+  1152530,
+  1152560,
+  1152630,
+  1152700,
+  1152900,
+  1152930,
+  1153020,
+  1153021,
+  1153050,
+  1153180,
+  1153190,
+  1153230,
+  1153240,
+  1153290,
+  1153310,
+  1153350,
+  1153351,
+  1153352,
+  1153353,
+  1153360,
+  1153420,
+  1153421,
+  1153422,
+  1153423,
+  1153440,
+  1153441,
+  1153442,
+  1153443,
+  1153490,
+  1153500,
+  1153510,
+  1153560,
+  1153600,
+  1153620,
+  1153630,
+  1153680,
+  1153810,
+  1153820,
+  1153960,
+  1153970,
+  1154000,
+  1154060,
+  1154190,
+  1154260,
+  1154270,
+  1154280,
+  1154310,
+  1154311,
+  1154430,
+  1154530,
+  1154590,
+  1154591,
+  1154592,
+  1154593,
+  1154594,
+  1154595,
+  1154596,
+  1154597,
+  1154630,
+  1154760,
+  1154770,
+  1154780,
+  1154820,
+  1154870,
+  1155010,
+  1155020,
+  1155030,
+  1155040,
+  1155041,
+  1155042,
+  1155050,
+  1155070,
+  1155140,
+  1155230,
+  1155240,
+  1155280,
+  1155320,
+  1155380,
+  1155381,
+  1155400,
+  1155430,
+  1155450,
+  1155530,
+  1155760,
+  1156140,
+  1156160,
+  1156240,
+  1156270,
+  1156271,
+  1156272,
+  1156273,
+  1156280,
+  1156310,
+  1156340,
+  1156390,
+  1156450,
+  1156560,
+  1156660,
+  1156710,
+  1156740,
+  1156810,
+  1156960,
+  1157030,
+  1157130,
+  1157160,
+  1157161,
+  1157162,
+  1157163,
+  1157170,
+  1157210,
+  1157230,
+  1157310,
+  1157380,
+  1157420,
+  1157430,
+  1157440,
+  1157450,
+  1157460,
+  1157470,
+  1157480,
+  1157490,
+  1157500,
+  1157510,
+  1157520,
+  1157540,
+  1157550,
+  1157580,
+  1157590,
+  1157690,
+  1157730,
+  1157731,
+  1157732,
+  1157930,
+  1157950,
+  1157970,
+  1158080,
+  1158100,
+  1158110,
+  1158111,
+  1158120,
+  1158130,
+  1158180,
+  1158181,
+  1158200,
+  1158210,
+  1158240,
+  1158241,
+  1158270,
+  1158340,
+  1158440,
+  1158441,
+  1158490,
+  1158491,
+  1158530,
+  1158540,
+  1158560,
+  1158620,
+  1158670,
+  1158730,
+  1158760,
+  1158780,
+  1158790,
+  1158800,
+  1158810,
+  1158930,
+  1158960,
+  1159010,
+  1159030,
+  1159050,
+  1159060,
+  1159080,
+  1159100,
+  1159110,
+  1159130,
+  1159140,
+  1159200,
+  1159270,
+  1159310,
+  1159311,
+  1159312,
+  1159313,
+  1159314,
+  1159315,
+  1159316,
+  1159320,
+  1159321,
+  1159322,
+  1159323,
+  1159324,
+  1159325,
+  1159326,
+  1159327,
+  1159328,
+  1159329,
+  1159380,
+  1159530,
+  1159570,
+  1159580,
+  1159670,
+  1159710,
+  1159720,
+  1159721,
+  1159722,
+  1159723,
+  1159900,
+  1159910,
+  1159920,
+  1159930,
+  1160000,
+  1160010,
+  1160140,
+  1160160,
+  1160170,
+  1160180,
+  1160181,
+  1160230,
+  1160240,
+  1160241,
+  1160242,
+  1160243,
+  1160300,
+  1160350,
+  1160390,
+  1160400,
+  1160401,
+  1160402,
+  1160403,
+  1160404,
+  1160420,
+  1160520,
+  1160540,
+  1160570,
+  1160571,
+  1160573,
+  1160590,
+  1160591,
+  1160592,
+  1160593,
+  1160600,
+  1160601,
+  1160602,
+  1160603,
+  1160640,
+  1160641,
+  1160642,
+  1160650,
+  1160651,
+  1160652,
+  1160660,
+  1160661,
+  1160662,
+  1160663,
+  1160710,
+  1160760,
+  1160930,
+  1160960,
+  1160990,
+  1161040,
+  1161090,
+  1161230,
+  1161290,
+  1161370,
+  1161380,
+  1161390,
+  1161410,
+  1161420,
+  1161421,
+  1161450,
+  1161460,
+  1161560,
+  1161561,
+  1161600,
+  1161601,
+  1161602,
+  1161603,
+  1161610,
+  1161690,
+  1161740,
+  1161920,
+  1161940,
+  1161950,
+  1161960,
+  1161970,
+  1161980,
+  1161990,
+  1162000,
+  1162110,
+  1162150,
+  1162160,
+  1162190,
+  1162200,
+  1162201,
+  1162202,
+  1162203,
+  1162204,
+  1162205,
+  1162206,
+  1162207,
+  1162208,
+  1162210,
+  1162220,
+  1162230,
+  1162260,
+  1162270,
+  1162340,
+  1162341,
+  1162342,
+  1162380,
+  1162420,
+  1162450,
+  1162451,
+  1162452,
+  1162490,
+  1162600,
+  1162601,
+  1162602,
+  1162620,
+  1162710,
+  1162711,
+  1162712,
+  1162713,
+  1162714,
+  1162715,
+  1162716,
+  1162720,
+  1162721,
+  1162722,
+  1162723,
+  1162780,
+  1162781,
+  1162782,
+  1162783,
+  1162784,
+  1162785,
+  1162790,
+  1162791,
+  1162792,
+  1162793,
+  1162794,
+  1162795,
+  1162796,
+  1162800,
+  1162801,
+  1162810,
+  1163030,
+  1163170,
+  1163180,
+  1163200,
+  1163210,
+  1163220,
+  1163240,
+  1163250,
+  1163280,
+  1163310,
+  1163330,
+  1163360,
+  1163400,
+  1163401,
+  1163402,
+  1163430,
+  1163440,
+  1163520,
+  1163640,
+  1163650,
+  1163770,
+  1163780,
+  1163790,
+  1163810,
+  1163811,
+  1163812,
+  1163900,
+  1164010,
+  1164090,
+  1164110,
+  1164130,
+  1164150,
+  1164160,
+  1164170,
+  1164180,
+  1164190,
+  1164200,
+  1164210,
+  1164211,
+  1164212,
+  1164213,
+  1164214,
+  1164215,
+  1164216,
+  1164217,
+  1164218,
+  1164219,
+  1164220,
+  1164230,
+  1164240,
+  1164260,
+  1164380,
+  1164400,
+  1164430,
+  1164490,
+  1164530,
+  1164540,
+  1164780,
+  1164810,
+  1164840,
+  1164950,
+  1165000,
+  1165030,
+  1165050,
+  1165051,
+  1165052,
+  1165070,
+  1165120,
+  1165130,
+  1165160,
+  1165200,
+  1165210,
+  1165220,
+  1165221,
+  1165240,
+  1165260,
+  1165261,
+  1165262,
+  1165300,
+  1165340,
+  1165370,
+  1165410,
+  1165510,
+  1165630,
+  1165650,
+  1165780,
+  1165940,
+  1165980,
+  1166170,
+  1166171,
+  1166180,
+  1166181,
+  1166190,
+  1166191,
+  1166192,
+  1166193,
+  1166194,
+  1166195,
+  1166196,
+  1166197,
+  1166198,
+  1166199,
+  1166200,
+  1166210,
+  1166220,
+  1166221,
+  1166222,
+  1166223,
+  1166224,
+  1166225,
+  1166340,
+  1166390,
+  1166410,
+  1166420,
+  1166470,
+  1166471,
+  1166472,
+  1166490,
+  1166500,
+  1166620,
+  1166670,
+  1166720,
+  1166721,
+  1166820,
+  1166821,
+  1166822,
+  1166823,
+  1166824,
+  1166825,
+  1166826,
+  1166827,
+  1166870,
+  1166871,
+  1166900,
+  1167000,
+  1167020,
+  1167030,
+  1167040,
+  1167050,
+  1167230,
+  1167231,
+  1167232,
+  1167233,
+  1167280,
+  1167290,
+  1167310,
+  1167330,
+  1167340,
+  1167420,
+  1167500,
+  1167510,
+  1167520,
+  1167550,
+  1167660,
+  1167661,
+  1167662,
+  1167663,
+  1167690,
+  1167720,
+  1167740,
+  1167840,
+  1167860,
+  1167870,
+  1167880,
+  1167910,
+  1167980,
+  1168030,
+  1168080,
+  1168130,
+  1168131,
+  1168180,
+  1168200,
+  1168330,
+  1168380,
+  1168440,
+  1168450,
+  1168480,
+  1168500,
+  1168501,
+  1168502,
+  1168510,
+  1168511,
+  1168512,
+  1168513,
+  1168514,
+  1168515,
+  1168516,
+  1168517,
+  1168518,
+  1168519,
+  1168520,
+  1168521,
+  1168522,
+  1168523,
+  1168524,
+  1168525,
+  1168526,
+  1168560,
+  1168561,
+  1168562,
+  1168563,
+  1168564,
+  1168565,
+  1168566,
+  1168567,
+  1168568,
+  1168580,
+  1168590,
+  1168620,
+  1168680,
+  1168700,
+  1168710,
+  1168730,
+  1168780,
+  1168810,
+  1168910,
+  1169010,
+  1169090,
+  1169120,
+  1169180,
+  1169181,
+  1169182,
+  1169220,
+  1169320,
+  1169330,
+  1169370,
+  1169530,
+  1169600,
+  1169610,
+  1169650,
+  1169670,
+  1169680,
+  1169720,
+  1169721,
+  1169722,
+  1169723,
+  1169724,
+  1169725,
+  1169726,
+  1169800,
+  1169801,
+  1169810,
+  1169811,
+  1169930,
+  1169931,
+  1169950,
+  1169951,
+  1169960,
+  1169970,
+  1169980,
+  1169990,
+  1170010,
+  1170100,
+  1170130,
+  1170140,
+  1170240,
+  1170270,
+  1170410,
+  1170430,
+  1170450,
+  1170451,
+  1170452,
+  1170453,
+  1170454,
+  1170455,
+  1170456,
+  1170457,
+  1170458,
+  1170459,
+  1170460,
+  1170461,
+  1170462,
+  1170463,
+  1170470,
+  1170490,
+  1170491,
+  1170492,
+  1170510,
+  1170520,
+  1170521,
+  1170522,
+  1170523,
+  1170524,
+  1170525,
+  1170526,
+  1170530,
+  1170531,
+  1170532,
+  1170540,
+  1170541,
+  1170542,
+  1170543,
+  1170544,
+  1170545,
+  1170546,
+  1170547,
+  1170548,
+  1170549,
+  1170550,
+  1170680,
+  1170690,
+  1170710,
+  1170711,
+  1170712,
+  1170713,
+  1170714,
+  1170715,
+  1170730,
+  1170731,
+  1170732,
+  1170733,
+  1170750,
+  1170784,
+  1170785,
+  1170786,
+  1170787,
+  1170789,
+  1170791,
+  1170800,
+  1170803,
+  1170807,
+  1170812,
+  1170813,
+  1170814,
+  1170850,
+  1170860,
+  1170890,
+  1170930,
+  1171020,
+  1171190,
+  1171200,
+  1171201,
+  1171202,
+  1171210,
+  1171211,
+  1171220,
+  1171380,
+  1171390,
+  1171400,
+  1171420,
+  1171460,
+  1171470,
+  1171500,
+  1171510,
+  1171590,
+  1171591,
+  1171680,
+  1171750,
+  1171790,
+  1171890,
+  1171900,
+  1171910,
+  1171920,
+  1171930,
+  1171940,
+  1172110,
+  1172130,
+  1172210,
+  1172270,
+  1172290,
+  1172310,
+  1172330,
+  1172420,
+  1172460,
+  1172490,
+  1172540,
+  1172550,
+  1172551,
+  1172552,
+  1172553,
+  1172600,
+  1172610,
+  1172700,
+  1172810,
+  1172860,
+  1172870,
+  1172880,
+  1172890,
+  1173030,
+  1173031,
+  1173050,
+  1173080,
+  1173140,
+  1173190,
+  1173210,
+  1173300,
+  1173360,
+  1173450,
+  1173451,
+  1173452,
+  1173453,
+  1173454,
+  1173470,
+  1173480,
+  1173481,
+  1173482,
+  1173483,
+  1173484,
+  1173485,
+  1173486,
+  1173487,
+  1173488,
+  1173489,
+  1173510,
+  1173560,
+  1173570,
+  1173580,
+  1173750,
+  1173751,
+  1173752,
+  1173760,
+  1173860,
+  1173880,
+  1173890,
+  1173900,
+  1173920,
+  1173930,
+  1173970,
+  1173971,
+  1174000,
+  1174040,
+  1174041,
+  1174042,
+  1174043,
+  1174044,
+  1174045,
+  1174046,
+  1174047,
+  1174048,
+  1174049,
+  1174060,
+  1174061,
+  1174062,
+  1174063,
+  1174064,
+  1174065,
+  1174066,
+  1174067,
+  1174068,
+  1174069,
+  1174080,
+  1174110,
+  1174160,
+  1174250,
+  1174290,
+  1174310,
+  1174311,
+  1174312,
+  1174313,
+  1174360,
+  1174370,
+  1174410,
+  1174470,
+  1174480,
+  1174520,
+  1174580,
+  1174581,
+  1174630,
+  1174631,
+  1174632,
+  1174730,
+  1174860,
+  1174880,
+  1174930,
+  1174980,
+  1175010,
+  1175080,
+  1175090,
+  1175110,
+  1175130,
+  1175220,
+  1175221,
+  1175222,
+  1175223,
+  1175310,
+  1175390,
+  1175410,
+  1175581,
+  1175680,
+  1175710,
+  1175711,
+  1175712,
+  1175713,
+  1175740,
+  1175760,
+  1175761,
+  1175780,
+  1175820,
+  1175990,
+  1176030,
+  1176080,
+  1176110,
+  1176120,
+  1176121,
+  1176130,
+  1176140,
+  1176150,
+  1176151,
+  1176152,
+  1176153,
+  1176154,
+  1176155,
+  1176156,
+  1176157,
+  1176158,
+  1176159,
+  1176180,
+  1176181,
+  1176182,
+  1176183,
+  1176184,
+  1176185,
+  1176186,
+  1176187,
+  1176188,
+  1176189,
+  1176200,
+  1176201,
+  1176202,
+  1176203,
+  1176204,
+  1176206,
+  1176207,
+  1176370,
+  1176371,
+  1176372,
+  1176373,
+  1176374,
+  1176375,
+  1176376,
+  1176377,
+  1176378,
+  1176379,
+  1176490,
+  1176510,
+  1176520,
+  1176521,
+  1176522,
+  1176523,
+  1176524,
+  1176530,
+  1176531,
+  1176532,
+  1176533,
+  1176534,
+  1176535,
+  1176536,
+  1176537,
+  1176538,
+  1176539,
+  1176610,
+  1176611,
+  1176612,
+  1176613,
+  1176614,
+  1176615,
+  1176616,
+  1176617,
+  1176618,
+  1176619,
+  1176620,
+  1176621,
+  1176622,
+  1176623,
+  1176650,
+  1176651,
+  1176652,
+  1176653,
+  1176654,
+  1176655,
+  1176660,
+  1176670,
+  1176680,
+  1176681,
+  1176682,
+  1176700,
+  1176730,
+  1176740,
+  1176750,
+  1176760,
+  1176820,
+  1176870,
+  1176900,
+  1176913,
+  1176914,
+  1176915,
+  1176917,
+  1176918,
+  1176919,
+  1176920,
+  1176921,
+  1176922,
+  1176923,
+  1176924,
+  1176925,
+  1176926,
+  1176932,
+  1176934,
+  1176935,
+  1176936,
+  1176980,
+  1177010,
+  1177050,
+  1177060,
+  1177160,
+  1177200,
+  1177210,
+  1177280,
+  1177520,
+  1177560,
+  1177590,
+  1177591,
+  1177592,
+  1177597,
+  1177598,
+  1177599,
+  1177600,
+  1177630,
+  1177760,
+  1177761,
+  1177762,
+  1177763,
+  1177764,
+  1177765,
+  1177770,
+  1177771,
+  1177772,
+  1177773,
+  1177774,
+  1177775,
+  1177776,
+  1177777,
+  1177780,
+  1177781,
+  1177782,
+  1177783,
+  1177784,
+  1177785,
+  1177786,
+  1177787,
+  1177800,
+  1177801,
+  1177802,
+  1177803,
+  1177804,
+  1177805,
+  1177806,
+  1177807,
+  1177830,
+  1177880,
+  1177900,
+  1177920,
+  1177930,
+  1178250,
+  1178280,
+  1178320,
+  1178321,
+  1178370,
+  1178410,
+  1178460,
+  1178570,
+  1178600,
+  1178610,
+  1178620,
+  1178630,
+  1178640,
+  1178660,
+  1178670,
+  1178730,
+  1178800,
+  1178810,
+  1178870,
+  1178871,
+  1178872,
+  1178873,
+  1178874,
+  1178875,
+  1178876,
+  1178877,
+  1178878,
+  1178879,
+  1178910,
+  1178920,
+  1178921,
+  1178922,
+  1178930,
+  1178931,
+  1178932,
+  1178933,
+  1178934,
+  1178935,
+  1178936,
+  1178940,
+  1178950,
+  1178960,
+  1178970,
+  1178980,
+  1178990,
+  1179090,
+  1179130,
+  1179140,
+  1179141,
+  1179142,
+  1179200,
+  1179230,
+  1179260,
+  1179290,
+  1179300,
+  1179330,
+  1179380,
+  1179450,
+  1179451,
+  1179452,
+  1179453,
+  1179454,
+  1179455,
+  1179456,
+  1179457,
+  1179458,
+  1179470,
+  1179490,
+  1179491,
+  1179492,
+  1179493,
+  1179494,
+  1179520,
+  1179550,
+  1179630,
+  1179631,
+  1179632,
+  1179633,
+  1179634,
+  1179635,
+  1179636,
+  1179637,
+  1179638,
+  1179639,
+  1179650,
+  1179651,
+  1179652,
+  1179653,
+  1179654,
+  1179655,
+  1179656,
+  1179710,
+  1179720,
+  1179760,
+  1179800,
+  1179830,
+  1179920,
+  1179930,
+  1179940,
+  1179950,
+  1179960,
+  1179980,
+  1179990,
+  1180010,
+  1180120,
+  1180140,
+  1180150,
+  1180160,
+  1180170,
+  1180180,
+  1180230,
+  1180240,
+  1180260,
+  1180290,
+  1180340,
+  1180350,
+  1180400,
+  1180410,
+  1180490,
+  1180491,
+  1180510,
+  1180560,
+  1180570,
+  1180580,
+  1180590,
+  1180600,
+  1180720,
+  1180721,
+  1180722,
+  1180730,
+  1180750,
+  1180760,
+  1180780,
+  1180890,
+  1180910,
+  1180920,
+  1180950,
+  1180980,
+  1181170,
+  1181230,
+  1181250,
+  1181260,
+  1181320,
+  1181350,
+  1181420,
+  1181530,
+  1181540,
+  1181541,
+  1181542,
+  1181630,
+  1181680,
+  1181740,
+  1181770,
+  1181771,
+  1181772,
+  1181773,
+  1181774,
+  1181775,
+  1181860,
+  1181870,
+  1181890,
+  1181920,
+  1181930,
+  1181950,
+  1181990,
+  1182000,
+  1182050,
+  1182120,
+  1182180,
+  1182190,
+  1182230,
+  1182270,
+  1182290,
+  1182291,
+  1182292,
+  1182293,
+  1182294,
+  1182300,
+  1182301,
+  1182302,
+  1182303,
+  1182304,
+  1182305,
+  1182306,
+  1182307,
+  1182308,
+  1182309,
+  1182320,
+  1182330,
+  1182340,
+  1182360,
+  1182380,
+  1182390,
+  1182400,
+  1182510,
+  1182520,
+  1182540,
+  1182560,
+  1182640,
+  1182753,
+  1182754,
+  1182755,
+  1182756,
+  1182757,
+  1182758,
+  1182759,
+  1182800,
+  1182810,
+  1182811,
+  1182870,
+  1182920,
+  1182930,
+  1182940,
+  1182960,
+  1183040,
+  1183050,
+  1183051,
+  1183052,
+  1183100,
+  1183101,
+  1183102,
+  1183110,
+  1183190,
+  1183240,
+  1183340,
+  1183370,
+  1183440,
+  1183520,
+  1183540,
+  1183610,
+  1183620,
+  1183621,
+  1183630,
+  1183640,
+  1183720,
+  1183960,
+  1184100,
+  1184101,
+  1184130,
+  1184200,
+  1184240,
+  1184270,
+  1184290,
+  1184340,
+  1184350,
+  1184351,
+  1184410,
+  1184411,
+  1184412,
+  1184520,
+  1184580,
+  1184630,
+  1184650,
+  1184651,
+  1184660,
+  1184661,
+  1184690,
+  1184910,
+  1184920,
+  1184970,
+  1184971,
+  1184972,
+  1185200,
+  1185210,
+  1185260,
+  1185430,
+  1185431,
+  1185432,
+  1185433,
+  1185434,
+  1185440,
+  1185457,
+  1185460,
+  1185463,
+  1185610,
+  1185640,
+  1185650,
+  1185690,
+  1185710,
+  1185760,
+  1185771,
+  1185790,
+  1185850,
+  1185890,
+  1185910,
+  1185920,
+  1185990,
+  1186000,
+  1186010,
+  1186130,
+  1186140,
+  1186230,
+  1186231,
+  1186232,
+  1186233,
+  1186234,
+  1186235,
+  1186236,
+  1186237,
+  1186238,
+  1186239,
+  1186240,
+  1186241,
+  1186242,
+  1186243,
+  1186244,
+  1186245,
+  1186410,
+  1186420,
+  1186540,
+  1186560,
+  1186561,
+  1186610,
+  1186870,
+  1186871,
+  1186872,
+  1186873,
+  1186874,
+  1186875,
+  1186876,
+  1186877,
+  1187040,
+  1187050,
+  1187060,
+  1187100,
+  1187140,
+  1187150,
+  1187151,
+  1187152,
+  1187153,
+  1187154,
+  1187155,
+  1187160,
+  1187170,
+  1187230,
+  1187240,
+  1187260,
+  1187300,
+  1187301,
+  1187302,
+  1187303,
+  1187304,
+  1187305,
+  1187306,
+  1187307,
+  1187308,
+  1187309,
+  1187310,
+  1187311,
+  1187312,
+  1187313,
+  1187314,
+  1187315,
+  1187316,
+  1187317,
+  1187318,
+  1187319,
+  1187320,
+  1187321,
+  1187322,
+  1187323,
+  1187324,
+  1187325,
+  1187326,
+  1187327,
+  1187328,
+  1187360,
+  1187370,
+  1187530,
+  1187540,
+  1187541,
+  1187550,
+  1187630,
+  1187631,
+  1187660,
+  1187680,
+  1187750,
+  1187760,
+  1187810,
+  1187820,
+  1187821,
+  1187880,
+  1187881,
+  1188040,
+  1188090,
+  1188120,
+  1188210,
+  1188230,
+  1188360,
+  1188480,
+  1188500,
+  1188600,
+  1188601,
+  1188602,
+  1188603,
+  1188604,
+  1188605,
+  1188606,
+  1188607,
+  1188608,
+  1188609,
+  1188610,
+  1188611,
+  1188612,
+  1188613,
+  1188614,
+  1188615,
+  1188616,
+  1188617,
+  1188618,
+  1188619,
+  1188620,
+  1188700,
+  1188730,
+  1188780,
+  1188790,
+  1188830,
+  1188840,
+  1188920,
+  1188940,
+  1189000,
+  1189110,
+  1189160,
+  1189260,
+  1189261,
+  1189310,
+  1189390,
+  1189480,
+  1189570,
+  1189620,
+  1189670,
+  1189671,
+  1189690,
+  1189700,
+  1189750,
+  1189760,
+  1189770,
+  1189840,
+  1189870,
+  1189871,
+  1189890,
+  1189900,
+  1189910,
+  1189960,
+  1189990,
+  1190010,
+  1190011,
+  1190012,
+  1190013,
+  1190050,
+  1190051,
+  1190140,
+  1190210,
+  1190220,
+  1190240,
+  1190250,
+  1190291,
+  1190330,
+  1190331,
+  1190440,
+  1190470,
+  1190490,
+  1190500,
+  1190510,
+  1190570,
+  1190580,
+  1190610,
+  1190680,
+  1190750,
+  1190770,
+  1190800,
+  1190920,
+  1190940,
+  1190950,
+  1190960,
+  1191010,
+  1191060,
+  1191130,
+  1191160,
+  1191161,
+  1191162,
+  1191170,
+  1191230,
+  1191300,
+  1191490,
+  1191810,
+  1191850,
+  1191880,
+  1191970,
+  1192040,
+  1192080,
+  1192110,
+  1192180,
+  1192220,
+  1192300,
+  1192320,
+  1192340,
+  1192350,
+  1192360,
+  1192370,
+  1192371,
+  1192400,
+  1192450,
+  1192561,
+  1192600,
+  1192650,
+  1192680,
+  1192690,
+  1192710,
+  1192770,
+  1192790,
+  1192800,
+  1192801,
+  1192820,
+  1192920,
+  1193190,
+  1193320,
+  1193360,
+  1193370,
+  1193390,
+  1193410,
+  1193440,
+  1193610,
+  1193611,
+  1193612,
+  1193613,
+  1193640,
+  1193690,
+  1193750,
+  1193840,
+  1193870,
+  1193871,
+  1193890,
+  1194000,
+  1194010,
+  1194020,
+  1194021,
+  1194070,
+  1194080,
+  1194110,
+  1194120,
+  1194270,
+  1194360,
+  1194361,
+  1194430,
+  1194440,
+  1194470,
+  1194500,
+  1194540,
+  1194660,
+  1194661,
+  1194690,
+  1194780,
+  1194781,
+  1194820,
+  1194850,
+  1194851,
+  1194852,
+  1194853,
+  1194854,
+  1194855,
+  1194856,
+  1194857,
+  1194858,
+  1194859,
+  1194980,
+  1195030,
+  1195040,
+  1195050,
+  1195060,
+  1195110,
+  1195130,
+  1195150,
+  1195160,
+  1195161,
+  1195162,
+  1195163,
+  1195164,
+  1195165,
+  1195166,
+  1195167,
+  1195200,
+  1195201,
+  1195202,
+  1195203,
+  1195204,
+  1195205,
+  1195206,
+  1195207,
+  1195208,
+  1195209,
+  1195210,
+  1195211,
+  1195212,
+  1195213,
+  1195214,
+  1195215,
+  1195216,
+  1195240,
+  1195270,
+  1195300,
+  1195301,
+  1195310,
+  1195311,
+  1195312,
+  1195313,
+  1195314,
+  1195315,
+  1195330,
+  1195331,
+  1195332,
+  1195480,
+  1195540,
+  1195600,
+  1195630,
+  1195740,
+  1195750,
+  1195840,
+  1195880,
+  1195881,
+  1195882,
+  1195883,
+  1195884,
+  1195885,
+  1195886,
+  1195900,
+  1195901,
+  1195902,
+  1195903,
+  1195904,
+  1195905,
+  1195906,
+  1195907,
+  1195930,
+  1195940,
+  1195950,
+  1195960,
+  1195970,
+  1195990,
+  1196010,
+  1196020,
+  1196040,
+  1196041,
+  1196050,
+  1196060,
+  1196061,
+  1196070,
+  1196100,
+  1196141,
+  1196150,
+  1196210,
+  1196220,
+  1196290,
+  1196340,
+  1196420,
+  1196490,
+  1196510,
+  1196560,
+  1196561,
+  1196650,
+  1196651,
+  1196670,
+  1196700,
+  1196710,
+  1196730,
+  1196770,
+  1196780,
+  1196781,
+  1196782,
+  1196783,
+  1196784,
+  1196785,
+  1196786,
+  1196787,
+  1196788,
+  1196789,
+  1196790,
+  1196791,
+  1196792,
+  1196793,
+  1196794,
+  1196850,
+  1196860,
+  1196930,
+  1197040,
+  1197050,
+  1197170,
+  1197250,
+  1197310,
+  1197420,
+  1197460,
+  1197470,
+  1197560,
+  1197580,
+  1197650,
+  1197651,
+  1197740,
+  1197800,
+  1197860,
+  1197890,
+  1197891,
+  1197892,
+  1197893,
+  1197894,
+  1197895,
+  1197900,
+  1197901,
+  1197902,
+  1197903,
+  1197904,
+  1197905,
+  1197906,
+  1197907,
+  1197910,
+  1197911,
+  1197912,
+  1197913,
+  1197914,
+  1197915,
+  1197970,
+  1197980,
+  1198010,
+  1198140,
+  1198141,
+  1198142,
+  1198143,
+  1198144,
+  1198145,
+  1198146,
+  1198147,
+  1198148,
+  1198149,
+  1198160,
+  1198161,
+  1198162,
+  1198163,
+  1198164,
+  1198165,
+  1198166,
+  1198180,
+  1198181,
+  1198182,
+  1198183,
+  1198184,
+  1198185,
+  1198186,
+  1198187,
+  1198188,
+  1198189,
+  1198190,
+  1198191,
+  1198192,
+  1198193,
+  1198280,
+  1198350,
+  1198360,
+  1198361,
+  1198362,
+  1198363,
+  1198364,
+  1198410,
+  1198460,
+  1198461,
+  1198462,
+  1198470,
+  1198480,
+  1198481,
+  1198560,
+  1198620,
+  1198680,
+  1198720,
+  1198721,
+  1198722,
+  1198723,
+  1198724,
+  1198725,
+  1198780,
+  1198830,
+  1198831,
+  1198832,
+  1198833,
+  1198834,
+  1198835,
+  1198836,
+  1198837,
+  1198839,
+  1198840,
+  1198841,
+  1198843,
+  1198844,
+  1198845,
+  1198846,
+  1198847,
+  1198848,
+  1198849,
+  1198940,
+  1198960,
+  1198980,
+  1198981,
+  1198982,
+  1199000,
+  1199001,
+  1199080,
+  1199120,
+  1199210,
+  1199310,
+  1199324,
+  1199380,
+  1199400,
+  1199470,
+  1199500,
+  1199530,
+  1199531,
+  1199532,
+  1199580,
+  1199590,
+  1199600,
+  1199601,
+  1199602,
+  1199630,
+  1199670,
+  1199720,
+  1199750,
+  1199870,
+  1199880,
+  1199890,
+  1199920,
+  1199950,
+  1199960,
+  1200170,
+  1200171,
+  1200260,
+  1200270,
+  1200340,
+  1200341,
+  1200342,
+  1200343,
+  1200344,
+  1200345,
+  1200346,
+  1200347,
+  1200348,
+  1200349,
+  1200360,
+  1200370,
+  1200470,
+  1200550,
+  1200551,
+  1200552,
+  1200566,
+  1200610,
+  1200620,
+  1200621,
+  1200622,
+  1200623,
+  1200640,
+  1200820,
+  1200830,
+  1200940,
+  1200960,
+  1201010,
+  1201020,
+  1201030,
+  1201050,
+  1201080,
+  1201140,
+  1201150,
+  1201151,
+  1201152,
+  1201180,
+  1201300,
+  1201360,
+  1201430,
+  1201510,
+  1201660,
+  1201820,
+  1201821,
+  1201900,
+  1201970,
+  1201980,
+  1202010,
+  1202011,
+  1202012,
+  1202013,
+  1202014,
+  1202030,
+  1202031,
+  1202032,
+  1202033,
+  1202034,
+  1202035,
+  1202036,
+  1202037,
+  1202040,
+  1202041,
+  1202042,
+  1202043,
+  1202044,
+  1202045,
+  1202050,
+  1202051,
+  1202052,
+  1202053,
+  1202055,
+  1202060,
+  1202061,
+  1202062,
+  1202063,
+  1202064,
+  1202065,
+  1202080,
+  1202190,
+  1202290,
+  1202320,
+  1202360,
+  1202450,
+  1202460,
+  1202470,
+  1202520,
+  1202600,
+  1202601,
+  1202603,
+  1202604,
+  1202605,
+  1202850,
+  1202860,
+  1202940,
+  1202941,
+  1203040,
+  1203041,
+  1203042,
+  1203043,
+  1203044,
+  1203045,
+  1203070,
+  1203080,
+  1203081,
+  1203082,
+  1203110,
+  1203150,
+  1203250,
+  1203300,
+  1203350,
+  1203440,
+  1203480,
+  1203481,
+  1203482,
+  1203510,
+  1203520,
+  1203530,
+  1203540,
+  1203541,
+  1203542,
+  1203543,
+  1203640,
+  1203720,
+  1203740,
+  1203790,
+  1203800,
+  1203830,
+  1203880,
+  1204050,
+  1204070,
+  1204090,
+  1204100,
+  1204130,
+  1204160,
+  1204170,
+  1204200,
+  1204400,
+  1204500,
+  1204590,
+  1204820,
+  1204850,
+  1204920,
+  1205000,
+  1205050,
+  1205090,
+  1205100,
+  1205110,
+  1205111,
+  1205112,
+  1205113,
+  1205114,
+  1205115,
+  1205120,
+  1205180,
+  1205200,
+  1205220,
+  1205230,
+  1205290,
+  1205310,
+  1205330,
+  1205361,
+  1205364,
+  1205380,
+  1205400,
+  1205410,
+  1205430,
+  1205470,
+  1205500,
+  1205501,
+  1205510,
+  1205511,
+  1205512,
+  1205513,
+  1205530,
+  1205580,
+  1205600,
+  1205760,
+  1205761,
+  1205762,
+  1205780,
+  1205781,
+  1205782,
+  1205783,
+  1205784,
+  1205785,
+  1205786,
+  1205787,
+  1205788,
+  1205789,
+  1205790,
+  1205791,
+  1205792,
+  1205793,
+  1205794,
+  1205795,
+  1205796,
+  1205797,
+  1205798,
+  1205799,
+  1205810,
+  1205820,
+  1205830,
+  1205840,
+  1205850,
+  1205860,
+  1205861,
+  1205862,
+  1205863,
+  1205864,
+  1205865,
+  1205866,
+  1205867,
+  1205868,
+  1205869,
+  1205880,
+  1205881,
+  1205882,
+  1205883,
+  1205884,
+  1205885,
+  1205886,
+  1205887,
+  1205890,
+  1205930,
+  1205980,
+  1206030,
+  1206130,
+  1206160,
+  1206190,
+  1206200,
+  1206330,
+  1206340,
+  1206390,
+  1206400,
+  1206450,
+  1206451,
+  1206460,
+  1206500,
+  1206540,
+  1206541,
+  1206580,
+  1206630,
+  1206640,
+  1206650,
+  1206680,
+  1206681,
+  1206682,
+  1206683,
+  1206684,
+  1206685,
+  1206686,
+  1206687,
+  1206688,
+  1206689,
+  1206690,
+  1206740,
+  1206750,
+  1206760,
+  1206761,
+  1206762,
+  1206800,
+  1206820,
+  1206821,
+  1206830,
+  1206890,
+  1206940,
+  1207000,
+  1207030,
+  1207050,
+  1207100,
+  1207110,
+  1207160,
+  1207170,
+  1207240,
+  1207290,
+  1207330,
+  1207350,
+  1207351,
+  1207430,
+  1207450,
+  1207460,
+  1207470,
+  1207510,
+  1207530,
+  1207550,
+  1207560,
+  1207610,
+  1207620,
+  1207660,
+  1207720,
+  1207750,
+  1207760,
+  1207790,
+  1207890,
+  1207900,
+  1207910,
+  1207920,
+  1207930,
+  1207950,
+  1207960,
+  1207970,
+  1207980,
+  1208010,
+  1208011,
+  1208020,
+  1208060,
+  1208080,
+  1208140,
+  1208150,
+  1208160,
+  1208250,
+  1208280,
+  1208290,
+  1208291,
+  1208292,
+  1208440,
+  1208660,
+  1208730,
+  1208820,
+  1208880,
+  1208940,
+  1209050,
+  1209051,
+  1209110,
+  1209120,
+  1209121,
+  1209130,
+  1209131,
+  1209132,
+  1209133,
+  1209134,
+  1209135,
+  1209150,
+  1209180,
+  1209210,
+  1209220,
+  1209230,
+  1209240,
+  1209250,
+  1209260,
+  1209340,
+  1209400,
+  1209460,
+  1209461,
+  1209470,
+  1209471,
+  1209480,
+  1209500,
+  1209530,
+  1209531,
+  1209532,
+  1209540,
+  1209560,
+  1209590,
+  1209600,
+  1209620,
+  1209621,
+  1209630,
+  1209640,
+  1209641,
+  1209680,
+  1209700,
+  1209710,
+  1209800,
+  1209801,
+  1209880,
+  1209900,
+  1210000,
+  1210040,
+  1210041,
+  1210070,
+  1210080,
+  1210090,
+  1210091,
+  1210130,
+  1210131,
+  1210132,
+  1210133,
+  1210170,
+  1210171,
+  1210200,
+  1210270,
+  1210280,
+  1210290,
+  1210300,
+  1210350,
+  1210400,
+  1210630,
+  1210730,
+  1210750,
+  1210820,
+  1210870,
+  1210950,
+  1210990,
+  1211170,
+  1211171,
+  1211172,
+  1211173,
+  1211174,
+  1211175,
+  1211176,
+  1211177,
+  1211178,
+  1211179,
+  1211200,
+  1211201,
+  1211202,
+  1211203,
+  1211204,
+  1211205,
+  1211206,
+  1211207,
+  1211208,
+  1211209,
+  1211300,
+  1211301,
+  1211302,
+  1211303,
+  1211310,
+  1211311,
+  1211312,
+  1211313,
+  1211314,
+  1211460,
+  1211470,
+  1211471,
+  1211472,
+  1211473,
+  1211474,
+  1211475,
+  1211476,
+  1211477,
+  1211478,
+  1211479,
+  1211480,
+  1211530,
+  1211590,
+  1211670,
+  1211671,
+  1211672,
+  1211673,
+  1211674,
+  1211675,
+  1211676,
+  1211677,
+  1211678,
+  1211679,
+  1211680,
+  1211681,
+  1211682,
+  1211683,
+  1211690,
+  1211770,
+  1211820,
+  1211860,
+  1211880,
+  1211900,
+  1211920,
+  1211940,
+  1212080,
+  1212090,
+  1212210,
+  1212211,
+  1212212,
+  1212213,
+  1212214,
+  1212215,
+  1212216,
+  1212217,
+  1212218,
+  1212219,
+  1212220,
+  1212230,
+  1212310,
+  1212311,
+  1212360,
+  1212490,
+  1212540,
+  1212590,
+  1212630,
+  1212660,
+  1212670,
+  1212690,
+  1212800,
+  1212801,
+  1212802,
+  1212803,
+  1212804,
+  1212805,
+  1212806,
+  1212807,
+  1212808,
+  1212809,
+  1212810,
+  1212811,
+  1212812,
+  1212813,
+  1212814,
+  1212815,
+  1212816,
+  1212817,
+  1212880,
+  1212890,
+  1212900,
+  1213160,
+  1213180,
+  1213270,
+  1213320,
+  1213330,
+  1213331,
+  1213332,
+  1213333,
+  1213334,
+  1213335,
+  1213350,
+  1213351,
+  1213352,
+  1213353,
+  1213354,
+  1213355,
+  1213380,
+  1213381,
+  1213382,
+  1213383,
+  1213384,
+  1213385,
+  1213386,
+  1213430,
+  1213431,
+  1213480,
+  1213490,
+  1213491,
+  1213500,
+  1213510,
+  1213540,
+  1213560,
+  1213590,
+  1213610,
+  1213611,
+  1213612,
+  1213613,
+  1213710,
+  1213820,
+  1213940,
+  1213950,
+  1214030,
+  1214090,
+  1214091,
+  1214092,
+  1214093,
+  1214094,
+  1214095,
+  1214096,
+  1214110,
+  1214111,
+  1214112,
+  1214113,
+  1214114,
+  1214115,
+  1214116,
+  1214170,
+  1214230,
+  1214250,
+  1214290,
+  1214310,
+  1214350,
+  1214390,
+  1214420,
+  1214430,
+  1214440,
+  1214480,
+  1214550,
+  1214551,
+  1214552,
+  1214553,
+  1214554,
+  1214555,
+  1214556,
+  1214557,
+  1214610,
+  1214620,
+  1214640,
+  1214730,
+  1214800,
+  1214810,
+  1214880,
+  1214890,
+  1214891,
+  1214892,
+  1214893,
+  1214894,
+  1214895,
+  1214896,
+  1214897,
+  1214900,
+  1214950,
+  1214970,
+  1215050,
+  1215110,
+  1215130,
+  1215160,
+  1215190,
+  1215220,
+  1215230,
+  1215360,
+  1215450,
+  1215460,
+  1215461,
+  1215462,
+  1215463,
+  1215620,
+  1215640,
+  1215680,
+  1215760,
+  1215820,
+  1215920,
+  1216000,
+  1216020,
+  1216070,
+  1216160,
+  1216180,
+  1216290,
+  1216360,
+  1216380,
+  1216390,
+  1216400,
+  1216510,
+  1216640,
+  1216680,
+  1216681,
+  1216690,
+  1216750,
+  1216790,
+  1216792,
+  1216793,
+  1216794,
+  1216810,
+  1216820,
+  1216830,
+  1216840,
+  1216890,
+  1216900,
+  1216910,
+  1216920,
+  1216950,
+  1216951,
+  1216952,
+  1216953,
+  1216954,
+  1216955,
+  1216956,
+  1217000,
+  1217120,
+  1217150,
+  1217240,
+  1217320,
+  1217400,
+  1217401,
+  1217540,
+  1217600,
+  1217601,
+  1217671,
+  1217672,
+  1217673,
+  1217674,
+  1217675,
+  1217676,
+  1217677,
+  1217679,
+  1217682,
+  1217683,
+  1217684,
+  1217685,
+  1217686,
+  1217687,
+  1217688,
+  1217689,
+  1217690,
+  1217691,
+  1217692,
+  1217840,
+  1217890,
+  1217910,
+  1217970,
+  1218010,
+  1218040,
+  1218080,
+  1218160,
+  1218240,
+  1218390,
+  1218630,
+  1218632,
+  1218650,
+  1218690,
+  1218720,
+  1218860,
+  1218880,
+  1218960,
+  1218990,
+  1219040,
+  1219130,
+  1219140,
+  1219150,
+  1219260,
+  1219261,
+  1219270,
+  1219330,
+  1219350,
+  1219410,
+  1219440,
+  1219460,
+  1219560,
+  1219630,
+  1219660,
+  1219750,
+  1219830,
+  1219850,
+  1219851,
+  1219852,
+  1219870,
+  1219900,
+  1219990,
+  1220050,
+  1220060,
+  1220061,
+  1220062,
+  1220130,
+  1220180,
+  1220210,
+  1220400,
+  1220401,
+  1220420,
+  1220421,
+  1220610,
+  1220660,
+  1220700,
+  1220730,
+  1220750,
+  1220790,
+  1220970,
+  1221050,
+  1221090,
+  1221100,
+  1221110,
+  1221120,
+  1221130,
+  1221140,
+  1221150,
+  1221160,
+  1221170,
+  1221180,
+  1221190,
+  1221200,
+  1221210,
+  1221220,
+  1221340,
+  1221360,
+  1221370,
+  1221500,
+  1221610,
+  1221700,
+  1221740,
+  1221780,
+  1221790,
+  1221850,
+  1221851,
+  1221852,
+  1221853,
+  1221870,
+  1221900,
+  1221940,
+  1221980,
+  1222100,
+  1222101,
+  1222190,
+  1222280,
+  1222360,
+  1222520,
+  1222530,
+  1222580,
+  1222630,
+  1222631,
+  1222632,
+  1222633,
+  1222634,
+  1222635,
+  1222650,
+  1222760,
+  1222780,
+  1222890,
+  1222891,
+  1222920,
+  1223000,
+  1223010,
+  1223060,
+  1223130,
+  1223160,
+  1223180,
+  1223290,
+  1223300,
+  1223310,
+  1223340,
+  1223490,
+  1223580,
+  1223630,
+  1223690,
+  1223710,
+  1223780,
+  1223790,
+  1223800,
+  1223830,
+  1223860,
+  1223950,
+  1223960,
+  1224000,
+  1224060,
+  1224100,
+  1224140,
+  1224190,
+  1224210,
+  1224240,
+  1224260,
+  1224340,
+  1224341,
+  1224350,
+  1224370,
+  1224390,
+  1224410,
+  1224440,
+  1224550,
+  1224570,
+  1224580,
+  1224590,
+  1224620,
+  1224660,
+  1224661,
+  1224662,
+  1224663,
+  1224664,
+  1224665,
+  1224666,
+  1224667,
+  1224668,
+  1224669,
+  1224680,
+  1224740,
+  1224760,
+  1224761,
+  1224762,
+  1224763,
+  1224764,
+  1224780,
+  1224781,
+  1224782,
+  1224783,
+  1224784,
+  1224785,
+  1224786,
+  1224787,
+  1224788,
+  1224789,
+  1224790,
+  1224791,
+  1224792,
+  1224793,
+  1224794,
+  1224795,
+  1224796,
+  1224800,
+  1224820,
+  1224821,
+  1224822,
+  1224823,
+  1224824,
+  1224825,
+  1224826,
+  1224827,
+  1224830,
+  1224831,
+  1224832,
+  1224833,
+  1224834,
+  1224835,
+  1224836,
+  1224850,
+  1224851,
+  1224852,
+  1224853,
+  1224854,
+  1224855,
+  1224856,
+  1224857,
+  1224858,
+  1224859,
+  1224860,
+  1224861,
+  1224862,
+  1224863,
+  1224864,
+  1224865,
+  1224866,
+  1224867,
+  1224868,
+  1224870,
+  1224871,
+  1224872,
+  1224873,
+  1224874,
+  1224875,
+  1224876,
+  1224877,
+  1224878,
+  1224879,
+  1224890,
+  1224891,
+  1224892,
+  1224893,
+  1224894,
+  1224895,
+  1224896,
+  1224897,
+  1224898,
+  1224940,
+  1224970,
+  1225000,
+  1225030,
+  1225140,
+  1225190,
+  1225210,
+  1225270,
+  1225300,
+  1225310,
+  1225340,
+  1225350,
+  1225360,
+  1225390,
+  1225400,
+  1225420,
+  1225430,
+  1225440,
+  1225450,
+  1225470,
+  1225480,
+  1225490,
+  1225510,
+  1225511,
+  1225512,
+  1225513,
+  1225514,
+  1225515,
+  1225620,
+  1225630,
+  1225720,
+  1225750,
+  1225800,
+  1225960,
+  1226040,
+  1226130,
+  1226220,
+  1226222,
+  1226390,
+  1226450,
+  1226460,
+  1226500,
+  1226650,
+  1226680,
+  1226710,
+  1226720,
+  1226730,
+  1226740,
+  1226750,
+  1226770,
+  1226780,
+  1226800,
+  1226850,
+  1226870,
+  1226930,
+  1226980,
+  1227030,
+  1227170,
+  1227310,
+  1227340,
+  1227350,
+  1227410,
+  1227420,
+  1227440,
+  1227441,
+  1227443,
+  1227444,
+  1227448,
+  1227449,
+  1227452,
+  1227453,
+  1227454,
+  1227456,
+  1227460,
+  1227461,
+  1227467,
+  1227468,
+  1227481,
+  1227500,
+  1227510,
+  1227520,
+  1227560,
+  1227610,
+  1227620,
+  1227670,
+  1227700,
+  1228340,
+  1228370,
+  1228400,
+  1228470,
+  1228480,
+  1228510,
+  1228530,
+  1228540,
+  1228580,
+  1228660,
+  1228710,
+  1228720,
+  1228740,
+  1228760,
+  1228810,
+  1229040,
+  1229140,
+  1229170,
+  1229220,
+  1229320,
+  1229350,
+  1229370,
+  1229550,
+  1229630,
+  1229670,
+  1229690,
+  1229700,
+  1229740,
+  1229820,
+  1229830,
+  1229840,
+  1229850,
+  1229860,
+  1229870,
+  1229940,
+  1229941,
+  1229942,
+  1229943,
+  1229944,
+  1229945,
+  1229950,
+  1229951,
+  1229952,
+  1229970,
+  1230040,
+  1230130,
+  1230131,
+  1230180,
+  1230230,
+  1230240,
+  1230250,
+  1230270,
+  1230271,
+  1230272,
+  1230273,
+  1230274,
+  1230275,
+  1230276,
+  1230277,
+  1230278,
+  1230279,
+  1230280,
+  1230290,
+  1230300,
+  1230380,
+  1230440,
+  1230441,
+  1230442,
+  1230450,
+  1230451,
+  1230460,
+  1230480,
+  1230481,
+  1230482,
+  1230483,
+  1230580,
+  1230630,
+  1230690,
+  1230700,
+  1230710,
+  1230730,
+  1230740,
+  1230750,
+  1230770,
+  1230830,
+  1230910,
+  1230950,
+  1230960,
+  1230970,
+  1231010,
+  1231020,
+  1231060,
+  1231080,
+  1231160,
+  1231220,
+  1231250,
+  1231320,
+  1231340,
+  1231370,
+  1231380,
+  1231430,
+  1231450,
+  1231610,
+  1231660,
+  1231690,
+  1231700,
+  1231850,
+  1231870,
+  1231910,
+  1231920,
+  1231960,
+  1231980,
+  1232030,
+  1232040,
+  1232041,
+  1232050,
+  1232070,
+  1232080,
+  1232170,
+  1232200,
+  1232210,
+  1232240,
+  1232250,
+  1232251,
+  1232252,
+  1232253,
+  1232254,
+  1232255,
+  1232256,
+  1232257,
+  1232320,
+  1232340,
+  1232350,
+  1232390,
+  1232520,
+  1232530,
+  1232540,
+  1232690,
+  1232740,
+  1232750,
+  1232770,
+  1232780,
+  1232910,
+  1232920,
+  1233050,
+  1233060,
+  1233061,
+  1233062,
+  1233080,
+  1233090,
+  1233100,
+  1233220,
+  1233280,
+  1233290,
+  1233310,
+  1233320,
+  1233330,
+  1233340,
+  1233360,
+  1233370,
+  1233371,
+  1233372,
+  1233373,
+  1233500,
+  1233650,
+  1233700,
+  1233840,
+  1234150,
+  1234170,
+  1234210,
+  1234230,
+  1234270,
+  1234350,
+  1234390,
+  1234391,
+  1234392,
+  1234393,
+  1234490,
+  1234510,
+  1234570,
+  1234610,
+  1234730,
+  1234740,
+  1234780,
+  1234950,
+  1235060,
+  1235080,
+  1235280,
+  1235330,
+  1235410,
+  1235530,
+  1235600,
+  1235660,
+  1235670,
+  1235720,
+  1235721,
+  1235722,
+  1235730,
+  1235731,
+  1235732,
+  1235733,
+  1235734,
+  1235740,
+  1235741,
+  1235742,
+  1235743,
+  1235744,
+  1235745,
+  1235746,
+  1235747,
+  1235750,
+  1235751,
+  1235752,
+  1235753,
+  1235754,
+  1235755,
+  1235756,
+  1235757,
+  1235758,
+  1235759,
+  1235760,
+  1235761,
+  1235762,
+  1235763,
+  1235764,
+  1235765,
+  1235766,
+  1235767,
+  1236010,
+  1236210,
+  1236230,
+  1236260,
+  1236280,
+  1236290,
+  1236360,
+  1236370,
+  1236440,
+  1236500,
+  1236501,
+  1236550,
+  1236610,
+  1236640,
+  1236650,
+  1236660,
+  1236710,
+  1236790,
+  1236890,
+  1237020,
+  1237030,
+  1237100,
+  1237160,
+  1237200,
+  1237230,
+  1237420,
+  1237430,
+  1237450,
+  1237470,
+  1237520,
+  1237521,
+  1237522,
+  1237523,
+  1237524,
+  1237525,
+  1237526,
+  1237527,
+  1237528,
+  1237600,
+  1237630,
+  1237650,
+  1237720,
+  1237721,
+  1237770,
+  1237830,
+  1237850,
+  1237860,
+  1237960,
+  1237990,
+  1238011,
+  1238012,
+  1238013,
+  1238014,
+  1238030,
+  1238050,
+  1238070,
+  1238090,
+  1238100,
+  1238101,
+  1238102,
+  1238103,
+  1238104,
+  1238105,
+  1238200,
+  1238210,
+  1238270,
+  1238290,
+  1238310,
+  1238350,
+  1238380,
+  1238381,
+  1238430,
+  1238440,
+  1238460,
+  1238530,
+  1238570,
+  1238590,
+  1238640,
+  1238660,
+  1238750,
+  1238760,
+  1238761,
+  1238762,
+  1238770,
+  1238790,
+  1238830,
+  1238831,
+  1238850,
+  1238851,
+  1238870,
+  1238871,
+  1238890,
+  1238891,
+  1239010,
+  1239060,
+  1239100,
+  1239110,
+  1239130,
+  1239150,
+  1239170,
+  1239210,
+  1239250,
+  1239290,
+  1239310,
+  1239390,
+  1239450,
+  1239510,
+  1239511,
+  1239512,
+  1239513,
+  1239514,
+  1239620,
+  1239640,
+  1239680,
+  1239780,
+  1239820,
+  1239830,
+  1239890,
+  1240020,
+  1240100,
+  1240151,
+  1240200,
+  1240260,
+  1240300,
+  1240301,
+  1240360,
+  1240380,
+  1240390,
+  1240650,
+  1240750,
+  1240760,
+  1240900,
+  1240930,
+  1240940,
+  1240950,
+  1240960,
+  1240970,
+  1240980,
+  1240990,
+  1241000,
+  1241010,
+  1241070,
+  1241080,
+  1241090,
+  1241190,
+  1241210,
+  1241240,
+  1241250,
+  1241260,
+  1241261,
+  1241262,
+  1241263,
+  1241264,
+  1241265,
+  1241266,
+  1241267,
+  1241268,
+  1241269,
+  1241270,
+  1241271,
+  1241272,
+  1241273,
+  1241274,
+  1241275,
+  1241276,
+  1241277,
+  1241278,
+  1241279,
+  1241280,
+  1241281,
+  1241282,
+  1241283,
+  1241284,
+  1241285,
+  1241286,
+  1241287,
+  1241288,
+  1241289,
+  1241290,
+  1241291,
+  1241292,
+  1241293,
+  1241294,
+  1241295,
+  1241296,
+  1241297,
+  1241298,
+  1241299,
+  1241300,
+  1241340,
+  1241341,
+  1241350,
+  1241351,
+  1241352,
+  1241450,
+  1241490,
+  1241550,
+  1241570,
+  1241580,
+  1241600,
+  1241640,
+  1241820,
+  1241830,
+  1241850,
+  1241870,
+  1241880,
+  1241930,
+  1242650,
+  1242680,
+  1242690,
+  1242710,
+  1242740,
+  1242741,
+  1242742,
+  1242743,
+  1242744,
+  1242745,
+  1242746,
+  1242747,
+  1242748,
+  1242749,
+  1242750,
+  1242751,
+  1242752,
+  1242753,
+  1242754,
+  1242755,
+  1242756,
+  1242757,
+  1242758,
+  1242759,
+  1242760,
+  1242761,
+  1242762,
+  1242763,
+  1242764,
+  1242765,
+  1242766,
+  1242767,
+  1242768,
+  1242769,
+  1242770,
+  1242771,
+  1242772,
+  1242773,
+  1242774,
+  1242775,
+  1242776,
+  1242777,
+  1242778,
+  1242779,
+  1242810,
+  1242830,
+  1242840,
+  1242850,
+  1242920,
+  1242970,
+  1243000,
+  1243020,
+  1243021,
+  1243070,
+  1243190,
+  1243380,
+  1243390,
+  1243400,
+  1243570,
+  1243680,
+  1243681,
+  1243682,
+  1243710,
+  1243770,
+  1243800,
+  1243840,
+  1243841,
+  1244040,
+  1244060,
+  1244070,
+  1244080,
+  1244160,
+  1244180,
+  1244230,
+  1244250,
+  1244270,
+  1244310,
+  1244390,
+  1244490,
+  1244510,
+  1244550,
+  1244560,
+  1244640,
+  1244670,
+  1244700,
+  1244701,
+  1244710,
+  1244780,
+  1244781,
+  1244840,
+  1244870,
+  1244880,
+  1244900,
+  1244920,
+  1245020,
+  1245030,
+  1245040,
+  1245050,
+  1245070,
+  1245100,
+  1245110,
+  1245120,
+  1245150,
+  1245180,
+  1245190,
+  1245200,
+  1245310,
+  1245320,
+  1245330,
+  1245340,
+  1245390,
+  1245400,
+  1245510,
+  1245590,
+  1245700,
+  1245880,
+  1245970,
+  1246030,
+  1246031,
+  1246032,
+  1246040,
+  1246090,
+  1246180,
+  1246181,
+  1246182,
+  1246183,
+  1246184,
+  1246185,
+  1246186,
+  1246187,
+  1246188,
+  1246189,
+  1246190,
+  1246191,
+  1246192,
+  1246210,
+  1246300,
+  1246310,
+  1246330,
+  1246370,
+  1246380,
+  1246400,
+  1246410,
+  1246411,
+  1246412,
+  1246413,
+  1246440,
+  1246500,
+  1246520,
+  1246530,
+  1246570,
+  1246590,
+  1246591,
+  1246610,
+  1246640,
+  1246660,
+  1246670,
+  1246700,
+  1246730,
+  1246740,
+  1246750,
+  1246760,
+  1246770,
+  1246810,
+  1246830,
+  1246840,
+  1246841,
+  1246842,
+  1246843,
+  1246890,
+  1246900,
+  1246910,
+  1246990,
+  1247000,
+  1247010,
+  1247090,
+  1247120,
+  1247130,
+  1247140,
+  1247150,
+  1247180,
+  1247200,
+  1247240,
+  1247270,
+  1247280,
+  1247290,
+  1247300,
+  1247320,
+  1247340,
+  1247380,
+  1247480,
+  1247560,
+  1247600,
+  1247610,
+  1247611,
+  1247612,
+  1247613,
+  1247614,
+  1247620,
+  1247680,
+  1247681,
+  1247700,
+  1247710,
+  1247711,
+  1247750,
+  1247760,
+  1247900,
+  1247901,
+  1247980,
+  1248020,
+  1248040,
+  1248050,
+  1248070,
+  1248160,
+  1248180,
+  1248181,
+  1248182,
+  1248183,
+  1248310,
+  1248320,
+  1248330,
+  1248331,
+  1248332,
+  1248333,
+  1248334,
+  1248335,
+  1248340,
+  1248360,
+  1248380,
+  1248400,
+  1248430,
+  1248431,
+  1248432,
+  1248433,
+  1248434,
+  1248530,
+  1248690,
+  1248880,
+  1248900,
+  1249000,
+  1249020,
+  1249030,
+  1249050,
+  1249100,
+  1249140,
+  1249160,
+  1249250,
+  1249251,
+  1249280,
+  1249310,
+  1249320,
+  1249340,
+  1249350,
+  1249360,
+  1249450,
+  1249570,
+  1249630,
+  1249650,
+  1249760,
+  1249770,
+  1249810,
+  1249900,
+  1249901,
+  1249902,
+  1249903,
+  1249920,
+  1249930,
+  1249990,
+  1250070,
+  1250110,
+  1250140,
+  1250170,
+  1250500,
+  1250550,
+  1250580,
+  1250581,
+  1250582,
+  1250583,
+  1250584,
+  1250585,
+  1250620,
+  1250621,
+  1250622,
+  1250690,
+  1250710,
+  1250730,
+  1250740,
+  1250830,
+  1250890,
+  1250920,
+  1250950,
+  1250951,
+  1250952,
+  1250953,
+  1250980,
+  1251000,
+  1251050,
+  1251180,
+  1251220,
+  1251230,
+  1251350,
+  1251420,
+  1251490,
+  1251491,
+  1251530,
+  1251570,
+  1251590,
+  1251610,
+  1251620,
+  1251640,
+  1251660,
+  1251720,
+  1251730,
+  1251810,
+  1251870,
+  1251940,
+  1252010,
+  1252080,
+  1252140,
+  1252180,
+  1252200,
+  1252260,
+  1252280,
+  1252290,
+  1252310,
+  1252340,
+  1252460,
+  1252520,
+  1252590,
+  1252660,
+  1252670,
+  1252700,
+  1252740,
+  1252750,
+  1252820,
+  1252870,
+  1252880,
+  1252881,
+  1252890,
+  1252910,
+  1252980,
+  1252990,
+  1253020,
+  1253090,
+  1253091,
+  1253092,
+  1253170,
+  1253280,
+  1253300,
+  1253301,
+  1253302,
+  1253340,
+  1253350,
+  1253420,
+  1253510,
+  1253530,
+  1253540,
+  1253550,
+  1253560,
+  1253600,
+  1253750,
+  1253751,
+  1253752,
+  1253753,
+  1253754,
+  1253755,
+  1253790,
+  1253830,
+  1253960,
+  1253970,
+  1253990,
+  1254000,
+  1254010,
+  1254030,
+  1254080,
+  1254081,
+  1254082,
+  1254083,
+  1254084,
+  1254090,
+  1254170,
+  1254171,
+  1254172,
+  1254173,
+  1254174,
+  1254175,
+  1254176,
+  1254190,
+  1254191,
+  1254192,
+  1254193,
+  1254210,
+  1254211,
+  1254212,
+  1254213,
+  1254240,
+  1254241,
+  1254270,
+  1254300,
+  1254340,
+  1254350,
+  1254380,
+  1254570,
+  1254580,
+  1254581,
+  1254582,
+  1254600,
+  1254650,
+  1254680,
+  1254700,
+  1254730,
+  1254750,
+  1254850,
+  1254851,
+  1254890,
+  1254910,
+  1254920,
+  1254921,
+  1254922,
+  1254923,
+  1254980,
+  1254990,
+  1254991,
+  1255000,
+  1255001,
+  1255070,
+  1255071,
+  1255072,
+  1255073,
+  1255074,
+  1255075,
+  1255080,
+  1255081,
+  1255120,
+  1255150,
+  1255151,
+  1255152,
+  1255250,
+  1255260,
+  1255270,
+  1255280,
+  1255310,
+  1255311,
+  1255340,
+  1255341,
+  1255342,
+  1255343,
+  1255344,
+  1255345,
+  1255346,
+  1255347,
+  1255348,
+  1255349,
+  1255350,
+  1255351,
+  1255352,
+  1255360,
+  1255361,
+  1255370,
+  1255390,
+  1255400,
+  1255401,
+  1255430,
+  1255440,
+  1255470,
+  1255490,
+  1255760,
+  1255850,
+  1255950,
+  1255960,
+  1256000,
+  1256030,
+  1256050,
+  1256090,
+  1256200,
+  1256240,
+  1256310,
+  1256350,
+  1256590,
+  1256620,
+  1256621,
+  1256740,
+  1256750,
+  1256780,
+  1256790,
+  1256800,
+  1256810,
+  1256840,
+  1256890,
+  1256910,
+  1256930,
+  1257321,
+  1257350,
+  1257351,
+  1257352,
+  1257380,
+  1257420,
+  1257440,
+  1257450,
+  1257460,
+  1257490,
+  1257570,
+  1257630,
+  1257640,
+  1257680,
+  1257730,
+  1257740,
+  1257741,
+  1257770,
+  1257790,
+  1257830,
+  1258150,
+  1258151,
+  1258152,
+  1258153,
+  1258154,
+  1258155,
+  1258170,
+  1258240,
+  1258280,
+  1258450,
+  1258490,
+  1258500,
+  1258510,
+  1258610,
+  1258690,
+  1258700,
+  1258701,
+  1258740,
+  1258910,
+  1259010,
+  1259090,
+  1259110,
+  1259150,
+  1259200,
+  1259250,
+  1259260,
+  1259270,
+  1259320,
+  1259360,
+  1259400,
+  1259410,
+  1259480,
+  1259490,
+  1259491,
+  1259492,
+  1259493,
+  1259494,
+  1259495,
+  1259496,
+  1259497,
+  1259498,
+  1259499,
+  1259650,
+  1259670,
+  1259680,
+  1259730,
+  1259750,
+  1259810,
+  1259900,
+  1259930,
+  1260050,
+  1260070,
+  1260200,
+  1260260,
+  1260270,
+  1260280,
+  1260290,
+  1260310,
+  1260350,
+  1260510,
+  1260650,
+  1260680,
+  1260900,
+  1260950,
+  1261050,
+  1261060,
+  1261120,
+  1261190,
+  1261250,
+  1261270,
+  1261310,
+  1261340,
+  1261380,
+  1261420,
+  1261460,
+  1261510,
+  1261540,
+  1261541,
+  1261542,
+  1261560,
+  1261600,
+  1261620,
+  1261680,
+  1261690,
+  1261691,
+  1261692,
+  1261693,
+  1261710,
+  1261711,
+  1261712,
+  1261713,
+  1261714,
+  1261715,
+  1261716,
+  1261717,
+  1261720,
+  1261840,
+  1261860,
+  1261861,
+  1261930,
+  1261940,
+  1262000,
+  1262010,
+  1262090,
+  1262130,
+  1262200,
+  1262220,
+  1262292,
+  1262300,
+  1262302,
+  1262303,
+  1262304,
+  1262340,
+  1262341,
+  1262342,
+  1262343,
+  1262344,
+  1262345,
+  1262346,
+  1262347,
+  1262348,
+  1262349,
+  1262370,
+  1262371,
+  1262372,
+  1262373,
+  1262374,
+  1262375,
+  1262376,
+  1262377,
+  1262378,
+  1262379,
+  1262390,
+  1262391,
+  1262392,
+  1262393,
+  1262394,
+  1262395,
+  1262396,
+  1262397,
+  1262398,
+  1262399,
+  1262400,
+  1262401,
+  1262402,
+  1262403,
+  1262404,
+  1262405,
+  1262406,
+  1262407,
+  1262408,
+  1262409,
+  1262410,
+  1262411,
+  1262412,
+  1262413,
+  1262414,
+  1262415,
+  1262416,
+  1262417,
+  1262418,
+  1262419,
+  1262420,
+  1262421,
+  1262422,
+  1262423,
+  1262424,
+  1262425,
+  1262426,
+  1262427,
+  1262428,
+  1262429,
+  1262430,
+  1262431,
+  1262432,
+  1262433,
+  1262434,
+  1262435,
+  1262436,
+  1262437,
+  1262438,
+  1262439,
+  1262480,
+  1262550,
+  1262570,
+  1262571,
+  1262572,
+  1262573,
+  1262590,
+  1262591,
+  1262592,
+  1262610,
+  1262660,
+  1262670,
+  1262740,
+  1262741,
+  1262742,
+  1262743,
+  1262810,
+  1262820,
+  1262980,
+  1262981,
+  1263020,
+  1263030,
+  1263040,
+  1263050,
+  1263080,
+  1263250,
+  1263260,
+  1263270,
+  1263280,
+  1263290,
+  1263300,
+  1263310,
+  1263320,
+  1263500,
+  1263560,
+  1263760,
+  1263790,
+  1263830,
+  1263870,
+  1264040,
+  1264101,
+  1264102,
+  1264103,
+  1264104,
+  1264105,
+  1264106,
+  1264110,
+  1264111,
+  1264112,
+  1264113,
+  1264114,
+  1264150,
+  1264170,
+  1264171,
+  1264172,
+  1264190,
+  1264270,
+  1264340,
+  1264370,
+  1264430,
+  1264440,
+  1264450,
+  1264460,
+  1264470,
+  1264640,
+  1264700,
+  1264780,
+  1264810,
+  1264860,
+  1265060,
+  1265061,
+  1265100,
+  1265180,
+  1265190,
+  1265250,
+  1265350,
+  1265450,
+  1265470,
+  1265471,
+  1265472,
+  1265473,
+  1265474,
+  1265475,
+  1265476,
+  1265560,
+  1265600,
+  1265620,
+  1265640,
+  1265670,
+  1265700,
+  1265710,
+  1265840,
+  1265910,
+  1265911,
+  1266000,
+  1266010,
+  1266020,
+  1266130,
+  1266230,
+  1266250,
+  1266500,
+  1266501,
+  1266502,
+  1266503,
+  1266510,
+  1266520,
+  1266580,
+  1266670,
+  1266710,
+  1266711,
+  1266712,
+  1266713,
+  1266714,
+  1266715,
+  1266716,
+  1266717,
+  1266718,
+  1266719,
+  1266740,
+  1266750,
+  1266760,
+  1266770,
+  1266860,
+  1266940,
+  1267030,
+  1267060,
+  1267080,
+  1267090,
+  1267091,
+  1267092,
+  1267093,
+  1267094,
+  1267095,
+  1267097,
+  1267098,
+  1267099,
+  1267100,
+  1267101,
+  1267102,
+  1267103,
+  1267104,
+  1267105,
+  1267106,
+  1267140,
+  1267250,
+  1267300,
+  1267340,
+  1267341,
+  1267342,
+  1267343,
+  1267344,
+  1267345,
+  1267346,
+  1267360,
+  1267361,
+  1267362,
+  1267363,
+  1267364,
+  1267365,
+  1267380,
+  1267381,
+  1267382,
+  1267383,
+  1267384,
+  1267440,
+  1267460,
+  1267480,
+  1267490,
+  1267500,
+  1267501,
+  1267502,
+  1267503,
+  1267504,
+  1267505,
+  1267506,
+  1267507,
+  1267509,
+  1267510,
+  1267590,
+  1267591,
+  1267592,
+  1267593,
+  1267594,
+  1267600,
+  1267710,
+  1267730,
+  1267780,
+  1267800,
+  1267801,
+  1267880,
+  1267900,
+  1267990,
+  1268010,
+  1268040,
+  1268050,
+  1268060,
+  1268120,
+  1268130,
+  1268210,
+  1268270,
+  1268300,
+  1268390,
+  1268391,
+  1268450,
+  1268460,
+  1268470,
+  1268500,
+  1268520,
+  1268560,
+  1268561,
+  1268570,
+  1268580,
+  1268610,
+  1268620,
+  1268820,
+  1268821,
+  1268850,
+  1268940,
+  1268970,
+  1268980,
+  1269010,
+  1269130,
+  1269220,
+  1269221,
+  1269310,
+  1269360,
+  1269440,
+  1269470,
+  1269490,
+  1269740,
+  1269741,
+  1269742,
+  1269743,
+  1269744,
+  1269745,
+  1269746,
+  1269747,
+  1269748,
+  1269749,
+  1269750,
+  1269751,
+  1269752,
+  1269753,
+  1269754,
+  1269755,
+  1269840,
+  1269880,
+  1269980,
+  1270000,
+  1270040,
+  1270090,
+  1270120,
+  1270140,
+  1270240,
+  1270250,
+  1270290,
+  1270320,
+  1270340,
+  1270480,
+  1270490,
+  1270540,
+  1270770,
+  1270790,
+  1270810,
+  1270830,
+  1270860,
+  1270950,
+  1271130,
+  1271131,
+  1271132,
+  1271133,
+  1271200,
+  1271210,
+  1271231,
+  1271240,
+  1271270,
+  1271330,
+  1271350,
+  1271370,
+  1271371,
+  1271450,
+  1271470,
+  1271570,
+  1271571,
+  1271670,
+  1271671,
+  1271680,
+  1271780,
+  1271790,
+  1271792,
+  1271793,
+  1271794,
+  1271800,
+  1271860,
+  1271861,
+  1271862,
+  1271880,
+  1271890,
+  1271891,
+  1271892,
+  1271893,
+  1272090,
+  1272170,
+  1272180,
+  1272210,
+  1272270,
+  1272380,
+  1272381,
+  1272382,
+  1272383,
+  1272384,
+  1272385,
+  1272430,
+  1272440,
+  1272480,
+  1272481,
+  1272490,
+  1272640,
+  1272641,
+  1272642,
+  1272643,
+  1272644,
+  1272645,
+  1272650,
+  1272654,
+  1272657,
+  1272770,
+  1272790,
+  1272810,
+  1272880,
+  1272930,
+  1272960,
+  1273030,
+  1273040,
+  1273050,
+  1273051,
+  1273052,
+  1273053,
+  1273054,
+  1273055,
+  1273056,
+  1273090,
+  1273140,
+  1273170,
+  1273190,
+  1273200,
+  1273370,
+  1273420,
+  1273460,
+  1273490,
+  1273620,
+  1273630,
+  1273850,
+  1273860,
+  1273910,
+  1273960,
+  1273961,
+  1273962,
+  1273963,
+  1273970,
+  1273971,
+  1274050,
+  1274080,
+  1274240,
+  1274410,
+  1274460,
+  1274660,
+  1274680,
+  1274950,
+  1274960,
+  1275020,
+  1275040,
+  1275050,
+  1275100,
+  1275360,
+  1275430,
+  1275440,
+  1275460,
+  1275470,
+  1275500,
+  1275530,
+  1275570,
+  1275580,
+  1275730,
+  1275740,
+  1275780,
+  1275900,
+  1275920,
+  1275950,
+  1275990,
+  1276020,
+  1276030,
+  1276050,
+  1276160,
+  1276180,
+  1276200,
+  1276210,
+  1276220,
+  1276230,
+  1276240,
+  1276250,
+  1276260,
+  1276280,
+  1276340,
+  1276341,
+  1276360,
+  1276380,
+  1276420,
+  1276500,
+  1276501,
+  1276502,
+  1276503,
+  1276520,
+  1276521,
+  1276522,
+  1276523,
+  1276524,
+  1276525,
+  1276560,
+  1276630,
+  1276650,
+  1276770,
+  1276780,
+  1276781,
+  1276830,
+  1276831,
+  1277220,
+  1277250,
+  1277260,
+  1277280,
+  1277370,
+  1277540,
+  1277550,
+  1277570,
+  1277600,
+  1277680,
+  1277690,
+  1277700,
+  1277830,
+  1277860,
+  1277960,
+  1277990,
+  1278000,
+  1278120,
+  1278130,
+  1278131,
+  1278133,
+  1278134,
+  1278240,
+  1278250,
+  1278260,
+  1278280,
+  1278300,
+  1278310,
+  1278311,
+  1278312,
+  1278313,
+  1278314,
+  1278315,
+  1278340,
+  1278450,
+  1278460,
+  1278470,
+  1278471,
+  1278472,
+  1278473,
+  1278474,
+  1278475,
+  1278476,
+  1278477,
+  1278480,
+  1278510,
+  1278550,
+  1278551,
+  1278570,
+  1278590,
+  1278610,
+  1278630,
+  1278680,
+  1278700,
+  1278740,
+  1278850,
+  1278870,
+  1278950,
+  1278951,
+  1278980,
+  1278990,
+  1279010,
+  1279011,
+  1279012,
+  1279013,
+  1279020,
+  1279210,
+  1279211,
+  1279250,
+  1279251,
+  1279252,
+  1279290,
+  1279291,
+  1279340,
+  1279341,
+  1279350,
+  1279351,
+  1279352,
+  1279353,
+  1279354,
+  1279355,
+  1279356,
+  1279357,
+  1279430,
+  1279460,
+  1279530,
+  1279550,
+  1279610,
+  1279670,
+  1279680,
+  1279710,
+  1279711,
+  1279712,
+  1279713,
+  1279714,
+  1279730,
+  1279740,
+  1279750,
+  1279780,
+  1279840,
+  1279850,
+  1279950,
+  1279960,
+  1280020,
+  1280050,
+  1280110,
+  1280120,
+  1280121,
+  1280123,
+  1280124,
+  1280125,
+  1280126,
+  1280127,
+  1280128,
+  1280129,
+  1280170,
+  1280390,
+  1280400,
+  1280420,
+  1280450,
+  1280510,
+  1280520,
+  1280800,
+  1280830,
+  1280870,
+  1280900,
+  1281000,
+  1281010,
+  1281060,
+  1281090,
+  1281110,
+  1281120,
+  1281210,
+  1281310,
+  1281330,
+  1281410,
+  1281500,
+  1281570,
+  1281571,
+  1281620,
+  1281710,
+  1281820,
+  1281870,
+  1281880,
+  1281881,
+  1281900,
+  1281910,
+  1281960,
+  1282030,
+  1282160,
+  1282170,
+  1282180,
+  1282190,
+  1282250,
+  1282290,
+  1282300,
+  1282350,
+  1282440,
+  1282450,
+  1282480,
+  1282481,
+  1282490,
+  1282530,
+  1282531,
+  1282532,
+  1282550,
+  1282620,
+  1282680,
+  1282681,
+  1282740,
+  1282750,
+  1282780,
+  1282781,
+  1282800,
+  1282840,
+  1282870,
+  1282960,
+  1282980,
+  1282990,
+  1283050,
+  1283090,
+  1283091,
+  1283150,
+  1283160,
+  1283161,
+  1283162,
+  1283163,
+  1283164,
+  1283200,
+  1283300,
+  1283320,
+  1283440,
+  1283530,
+  1283710,
+  1283711,
+  1283970,
+  1284010,
+  1284040,
+  1284060,
+  1284250,
+  1284270,
+  1284310,
+  1284470,
+  1284490,
+  1284500,
+  1284520,
+  1284580,
+  1284600,
+  1284640,
+  1284680,
+  1284690,
+  1284710,
+  1284712,
+  1284720,
+  1284880,
+  1284890,
+  1284900,
+  1284910,
+  1284920,
+  1284921,
+  1284970,
+  1284990,
+  1284991,
+  1284992,
+  1285030,
+  1285150,
+  1285220,
+  1285290,
+  1285300,
+  1285330,
+  1285332,
+  1285333,
+  1285334,
+  1285335,
+  1285336,
+  1285337,
+  1285338,
+  1285339,
+  1285340,
+  1285341,
+  1285342,
+  1285343,
+  1285344,
+  1285590,
+  1285591,
+  1285592,
+  1285593,
+  1285680,
+  1285770,
+  1285810,
+  1285880,
+  1285950,
+  1285980,
+  1285990,
+  1286000,
+  1286050,
+  1286090,
+  1286100,
+  1286130,
+  1286250,
+  1286251,
+  1286252,
+  1286253,
+  1286254,
+  1286255,
+  1286256,
+  1286290,
+  1286400,
+  1286440,
+  1286510,
+  1286540,
+  1286570,
+  1286590,
+  1286610,
+  1286630,
+  1286750,
+  1286760,
+  1286800,
+  1286820,
+  1286900,
+  1286902,
+  1286903,
+  1286904,
+  1286905,
+  1286912,
+  1286913,
+  1286914,
+  1286915,
+  1286916,
+  1286960,
+  1287020,
+  1287050,
+  1287051,
+  1287052,
+  1287053,
+  1287054,
+  1287055,
+  1287056,
+  1287057,
+  1287058,
+  1287059,
+  1287060,
+  1287061,
+  1287062,
+  1287063,
+  1287064,
+  1287065,
+  1287066,
+  1287067,
+  1287068,
+  1287069,
+  1287070,
+  1287071,
+  1287072,
+  1287073,
+  1287074,
+  1287075,
+  1287076,
+  1287081,
+  1287082,
+  1287083,
+  1287110,
+  1287300,
+  1287320,
+  1287321,
+  1287322,
+  1287323,
+  1287324,
+  1287360,
+  1287480,
+  1287490,
+  1287570,
+  1287580,
+  1287581,
+  1287582,
+  1287600,
+  1287601,
+  1287602,
+  1287720,
+  1287760,
+  1287770,
+  1287780,
+  1287820,
+  1287890,
+  1287960,
+  1287990,
+  1288000,
+  1288010,
+  1288050,
+  1288080,
+  1288150,
+  1288240,
+  1288340,
+  1288440,
+  1288460,
+  1288490,
+  1288520,
+  1288681,
+  1288682,
+  1288683,
+  1288684,
+  1288685,
+  1288690,
+  1288780,
+  1288850,
+  1288860,
+  1289110,
+  1289190,
+  1289191,
+  1289192,
+  1289211,
+  1289234,
+  1289360,
+  1289390,
+  1289400,
+  1289450,
+  1289451,
+  1289452,
+  1289453,
+  1289454,
+  1289460,
+  1289520,
+  1289590,
+  1289660,
+  1289700,
+  1289710,
+  1289730,
+  1289731,
+  1289740,
+  1289760,
+  1289910,
+  1289920,
+  1289950,
+  1290030,
+  1290180,
+  1290210,
+  1290250,
+  1290340,
+  1290380,
+  1290400,
+  1290401,
+  1290402,
+  1290410,
+  1290420,
+  1290422,
+  1290423,
+  1290424,
+  1290520,
+  1290521,
+  1290530,
+  1290531,
+  1290532,
+  1290580,
+  1290590,
+  1290630,
+  1290660,
+  1290690,
+  1290700,
+  1290730,
+  1290800,
+  1290840,
+  1290870,
+  1290890,
+  1290910,
+  1290911,
+  1290912,
+  1290913,
+  1290914,
+  1290915,
+  1290916,
+  1290917,
+  1290918,
+  1290950,
+  1290970,
+  1291030,
+  1291031,
+  1291032,
+  1291033,
+  1291034,
+  1291035,
+  1291036,
+  1291037,
+  1291038,
+  1291040,
+  1291180,
+  1291320,
+  1291360,
+  1291400,
+  1291480,
+  1291620,
+  1291630,
+  1291631,
+  1291632,
+  1291700,
+  1291760,
+  1291780,
+  1291781,
+  1291840,
+  1291850,
+  1291880,
+  1291881,
+  1291882,
+  1291883,
+  1291884,
+  1291885,
+  1291886,
+  1291887,
+  1291888,
+  1291889,
+  1291920,
+  1291930,
+  1291960,
+  1291980,
+  1292030,
+  1292130,
+  1292200,
+  1292230,
+  1292231,
+  1292300,
+  1292301,
+  1292302,
+  1292303,
+  1292304,
+  1292320,
+  1292350,
+  1292430,
+  1292590,
+  1292640,
+  1292780,
+  1292890,
+  1293030,
+  1293080,
+  1293240,
+  1293280,
+  1293320,
+  1293330,
+  1293340,
+  1293350,
+  1293360,
+  1293410,
+  1293500,
+  1293580,
+  1293590,
+  1293591,
+  1293620,
+  1293790,
+  1293870,
+  1293890,
+  1293891,
+  1293892,
+  1293893,
+  1294030,
+  1294130,
+  1294131,
+  1294140,
+  1294141,
+  1294142,
+  1294143,
+  1294144,
+  1294390,
+  1294440,
+  1294460,
+  1294530,
+  1294540,
+  1294560,
+  1294580,
+  1294610,
+  1294690,
+  1294770,
+  1294790,
+  1294800,
+  1294930,
+  1295040,
+  1295100,
+  1295110,
+  1295120,
+  1295130,
+  1295160,
+  1295180,
+  1295190,
+  1295240,
+  1295300,
+  1295330,
+  1295340,
+  1295350,
+  1295380,
+  1295710,
+  1295712,
+  1295713,
+  1295714,
+  1295715,
+  1295716,
+  1295717,
+  1295718,
+  1295719,
+  1295720,
+  1295721,
+  1295722,
+  1295723,
+  1295724,
+  1295725,
+  1295726,
+  1295727,
+  1295800,
+  1295830,
+  1295880,
+  1295890,
+  1295960,
+  1296230,
+  1296420,
+  1296640,
+  1296690,
+  1296710,
+  1296711,
+  1296712,
+  1296713,
+  1296714,
+  1296715,
+  1296730,
+  1296731,
+  1296740,
+  1296741,
+  1296742,
+  1296743,
+  1296744,
+  1296760,
+  1296761,
+  1296762,
+  1296763,
+  1296790,
+  1296820,
+  1296890,
+  1296891,
+  1296900,
+  1297050,
+  1297051,
+  1297120,
+  1297130,
+  1297410,
+  1297460,
+  1297600,
+  1297700,
+  1297730,
+  1297840,
+  1297850,
+  1298030,
+  1298040,
+  1298090,
+  1298210,
+  1298590,
+  1298650,
+  1298720,
+  1298780,
+  1298870,
+  1298920,
+  1298940,
+  1298980,
+  1299050,
+  1299090,
+  1299190,
+  1299200,
+  1299270,
+  1299300,
+  1299380,
+  1299390,
+  1299530,
+  1299590,
+  1299591,
+  1299610,
+  1299630,
+  1299740,
+  1299770,
+  1299980,
+  1300210,
+  1300211,
+  1300410,
+  1300450,
+  1300710,
+  1300770,
+  1300850,
+  1300851,
+  1300980,
+  1300990,
+  1301020,
+  1301021,
+  1301040,
+  1301050,
+  1301080,
+  1301490,
+  1301540,
+  1301740,
+  1301800,
+  1301870,
+  1302010,
+  1302040,
+  1302060,
+  1302210,
+  1302380,
+  1302410,
+  1302500,
+  1302520,
+  1302521,
+  1302522,
+  1302660,
+  1302810,
+  1302900,
+  1303030,
+  1303080,
+  1303081,
+  1303082,
+  1303150,
+  1303182,
+  1303183,
+  1303184,
+  1303190,
+  1303191,
+  1303192,
+  1303193,
+  1303194,
+  1303195,
+  1303196,
+  1303197,
+  1303198,
+  1303199,
+  1303200,
+  1303201,
+  1303310,
+  1303311,
+  1303312,
+  1303313,
+  1303314,
+  1303430,
+  1303490,
+  1303605,
+  1303780,
+  1303800,
+  1303830,
+  1303880,
+  1303891,
+  1303900,
+  1303910,
+  1303970,
+  1304020,
+  1304030,
+  1304031,
+  1304150,
+  1304190,
+  1304230,
+  1304240,
+  1304250,
+  1304410,
+  1304411,
+  1304412,
+  1304413,
+  1304414,
+  1304415,
+  1304416,
+  1304417,
+  1304418,
+  1304419,
+  1304440,
+  1304441,
+  1304442,
+  1304444,
+  1304445,
+  1304446,
+  1304447,
+  1304448,
+  1304449,
+  1304460,
+  1304461,
+  1304462,
+  1304463,
+  1304464,
+  1304467,
+  1304468,
+  1304469,
+  1304590,
+  1304591,
+  1304600,
+  1304601,
+  1304900,
+  1304960,
+  1305010,
+  1305040,
+  1305360,
+  1305410,
+  1305680,
+  1306000,
+  1306001,
+  1306050,
+  1306120,
+  1306130,
+  1306140,
+  1306230,
+  1306410,
+  1306810,
+  1306830,
+  1306870,
+  1307000,
+  1307050,
+  1307060,
+  1307170,
+  1307210,
+  1307290,
+  1307400,
+  1307420,
+  1307430,
+  1307440,
+  1307470,
+  1307540,
+  1307590,
+  1307591,
+  1307600,
+  1307680,
+  1307720,
+  1308010,
+  1308030,
+  1308070,
+  1308090,
+  1308110,
+  1308160,
+  1308180,
+  1308181,
+  1308182,
+  1308183,
+  1308200,
+  1308210,
+  1308260,
+  1308270,
+  1308640,
+  1308670,
+  1308680,
+  1308720,
+  1308721,
+  1308850,
+  1308900,
+  1308910,
+  1308930,
+  1308932,
+  1308933,
+  1308934,
+  1308935,
+  1309020,
+  1309070,
+  1309100,
+  1309101,
+  1309102,
+  1309103,
+  1309110,
+  1309120,
+  1309150,
+  1309151,
+  1309152,
+  1309153,
+  1309154,
+  1309155,
+  1309156,
+  1309159,
+  1309160,
+  1309230,
+  1309240,
+  1309250,
+  1309310,
+  1309420,
+  1309540,
+  1309541,
+  1309670,
+  1309690,
+  1309790,
+  1309930,
+  1310000,
+  1310060,
+  1310280,
+  1310290,
+  1310310,
+  1310320,
+  1310370,
+  1310430,
+  1310460,
+  1310730,
+  1310731,
+  1310760,
+  1310860,
+  1310920,
+  1311090,
+  1311091,
+  1311092,
+  1311094,
+  1311098,
+  1311100,
+  1311101,
+  1311102,
+  1311170,
+  1311180,
+  1311260,
+  1311340,
+  1311360,
+  1311600,
+  1311760,
+  1311790,
+  1311810,
+  1311820,
+  1311860,
+  1311870,
+  1311920,
+  1312040,
+  1312260,
+  1312300,
+  1312340,
+  1312410,
+  1312411,
+  1312412,
+  1312413,
+  1312414,
+  1312430,
+  1312530,
+  1312720,
+  1312820,
+  1312920,
+  1312930,
+  1312940,
+  1312980,
+  1313010,
+  1313020,
+  1313180,
+  1313300,
+  1313380,
+  1313460,
+  1313480,
+  1313500,
+  1313610,
+  1313690,
+  1313710,
+  1313800,
+  1313840,
+  1313850,
+  1314060,
+  1314061,
+  1314062,
+  1314130,
+  1314150,
+  1314350,
+  1314360,
+  1314370,
+  1314440,
+  1314470,
+  1314490,
+  1314550,
+  1314560,
+  1314561,
+  1314562,
+  1314563,
+  1314660,
+  1314720,
+  1314760,
+  1314761,
+  1314762,
+  1314763,
+  1314764,
+  1314765,
+  1314790,
+  1314850,
+  1314900,
+  1314950,
+  1314951,
+  1315010,
+  1315140,
+  1315150,
+  1315260,
+  1315290,
+  1315300,
+  1315350,
+  1315400,
+  1315430,
+  1315431,
+  1315432,
+  1315433,
+  1315434,
+  1315435,
+  1315440,
+  1315441,
+  1315442,
+  1315443,
+  1315460,
+  1315470,
+  1315471,
+  1315472,
+  1315480,
+  1315510,
+  1315520,
+  1315540,
+  1315550,
+  1315560,
+  1315570,
+  1315580,
+  1315600,
+  1315700,
+  1315750,
+  1315751,
+  1315752,
+  1315760,
+  1315800,
+  1315801,
+  1315802,
+  1315803,
+  1315804,
+  1315805,
+  1315806,
+  1315807,
+  1315808,
+  1315809,
+  1315830,
+  1315870,
+  1315871,
+  1315872,
+  1315873,
+  1315874,
+  1315875,
+  1315876,
+  1315877,
+  1315878,
+  1315960,
+  1315970,
+  1315990,
+  1316020,
+  1316021,
+  1316022,
+  1316023,
+  1316024,
+  1316025,
+  1316026,
+  1316027,
+  1316028,
+  1316029,
+  1316070,
+  1316071,
+  1316072,
+  1316073,
+  1316074,
+  1316075,
+  1316076,
+  1316080,
+  1316110,
+  1316140,
+  1316141,
+  1316142,
+  1316143,
+  1316144,
+  1316145,
+  1316146,
+  1316180,
+  1316181,
+  1316182,
+  1316183,
+  1316184,
+  1316185,
+  1316240,
+  1316241,
+  1316242,
+  1316250,
+  1316260,
+  1316261,
+  1316262,
+  1316263,
+  1316264,
+  1316265,
+  1316270,
+  1316271,
+  1316272,
+  1316273,
+  1316274,
+  1316275,
+  1316300,
+  1316340,
+  1316350,
+  1316450,
+  1316470,
+  1316480,
+  1316540,
+  1316550,
+  1316600,
+  1316670,
+  1316710,
+  1316750,
+  1316780,
+  1316810,
+  1316840,
+  1316880,
+  1317080,
+  1317160,
+  1317180,
+  1317200,
+  1317230,
+  1317250,
+  1317260,
+  1317280,
+  1317300,
+  1317380,
+  1317470,
+  1317471,
+  1317472,
+  1317473,
+  1317474,
+  1317475,
+  1317476,
+  1317481,
+  1317482,
+  1317483,
+  1317484,
+  1317485,
+  1317486,
+  1317487,
+  1317488,
+  1317489,
+  1317490,
+  1317491,
+  1317493,
+  1317494,
+  1317495,
+  1317840,
+  1317890,
+  1317920,
+  1317970,
+  1317980,
+  1318030,
+  1318140,
+  1318160,
+  1318170,
+  1318250,
+  1318270,
+  1318290,
+  1318300,
+  1318320,
+  1318360,
+  1318380,
+  1318430,
+  1318720,
+  1318760,
+  1318880,
+  1318890,
+  1318960,
+  1319000,
+  1319030,
+  1319050,
+  1319410,
+  1319450,
+  1319490,
+  1319580,
+  1319590,
+  1319640,
+  1319660,
+  1319750,
+  1319770,
+  1319810,
+  1319870,
+  1319980,
+  1320330,
+  1320350,
+  1320540,
+  1320600,
+  1320670,
+  1320690,
+  1320700,
+  1320820,
+  1320850,
+  1320851,
+  1321290,
+  1321360,
+  1321370,
+  1321550,
+  1321580,
+  1321770,
+  1321790,
+  1322020,
+  1322120,
+  1322250,
+  1322320,
+  1322340,
+  1322430,
+  1322470,
+  1322500,
+  1322510,
+  1322511,
+  1322512,
+  1322670,
+  1322770,
+  1322790,
+  1322791,
+  1322792,
+  1322793,
+  1322794,
+  1322795,
+  1322796,
+  1322797,
+  1322798,
+  1323110,
+  1323210,
+  1323240,
+  1323241,
+  1323242,
+  1323320,
+  1323360,
+  1323510,
+  1323720,
+  1323810,
+  1323940,
+  1323941,
+  1324000,
+  1324060,
+  1324140,
+  1324160,
+  1324190,
+  1324240,
+  1324390,
+  1324470,
+  1324480,
+  1324590,
+  1324660,
+  1324670,
+  1324700,
+  1324740,
+  1324741,
+  1324970,
+  1324971,
+  1325400,
+  1325500,
+  1325620,
+  1325690,
+  1325700,
+  1325730,
+  1325790,
+  1325860,
+  1325940,
+  1326060,
+  1326300,
+  1326650,
+  1326710,
+  1326720,
+  1326730,
+  1326770,
+  1327030,
+  1327140,
+  1327240,
+  1327300,
+  1327330,
+  1327341,
+  1327410,
+  1327420,
+  1327490,
+  1327530,
+  1327630,
+  1327700,
+  1327730,
+  1327770,
+  1327790,
+  1327840,
+  1327841,
+  1327842,
+  1327890,
+  1327891,
+  1328010,
+  1328030,
+  1328031,
+  1328032,
+  1328170,
+  1328340,
+  1328341,
+  1328420,
+  1328421,
+  1328550,
+  1328610,
+  1328640,
+  1328650,
+  1328690,
+  1328700,
+  1328880,
+  1328950,
+  1328960,
+  1329020,
+  1329050,
+  1329060,
+  1329070,
+  1329090,
+  1329100,
+  1329120,
+  1329140,
+  1329160,
+  1329230,
+  1329250,
+  1329260,
+  1329261,
+  1329262,
+  1329263,
+  1329264,
+  1329380,
+  1329550,
+  1329551,
+  1329552,
+  1329553,
+  1329554,
+  1329555,
+  1329556,
+  1329557,
+  1329558,
+  1329559,
+  1329570,
+  1329571,
+  1329572,
+  1329573,
+  1329580,
+  1329590,
+  1329700,
+  1329701,
+  1329702,
+  1329703,
+  1329704,
+  1329705,
+  1329706,
+  1329707,
+  1329708,
+  1329720,
+  1329740,
+  1329760,
+  1329761,
+  1329770,
+  1329780,
+  1329870,
+  1329900,
+  1329920,
+  1329970,
+  1330040,
+  1330070,
+  1330130,
+  1330150,
+  1330210,
+  1330211,
+  1330212,
+  1330213,
+  1330214,
+  1330215,
+  1330216,
+  1330217,
+  1330218,
+  1330219,
+  1330240,
+  1330320,
+  1330350,
+  1330380,
+  1330410,
+  1330420,
+  1330450,
+  1330480,
+  1330600,
+  1330601,
+  1330602,
+  1330720,
+  1330721,
+  1330750,
+  1330810,
+  1330900,
+  1330910,
+  1330970,
+  1331000,
+  1331001,
+  1331002,
+  1331010,
+  1331011,
+  1331020,
+  1331021,
+  1331110,
+  1331111,
+  1331112,
+  1331113,
+  1331114,
+  1331115,
+  1331130,
+  1331140,
+  1331150,
+  1331160,
+  1331220,
+  1331221,
+  1331250,
+  1331270,
+  1331280,
+  1331350,
+  1331360,
+  1331520,
+  1331720,
+  1331730,
+  1331740,
+  1331750,
+  1331760,
+  1331770,
+  1331780,
+  1331790,
+  1331800,
+  1331810,
+  1331820,
+  1331821,
+  1332020,
+  1332230,
+  1332400,
+  1332420,
+  1332480,
+  1332520,
+  1332560,
+  1332640,
+  1332680,
+  1332681,
+  1332682,
+  1332683,
+  1332684,
+  1332685,
+  1332686,
+  1332687,
+  1332700,
+  1332810,
+  1332870,
+  1332980,
+  1333010,
+  1333140,
+  1333170,
+  1333173,
+  1333174,
+  1333175,
+  1333176,
+  1333177,
+  1333178,
+  1333179,
+  1333210,
+  1333220,
+  1333370,
+  1333390,
+  1333400,
+  1333510,
+  1333550,
+  1333570,
+  1333640,
+  1333740,
+  1333741,
+  1333760,
+  1333770,
+  1334030,
+  1334270,
+  1334370,
+  1334400,
+  1334410,
+  1334430,
+  1334460,
+  1334470,
+  1334480,
+  1334490,
+  1334680,
+  1334710,
+  1334770,
+  1334790,
+  1334791,
+  1334792,
+  1334810,
+  1334870,
+  1334890,
+  1334930,
+  1335070,
+  1335080,
+  1335090,
+  1335100,
+  1335110,
+  1335120,
+  1335130,
+  1335140,
+  1335150,
+  1335160,
+  1335170,
+  1335190,
+  1335290,
+  1335390,
+  1335450,
+  1335650,
+  1335690,
+  1335740,
+  1335750,
+  1335840,
+  1335870,
+  1335930,
+  1335950,
+  1335980,
+  1335990,
+  1336220,
+  1336240,
+  1336270,
+  1336320,
+  1336321,
+  1336322,
+  1336350,
+  1336390,
+  1336480,
+  1336481,
+  1336482,
+  1336483,
+  1336484,
+  1336550,
+  1336610,
+  1336710,
+  1336711,
+  1336720,
+  1336740,
+  1336780,
+  1336810,
+  1336850,
+  1336870,
+  1336900,
+  1336901,
+  1336930,
+  1337060,
+  1337090,
+  1337091,
+  1337092,
+  1337180,
+  1337181,
+  1337182,
+  1337360,
+  1337370,
+  1337440,
+  1337450,
+  1337470,
+  1337490,
+  1337500,
+  1337510,
+  1337560,
+  1337570,
+  1337580,
+  1337690,
+  1337740,
+  1337860,
+  1337900,
+  1337901,
+  1337902,
+  1337904,
+  1337905,
+  1337950,
+  1337990,
+  1338040,
+  1338060,
+  1338070,
+  1338080,
+  1338270,
+  1338300,
+  1338310,
+  1338370,
+  1338400,
+  1338470,
+  1338540,
+  1338630,
+  1338700,
+  1338740,
+  1338870,
+  1338890,
+  1338900,
+  1338960,
+  1338961,
+  1338962,
+  1338963,
+  1338964,
+  1339010,
+  1339011,
+  1339012,
+  1339060,
+  1339270,
+  1339320,
+  1339390,
+  1339391,
+  1339400,
+  1339430,
+  1339431,
+  1339432,
+  1339440,
+  1339520,
+  1339660,
+  1339680,
+  1339700,
+  1339770,
+  1339771,
+  1339910,
+  1339930,
+  1339940,
+  1339950,
+  1339990,
+  1340060,
+  1340070,
+  1340280,
+  1340350,
+  1340351,
+  1340461,
+  1340462,
+  1340463,
+  1340464,
+  1340510,
+  1340590,
+  1340610,
+  1340611,
+  1340612,
+  1340613,
+  1340614,
+  1340615,
+  1340616,
+  1340617,
+  1340670,
+  1340700,
+  1340750,
+  1340940,
+  1341180,
+  1341320,
+  1341350,
+  1341351,
+  1341380,
+  1341410,
+  1341411,
+  1341412,
+  1341413,
+  1341414,
+  1341520,
+  1341530,
+  1341531,
+  1341580,
+  1341590,
+  1341690,
+  1341700,
+  1341701,
+  1341702,
+  1341703,
+  1341790,
+  1341810,
+  1341860,
+  1341910,
+  1341920,
+  1341970,
+  1342010,
+  1342160,
+  1342190,
+  1342230,
+  1342440,
+  1342450,
+  1342460,
+  1342510,
+  1342570,
+  1342580,
+  1342650,
+  1342670,
+  1342680,
+  1342710,
+  1342711,
+  1342712,
+  1342713,
+  1342720,
+  1342760,
+  1342820,
+  1342830,
+  1342831,
+  1342840,
+  1342870,
+  1342880,
+  1342881,
+  1342882,
+  1342883,
+  1342980,
+  1343000,
+  1343160,
+  1343161,
+  1343180,
+  1343181,
+  1343182,
+  1343250,
+  1343320,
+  1343360,
+  1343490,
+  1343500,
+  1343530,
+  1343540,
+  1343612,
+  1343650,
+  1343740,
+  1343760,
+  1343770,
+  1343780,
+  1343790,
+  1343860,
+  1343980,
+  1344000,
+  1344040,
+  1344050,
+  1344060,
+  1344100,
+  1344150,
+  1344151,
+  1344152,
+  1344153,
+  1344190,
+  1344191,
+  1344192,
+  1344193,
+  1344194,
+  1344280,
+  1344320,
+  1344470,
+  1344610,
+  1344620,
+  1344650,
+  1344680,
+  1344850,
+  1345060,
+  1345070,
+  1345230,
+  1345231,
+  1345232,
+  1345233,
+  1345310,
+  1345500,
+  1345510,
+  1345560,
+  1345580,
+  1345610,
+  1345620,
+  1345630,
+  1345800,
+  1345840,
+  1345920,
+  1345930,
+  1345960,
+  1345961,
+  1345962,
+  1345970,
+  1345990,
+  1346040,
+  1346050,
+  1346060,
+  1346080,
+  1346090,
+  1346140,
+  1346150,
+  1346160,
+  1346500,
+  1346510,
+  1346520,
+  1346540,
+  1346541,
+  1346580,
+  1346590,
+  1346730,
+  1346760,
+  1346820,
+  1346880,
+  1346910,
+  1346920,
+  1346930,
+  1347090,
+  1347100,
+  1347270,
+  1347340,
+  1347341,
+  1347370,
+  1347380,
+  1347400,
+  1347410,
+  1347520,
+  1347610,
+  1347611,
+  1347640,
+  1347650,
+  1347720,
+  1347740,
+  1347750,
+  1347751,
+  1347790,
+  1347830,
+  1347890,
+  1347920,
+  1347980,
+  1347990,
+  1348090,
+  1348140,
+  1348150,
+  1348190,
+  1348420,
+  1348470,
+  1348500,
+  1348590,
+  1348620,
+  1348640,
+  1348650,
+  1348660,
+  1348661,
+  1348670,
+  1348710,
+  1348720,
+  1348740,
+  1348780,
+  1348850,
+  1348890,
+  1348900,
+  1349010,
+  1349180,
+  1349250,
+  1349320,
+  1349350,
+  1349400,
+  1349480,
+  1349490,
+  1349491,
+  1349492,
+  1349520,
+  1349521,
+  1349522,
+  1349523,
+  1349580,
+  1349611,
+  1349612,
+  1349613,
+  1349614,
+  1349616,
+  1349650,
+  1349651,
+  1349652,
+  1349653,
+  1349660,
+  1349661,
+  1349662,
+  1349663,
+  1349700,
+  1349750,
+  1349770,
+  1350040,
+  1350400,
+  1350460,
+  1350520,
+  1350550,
+  1350600,
+  1350601,
+  1350602,
+  1350603,
+  1350604,
+  1350660,
+  1350680,
+  1350750,
+  1350800,
+  1350870,
+  1350880,
+  1350900,
+  1350910,
+  1350930,
+  1350940,
+  1350960,
+  1350970,
+  1350980,
+  1350990,
+  1351010,
+  1351020,
+  1351030,
+  1351040,
+  1351050,
+  1351060,
+  1351100,
+  1351160,
+  1351161,
+  1351230,
+  1351260,
+  1351261,
+  1351270,
+  1351271,
+  1351320,
+  1351390,
+  1351420,
+  1351570,
+  1351571,
+  1351572,
+  1351600,
+  1351601,
+  1351602,
+  1351603,
+  1351604,
+  1351790,
+  1351860,
+  1351861,
+  1351910,
+  1351920,
+  1351990,
+  1352030,
+  1352110,
+  1352160,
+  1352170,
+  1352171,
+  1352172,
+  1352173,
+  1352320,
+  1352360,
+  1352580,
+  1352581,
+  1352582,
+  1352583,
+  1352584,
+  1352585,
+  1352720,
+  1352721,
+  1352750,
+  1352780,
+  1352880,
+  1352940,
+  1352980,
+  1352990,
+  1353000,
+  1353060,
+  1353080,
+  1353090,
+  1353110,
+  1353170,
+  1353190,
+  1353290,
+  1353320,
+  1353360,
+  1353430,
+  1353480,
+  1353490,
+  1353520,
+  1353521,
+  1353522,
+  1353600,
+  1353700,
+  1353701,
+  1353710,
+  1353740,
+  1353750,
+  1353770,
+  1353780,
+  1353840,
+  1353960,
+  1353980,
+  1353990,
+  1354010,
+  1354050,
+  1354051,
+  1354052,
+  1354053,
+  1354110,
+  1354111,
+  1354120,
+  1354200,
+  1354220,
+  1354250,
+  1354280,
+  1354290,
+  1354310,
+  1354312,
+  1354320,
+  1354350,
+  1354380,
+  1354410,
+  1354430,
+  1354431,
+  1354560,
+  1354561,
+  1354600,
+  1354620,
+  1354630,
+  1354631,
+  1354640,
+  1354650,
+  1354670,
+  1354740,
+  1354741,
+  1354790,
+  1354810,
+  1354811,
+  1354812,
+  1354813,
+  1354814,
+  1354815,
+  1354816,
+  1354817,
+  1354818,
+  1354819,
+  1354860,
+  1354861,
+  1354862,
+  1354870,
+  1354880,
+  1354950,
+  1354960,
+  1355080,
+  1355130,
+  1355150,
+  1355151,
+  1355280,
+  1355281,
+  1355282,
+  1355283,
+  1355600,
+  1355640,
+  1355700,
+  1355740,
+  1355741,
+  1355750,
+  1355751,
+  1355752,
+  1355753,
+  1355754,
+  1355840,
+  1355850,
+  1355851,
+  1355852,
+  1355853,
+  1355854,
+  1355855,
+  1355856,
+  1355857,
+  1355858,
+  1355859,
+  1355870,
+  1355871,
+  1355872,
+  1355890,
+  1355920,
+  1355940,
+  1356000,
+  1356001,
+  1356010,
+  1356050,
+  1356110,
+  1356140,
+  1356210,
+  1356211,
+  1356220,
+  1356221,
+  1356222,
+  1356310,
+  1356330,
+  1356331,
+  1356340,
+  1356370,
+  1356371,
+  1356410,
+  1356411,
+  1356430,
+  1356490,
+  1356500,
+  1356510,
+  1356570,
+  1356690,
+  1356730,
+  1356731,
+  1356732,
+  1356733,
+  1356850,
+  1356900,
+  1356920,
+  1356930,
+  1356980,
+  1357070,
+  1357071,
+  1357160,
+  1357170,
+  1357171,
+  1357180,
+  1357310,
+  1357311,
+  1357312,
+  1357313,
+  1357330,
+  1357340,
+  1357360,
+  1357370,
+  1357371,
+  1357372,
+  1357470,
+  1357480,
+  1357650,
+  1357690,
+  1357730,
+  1357760,
+  1357770,
+  1357880,
+  1357900,
+  1357910,
+  1357950,
+  1357970,
+  1358040,
+  1358070,
+  1358160,
+  1358161,
+  1358162,
+  1358200,
+  1358220,
+  1358240,
+  1358280,
+  1358330,
+  1358460,
+  1358461,
+  1358500,
+  1358520,
+  1358680,
+  1358800,
+  1358890,
+  1359040,
+  1359050,
+  1359180,
+  1359200,
+  1359210,
+  1359230,
+  1359320,
+  1359460,
+  1359590,
+  1359610,
+  1359660,
+  1359670,
+  1359740,
+  1359750,
+  1359770,
+  1359780,
+  1359860,
+  1359880,
+  1360020,
+  1360060,
+  1360120,
+  1360240,
+  1360310,
+  1360311,
+  1360312,
+  1360313,
+  1360314,
+  1360315,
+  1360316,
+  1360317,
+  1360318,
+  1360319,
+  1360320,
+  1360321,
+  1360322,
+  1360323,
+  1360324,
+  1360325,
+  1360326,
+  1360327,
+  1360328,
+  1360329,
+  1360330,
+  1360331,
+  1360332,
+  1360333,
+  1360334,
+  1360335,
+  1360340,
+  1360341,
+  1360342,
+  1360343,
+  1360344,
+  1360345,
+  1360346,
+  1360347,
+  1360348,
+  1360349,
+  1360350,
+  1360351,
+  1360352,
+  1360353,
+  1360354,
+  1360355,
+  1360356,
+  1360357,
+  1360370,
+  1360540,
+  1360630,
+  1360680,
+  1360910,
+  1360950,
+  1360970,
+  1361030,
+  1361080,
+  1361170,
+  1361250,
+  1361280,
+  1361310,
+  1361311,
+  1361340,
+  1361370,
+  1361420,
+  1361450,
+  1361590,
+  1361591,
+  1361620,
+  1361770,
+  1361830,
+  1361831,
+  1361930,
+  1361960,
+  1362080,
+  1362100,
+  1362101,
+  1362102,
+  1362103,
+  1362104,
+  1362105,
+  1362106,
+  1362107,
+  1362108,
+  1362109,
+  1362110,
+  1362111,
+  1362112,
+  1362113,
+  1362114,
+  1362115,
+  1362116,
+  1362117,
+  1362118,
+  1362119,
+  1362150,
+  1362151,
+  1362152,
+  1362153,
+  1362154,
+  1362155,
+  1362156,
+  1362157,
+  1362158,
+  1362159,
+  1362160,
+  1362161,
+  1362162,
+  1362163,
+  1362164,
+  1362165,
+  1362166,
+  1362167,
+  1362168,
+  1362169,
+  1362170,
+  1362171,
+  1362172,
+  1362173,
+  1362174,
+  1362175,
+  1362176,
+  1362177,
+  1362178,
+  1362179,
+  1362180,
+  1362220,
+  1362221,
+  1362222,
+  1362223,
+  1362224,
+  1362330,
+  1362370,
+  1362410,
+  1362540,
+  1362600,
+  1362601,
+  1362602,
+  1362640,
+  1362660,
+  1362730,
+  1362790,
+  1362930,
+  1363000,
+  1363060,
+  1363070,
+  1363100,
+  1363110,
+  1363240,
+  1363250,
+  1363370,
+  1363410,
+  1363450,
+  1363500,
+  1363540,
+  1363591,
+  1363630,
+  1363631,
+  1363632,
+  1363640,
+  1363650,
+  1363750,
+  1363880,
+  1363910,
+  1364030,
+  1364032,
+  1364033,
+  1364034,
+  1364035,
+  1364036,
+  1364037,
+  1364038,
+  1364039,
+  1364050,
+  1364051,
+  1364110,
+  1364111,
+  1364190,
+  1364220,
+  1364221,
+  1364222,
+  1364224,
+  1364310,
+  1364320,
+  1364390,
+  1364440,
+  1364470,
+  1364480,
+  1364520,
+  1364521,
+  1364550,
+  1364590,
+  1364650,
+  1364660,
+  1364661,
+  1364662,
+  1364663,
+  1364664,
+  1364770,
+  1364790,
+  1364840,
+  1364970,
+  1364971,
+  1365000,
+  1365020,
+  1365050,
+  1365060,
+  1365070,
+  1365080,
+  1365090,
+  1365100,
+  1365110,
+  1365120,
+  1365130,
+  1365150,
+  1365160,
+  1365170,
+  1365180,
+  1365190,
+  1365200,
+  1365210,
+  1365220,
+  1365230,
+  1365240,
+  1365250,
+  1365260,
+  1365270,
+  1365280,
+  1365290,
+  1365300,
+  1365310,
+  1365320,
+  1365330,
+  1365340,
+  1365350,
+  1365360,
+  1365420,
+  1365440,
+  1365460,
+  1365580,
+  1365650,
+  1365710,
+  1365760,
+  1365870,
+  1365980,
+  1365990,
+  1366050,
+  1366090,
+  1366091,
+  1366190,
+  1366270,
+  1366300,
+  1366370,
+  1366410,
+  1366460,
+  1366470,
+  1366500,
+  1366580,
+  1366600,
+  1366640,
+  1366800,
+  1366900,
+  1366910,
+  1366920,
+  1366950,
+  1367000,
+  1367030,
+  1367140,
+  1367150,
+  1367290,
+  1367390,
+  1367400,
+  1367480,
+  1367570,
+  1367610,
+  1367630,
+  1367640,
+  1367650,
+  1367660,
+  1367670,
+  1367740,
+  1367800,
+  1367801,
+  1367850,
+  1367930,
+  1368090,
+  1368110,
+  1368210,
+  1368360,
+  1368370,
+  1368380,
+  1368390,
+  1368501,
+  1368502,
+  1368503,
+  1368570,
+  1368571,
+  1368572,
+  1368610,
+  1368630,
+  1368740,
+  1368790,
+  1368800,
+  1368801,
+  1368920,
+  1368930,
+  1368931,
+  1368950,
+  1368980,
+  1368981,
+  1368982,
+  1368983,
+  1368984,
+  1369000,
+  1369020,
+  1369030,
+  1369100,
+  1369120,
+  1369190,
+  1369210,
+  1369220,
+  1369230,
+  1369250,
+  1369260,
+  1369270,
+  1369280,
+  1369290,
+  1369310,
+  1369380,
+  1369440,
+  1369450,
+  1369451,
+  1369452,
+  1369453,
+  1369454,
+  1369455,
+  1369456,
+  1369490,
+  1369530,
+  1369680,
+  1370010,
+  1370020,
+  1370080,
+  1370100,
+  1370190,
+  1370230,
+  1370240,
+  1370260,
+  1370280,
+  1370350,
+  1370650,
+  1370740,
+  1370780,
+  1370790,
+  1370800,
+  1370810,
+  1370890,
+  1370900,
+  1370901,
+  1370902,
+  1370930,
+  1371030,
+  1371250,
+  1371400,
+  1371401,
+  1371402,
+  1371403,
+  1371404,
+  1371405,
+  1371406,
+  1371407,
+  1371408,
+  1371409,
+  1371420,
+  1371421,
+  1371422,
+  1371423,
+  1371424,
+  1371425,
+  1371426,
+  1371427,
+  1371428,
+  1371429,
+  1371430,
+  1371650,
+  1371651,
+  1371652,
+  1371654,
+  1371830,
+  1371870,
+  1372020,
+  1372021,
+  1372130,
+  1372400,
+  1372490,
+  1372540,
+  1372690,
+  1372710,
+  1372740,
+  1372790,
+  1372791,
+  1372960,
+  1372980,
+  1373150,
+  1373160,
+  1373340,
+  1373480,
+  1373490,
+  1373660,
+  1373820,
+  1374000,
+  1374150,
+  1374190,
+  1374340,
+  1374380,
+  1374420,
+  1374450,
+  1374520,
+  1374610,
+  1374620,
+  1374650,
+  1374660,
+  1374710,
+  1374730,
+  1374731,
+  1374732,
+  1374733,
+  1374734,
+  1374735,
+  1374790,
+  1374870,
+  1374880,
+  1375100,
+  1375110,
+  1375190,
+  1375200,
+  1375250,
+  1375350,
+  1375360,
+  1375361,
+  1375362,
+  1375363,
+  1375364,
+  1375365,
+  1375366,
+  1375367,
+  1375368,
+  1375369,
+  1375370,
+  1375470,
+  1375471,
+  1375550,
+  1375580,
+  1375590,
+  1375600,
+  1375610,
+  1375660,
+  1375680,
+  1375700,
+  1376000,
+  1376240,
+  1376250,
+  1376260,
+  1376280,
+  1376400,
+  1376490,
+  1376500,
+  1376530,
+  1376570,
+  1376650,
+  1376670,
+  1376680,
+  1376720,
+  1376750,
+  1376770,
+  1376900,
+  1376920,
+  1376930,
+  1376970,
+  1376971,
+  1376972,
+  1376973,
+  1376974,
+  1377080,
+  1377090,
+  1377100,
+  1377130,
+  1377210,
+  1377220,
+  1377340,
+  1377460,
+  1377530,
+  1377570,
+  1377650,
+  1377660,
+  1377670,
+  1377690,
+  1377720,
+  1377730,
+  1377740,
+  1377750,
+  1377830,
+  1377860,
+  1377870,
+  1377880,
+  1377910,
+  1377960,
+  1378190,
+  1378191,
+  1378192,
+  1378193,
+  1378194,
+  1378195,
+  1378196,
+  1378197,
+  1378198,
+  1378240,
+  1378241,
+  1378340,
+  1378341,
+  1378342,
+  1378343,
+  1378344,
+  1378420,
+  1378430,
+  1378440,
+  1378450,
+  1378460,
+  1378510,
+  1378520,
+  1378530,
+  1378540,
+  1378560,
+  1378600,
+  1378610,
+  1378680,
+  1378740,
+  1378760,
+  1378950,
+  1378980,
+  1379080,
+  1379100,
+  1379170,
+  1379180,
+  1379220,
+  1379221,
+  1379222,
+  1379260,
+  1379261,
+  1379280,
+  1379300,
+  1379310,
+  1379311,
+  1379330,
+  1379360,
+  1379390,
+  1379420,
+  1379430,
+  1379440,
+  1379480,
+  1379540,
+  1379541,
+  1379690,
+  1379720,
+  1379740,
+  1379780,
+  1379800,
+  1379950,
+  1380020,
+  1380021,
+  1380022,
+  1380023,
+  1380024,
+  1380025,
+  1380030,
+  1380040,
+  1380090,
+  1380110,
+  1380140,
+  1380550,
+  1380580,
+  1380590,
+  1380950,
+  1380960,
+  1381140,
+  1381170,
+  1381180,
+  1381220,
+  1381330,
+  1381340,
+  1381410,
+  1381570,
+  1381580,
+  1381620,
+  1381790,
+  1381791,
+  1381800,
+  1381860,
+  1381900,
+  1381910,
+  1381920,
+  1382040,
+  1382050,
+  1382140,
+  1382210,
+  1382220,
+  1382241,
+  1382340,
+  1382400,
+  1382420,
+  1382440,
+  1382550,
+  1382560,
+  1382590,
+  1382591,
+  1382592,
+  1382593,
+  1382600,
+  1382610,
+  1382611,
+  1382612,
+  1382613,
+  1382700,
+  1382740,
+  1382760,
+  1382780,
+  1382820,
+  1382900,
+  1382930,
+  1382960,
+  1383180,
+  1383230,
+  1383240,
+  1383241,
+  1383260,
+  1383420,
+  1383530,
+  1383600,
+  1383610,
+  1383710,
+  1383750,
+  1383790,
+  1383791,
+  1383792,
+  1383800,
+  1383801,
+  1383802,
+  1383803,
+  1383804,
+  1383860,
+  1383870,
+  1383900,
+  1383950,
+  1384020,
+  1384050,
+  1384100,
+  1384140,
+  1384230,
+  1384240,
+  1384340,
+  1384610,
+  1384640,
+  1384690,
+  1384780,
+  1384810,
+  1384860,
+  1385000,
+  1385010,
+  1385020,
+  1385070,
+  1385310,
+  1385400,
+  1385410,
+  1385470,
+  1385490,
+  1385850,
+  1385860,
+  1385870,
+  1385930,
+  1385931,
+  1385932,
+  1385933,
+  1385934,
+  1385935,
+  1385980,
+  1386180,
+  1386270,
+  1386390,
+  1386470,
+  1386540,
+  1386600,
+  1386610,
+  1386611,
+  1386612,
+  1386613,
+  1386614,
+  1386615,
+  1386616,
+  1386740,
+  1386820,
+  1386930,
+  1386931,
+  1386932,
+  1387105,
+  1387310,
+  1387380,
+  1387390,
+  1387540,
+  1387630,
+  1387670,
+  1387680,
+  1387690,
+  1387700,
+  1387710,
+  1387720,
+  1387730,
+  1387740,
+  1387750,
+  1387760,
+  1387850,
+  1387880,
+  1387890,
+  1387920,
+  1387921,
+  1387922,
+  1388000,
+  1388020,
+  1388040,
+  1388060,
+  1388180,
+  1388200,
+  1388380,
+  1388620,
+  1388630,
+  1388680,
+  1388730,
+  1388790,
+  1388850,
+  1389060,
+  1389080,
+  1389220,
+  1389240,
+  1389290,
+  1389340,
+  1389400,
+  1389490,
+  1389491,
+  1389492,
+  1389493,
+  1389770,
+  1389800,
+  1389910,
+  1389911,
+  1389940,
+  1389960,
+  1390100,
+  1390110,
+  1390130,
+  1390131,
+  1390132,
+  1390150,
+  1390160,
+  1390210,
+  1390211,
+  1390212,
+  1390213,
+  1390214,
+  1390430,
+  1390510,
+  1390520,
+  1390590,
+  1390610,
+  1390620,
+  1390660,
+  1390680,
+  1390710,
+  1390770,
+  1390780,
+  1390840,
+  1390930,
+  1390940,
+  1390950,
+  1391080,
+  1391110,
+  1391140,
+  1391230,
+  1391320,
+  1391440,
+  1391480,
+  1391700,
+  1391810,
+  1391820,
+  1391830,
+  1391840,
+  1391850,
+  1391860,
+  1391870,
+  1391880,
+  1391890,
+  1391900,
+  1391910,
+  1391930,
+  1392020,
+  1392090,
+  1392091,
+  1392100,
+  1392110,
+  1392120,
+  1392160,
+  1392210,
+  1392220,
+  1392250,
+  1392270,
+  1392271,
+  1392440,
+  1392500,
+  1392610,
+  1392620,
+  1392710,
+  1392830,
+  1392840,
+  1392850,
+  1392870,
+  1392990,
+  1393000,
+  1393010,
+  1393020,
+  1393040,
+  1393060,
+  1393110,
+  1393111,
+  1393140,
+  1393160,
+  1393180,
+  1393230,
+  1393250,
+  1393470,
+  1393590,
+  1393591,
+  1393600,
+  1393780,
+  1393790,
+  1393900,
+  1394000,
+  1394020,
+  1394230,
+  1394231,
+  1394232,
+  1394310,
+  1394530,
+  1394870,
+  1394890,
+  1394950,
+  1394980,
+  1395050,
+  1395100,
+  1395110,
+  1395130,
+  1395140,
+  1395240,
+  1395300,
+  1395590,
+  1395610,
+  1395720,
+  1395730,
+  1395800,
+  1395801,
+  1395802,
+  1395803,
+  1395804,
+  1395805,
+  1395806,
+  1395807,
+  1395808,
+  1395809,
+  1395950,
+  1396040,
+  1396060,
+  1396070,
+  1396230,
+  1396270,
+  1396360,
+  1396400,
+  1396410,
+  1396420,
+  1396430,
+  1396440,
+  1396460,
+  1396470,
+  1396471,
+  1396472,
+  1396473,
+  1396474,
+  1396510,
+  1396550,
+  1396560,
+  1396570,
+  1396590,
+  1396600,
+  1396670,
+  1396680,
+  1396690,
+  1396700,
+  1396750,
+  1396780,
+  1396800,
+  1396820,
+  1396840,
+  1396860,
+  1396920,
+  1397150,
+  1397250,
+  1397320,
+  1397340,
+  1397370,
+  1397380,
+  1397381,
+  1397480,
+  1397490,
+  1397600,
+  1397990,
+  1398050,
+  1398060,
+  1398580,
+  1398610,
+  1398770,
+  1399010,
+  1399020,
+  1399100,
+  1399110,
+  1399111,
+  1399410,
+  1399411,
+  1399412,
+  1399420,
+  1399450,
+  1399490,
+  1399500,
+  1399510,
+  1399520,
+  1399610,
+  1399680,
+  1399770,
+  1399790,
+  1399791,
+  1399810,
+  1399820,
+  1399830,
+  1399920,
+  1400050,
+  1400051,
+  1400160,
+  1400280,
+  1400300,
+  1400301,
+  1400302,
+  1400303,
+  1400304,
+  1400305,
+  1400306,
+  1400307,
+  1400308,
+  1400309,
+  1400310,
+  1400400,
+  1400430,
+  1400460,
+  1400490,
+  1400530,
+  1400540,
+  1400550,
+  1400551,
+  1400590,
+  1400720,
+  1400770,
+  1400780,
+  1400790,
+  1400800,
+  1400810,
+  1400890,
+  1400900,
+  1400970,
+  1401040,
+  1401180,
+  1401190,
+  1401450,
+  1401451,
+  1401452,
+  1401460,
+  1401461,
+  1401462,
+  1401480,
+  1401490,
+  1401760,
+  1401860,
+  1401861,
+  1401960,
+  1402170,
+  1402330,
+  1402560,
+  1402610,
+  1402620,
+  1402630,
+  1402640,
+  1402690,
+  1402710,
+  1402840,
+  1402910,
+  1402920,
+  1403070,
+  1403090,
+  1403380,
+  1403470,
+  1403510,
+  1403540,
+  1403620,
+  1403630,
+  1403800,
+  1403840,
+  1403860,
+  1403880,
+  1403900,
+  1403920,
+  1403950,
+  1404040,
+  1404041,
+  1404042,
+  1404230,
+  1404231,
+  1404250,
+  1404290,
+  1404370,
+  1404590,
+  1404640,
+  1404641,
+  1404680,
+  1404690,
+  1404900,
+  1404901,
+  1404910,
+  1404950,
+  1405030,
+  1405210,
+  1405211,
+  1405212,
+  1405213,
+  1405214,
+  1405215,
+  1405216,
+  1405217,
+  1405218,
+  1405219,
+  1405240,
+  1405241,
+  1405300,
+  1405400,
+  1405401,
+  1405510,
+  1405520,
+  1405540,
+  1405541,
+  1405542,
+  1405543,
+  1405550,
+  1405551,
+  1405552,
+  1405553,
+  1405554,
+  1405555,
+  1405556,
+  1405557,
+  1405560,
+  1405570,
+  1405580,
+  1405590,
+  1405600,
+  1405610,
+  1405620,
+  1405630,
+  1405640,
+  1405650,
+  1405830,
+  1405840,
+  1405870,
+  1405871,
+  1405872,
+  1405873,
+  1405874,
+  1405875,
+  1405890,
+  1405910,
+  1405940,
+  1405990,
+  1406010,
+  1406060,
+  1406190,
+  1406220,
+  1406230,
+  1406300,
+  1406310,
+  1406320,
+  1406380,
+  1406400,
+  1406420,
+  1406430,
+  1406440,
+  1406450,
+  1406520,
+  1406530,
+  1406550,
+  1406580,
+  1406590,
+  1406600,
+  1406620,
+  1406640,
+  1406650,
+  1406660,
+  1406840,
+  1407020,
+  1407290,
+  1407360,
+  1407570,
+  1407580,
+  1407590,
+  1407600,
+  1407610,
+  1407700,
+  1407701,
+  1407710,
+  1407810,
+  1407900,
+  1408020,
+  1408180,
+  1408181,
+  1408182,
+  1408183,
+  1408184,
+  1408185,
+  1408186,
+  1408187,
+  1408188,
+  1408189,
+  1408290,
+  1408330,
+  1408390,
+  1408510,
+  1408511,
+  1408620,
+  1408640,
+  1408650,
+  1408660,
+  1408690,
+  1408870,
+  1408910,
+  1408950,
+  1408990,
+  1409120,
+  1409140,
+  1409141,
+  1409142,
+  1409143,
+  1409220,
+  1409221,
+  1409222,
+  1409223,
+  1409224,
+  1409225,
+  1409226,
+  1409227,
+  1409228,
+  1409229,
+  1409380,
+  1409580,
+  1409590,
+  1409670,
+  1409690,
+  1409720,
+  1409721,
+  1409800,
+  1409802,
+  1409850,
+  1409870,
+  1409950,
+  1409960,
+  1410010,
+  1410130,
+  1410170,
+  1410220,
+  1410460,
+  1410520,
+  1410590,
+  1410720,
+  1410760,
+  1410820,
+  1410880,
+  1410900,
+  1410910,
+  1410940,
+  1410990,
+  1411060,
+  1411070,
+  1411080,
+  1411100,
+  1411110,
+  1411390,
+  1411430,
+  1411510,
+  1411520,
+  1411530,
+  1411610,
+  1411650,
+  1411680,
+  1411760,
+  1411960,
+  1412060,
+  1412140,
+  1412200,
+  1412210,
+  1412230,
+  1412280,
+  1412281,
+  1412282,
+  1412283,
+  1412300,
+  1412330,
+  1412350,
+  1412450,
+  1412480,
+  1412490,
+  1412520,
+  1412530,
+  1412690,
+  1412710,
+  1412760,
+  1412761,
+  1412790,
+  1412830,
+  1412930,
+  1412940,
+  1413080,
+  1413200,
+  1413230,
+  1413240,
+  1413280,
+  1413380,
+  1413390,
+  1413420,
+  1413450,
+  1413510,
+  1413520,
+  1413530,
+  1413620,
+  1413700,
+  1413750,
+  1413800,
+  1413880,
+  1414050,
+  1414130,
+  1414131,
+  1414170,
+  1414200,
+  1414310,
+  1414330,
+  1414350,
+  1414351,
+  1414352,
+  1414353,
+  1414450,
+  1414540,
+  1414590,
+  1414690,
+  1414750,
+  1415070,
+  1415130,
+  1415310,
+  1415340,
+  1415350,
+  1415390,
+  1415420,
+  1415430,
+  1415440,
+  1415450,
+  1415510,
+  1415530,
+  1415640,
+  1415690,
+  1415691,
+  1415692,
+  1415700,
+  1415900,
+  1415970,
+  1415980,
+  1416090,
+  1416190,
+  1416310,
+  1416390,
+  1416391,
+  1416420,
+  1416470,
+  1416560,
+  1416570,
+  1416590,
+  1416620,
+  1416630,
+  1416640,
+  1416670,
+  1416740,
+  1416830,
+  1416990,
+  1417030,
+  1417031,
+  1417032,
+  1417080,
+  1417100,
+  1417260,
+  1417510,
+  1417560,
+  1417580,
+  1417600,
+  1417630,
+  1417810,
+  1417860,
+  1418070,
+  1418150,
+  1418170,
+  1418230,
+  1418231,
+  1418240,
+  1418260,
+  1418300,
+  1418400,
+  1418480,
+  1418580,
+  1418640,
+  1418660,
+  1418710,
+  1418730,
+  1418790,
+  1418800,
+  1418840,
+  1418841,
+  1418842,
+  1418843,
+  1418844,
+  1418845,
+  1418846,
+  1418847,
+  1418848,
+  1418849,
+  1418860,
+  1418900,
+  1418970,
+  1418980,
+  1419050,
+  1419080,
+  1419120,
+  1419121,
+  1419122,
+  1419420,
+  1419450,
+  1419460,
+  1419470,
+  1419490,
+  1419500,
+  1419520,
+  1419710,
+  1419711,
+  1419712,
+  1419713,
+  1419714,
+  1419715,
+  1419790,
+  1419810,
+  1419820,
+  1419840,
+  1419900,
+  1419940,
+  1419950,
+  1419951,
+  1419952,
+  1419960,
+  1420030,
+  1420070,
+  1420071,
+  1420072,
+  1420073,
+  1420074,
+  1420075,
+  1420076,
+  1420110,
+  1420170,
+  1420220,
+  1420221,
+  1420360,
+  1420390,
+  1420470,
+  1420471,
+  1420500,
+  1420550,
+  1420640,
+  1420670,
+  1420710,
+  1420840,
+  1420870,
+  1420880,
+  1420890,
+  1420930,
+  1421070,
+  1421110,
+  1421370,
+  1421460,
+  1421480,
+  1421500,
+  1421540,
+  1421550,
+  1421551,
+  1421552,
+  1421553,
+  1421580,
+  1421640,
+  1421650,
+  1421651,
+  1421652,
+  1421653,
+  1421780,
+  1421781,
+  1421782,
+  1421783,
+  1421784,
+  1421785,
+  1421786,
+  1421787,
+  1421788,
+  1421800,
+  1421801,
+  1421802,
+  1421803,
+  1421804,
+  1421805,
+  1421806,
+  1421807,
+  1421808,
+  1421809,
+  1421810,
+  1421811,
+  1421812,
+  1421813,
+  1421814,
+  1421830,
+  1421831,
+  1421832,
+  1421833,
+  1421834,
+  1421835,
+  1421836,
+  1421837,
+  1421838,
+  1421839,
+  1421840,
+  1421841,
+  1421842,
+  1421843,
+  1421844,
+  1421845,
+  1421846,
+  1421847,
+  1421848,
+  1421849,
+  1421850,
+  1421851,
+  1421852,
+  1421853,
+  1421854,
+  1421855,
+  1421856,
+  1421857,
+  1421858,
+  1421859,
+  1421860,
+  1421861,
+  1421862,
+  1421863,
+  1421864,
+  1421865,
+  1421866,
+  1421867,
+  1421868,
+  1421870,
+  1421871,
+  1421872,
+  1421873,
+  1421874,
+  1421875,
+  1421876,
+  1421877,
+  1421878,
+  1421880,
+  1421881,
+  1421882,
+  1421883,
+  1421884,
+  1421885,
+  1421886,
+  1421887,
+  1421888,
+  1421890,
+  1421891,
+  1421892,
+  1421893,
+  1421894,
+  1421895,
+  1421896,
+  1421897,
+  1421898,
+  1421910,
+  1421911,
+  1421912,
+  1421913,
+  1421914,
+  1421915,
+  1422010,
+  1422050,
+  1422060,
+  1422070,
+  1422160,
+  1422170,
+  1422250,
+  1422310,
+  1422320,
+  1422350,
+  1422660,
+  1422720,
+  1422830,
+  1422920,
+  1422991,
+  1423070,
+  1423210,
+  1423240,
+  1423241,
+  1423242,
+  1423243,
+  1423244,
+  1423245,
+  1423246,
+  1423247,
+  1423248,
+  1423249,
+  1423250,
+  1423251,
+  1423390,
+  1423440,
+  1423510,
+  1423550,
+  1423560,
+  1423640,
+  1423650,
+  1423760,
+  1423770,
+  1423800,
+  1423840,
+  1423860,
+  1423900,
+  1423920,
+  1423921,
+  1423922,
+  1423950,
+  1423951,
+  1423952,
+  1423953,
+  1424000,
+  1424060,
+  1424100,
+  1424101,
+  1424102,
+  1424110,
+  1424170,
+  1424200,
+  1424201,
+  1424210,
+  1424211,
+  1424212,
+  1424213,
+  1424214,
+  1424215,
+  1424216,
+  1424230,
+  1424240,
+  1424320,
+  1424430,
+  1424440,
+  1424530,
+  1424580,
+  1424830,
+  1424880,
+  1424920,
+  1424940,
+  1424950,
+  1425040,
+  1425150,
+  1425210,
+  1425290,
+  1425430,
+  1425450,
+  1425520,
+  1425570,
+  1425650,
+  1425820,
+  1425860,
+  1425910,
+  1425930,
+  1425931,
+  1425932,
+  1425933,
+  1425950,
+  1426000,
+  1426020,
+  1426250,
+  1426300,
+  1426390,
+  1426510,
+  1426640,
+  1426650,
+  1426660,
+  1426670,
+  1426680,
+  1426690,
+  1426700,
+  1426710,
+  1426750,
+  1426770,
+  1426880,
+  1426910,
+  1426920,
+  1426921,
+  1427000,
+  1427010,
+  1427160,
+  1427170,
+  1427180,
+  1427190,
+  1427220,
+  1427221,
+  1427230,
+  1427310,
+  1427360,
+  1427370,
+  1427380,
+  1427430,
+  1427470,
+  1427490,
+  1427590,
+  1427591,
+  1427592,
+  1427610,
+  1427650,
+  1427670,
+  1427671,
+  1427672,
+  1427673,
+  1427674,
+  1427675,
+  1427676,
+  1427677,
+  1427750,
+  1427850,
+  1428000,
+  1428020,
+  1428021,
+  1428022,
+  1428023,
+  1428024,
+  1428110,
+  1428120,
+  1428121,
+  1428220,
+  1428250,
+  1428330,
+  1428510,
+  1428690,
+  1428720,
+  1428860,
+  1428890,
+  1428930,
+  1428940,
+  1428990,
+  1429010,
+  1429090,
+  1429230,
+  1429240,
+  1429270,
+  1429280,
+  1429290,
+  1429450,
+  1429560,
+  1429750,
+  1429751,
+  1429752,
+  1429753,
+  1429754,
+  1429755,
+  1429756,
+  1429757,
+  1429758,
+  1429759,
+  1429810,
+  1429860,
+  1429910,
+  1429990,
+  1430000,
+  1430110,
+  1430300,
+  1430370,
+  1430390,
+  1430490,
+  1430520,
+  1430560,
+  1430580,
+  1430590,
+  1430610,
+  1430770,
+  1430830,
+  1430840,
+  1430850,
+  1430860,
+  1430880,
+  1430881,
+  1430890,
+  1430891,
+  1430892,
+  1430893,
+  1430894,
+  1430895,
+  1430896,
+  1430897,
+  1430960,
+  1430990,
+  1431010,
+  1431030,
+  1431050,
+  1431060,
+  1431080,
+  1431160,
+  1431260,
+  1431310,
+  1431330,
+  1431390,
+  1431480,
+  1431481,
+  1431482,
+  1431483,
+  1431484,
+  1431485,
+  1431486,
+  1431487,
+  1431488,
+  1431489,
+  1431490,
+  1431491,
+  1431492,
+  1431493,
+  1431494,
+  1431495,
+  1431496,
+  1431497,
+  1431498,
+  1431600,
+  1431670,
+  1431700,
+  1431701,
+  1431702,
+  1431710,
+  1431711,
+  1431712,
+  1431810,
+  1431820,
+  1431870,
+  1432030,
+  1432040,
+  1432120,
+  1432121,
+  1432122,
+  1432123,
+  1432124,
+  1432125,
+  1432126,
+  1432127,
+  1432128,
+  1432129,
+  1432140,
+  1432141,
+  1432142,
+  1432143,
+  1432144,
+  1432145,
+  1432146,
+  1432147,
+  1432148,
+  1432149,
+  1432150,
+  1432151,
+  1432152,
+  1432153,
+  1432154,
+  1432155,
+  1432156,
+  1432157,
+  1432158,
+  1432159,
+  1432160,
+  1432161,
+  1432162,
+  1432163,
+  1432164,
+  1432165,
+  1432166,
+  1432167,
+  1432168,
+  1432169,
+  1432170,
+  1432171,
+  1432172,
+  1432173,
+  1432174,
+  1432175,
+  1432176,
+  1432177,
+  1432178,
+  1432180,
+  1432181,
+  1432182,
+  1432190,
+  1432460,
+  1432470,
+  1432530,
+  1432540,
+  1432640,
+  1432641,
+  1432642,
+  1432643,
+  1432790,
+  1432940,
+  1433080,
+  1433081,
+  1433082,
+  1433180,
+  1433260,
+  1433270,
+  1433510,
+  1433560,
+  1433580,
+  1433581,
+  1433582,
+  1433583,
+  1433600,
+  1433601,
+  1433602,
+  1433603,
+  1433604,
+  1433605,
+  1433606,
+  1433607,
+  1433620,
+  1433630,
+  1433640,
+  1433650,
+  1433660,
+  1433670,
+  1433680,
+  1433690,
+  1433710,
+  1433720,
+  1433730,
+  1433740,
+  1433760,
+  1434020,
+  1434030,
+  1434170,
+  1434180,
+  1434190,
+  1434290,
+  1434450,
+  1434530,
+  1434560,
+  1434570,
+  1434580,
+  1434590,
+  1434600,
+  1434690,
+  1435030,
+  1435050,
+  1435060,
+  1435120,
+  1435130,
+  1435140,
+  1435260,
+  1435290,
+  1435340,
+  1435450,
+  1435451,
+  1435452,
+  1435510,
+  1435530,
+  1435550,
+  1435551,
+  1435552,
+  1435580,
+  1435620,
+  1435650,
+  1435700,
+  1435710,
+  1435730,
+  1435920,
+  1435930,
+  1436020,
+  1436060,
+  1436110,
+  1436120,
+  1436160,
+  1436161,
+  1436162,
+  1436163,
+  1436164,
+  1436165,
+  1436166,
+  1436167,
+  1436168,
+  1436169,
+  1436170,
+  1436171,
+  1436172,
+  1436173,
+  1436174,
+  1436175,
+  1436176,
+  1436180,
+  1436230,
+  1436290,
+  1436300,
+  1436310,
+  1436320,
+  1436360,
+  1436460,
+  1436520,
+  1436660,
+  1436670,
+  1436690,
+  1436710,
+  1436740,
+  1436770,
+  1436771,
+  1436772,
+  1436850,
+  1436890,
+  1436950,
+  1436970,
+  1437000,
+  1437070,
+  1437071,
+  1437072,
+  1437073,
+  1437074,
+  1437075,
+  1437130,
+  1437310,
+  1437330,
+  1437331,
+  1437460,
+  1437610,
+  1437611,
+  1437660,
+  1437780,
+  1437781,
+  1437782,
+  1437783,
+  1437784,
+  1437810,
+  1437960,
+  1438000,
+  1438010,
+  1438020,
+  1438050,
+  1438070,
+  1438150,
+  1438160,
+  1438180,
+  1438210,
+  1438420,
+  1438550,
+  1438630,
+  1438690,
+  1438730,
+  1438770,
+  1438970,
+  1438980,
+  1439000,
+  1439001,
+  1439020,
+  1439050,
+  1439060,
+  1439360,
+  1439430,
+  1439490,
+  1439520,
+  1439530,
+  1439540,
+  1439570,
+  1439620,
+  1439670,
+  1439810,
+  1439880,
+  1440100,
+  1440190,
+  1440191,
+  1440200,
+  1440240,
+  1440250,
+  1440320,
+  1440450,
+  1440480,
+  1440550,
+  1440600,
+  1440610,
+  1440700,
+  1440710,
+  1440760,
+  1440761,
+  1440820,
+  1440830,
+  1440920,
+  1440930,
+  1441030,
+  1441150,
+  1441190,
+  1441191,
+  1441192,
+  1441193,
+  1441450,
+  1441460,
+  1441490,
+  1441510,
+  1441600,
+  1441650,
+  1441660,
+  1441700,
+  1441710,
+  1441711,
+  1441712,
+  1441713,
+  1441714,
+  1441715,
+  1441716,
+  1441717,
+  1441718,
+  1441719,
+  1441720,
+  1441721,
+  1441722,
+  1441723,
+  1441724,
+  1441725,
+  1441726,
+  1441727,
+  1441728,
+  1441729,
+  1441730,
+  1441731,
+  1441820,
+  1441870,
+  1441871,
+  1441872,
+  1441873,
+  1441874,
+  1441875,
+  1441876,
+  1441877,
+  1441878,
+  1441910,
+  1441920,
+  1441930,
+  1441940,
+  1441950,
+  1441970,
+  1441980,
+  1441990,
+  1442000,
+  1442010,
+  1442060,
+  1442100,
+  1442140,
+  1442180,
+  1442210,
+  1442220,
+  1442280,
+  1442281,
+  1442320,
+  1442340,
+  1442370,
+  1442420,
+  1442500,
+  1442510,
+  1442541,
+  1442550,
+  1442600,
+  1442620,
+  1442640,
+  1442700,
+  1442701,
+  1442702,
+  1442703,
+  1442810,
+  1442811,
+  1442900,
+  1442920,
+  1442970,
+  1442980,
+  1442990,
+  1443000,
+  1443010,
+  1443011,
+  1443015,
+  1443016,
+  1443017,
+  1443018,
+  1443019,
+  1443020,
+  1443021,
+  1443022,
+  1443023,
+  1443024,
+  1443025,
+  1443026,
+  1443027,
+  1443028,
+  1443029,
+  1443040,
+  1443041,
+  1443042,
+  1443043,
+  1443044,
+  1443045,
+  1443046,
+  1443047,
+  1443048,
+  1443049,
+  1443050,
+  1443051,
+  1443052,
+  1443053,
+  1443054,
+  1443055,
+  1443056,
+  1443057,
+  1443058,
+  1443059,
+  1443060,
+  1443061,
+  1443062,
+  1443063,
+  1443064,
+  1443065,
+  1443066,
+  1443080,
+  1443081,
+  1443082,
+  1443083,
+  1443084,
+  1443085,
+  1443086,
+  1443087,
+  1443088,
+  1443089,
+  1443090,
+  1443091,
+  1443092,
+  1443093,
+  1443110,
+  1443150,
+  1443220,
+  1443510,
+  1443530,
+  1443531,
+  1443532,
+  1443533,
+  1443660,
+  1443770,
+  1443780,
+  1443790,
+  1443900,
+  1443970,
+  1444040,
+  1444100,
+  1444140,
+  1444200,
+  1444201,
+  1444202,
+  1444203,
+  1444500,
+  1444560,
+  1444590,
+  1444680,
+  1444690,
+  1444790,
+  1444810,
+  1445160,
+  1445170,
+  1445180,
+  1445310,
+  1445350,
+  1445380,
+  1445390,
+  1445450,
+  1445460,
+  1445550,
+  1445560,
+  1445561,
+  1445700,
+  1445760,
+  1445770,
+  1445800,
+  1445900,
+  1445930,
+  1445950,
+  1445990,
+  1446070,
+  1446120,
+  1446170,
+  1446190,
+  1446240,
+  1446290,
+  1446360,
+  1446490,
+  1446570,
+  1446730,
+  1446760,
+  1446770,
+  1446820,
+  1446910,
+  1447040,
+  1447200,
+  1447360,
+  1447370,
+  1447430,
+  1447440,
+  1447460,
+  1447500,
+  1447510,
+  1447520,
+  1447530,
+  1447620,
+  1447680,
+  1447880,
+  1447910,
+  1447930,
+  1448050,
+  1448100,
+  1448101,
+  1448240,
+  1448280,
+  1448420,
+  1448430,
+  1448480,
+  1448510,
+  1448511,
+  1448512,
+  1448580,
+  1448581,
+  1448582,
+  1448680,
+  1448700,
+  1448900,
+  1448920,
+  1448980,
+  1449260,
+  1449310,
+  1449340,
+  1449350,
+  1449390,
+  1449440,
+  1449441,
+  1449442,
+  1449450,
+  1449460,
+  1449610,
+  1449740,
+  1449870,
+  1449880,
+  1449881,
+  1449882,
+  1449883,
+  1449890,
+  1449900,
+  1449930,
+  1450010,
+  1450030,
+  1450040,
+  1450130,
+  1450140,
+  1450220,
+  1450260,
+  1450340,
+  1450350,
+  1450370,
+  1450420,
+  1450430,
+  1450440,
+  1450450,
+  1450460,
+  1450470,
+  1450510,
+  1450540,
+  1450560,
+  1450570,
+  1450571,
+  1450572,
+  1450630,
+  1450690,
+  1450700,
+  1450710,
+  1450740,
+  1450770,
+  1450820,
+  1450840,
+  1450860,
+  1450940,
+  1450950,
+  1450960,
+  1450970,
+  1450980,
+  1450990,
+  1451000,
+  1451020,
+  1451021,
+  1451022,
+  1451023,
+  1451024,
+  1451070,
+  1451130,
+  1451140,
+  1451150,
+  1451170,
+  1451180,
+  1451260,
+  1451330,
+  1451340,
+  1451390,
+  1451400,
+  1451460,
+  1451520,
+  1451521,
+  1451620,
+  1451673,
+  1451678,
+  1451700,
+  1451710,
+  1451790,
+  1451850,
+  1451910,
+  1452050,
+  1452090,
+  1452140,
+  1452150,
+  1452170,
+  1452340,
+  1452390,
+  1452430,
+  1452490,
+  1452520,
+  1452560,
+  1452570,
+  1452580,
+  1452590,
+  1452610,
+  1452620,
+  1452640,
+  1452680,
+  1452740,
+  1452750,
+  1452930,
+  1453060,
+  1453070,
+  1453120,
+  1453180,
+  1453210,
+  1453290,
+  1453360,
+  1453370,
+  1453380,
+  1453410,
+  1453500,
+  1453510,
+  1453580,
+  1453581,
+  1453582,
+  1453583,
+  1453584,
+  1453585,
+  1453590,
+  1453610,
+  1453620,
+  1453630,
+  1453650,
+  1453690,
+  1453720,
+  1453800,
+  1453801,
+  1453802,
+  1453810,
+  1453820,
+  1453830,
+  1453860,
+  1453880,
+  1453890,
+  1453930,
+  1453950,
+  1453970,
+  1453980,
+  1454040,
+  1454070,
+  1454120,
+  1454350,
+  1454440,
+  1454460,
+  1454470,
+  1454500,
+  1454510,
+  1454560,
+  1454610,
+  1454630,
+  1454750,
+  1454770,
+  1454810,
+  1454860,
+  1454870,
+  1454871,
+  1454900,
+  1454910,
+  1454920,
+  1455240,
+  1455310,
+  1455320,
+  1455330,
+  1455340,
+  1455360,
+  1455480,
+  1455550,
+  1455570,
+  1455600,
+  1455640,
+  1455641,
+  1455690,
+  1455700,
+  1455810,
+  1455820,
+  1455850,
+  1455860,
+  1455870,
+  1455940,
+  1455950,
+  1455960,
+  1455981,
+  1455982,
+  1456030,
+  1456160,
+  1456180,
+  1456210,
+  1456310,
+  1456360,
+  1456361,
+  1456362,
+  1456363,
+  1456370,
+  1456371,
+  1456372,
+  1456373,
+  1456450,
+  1456460,
+  1456480,
+  1456510,
+  1456520,
+  1456541,
+  1456550,
+  1456660,
+  1456670,
+  1456790,
+  1456840,
+  1456841,
+  1456842,
+  1456843,
+  1456890,
+  1457010,
+  1457050,
+  1457051,
+  1457052,
+  1457053,
+  1457060,
+  1457240,
+  1457260,
+  1457270,
+  1457290,
+  1457410,
+  1457440,
+  1457450,
+  1457530,
+  1457610,
+  1457670,
+  1457700,
+  1457701,
+  1457750,
+  1457770,
+  1457800,
+  1457830,
+  1457860,
+  1458010,
+  1458030,
+  1458060,
+  1458080,
+  1458081,
+  1458083,
+  1458084,
+  1458085,
+  1458086,
+  1458087,
+  1458088,
+  1458089,
+  1458130,
+  1458131,
+  1458150,
+  1458151,
+  1458152,
+  1458153,
+  1458154,
+  1458155,
+  1458160,
+  1458240,
+  1458410,
+  1458510,
+  1458520,
+  1458630,
+  1458660,
+  1458680,
+  1459110,
+  1459120,
+  1459150,
+  1459180,
+  1459350,
+  1459380,
+  1459420,
+  1459600,
+  1459610,
+  1459680,
+  1459820,
+  1459880,
+  1459970,
+  1460020,
+  1460021,
+  1460060,
+  1460140,
+  1460150,
+  1460180,
+  1460190,
+  1460240,
+  1460270,
+  1460280,
+  1460350,
+  1460360,
+  1460361,
+  1460362,
+  1460363,
+  1460364,
+  1460365,
+  1460366,
+  1460367,
+  1460368,
+  1460369,
+  1460370,
+  1460390,
+  1460460,
+  1460461,
+  1460462,
+  1460463,
+  1460500,
+  1460560,
+  1460620,
+  1460680,
+  1460730,
+  1460880,
+  1460890,
+  1460920,
+  1461050,
+  1461070,
+  1461160,
+  1461170,
+  1461180,
+  1461270,
+  1461290,
+  1461291,
+  1461292,
+  1461293,
+  1461294,
+  1461330,
+  1461380,
+  1461440,
+  1461510,
+  1461670,
+  1461720,
+  1461850,
+  1461851,
+  1461852,
+  1461853,
+  1461854,
+  1461870,
+  1461880,
+  1461940,
+  1461950,
+  1462050,
+  1462090,
+  1462230,
+  1462450,
+  1462451,
+  1462460,
+  1462530,
+  1462660,
+  1462890,
+  1462940,
+  1462980,
+  1463060,
+  1463090,
+  1463160,
+  1463190,
+  1463220,
+  1463230,
+  1463240,
+  1463241,
+  1463250,
+  1463251,
+  1463260,
+  1463261,
+  1463270,
+  1463271,
+  1463340,
+  1463440,
+  1463490,
+  1463491,
+  1463492,
+  1463493,
+  1463494,
+  1463495,
+  1463496,
+  1463497,
+  1463520,
+  1463580,
+  1463581,
+  1463582,
+  1463583,
+  1463590,
+  1463591,
+  1463592,
+  1463593,
+  1463594,
+  1463595,
+  1463596,
+  1463597,
+  1463600,
+  1463610,
+  1463620,
+  1463630,
+  1463640,
+  1463650,
+  1463660,
+  1463670,
+  1463680,
+  1463690,
+  1463740,
+  1463770,
+  1463810,
+  1463990,
+  1464060,
+  1464061,
+  1464062,
+  1464063,
+  1464070,
+  1464140,
+  1464230,
+  1464310,
+  1464311,
+  1464312,
+  1464460,
+  1464470,
+  1464510,
+  1464580,
+  1464640,
+  1464680,
+  1464681,
+  1464710,
+  1464740,
+  1464760,
+  1464880,
+  1464890,
+  1464950,
+  1464980,
+  1465270,
+  1465271,
+  1465272,
+  1465320,
+  1465420,
+  1465430,
+  1465431,
+  1465432,
+  1465650,
+  1465651,
+  1465730,
+  1465731,
+  1465732,
+  1465733,
+  1465734,
+  1465750,
+  1465760,
+  1465840,
+  1465850,
+  1465880,
+  1465960,
+  1466080,
+  1466120,
+  1466160,
+  1466280,
+  1466330,
+  1466340,
+  1466380,
+  1466430,
+  1466460,
+  1466470,
+  1466480,
+  1466670,
+  1466720,
+  1466730,
+  1466760,
+  1466780,
+  1466790,
+  1466820,
+  1466821,
+  1466890,
+  1466980,
+  1466990,
+  1467010,
+  1467050,
+  1467051,
+  1467052,
+  1467100,
+  1467120,
+  1467121,
+  1467150,
+  1467210,
+  1467220,
+  1467290,
+  1467350,
+  1467370,
+  1467440,
+  1467510,
+  1467560,
+  1467710,
+  1467930,
+  1467940,
+  1468080,
+  1468090,
+  1468140,
+  1468150,
+  1468270,
+  1468290,
+  1468310,
+  1468390,
+  1468450,
+  1468480,
+  1468550,
+  1468650,
+  1468660,
+  1468670,
+  1468672,
+  1468673,
+  1468700,
+  1468710,
+  1468850,
+  1468860,
+  1468870,
+  1468880,
+  1468890,
+  1468900,
+  1468910,
+  1468920,
+  1468930,
+  1468940,
+  1469010,
+  1469100,
+  1469210,
+  1469470,
+  1469471,
+  1469670,
+  1469730,
+  1469740,
+  1469770,
+  1469780,
+  1469790,
+  1469810,
+  1469900,
+  1470250,
+  1470260,
+  1470400,
+  1470410,
+  1470500,
+  1470600,
+  1470610,
+  1470630,
+  1470640,
+  1470950,
+  1470990,
+  1471010,
+  1471070,
+  1471071,
+  1471072,
+  1471073,
+  1471074,
+  1471160,
+  1471161,
+  1471260,
+  1471280,
+  1471310,
+  1471340,
+  1471360,
+  1471370,
+  1471390,
+  1471520,
+  1471521,
+  1471590,
+  1471810,
+  1471870,
+  1471920,
+  1471930,
+  1471970,
+  1471980,
+  1472000,
+  1472030,
+  1472190,
+  1472191,
+  1472192,
+  1472200,
+  1472210,
+  1472240,
+  1472300,
+  1472310,
+  1472350,
+  1472400,
+  1472450,
+  1472470,
+  1472480,
+  1472490,
+  1472500,
+  1472510,
+  1472520,
+  1472530,
+  1472670,
+  1472710,
+  1472720,
+  1472780,
+  1472800,
+  1472842,
+  1472843,
+  1472844,
+  1472845,
+  1472846,
+  1472847,
+  1472848,
+  1472849,
+  1472850,
+  1472851,
+  1472852,
+  1472853,
+  1472854,
+  1472855,
+  1472856,
+  1472857,
+  1472858,
+  1472859,
+  1472860,
+  1472861,
+  1472862,
+  1472863,
+  1472864,
+  1472865,
+  1472866,
+  1472867,
+  1472868,
+  1472869,
+  1472870,
+  1472871,
+  1472872,
+  1472873,
+  1472874,
+  1472875,
+  1472876,
+  1472877,
+  1472879,
+  1472890,
+  1472891,
+  1472895,
+  1472896,
+  1473080,
+  1473280,
+  1473310,
+  1473320,
+  1473430,
+  1473431,
+  1473440,
+  1473470,
+  1473520,
+  1473590,
+  1473610,
+  1473680,
+  1473690,
+  1473700,
+  1473710,
+  1473720,
+  1473810,
+  1473860,
+  1474030,
+  1474110,
+  1474140,
+  1474141,
+  1474142,
+  1474240,
+  1474340,
+  1474380,
+  1474470,
+  1474600,
+  1474610,
+  1474620,
+  1474630,
+  1474730,
+  1474820,
+  1474920,
+  1475040,
+  1475060,
+  1475130,
+  1475131,
+  1475230,
+  1475320,
+  1475340,
+  1475490,
+  1475510,
+  1475530,
+  1475540,
+  1475580,
+  1475630,
+  1475640,
+  1475660,
+  1475680,
+  1475790,
+  1475830,
+  1475870,
+  1475880,
+  1475910,
+  1475980,
+  1475990,
+  1476070,
+  1476090,
+  1476120,
+  1476190,
+  1476200,
+  1476300,
+  1476301,
+  1476490,
+  1476670,
+  1476700,
+  1476780,
+  1476810,
+  1476910,
+  1476980,
+  1477111,
+  1477180,
+  1477280,
+  1477340,
+  1477350,
+  1477430,
+  1477431,
+  1477540,
+  1477620,
+  1477670,
+  1477671,
+  1477690,
+  1477720,
+  1477740,
+  1477780,
+  1477800,
+  1477830,
+  1477840,
+  1478000,
+  1478090,
+  1478091,
+  1478092,
+  1478093,
+  1478094,
+  1478095,
+  1478096,
+  1478110,
+  1478120,
+  1478150,
+  1478300,
+  1478460,
+  1478461,
+  1478462,
+  1478463,
+  1478464,
+  1478465,
+  1478466,
+  1478510,
+  1478560,
+  1478720,
+  1478750,
+  1478751,
+  1478760,
+  1478810,
+  1478940,
+  1478950,
+  1478951,
+  1478952,
+  1478953,
+  1479070,
+  1479110,
+  1479250,
+  1479350,
+  1479440,
+  1479451,
+  1479453,
+  1479454,
+  1479510,
+  1479580,
+  1479630,
+  1479670,
+  1479710,
+  1479790,
+  1479791,
+  1479792,
+  1479793,
+  1479794,
+  1479800,
+  1480080,
+  1480100,
+  1480140,
+  1480200,
+  1480230,
+  1480310,
+  1480311,
+  1480312,
+  1480313,
+  1480314,
+  1480315,
+  1480320,
+  1480321,
+  1480360,
+  1480460,
+  1480461,
+  1480462,
+  1480500,
+  1480550,
+  1480580,
+  1480670,
+  1480750,
+  1480751,
+  1480760,
+  1480780,
+  1480880,
+  1481110,
+  1481111,
+  1481112,
+  1481113,
+  1481130,
+  1481190,
+  1481200,
+  1481240,
+  1481250,
+  1481320,
+  1481380,
+  1481390,
+  1481490,
+  1481510,
+  1481570,
+  1481590,
+  1481770,
+  1481800,
+  1481850,
+  1481920,
+  1482080,
+  1482081,
+  1482120,
+  1482140,
+  1482160,
+  1482170,
+  1482220,
+  1482290,
+  1482350,
+  1482390,
+  1482560,
+  1482570,
+  1482630,
+  1482631,
+  1482632,
+  1482900,
+  1482960,
+  1483070,
+  1483120,
+  1483170,
+  1483210,
+  1483230,
+  1483290,
+  1483360,
+  1483460,
+  1483490,
+  1483491,
+  1483500,
+  1483510,
+  1483511,
+  1483520,
+  1483690,
+  1483700,
+  1483710,
+  1483720,
+  1483730,
+  1483740,
+  1484190,
+  1484200,
+  1484220,
+  1484230,
+  1484231,
+  1484260,
+  1484290,
+  1484300,
+  1484310,
+  1484330,
+  1484350,
+  1484360,
+  1484370,
+  1484380,
+  1484390,
+  1484410,
+  1484420,
+  1484430,
+  1484440,
+  1484450,
+  1484460,
+  1484480,
+  1484500,
+  1484540,
+  1484590,
+  1484670,
+  1484820,
+  1484870,
+  1485040,
+  1485060,
+  1485130,
+  1485170,
+  1485180,
+  1485220,
+  1485290,
+  1485291,
+  1485292,
+  1485330,
+  1485390,
+  1485400,
+  1485470,
+  1485570,
+  1485610,
+  1485620,
+  1485720,
+  1485750,
+  1485790,
+  1485930,
+  1485950,
+  1485960,
+  1486020,
+  1486040,
+  1486110,
+  1486150,
+  1486160,
+  1486240,
+  1486241,
+  1486310,
+  1486311,
+  1486312,
+  1486320,
+  1486350,
+  1486360,
+  1486400,
+  1486460,
+  1486470,
+  1486471,
+  1486480,
+  1486490,
+  1486500,
+  1486510,
+  1486560,
+  1486570,
+  1486580,
+  1486590,
+  1486710,
+  1486770,
+  1486780,
+  1486830,
+  1486831,
+  1486832,
+  1486833,
+  1486834,
+  1486835,
+  1486836,
+  1487070,
+  1487080,
+  1487090,
+  1487260,
+  1487310,
+  1487490,
+  1487500,
+  1487510,
+  1487530,
+  1487540,
+  1487610,
+  1487770,
+  1487910,
+  1488260,
+  1488270,
+  1488280,
+  1488300,
+  1488580,
+  1488581,
+  1488600,
+  1488770,
+  1488780,
+  1488870,
+  1489180,
+  1489230,
+  1489231,
+  1489232,
+  1489233,
+  1489240,
+  1489460,
+  1489750,
+  1489790,
+  1489800,
+  1490040,
+  1490070,
+  1490080,
+  1490090,
+  1490100,
+  1490110,
+  1490111,
+  1490112,
+  1490113,
+  1490114,
+  1490115,
+  1490116,
+  1490117,
+  1490170,
+  1490200,
+  1490280,
+  1490300,
+  1490360,
+  1490530,
+  1490540,
+  1490700,
+  1490720,
+  1491100,
+  1491140,
+  1491330,
+  1491420,
+  1491450,
+  1491620,
+  1491860,
+  1491890,
+  1492020,
+  1492030,
+  1492180,
+  1492340,
+  1492410,
+  1492490,
+  1492491,
+  1492560,
+  1492690,
+  1492700,
+  1492701,
+  1492760,
+  1492920,
+  1492960,
+  1492970,
+  1493010,
+  1493011,
+  1493030,
+  1493031,
+  1493032,
+  1493033,
+  1493034,
+  1493035,
+  1493080,
+  1493090,
+  1493100,
+  1493110,
+  1493120,
+  1493130,
+  1493140,
+  1493170,
+  1493190,
+  1493250,
+  1493270,
+  1493330,
+  1493470,
+  1493500,
+  1493510,
+  1493580,
+  1493620,
+  1493710,
+  1493830,
+  1494020,
+  1494120,
+  1494130,
+  1494300,
+  1494330,
+  1494331,
+  1494332,
+  1494333,
+  1494334,
+  1494335,
+  1494336,
+  1494337,
+  1494338,
+  1494339,
+  1494350,
+  1494351,
+  1494352,
+  1494410,
+  1494430,
+  1494460,
+  1494590,
+  1494600,
+  1494601,
+  1494602,
+  1494603,
+  1494604,
+  1494605,
+  1494606,
+  1494607,
+  1494608,
+  1494609,
+  1494610,
+  1494611,
+  1494612,
+  1494620,
+  1494740,
+  1494820,
+  1494850,
+  1495030,
+  1495150,
+  1495160,
+  1495180,
+  1495210,
+  1495310,
+  1495330,
+  1495350,
+  1495520,
+  1495540,
+  1495590,
+  1495680,
+  1495710,
+  1495730,
+  1495740,
+  1495750,
+  1495810,
+  1495870,
+  1495890,
+  1495950,
+  1495980,
+  1496010,
+  1496040,
+  1496041,
+  1496042,
+  1496043,
+  1496050,
+  1496070,
+  1496130,
+  1496140,
+  1496160,
+  1496200,
+  1496280,
+  1496300,
+  1496330,
+  1496331,
+  1496360,
+  1496370,
+  1496400,
+  1496401,
+  1496402,
+  1496403,
+  1496404,
+  1496410,
+  1496420,
+  1496421,
+  1496422,
+  1496423,
+  1496440,
+  1496460,
+  1496480,
+  1496520,
+  1496630,
+  1496660,
+  1496661,
+  1496700,
+  1496701,
+  1496730,
+  1496731,
+  1496830,
+  1496890,
+  1496910,
+  1496911,
+  1496920,
+  1496950,
+  1496960,
+  1496980,
+  1497020,
+  1497030,
+  1497090,
+  1497120,
+  1497160,
+  1497220,
+  1497260,
+  1497320,
+  1497340,
+  1497350,
+  1497480,
+  1497720,
+  1497750,
+  1497840,
+  1497850,
+  1497870,
+  1497920,
+  1497930,
+  1497960,
+  1498030,
+  1498090,
+  1498150,
+  1498210,
+  1498260,
+  1498390,
+  1498480,
+  1498530,
+  1498580,
+  1498610,
+  1498760,
+  1498800,
+  1498801,
+  1498880,
+  1498920,
+  1498950,
+  1498960,
+  1498990,
+  1499040,
+  1499100,
+  1499170,
+  1499270,
+  1499320,
+  1499330,
+  1499340,
+  1499350,
+  1499360,
+  1499370,
+  1499380,
+  1499390,
+  1499440,
+  1499460,
+  1499490,
+  1499510,
+  1499570,
+  1499580,
+  1499590,
+  1499760,
+  1499790,
+  1499910,
+  1500080,
+  1500130,
+  1500190,
+  1500200,
+  1500270,
+  1500420,
+  1500430,
+  1500431,
+  1500440,
+  1500441,
+  1500442,
+  1500560,
+  1500630,
+  1500640,
+  1500670,
+  1500671,
+  1500672,
+  1500673,
+  1500680,
+  1500690,
+  1500700,
+  1500730,
+  1500770,
+  1500840,
+  1500850,
+  1500900,
+  1500950,
+  1501010,
+  1501060,
+  1501070,
+  1501080,
+  1501081,
+  1501082,
+  1501130,
+  1501170,
+  1501220,
+  1501240,
+  1501241,
+  1501242,
+  1501243,
+  1501244,
+  1501245,
+  1501246,
+  1501247,
+  1501248,
+  1501249,
+  1501250,
+  1501251,
+  1501252,
+  1501253,
+  1501254,
+  1501256,
+  1501257,
+  1501258,
+  1501259,
+  1501260,
+  1501261,
+  1501262,
+  1501263,
+  1501264,
+  1501265,
+  1501266,
+  1501267,
+  1501268,
+  1501269,
+  1501270,
+  1501271,
+  1501272,
+  1501273,
+  1501274,
+  1501275,
+  1501276,
+  1501277,
+  1501278,
+  1501279,
+  1501280,
+  1501281,
+  1501282,
+  1501283,
+  1501284,
+  1501290,
+  1501460,
+  1501590,
+  1501630,
+  1501660,
+  1501670,
+  1501680,
+  1501681,
+  1501700,
+  1501710,
+  1501860,
+  1501870,
+  1502000,
+  1502150,
+  1502300,
+  1502320,
+  1502330,
+  1502350,
+  1502390,
+  1502440,
+  1502870,
+  1502940,
+  1503030,
+  1503070,
+  1503100,
+  1503190,
+  1503200,
+  1503230,
+  1503550,
+  1503650,
+  1503660,
+  1503710,
+  1503720,
+  1503730,
+  1503740,
+  1503770,
+  1503771,
+  1503800,
+  1503840,
+  1503870,
+  1503970,
+  1503980,
+  1504040,
+  1504170,
+  1504280,
+  1504300,
+  1504370,
+  1504510,
+  1504511,
+  1504530,
+  1504540,
+  1504590,
+  1504640,
+  1504641,
+  1504680,
+  1504750,
+  1504800,
+  1505290,
+  1505291,
+  1505292,
+  1505293,
+  1505294,
+  1505295,
+  1505296,
+  1505297,
+  1505298,
+  1505299,
+  1505300,
+  1505320,
+  1505580,
+  1505660,
+  1505810,
+  1505820,
+  1505870,
+  1505890,
+  1505930,
+  1505931,
+  1505932,
+  1505950,
+  1506050,
+  1506070,
+  1506120,
+  1506190,
+  1506191,
+  1506192,
+  1506193,
+  1506194,
+  1506195,
+  1506220,
+  1506240,
+  1506270,
+  1506310,
+  1506340,
+  1506350,
+  1506370,
+  1506570,
+  1506650,
+  1506670,
+  1506700,
+  1506780,
+  1506800,
+  1506950,
+  1507070,
+  1507100,
+  1507160,
+  1507300,
+  1507370,
+  1507380,
+  1507450,
+  1507460,
+  1507470,
+  1507540,
+  1507680,
+  1507700,
+  1507810,
+  1507920,
+  1508300,
+  1508480,
+  1508560,
+  1508600,
+  1508610,
+  1508700,
+  1508810,
+  1508910,
+  1509120,
+  1509240,
+  1509410,
+  1509580,
+  1509600,
+  1509610,
+  1509620,
+  1510080,
+  1510120,
+  1510200,
+  1510220,
+  1510260,
+  1510640,
+  1510850,
+  1510940,
+  1510970,
+  1510980,
+  1511030,
+  1511150,
+  1511151,
+  1511170,
+  1511180,
+  1511420,
+  1511430,
+  1511440,
+  1511441,
+  1511442,
+  1511443,
+  1511444,
+  1511445,
+  1511470,
+  1511510,
+  1511770,
+  1512080,
+  1512110,
+  1512140,
+  1512150,
+  1512210,
+  1512220,
+  1512222,
+  1512430,
+  1512670,
+  1512700,
+  1512760,
+  1512840,
+  1513140,
+  1513510,
+  1513850,
+  1513870,
+  1513880,
+  1513890,
+  1513900,
+  1514110,
+  1514320,
+  1514440,
+  1514510,
+  1514520,
+  1514530,
+  1514600,
+  1514630,
+  1514790,
+  1514860,
+  1514870,
+  1515050,
+  1515060,
+  1515061,
+  1515062,
+  1515063,
+  1515064,
+  1515065,
+  1515066,
+  1515067,
+  1515068,
+  1515069,
+  1515110,
+  1515120,
+  1515130,
+  1515250,
+  1515360,
+  1515390,
+  1515440,
+  1515480,
+  1515481,
+  1515482,
+  1515483,
+  1515484,
+  1515510,
+  1515670,
+  1515690,
+  1515910,
+  1515911,
+  1515940,
+  1515960,
+  1516010,
+  1516050,
+  1516140,
+  1516220,
+  1516230,
+  1516260,
+  1516270,
+  1516430,
+  1516480,
+  1516630,
+  1516700,
+  1516770,
+  1516780,
+  1516800,
+  1516830,
+  1516840,
+  1516850,
+  1516930,
+  1517030,
+  1517040,
+  1517080,
+  1517130,
+  1517131,
+  1517200,
+  1517201,
+  1517202,
+  1517203,
+  1517210,
+  1517211,
+  1517212,
+  1517213,
+  1517214,
+  1517215,
+  1517216,
+  1517217,
+  1517260,
+  1517270,
+  1517370,
+  1517420,
+  1517460,
+  1517480,
+  1517481,
+  1517482,
+  1517630,
+  1517631,
+  1517632,
+  1517650,
+  1517660,
+  1517670,
+  1517680,
+  1517690,
+  1517700,
+  1517710,
+  1517720,
+  1517730,
+  1517740,
+  1517750,
+  1517760,
+  1517780,
+  1517790,
+  1517890,
+  1517910,
+  1517950,
+  1517980,
+  1518080,
+  1518150,
+  1518151,
+  1518152,
+  1518153,
+  1518160,
+  1518170,
+  1518230,
+  1518260,
+  1518261,
+  1518262,
+  1518290,
+  1518340,
+  1518450,
+  1518470,
+  1518500,
+  1518520,
+  1518670,
+  1518790,
+  1519170,
+  1519270,
+  1519430,
+  1519500,
+  1519510,
+  1519560,
+  1519700,
+  1519720,
+  1519960,
+  1520100,
+  1520140,
+  1520141,
+  1520400,
+  1520430,
+  1520450,
+  1520480,
+  1520550,
+  1520620,
+  1520630,
+  1520720,
+  1520860,
+  1520930,
+  1520950,
+  1520960,
+  1521000,
+  1521030,
+  1521130,
+  1521240,
+  1521241,
+  1521242,
+  1521243,
+  1521244,
+  1521245,
+  1521246,
+  1521247,
+  1521320,
+  1521321,
+  1521380,
+  1521381,
+  1521382,
+  1521383,
+  1521420,
+  1521440,
+  1521460,
+  1521470,
+  1521480,
+  1521500,
+  1521501,
+  1521502,
+  1521540,
+  1521710,
+  1521740,
+  1521830,
+  1521860,
+  1521940,
+  1521990,
+  1522060,
+  1522090,
+  1522190,
+  1522210,
+  1522211,
+  1522240,
+  1522250,
+  1522290,
+  1522320,
+  1522380,
+  1522390,
+  1522410,
+  1522420,
+  1522430,
+  1522520,
+  1522550,
+  1522600,
+  1522650,
+  1522720,
+  1522780,
+  1522880,
+  1522910,
+  1523000,
+  1523050,
+  1523060,
+  1523070,
+  1523080,
+  1523110,
+  1523120,
+  1523180,
+  1523181,
+  1523190,
+  1523280,
+  1523300,
+  1523310,
+  1523380,
+  1523410,
+  1523430,
+  1523450,
+  1523451,
+  1523470,
+  1523730,
+  1523740,
+  1523810,
+  1523880,
+  1523910,
+  1523950,
+  1523960,
+  1523970,
+  1524200,
+  1524210,
+  1524220,
+  1524260,
+  1524420,
+  1524480,
+  1524500,
+  1524660,
+  1524670,
+  1524671,
+  1524680,
+  1524681,
+  1524682,
+  1524683,
+  1524684,
+  1524685,
+  1524686,
+  1524687,
+  1524740,
+  1524760,
+  1524770,
+  1524780,
+  1524820,
+  1524830,
+  1524860,
+  1524861,
+  1524862,
+  1524870,
+  1524890,
+  1524900,
+  1524960,
+  1524980,
+  1525170,
+  1525240,
+  1525260,
+  1525300,
+  1525630,
+  1525670,
+  1525720,
+  1525820,
+  1525840,
+  1525860,
+  1525880,
+  1526010,
+  1526050,
+  1526051,
+  1526052,
+  1526070,
+  1526071,
+  1526072,
+  1526240,
+  1526250,
+  1526280,
+  1526460,
+  1526620,
+  1526710,
+  1526720,
+  1526830,
+  1527110,
+  1527130,
+  1527140,
+  1527150,
+  1527250,
+  1527340,
+  1527440,
+  1527490,
+  1527530,
+  1527550,
+  1527580,
+  1527590,
+  1527660,
+  1527740,
+  1527760,
+  1527810,
+  1527850,
+  1527860,
+  1528070,
+  1528210,
+  1528250,
+  1528380,
+  1528381,
+  1528382,
+  1528440,
+  1528441,
+  1528442,
+  1528460,
+  1528480,
+  1528490,
+  1528790,
+  1528791,
+  1528990,
+  1529240,
+  1529320,
+  1529380,
+  1529390,
+  1529400,
+  1529450,
+  1529570,
+  1529660,
+  1529820,
+  1529890,
+  1529891,
+  1529920,
+  1529970,
+  1529980,
+  1530010,
+  1530011,
+  1530012,
+  1530080,
+  1530270,
+  1530271,
+  1530272,
+  1530273,
+  1530310,
+  1530320,
+  1530380,
+  1530430,
+  1530500,
+  1530501,
+  1530502,
+  1530503,
+  1530504,
+  1530640,
+  1530730,
+  1530830,
+  1530880,
+  1530881,
+  1530882,
+  1530883,
+  1530940,
+  1531050,
+  1531100,
+  1531280,
+  1531390,
+  1531391,
+  1531392,
+  1531393,
+  1531400,
+  1531440,
+  1531470,
+  1531471,
+  1531472,
+  1531473,
+  1531480,
+  1531600,
+  1531601,
+  1531602,
+  1531603,
+  1531604,
+  1531605,
+  1531606,
+  1531607,
+  1531860,
+  1532190,
+  1532220,
+  1532290,
+  1532330,
+  1532450,
+  1532451,
+  1532470,
+  1532500,
+  1532570,
+  1532580,
+  1532610,
+  1532630,
+  1532670,
+  1532730,
+  1532930,
+  1533000,
+  1533001,
+  1533002,
+  1533003,
+  1533004,
+  1533005,
+  1533006,
+  1533007,
+  1533008,
+  1533009,
+  1533010,
+  1533011,
+  1533030,
+  1533040,
+  1533100,
+  1533170,
+  1533180,
+  1533200,
+  1533210,
+  1533220,
+  1533230,
+  1533240,
+  1533250,
+  1533270,
+  1533290,
+  1533340,
+  1533350,
+  1533360,
+  1533430,
+  1533460,
+  1533930,
+  1534030,
+  1534100,
+  1534110,
+  1534112,
+  1534114,
+  1534115,
+  1534118,
+  1534119,
+  1534120,
+  1534121,
+  1534122,
+  1534123,
+  1534124,
+  1534125,
+  1534126,
+  1534129,
+  1534130,
+  1534133,
+  1534210,
+  1534400,
+  1534440,
+  1534490,
+  1534560,
+  1534670,
+  1534680,
+  1534710,
+  1534750,
+  1534780,
+  1534920,
+  1535180,
+  1535220,
+  1535250,
+  1535251,
+  1535260,
+  1535261,
+  1535262,
+  1535263,
+  1535264,
+  1535265,
+  1535266,
+  1535330,
+  1535331,
+  1535332,
+  1535333,
+  1535380,
+  1535390,
+  1535400,
+  1535410,
+  1535440,
+  1535540,
+  1535570,
+  1535580,
+  1535600,
+  1535650,
+  1535651,
+  1535652,
+  1535730,
+  1535740,
+  1535860,
+  1535930,
+  1535931,
+  1535932,
+  1535933,
+  1535990,
+  1536010,
+  1536030,
+  1536050,
+  1536330,
+  1536370,
+  1536430,
+  1536500,
+  1536510,
+  1536540,
+  1536550,
+  1536560,
+  1536700,
+  1536760,
+  1536761,
+  1536762,
+  1536763,
+  1536764,
+  1536810,
+  1536920,
+  1536950,
+  1536951,
+  1536952,
+  1536953,
+  1536954,
+  1536970,
+  1537260,
+  1537270,
+  1537290,
+  1537360,
+  1537400,
+  1537401,
+  1537550,
+  1537580,
+  1537581,
+  1537582,
+  1537583,
+  1537584,
+  1537585,
+  1537610,
+  1537640,
+  1537650,
+  1537760,
+  1537780,
+  1537790,
+  1537860,
+  1537870,
+  1537990,
+  1537991,
+  1537992,
+  1537993,
+  1538000,
+  1538090,
+  1538200,
+  1538230,
+  1538250,
+  1538530,
+  1538660,
+  1538740,
+  1538741,
+  1538870,
+  1538930,
+  1538940,
+  1538960,
+  1539200,
+  1539260,
+  1539290,
+  1539300,
+  1539310,
+  1539320,
+  1539330,
+  1539340,
+  1539440,
+  1539470,
+  1539480,
+  1539490,
+  1539500,
+  1539520,
+  1539550,
+  1539560,
+  1539561,
+  1539562,
+  1539660,
+  1539690,
+  1539700,
+  1539820,
+  1539821,
+  1539822,
+  1539823,
+  1539830,
+  1539850,
+  1539880,
+  1539900,
+  1540040,
+  1540070,
+  1540280,
+  1540290,
+  1540380,
+  1540620,
+  1540870,
+  1541140,
+  1541180,
+  1541260,
+  1541290,
+  1541930,
+  1541960,
+  1542020,
+  1542030,
+  1542040,
+  1542190,
+  1542200,
+  1542230,
+  1542310,
+  1542360,
+  1542400,
+  1542470,
+  1542500,
+  1542501,
+  1542520,
+  1542560,
+  1542570,
+  1542571,
+  1542600,
+  1542690,
+  1543160,
+  1543161,
+  1543180,
+  1543220,
+  1543230,
+  1543310,
+  1543350,
+  1543420,
+  1543580,
+  1543600,
+  1543640,
+  1543680,
+  1543700,
+  1543950,
+  1544060,
+  1544070,
+  1544130,
+  1544200,
+  1544340,
+  1544400,
+  1544401,
+  1544402,
+  1544403,
+  1544406,
+  1544410,
+  1544590,
+  1544600,
+  1544610,
+  1544620,
+  1544760,
+  1544770,
+  1544950,
+  1545300,
+  1545310,
+  1545400,
+  1545630,
+  1545760,
+  1545770,
+  1545860,
+  1545950,
+  1545960,
+  1545980,
+  1546020,
+  1546040,
+  1546200,
+  1546490,
+  1546510,
+  1546560,
+  1546610,
+  1546670,
+  1546780,
+  1546840,
+  1546850,
+  1546851,
+  1546852,
+  1546853,
+  1546854,
+  1546855,
+  1546980,
+  1546981,
+  1546982,
+  1546983,
+  1547020,
+  1547180,
+  1547510,
+  1547560,
+  1547570,
+  1547600,
+  1547680,
+  1547690,
+  1547700,
+  1547710,
+  1547720,
+  1547800,
+  1547810,
+  1547850,
+  1547920,
+  1547940,
+  1548080,
+  1548100,
+  1548140,
+  1548160,
+  1548170,
+  1548200,
+  1548260,
+  1548380,
+  1548460,
+  1548470,
+  1548710,
+  1548720,
+  1548770,
+  1548970,
+  1548990,
+  1549040,
+  1549100,
+  1549150,
+  1549470,
+  1549490,
+  1549500,
+  1549560,
+  1549660,
+  1549670,
+  1549770,
+  1549790,
+  1549820,
+  1549880,
+  1549890,
+  1549900,
+  1549910,
+  1549920,
+  1550070,
+  1550120,
+  1550140,
+  1550141,
+  1550142,
+  1550160,
+  1550161,
+  1550170,
+  1550290,
+  1550410,
+  1550440,
+  1550500,
+  1550610,
+  1550670,
+  1550910,
+  1550930,
+  1550970,
+  1551130,
+  1551170,
+  1551180,
+  1551320,
+  1551380,
+  1551390,
+  1551391,
+  1551400,
+  1551410,
+  1551430,
+  1551440,
+  1551790,
+  1551950,
+  1552100,
+  1552360,
+  1552420,
+  1552450,
+  1552480,
+  1552560,
+  1552561,
+  1552562,
+  1552563,
+  1552564,
+  1552565,
+  1552566,
+  1552567,
+  1552568,
+  1552569,
+  1552580,
+  1552581,
+  1552582,
+  1552583,
+  1552584,
+  1552585,
+  1552588,
+  1552610,
+  1552670,
+  1552690,
+  1552700,
+  1552701,
+  1552702,
+  1552703,
+  1552704,
+  1552705,
+  1552850,
+  1552900,
+  1552901,
+  1552910,
+  1553020,
+  1553040,
+  1553050,
+  1553060,
+  1553061,
+  1553100,
+  1553101,
+  1553240,
+  1553270,
+  1553290,
+  1553350,
+  1553620,
+  1553700,
+  1553720,
+  1553730,
+  1553760,
+  1553770,
+  1553780,
+  1553790,
+  1553860,
+  1554190,
+  1554200,
+  1554230,
+  1554240,
+  1554250,
+  1554350,
+  1554351,
+  1554360,
+  1554410,
+  1554420,
+  1554430,
+  1554450,
+  1554480,
+  1554490,
+  1554570,
+  1554620,
+  1554690,
+  1554880,
+  1554900,
+  1554910,
+  1554930,
+  1554990,
+  1555000,
+  1555010,
+  1555040,
+  1555050,
+  1555170,
+  1555250,
+  1555251,
+  1555260,
+  1555261,
+  1555263,
+  1555360,
+  1555370,
+  1555440,
+  1555441,
+  1555442,
+  1555550,
+  1555600,
+  1555601,
+  1555602,
+  1555603,
+  1555740,
+  1555741,
+  1555760,
+  1555810,
+  1555850,
+  1555851,
+  1555852,
+  1555853,
+  1556020,
+  1556030,
+  1556061,
+  1556062,
+  1556090,
+  1556110,
+  1556140,
+  1556330,
+  1556390,
+  1556450,
+  1556451,
+  1556510,
+  1556590,
+  1556620,
+  1556630,
+  1556690,
+  1556700,
+  1556701,
+  1556702,
+  1556703,
+  1556704,
+  1556705,
+  1556706,
+  1556707,
+  1556708,
+  1556709,
+  1556710,
+  1556711,
+  1556712,
+  1556713,
+  1556714,
+  1556715,
+  1556716,
+  1556717,
+  1556718,
+  1556719,
+  1556720,
+  1556721,
+  1556722,
+  1556723,
+  1556724,
+  1556725,
+  1556726,
+  1556727,
+  1556728,
+  1556729,
+  1556730,
+  1556810,
+  1556830,
+  1556900,
+  1557110,
+  1557210,
+  1557310,
+  1557320,
+  1557370,
+  1557490,
+  1557570,
+  1557590,
+  1557600,
+  1557620,
+  1557621,
+  1557750,
+  1557850,
+  1557851,
+  1557920,
+  1557960,
+  1557970,
+  1557980,
+  1557981,
+  1558040,
+  1558120,
+  1558220,
+  1558230,
+  1558240,
+  1558250,
+  1558260,
+  1558270,
+  1558280,
+  1558300,
+  1558310,
+  1558340,
+  1558341,
+  1558520,
+  1558540,
+  1558690,
+  1558691,
+  1558810,
+  1558820,
+  1558880,
+  1558881,
+  1558882,
+  1558883,
+  1558884,
+  1558885,
+  1559030,
+  1559200,
+  1559220,
+  1559221,
+  1559222,
+  1559223,
+  1559290,
+  1559320,
+  1559360,
+  1559361,
+  1559440,
+  1559470,
+  1559610,
+  1559640,
+  1559950,
+  1560080,
+  1560190,
+  1560191,
+  1560192,
+  1560193,
+  1560270,
+  1560280,
+  1560290,
+  1560360,
+  1560361,
+  1560370,
+  1560371,
+  1560420,
+  1560440,
+  1560570,
+  1560660,
+  1560670,
+  1560680,
+  1560690,
+  1560700,
+  1560810,
+  1560930,
+  1560931,
+  1560932,
+  1560933,
+  1560934,
+  1560935,
+  1560936,
+  1560937,
+  1560938,
+  1560939,
+  1560980,
+  1560981,
+  1560982,
+  1560983,
+  1560984,
+  1561110,
+  1561360,
+  1561361,
+  1561362,
+  1561363,
+  1561364,
+  1561365,
+  1561410,
+  1561420,
+  1561580,
+  1561690,
+  1561700,
+  1561770,
+  1561790,
+  1561820,
+  1561830,
+  1561840,
+  1561930,
+  1561940,
+  1561950,
+  1562190,
+  1562200,
+  1562280,
+  1562290,
+  1562310,
+  1562350,
+  1562360,
+  1562460,
+  1562530,
+  1562570,
+  1562720,
+  1562770,
+  1562900,
+  1562950,
+  1562960,
+  1563040,
+  1563120,
+  1563200,
+  1563290,
+  1563430,
+  1563620,
+  1563621,
+  1563690,
+  1563810,
+  1563980,
+  1564310,
+  1564320,
+  1564390,
+  1564610,
+  1564750,
+  1564780,
+  1564820,
+  1564910,
+  1564990,
+  1565100,
+  1565160,
+  1565170,
+  1565270,
+  1565300,
+  1565350,
+  1565360,
+  1565370,
+  1565380,
+  1565390,
+  1565400,
+  1565410,
+  1565411,
+  1565412,
+  1565413,
+  1565414,
+  1565415,
+  1565416,
+  1565460,
+  1565520,
+  1565570,
+  1565600,
+  1565601,
+  1565602,
+  1565920,
+  1565921,
+  1565922,
+  1565930,
+  1566000,
+  1566180,
+  1566190,
+  1566260,
+  1566320,
+  1566380,
+  1566470,
+  1566520,
+  1566730,
+  1566750,
+  1566770,
+  1566850,
+  1566851,
+  1566852,
+  1566853,
+  1566854,
+  1566855,
+  1566856,
+  1566970,
+  1566971,
+  1567070,
+  1567071,
+  1567072,
+  1567073,
+  1567090,
+  1567110,
+  1567130,
+  1567150,
+  1567220,
+  1567290,
+  1567291,
+  1567292,
+  1567293,
+  1567294,
+  1567320,
+  1567330,
+  1567340,
+  1567350,
+  1567360,
+  1567390,
+  1567470,
+  1567510,
+  1567610,
+  1567660,
+  1567730,
+  1567750,
+  1567820,
+  1567970,
+  1568050,
+  1568200,
+  1568220,
+  1568221,
+  1568300,
+  1568350,
+  1568390,
+  1568410,
+  1568640,
+  1568680,
+  1568690,
+  1568770,
+  1568780,
+  1568800,
+  1568810,
+  1568830,
+  1568840,
+  1568850,
+  1568860,
+  1568870,
+  1568990,
+  1568991,
+  1568992,
+  1569020,
+  1569030,
+  1569050,
+  1569060,
+  1569190,
+  1569230,
+  1569280,
+  1569281,
+  1569282,
+  1569283,
+  1569284,
+  1569300,
+  1569301,
+  1569304,
+  1569310,
+  1569311,
+  1569312,
+  1569313,
+  1569314,
+  1569320,
+  1569321,
+  1569322,
+  1569323,
+  1569324,
+  1569330,
+  1569331,
+  1569332,
+  1569333,
+  1569334,
+  1569400,
+  1569490,
+  1569600,
+  1569630,
+  1569670,
+  1569770,
+  1569771,
+  1569772,
+  1569773,
+  1569774,
+  1569775,
+  1569776,
+  1569777,
+  1569778,
+  1569779,
+  1569910,
+  1569960,
+  1569980,
+  1570060,
+  1570090,
+  1570130,
+  1570170,
+  1570180,
+  1570230,
+  1570380,
+  1570390,
+  1570530,
+  1570560,
+  1570561,
+  1570580,
+  1570590,
+  1570591,
+  1570592,
+  1570593,
+  1570594,
+  1570640,
+  1570770,
+  1570771,
+  1570772,
+  1571250,
+  1571290,
+  1571390,
+  1571400,
+  1571410,
+  1571510,
+  1571511,
+  1571512,
+  1571513,
+  1571520,
+  1571521,
+  1571530,
+  1571550,
+  1571590,
+  1571630,
+  1571710,
+  1571740,
+  1571850,
+  1571900,
+  1571901,
+  1571902,
+  1571903,
+  1572030,
+  1572160,
+  1572280,
+  1572430,
+  1572431,
+  1572432,
+  1572433,
+  1572490,
+  1572491,
+  1572500,
+  1572820,
+  1572870,
+  1572890,
+  1572891,
+  1572892,
+  1572893,
+  1572894,
+  1573000,
+  1573010,
+  1573030,
+  1573040,
+  1573050,
+  1573140,
+  1573141,
+  1573230,
+  1573260,
+  1573380,
+  1573490,
+  1573600,
+  1573650,
+  1573670,
+  1573680,
+  1573740,
+  1573780,
+  1573781,
+  1573820,
+  1573830,
+  1573840,
+  1573918,
+  1573920,
+  1573930,
+  1573940,
+  1574050,
+  1574120,
+  1574140,
+  1574230,
+  1574280,
+  1574430,
+  1574460,
+  1574630,
+  1574640,
+  1574641,
+  1574650,
+  1574790,
+  1574860,
+  1574960,
+  1574961,
+  1574962,
+  1575020,
+  1575080,
+  1575081,
+  1575250,
+  1575340,
+  1575341,
+  1575363,
+  1575364,
+  1575365,
+  1575366,
+  1575367,
+  1575368,
+  1575369,
+  1575397,
+  1575410,
+  1575411,
+  1575412,
+  1575413,
+  1575414,
+  1575415,
+  1575416,
+  1575490,
+  1575530,
+  1575600,
+  1575610,
+  1575620,
+  1575660,
+  1575760,
+  1575761,
+  1575762,
+  1575763,
+  1575764,
+  1575800,
+  1575820,
+  1575850,
+  1575881,
+  1575882,
+  1575883,
+  1575884,
+  1575885,
+  1575887,
+  1575888,
+  1575930,
+  1575970,
+  1576100,
+  1576180,
+  1576200,
+  1576260,
+  1576310,
+  1576311,
+  1576312,
+  1576330,
+  1576340,
+  1576390,
+  1576410,
+  1576430,
+  1576450,
+  1576460,
+  1576520,
+  1576800,
+  1577000,
+  1577090,
+  1577100,
+  1577220,
+  1577330,
+  1577430,
+  1577431,
+  1577432,
+  1577433,
+  1577540,
+  1577670,
+  1577781,
+  1577783,
+  1577784,
+  1577785,
+  1577786,
+  1578030,
+  1578120,
+  1578121,
+  1578122,
+  1578123,
+  1578124,
+  1578125,
+  1578126,
+  1578127,
+  1578128,
+  1578129,
+  1578140,
+  1578190,
+  1578355,
+  1578356,
+  1578357,
+  1578358,
+  1578530,
+  1578531,
+  1578560,
+  1578580,
+  1578600,
+  1578610,
+  1578620,
+  1578630,
+  1578670,
+  1578680,
+  1578690,
+  1578770,
+  1579040,
+  1579041,
+  1579042,
+  1579043,
+  1579080,
+  1579090,
+  1579150,
+  1579220,
+  1579410,
+  1579520,
+  1579750,
+  1579760,
+  1579770,
+  1579810,
+  1579820,
+  1579830,
+  1579960,
+  1579980,
+  1579991,
+  1579992,
+  1580050,
+  1580070,
+  1580080,
+  1580110,
+  1580130,
+  1580220,
+  1580350,
+  1580360,
+  1580540,
+  1580541,
+  1580580,
+  1580581,
+  1580582,
+  1580583,
+  1580584,
+  1580585,
+  1580586,
+  1580587,
+  1580588,
+  1580589,
+  1580590,
+  1580591,
+  1580592,
+  1580593,
+  1580594,
+  1580595,
+  1580596,
+  1580630,
+  1580730,
+  1580731,
+  1580760,
+  1580880,
+  1580920,
+  1580930,
+  1581130,
+  1581230,
+  1581450,
+  1581451,
+  1581510,
+  1581511,
+  1581512,
+  1581513,
+  1581514,
+  1581515,
+  1581516,
+  1581517,
+  1581518,
+  1581519,
+  1581520,
+  1581521,
+  1581522,
+  1581540,
+  1581570,
+  1581630,
+  1581690,
+  1581691,
+  1581692,
+  1581710,
+  1581780,
+  1581901,
+  1581931,
+  1581932,
+  1581933,
+  1581934,
+  1581935,
+  1581936,
+  1581937,
+  1581938,
+  1581939,
+  1582050,
+  1582220,
+  1582240,
+  1582400,
+  1582422,
+  1582490,
+  1582590,
+  1582690,
+  1582820,
+  1582821,
+  1582830,
+  1582880,
+  1582920,
+  1583050,
+  1583100,
+  1583110,
+  1583120,
+  1583250,
+  1583310,
+  1583340,
+  1583430,
+  1583680,
+  1583790,
+  1583800,
+  1583810,
+  1583860,
+  1583920,
+  1583940,
+  1583970,
+  1583971,
+  1584010,
+  1584011,
+  1584012,
+  1584013,
+  1584110,
+  1584250,
+  1584260,
+  1584380,
+  1584400,
+  1584490,
+  1584620,
+  1584650,
+  1584700,
+  1584710,
+  1584790,
+  1584870,
+  1584880,
+  1584890,
+  1585000,
+  1585010,
+  1585110,
+  1585150,
+  1585190,
+  1585380,
+  1585381,
+  1585382,
+  1585510,
+  1585550,
+  1585600,
+  1585610,
+  1585620,
+  1585670,
+  1585770,
+  1585790,
+  1585810,
+  1585811,
+  1585812,
+  1585813,
+  1585816,
+  1585820,
+  1585870,
+  1585871,
+  1585900,
+  1586060,
+  1586080,
+  1586100,
+  1586140,
+  1586170,
+  1586180,
+  1586200,
+  1586250,
+  1586440,
+  1586580,
+  1586600,
+  1586630,
+  1586690,
+  1586691,
+  1586770,
+  1586780,
+  1586790,
+  1587140,
+  1587150,
+  1587310,
+  1587400,
+  1587450,
+  1587590,
+  1587591,
+  1587592,
+  1587593,
+  1587594,
+  1587595,
+  1587596,
+  1587597,
+  1587598,
+  1587599,
+  1587620,
+  1587621,
+  1587622,
+  1587623,
+  1587640,
+  1587730,
+  1587980,
+  1588030,
+  1588320,
+  1588350,
+  1588360,
+  1588370,
+  1588390,
+  1588430,
+  1588640,
+  1588720,
+  1588810,
+  1588820,
+  1588821,
+  1588830,
+  1588930,
+  1588960,
+  1588961,
+  1588962,
+  1588963,
+  1588970,
+  1588980,
+  1589030,
+  1589310,
+  1589620,
+  1589850,
+  1589851,
+  1589852,
+  1589853,
+  1590110,
+  1590170,
+  1590171,
+  1590200,
+  1590210,
+  1590280,
+  1590300,
+  1590400,
+  1590510,
+  1590520,
+  1590530,
+  1590551,
+  1590560,
+  1590561,
+  1590562,
+  1590563,
+  1590564,
+  1590565,
+  1590580,
+  1590590,
+  1590610,
+  1590710,
+  1590711,
+  1590712,
+  1590713,
+  1590830,
+  1590860,
+  1590930,
+  1590960,
+  1591070,
+  1591080,
+  1591390,
+  1591460,
+  1591510,
+  1591620,
+  1591780,
+  1591810,
+  1591880,
+  1591881,
+  1591920,
+  1591930,
+  1592010,
+  1592030,
+  1592040,
+  1592041,
+  1592070,
+  1592090,
+  1592250,
+  1592350,
+  1592500,
+  1592510,
+  1592511,
+  1592512,
+  1592560,
+  1592570,
+  1592630,
+  1592730,
+  1592770,
+  1592800,
+  1592910,
+  1592960,
+  1593000,
+  1593020,
+  1593122,
+  1593123,
+  1593124,
+  1593130,
+  1593150,
+  1593240,
+  1593330,
+  1593360,
+  1593450,
+  1593470,
+  1593540,
+  1593580,
+  1593720,
+  1593721,
+  1593722,
+  1593790,
+  1593830,
+  1593840,
+  1593850,
+  1593910,
+  1594030,
+  1594050,
+  1594070,
+  1594140,
+  1594240,
+  1594250,
+  1594260,
+  1594350,
+  1594550,
+  1594580,
+  1594581,
+  1594582,
+  1594583,
+  1594630,
+  1594631,
+  1594640,
+  1594770,
+  1594820,
+  1594930,
+  1595080,
+  1595240,
+  1595430,
+  1595530,
+  1595550,
+  1595551,
+  1595560,
+  1595570,
+  1595580,
+  1595650,
+  1595700,
+  1595840,
+  1595980,
+  1596210,
+  1596280,
+  1596630,
+  1596631,
+  1596632,
+  1596650,
+  1596651,
+  1596652,
+  1596653,
+  1596654,
+  1596655,
+  1596660,
+  1596661,
+  1596662,
+  1596663,
+  1596664,
+  1596665,
+  1596666,
+  1596667,
+  1596670,
+  1596710,
+  1596711,
+  1596830,
+  1596860,
+  1596870,
+  1596880,
+  1596900,
+  1596910,
+  1597100,
+  1597190,
+  1597360,
+  1597370,
+  1597410,
+  1597540,
+  1597860,
+  1597890,
+  1597920,
+  1598000,
+  1598110,
+  1598240,
+  1598241,
+  1598242,
+  1598243,
+  1598244,
+  1598245,
+  1598246,
+  1598247,
+  1598330,
+  1598340,
+  1598380,
+  1598440,
+  1598441,
+  1598442,
+  1598480,
+  1598481,
+  1598482,
+  1598500,
+  1598510,
+  1598520,
+  1598530,
+  1598850,
+  1598980,
+  1598990,
+  1599010,
+  1599030,
+  1599040,
+  1599050,
+  1599100,
+  1599180,
+  1599190,
+  1599191,
+  1599192,
+  1599193,
+  1599194,
+  1599260,
+  1599290,
+  1599300,
+  1599310,
+  1599350,
+  1599480,
+  1599481,
+  1599482,
+  1599483,
+  1599484,
+  1599485,
+  1599486,
+  1599500,
+  1599750,
+  1599770,
+  1599790,
+  1599800,
+  1599840,
+  1600000,
+  1600010,
+  1600150,
+  1600220,
+  1600410,
+  1600510,
+  1600511,
+  1600512,
+  1600540,
+  1600541,
+  1600590,
+  1600710,
+  1600740,
+  1600770,
+  1600800,
+  1600850,
+  1600860,
+  1600920,
+  1600940,
+  1601290,
+  1601350,
+  1601550,
+  1601560,
+  1601710,
+  1601720,
+  1601810,
+  1602070,
+  1602230,
+  1602270,
+  1602400,
+  1602410,
+  1602470,
+  1602640,
+  1602641,
+  1602642,
+  1602643,
+  1602644,
+  1602660,
+  1602680,
+  1602720,
+  1603010,
+  1603120,
+  1603121,
+  1603250,
+  1603320,
+  1603330,
+  1603340,
+  1603560,
+  1604170,
+  1604190,
+  1604220,
+  1604330,
+  1604850,
+  1604860,
+  1604940,
+  1604970,
+  1604971,
+  1604990,
+  1605060,
+  1605090,
+  1605170,
+  1605730,
+  1605750,
+  1605790,
+  1605800,
+  1605810,
+  1605820,
+  1605840,
+  1605870,
+  1605871,
+  1605872,
+  1605873,
+  1605970,
+  1605971,
+  1605972,
+  1605980,
+  1605990,
+  1606090,
+  1606100,
+  1606160,
+  1606161,
+  1606162,
+  1606163,
+  1606170,
+  1606200,
+  1606220,
+  1606252,
+  1606253,
+  1606254,
+  1606255,
+  1606256,
+  1606320,
+  1606490,
+  1606650,
+  1606810,
+  1606840,
+  1606930,
+  1606960,
+  1607050,
+  1607060,
+  1607061,
+  1607062,
+  1607063,
+  1607064,
+  1607120,
+  1607210,
+  1607211,
+  1607230,
+  1607320,
+  1607321,
+  1607340,
+  1607380,
+  1607540,
+  1607690,
+  1607830,
+  1607890,
+  1608020,
+  1608150,
+  1608190,
+  1608240,
+  1608280,
+  1608300,
+  1608380,
+  1608390,
+  1608440,
+  1608480,
+  1608510,
+  1608540,
+  1608610,
+  1608790,
+  1609140,
+  1609150,
+  1609210,
+  1609240,
+  1609260,
+  1609280,
+  1609610,
+  1609620,
+  1609920,
+  1609960,
+  1609970,
+  1609980,
+  1610010,
+  1610030,
+  1610050,
+  1610080,
+  1610090,
+  1610091,
+  1610100,
+  1610300,
+  1610400,
+  1610510,
+  1610540,
+  1610550,
+  1610580,
+  1610600,
+  1610800,
+  1610801,
+  1610880,
+  1610881,
+  1610882,
+  1610970,
+  1611010,
+  1611050,
+  1611080,
+  1611170,
+  1611180,
+  1611190,
+  1611200,
+  1611210,
+  1611220,
+  1611230,
+  1611240,
+  1611250,
+  1611260,
+  1611310,
+  1611330,
+  1611360,
+  1611450,
+  1611470,
+  1611500,
+  1611520,
+  1611610,
+  1611620,
+  1611630,
+  1611670,
+  1611730,
+  1611940,
+  1612050,
+  1612070,
+  1612210,
+  1612260,
+  1612320,
+  1612340,
+  1612410,
+  1612490,
+  1612600,
+  1612670,
+  1612680,
+  1612700,
+  1612710,
+  1612720,
+  1612740,
+  1612760,
+  1612940,
+  1612970,
+  1613040,
+  1613060,
+  1613110,
+  1613111,
+  1613200,
+  1613280,
+  1613281,
+  1613282,
+  1613283,
+  1613284,
+  1613285,
+  1613450,
+  1613460,
+  1614140,
+  1614170,
+  1614171,
+  1614172,
+  1614173,
+  1614470,
+  1614630,
+  1614700,
+  1614760,
+  1614800,
+  1615010,
+  1615011,
+  1615012,
+  1615200,
+  1615260,
+  1615270,
+  1615280,
+  1615500,
+  1615501,
+  1615680,
+  1615690,
+  1615730,
+  1615780,
+  1615790,
+  1616010,
+  1616080,
+  1616120,
+  1616150,
+  1616180,
+  1616530,
+  1616620,
+  1617260,
+  1617300,
+  1617301,
+  1617303,
+  1617350,
+  1617380,
+  1617470,
+  1617500,
+  1617501,
+  1617502,
+  1617503,
+  1617520,
+  1617530,
+  1617540,
+  1617550,
+  1617690,
+  1617720,
+  1617730,
+  1617770,
+  1617850,
+  1617851,
+  1617852,
+  1617853,
+  1617854,
+  1617855,
+  1617856,
+  1617857,
+  1617858,
+  1617859,
+  1617860,
+  1617861,
+  1617862,
+  1617863,
+  1617864,
+  1617870,
+  1617940,
+  1617941,
+  1617942,
+  1617943,
+  1617944,
+  1617945,
+  1617946,
+  1617947,
+  1617948,
+  1617949,
+  1618040,
+  1618060,
+  1618100,
+  1618110,
+  1618120,
+  1618370,
+  1618400,
+  1618410,
+  1618600,
+  1618620,
+  1618640,
+  1618660,
+  1618680,
+  1618700,
+  1618840,
+  1618950,
+  1618990,
+  1619010,
+  1619070,
+  1619090,
+  1619140,
+  1619170,
+  1619190,
+  1619191,
+  1619300,
+  1619320,
+  1619650,
+  1619710,
+  1619730,
+  1619740,
+  1619800,
+  1619850,
+  1619851,
+  1619852,
+  1619853,
+  1619854,
+  1619880,
+  1619950,
+  1619951,
+  1619980,
+  1620250,
+  1620380,
+  1620400,
+  1620450,
+  1620550,
+  1620551,
+  1620552,
+  1620630,
+  1620760,
+  1620761,
+  1620762,
+  1620780,
+  1620950,
+  1620951,
+  1621040,
+  1621110,
+  1621150,
+  1621151,
+  1621300,
+  1621330,
+  1621340,
+  1621470,
+  1621471,
+  1621473,
+  1621474,
+  1621510,
+  1621630,
+  1621631,
+  1621650,
+  1621651,
+  1621660,
+  1621661,
+  1621670,
+  1621700,
+  1621730,
+  1621740,
+  1621860,
+  1622020,
+  1622021,
+  1622100,
+  1622150,
+  1622220,
+  1622240,
+  1622290,
+  1622460,
+  1622650,
+  1622670,
+  1622730,
+  1622750,
+  1622790,
+  1622870,
+  1622930,
+  1622940,
+  1622941,
+  1623030,
+  1623031,
+  1623050,
+  1623051,
+  1623150,
+  1623250,
+  1623270,
+  1623280,
+  1623360,
+  1623540,
+  1623570,
+  1623571,
+  1623600,
+  1623740,
+  1623780,
+  1623781,
+  1623782,
+  1623783,
+  1623810,
+  1623980,
+  1624070,
+  1624110,
+  1624120,
+  1624260,
+  1624261,
+  1624262,
+  1624290,
+  1624340,
+  1624400,
+  1624410,
+  1624520,
+  1624810,
+  1625320,
+  1625390,
+  1625400,
+  1625560,
+  1625590,
+  1625660,
+  1625770,
+  1626000,
+  1626001,
+  1626002,
+  1626003,
+  1626250,
+  1626310,
+  1626320,
+  1626390,
+  1626540,
+  1626550,
+  1626660,
+  1626670,
+  1626960,
+  1626970,
+  1626971,
+  1626972,
+  1626973,
+  1627020,
+  1627300,
+  1627500,
+  1627580,
+  1627581,
+  1627582,
+  1627583,
+  1627584,
+  1627585,
+  1627586,
+  1627650,
+  1627780,
+  1627790,
+  1627800,
+  1627810,
+  1627830,
+  1627910,
+  1628050,
+  1628070,
+  1628080,
+  1628220,
+  1628250,
+  1628251,
+  1628252,
+  1628253,
+  1628254,
+  1628255,
+  1628280,
+  1628281,
+  1628290,
+  1628350,
+  1628380,
+  1628460,
+  1628660,
+  1628661,
+  1628662,
+  1628663,
+  1628870,
+  1628880,
+  1628970,
+  1629000,
+  1629010,
+  1629020,
+  1629090,
+  1629120,
+  1629240,
+  1629260,
+  1629270,
+  1629280,
+  1629360,
+  1629410,
+  1629580,
+  1629640,
+  1629750,
+  1629760,
+  1629800,
+  1629840,
+  1629841,
+  1629842,
+  1629843,
+  1630040,
+  1630050,
+  1630090,
+  1630150,
+  1630170,
+  1630220,
+  1630230,
+  1630240,
+  1630250,
+  1630260,
+  1630390,
+  1630410,
+  1630480,
+  1630580,
+  1630600,
+  1630601,
+  1630602,
+  1630610,
+  1630620,
+  1630722,
+  1630726,
+  1630727,
+  1630728,
+  1630729,
+  1630732,
+  1630734,
+  1630735,
+  1630736,
+  1630790,
+  1630870,
+  1631280,
+  1631300,
+  1631370,
+  1631380,
+  1631480,
+  1631520,
+  1631620,
+  1631810,
+  1631840,
+  1631890,
+  1632200,
+  1632320,
+  1632350,
+  1632380,
+  1632460,
+  1632520,
+  1632540,
+  1632541,
+  1632550,
+  1632560,
+  1632570,
+  1632700,
+  1632720,
+  1632740,
+  1632800,
+  1632840,
+  1632890,
+  1632910,
+  1633190,
+  1633240,
+  1633250,
+  1633251,
+  1633480,
+  1633481,
+  1633482,
+  1633483,
+  1633484,
+  1633485,
+  1633486,
+  1633540,
+  1633570,
+  1633610,
+  1633650,
+  1633651,
+  1633670,
+  1633680,
+  1633700,
+  1633710,
+  1633720,
+  1633730,
+  1633870,
+  1633910,
+  1633940,
+  1633960,
+  1634000,
+  1634010,
+  1634040,
+  1634140,
+  1634160,
+  1634180,
+  1634200,
+  1634201,
+  1634202,
+  1634400,
+  1634440,
+  1634460,
+  1634510,
+  1634570,
+  1634580,
+  1634610,
+  1634680,
+  1634690,
+  1634691,
+  1634692,
+  1634693,
+  1634694,
+  1634695,
+  1634696,
+  1634697,
+  1634698,
+  1634699,
+  1634700,
+  1634701,
+  1634702,
+  1634703,
+  1634704,
+  1634705,
+  1634706,
+  1634707,
+  1634708,
+  1634709,
+  1634710,
+  1634711,
+  1634712,
+  1634713,
+  1634760,
+  1634870,
+  1634910,
+  1634930,
+  1635070,
+  1635170,
+  1635171,
+  1635360,
+  1635390,
+  1635470,
+  1635540,
+  1635690,
+  1635730,
+  1635820,
+  1635821,
+  1635822,
+  1635823,
+  1635852,
+  1635853,
+  1635860,
+  1635910,
+  1635960,
+  1635970,
+  1636180,
+  1636290,
+  1636291,
+  1636292,
+  1636293,
+  1636294,
+  1636330,
+  1636340,
+  1636341,
+  1636342,
+  1636343,
+  1636344,
+  1636345,
+  1636346,
+  1636670,
+  1636780,
+  1636790,
+  1636800,
+  1636840,
+  1636870,
+  1636871,
+  1636872,
+  1636873,
+  1636880,
+  1637170,
+  1637171,
+  1637250,
+  1637251,
+  1637252,
+  1637253,
+  1637254,
+  1637255,
+  1637256,
+  1637257,
+  1637258,
+  1637259,
+  1637310,
+  1637330,
+  1637350,
+  1637470,
+  1637471,
+  1637472,
+  1637530,
+  1637531,
+  1637590,
+  1637860,
+  1637960,
+  1637980,
+  1638180,
+  1638240,
+  1638250,
+  1638280,
+  1638310,
+  1638311,
+  1638320,
+  1638370,
+  1638380,
+  1638400,
+  1638420,
+  1638530,
+  1638580,
+  1638581,
+  1638582,
+  1638620,
+  1638640,
+  1638750,
+  1638751,
+  1638752,
+  1638753,
+  1638754,
+  1638790,
+  1638800,
+  1638810,
+  1638811,
+  1638820,
+  1638830,
+  1638840,
+  1638900,
+  1639240,
+  1639270,
+  1639280,
+  1639460,
+  1639540,
+  1639550,
+  1639800,
+  1639810,
+  1639820,
+  1639840,
+  1639841,
+  1639960,
+  1639970,
+  1639980,
+  1640010,
+  1640200,
+  1640240,
+  1640280,
+  1640310,
+  1640330,
+  1640381,
+  1640382,
+  1640383,
+  1640390,
+  1640420,
+  1640440,
+  1640500,
+  1640530,
+  1640620,
+  1640650,
+  1640680,
+  1640740,
+  1640750,
+  1640850,
+  1640870,
+  1641110,
+  1641140,
+  1641150,
+  1641160,
+  1641161,
+  1641200,
+  1641201,
+  1641202,
+  1641203,
+  1641204,
+  1641205,
+  1641310,
+  1641360,
+  1641490,
+  1641610,
+  1641640,
+  1641740,
+  1641940,
+  1641950,
+  1642020,
+  1642080,
+  1642120,
+  1642180,
+  1642200,
+  1642320,
+  1642380,
+  1642710,
+  1642740,
+  1642760,
+  1642770,
+  1642810,
+  1642850,
+  1642900,
+  1642910,
+  1642950,
+  1643020,
+  1643080,
+  1643090,
+  1643091,
+  1643140,
+  1643210,
+  1643230,
+  1643231,
+  1643250,
+  1643260,
+  1643290,
+  1643350,
+  1643351,
+  1643355,
+  1643360,
+  1643380,
+  1643390,
+  1643410,
+  1643420,
+  1643480,
+  1643620,
+  1643630,
+  1643750,
+  1643780,
+  1643790,
+  1643810,
+  1643830,
+  1643860,
+  1643861,
+  1643862,
+  1643863,
+  1643864,
+  1643865,
+  1643866,
+  1643867,
+  1643868,
+  1643869,
+  1643870,
+  1643871,
+  1643872,
+  1643873,
+  1643874,
+  1643875,
+  1643876,
+  1643877,
+  1643878,
+  1643879,
+  1643880,
+  1643881,
+  1643882,
+  1643883,
+  1643884,
+  1643885,
+  1643886,
+  1643887,
+  1643888,
+  1643889,
+  1643890,
+  1643891,
+  1643892,
+  1643893,
+  1643894,
+  1643895,
+  1643896,
+  1643897,
+  1643898,
+  1643899,
+  1643900,
+  1643901,
+  1643902,
+  1643903,
+  1643904,
+  1643905,
+  1643906,
+  1643907,
+  1643908,
+  1643909,
+  1643910,
+  1643911,
+  1643912,
+  1643913,
+  1643914,
+  1643915,
+  1643916,
+  1643917,
+  1643918,
+  1643919,
+  1643921,
+  1643922,
+  1643923,
+  1643924,
+  1643925,
+  1643926,
+  1643927,
+  1643928,
+  1643930,
+  1643940,
+  1643941,
+  1643942,
+  1643943,
+  1643944,
+  1643945,
+  1643946,
+  1643947,
+  1643948,
+  1643949,
+  1643950,
+  1643951,
+  1643952,
+  1643953,
+  1643954,
+  1643955,
+  1643956,
+  1643957,
+  1643958,
+  1643959,
+  1643980,
+  1643981,
+  1643982,
+  1643983,
+  1643984,
+  1643985,
+  1643986,
+  1643987,
+  1643988,
+  1643989,
+  1643990,
+  1644210,
+  1644410,
+  1644420,
+  1644480,
+  1644520,
+  1644530,
+  1644550,
+  1644610,
+  1644611,
+  1644612,
+  1644613,
+  1644614,
+  1644615,
+  1644730,
+  1644760,
+  1644860,
+  1644870,
+  1644880,
+  1644881,
+  1644890,
+  1644900,
+  1645080,
+  1645310,
+  1645360,
+  1645370,
+  1645380,
+  1645390,
+  1645400,
+  1645410,
+  1645420,
+  1645430,
+  1645440,
+  1645450,
+  1645452,
+  1645460,
+  1645470,
+  1645480,
+  1645490,
+  1645500,
+  1645510,
+  1645520,
+  1645530,
+  1645540,
+  1645550,
+  1645850,
+  1646320,
+  1646370,
+  1646550,
+  1646690,
+  1646700,
+  1646720,
+  1646940,
+  1646950,
+  1647130,
+  1647180,
+  1647320,
+  1647450,
+  1647470,
+  1647510,
+  1647520,
+  1647530,
+  1647540,
+  1647620,
+  1647790,
+  1647880,
+  1647900,
+  1647930,
+  1647950,
+  1647960,
+  1647961,
+  1647962,
+  1647963,
+  1647964,
+  1647965,
+  1647966,
+  1647967,
+  1647968,
+  1647970,
+  1648020,
+  1648060,
+  1648061,
+  1648062,
+  1648063,
+  1648110,
+  1648120,
+  1648220,
+  1648330,
+  1648400,
+  1648401,
+  1648402,
+  1648403,
+  1648410,
+  1648411,
+  1648412,
+  1648413,
+  1648510,
+  1648511,
+  1648520,
+  1648521,
+  1648640,
+  1648641,
+  1648680,
+  1648681,
+  1648682,
+  1648770,
+  1648780,
+  1648850,
+  1648880,
+  1648950,
+  1649050,
+  1649100,
+  1649150,
+  1649160,
+  1649220,
+  1649230,
+  1649580,
+  1649590,
+  1649600,
+  1649710,
+  1649711,
+  1649810,
+  1649840,
+  1649880,
+  1649930,
+  1649990,
+  1650000,
+  1650030,
+  1650050,
+  1650090,
+  1650100,
+  1650120,
+  1650160,
+  1650170,
+  1650171,
+  1650172,
+  1650173,
+  1650174,
+  1650175,
+  1650176,
+  1650177,
+  1650178,
+  1650179,
+  1650230,
+  1650231,
+  1650232,
+  1650233,
+  1650240,
+  1650241,
+  1650260,
+  1650420,
+  1650510,
+  1650630,
+  1650640,
+  1650650,
+  1650780,
+  1650940,
+  1651050,
+  1651060,
+  1651070,
+  1651080,
+  1651100,
+  1651120,
+  1651180,
+  1651270,
+  1651330,
+  1651480,
+  1651570,
+  1651630,
+  1651631,
+  1651640,
+  1651650,
+  1651660,
+  1651670,
+  1651820,
+  1651830,
+  1651900,
+  1651910,
+  1651911,
+  1651912,
+  1651913,
+  1651920,
+  1652070,
+  1652350,
+  1652351,
+  1652370,
+  1652430,
+  1652440,
+  1652450,
+  1652530,
+  1652550,
+  1652570,
+  1652760,
+  1652860,
+  1652861,
+  1652862,
+  1652863,
+  1653130,
+  1653570,
+  1653690,
+  1653720,
+  1653760,
+  1653900,
+  1653940,
+  1653960,
+  1654180,
+  1654330,
+  1654370,
+  1654380,
+  1654381,
+  1654382,
+  1654400,
+  1654430,
+  1654480,
+  1654481,
+  1654540,
+  1654720,
+  1654721,
+  1654722,
+  1654723,
+  1654820,
+  1654850,
+  1654950,
+  1655040,
+  1655070,
+  1655230,
+  1655360,
+  1655470,
+  1655471,
+  1655760,
+  1655780,
+  1655870,
+  1656220,
+  1656221,
+  1656222,
+  1656320,
+  1656330,
+  1656340,
+  1656350,
+  1656360,
+  1656370,
+  1656380,
+  1656530,
+  1656540,
+  1656720,
+  1656770,
+  1656800,
+  1656810,
+  1656910,
+  1656972,
+  1656973,
+  1656974,
+  1657030,
+  1657040,
+  1657120,
+  1657140,
+  1657141,
+  1657310,
+  1657380,
+  1657850,
+  1657860,
+  1657990,
+  1658060,
+  1658190,
+  1658330,
+  1658340,
+  1658430,
+  1658570,
+  1658630,
+  1658670,
+  1658720,
+  1658730,
+  1658810,
+  1658860,
+  1658950,
+  1658980,
+  1659070,
+  1659110,
+  1659290,
+  1659350,
+  1659570,
+  1659770,
+  1659940,
+  1660020,
+  1660030,
+  1660060,
+  1660061,
+  1660100,
+  1660380,
+  1660381,
+  1660390,
+  1660400,
+  1660410,
+  1660740,
+  1660760,
+  1660810,
+  1660900,
+  1661000,
+  1661120,
+  1661140,
+  1661230,
+  1661400,
+  1661460,
+  1661510,
+  1661520,
+  1661530,
+  1661540,
+  1661590,
+  1661710,
+  1661770,
+  1661990,
+  1662380,
+  1662400,
+  1662430,
+  1662490,
+  1662500,
+  1662501,
+  1662502,
+  1662503,
+  1662504,
+  1662505,
+  1662600,
+  1662610,
+  1662620,
+  1662640,
+  1662730,
+  1662880,
+  1662890,
+  1662910,
+  1663020,
+  1663021,
+  1663022,
+  1663080,
+  1663100,
+  1663110,
+  1663120,
+  1663130,
+  1663160,
+  1663240,
+  1663300,
+  1663340,
+  1663360,
+  1663420,
+  1663460,
+  1663470,
+  1663480,
+  1663490,
+  1663500,
+  1663510,
+  1663520,
+  1663530,
+  1663540,
+  1663550,
+  1663570,
+  1663590,
+  1663630,
+  1663680,
+  1663690,
+  1663700,
+  1663760,
+  1663820,
+  1663830,
+  1664020,
+  1664030,
+  1664031,
+  1664032,
+  1664033,
+  1664034,
+  1664040,
+  1664041,
+  1664070,
+  1664150,
+  1664151,
+  1664152,
+  1664153,
+  1664210,
+  1664270,
+  1664300,
+  1664460,
+  1664480,
+  1664490,
+  1664500,
+  1664550,
+  1664560,
+  1664600,
+  1664700,
+  1664760,
+  1664830,
+  1664831,
+  1664832,
+  1664880,
+  1664920,
+  1664931,
+  1664950,
+  1664951,
+  1664970,
+  1665030,
+  1665100,
+  1665310,
+  1665360,
+  1665370,
+  1665380,
+  1665390,
+  1665420,
+  1665440,
+  1665450,
+  1665470,
+  1665560,
+  1665630,
+  1665680,
+  1665710,
+  1665720,
+  1665830,
+  1665840,
+  1665841,
+  1665842,
+  1665843,
+  1665940,
+  1665960,
+  1666020,
+  1666040,
+  1666041,
+  1666080,
+  1666130,
+  1666131,
+  1666220,
+  1666330,
+  1666360,
+  1666380,
+  1666390,
+  1666410,
+  1666420,
+  1666440,
+  1666450,
+  1666550,
+  1666730,
+  1666731,
+  1666760,
+  1666890,
+  1666900,
+  1667070,
+  1667370,
+  1667410,
+  1667560,
+  1667570,
+  1667600,
+  1667610,
+  1667620,
+  1667660,
+  1667820,
+  1667821,
+  1667822,
+  1667823,
+  1667824,
+  1667825,
+  1667826,
+  1667827,
+  1667828,
+  1667829,
+  1667830,
+  1667831,
+  1667832,
+  1667833,
+  1667834,
+  1667835,
+  1667836,
+  1667837,
+  1667838,
+  1667839,
+  1667850,
+  1667851,
+  1667852,
+  1667853,
+  1667854,
+  1667855,
+  1667856,
+  1667857,
+  1667858,
+  1667859,
+  1667860,
+  1667861,
+  1667862,
+  1667863,
+  1667864,
+  1667865,
+  1667866,
+  1667867,
+  1667868,
+  1667869,
+  1667871,
+  1667872,
+  1667873,
+  1667874,
+  1667875,
+  1667876,
+  1667877,
+  1667878,
+  1667879,
+  1667880,
+  1667881,
+  1667882,
+  1667883,
+  1667884,
+  1667885,
+  1667886,
+  1667887,
+  1667888,
+  1667889,
+  1667890,
+  1667891,
+  1667892,
+  1667893,
+  1667894,
+  1667895,
+  1667896,
+  1667897,
+  1667898,
+  1667899,
+  1667900,
+  1667901,
+  1667902,
+  1667903,
+  1667904,
+  1667905,
+  1667906,
+  1667907,
+  1667908,
+  1667909,
+  1667910,
+  1667911,
+  1667912,
+  1667913,
+  1667914,
+  1667915,
+  1667916,
+  1667917,
+  1667918,
+  1667919,
+  1667930,
+  1667940,
+  1667950,
+  1667951,
+  1667952,
+  1667953,
+  1667954,
+  1667955,
+  1667956,
+  1667957,
+  1667958,
+  1667960,
+  1668070,
+  1668100,
+  1668110,
+  1668180,
+  1668220,
+  1668230,
+  1668240,
+  1668250,
+  1668270,
+  1668390,
+  1668430,
+  1668440,
+  1668560,
+  1668570,
+  1668660,
+  1668700,
+  1668740,
+  1668750,
+  1668910,
+  1669200,
+  1669201,
+  1669202,
+  1669203,
+  1669204,
+  1669210,
+  1669250,
+  1669300,
+  1669460,
+  1669680,
+  1669710,
+  1669720,
+  1669810,
+  1669920,
+  1670000,
+  1670040,
+  1670100,
+  1670140,
+  1670141,
+  1670142,
+  1670150,
+  1670220,
+  1670320,
+  1670330,
+  1670340,
+  1670390,
+  1670391,
+  1670430,
+  1670520,
+  1670521,
+  1670522,
+  1670560,
+  1670570,
+  1670600,
+  1670710,
+  1670720,
+  1670730,
+  1670790,
+  1670840,
+  1670841,
+  1670842,
+  1670910,
+  1670990,
+  1671000,
+  1671010,
+  1671030,
+  1671040,
+  1671050,
+  1671150,
+  1671151,
+  1671190,
+  1671270,
+  1671650,
+  1671680,
+  1672150,
+  1672210,
+  1672290,
+  1672300,
+  1672540,
+  1672570,
+  1672580,
+  1672980,
+  1672981,
+  1672982,
+  1672983,
+  1672984,
+  1672985,
+  1672986,
+  1673010,
+  1673240,
+  1673250,
+  1673280,
+  1673610,
+  1673930,
+  1673950,
+  1673960,
+  1673990,
+  1674040,
+  1674190,
+  1674210,
+  1674280,
+  1674290,
+  1674350,
+  1674390,
+  1674450,
+  1674460,
+  1674480,
+  1674570,
+  1674580,
+  1674610,
+  1674611,
+  1674612,
+  1674613,
+  1674614,
+  1674631,
+  1674632,
+  1674633,
+  1674634,
+  1674635,
+  1674636,
+  1674637,
+  1674680,
+  1674690,
+  1674730,
+  1674790,
+  1674910,
+  1674911,
+  1674951,
+  1674970,
+  1675010,
+  1675011,
+  1675550,
+  1675560,
+  1675570,
+  1675710,
+  1675711,
+  1675712,
+  1675713,
+  1675714,
+  1675715,
+  1675716,
+  1675717,
+  1675718,
+  1675719,
+  1675720,
+  1675721,
+  1675722,
+  1675723,
+  1675724,
+  1675725,
+  1675726,
+  1675727,
+  1675728,
+  1675729,
+  1675730,
+  1675731,
+  1675732,
+  1675733,
+  1675734,
+  1675735,
+  1675736,
+  1675737,
+  1675738,
+  1675739,
+  1675740,
+  1675741,
+  1675742,
+  1675743,
+  1675744,
+  1675745,
+  1675746,
+  1675747,
+  1675748,
+  1675749,
+  1675750,
+  1675751,
+  1675752,
+  1675753,
+  1675754,
+  1675755,
+  1675756,
+  1675757,
+  1675758,
+  1675759,
+  1675770,
+  1675771,
+  1675772,
+  1675773,
+  1675774,
+  1675775,
+  1675776,
+  1675777,
+  1675778,
+  1675779,
+  1675780,
+  1675781,
+  1675782,
+  1675783,
+  1675784,
+  1675785,
+  1675786,
+  1675787,
+  1675788,
+  1675789,
+  1675790,
+  1675800,
+  1675801,
+  1675802,
+  1675803,
+  1675804,
+  1675805,
+  1675806,
+  1675807,
+  1675808,
+  1675809,
+  1675810,
+  1675811,
+  1675812,
+  1675813,
+  1675814,
+  1675815,
+  1675816,
+  1675817,
+  1675818,
+  1675819,
+  1675820,
+  1675821,
+  1675822,
+  1675823,
+  1675824,
+  1675825,
+  1675826,
+  1675827,
+  1675828,
+  1675829,
+  1675890,
+  1675910,
+  1675930,
+  1675980,
+  1676010,
+  1676041,
+  1676042,
+  1676043,
+  1676044,
+  1676080,
+  1676100,
+  1676120,
+  1676190,
+  1676230,
+  1676250,
+  1676500,
+  1676630,
+  1676800,
+  1676810,
+  1676820,
+  1676830,
+  1676900,
+  1676960,
+  1677070,
+  1677150,
+  1677160,
+  1677170,
+  1677171,
+  1677210,
+  1677320,
+  1677530,
+  1677540,
+  1677541,
+  1677542,
+  1677550,
+  1677610,
+  1677660,
+  1677710,
+  1677760,
+  1677780,
+  1677990,
+  1677991,
+  1678120,
+  1678190,
+  1678240,
+  1678260,
+  1678310,
+  1678370,
+  1678640,
+  1678800,
+  1678890,
+  1678970,
+  1679030,
+  1679031,
+  1679140,
+  1679390,
+  1679580,
+  1679600,
+  1679601,
+  1679610,
+  1679611,
+  1679620,
+  1679630,
+  1679640,
+  1679810,
+  1679900,
+  1680090,
+  1680091,
+  1680092,
+  1680093,
+  1680094,
+  1680095,
+  1680096,
+  1680097,
+  1680098,
+  1680099,
+  1680100,
+  1680101,
+  1680102,
+  1680103,
+  1680104,
+  1680105,
+  1680106,
+  1680107,
+  1680108,
+  1680109,
+  1680110,
+  1680111,
+  1680112,
+  1680113,
+  1680114,
+  1680115,
+  1680116,
+  1680117,
+  1680118,
+  1680119,
+  1680120,
+  1680121,
+  1680122,
+  1680123,
+  1680124,
+  1680125,
+  1680126,
+  1680127,
+  1680128,
+  1680129,
+  1680130,
+  1680131,
+  1680132,
+  1680133,
+  1680134,
+  1680135,
+  1680136,
+  1680137,
+  1680138,
+  1680139,
+  1680140,
+  1680141,
+  1680142,
+  1680143,
+  1680144,
+  1680145,
+  1680146,
+  1680147,
+  1680148,
+  1680149,
+  1680150,
+  1680151,
+  1680152,
+  1680153,
+  1680154,
+  1680155,
+  1680156,
+  1680157,
+  1680158,
+  1680159,
+  1680160,
+  1680161,
+  1680162,
+  1680163,
+  1680164,
+  1680165,
+  1680166,
+  1680167,
+  1680168,
+  1680169,
+  1680170,
+  1680171,
+  1680172,
+  1680173,
+  1680174,
+  1680175,
+  1680176,
+  1680177,
+  1680178,
+  1680179,
+  1680180,
+  1680181,
+  1680182,
+  1680183,
+  1680184,
+  1680185,
+  1680186,
+  1680187,
+  1680188,
+  1680189,
+  1680200,
+  1680420,
+  1680450,
+  1680480,
+  1680750,
+  1680820,
+  1680850,
+  1680920,
+  1680930,
+  1680940,
+  1680950,
+  1680960,
+  1680970,
+  1680971,
+  1680972,
+  1680973,
+  1681050,
+  1681090,
+  1681170,
+  1681180,
+  1681201,
+  1681210,
+  1681220,
+  1681270,
+  1681271,
+  1681300,
+  1681630,
+  1681660,
+  1681680,
+  1681690,
+  1681750,
+  1681790,
+  1681820,
+  1682010,
+  1682100,
+  1682180,
+  1682230,
+  1682390,
+  1682480,
+  1682510,
+  1682640,
+  1682710,
+  1682720,
+  1682730,
+  1682740,
+  1682770,
+  1682771,
+  1682830,
+  1683260,
+  1683350,
+  1683700,
+  1683780,
+  1684200,
+  1684540,
+  1684590,
+  1684591,
+  1684592,
+  1684730,
+  1684770,
+  1684800,
+  1684890,
+  1684960,
+  1684961,
+  1685040,
+  1685050,
+  1685080,
+  1685081,
+  1685090,
+  1685100,
+  1685110,
+  1685160,
+  1685200,
+  1685290,
+  1685340,
+  1685350,
+  1685351,
+  1685352,
+  1685353,
+  1685354,
+  1685355,
+  1685356,
+  1685357,
+  1685358,
+  1685359,
+  1685360,
+  1685361,
+  1685362,
+  1685363,
+  1685364,
+  1685365,
+  1685366,
+  1685367,
+  1685368,
+  1685369,
+  1685370,
+  1685371,
+  1685372,
+  1685373,
+  1685374,
+  1685375,
+  1685376,
+  1685377,
+  1685378,
+  1685379,
+  1685380,
+  1685381,
+  1685382,
+  1685383,
+  1685384,
+  1685385,
+  1685386,
+  1685387,
+  1685388,
+  1685389,
+  1685390,
+  1685391,
+  1685392,
+  1685393,
+  1685394,
+  1685395,
+  1685396,
+  1685397,
+  1685398,
+  1685399,
+  1685400,
+  1685401,
+  1685402,
+  1685403,
+  1685404,
+  1685405,
+  1685406,
+  1685407,
+  1685408,
+  1685409,
+  1685410,
+  1685411,
+  1685412,
+  1685413,
+  1685414,
+  1685415,
+  1685416,
+  1685417,
+  1685418,
+  1685419,
+  1685420,
+  1685421,
+  1685422,
+  1685423,
+  1685424,
+  1685425,
+  1685426,
+  1685427,
+  1685428,
+  1685429,
+  1685430,
+  1685431,
+  1685432,
+  1685433,
+  1685434,
+  1685435,
+  1685436,
+  1685437,
+  1685438,
+  1685439,
+  1685440,
+  1685441,
+  1685442,
+  1685443,
+  1685444,
+  1685445,
+  1685446,
+  1685447,
+  1685448,
+  1685449,
+  1685540,
+  1685640,
+  1685670,
+  1685690,
+  1685720,
+  1685721,
+  1685910,
+  1686030,
+  1686040,
+  1686180,
+  1686300,
+  1686460,
+  1686500,
+  1686740,
+  1686750,
+  1687110,
+  1687270,
+  1687290,
+  1687500,
+  1687510,
+  1687520,
+  1687610,
+  1687720,
+  1687800,
+  1687801,
+  1687802,
+  1687803,
+  1687804,
+  1687805,
+  1687806,
+  1687807,
+  1687808,
+  1687809,
+  1687810,
+  1687811,
+  1687812,
+  1687813,
+  1687814,
+  1687815,
+  1687816,
+  1687817,
+  1687818,
+  1687819,
+  1687820,
+  1687821,
+  1687822,
+  1687823,
+  1687824,
+  1687825,
+  1687826,
+  1687827,
+  1687828,
+  1687829,
+  1687830,
+  1687831,
+  1687832,
+  1687833,
+  1687834,
+  1687835,
+  1687836,
+  1687837,
+  1687838,
+  1687839,
+  1687850,
+  1687851,
+  1687852,
+  1687853,
+  1687854,
+  1687855,
+  1687856,
+  1687857,
+  1687858,
+  1687859,
+  1687860,
+  1687861,
+  1687862,
+  1687863,
+  1687864,
+  1687865,
+  1687866,
+  1687867,
+  1687868,
+  1687869,
+  1687870,
+  1687871,
+  1687872,
+  1687873,
+  1687874,
+  1687875,
+  1687876,
+  1687877,
+  1687878,
+  1687879,
+  1687880,
+  1687881,
+  1687882,
+  1687883,
+  1687884,
+  1687885,
+  1687886,
+  1687887,
+  1687888,
+  1687889,
+  1687890,
+  1687891,
+  1687892,
+  1687893,
+  1687894,
+  1687895,
+  1687896,
+  1687897,
+  1687898,
+  1687899,
+  1687900,
+  1687901,
+  1687902,
+  1687903,
+  1687904,
+  1687905,
+  1687906,
+  1687907,
+  1687908,
+  1687909,
+  1688000,
+  1688010,
+  1688030,
+  1688040,
+  1688050,
+  1688060,
+  1688110,
+  1688120,
+  1688170,
+  1688260,
+  1688410,
+  1688450,
+  1688451,
+  1688480,
+  1688500,
+  1688560,
+  1688680,
+  1688681,
+  1688682,
+  1688683,
+  1688684,
+  1688750,
+  1688840,
+  1688860,
+  1688900,
+  1688920,
+  1688990,
+  1689100,
+  1689110,
+  1689200,
+  1689290,
+  1689291,
+  1689292,
+  1689330,
+  1689710,
+  1689760,
+  1689810,
+  1689830,
+  1689950,
+  1689970,
+  1690010,
+  1690130,
+  1690140,
+  1690230,
+  1690300,
+  1690310,
+  1690330,
+  1690420,
+  1690470,
+  1690510,
+  1690511,
+  1690512,
+  1690513,
+  1690580,
+  1690670,
+  1690750,
+  1690780,
+  1690800,
+  1690840,
+  1690850,
+  1690960,
+  1690961,
+  1690962,
+  1690963,
+  1690964,
+  1691040,
+  1691080,
+  1691090,
+  1691110,
+  1691140,
+  1691240,
+  1691430,
+  1691440,
+  1691460,
+  1691470,
+  1691471,
+  1691540,
+  1691570,
+  1691670,
+  1691710,
+  1691810,
+  1691811,
+  1691910,
+  1691920,
+  1691930,
+  1691931,
+  1691940,
+  1691950,
+  1691960,
+  1691980,
+  1692020,
+  1692040,
+  1692080,
+  1692260,
+  1692370,
+  1692371,
+  1692460,
+  1692462,
+  1692463,
+  1692464,
+  1692465,
+  1692466,
+  1692490,
+  1692530,
+  1692531,
+  1692532,
+  1692610,
+  1692660,
+  1692750,
+  1692751,
+  1692752,
+  1692753,
+  1692754,
+  1692755,
+  1692756,
+  1692757,
+  1692758,
+  1692759,
+  1692760,
+  1692761,
+  1692762,
+  1692763,
+  1692764,
+  1692765,
+  1692766,
+  1692767,
+  1692768,
+  1692769,
+  1692770,
+  1692771,
+  1692772,
+  1692773,
+  1692774,
+  1692775,
+  1692776,
+  1692777,
+  1692778,
+  1692779,
+  1692780,
+  1692781,
+  1692782,
+  1692783,
+  1692784,
+  1692785,
+  1692786,
+  1692787,
+  1692788,
+  1692789,
+  1692790,
+  1692791,
+  1692792,
+  1692793,
+  1692794,
+  1692795,
+  1692796,
+  1692797,
+  1692798,
+  1692799,
+  1692800,
+  1692801,
+  1692802,
+  1692803,
+  1692804,
+  1692805,
+  1692806,
+  1692807,
+  1692808,
+  1692809,
+  1692810,
+  1692811,
+  1692812,
+  1692813,
+  1692814,
+  1692815,
+  1692816,
+  1692817,
+  1692818,
+  1692819,
+  1692820,
+  1692821,
+  1692822,
+  1692823,
+  1692824,
+  1692825,
+  1692826,
+  1692827,
+  1692828,
+  1692829,
+  1692830,
+  1692831,
+  1692832,
+  1692833,
+  1692834,
+  1692835,
+  1692836,
+  1692837,
+  1692838,
+  1692839,
+  1692840,
+  1692841,
+  1692842,
+  1692843,
+  1692844,
+  1692845,
+  1692846,
+  1692847,
+  1692848,
+  1692849,
+  1692880,
+  1693110,
+  1693120,
+  1693720,
+  1693880,
+  1694060,
+  1694070,
+  1694080,
+  1694220,
+  1694280,
+  1694400,
+  1694700,
+  1694730,
+  1694780,
+  1694800,
+  1694801,
+  1694850,
+  1694910,
+  1694950,
+  1695050,
+  1695100,
+  1695101,
+  1695102,
+  1695103,
+  1695104,
+  1695105,
+  1695106,
+  1695107,
+  1695108,
+  1695109,
+  1695110,
+  1695111,
+  1695112,
+  1695113,
+  1695114,
+  1695115,
+  1695116,
+  1695117,
+  1695118,
+  1695119,
+  1695120,
+  1695121,
+  1695122,
+  1695123,
+  1695124,
+  1695125,
+  1695126,
+  1695127,
+  1695128,
+  1695129,
+  1695140,
+  1695141,
+  1695142,
+  1695143,
+  1695144,
+  1695145,
+  1695146,
+  1695147,
+  1695148,
+  1695149,
+  1695160,
+  1695161,
+  1695162,
+  1695163,
+  1695164,
+  1695165,
+  1695166,
+  1695167,
+  1695168,
+  1695169,
+  1695170,
+  1695171,
+  1695172,
+  1695173,
+  1695174,
+  1695175,
+  1695176,
+  1695177,
+  1695178,
+  1695179,
+  1695180,
+  1695181,
+  1695182,
+  1695183,
+  1695184,
+  1695185,
+  1695186,
+  1695187,
+  1695188,
+  1695189,
+  1695190,
+  1695191,
+  1695192,
+  1695193,
+  1695194,
+  1695195,
+  1695196,
+  1695197,
+  1695198,
+  1695199,
+  1695210,
+  1695211,
+  1695212,
+  1695213,
+  1695214,
+  1695215,
+  1695216,
+  1695217,
+  1695218,
+  1695219,
+  1695220,
+  1695221,
+  1695222,
+  1695223,
+  1695224,
+  1695225,
+  1695226,
+  1695227,
+  1695228,
+  1695229,
+  1695230,
+  1695290,
+  1695300,
+  1695350,
+  1695351,
+  1695361,
+  1695390,
+  1695410,
+  1695440,
+  1695490,
+  1695590,
+  1695630,
+  1695660,
+  1695690,
+  1695691,
+  1695710,
+  1695711,
+  1695720,
+  1695730,
+  1695731,
+  1695740,
+  1695750,
+  1695760,
+  1695770,
+  1695780,
+  1695791,
+  1695920,
+  1695980,
+  1696000,
+  1696060,
+  1696061,
+  1696062,
+  1696120,
+  1696180,
+  1696270,
+  1696360,
+  1696390,
+  1696391,
+  1696400,
+  1696420,
+  1696470,
+  1696500,
+  1696510,
+  1696530,
+  1696560,
+  1696600,
+  1696690,
+  1696870,
+  1696880,
+  1696890,
+  1697210,
+  1697211,
+  1697220,
+  1697230,
+  1697260,
+  1697320,
+  1697321,
+  1697322,
+  1697323,
+  1697324,
+  1697325,
+  1697326,
+  1697327,
+  1697328,
+  1697329,
+  1697330,
+  1697331,
+  1697332,
+  1697333,
+  1697334,
+  1697335,
+  1697336,
+  1697337,
+  1697338,
+  1697339,
+  1697340,
+  1697341,
+  1697342,
+  1697343,
+  1697344,
+  1697345,
+  1697346,
+  1697347,
+  1697348,
+  1697349,
+  1697350,
+  1697351,
+  1697352,
+  1697353,
+  1697354,
+  1697355,
+  1697356,
+  1697357,
+  1697358,
+  1697359,
+  1697360,
+  1697361,
+  1697362,
+  1697363,
+  1697364,
+  1697365,
+  1697366,
+  1697367,
+  1697368,
+  1697369,
+  1697370,
+  1697371,
+  1697372,
+  1697373,
+  1697374,
+  1697375,
+  1697376,
+  1697377,
+  1697378,
+  1697379,
+  1697380,
+  1697381,
+  1697382,
+  1697383,
+  1697384,
+  1697385,
+  1697386,
+  1697387,
+  1697388,
+  1697389,
+  1697390,
+  1697391,
+  1697392,
+  1697393,
+  1697394,
+  1697395,
+  1697396,
+  1697397,
+  1697398,
+  1697399,
+  1697410,
+  1697411,
+  1697412,
+  1697413,
+  1697414,
+  1697415,
+  1697416,
+  1697417,
+  1697418,
+  1697419,
+  1697430,
+  1697431,
+  1697432,
+  1697433,
+  1697434,
+  1697435,
+  1697436,
+  1697437,
+  1697438,
+  1697439,
+  1697440,
+  1697480,
+  1697510,
+  1697580,
+  1697660,
+  1697710,
+  1697840,
+  1697960,
+  1698050,
+  1698090,
+  1698100,
+  1698150,
+  1698180,
+  1698190,
+  1698250,
+  1698251,
+  1698252,
+  1698300,
+  1698340,
+  1698370,
+  1698380,
+  1698430,
+  1698490,
+  1698500,
+  1698560,
+  1698580,
+  1698790,
+  1698830,
+  1699060,
+  1699070,
+  1699100,
+  1699330,
+  1699340,
+  1699350,
+  1699360,
+  1699470,
+  1699540,
+  1699541,
+  1699542,
+  1699543,
+  1699544,
+  1699545,
+  1699546,
+  1699547,
+  1699548,
+  1699549,
+  1699550,
+  1699551,
+  1699552,
+  1699553,
+  1699554,
+  1699555,
+  1699556,
+  1699557,
+  1699558,
+  1699559,
+  1699570,
+  1699571,
+  1699572,
+  1699573,
+  1699574,
+  1699575,
+  1699576,
+  1699577,
+  1699578,
+  1699579,
+  1699580,
+  1699581,
+  1699582,
+  1699583,
+  1699584,
+  1699585,
+  1699586,
+  1699587,
+  1699588,
+  1699589,
+  1699590,
+  1699591,
+  1699592,
+  1699593,
+  1699594,
+  1699595,
+  1699596,
+  1699597,
+  1699598,
+  1699599,
+  1699600,
+  1699601,
+  1699602,
+  1699603,
+  1699604,
+  1699605,
+  1699606,
+  1699607,
+  1699608,
+  1699609,
+  1699610,
+  1699611,
+  1699612,
+  1699613,
+  1699614,
+  1699615,
+  1699616,
+  1699617,
+  1699618,
+  1699619,
+  1699620,
+  1699621,
+  1699622,
+  1699623,
+  1699624,
+  1699625,
+  1699626,
+  1699627,
+  1699628,
+  1699629,
+  1699630,
+  1699631,
+  1699632,
+  1699633,
+  1699634,
+  1699635,
+  1699636,
+  1699637,
+  1699638,
+  1699639,
+  1699640,
+  1699641,
+  1699642,
+  1699643,
+  1699644,
+  1699645,
+  1699646,
+  1699647,
+  1699648,
+  1699649,
+  1699700,
+  1699800,
+  1700060,
+  1700100,
+  1700280,
+  1700310,
+  1700360,
+  1700390,
+  1700470,
+  1700471,
+  1700472,
+  1700473,
+  1700474,
+  1700475,
+  1700476,
+  1700477,
+  1700478,
+  1700479,
+  1700480,
+  1700481,
+  1700482,
+  1700483,
+  1700484,
+  1700485,
+  1700486,
+  1700487,
+  1700488,
+  1700489,
+  1700490,
+  1700491,
+  1700492,
+  1700493,
+  1700494,
+  1700495,
+  1700496,
+  1700497,
+  1700498,
+  1700499,
+  1700500,
+  1700501,
+  1700502,
+  1700503,
+  1700504,
+  1700505,
+  1700506,
+  1700507,
+  1700508,
+  1700509,
+  1700510,
+  1700511,
+  1700512,
+  1700513,
+  1700514,
+  1700515,
+  1700516,
+  1700517,
+  1700518,
+  1700519,
+  1700520,
+  1700521,
+  1700522,
+  1700523,
+  1700530,
+  1700531,
+  1700532,
+  1700533,
+  1700534,
+  1700535,
+  1700540,
+  1700541,
+  1700542,
+  1700543,
+  1700544,
+  1700545,
+  1700546,
+  1700547,
+  1700548,
+  1700549,
+  1700560,
+  1700561,
+  1700562,
+  1700563,
+  1700564,
+  1700565,
+  1700566,
+  1700567,
+  1700568,
+  1700569,
+  1700570,
+  1700571,
+  1700572,
+  1700573,
+  1700574,
+  1700575,
+  1700576,
+  1700577,
+  1700578,
+  1700579,
+  1700580,
+  1700581,
+  1700582,
+  1700583,
+  1700584,
+  1700585,
+  1700586,
+  1700587,
+  1700588,
+  1700589,
+  1700710,
+  1700720,
+  1700730,
+  1700750,
+  1700820,
+  1700821,
+  1700970,
+  1701060,
+  1701070,
+  1701110,
+  1701120,
+  1701170,
+  1701200,
+  1701310,
+  1701430,
+  1701480,
+  1701550,
+  1701600,
+  1701700,
+  1701790,
+  1701860,
+  1701861,
+  1701862,
+  1701980,
+  1701981,
+  1701982,
+  1701983,
+  1701984,
+  1702020,
+  1702060,
+  1702080,
+  1702110,
+  1702210,
+  1702290,
+  1702340,
+  1702570,
+  1702640,
+  1702750,
+  1702810,
+  1702900,
+  1702920,
+  1703150,
+  1703151,
+  1703270,
+  1703320,
+  1703400,
+  1703410,
+  1703420,
+  1703630,
+  1703660,
+  1703661,
+  1703662,
+  1703663,
+  1703664,
+  1703665,
+  1703666,
+  1703667,
+  1703668,
+  1703669,
+  1703670,
+  1703671,
+  1703672,
+  1703673,
+  1703674,
+  1703675,
+  1703676,
+  1703677,
+  1703678,
+  1703679,
+  1703680,
+  1703681,
+  1703682,
+  1703683,
+  1703684,
+  1703685,
+  1703686,
+  1703687,
+  1703688,
+  1703689,
+  1703690,
+  1703691,
+  1703692,
+  1703693,
+  1703694,
+  1703695,
+  1703696,
+  1703697,
+  1703698,
+  1703699,
+  1703700,
+  1703701,
+  1703702,
+  1703703,
+  1703704,
+  1703705,
+  1703706,
+  1703707,
+  1703708,
+  1703709,
+  1703710,
+  1703711,
+  1703712,
+  1703713,
+  1703714,
+  1703715,
+  1703716,
+  1703717,
+  1703718,
+  1703719,
+  1703720,
+  1703721,
+  1703722,
+  1703723,
+  1703724,
+  1703725,
+  1703726,
+  1703727,
+  1703728,
+  1703729,
+  1703730,
+  1703731,
+  1703732,
+  1703733,
+  1703734,
+  1703735,
+  1703736,
+  1703737,
+  1703738,
+  1703739,
+  1703750,
+  1703751,
+  1703752,
+  1703753,
+  1703754,
+  1703755,
+  1703756,
+  1703757,
+  1703758,
+  1703759,
+  1703760,
+  1703761,
+  1703762,
+  1703763,
+  1703764,
+  1703765,
+  1703766,
+  1703767,
+  1703768,
+  1703769,
+  1703810,
+  1703811,
+  1703812,
+  1703813,
+  1703814,
+  1703815,
+  1703816,
+  1703817,
+  1703818,
+  1703819,
+  1703820,
+  1703821,
+  1703822,
+  1703823,
+  1703824,
+  1703825,
+  1703826,
+  1703827,
+  1703828,
+  1703829,
+  1703830,
+  1703831,
+  1703832,
+  1703833,
+  1703834,
+  1703835,
+  1703836,
+  1703837,
+  1703838,
+  1703839,
+  1703840,
+  1703841,
+  1703842,
+  1703843,
+  1703844,
+  1703845,
+  1703846,
+  1703847,
+  1703848,
+  1703849,
+  1703850,
+  1703851,
+  1703852,
+  1703853,
+  1703854,
+  1703855,
+  1703856,
+  1703857,
+  1703858,
+  1703859,
+  1703860,
+  1703861,
+  1703862,
+  1703863,
+  1703864,
+  1703865,
+  1703866,
+  1703867,
+  1703868,
+  1703869,
+  1703870,
+  1703871,
+  1703872,
+  1703873,
+  1703874,
+  1703875,
+  1703876,
+  1703877,
+  1703878,
+  1703879,
+  1703880,
+  1703881,
+  1703882,
+  1703883,
+  1703884,
+  1703885,
+  1703886,
+  1703887,
+  1703888,
+  1703889,
+  1703890,
+  1703891,
+  1703892,
+  1703893,
+  1703894,
+  1703895,
+  1703896,
+  1703897,
+  1703898,
+  1703899,
+  1703900,
+  1703901,
+  1703902,
+  1703903,
+  1703904,
+  1703905,
+  1703906,
+  1703907,
+  1703908,
+  1703909,
+  1703940,
+  1703960,
+  1703961,
+  1703962,
+  1703963,
+  1703964,
+  1703965,
+  1703966,
+  1703967,
+  1703968,
+  1703969,
+  1703970,
+  1703971,
+  1703972,
+  1703973,
+  1703974,
+  1703975,
+  1703976,
+  1703977,
+  1703978,
+  1703979,
+  1703980,
+  1703981,
+  1703982,
+  1703983,
+  1703984,
+  1703985,
+  1703986,
+  1703987,
+  1703988,
+  1703989,
+  1703990,
+  1703991,
+  1703992,
+  1703993,
+  1703994,
+  1703995,
+  1703996,
+  1703997,
+  1703998,
+  1703999,
+  1704000,
+  1704001,
+  1704002,
+  1704003,
+  1704004,
+  1704005,
+  1704006,
+  1704007,
+  1704008,
+  1704009,
+  1704010,
+  1704011,
+  1704012,
+  1704013,
+  1704014,
+  1704015,
+  1704016,
+  1704017,
+  1704018,
+  1704019,
+  1704020,
+  1704021,
+  1704022,
+  1704023,
+  1704024,
+  1704025,
+  1704026,
+  1704027,
+  1704028,
+  1704029,
+  1704030,
+  1704031,
+  1704032,
+  1704033,
+  1704034,
+  1704035,
+  1704036,
+  1704037,
+  1704038,
+  1704039,
+  1704040,
+  1704041,
+  1704042,
+  1704043,
+  1704044,
+  1704045,
+  1704046,
+  1704047,
+  1704048,
+  1704049,
+  1704050,
+  1704051,
+  1704052,
+  1704053,
+  1704054,
+  1704055,
+  1704056,
+  1704057,
+  1704058,
+  1704059,
+  1704100,
+  1704110,
+  1704220,
+  1704280,
+  1704330,
+  1704331,
+  1704332,
+  1704333,
+  1704334,
+  1704335,
+  1704336,
+  1704337,
+  1704338,
+  1704339,
+  1704340,
+  1704341,
+  1704342,
+  1704343,
+  1704344,
+  1704345,
+  1704346,
+  1704347,
+  1704348,
+  1704349,
+  1704350,
+  1704351,
+  1704352,
+  1704353,
+  1704354,
+  1704355,
+  1704356,
+  1704357,
+  1704358,
+  1704359,
+  1704360,
+  1704361,
+  1704362,
+  1704363,
+  1704364,
+  1704365,
+  1704366,
+  1704367,
+  1704368,
+  1704369,
+  1704370,
+  1704371,
+  1704372,
+  1704373,
+  1704374,
+  1704375,
+  1704376,
+  1704377,
+  1704378,
+  1704379,
+  1704380,
+  1704381,
+  1704382,
+  1704383,
+  1704384,
+  1704385,
+  1704386,
+  1704387,
+  1704388,
+  1704389,
+  1704390,
+  1704391,
+  1704392,
+  1704393,
+  1704394,
+  1704395,
+  1704396,
+  1704397,
+  1704398,
+  1704399,
+  1704400,
+  1704401,
+  1704402,
+  1704403,
+  1704404,
+  1704405,
+  1704406,
+  1704407,
+  1704408,
+  1704409,
+  1704410,
+  1704411,
+  1704412,
+  1704413,
+  1704414,
+  1704415,
+  1704416,
+  1704417,
+  1704418,
+  1704419,
+  1704420,
+  1704421,
+  1704422,
+  1704423,
+  1704424,
+  1704425,
+  1704426,
+  1704427,
+  1704428,
+  1704429,
+  1704440,
+  1704460,
+  1704610,
+  1704650,
+  1704660,
+  1704680,
+  1704681,
+  1704690,
+  1704691,
+  1704960,
+  1704961,
+  1704990,
+  1704991,
+  1704992,
+  1704993,
+  1704994,
+  1704995,
+  1704996,
+  1704997,
+  1704998,
+  1704999,
+  1705000,
+  1705001,
+  1705002,
+  1705003,
+  1705004,
+  1705005,
+  1705006,
+  1705007,
+  1705008,
+  1705009,
+  1705010,
+  1705011,
+  1705012,
+  1705013,
+  1705014,
+  1705015,
+  1705016,
+  1705017,
+  1705018,
+  1705019,
+  1705040,
+  1705041,
+  1705042,
+  1705043,
+  1705044,
+  1705045,
+  1705046,
+  1705047,
+  1705048,
+  1705049,
+  1705050,
+  1705051,
+  1705052,
+  1705053,
+  1705054,
+  1705055,
+  1705056,
+  1705057,
+  1705058,
+  1705059,
+  1705060,
+  1705061,
+  1705062,
+  1705063,
+  1705064,
+  1705065,
+  1705066,
+  1705067,
+  1705068,
+  1705069,
+  1705070,
+  1705071,
+  1705072,
+  1705073,
+  1705074,
+  1705075,
+  1705076,
+  1705077,
+  1705078,
+  1705079,
+  1705080,
+  1705081,
+  1705082,
+  1705083,
+  1705084,
+  1705085,
+  1705086,
+  1705087,
+  1705088,
+  1705089,
+  1705090,
+  1705091,
+  1705092,
+  1705093,
+  1705094,
+  1705095,
+  1705096,
+  1705097,
+  1705098,
+  1705099,
+  1705100,
+  1705101,
+  1705102,
+  1705103,
+  1705104,
+  1705105,
+  1705106,
+  1705107,
+  1705108,
+  1705109,
+  1705230,
+  1705231,
+  1705232,
+  1705233,
+  1705234,
+  1705235,
+  1705236,
+  1705237,
+  1705238,
+  1705239,
+  1705240,
+  1705241,
+  1705242,
+  1705243,
+  1705244,
+  1705245,
+  1705246,
+  1705247,
+  1705248,
+  1705249,
+  1705250,
+  1705251,
+  1705252,
+  1705253,
+  1705254,
+  1705255,
+  1705256,
+  1705257,
+  1705258,
+  1705259,
+  1705260,
+  1705261,
+  1705262,
+  1705263,
+  1705264,
+  1705265,
+  1705266,
+  1705267,
+  1705268,
+  1705269,
+  1705270,
+  1705271,
+  1705272,
+  1705273,
+  1705274,
+  1705275,
+  1705276,
+  1705277,
+  1705278,
+  1705279,
+  1705280,
+  1705281,
+  1705282,
+  1705283,
+  1705284,
+  1705285,
+  1705286,
+  1705287,
+  1705288,
+  1705289,
+  1705290,
+  1705291,
+  1705292,
+  1705293,
+  1705294,
+  1705295,
+  1705296,
+  1705297,
+  1705298,
+  1705299,
+  1705300,
+  1705301,
+  1705302,
+  1705303,
+  1705304,
+  1705305,
+  1705306,
+  1705307,
+  1705308,
+  1705309,
+  1705310,
+  1705311,
+  1705312,
+  1705313,
+  1705314,
+  1705315,
+  1705316,
+  1705317,
+  1705318,
+  1705319,
+  1705320,
+  1705321,
+  1705322,
+  1705323,
+  1705324,
+  1705325,
+  1705326,
+  1705327,
+  1705328,
+  1705329,
+  1705600,
+  1705630,
+  1705740,
+  1705820,
+  1705840,
+  1705900,
+  1705910,
+  1705990,
+  1706180,
+  1706200,
+  1706230,
+  1706400,
+  1706401,
+  1706402,
+  1706403,
+  1706404,
+  1706680,
+  1706690,
+  1706730,
+  1706750,
+  1706840,
+  1707020,
+  1707021,
+  1707022,
+  1707160,
+  1707300,
+  1707340,
+  1707350,
+  1707360,
+  1707420,
+  1707430,
+  1707440,
+  1707530,
+  1707531,
+  1707532,
+  1707533,
+  1707534,
+  1707535,
+  1707810,
+  1707820,
+  1707860,
+  1707910,
+  1707920,
+  1707921,
+  1707922,
+  1707930,
+  1707931,
+  1707932,
+  1707933,
+  1708020,
+  1708090,
+  1708091,
+  1708440,
+  1708500,
+  1708600,
+  1708620,
+  1708660,
+  1708670,
+  1708680,
+  1708720,
+  1708840,
+  1708860,
+  1708890,
+  1708910,
+  1708930,
+  1708931,
+  1709010,
+  1709140,
+  1709200,
+  1709270,
+  1709340,
+  1709560,
+  1709620,
+  1709680,
+  1709690,
+  1709840,
+  1709890,
+  1709930,
+  1709970,
+  1709971,
+  1709972,
+  1709973,
+  1709974,
+  1709975,
+  1709976,
+  1709977,
+  1709978,
+  1709979,
+  1709980,
+  1709981,
+  1709982,
+  1709983,
+  1709984,
+  1710020,
+  1710030,
+  1710060,
+  1710061,
+  1710070,
+  1710080,
+  1710240,
+  1710241,
+  1710270,
+  1710300,
+  1710301,
+  1710350,
+  1710370,
+  1710371,
+  1710430,
+  1710440,
+  1710470,
+  1710610,
+  1710650,
+  1710660,
+  1711030,
+  1711031,
+  1711032,
+  1711040,
+  1711140,
+  1711180,
+  1711181,
+  1711182,
+  1711183,
+  1711330,
+  1711370,
+  1711380,
+  1711390,
+  1711410,
+  1711570,
+  1711730,
+  1711731,
+  1711732,
+  1711733,
+  1711734,
+  1711770,
+  1711771,
+  1711772,
+  1711773,
+  1711810,
+  1711820,
+  1711821,
+  1711822,
+  1711890,
+  1711900,
+  1712070,
+  1712190,
+  1712220,
+  1712620,
+  1712660,
+  1712770,
+  1712780,
+  1712790,
+  1713180,
+  1713280,
+  1713281,
+  1713330,
+  1713380,
+  1713430,
+  1713490,
+  1713540,
+  1713560,
+  1713800,
+  1713870,
+  1713900,
+  1714110,
+  1714150,
+  1714160,
+  1714161,
+  1714220,
+  1714330,
+  1714600,
+  1714780,
+  1714890,
+  1715100,
+  1715150,
+  1715170,
+  1715180,
+  1715200,
+  1715230,
+  1715300,
+  1715410,
+  1715420,
+  1715421,
+  1715422,
+  1715430,
+  1715440,
+  1715450,
+  1715480,
+  1715520,
+  1715521,
+  1715600,
+  1715610,
+  1715620,
+  1715790,
+  1715810,
+  1715811,
+  1715812,
+  1715900,
+  1715910,
+  1715920,
+  1715990,
+  1716010,
+  1716060,
+  1716070,
+  1716090,
+  1716280,
+  1716291,
+  1716340,
+  1716410,
+  1716580,
+  1716581,
+  1716620,
+  1716670,
+  1716840,
+  1717030,
+  1717040,
+  1717380,
+  1717450,
+  1717460,
+  1717480,
+  1717650,
+  1717652,
+  1717653,
+  1717654,
+  1717655,
+  1717656,
+  1717750,
+  1717970,
+  1717980,
+  1718030,
+  1718140,
+  1718150,
+  1718170,
+  1718360,
+  1718640,
+  1718750,
+  1718780,
+  1718880,
+  1718930,
+  1718950,
+  1718951,
+  1718960,
+  1718970,
+  1718980,
+  1719010,
+  1719280,
+  1719281,
+  1719282,
+  1719283,
+  1719284,
+  1719285,
+  1719286,
+  1719287,
+  1719288,
+  1719289,
+  1719440,
+  1719520,
+  1719560,
+  1719561,
+  1719562,
+  1719563,
+  1719564,
+  1719565,
+  1719566,
+  1719567,
+  1719568,
+  1719569,
+  1719640,
+  1719800,
+  1719810,
+  1719840,
+  1719910,
+  1719920,
+  1720000,
+  1720001,
+  1720002,
+  1720003,
+  1720004,
+  1720005,
+  1720006,
+  1720007,
+  1720008,
+  1720009,
+  1720080,
+  1720250,
+  1720410,
+  1720440,
+  1720441,
+  1720442,
+  1720443,
+  1720444,
+  1720445,
+  1720446,
+  1720447,
+  1720448,
+  1720449,
+  1720630,
+  1720670,
+  1720690,
+  1720691,
+  1720692,
+  1720693,
+  1720694,
+  1720695,
+  1720696,
+  1720697,
+  1720698,
+  1720699,
+  1720710,
+  1720820,
+  1720870,
+  1720871,
+  1720872,
+  1720873,
+  1720874,
+  1720875,
+  1720876,
+  1720877,
+  1720878,
+  1720879,
+  1720890,
+  1721040,
+  1721190,
+  1721210,
+  1721320,
+  1721500,
+  1721630,
+  1721670,
+  1721760,
+  1721770,
+  1721850,
+  1721851,
+  1721852,
+  1721853,
+  1721854,
+  1721855,
+  1721856,
+  1721857,
+  1721858,
+  1721859,
+  1721860,
+  1721861,
+  1721862,
+  1721863,
+  1721880,
+  1721900,
+  1721920,
+  1722010,
+  1722130,
+  1722280,
+  1722350,
+  1722430,
+  1722460,
+  1722480,
+  1722530,
+  1722531,
+  1722532,
+  1722533,
+  1722540,
+  1722690,
+  1722691,
+  1722692,
+  1722693,
+  1722720,
+  1722880,
+  1722900,
+  1723040,
+  1723060,
+  1723130,
+  1723310,
+  1723380,
+  1723430,
+  1723520,
+  1723521,
+  1723550,
+  1723640,
+  1723660,
+  1723810,
+  1723880,
+  1723890,
+  1723900,
+  1723901,
+  1723902,
+  1723903,
+  1723904,
+  1723905,
+  1723906,
+  1723910,
+  1723911,
+  1723912,
+  1723913,
+  1724110,
+  1724200,
+  1724230,
+  1724520,
+  1724640,
+  1724690,
+  1724710,
+  1724730,
+  1724740,
+  1724750,
+  1724751,
+  1724752,
+  1724880,
+  1724920,
+  1725140,
+  1725150,
+  1725190,
+  1725500,
+  1725501,
+  1725502,
+  1725503,
+  1725504,
+  1725505,
+  1725506,
+  1725507,
+  1725540,
+  1725541,
+  1725700,
+  1725720,
+  1725721,
+  1725730,
+  1725760,
+  1725780,
+  1725790,
+  1725920,
+  1725960,
+  1726150,
+  1726200,
+  1726230,
+  1726480,
+  1726520,
+  1726570,
+  1726670,
+  1726740,
+  1726810,
+  1726840,
+  1726920,
+  1727170,
+  1727240,
+  1727300,
+  1727320,
+  1727330,
+  1727420,
+  1727480,
+  1727630,
+  1727670,
+  1727700,
+  1727830,
+  1728030,
+  1728210,
+  1728220,
+  1728230,
+  1728240,
+  1728250,
+  1728650,
+  1728730,
+  1728820,
+  1728910,
+  1729350,
+  1729500,
+  1729550,
+  1729610,
+  1729680,
+  1729850,
+  1729890,
+  1729930,
+  1729931,
+  1729960,
+  1729970,
+  1730040,
+  1730230,
+  1730410,
+  1730420,
+  1730421,
+  1730422,
+  1730423,
+  1730424,
+  1730430,
+  1730440,
+  1730710,
+  1730711,
+  1730712,
+  1730713,
+  1730714,
+  1730715,
+  1730730,
+  1731020,
+  1731150,
+  1731160,
+  1731180,
+  1731220,
+  1731280,
+  1731300,
+  1731430,
+  1731500,
+  1731530,
+  1731600,
+  1731620,
+  1731640,
+  1731641,
+  1731642,
+  1731760,
+  1731761,
+  1731762,
+  1731763,
+  1731764,
+  1731770,
+  1731780,
+  1731810,
+  1731910,
+  1731960,
+  1731980,
+  1731990,
+  1732150,
+  1732550,
+  1732551,
+  1732552,
+  1732553,
+  1732554,
+  1732555,
+  1732556,
+  1732557,
+  1732558,
+  1732559,
+  1732570,
+  1732630,
+  1732631,
+  1732632,
+  1732633,
+  1732634,
+  1732635,
+  1732636,
+  1732637,
+  1732638,
+  1732639,
+  1732640,
+  1732670,
+  1732671,
+  1732672,
+  1732673,
+  1732674,
+  1732675,
+  1732676,
+  1732677,
+  1732678,
+  1732690,
+  1732700,
+  1732701,
+  1732702,
+  1732703,
+  1732704,
+  1732770,
+  1732771,
+  1732772,
+  1732773,
+  1732774,
+  1732775,
+  1732776,
+  1732777,
+  1732778,
+  1732779,
+  1732780,
+  1732781,
+  1732782,
+  1732783,
+  1732784,
+  1732785,
+  1732786,
+  1732787,
+  1732788,
+  1732789,
+  1732790,
+  1732791,
+  1732792,
+  1732793,
+  1732794,
+  1732795,
+  1732796,
+  1732797,
+  1732798,
+  1732810,
+  1732811,
+  1732812,
+  1732813,
+  1732814,
+  1732830,
+  1732850,
+  1732851,
+  1732852,
+  1732853,
+  1732854,
+  1732855,
+  1732856,
+  1732857,
+  1732860,
+  1732870,
+  1733210,
+  1733360,
+  1733430,
+  1733580,
+  1733670,
+  1733870,
+  1733900,
+  1734080,
+  1734090,
+  1734100,
+  1734180,
+  1734181,
+  1734182,
+  1734220,
+  1734340,
+  1734380,
+  1734440,
+  1734480,
+  1734580,
+  1734690,
+  1734720,
+  1734730,
+  1734820,
+  1735050,
+  1735250,
+  1735290,
+  1735380,
+  1735381,
+  1735480,
+  1735500,
+  1735520,
+  1735530,
+  1735680,
+  1735710,
+  1735720,
+  1735800,
+  1735890,
+  1735920,
+  1735921,
+  1736390,
+  1736640,
+  1736720,
+  1736721,
+  1736722,
+  1736723,
+  1736940,
+  1736950,
+  1736990,
+  1736991,
+  1736992,
+  1736993,
+  1736994,
+  1737141,
+  1737250,
+  1737260,
+  1737270,
+  1737350,
+  1737351,
+  1737352,
+  1737410,
+  1737540,
+  1737570,
+  1737630,
+  1737631,
+  1737632,
+  1737660,
+  1737661,
+  1737700,
+  1737770,
+  1737810,
+  1737930,
+  1738020,
+  1738180,
+  1738181,
+  1738182,
+  1738190,
+  1738200,
+  1738201,
+  1738202,
+  1738203,
+  1738204,
+  1738205,
+  1738206,
+  1738207,
+  1738208,
+  1738209,
+  1738210,
+  1738250,
+  1738350,
+  1738360,
+  1738370,
+  1738380,
+  1738390,
+  1738391,
+  1738392,
+  1738440,
+  1738510,
+  1738690,
+  1738700,
+  1738730,
+  1738770,
+  1738800,
+  1738900,
+  1738980,
+  1739020,
+  1739021,
+  1739090,
+  1739110,
+  1739120,
+  1739140,
+  1739590,
+  1739740,
+  1739780,
+  1739810,
+  1739890,
+  1739891,
+  1740030,
+  1740330,
+  1740440,
+  1740520,
+  1740560,
+  1740640,
+  1740650,
+  1740670,
+  1740750,
+  1740840,
+  1740841,
+  1740900,
+  1740980,
+  1741010,
+  1741020,
+  1741180,
+  1741190,
+  1741230,
+  1741240,
+  1741310,
+  1741330,
+  1741350,
+  1741360,
+  1741370,
+  1741380,
+  1741390,
+  1741460,
+  1741530,
+  1741540,
+  1741580,
+  1741600,
+  1741700,
+  1741750,
+  1741760,
+  1741820,
+  1741830,
+  1741840,
+  1742030,
+  1742150,
+  1742190,
+  1742220,
+  1742260,
+  1742520,
+  1742640,
+  1742650,
+  1742670,
+  1743290,
+  1743291,
+  1743840,
+  1743950,
+  1743970,
+  1743980,
+  1743990,
+  1744010,
+  1744080,
+  1744101,
+  1744102,
+  1744150,
+  1744160,
+  1744230,
+  1744260,
+  1744310,
+  1744360,
+  1744370,
+  1744410,
+  1744540,
+  1744550,
+  1744560,
+  1744600,
+  1744601,
+  1744700,
+  1744810,
+  1744811,
+  1744812,
+  1744813,
+  1744814,
+  1744815,
+  1744816,
+  1744817,
+  1744818,
+  1744819,
+  1744830,
+  1744831,
+  1744832,
+  1744833,
+  1744834,
+  1744835,
+  1744836,
+  1744870,
+  1744980,
+  1745290,
+  1745440,
+  1745460,
+  1745830,
+  1745940,
+  1745970,
+  1746000,
+  1746090,
+  1746260,
+  1746350,
+  1746470,
+  1746550,
+  1746580,
+  1746610,
+  1746690,
+  1746860,
+  1746900,
+  1746920,
+  1747100,
+  1747130,
+  1747140,
+  1747350,
+  1747380,
+  1747420,
+  1747620,
+  1747700,
+  1747710,
+  1747780,
+  1747810,
+  1747840,
+  1747960,
+  1747990,
+  1748000,
+  1748411,
+  1748440,
+  1748441,
+  1748442,
+  1748443,
+  1748444,
+  1748445,
+  1748446,
+  1748447,
+  1748448,
+  1748449,
+  1748450,
+  1748460,
+  1748461,
+  1748462,
+  1748463,
+  1748464,
+  1748465,
+  1748466,
+  1748467,
+  1748468,
+  1748469,
+  1748470,
+  1748471,
+  1748472,
+  1748473,
+  1748474,
+  1748475,
+  1748476,
+  1748477,
+  1748478,
+  1748479,
+  1748480,
+  1748481,
+  1748482,
+  1748483,
+  1748484,
+  1748485,
+  1748486,
+  1748487,
+  1748488,
+  1748489,
+  1748500,
+  1748501,
+  1748502,
+  1748503,
+  1748504,
+  1748505,
+  1748506,
+  1748507,
+  1748508,
+  1748509,
+  1748520,
+  1748521,
+  1748522,
+  1748523,
+  1748524,
+  1748525,
+  1748526,
+  1748527,
+  1748528,
+  1748529,
+  1748530,
+  1748531,
+  1748532,
+  1748533,
+  1748534,
+  1748535,
+  1748536,
+  1748537,
+  1748538,
+  1748539,
+  1748540,
+  1748541,
+  1748542,
+  1748543,
+  1748544,
+  1748545,
+  1748546,
+  1748547,
+  1748548,
+  1748549,
+  1748550,
+  1748551,
+  1748552,
+  1748553,
+  1748554,
+  1748555,
+  1748556,
+  1748557,
+  1748558,
+  1748559,
+  1748560,
+  1748561,
+  1748562,
+  1748563,
+  1748564,
+  1748565,
+  1748566,
+  1748567,
+  1748568,
+  1748569,
+  1748680,
+  1748720,
+  1748730,
+  1748780,
+  1748810,
+  1748820,
+  1748990,
+  1749000,
+  1749080,
+  1749100,
+  1749102,
+  1749103,
+  1749230,
+  1749250,
+  1749280,
+  1749281,
+  1749282,
+  1749283,
+  1749284,
+  1749550,
+  1749590,
+  1749680,
+  1749690,
+  1749820,
+  1749910,
+  1750190,
+  1750210,
+  1750390,
+  1750400,
+  1750610,
+  1750611,
+  1750612,
+  1750680,
+  1750850,
+  1750890,
+  1751010,
+  1751020,
+  1751030,
+  1751040,
+  1751050,
+  1751200,
+  1751201,
+  1751202,
+  1751203,
+  1751204,
+  1751260,
+  1751370,
+  1751430,
+  1751590,
+  1751620,
+  1751740,
+  1751750,
+  1752110,
+  1752120,
+  1752130,
+  1752160,
+  1752300,
+  1752301,
+  1752310,
+  1752311,
+  1752320,
+  1752350,
+  1752380,
+  1752450,
+  1752460,
+  1752550,
+  1752630,
+  1752670,
+  1752680,
+  1752860,
+  1752900,
+  1752910,
+  1752920,
+  1753060,
+  1753460,
+  1753470,
+  1753480,
+  1753520,
+  1753521,
+  1753522,
+  1753523,
+  1753524,
+  1753525,
+  1753526,
+  1753527,
+  1753528,
+  1753529,
+  1753560,
+  1753570,
+  1753580,
+  1753590,
+  1753600,
+  1753610,
+  1753620,
+  1753770,
+  1754190,
+  1754220,
+  1754230,
+  1754310,
+  1754370,
+  1754470,
+  1754660,
+  1754810,
+  1755000,
+  1755001,
+  1755050,
+  1755190,
+  1755200,
+  1755370,
+  1755400,
+  1755401,
+  1755402,
+  1755440,
+  1755510,
+  1755630,
+  1755631,
+  1755710,
+  1755730,
+  1755800,
+  1755900,
+  1755930,
+  1756050,
+  1756130,
+  1756270,
+  1756290,
+  1756400,
+  1756560,
+  1756590,
+  1756610,
+  1756640,
+  1756660,
+  1756670,
+  1756680,
+  1756690,
+  1756870,
+  1756890,
+  1756970,
+  1756980,
+  1756990,
+  1757080,
+  1757220,
+  1757500,
+  1757530,
+  1757540,
+  1757640,
+  1757780,
+  1757900,
+  1758130,
+  1758170,
+  1758240,
+  1758270,
+  1758500,
+  1758560,
+  1758570,
+  1758610,
+  1758720,
+  1758730,
+  1758750,
+  1758840,
+  1758841,
+  1758940,
+  1758970,
+  1759000,
+  1759020,
+  1759021,
+  1759022,
+  1759110,
+  1759140,
+  1759170,
+  1759300,
+  1759310,
+  1759370,
+  1759530,
+  1759610,
+  1759770,
+  1760000,
+  1760030,
+  1760120,
+  1760130,
+  1760280,
+  1760290,
+  1760470,
+  1760480,
+  1760490,
+  1760500,
+  1760630,
+  1760780,
+  1761020,
+  1761140,
+  1761150,
+  1761160,
+  1761180,
+  1761280,
+  1761330,
+  1761550,
+  1761570,
+  1761580,
+  1761590,
+  1761610,
+  1761710,
+  1761830,
+  1761890,
+  1762030,
+  1762080,
+  1762140,
+  1762170,
+  1762210,
+  1762430,
+  1762540,
+  1762541,
+  1762542,
+  1762543,
+  1762550,
+  1762580,
+  1762590,
+  1762640,
+  1762650,
+  1762700,
+  1762710,
+  1762770,
+  1762780,
+  1762980,
+  1763080,
+  1763310,
+  1763460,
+  1763461,
+  1763462,
+  1763500,
+  1763920,
+  1763930,
+  1764060,
+  1764061,
+  1764062,
+  1764063,
+  1764140,
+  1764150,
+  1764200,
+  1764320,
+  1764330,
+  1764350,
+  1764360,
+  1764380,
+  1764470,
+  1764620,
+  1764630,
+  1764860,
+  1765100,
+  1765190,
+  1765340,
+  1765360,
+  1765450,
+  1765490,
+  1765530,
+  1765570,
+  1765580,
+  1765590,
+  1765650,
+  1765720,
+  1765750,
+  1765751,
+  1765753,
+  1765900,
+  1766020,
+  1766021,
+  1766022,
+  1766220,
+  1766280,
+  1766600,
+  1766610,
+  1766620,
+  1766670,
+  1766730,
+  1766870,
+  1766880,
+  1766950,
+  1767030,
+  1767031,
+  1767060,
+  1767061,
+  1767070,
+  1767071,
+  1767090,
+  1767100,
+  1767110,
+  1767240,
+  1767340,
+  1767341,
+  1767420,
+  1767430,
+  1767680,
+  1767690,
+  1767691,
+  1767850,
+  1768080,
+  1768120,
+  1768130,
+  1768370,
+  1768560,
+  1768601,
+  1768610,
+  1768690,
+  1768770,
+  1768771,
+  1768840,
+  1768890,
+  1769070,
+  1769080,
+  1769110,
+  1769120,
+  1769500,
+  1769540,
+  1769600,
+  1769620,
+  1769710,
+  1769940,
+  1769970,
+  1769971,
+  1770020,
+  1770090,
+  1770130,
+  1770150,
+  1770290,
+  1770430,
+  1770450,
+  1770520,
+  1770521,
+  1770530,
+  1770560,
+  1770580,
+  1770640,
+  1770860,
+  1770940,
+  1770941,
+  1770942,
+  1771370,
+  1771470,
+  1771540,
+  1771590,
+  1771591,
+  1771592,
+  1771593,
+  1771594,
+  1771670,
+  1771680,
+  1771720,
+  1771760,
+  1771790,
+  1771820,
+  1771840,
+  1771860,
+  1771910,
+  1771920,
+  1772040,
+  1772160,
+  1772190,
+  1772200,
+  1772330,
+  1772400,
+  1772401,
+  1772402,
+  1772403,
+  1772404,
+  1772405,
+  1772420,
+  1772760,
+  1772850,
+  1773090,
+  1773100,
+  1773140,
+  1773190,
+  1773250,
+  1773260,
+  1773270,
+  1773310,
+  1773430,
+  1773800,
+  1773801,
+  1773880,
+  1773910,
+  1773920,
+  1773930,
+  1773940,
+  1773960,
+  1773980,
+  1774010,
+  1774260,
+  1774261,
+  1774262,
+  1774270,
+  1774271,
+  1774272,
+  1774273,
+  1774274,
+  1774275,
+  1774276,
+  1774277,
+  1774278,
+  1774280,
+  1774281,
+  1774282,
+  1774283,
+  1774284,
+  1774285,
+  1774286,
+  1774287,
+  1774288,
+  1774290,
+  1774291,
+  1774292,
+  1774293,
+  1774294,
+  1774295,
+  1774296,
+  1774297,
+  1774298,
+  1774300,
+  1774301,
+  1774302,
+  1774303,
+  1774304,
+  1774305,
+  1774310,
+  1774311,
+  1774312,
+  1774313,
+  1774314,
+  1774315,
+  1774316,
+  1774317,
+  1774318,
+  1774320,
+  1774321,
+  1774322,
+  1774323,
+  1774324,
+  1774325,
+  1774326,
+  1774327,
+  1774328,
+  1774330,
+  1774331,
+  1774332,
+  1774333,
+  1774334,
+  1774335,
+  1774336,
+  1774337,
+  1774338,
+  1774340,
+  1774341,
+  1774342,
+  1774343,
+  1774344,
+  1774345,
+  1774346,
+  1774347,
+  1774348,
+  1774349,
+  1774370,
+  1774470,
+  1774480,
+  1774490,
+  1774530,
+  1774660,
+  1774670,
+  1774730,
+  1774740,
+  1774850,
+  1774930,
+  1775030,
+  1775070,
+  1775090,
+  1775390,
+  1775400,
+  1775420,
+  1775480,
+  1775610,
+  1775680,
+  1775890,
+  1775900,
+  1775930,
+  1775931,
+  1775932,
+  1775933,
+  1775934,
+  1776020,
+  1776030,
+  1776180,
+  1776340,
+  1776430,
+  1776450,
+  1776630,
+  1776670,
+  1776740,
+  1776830,
+  1776850,
+  1776950,
+  1777070,
+  1777140,
+  1777240,
+  1777410,
+  1777420,
+  1777450,
+  1777520,
+  1777570,
+  1777680,
+  1777720,
+  1777810,
+  1777850,
+  1778080,
+  1778230,
+  1778240,
+  1778250,
+  1778260,
+  1778390,
+  1778400,
+  1778420,
+  1778440,
+  1778540,
+  1778570,
+  1778740,
+  1778741,
+  1778742,
+  1778743,
+  1778744,
+  1778745,
+  1778746,
+  1778747,
+  1778748,
+  1778750,
+  1778751,
+  1778752,
+  1778790,
+  1778791,
+  1778800,
+  1778810,
+  1779210,
+  1779250,
+  1779320,
+  1779350,
+  1779360,
+  1779370,
+  1779380,
+  1779390,
+  1779400,
+  1779420,
+  1779580,
+  1779600,
+  1779601,
+  1779700,
+  1779830,
+  1780030,
+  1780580,
+  1780660,
+  1780830,
+  1780890,
+  1780910,
+  1780970,
+  1781000,
+  1781070,
+  1781100,
+  1781120,
+  1781130,
+  1781320,
+  1781410,
+  1781420,
+  1781430,
+  1781440,
+  1781510,
+  1781570,
+  1781600,
+  1781660,
+  1781690,
+  1781930,
+  1782020,
+  1782060,
+  1782140,
+  1782170,
+  1782220,
+  1782240,
+  1782280,
+  1782310,
+  1782340,
+  1782360,
+  1782370,
+  1782400,
+  1782401,
+  1782402,
+  1782403,
+  1782404,
+  1782405,
+  1782406,
+  1782407,
+  1782410,
+  1782430,
+  1782431,
+  1782432,
+  1782433,
+  1782434,
+  1782435,
+  1782436,
+  1782490,
+  1782491,
+  1782492,
+  1782493,
+  1782494,
+  1782495,
+  1782496,
+  1782497,
+  1782498,
+  1782499,
+  1782500,
+  1782501,
+  1782502,
+  1782530,
+  1782531,
+  1782750,
+  1782830,
+  1783260,
+  1783290,
+  1783330,
+  1783343,
+  1783344,
+  1783345,
+  1783346,
+  1783347,
+  1783348,
+  1783400,
+  1783530,
+  1783540,
+  1783550,
+  1783570,
+  1783571,
+  1783572,
+  1783573,
+  1783574,
+  1783575,
+  1783576,
+  1783590,
+  1783640,
+  1783650,
+  1783790,
+  1783990,
+  1784010,
+  1784030,
+  1784050,
+  1784270,
+  1784280,
+  1784390,
+  1784391,
+  1784392,
+  1784393,
+  1784394,
+  1784400,
+  1784401,
+  1784402,
+  1784403,
+  1784404,
+  1784450,
+  1784451,
+  1784490,
+  1784491,
+  1784492,
+  1784493,
+  1784494,
+  1784495,
+  1784496,
+  1784497,
+  1784498,
+  1784499,
+  1784500,
+  1784510,
+  1784520,
+  1784530,
+  1784531,
+  1784532,
+  1784533,
+  1784534,
+  1784535,
+  1784536,
+  1784537,
+  1784538,
+  1784540,
+  1784620,
+  1784670,
+  1784720,
+  1784740,
+  1784770,
+  1784850,
+  1784870,
+  1784890,
+  1785070,
+  1785110,
+  1785130,
+  1785140,
+  1785170,
+  1785290,
+  1785570,
+  1785610,
+  1785620,
+  1785740,
+  1785760,
+  1785830,
+  1785840,
+  1785960,
+  1786000,
+  1786020,
+  1786040,
+  1786041,
+  1786042,
+  1786050,
+  1786090,
+  1786140,
+  1786160,
+  1786310,
+  1786380,
+  1786560,
+  1786650,
+  1786890,
+  1787090,
+  1787250,
+  1787260,
+  1787270,
+  1787330,
+  1787340,
+  1787570,
+  1787720,
+  1787750,
+  1787780,
+  1788000,
+  1788010,
+  1788080,
+  1788140,
+  1788210,
+  1788240,
+  1788250,
+  1788370,
+  1788530,
+  1788580,
+  1788610,
+  1789150,
+  1789160,
+  1789190,
+  1789200,
+  1789240,
+  1789290,
+  1789320,
+  1789400,
+  1790230,
+  1790240,
+  1790320,
+  1790430,
+  1790460,
+  1790520,
+  1790530,
+  1790540,
+  1790570,
+  1790720,
+  1790790,
+  1790910,
+  1791130,
+  1791140,
+  1791150,
+  1791170,
+  1791190,
+  1791210,
+  1791320,
+  1791330,
+  1791340,
+  1791370,
+  1791380,
+  1791470,
+  1791471,
+  1791550,
+  1791670,
+  1791690,
+  1791720,
+  1791780,
+  1791990,
+  1792090,
+  1792180,
+  1792190,
+  1792310,
+  1792320,
+  1792330,
+  1792340,
+  1792630,
+  1792910,
+  1792930,
+  1792940,
+  1792950,
+  1792980,
+  1792990,
+  1793010,
+  1793011,
+  1793012,
+  1793013,
+  1793050,
+  1793230,
+  1793460,
+  1793470,
+  1793480,
+  1793500,
+  1793540,
+  1793570,
+  1793590,
+  1793640,
+  1793770,
+  1793790,
+  1793830,
+  1793860,
+  1793870,
+  1794050,
+  1794051,
+  1794052,
+  1794053,
+  1794090,
+  1794100,
+  1794200,
+  1794410,
+  1794480,
+  1794500,
+  1794570,
+  1794630,
+  1794650,
+  1794810,
+  1794820,
+  1794910,
+  1795000,
+  1795050,
+  1795060,
+  1795320,
+  1795400,
+  1795460,
+  1795500,
+  1795650,
+  1795700,
+  1795850,
+  1795940,
+  1795990,
+  1796090,
+  1796120,
+  1796160,
+  1796290,
+  1796300,
+  1796320,
+  1796360,
+  1796400,
+  1796420,
+  1796460,
+  1796490,
+  1796760,
+  1796770,
+  1796880,
+  1796980,
+  1797050,
+  1797160,
+  1797200,
+  1797210,
+  1797220,
+  1797280,
+  1797310,
+  1797340,
+  1797350,
+  1797620,
+  1797730,
+  1797810,
+  1797860,
+  1797900,
+  1798250,
+  1798251,
+  1798360,
+  1798370,
+  1798400,
+  1798440,
+  1798450,
+  1798500,
+  1798501,
+  1798502,
+  1798503,
+  1798504,
+  1798505,
+  1798560,
+  1798680,
+  1798800,
+  1798830,
+  1798840,
+  1799070,
+  1799100,
+  1799120,
+  1799250,
+  1799330,
+  1799390,
+  1799430,
+  1799480,
+  1799510,
+  1799680,
+  1799760,
+  1799770,
+  1799780,
+  1799790,
+  1799880,
+  1799920,
+  1799921,
+  1799960,
+  1799961,
+  1800130,
+  1800150,
+  1800210,
+  1800450,
+  1800530,
+  1800710,
+  1800720,
+  1800800,
+  1800840,
+  1800870,
+  1800880,
+  1801080,
+  1801100,
+  1801120,
+  1801130,
+  1801160,
+  1801250,
+  1801280,
+  1801380,
+  1801390,
+  1801480,
+  1801510,
+  1801540,
+  1801720,
+  1801721,
+  1801722,
+  1801723,
+  1801724,
+  1801725,
+  1801726,
+  1801727,
+  1801728,
+  1801729,
+  1801730,
+  1801731,
+  1801732,
+  1801733,
+  1801734,
+  1801735,
+  1801736,
+  1801737,
+  1801738,
+  1801739,
+  1801740,
+  1801741,
+  1801742,
+  1801743,
+  1801744,
+  1801745,
+  1801746,
+  1801747,
+  1801748,
+  1801749,
+  1801750,
+  1801751,
+  1801752,
+  1801753,
+  1801754,
+  1801755,
+  1801756,
+  1801757,
+  1801758,
+  1801759,
+  1801760,
+  1801761,
+  1801762,
+  1801763,
+  1801764,
+  1801765,
+  1801766,
+  1801767,
+  1801768,
+  1801769,
+  1801770,
+  1801771,
+  1801772,
+  1801773,
+  1801774,
+  1801775,
+  1801776,
+  1801777,
+  1801778,
+  1801779,
+  1801780,
+  1801781,
+  1801782,
+  1801783,
+  1801784,
+  1801785,
+  1801786,
+  1801787,
+  1801788,
+  1801789,
+  1801790,
+  1801791,
+  1801792,
+  1801793,
+  1801794,
+  1801795,
+  1801796,
+  1801797,
+  1801798,
+  1801799,
+  1801800,
+  1801801,
+  1801802,
+  1801803,
+  1801804,
+  1801805,
+  1801806,
+  1801807,
+  1801808,
+  1801809,
+  1801810,
+  1801811,
+  1801812,
+  1801813,
+  1801814,
+  1801815,
+  1801816,
+  1801817,
+  1801818,
+  1801819,
+  1801840,
+  1801900,
+  1801910,
+  1801930,
+  1801960,
+  1801970,
+  1802030,
+  1802140,
+  1802150,
+  1802230,
+  1802260,
+  1802310,
+  1802320,
+  1802380,
+  1802450,
+  1802480,
+  1802540,
+  1802740,
+  1802760,
+  1802770,
+  1802950,
+  1802960,
+  1802970,
+  1803180,
+  1803240,
+  1803250,
+  1803260,
+  1803270,
+  1803280,
+  1803320,
+  1803520,
+  1803670,
+  1803940,
+  1804030,
+  1804160,
+  1804180,
+  1804240,
+  1804250,
+  1804460,
+  1804560,
+  1804660,
+  1804680,
+  1804690,
+  1804700,
+  1804790,
+  1804830,
+  1805010,
+  1805290,
+  1805330,
+  1805430,
+  1805440,
+  1805450,
+  1805460,
+  1805600,
+  1805850,
+  1805860,
+  1805870,
+  1805880,
+  1805890,
+  1805900,
+  1806060,
+  1806090,
+  1806140,
+  1806141,
+  1806143,
+  1806144,
+  1806145,
+  1806146,
+  1806147,
+  1806148,
+  1806149,
+  1806150,
+  1806151,
+  1806152,
+  1806153,
+  1806154,
+  1806155,
+  1806156,
+  1806157,
+  1806158,
+  1806159,
+  1806170,
+  1806180,
+  1806260,
+  1806280,
+  1806340,
+  1806550,
+  1806720,
+  1806870,
+  1806890,
+  1807010,
+  1807040,
+  1807060,
+  1807170,
+  1807620,
+  1807880,
+  1808070,
+  1808290,
+  1808430,
+  1808990,
+  1809080,
+  1809120,
+  1809121,
+  1809122,
+  1809123,
+  1809124,
+  1809125,
+  1809128,
+  1809150,
+  1809200,
+  1809210,
+  1809410,
+  1809411,
+  1809412,
+  1809413,
+  1809414,
+  1809460,
+  1809461,
+  1809462,
+  1809463,
+  1809600,
+  1809660,
+  1809670,
+  1809790,
+  1809800,
+  1809810,
+  1810010,
+  1810030,
+  1810031,
+  1810090,
+  1810100,
+  1810110,
+  1810170,
+  1810290,
+  1810370,
+  1810400,
+  1810420,
+  1810590,
+  1810690,
+  1810800,
+  1810910,
+  1811020,
+  1811030,
+  1811060,
+  1811080,
+  1811090,
+  1811210,
+  1811220,
+  1811230,
+  1811250,
+  1811530,
+  1811570,
+  1811650,
+  1811770,
+  1811790,
+  1811800,
+  1811830,
+  1811850,
+  1811930,
+  1812000,
+  1812110,
+  1812160,
+  1812310,
+  1812320,
+  1812330,
+  1812350,
+  1812360,
+  1812470,
+  1812480,
+  1812481,
+  1812482,
+  1812483,
+  1812484,
+  1812485,
+  1812486,
+  1812487,
+  1812490,
+  1812520,
+  1812530,
+  1812540,
+  1812550,
+  1812630,
+  1812750,
+  1812770,
+  1813040,
+  1813050,
+  1813080,
+  1813090,
+  1813220,
+  1813260,
+  1813450,
+  1813460,
+  1813510,
+  1813520,
+  1813580,
+  1813620,
+  1813670,
+  1813810,
+  1814040,
+  1814300,
+  1814390,
+  1814660,
+  1814680,
+  1814740,
+  1814750,
+  1814840,
+  1815040,
+  1815470,
+  1815490,
+  1815620,
+  1815930,
+  1815931,
+  1815932,
+  1815933,
+  1816100,
+  1816260,
+  1816280,
+  1816290,
+  1816310,
+  1816400,
+  1816460,
+  1816540,
+  1816580,
+  1816590,
+  1816630,
+  1816660,
+  1816661,
+  1816662,
+  1816663,
+  1816664,
+  1816665,
+  1816666,
+  1816667,
+  1816668,
+  1816669,
+  1816720,
+  1816820,
+  1816821,
+  1816840,
+  1817040,
+  1817050,
+  1817090,
+  1817160,
+  1817180,
+  1817270,
+  1817370,
+  1817390,
+  1817410,
+  1817630,
+  1817690,
+  1817751,
+  1817950,
+  1818040,
+  1818070,
+  1818160,
+  1818161,
+  1818162,
+  1818163,
+  1818164,
+  1818210,
+  1818510,
+  1818650,
+  1818850,
+  1819270,
+  1819310,
+  1819320,
+  1819330,
+  1819510,
+  1819710,
+  1819720,
+  1819730,
+  1819740,
+  1819760,
+  1819790,
+  1820010,
+  1820200,
+  1820310,
+  1820370,
+  1820490,
+  1820520,
+  1820540,
+  1820650,
+  1820670,
+  1820970,
+  1821040,
+  1821720,
+  1822100,
+  1822101,
+  1822102,
+  1822103,
+  1822104,
+  1822150,
+  1822260,
+  1822310,
+  1822330,
+  1822380,
+  1822480,
+  1822570,
+  1822730,
+  1822830,
+  1822850,
+  1822860,
+  1822870,
+  1822990,
+  1823230,
+  1823280,
+  1823440,
+  1823441,
+  1823500,
+  1823520,
+  1823521,
+  1823530,
+  1823531,
+  1823680,
+  1824030,
+  1824190,
+  1824320,
+  1824340,
+  1824400,
+  1824460,
+  1824680,
+  1824860,
+  1824870,
+  1824890,
+  1824920,
+  1826390,
+  1826580,
+  1826630,
+  1826850,
+  1826870,
+  1826871,
+  1827270,
+  1827280,
+  1827320,
+  1827330,
+  1827350,
+  1827510,
+  1827520,
+  1827750,
+  1827860,
+  1828150,
+  1828230,
+  1828250,
+  1828340,
+  1828520,
+  1828560,
+  1828620,
+  1828670,
+  1829290,
+  1829720,
+  1829860,
+  1829870,
+  1830010,
+  1830030,
+  1830090,
+  1830310,
+  1830410,
+  1830550,
+  1830750,
+  1830880,
+  1830930,
+  1831000,
+  1831210,
+  1831280,
+  1831281,
+  1831600,
+  1831840,
+  1832360,
+  1832390,
+  1832400,
+  1832410,
+  1832420,
+  1832430,
+  1832440,
+  1832450,
+  1832460,
+  1832470,
+  1832590,
+  1832710,
+  1832730,
+  1832731,
+  1832732,
+  1832733,
+  1832734,
+  1832750,
+  1832770,
+  1832840,
+  1832960,
+  1832970,
+  1833370,
+  1833410,
+  1833420,
+  1833421,
+  1833430,
+  1833440,
+  1833520,
+  1833740,
+  1833760,
+  1833940,
+  1834090,
+  1834270,
+  1834330,
+  1834410,
+  1834860,
+  1835340,
+  1835760,
+  1835761,
+  1835850,
+  1836000,
+  1836380,
+  1837360,
+  1837860,
+  1838260,
+  1838430,
+  1838920,
+  1840260,
+  1840600,
+  1840980,
+  1842460,
+  1843510,
+  2028850
+};
+
+bool
+SKIF_Steam_isIgnorableAppID (uint32_t appid)
+{
+  return
+    std::binary_search ( std::begin (steam_apps_ignorable),
+                         std::end   (steam_apps_ignorable), appid );
+}
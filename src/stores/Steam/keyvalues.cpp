@@ -0,0 +1,384 @@
+//
+// Copyright 2020 Andon "Kaldaien" Coleman
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+//
+
+#include <stores/Steam/keyvalues.h>
+#include <utility/sk_utility.h>
+#include <cstring>
+
+void
+SK_Steam_KeyValueTree::clear (void)
+{
+  _text.clear  ();
+  _nodes.clear ();
+  _first = npos;
+}
+
+static bool
+SK_Steam_KeyValueTree_Equals (std::string_view a, std::string_view b)
+{
+  return a.length () == b.length () && _strnicmp (a.data (), b.data (), a.length ()) == 0;
+}
+
+bool
+SK_Steam_KeyValueTree::parse (std::string text)
+{
+  return parse (std::move (text), { });
+}
+
+bool
+SK_Steam_KeyValueTree::parse (std::string text, const std::vector <path_t>& wanted)
+{
+  clear ();
+
+  if (text.size () >= npos)
+    return false;
+
+  _text = std::move (text);
+
+  // Manifests hold a few dozen nodes at most, this avoids most reallocations
+  _nodes.reserve (64);
+
+  enum class keep_e {
+    None,     // Skipped
+    Ancestor, // Leads up to something wanted, but is not wanted itself
+    Inside    // Wanted
+  };
+
+  struct level_s {
+    uint32_t section;    // npos for the top level
+    uint32_t last_child;
+    keep_e   keep;
+  };
+
+  std::vector <level_s> levels = { { npos, npos, (wanted.empty ()) ? keep_e::Inside : keep_e::Ancestor } };
+
+  // Names of the sections currently kept, from the top level down
+  std::vector <std::string_view> path;
+
+  // Depth within a section that is being skipped over
+  uint32_t skip_depth     = 0;
+
+  uint32_t pending_offset = 0,
+           pending_length = 0;
+  bool     pending        = false; // A key is waiting for its value or section
+
+  // Whether the key at the current level is wanted, leads up to something wanted, or neither
+  auto _Classify = [&](std::string_view name) -> keep_e
+  {
+    if (levels.back ().keep == keep_e::Inside)
+      return keep_e::Inside;
+
+    keep_e       keep  = keep_e::None;
+    const size_t depth = path.size () + 1;
+
+    for (auto& want : wanted)
+    {
+      bool match = true;
+
+      for (size_t i = 0; i < depth && i < want.size () && match; i++)
+      {
+        std::string_view part = (i < path.size ()) ? path [i] : name;
+
+        match = (want [i] == "*" || SK_Steam_KeyValueTree_Equals (part, want [i]));
+      }
+
+      if (! match)
+        continue;
+
+      if (depth >= want.size ())
+        return keep_e::Inside;
+
+      keep = keep_e::Ancestor;
+    }
+
+    return keep;
+  };
+
+  auto _Append = [&](node_s&& node) -> uint32_t
+  {
+    uint32_t idx   = static_cast <uint32_t> (_nodes.size ());
+    auto&    level = levels.back ();
+
+    _nodes.emplace_back (node);
+
+    if (level.last_child != npos)
+      _nodes [level.last_child].next_sibling = idx;
+    else if (level.section != npos)
+      _nodes [level.section].first_child     = idx;
+    else
+      _first                                 = idx;
+
+    level.last_child = idx;
+
+    return idx;
+  };
+
+  const char*  data = _text.data ();
+  const size_t size = _text.size ();
+  bool         ok   = true;
+
+  for (size_t pos = 0; pos < size && ok; )
+  {
+    const char c = data [pos];
+
+    if (c == ' ' || c == '\t' || c == '\r' || c == '\n' || c == '\0')
+    {
+      ++pos;
+      continue;
+    }
+
+    // Comments
+    if (c == '/' && pos + 1 < size && data [pos + 1] == '/')
+    {
+      while (pos < size && data [pos] != '\n')
+        ++pos;
+      continue;
+    }
+
+    if (c == '{')
+    {
+      if (! pending)
+      {
+        ok = false;
+        break;
+      }
+
+      pending = false;
+      ++pos;
+
+      std::string_view name (data + pending_offset, pending_length);
+      keep_e           keep = (skip_depth > 0) ? keep_e::None : _Classify (name);
+
+      if (keep == keep_e::None)
+      {
+        skip_depth++;
+        continue;
+      }
+
+      node_s   section;
+      section.key_offset = pending_offset;
+      section.key_length = pending_length;
+      section.section    = true;
+
+      levels.push_back ({ _Append (std::move (section)), npos, keep });
+      path.push_back   (name);
+      continue;
+    }
+
+    if (c == '}')
+    {
+      // Unbalanced, or a key without a value right before the end of the section
+      if ((levels.size () == 1 && skip_depth == 0) || pending)
+      {
+        ok = false;
+        break;
+      }
+
+      if (skip_depth > 0)
+        skip_depth--;
+
+      else
+      {
+        levels.pop_back ();
+        path.pop_back   ();
+      }
+
+      ++pos;
+      continue;
+    }
+
+    // Conditionals, e.g. [$WIN32], are not used by Steam's own files
+    if (c == '[')
+    {
+      while (pos < size && data [pos] != ']')
+        ++pos;
+      ++pos;
+      continue;
+    }
+
+    uint32_t token_offset = 0,
+             token_length = 0;
+
+    if (c == '"')
+    {
+      size_t end     = ++pos;
+      bool   escaped = false;
+
+      while (end < size && data [end] != '"')
+      {
+        if (data [end] == '\\' && end + 1 < size)
+        {
+          escaped = true;
+          end    += 2;
+        }
+
+        else
+          end++;
+      }
+
+      if (end >= size)
+      {
+        ok = false;
+        break;
+      }
+
+      token_offset = static_cast <uint32_t> (pos);
+      token_length = static_cast <uint32_t> (end - pos);
+
+      // \" and \\ are resolved in place, as the result is never longer; other escapes are kept as-is
+      if (escaped)
+      {
+        char* out = _text.data () + pos;
+
+        for (size_t i = pos; i < end; )
+        {
+          if (data [i] == '\\' && i + 1 < end && (data [i + 1] == '"' || data [i + 1] == '\\'))
+          {
+            *out++ = data [i + 1];
+            i     += 2;
+          }
+
+          else
+            *out++ = data [i++];
+        }
+
+        token_length = static_cast <uint32_t> (out - (_text.data () + pos));
+      }
+
+      pos = end + 1;
+    }
+
+    // Unquoted token
+    else
+    {
+      size_t end = pos;
+
+      while (end < size && data [end] != ' '  && data [end] != '\t' && data [end] != '\r' &&
+                           data [end] != '\n' && data [end] != '"'  && data [end] != '{'  && data [end] != '}')
+        ++end;
+
+      token_offset = static_cast <uint32_t> (pos);
+      token_length = static_cast <uint32_t> (end - pos);
+      pos          = end;
+    }
+
+    if (! pending)
+    {
+      pending_offset = token_offset;
+      pending_length = token_length;
+      pending        = true;
+    }
+
+    else
+    {
+      if (skip_depth == 0 && _Classify ({ data + pending_offset, pending_length }) == keep_e::Inside)
+      {
+        node_s   kv;
+        kv.key_offset   = pending_offset;
+        kv.key_length   = pending_length;
+        kv.value_offset = token_offset;
+        kv.value_length = token_length;
+
+        _Append (std::move (kv));
+      }
+
+      pending = false;
+    }
+  }
+
+  if (! ok || levels.size () != 1 || skip_depth != 0)
+  {
+    PLOG_ERROR << "Corrupt KeyValues data detected!";
+    clear ();
+    return false;
+  }
+
+  // Copy out the text of what was kept
+  if (! wanted.empty ())
+  {
+    std::string kept;
+
+    for (auto& node : _nodes)
+    {
+      std::string_view k = { _text.data () + node.key_offset,   node.key_length   },
+                       v = { _text.data () + node.value_offset, node.value_length };
+
+      node.key_offset   = static_cast <uint32_t> (kept.size ()); kept.append (k);
+      node.value_offset = static_cast <uint32_t> (kept.size ()); kept.append (v);
+    }
+
+    _text.swap (kept);
+  }
+
+  return true;
+}
+
+uint32_t
+SK_Steam_KeyValueTree::findChild (uint32_t parent, std::string_view name) const
+{
+  for (uint32_t node  = firstChild (parent);
+                node != npos;
+                node  = nextSibling (node))
+  {
+    std::string_view k = key (node);
+
+    if (k.length () == name.length () && _strnicmp (k.data (), name.data (), k.length ()) == 0)
+      return node;
+  }
+
+  return npos;
+}
+
+uint32_t
+SK_Steam_KeyValueTree::findSection (std::initializer_list <std::string_view> path) const
+{
+  uint32_t node = npos;
+
+  for (auto& part : path)
+  {
+    node = findChild (node, part);
+
+    if (node == npos || ! isSection (node))
+      return npos;
+  }
+
+  return node;
+}
+
+std::string_view
+SK_Steam_KeyValueTree::getValue (std::initializer_list <std::string_view> path, std::string_view name) const
+{
+  if (empty ())
+    return { };
+
+  uint32_t section = findSection (path);
+
+  if (section == npos && path.size () != 0)
+    return { };
+
+  uint32_t node = findChild (section, name);
+
+  if (node == npos || isSection (node))
+    return { };
+
+  return value (node);
+}
@@ -24,12 +24,13 @@
 #include <utility/registry.h>
 #include <utility/utility.h>
 #include <stores/Steam/apps_ignore.h>
-#include <vdf_parser.hpp>
 #include <utility/fsutil.h>
 #include <stores/Steam/vdf.h>
+#include <stores/generic_library2.h>
 
 #include <fstream>
 #include <filesystem>
+#include <future>
 #include <regex>
 #include <utility/injection.h>
 #include <nlohmann/json.hpp>
@@ -54,7 +55,7 @@ CRITICAL_SECTION VFSManifestSection;
 // Thread safety is backed by the VFSManifestSection critical section
 struct {
   int                 frame_last_scanned = 0; // 0 == not initialized nor scanned
-  SKIF_DirectoryWatch watch;
+  SKIF_DirectoryChangeWatch watch;
   SK_VirtualFS        manifest_vfs;
   DWORD               signaled = 0;
   int                 count    = 0;
@@ -62,19 +63,6 @@ struct {
   UINT_PTR            timer;
 } static steam_libraries[MAX_STEAM_LIBRARIES];
 
-// Helper function used to perform a case insensitive search of tyti::vdf::objects
-static std::shared_ptr <tyti::vdf::object>
-SKIF_VDF_ciSearch (const std::string value, const std::unordered_map <std::string, std::shared_ptr<tyti::vdf::object>>* map)
-{
-  for (auto& child : *map)
-  {
-    if (lstrcmpiA (child.first.c_str(), value.c_str()) == 0)
-      return child.second;
-  }
-
-  return nullptr;
-}
-
 int
 SK_VFS_ScanTree ( SK_VirtualFS::vfsNode* pVFSRoot,
                                 wchar_t* wszDir,
@@ -150,25 +138,65 @@ SK_VFS_ScanTree ( SK_VirtualFS::vfsNode* pVFSRoot,
   return found;
 }
 
-std::string
-SK_GetManifestContentsForAppID (app_record_s *app)
+// Reads and parses a single text KeyValues file (appmanifest_<appid>.acf, localconfig.vdf, etc.),
+//   optionally only keeping the wanted paths, see SK_Steam_KeyValueTree::parse
+static bool
+SK_Steam_ReadKeyValues (const wchar_t* wszManifestFullPath, SK_Steam_KeyValueTree& manifest, const std::vector <SK_Steam_KeyValueTree::path_t>& wanted = { })
 {
-  //PLOG_VERBOSE << "Steam AppID: " << appid;
+  // When opening an existing file, the CreateFile function performs the following actions:
+  // [...] and ignores any file attributes (FILE_ATTRIBUTE_*) specified by dwFlagsAndAttributes.
+  CHandle hManifest (
+    CreateFileW ( wszManifestFullPath,
+                    GENERIC_READ,
+                      FILE_SHARE_READ | FILE_SHARE_WRITE,
+                        nullptr,        OPEN_EXISTING,
+                          FILE_ATTRIBUTE_NORMAL | FILE_FLAG_SEQUENTIAL_SCAN,
+                            nullptr ) );
+
+  if (hManifest == INVALID_HANDLE_VALUE)
+    return false;
 
-  static AppId_t     manifest_id = 0;
-  static std::string manifest;
-  
-  if (! app->steam.manifest_data.empty())
-    return app->steam.manifest_data;
+  DWORD dwSizeHigh = 0,
+        dwRead     = 0,
+        dwSize     =
+    GetFileSize (hManifest, &dwSizeHigh);
+
+  if (dwSize == INVALID_FILE_SIZE || dwSizeHigh != 0)
+    return false;
 
-  if (manifest_id == app->id && (! manifest.empty ()))
-    return manifest;
+  std::string manifest_data (dwSize, '\0');
+
+  const bool bRead =
+    ReadFile ( hManifest,
+                  manifest_data.data (),
+                    dwSize,
+                  &dwRead,
+                      nullptr );
+
+  if (! bRead || ! dwRead)
+    return false;
+
+  manifest_data.resize (dwRead);
+
+  return
+    manifest.parse (std::move (manifest_data), wanted);
+}
+
+const SK_Steam_KeyValueTree&
+SK_GetManifestForAppID (app_record_s *app)
+{
+  //PLOG_VERBOSE << "Steam AppID: " << appid;
+
+  // The manifest is read and parsed once per app record; the path is set
+  //   on the first attempt, and is "<InvalidPath>" if it failed
+  if (! app->steam.manifest_path.empty())
+    return app->details->manifest;
 
   steam_library_t* steam_lib_paths = nullptr;
   int              steam_libs      = SK_Steam_GetLibraries (&steam_lib_paths);
 
   if (! steam_lib_paths)
-    return "";
+    return app->details->manifest;
 
   if (steam_libs != 0)
   {
@@ -213,60 +241,17 @@ SK_GetManifestContentsForAppID (app_record_s *app)
 
     LeaveCriticalSection (&VFSManifestSection);
 
-    // When opening an existing file, the CreateFile function performs the following actions:
-    // [...] and ignores any file attributes (FILE_ATTRIBUTE_*) specified by dwFlagsAndAttributes.
-    CHandle hManifest (
-      CreateFileW ( wszManifestFullPath,
-                      GENERIC_READ,
-                        FILE_SHARE_READ | FILE_SHARE_WRITE,
-                          nullptr,        OPEN_EXISTING,
-                            FILE_ATTRIBUTE_NORMAL, // GetFileAttributesW (wszManifestFullPath)
-                              nullptr ) );
-
-    if (hManifest != INVALID_HANDLE_VALUE)
+    if (found && SK_Steam_ReadKeyValues (wszManifestFullPath, app->details->manifest))
     {
-      //PLOG_VERBOSE << "Reading " << wszManifest;
-
-      DWORD dwSizeHigh = 0,
-            dwRead     = 0,
-            dwSize     =
-        GetFileSize (hManifest, &dwSizeHigh);
-
-      auto szManifestData =
-        std::make_unique <char []> (
-          std::size_t (dwSize) + std::size_t (1)
-        );
-      auto manifest_data =
-        szManifestData.get ();
-
-      if (! manifest_data)
-        return "";
-
-      const bool bRead =
-        ReadFile ( hManifest,
-                      manifest_data,
-                        dwSize,
-                      &dwRead,
-                          nullptr );
-
-      if (bRead && dwRead)
-      {
-        manifest =
-          std::move (manifest_data);
-
-        manifest_id = app->id;
-
-        app->steam.manifest_data = manifest;
-        app->steam.manifest_path = wszManifestFullPath;
-        return app->steam.manifest_data;
-      }
+      app->steam.manifest_path = wszManifestFullPath;
+      return app->details->manifest;
     }
   }
 
-  app->steam.manifest_data =  "<InvalidData>";
+  app->details->manifest.clear ();
   app->steam.manifest_path = L"<InvalidPath>";
 
-  return "";
+  return app->details->manifest;
 }
 
 
@@ -489,20 +474,26 @@ SK_Steam_GetLibraries (steam_library_t** ppLibraries)
         {
           data [dwSize] = '\0';
 
+          SK_Steam_KeyValueTree library_folders;
+          library_folders.parse (std::string (data, dwRead));
+
           for (int i = 1; i < MAX_STEAM_LIBRARIES - 1; i++)
           {
+            const std::string idx =
+              std::to_string (i);
+
             // Old libraryfolders.vdf format
             std::wstring lib_path =
-              SK_Steam_KeyValues::getValueAsUTF16 (
-                data, { "LibraryFolders" }, std::to_string (i)
+              SK_UTF8ToWideChar (
+                std::string (library_folders.getValue ({ "LibraryFolders" }, idx))
               );
 
             if (lib_path.empty ())
             {
               // New (July 2021) libraryfolders.vdf format
               lib_path =
-                SK_Steam_KeyValues::getValueAsUTF16 (
-                  data, { "LibraryFolders", std::to_string (i) }, "path"
+                SK_UTF8ToWideChar (
+                  std::string (library_folders.getValue ({ "LibraryFolders", idx }, "path"))
                 );
             }
 
@@ -544,18 +535,16 @@ SK_UseManifestToGetAppName (app_record_s *app)
 {
   //PLOG_VERBOSE << "Steam AppID: " << appid;
 
-  if (app->steam.manifest_data.empty())
-      app->steam.manifest_data =
-        SK_GetManifestContentsForAppID (app);
+  const auto& manifest =
+    SK_GetManifestForAppID (app);
 
-  if (! app->steam.manifest_data.empty ())
+  if (! manifest.empty ())
   {
     //PLOG_VERBOSE << "Parsing manifest for AppID: " << app->id;
 
-    std::string app_name =
-      SK_Steam_KeyValues::getValue (
-        app->steam.manifest_data, { "AppState" }, "name"
-      );
+    std::string app_name (
+      manifest.getValue ({ "AppState" }, "name")
+    );
 
     if (! app_name.empty ())
     {
@@ -569,16 +558,14 @@ SK_UseManifestToGetAppName (app_record_s *app)
 std::string
 SK_UseManifestToGetCurrentBranch (app_record_s *app)
 {
-  if (app->steam.manifest_data.empty())
-      app->steam.manifest_data =
-        SK_GetManifestContentsForAppID (app);
+  const auto& manifest =
+    SK_GetManifestForAppID (app);
 
-  if (! app->steam.manifest_data.empty ())
+  if (! manifest.empty ())
   {
-    std::string branch =
-      SK_Steam_KeyValues::getValue (
-        app->steam.manifest_data, { "AppState", "UserConfig" }, "BetaKey"
-      );
+    std::string branch (
+      manifest.getValue ({ "AppState", "UserConfig" }, "BetaKey")
+    );
 
     if (! branch.empty ())
     {
@@ -596,63 +583,23 @@ SKIF_Steam_GetLaunchOptions (AppId_t appid, SteamId3_t userid , app_record_s *ap
   app->steam.local.launch_option.clear();
   app->steam.local.launch_option_parsed.clear();
 
-  // Implementation using the ValveFileVDF project
-  std::ifstream file (SKIF_Steam_GetUserConfigStorePath (userid, ConfigStore_UserLocal));
+  // LaunchOptions is tracked at "UserLocalConfigStore" -> "Software" -> "valve" -> "Steam" -> "apps" -> "<app-id>" -> "LaunchOptions"
+  const std::string     app_id = std::to_string (appid);
+  SK_Steam_KeyValueTree user_localconfig;
 
-  if (file.is_open())
+  if (SK_Steam_ReadKeyValues (SK_UTF8ToWideChar (SKIF_Steam_GetUserConfigStorePath (userid, ConfigStore_UserLocal)).c_str(), user_localconfig, {
+        { "UserLocalConfigStore", "Software", "Valve", "Steam", "Apps", app_id, "LaunchOptions" }
+      }))
   {
-    try
-    {
-      auto user_localconfig = tyti::vdf::read(file);
-      file.close();
-
-      if (user_localconfig.childs.size() > 0)
-      {
-        // LaunchOptions is tracked at "UserLocalConfigStore" -> "Software" -> "valve" -> "Steam" -> "apps" -> "<app-id>" -> "LaunchOptions"
-        
-        std::shared_ptr <tyti::vdf::object>
-                                         apps_localconfig = SKIF_VDF_ciSearch ("Software", &user_localconfig.childs);
-        if (apps_localconfig != nullptr) apps_localconfig = SKIF_VDF_ciSearch ("Valve",    &apps_localconfig->childs);
-        if (apps_localconfig != nullptr) apps_localconfig = SKIF_VDF_ciSearch ("Steam",    &apps_localconfig->childs);
-        if (apps_localconfig != nullptr) apps_localconfig = SKIF_VDF_ciSearch ("Apps",     &apps_localconfig->childs);
-
-        /* case sensitive -- cannot be used
-        auto& apps_localconfig =
-          user_localconfig.
-            childs.at("Software") ->
-              childs.at("valve")  ->
-                childs.at("Steam")->
-                  childs.at("apps");
-        */
-
-        if (apps_localconfig != nullptr &&
-            apps_localconfig->childs.size() > 0)
-        {
-          auto lc_app = apps_localconfig->childs.find(std::to_string(appid));
-          if (lc_app != apps_localconfig->childs.end())
-          {
-            auto& attribs = lc_app->second->attribs;
-
-            if (! attribs.empty() && attribs.count("LaunchOptions") > 0)
-            {
-              // Also updates the copy
-              if (app != nullptr)
-                app->steam.local.launch_option = attribs.at("LaunchOptions");
+    std::string launch_option (
+      user_localconfig.getValue ({ "UserLocalConfigStore", "Software", "Valve", "Steam", "Apps", app_id }, "LaunchOptions")
+    );
 
-              return attribs.at("LaunchOptions");
-            }
-          }
-        }
-      }
-    }
+    // Also updates the copy
+    if (app != nullptr)
+      app->steam.local.launch_option = launch_option;
 
-    // I don't expect this to throw any std::out_of_range exceptions any more
-    //   but one can never be too sure when it comes to data structures like these.
-    //     - Aemony
-    catch (const std::exception& e)
-    {
-      UNREFERENCED_PARAMETER(e);
-    }
+    return launch_option;
   }
 
   return "";
@@ -683,100 +630,71 @@ SKIF_Steam_PreloadUserLocalConfig (SteamId3_t userid, std::vector <std::pair < s
 
   PLOG_INFO << "Preloading Steam user local config...";
 
-  // Implementation using the ValveFileVDF project
-  std::ifstream file (SKIF_Steam_GetUserConfigStorePath (userid, ConfigStore_UserLocal));
+  // The file often spans several megabytes (friends, broadcasts, playtime, etc.), so only the parts used here are kept:
+  // - LaunchOptions are tracked at "UserLocalConfigStore" -> "Software" -> "valve" -> "Steam" -> "apps" -> "<app-id>" -> "LaunchOptions"
+  // - AppTickets are tracked at "UserLocalConfigStore" -> "apptickets" -> "<app-id>"
+  SK_Steam_KeyValueTree user_localconfig;
 
-  if (file.is_open())
+  if (! SK_Steam_ReadKeyValues (SK_UTF8ToWideChar (SKIF_Steam_GetUserConfigStorePath (userid, ConfigStore_UserLocal)).c_str(), user_localconfig, {
+          { "UserLocalConfigStore", "Software", "Valve", "Steam", "Apps", "*", "LaunchOptions" },
+          { "UserLocalConfigStore", "apptickets" }
+        }))
   {
-    try
-    {
-      auto user_localconfig = tyti::vdf::read(file);
-      file.close();
+    PLOG_ERROR << "Unknown error occurred when trying to parse localconfig.vdf";
+    return false;
+  }
 
-      if (user_localconfig.childs.size() > 0)
-      {
-        // Preload LaunchOptions...
-        // LaunchOptions are tracked at "UserLocalConfigStore" -> "Software" -> "valve" -> "Steam" -> "apps" -> "<app-id>" -> "LaunchOptions"
-        
-        std::shared_ptr <tyti::vdf::object>
-                                         apps_localconfig = SKIF_VDF_ciSearch ("Software", &user_localconfig.childs);
-        if (apps_localconfig != nullptr) apps_localconfig = SKIF_VDF_ciSearch ("Valve",    &apps_localconfig->childs);
-        if (apps_localconfig != nullptr) apps_localconfig = SKIF_VDF_ciSearch ("Steam",    &apps_localconfig->childs);
-        if (apps_localconfig != nullptr) apps_localconfig = SKIF_VDF_ciSearch ("Apps",     &apps_localconfig->childs);
-      //if (apps_localconfig != nullptr) PLOG_VERBOSE << "Found a match!";
-
-        /* case sensitive -- cannot be used
-        auto& apps_localconfig =
-          user_localconfig.
-            childs.at("Software") ->
-              childs.at("valve")  ->
-                childs.at("Steam")->
-                  childs.at("apps");
-        */
-
-        if (apps_localconfig != nullptr &&
-            apps_localconfig->childs.size() > 0)
-        {
-          for (auto& app : *apps)
-          {
-            if (app.second.store != app_record_s::Store::Steam)
-              continue;
+  // Preload LaunchOptions...
+  uint32_t apps_localconfig =
+    user_localconfig.findSection ({ "UserLocalConfigStore", "Software", "Valve", "Steam", "Apps" });
 
-            auto lc_app = apps_localconfig->childs.find(std::to_string(app.second.id));
-            if (lc_app != apps_localconfig->childs.end())
-            {
-              auto& attribs = lc_app->second->attribs;
+  if (apps_localconfig != SK_Steam_KeyValueTree::npos)
+  {
+    // Indexed once, instead of looking up every app among all of its siblings
+    std::unordered_map <std::string_view, uint32_t> lc_apps;
 
-              if (! attribs.empty() && attribs.count("LaunchOptions") > 0)
-                app.second.steam.local.launch_option = attribs.at("LaunchOptions");
-            }
-          }
-        }
+    for (uint32_t node  = user_localconfig.firstChild (apps_localconfig);
+                  node != SK_Steam_KeyValueTree::npos;
+                  node  = user_localconfig.nextSibling (node))
+    {
+      if (user_localconfig.isSection (node))
+        lc_apps.emplace (user_localconfig.key (node), node);
+    }
 
-        // Preload DLC ownership...
-        // 
-        // AppTickets are tracked at "UserLocalConfigStore" -> "apptickets" -> "<app-id>"
-        // This is used to determine if a DLC related launch option should be visible
-        std::shared_ptr <tyti::vdf::object>
-          apptickets_localconfig =
-            SKIF_VDF_ciSearch ("apptickets", &user_localconfig.childs);
-            //user_localconfig.childs.at("apptickets"); // case sensitive -- cannot be used
-
-        if (apptickets_localconfig != nullptr &&
-            apptickets_localconfig->attribs.size() > 0)
-        {
-          // Naively assume an app ticket indicates ownership
-          for (auto& child : apptickets_localconfig->attribs)
-          {
-            if (! child.first.empty())
-            {
-              try {
-                apptickets->emplace (child.first);
-              } 
-              catch (const std::exception& e)
-              {
-                UNREFERENCED_PARAMETER(e);
-              }
-            }
-          }
-        }
+    for (auto& app : *apps)
+    {
+      if (app.second.store != app_record_s::Store::Steam)
+        continue;
+
+      auto lc_app = lc_apps.find (std::to_string (app.second.id));
+      if (lc_app != lc_apps.end())
+      {
+        uint32_t launch_option = user_localconfig.findChild (lc_app->second, "LaunchOptions");
 
-        return true;
+        if (launch_option != SK_Steam_KeyValueTree::npos && ! user_localconfig.isSection (launch_option))
+          app.second.steam.local.launch_option = user_localconfig.value (launch_option);
       }
     }
+  }
 
-    // I don't expect this to throw any std::out_of_range exceptions any more
-    //   but one can never be too sure when it comes to data structures like these.
-    //     - Aemony
-    catch (const std::exception& e)
-    {
-      UNREFERENCED_PARAMETER(e);
+  // Preload DLC ownership...
+  // This is used to determine if a DLC related launch option should be visible
+  uint32_t apptickets_localconfig =
+    user_localconfig.findSection ({ "UserLocalConfigStore", "apptickets" });
 
-      PLOG_ERROR << "Unknown error occurred when trying to parse localconfig.vdf";
+  if (apptickets_localconfig != SK_Steam_KeyValueTree::npos)
+  {
+    // Naively assume an app ticket indicates ownership
+    for (uint32_t node  = user_localconfig.firstChild (apptickets_localconfig);
+                  node != SK_Steam_KeyValueTree::npos;
+                  node  = user_localconfig.nextSibling (node))
+    {
+      if (! user_localconfig.isSection (node) && ! user_localconfig.key (node).empty())
+        apptickets->emplace (user_localconfig.key (node));
     }
   }
 
-  return false;
+  return true;
 }
 
 bool
@@ -801,82 +719,67 @@ SKIF_Steam_PreloadUserSharedConfig (SteamId3_t userid, std::vector <std::pair <
 
   PLOG_INFO << "Preloading Steam user roaming config...";
 
-  // Implementation using the ValveFileVDF project
-  std::ifstream file (SKIF_Steam_GetUserConfigStorePath (userid, ConfigStore_UserRoaming));
+  // Only the hidden and favorite states are kept:
+  // - "UserRoamingConfigStore" -> "Software" -> "valve" -> "Steam" -> "apps" -> "<app-id>" -> "hidden" == 1
+  // - "UserRoamingConfigStore" -> "Software" -> "valve" -> "Steam" -> "apps" -> "<app-id>" -> "tags" -> "<order>" == "favorite"
+  SK_Steam_KeyValueTree vdfConfig;
 
-  if (file.is_open())
+  if (! SK_Steam_ReadKeyValues (SK_UTF8ToWideChar (SKIF_Steam_GetUserConfigStorePath (userid, ConfigStore_UserRoaming)).c_str(), vdfConfig, {
+          { "UserRoamingConfigStore", "Software", "Valve", "Steam", "Apps", "*", "hidden" },
+          { "UserRoamingConfigStore", "Software", "Valve", "Steam", "Apps", "*", "tags"   }
+        }))
   {
-    try
+    PLOG_ERROR << "Unknown error occurred when trying to parse sharedconfig.vdf";
+    return false;
+  }
+
+  uint32_t vdfConfigAppsTree =
+    vdfConfig.findSection ({ "UserRoamingConfigStore", "Software", "Valve", "Steam", "Apps" });
+
+  if (vdfConfigAppsTree != SK_Steam_KeyValueTree::npos)
+  {
+    std::unordered_map <std::string_view, uint32_t> conf_apps;
+
+    for (uint32_t node  = vdfConfig.firstChild (vdfConfigAppsTree);
+                  node != SK_Steam_KeyValueTree::npos;
+                  node  = vdfConfig.nextSibling (node))
     {
-      auto vdfConfig = tyti::vdf::read(file);
-      file.close();
+      if (vdfConfig.isSection (node))
+        conf_apps.emplace (vdfConfig.key (node), node);
+    }
+
+    for (auto& app : *apps)
+    {
+      if (app.second.store != app_record_s::Store::Steam)
+        continue;
 
-      if (vdfConfig.childs.size() > 0)
+      auto conf_app  = conf_apps.find (std::to_string (app.second.id));
+      if ( conf_app != conf_apps.end())
       {
-        std::shared_ptr <tyti::vdf::object>
-                                          vdfConfigAppsTree  = SKIF_VDF_ciSearch ("Software", &vdfConfig.childs);
-        if (vdfConfigAppsTree != nullptr) vdfConfigAppsTree  = SKIF_VDF_ciSearch ("Valve",    &vdfConfigAppsTree->childs);
-        if (vdfConfigAppsTree != nullptr) vdfConfigAppsTree  = SKIF_VDF_ciSearch ("Steam",    &vdfConfigAppsTree->childs);
-        if (vdfConfigAppsTree != nullptr) vdfConfigAppsTree  = SKIF_VDF_ciSearch ("Apps",     &vdfConfigAppsTree->childs);
-      //if (vdfConfigAppsTree != nullptr) PLOG_VERBOSE << "Found a match!";
-
-        /* case sensitive -- cannot be used
-        auto& vdfConfigAppsTree =
-          vdfConfig. // UserRoamingConfigStore
-            childs.at("Software") ->
-              childs.at("Valve")  ->
-                childs.at("Steam")->
-                  childs.at("apps");
-        */
-
-        if (vdfConfigAppsTree != nullptr &&
-            vdfConfigAppsTree->childs.size() > 0)
+        // Load hidden state...
+        uint32_t hidden = vdfConfig.findChild (conf_app->second, "hidden");
+
+        if (hidden != SK_Steam_KeyValueTree::npos && ! vdfConfig.isSection (hidden) && vdfConfig.value (hidden) == "1")
+          app.second.steam.shared.hidden     = 1;
+
+        // Load favorite state...
+        uint32_t tags = vdfConfig.findChild (conf_app->second, "tags");
+
+        if (tags != SK_Steam_KeyValueTree::npos && vdfConfig.isSection (tags))
         {
-          for (auto& app : *apps)
+          for (uint32_t tag  = vdfConfig.firstChild (tags);
+                        tag != SK_Steam_KeyValueTree::npos;
+                        tag  = vdfConfig.nextSibling (tag))
           {
-            if (app.second.store != app_record_s::Store::Steam)
-              continue;
-
-            auto conf_app  = vdfConfigAppsTree->childs.find(std::to_string(app.second.id));
-            if ( conf_app != vdfConfigAppsTree->childs.end())
-            {
-              // Load hidden state...
-              // "UserRoamingConfigStore" -> "Software" -> "valve" -> "Steam" -> "apps" -> "<app-id>" -> "hidden" == 1
-              auto& attribs = conf_app->second->attribs;
-              if (! attribs.empty() && attribs.count("hidden") > 0 && attribs.at("hidden") == "1")
-                app.second.steam.shared.hidden     = 1;
-
-              // Load favorite state...
-              // "UserRoamingConfigStore" -> "Software" -> "valve" -> "Steam" -> "apps" -> "<app-id>" -> "tags" -> "<order>" == "favorite"
-              if (! conf_app->second->childs.empty() && conf_app->second->childs.count("tags") > 0)
-              {
-                auto& tags = conf_app->second->childs.at("tags");
-                for (auto& child : tags->attribs)
-                {
-                  if (! child.first.empty() && child.second == "favorite")
-                    app.second.steam.shared.favorite = 1;
-                }
-              }
-            }
+            if (! vdfConfig.isSection (tag) && ! vdfConfig.key (tag).empty() && vdfConfig.value (tag) == "favorite")
+              app.second.steam.shared.favorite = 1;
           }
         }
-
-        return true;
       }
     }
-
-    // I don't expect this to throw any std::out_of_range exceptions any more
-    //   but one can never be too sure when it comes to data structures like these.
-    //     - Aemony
-    catch (const std::exception& e)
-    {
-      UNREFERENCED_PARAMETER(e);
-
-      PLOG_ERROR << "Unknown error occurred when trying to parse sharedconfig.vdf";
-    }
   }
 
-  return false;
+  return true;
 }
 
 void
@@ -889,59 +792,24 @@ SKIF_Steam_PreloadUserConfig (SteamId3_t userid, std::vector<std::pair<std::stri
 bool
 SKIF_Steam_isSteamOverlayEnabled (AppId_t appid, SteamId3_t userid)
 {
-  std::ifstream file (SKIF_Steam_GetUserConfigStorePath (userid, ConfigStore_UserLocal));
-
-  if (file.is_open())
+  // There are two relevant here:
+  // - Global state is tracked at "UserLocalConfigStore" -> "system" -> "EnableGameOverlay"
+  // - Game-specific state is tracked at "UserLocalConfigStore" -> "apps" -> "<app-id>" -> "OverlayAppEnable"
+  const std::string     app_id = std::to_string (appid);
+  SK_Steam_KeyValueTree user_localconfig;
+
+  if (SK_Steam_ReadKeyValues (SK_UTF8ToWideChar (SKIF_Steam_GetUserConfigStorePath (userid, ConfigStore_UserLocal)).c_str(), user_localconfig, {
+        { "UserLocalConfigStore", "system",         "EnableGameOverlay" },
+        { "UserLocalConfigStore", "apps",   app_id, "OverlayAppEnable"  }
+      }))
   {
-    try
-    {
-      auto user_localconfig = tyti::vdf::read(file);
-      file.close();
-
-      if (user_localconfig.childs.size() > 0)
-      {
-        // There are two relevant here:
-        // - Global state is tracked at "UserLocalConfigStore" -> "system" -> "EnableGameOverlay"
-        // - Game-specific state is tracked at "UserLocalConfigStore" -> "apps" -> "<app-id>" -> "OverlayAppEnable"
-
-        std::shared_ptr <tyti::vdf::object>
-          system_localconfig =
-            SKIF_VDF_ciSearch ("system", &user_localconfig.childs);
-          //user_localconfig.childs.at("system"); // case sensitive -- cannot be used
-          
-
-        // If global state is disabled, don't bother checking the local state
-        if (! system_localconfig->attribs.empty() && system_localconfig->attribs.count("EnableGameOverlay") > 0 && system_localconfig->attribs.at("EnableGameOverlay") == "0")
-          return false;
-
-        // Continue checking the local state
-        std::shared_ptr <tyti::vdf::object>
-          apps_localconfig =
-            SKIF_VDF_ciSearch ("apps", &user_localconfig.childs);
-          //user_localconfig.childs.at("apps"); // case sensitive -- cannot be used
-
-        if (apps_localconfig != nullptr &&
-            apps_localconfig->childs.size() > 0)
-        {
-          auto lc_app = apps_localconfig->childs.find(std::to_string(appid));
-          if (lc_app != apps_localconfig->childs.end())
-          {
-            auto& attribs = lc_app->second->attribs;
-
-            if (! attribs.empty() && attribs.count("OverlayAppEnable") > 0 && attribs.at("OverlayAppEnable") == "0")
-              return false;
-          }
-        }
-      }
-    }
+    // If global state is disabled, don't bother checking the local state
+    if (user_localconfig.getValue ({ "UserLocalConfigStore", "system" }, "EnableGameOverlay") == "0")
+      return false;
 
-    // I don't expect this to throw any std::out_of_range exceptions any more
-    //   but one can never be too sure when it comes to data structures like these.
-    //     - Aemony
-    catch (const std::exception& e)
-    {
-      UNREFERENCED_PARAMETER(e);
-    }
+    // Continue checking the local state
+    if (user_localconfig.getValue ({ "UserLocalConfigStore", "apps", app_id }, "OverlayAppEnable") == "0")
+      return false;
   }
 
   return true;
@@ -952,17 +820,16 @@ SK_UseManifestToGetAppOwner (app_record_s *app)
 {
   //PLOG_VERBOSE << "Steam AppID: " << appid;
 
-  std::string manifest_data =
-    SK_GetManifestContentsForAppID (app);
+  const auto& manifest =
+    SK_GetManifestForAppID (app);
 
-  if (! manifest_data.empty ())
+  if (! manifest.empty ())
   {
     //PLOG_VERBOSE << "Parsing manifest for AppID: " << appid;
 
-    std::string app_owner =
-      SK_Steam_KeyValues::getValue (
-        manifest_data, { "AppState" }, "LastOwner"
-      );
+    std::string app_owner (
+      manifest.getValue ({ "AppState" }, "LastOwner")
+    );
 
     if (! app_owner.empty ())
     {
@@ -981,17 +848,16 @@ SK_UseManifestToGetInstallDir (app_record_s *app)
   if (! app->install_dir.empty())
     return app->install_dir;
 
-  if (app->steam.manifest_data.empty())
-    app->steam.manifest_data =
-      SK_GetManifestContentsForAppID (app);
+  const auto& manifest =
+    SK_GetManifestForAppID (app);
 
-  if (! app->steam.manifest_data.empty ())
+  if (! manifest.empty ())
   {
     //PLOG_VERBOSE << "Parsing manifest for AppID: " << appid;
 
     std::wstring app_path =
-      SK_Steam_KeyValues::getValueAsUTF16 (
-        app->steam.manifest_data, { "AppState" }, "installdir"
+      SK_UTF8ToWideChar (
+        std::string (manifest.getValue ({ "AppState" }, "installdir"))
       );
 
     if (! app_path.empty ())
@@ -1020,25 +886,25 @@ SK_UseManifestToGetDepots (app_record_s *app)
 {
   std::vector <SK_Steam_Depot> depots;
 
-  std::string manifest_data =
-    SK_GetManifestContentsForAppID (app);
+  const auto& manifest =
+    SK_GetManifestForAppID (app);
 
-  if (! manifest_data.empty ())
-  {
-    std::vector <std::string> values;
-    auto                      mounted_depots =
-      SK_Steam_KeyValues::getKeys (
-        manifest_data, { "AppState", "MountedDepots" }, &values
-      );
+  uint32_t mounted_depots =
+    manifest.findSection ({ "AppState", "MountedDepots" });
 
-    int idx = 0;
-
-    for ( auto& it : mounted_depots )
+  if (mounted_depots != SK_Steam_KeyValueTree::npos)
+  {
+    for ( uint32_t it  = manifest.firstChild  (mounted_depots);
+                   it != SK_Steam_KeyValueTree::npos;
+                   it  = manifest.nextSibling (it) )
     {
+      if (manifest.isSection (it))
+        continue;
+
       depots.push_back (
         SK_Steam_Depot {
-          "", static_cast <uint32_t> (atoi  (it            .c_str ())),
-              static_cast <uint64_t> (atoll (values [idx++].c_str ()))
+          "", static_cast <uint32_t> (atoi  (std::string (manifest.key   (it)).c_str ())),
+              static_cast <uint64_t> (atoll (std::string (manifest.value (it)).c_str ()))
         }
       );
     }
@@ -1050,18 +916,18 @@ SK_UseManifestToGetDepots (app_record_s *app)
 ManifestId_t
 SK_UseManifestToGetDepotManifest (app_record_s *app, DepotId_t depot)
 {
-  std::string manifest_data =
-    SK_GetManifestContentsForAppID (app);
+  const auto& manifest =
+    SK_GetManifestForAppID (app);
 
-  if (! manifest_data.empty ())
+  if (! manifest.empty ())
   {
+    const std::string depot_id =
+      std::to_string (depot);
+
     return
       atoll (
-        SK_Steam_KeyValues::getValue (
-          manifest_data, {
-            "AppState", "InstalledDepots", std::to_string (depot)
-          },
-          "manifest"
+        std::string (
+          manifest.getValue ({ "AppState", "InstalledDepots", depot_id }, "manifest")
         ).c_str ()
       );
   }
@@ -1111,21 +977,69 @@ SKIF_Steam_areLibrariesSignaled (void)
 
     bool countFiles = (library.frame_last_scanned == 0);
 
-    // If we detect any changes, delay checking the details for a couple of seconds 
-    if (library.watch.isSignaled (library.path)) // UITab_Library // We do not wake up when unfocused as that causes SKIF to constantly be active during downloads/updates
+    // Changes are only handed out once the folder has been quiet for a couple of seconds,
+    //   as Steam rewrites the manifests several times over during downloads/updates
+    if (library.watch.isSignaled (library.path, UITab_None, FALSE, FILE_NOTIFY_CHANGE_FILE_NAME | FILE_NOTIFY_CHANGE_LAST_WRITE, 2500)) // UITab_Library // We do not wake up when unfocused as that causes SKIF to constantly be active during downloads/updates
     {
-      library.signaled = SKIF_Util_timeGetTime ( );
+      KillTimer (SKIF_Notify_hWnd, library.timer);
+      library.signaled = 0;
 
-      // Create a timer to trigger a refresh after the time has expired
-      SetTimer (SKIF_Notify_hWnd, library.timer, 2500 + 50, NULL);
+      bool overflowed = false;
+      auto changes    = library.watch.getChanges (&overflowed);
+
+      if (overflowed)
+        countFiles = true;
+
+      // Only manifests being added or removed affects the list of installed apps
+      else if (! countFiles)
+      {
+        SK_VirtualFS::vfsNode* pFolder =
+          static_cast <SK_VirtualFS::vfsNode*> (library.manifest_vfs)->addDirectory (library.path);
+
+        int prevCount = library.count;
+
+        auto _isManifest = [](const std::wstring& name) -> bool
+        {
+          return (! name.empty() && PathMatchSpecW (name.c_str(), L"appmanifest_*.acf"));
+        };
+
+        for (auto& change : changes)
+        {
+          bool removed = (change.action == SKIF_DirectoryChange::Action::Removed),
+               added   = (change.action == SKIF_DirectoryChange::Action::Added);
+
+          if (change.action == SKIF_DirectoryChange::Action::Renamed)
+          {
+            if (_isManifest (change.old_path) && pFolder->removeFile (change.old_path.c_str()))
+              library.count--;
+
+            added = true;
+          }
+
+          if (! _isManifest (change.path))
+            continue;
+
+          if (removed && pFolder->removeFile (change.path.c_str()))
+            library.count--;
+
+          else if (added && ! pFolder->containsFile (change.path.c_str()))
+          {
+            pFolder->addFile (change.path.c_str());
+            library.count++;
+          }
+        }
+
+        if (library.count != prevCount)
+          isSignaled = true;
+      }
     }
 
-    // Only refresh if there has been no further changes to the folder recently
-    if (0 < library.signaled && library.signaled + 2500 < SKIF_Util_timeGetTime ( ))
+    // Create a timer to wake us up once the changes have settled
+    else if (library.watch.getLastChange ( ) != library.signaled)
     {
-      KillTimer (SKIF_Notify_hWnd, library.timer);
-      library.signaled = 0;
-      countFiles = true;
+      library.signaled = library.watch.getLastChange ( );
+
+      SetTimer (SKIF_Notify_hWnd, library.timer, 2500 + 50, NULL);
     }
 
     if (countFiles)
@@ -1152,12 +1066,21 @@ SKIF_Steam_areLibrariesSignaled (void)
 };
 
 
+// An installed app, along with its parsed appmanifest_<appid>.acf file
+struct SKIF_SteamInt_Manifest {
+  AppId_t               appid = 0;
+  std::wstring          path;
+  SK_Steam_KeyValueTree manifest; // Empty if it could not be read or parsed
+};
+
 // This is an internal helper function used by SKIF_Steam_GetInstalledAppIDs ( ).
 // This function discovers and returns an unprocessed vector of all apps on the system.
-static std::vector <AppId_t>
+//   Libraries are scanned concurrently (one task each, as they are typically on separate drives),
+//     and the manifests they contain are read and parsed as part of the scan.
+static std::vector <SKIF_SteamInt_Manifest>
 SKIF_SteamInt_DiscoverInstalledApps (void)
 {
-  std::vector <AppId_t> apps;
+  std::vector <SKIF_SteamInt_Manifest> apps;
 
   steam_library_t* steam_lib_paths = nullptr;
   int              steam_libs      = SK_Steam_GetLibraries (&steam_lib_paths);
@@ -1171,9 +1094,78 @@ SKIF_SteamInt_DiscoverInstalledApps (void)
 
   if (steam_libs != 0)
   {
-    EnterCriticalSection (&VFSManifestSection);
+    struct scan_s {
+      SK_VirtualFS                         vfs;
+      int                                  count = 0;
+      wchar_t                              path [MAX_PATH + 2] = { };
+      std::vector <SKIF_SteamInt_Manifest> manifests;
+    };
+
+    std::vector <scan_s>             scans (steam_libs);
+    std::vector <std::future <void>> tasks;
 
     // Scan through the libraries first for all appmanifest files they contain
+    for (int i = 0; i < steam_libs; i++)
+    {
+      tasks.emplace_back (
+        std::async (std::launch::async, [&scan = scans [i], wszLibrary = (const wchar_t *)steam_lib_paths [i]](void)
+        {
+          SKIF_Util_SetThreadDescription (GetCurrentThread (), L"SKIF_SteamLibraryWorker");
+
+          DWORD dwStart = SKIF_Util_timeGetTime1 ( );
+
+          swprintf (scan.path, MAX_PATH + 2,
+                        LR"(%s\steamapps)",
+                    wszLibrary );
+
+          scan.vfs.clear ();
+
+          scan.count =
+            SK_VFS_ScanTree ( scan.vfs,
+                              scan.path, L"appmanifest_*.acf", 0);
+
+          SK_VirtualFS::vfsNode* pFolder =
+            scan.vfs;
+
+          // Really, this will just iterate once, across pFolder->children[0]
+          //   ...as long as SKIF doesn't dynamically recognize
+          //        new Steam libraries during runtime, that is...
+          for (const auto& folder : pFolder->children)
+          {
+            scan.manifests.reserve (folder.second->children.size ());
+
+            // Now read the manifests of all apps that are installed
+            for (const auto& file : folder.second->children)
+            {
+              uint32_t appid;
+
+              if ( swscanf (file.first.c_str(),
+                                L"appmanifest_%lu.acf",
+                                  &appid ) == 1 )
+              {
+                SKIF_SteamInt_Manifest& app =
+                  scan.manifests.emplace_back ( );
+
+                app.appid = appid;
+                app.path  = file.second->getFullPath ( );
+
+                if (! SK_Steam_ReadKeyValues (app.path.c_str (), app.manifest))
+                  PLOG_WARNING << "Failed to read manifest: " << app.path;
+              }
+            }
+          }
+
+          PLOG_INFO << "[Library Processing] Scanned Steam library " << scan.path << " (" << scan.manifests.size () << " manifests) in " << (SKIF_Util_timeGetTime1 ( ) - dwStart) << " ms.";
+        })
+      );
+    }
+
+    for (int i = 0; i < steam_libs; i++)
+      SKIF_Util_JoinTask (tasks [i], "[Library Processing] Scan of Steam library " + SK_WideCharToUTF8 ((const wchar_t *)steam_lib_paths [i]));
+
+    // Publish the results
+    EnterCriticalSection (&VFSManifestSection);
+
     for (int i = 0; i < steam_libs; i++)
     {
       auto& library =
@@ -1182,56 +1174,32 @@ SKIF_SteamInt_DiscoverInstalledApps (void)
       // SKIF_FrameCount iterates at the start of the frame, so even the first frame will be frame count 1
       if (library.frame_last_scanned == 0)
       {
-        swprintf (library.path, MAX_PATH + 2,
-                      LR"(%s\steamapps)",
-                  (wchar_t *)steam_lib_paths [i] );
+        wcsncpy_s (library.path, MAX_PATH + 2,
+                   scans [i].path, _TRUNCATE);
 
         library.timer = static_cast <UINT_PTR>(1983 + i); // 1983-1999
       }
 
-      // Scan the folder if we haven't already done so during this frame
-      if (library.frame_last_scanned != frame_count_)
-      {
-        library.frame_last_scanned    = frame_count_;
+      library.frame_last_scanned = frame_count_;
+      library.count              = scans [i].count;
+      library.manifest_vfs.swap (scans [i].vfs);
+    }
 
-        // Clear out any existing paths
-        library.manifest_vfs.clear();
+    g_SteamLibrariesParsed.store (true);
 
-        library.count =
-          SK_VFS_ScanTree ( library.manifest_vfs,
-                            library.path, L"appmanifest_*.acf", 0);
-      }
-      
-      SK_VirtualFS::vfsNode* pFolder =
-        library.manifest_vfs;
+    LeaveCriticalSection (&VFSManifestSection);
 
-      // Really, this will just iterate once, across pFolder->children[0]
-      //   ...as long as SKIF doesn't dynamically recognize
-      //        new Steam libraries during runtime, that is...
-      for (const auto& folder : pFolder->children)
+    // Keep the order of the libraries
+    for (auto& scan : scans)
+    {
+      for (auto& app : scan.manifests)
       {
-        // Now add the App IDs of all manifests that are installed,
-        //   and also check for Special K ownership on Steam...
-        for (const auto& file : folder.second->children)
-        {
-          uint32_t appid;
-
-          if ( swscanf (file.first.c_str(),
-                            L"appmanifest_%lu.acf",
-                              &appid ) == 1 )
-          {
-            apps.push_back (appid);
+        if (app.appid == 1157970)
+          bHasSpecialK = true;
 
-            if (appid == 1157970)
-              bHasSpecialK = true;
-          }
-        }
+        apps.emplace_back (std::move (app));
       }
     }
-
-    g_SteamLibrariesParsed.store (true);
-
-    LeaveCriticalSection (&VFSManifestSection);
   }
   
   if (bHasSpecialK)
@@ -1311,24 +1279,31 @@ SKIF_Steam_GetInstalledAppIDs (std::vector <std::pair < std::string, app_record_
 
   PLOG_INFO << "Detecting Steam games...";
 
-  for (auto app : SKIF_SteamInt_DiscoverInstalledApps ( ))
+  for (auto& app : SKIF_SteamInt_DiscoverInstalledApps ( ))
   {
     // Skip Steamworks Common Redists
-    if (app == 228980) continue;
+    if (app.appid == 228980) continue;
 
     // Skip IDs related to apps, DLCs, music, and tools (including Special K for now)
-    if (std::find(std::begin(steam_apps_ignorable), std::end(steam_apps_ignorable), app) != std::end(steam_apps_ignorable)) continue;
+    if (SKIF_Steam_isIgnorableAppID (app.appid)) continue;
 
-    if (unique_apps.emplace (app).second)
+    if (unique_apps.emplace (app.appid).second)
     {
-      app_record_s record (app);
+      app_record_s record (app.appid);
       record.store      = app_record_s::Store::Steam;
       record.store_utf8 = "Steam";
 
-      // Opening the manifests to read the names is a
-      //   lengthy operation, so defer names and icons
+      // The manifest was already read during the scan; if that failed,
+      //   SK_GetManifestForAppID ( ) will try again when it is needed
+      if (! app.manifest.empty ())
+      {
+        record.details->manifest   = std::move (app.manifest);
+        record.steam.manifest_path = std::move (app.path);
+      }
+
+      // Names and icons are still deferred
       apps->emplace_back (
-        "Loading...", record
+        "Loading...", std::move (record)
       );
     }
   }
@@ -1567,6 +1542,7 @@ SKIF_Steam_IdentifyAssetPCGW (uint32_t app_id)
               PLOG_DEBUG << "Downloading cover asset: " << assetUrl;
 
               SKIF_Util_GetWebResource (SK_UTF8ToWideChar (assetUrl), targetAssetPath + L"cover-pcgw.png");
+              SKIF_AssetIndex::GetInstance ( ).update (targetAssetPath + L"cover-pcgw.png");
             }
           }
         }
@@ -22,9 +22,12 @@
 
 #include <stores/Steam/vdf.h>
 #include <utility/fsutil.h>
+#include <utility/utility.h>
 #include <regex>
 #include <stores/Steam/steam_library.h>
 #include <filesystem>
+#include <future>
+#include <atomic>
 
 const int SKIF_STEAM_APPID = 1157970;
 
@@ -32,38 +35,86 @@ const int SKIF_STEAM_APPID = 1157970;
 using appinfo_s     = skValveDataFile::appinfo_s;
 using app_section_s =                  appinfo_s::section_s;
 
+// Precompiled section queries used by getAppInfo
+static constexpr app_section_s::path_s path_extended      { "appinfo", "extended"                                                  };
+static constexpr app_section_s::path_s path_common        { "appinfo", "common"                                                    };
+static constexpr app_section_s::path_s path_capsule_image { "appinfo", "common", "library_assets_full", "library_capsule", "image" };
+static constexpr app_section_s::path_s path_launch        { "appinfo", "config", "launch"                                          };
+static constexpr app_section_s::path_s path_ufs           { "appinfo", "ufs"                                                       };
+static constexpr app_section_s::path_s path_rootoverrides { "appinfo", "ufs",    "rootoverrides"                                   };
+static constexpr app_section_s::path_s path_savefiles     { "appinfo", "ufs",    "savefiles"                                       };
+static constexpr app_section_s::path_s path_branches      { "appinfo", "depots", "branches"                                        };
+
 uint32_t skValveDataFile::vdf_version = 0x27; // Default to Pre-December 2022
 
+// Bytes preceding the KeyValues data of an app record
+static size_t
+SK_VDF_GetAppHeaderSize (void)
+{
+  return
+    ( skValveDataFile::vdf_version > 0x27 ? sizeof (skValveDataFile::appinfo_s)
+                                          : sizeof (skValveDataFile::appinfo27_s) );
+}
+
 skValveDataFile::skValveDataFile (std::wstring source) : path (source)
 {
-  FILE *fData = nullptr;
+  std::scoped_lock lock (_lock);
 
-  _wfopen_s (&fData, path.c_str (), L"rbS");
+  openView ();
+}
 
-  if (fData != nullptr)
-  {
-#ifdef _WIN64
-    _fseeki64 (fData, 0, SEEK_END);
-#else
-    fseek     (fData, 0, SEEK_END);
-#endif
-    size_t
-    size =
-#ifdef _WIN64
-    _ftelli64 (fData);
-#else
-    ftell     (fData);
-#endif
-    rewind    (fData);
+bool
+skValveDataFile::open (void)
+{
+  std::scoped_lock lock (_lock);
+
+  return openView ();
+}
+
+void
+skValveDataFile::close (void)
+{
+  std::scoped_lock lock (_lock);
+
+  closeView ();
+}
+
+void
+skValveDataFile::closeView (void)
+{
+  // The index and string table are kept, as they tell getAppInfo which apps are worth
+  //   mapping the file again for, and stay valid for as long as the file is unchanged
+  _data.close ();
+
+  base  = nullptr;
+  root  = nullptr;
+  table = nullptr;
+}
+
+bool
+skValveDataFile::openView (void)
+{
+  closeView ();
 
-    _data.resize (size);
+  WIN32_FILE_ATTRIBUTE_DATA fad = { };
+  GetFileAttributesExW (path.c_str (), GetFileExInfoStandard, &fad);
 
-    fread  (_data.data (), size, 1, fData);
-    fclose (                        fData);
+  const uint64_t size  = (static_cast <uint64_t> (fad.nFileSizeHigh)                  << 32) | fad.nFileSizeLow,
+                 mtime = (static_cast <uint64_t> (fad.ftLastWriteTime.dwHighDateTime) << 32) | fad.ftLastWriteTime.dwLowDateTime;
 
+  // The file is mapped rather than read, only the pages of apps we actually parse get touched
+  if (! _data.open (path.c_str ()))
+    PLOG_ERROR << "Failed to map " << path;
+
+  // Version, universe and (0x29+) the string table offset
+  else if (_data.size () < sizeof (DWORD) * 2 + sizeof (uint64_t))
+    PLOG_ERROR << "appinfo.vdf is truncated (" << _data.size () << " bytes)!";
+
+  else
+  {
     base =
       reinterpret_cast <
-             header_s *> (_data.data ());
+             header_s *> (const_cast <BYTE *> (_data.data ()));
 
     vdf_version =
       ((uint8_t *)&base->version)[0];
@@ -74,60 +125,190 @@ skValveDataFile::skValveDataFile (std::wstring source) : path (source)
     // A string table was added in June of 2024 (0x29)
     if (vdf_version >= 0x29)
     {
-      uintptr_t strtable_pos
-            =   (uintptr_t)*(uint64_t *)root;
+      uint64_t strtable_pos
+            =   *(uint64_t *)root;
       root  = (appinfo_s *)((uint64_t *)root + 1);
-      table = (str_tbl_s *)(&_data [strtable_pos]);
 
       // Valve is using 64-bit offsets, if this file is larger than
       //   4 GiB SKIF32 is fundamentally inoperable!
       PLOG_ERROR_IF (
-        *(uint64_t *)root > std::numeric_limits <uintptr_t>::max ()
+        strtable_pos > std::numeric_limits <uintptr_t>::max ()
       ) << "VDF File is Too Large!";
 
-      strs.reserve   (        table->num_strings);
-      strs.push_back ((char *)table->strings);
+      if ( strtable_pos > std::numeric_limits <size_t>::max () ||
+           ! _data.contains (_data.data () + (size_t)strtable_pos, sizeof (DWORD) + 1) )
+      {
+        PLOG_ERROR << "String table offset (" << strtable_pos << ") is out-of-bounds, appinfo.vdf will not be used!";
+        closeView ();
+        _index.clear ();
+        strs.clear   ();
+        _size = _mtime = 0;
+        return false;
+      }
+
+      table = (str_tbl_s *)(_data.data () + (size_t)strtable_pos);
+    }
+
+    // Unchanged since it was last indexed, so only the single records that get decoded are validated
+    if (! _index.empty () && _data.size () == size && _size == size && _mtime == mtime)
+      return true;
+
+    strs.clear ();
+
+    if (table != nullptr)
+    {
+      strs.reserve   (table->num_strings);
+      strs.push_back (0);
 
       char* str     = (char *)table->strings;
-      char* end_tbl = (char *)_data.data () +
-                              _data.size ();
+      char* end_tbl = (char *)_data.end ();
 
       for (DWORD i = 1; i < table->num_strings; ++i)
       {
-        while (*str++ != '\0' && str < end_tbl);
+        while (str < end_tbl && *str++ != '\0');
 
-        if (str > end_tbl)
+        if (str >= end_tbl)
         {
           // On overflow, restart table iteration from the beginning
           PLOG_ERROR << "Malformed string table detected!";
           str = (char *)table->strings;
         }
 
-        strs.push_back (str);
+        strs.push_back ((size_t)(str - (char *)table->strings));
       }
     }
+
+    buildIndex ();
+
+    _size  = size;
+    _mtime = mtime;
+
+    return true;
   }
+
+  closeView ();
+  _index.clear ();
+  strs.clear   ();
+  _size = _mtime = 0;
+
+  return false;
 }
 
 void
+skValveDataFile::buildIndex (void)
+{
+  _index.clear ();
+
+  if (root == nullptr || _data.empty ())
+    return;
+
+  switch (vdf_version)
+  {
+    case 0x27:
+    case 0x28:
+    case 0x29:
+      break;
+    default:
+      PLOG_WARNING << "Unsupported appinfo.vdf version (" << vdf_version << "), app index will not be built!";
+      return;
+  }
+
+  SK_RunOnceEx ([&](void)
+  {
+    switch (vdf_version)
+    {
+      case 0x29: // v41
+        PLOG_VERBOSE << "appinfo.vdf version: " << vdf_version << " (June 2024)";
+        break;
+      case 0x28: // v40
+        PLOG_VERBOSE << "appinfo.vdf version: " << vdf_version << " (December 2022)";
+        break;
+      default: // v39
+        PLOG_VERBOSE << "appinfo.vdf version: " << vdf_version << " (pre-December 2022)";
+    }
+  });
+
+  const size_t vdf_header_size =
+    SK_VDF_GetAppHeaderSize ();
+
+  // The string table (0x29+) follows the app records, so it marks their end
+  const size_t end_of_apps =
+    ( table != nullptr ) ? (size_t)((uint8_t *)table - _data.data ())
+                         :                             _data.size ();
+
+  size_t offset =
+    (size_t)((uint8_t *)root - _data.data ());
+
+  // Rough guess, but avoids most of the rehashing on large files
+  _index.reserve (_data.size () / 8192);
+
+  while (offset + sizeof (appinfo27_s::appid) <= end_of_apps)
+  {
+    auto *pApp =
+      (appinfo_s *)(_data.data () + offset);
+
+    if (pApp->appid == _LastSteamApp)
+      break;
+
+    // Size excludes the appid and size fields themselves
+    const size_t record_size =
+      ( offset + 8 <= end_of_apps ) ? (size_t)pApp->size + 8
+                                    : 0;
+
+    if ( record_size          < vdf_header_size ||
+         end_of_apps - offset < record_size )
+    {
+      PLOG_ERROR << "Malformed appinfo.vdf record for appid " << pApp->appid
+                 << " at offset " << offset << ", indexing stopped!";
+      break;
+    }
+
+    _index.emplace (pApp->appid, app_index_s { offset, record_size });
+
+    offset += record_size;
+  }
+
+  PLOG_VERBOSE << "Indexed " << _index.size () << " apps in appinfo.vdf";
+}
+
+appinfo_s*
+skValveDataFile::findAppInfo (uint32_t appid)
+{
+  auto it =
+    _index.find (appid);
+
+  if (it == _index.cend () || _data.empty ())
+    return nullptr;
+
+  return
+    (appinfo_s *)(_data.data () + it->second.offset);
+}
+
+// Returns false if the data ended prematurely (truncated or corrupt record)
+//   All parser state is local, so separate section_s objects may be parsed concurrently
+bool
 app_section_s::parse (section_desc_s& desc)
 {
-  static
-    std::map <_TokenOp,size_t>
-                    operand_sizes =
-    { { Int32, sizeof (int32_t) },
-      { Int64, sizeof (int64_t) } };
+  static constexpr auto
+    operand_size = [](_TokenOp op) constexpr -> size_t
+  {
+    return (op == Int64) ? sizeof (int64_t)
+                         : sizeof (int32_t);
+  };
+
+  clear ();
 
-  std::vector <
-    section_data_s
-  > raw_sections;
+  // Innermost section that has not yet been closed
+  uint32_t current   = npos;
+  bool     exception = false;
 
-  static bool exception = false;
+  // Every read below is checked against the end of the record, not the file
+  uint8_t* const end      = (uint8_t *)desc.blob + desc.size;
+  bool           overflow = false;
 
-  if (! exception)
   {
-    for ( uint8_t *cur = (uint8_t *)desc.blob             ;
-                   cur < (uint8_t *)desc.blob + desc.size ;
+    for ( uint8_t *cur = (uint8_t *)desc.blob           ;
+                   cur < end && ! overflow && ! exception ;
                    cur++ )
     {
       auto op =
@@ -142,6 +323,12 @@ app_section_s::parse (section_desc_s& desc)
         //
         if (appinfo->vdf_version >= 0x29)
         {
+          if (end - cur <= (ptrdiff_t)sizeof (uint32_t))
+          {
+            overflow = true;
+            break;
+          }
+
           name =
             (char *)appinfo->table->strings;
 
@@ -155,7 +342,7 @@ app_section_s::parse (section_desc_s& desc)
           if ( str_idx < appinfo->table->num_strings )
           {
             name =
-              appinfo->strs [str_idx];
+              (char *)appinfo->table->strings + appinfo->strs [str_idx];
 #ifdef DEBUG
             PLOG_VERBOSE << "String=" << name;
 #endif
@@ -173,28 +360,37 @@ app_section_s::parse (section_desc_s& desc)
         {
           // Skip past name declarations, except for </Section> because it has no name.
                   cur++;
-          while (*cur != '\0')
+          while (cur < end && *cur != '\0')
                 ++cur;
+
+          if (cur >= end)
+          {
+            overflow = true;
+            break;
+          }
         }
       }
 
       if (op == SectionBegin)
       {
-        if (! raw_sections.empty ())
-              raw_sections.push_back ({ raw_sections.back ().name + std::string (".") +
-                                        name, {  (void *)cur, 0 } });
-        else
-          raw_sections.push_back     ({ name, {  (void *)cur, 0 } });
+        sections.push_back ({ name, current,
+          (current != npos) ? sections [current].depth + 1 : 0,
+                              { (void *)cur, 0 }, { } });
+
+        current =
+          static_cast <uint32_t> (sections.size () - 1);
       }
 
       else if (op == SectionEnd)
       {
-        if (! raw_sections.empty ())
-        {     raw_sections.back  ().desc.size =
+        if (current != npos)
+        {
+          sections [current].desc.size =
             (uintptr_t)cur -
-            (uintptr_t)raw_sections.back      ().desc.blob;
-                  finished_sections.push_back (raw_sections.back ());
-                        raw_sections.pop_back  ();
+            (uintptr_t)sections [current].desc.blob;
+
+          finished_sections.push_back (current);
+          current = sections [current].parent;
         }
       }
 
@@ -205,22 +401,29 @@ app_section_s::parse (section_desc_s& desc)
         switch (op)
         {
           case String:
-            if (! raw_sections.empty ())
-            {     raw_sections.back ().keys.push_back (
+            if (current != npos)
+            {     _unsorted_keys.push_back (
                 { name, { String, (void *)cur }}
-              );
+              );  _key_owners.push_back (current);
             } else { exception = true; }
-            while (*cur != '\0')     ++cur;
+            while (cur < end && *cur != '\0') ++cur;
+            overflow = (cur >= end);
             break;
 
           case Int32:
           case Int64:
-            if (! raw_sections.empty ())
-            {     raw_sections.back ().keys.push_back (
+            if (end - cur < (ptrdiff_t)operand_size (op))
+            {
+              overflow = true;
+              break;
+            }
+
+            if (current != npos)
+            {     _unsorted_keys.push_back (
                 { name, { op, (void *)cur }}
-              );
+              );  _key_owners.push_back (current);
             } else { exception = true; }
-            cur += (operand_sizes [op]-1);
+            cur += (operand_size (op)-1);
             break;
 
           default:
@@ -231,38 +434,115 @@ app_section_s::parse (section_desc_s& desc)
       }
     }
   }
+
+  PLOG_ERROR_IF (overflow) << "Section data ended prematurely, the appinfo.vdf record is truncated or corrupt!";
+
+  // Keys of a section are interleaved with those of its children, so group them
+  //   by section with a single counting sort (stable, so key order is preserved)
+  const size_t count = _unsorted_keys.size ();
+
+  keys.resize        (count);
+  _key_firsts.assign (sections.size () + 1, 0);
+
+  for (size_t i = 0; i < count; ++i)
+    ++_key_firsts [_key_owners [i] + 1];
+
+  for (size_t i = 1; i < _key_firsts.size (); ++i)
+    _key_firsts [i] += _key_firsts [i - 1];
+
+  for (size_t i = 0; i < sections.size (); ++i)
+    sections [i].keys =
+      std::span <_kv_pair> (keys.data () + _key_firsts [i], _key_firsts [i + 1] - _key_firsts [i]);
+
+  for (size_t i = 0; i < count; ++i)
+    keys [_key_firsts [_key_owners [i]]++] = _unsorted_keys [i];
+
+  return
+    (! overflow);
+}
+
+void
+app_section_s::clear (void)
+{
+  sections.clear          ();
+  finished_sections.clear ();
+  keys.clear              ();
+  _unsorted_keys.clear    ();
+  _key_owners.clear       ();
+  _key_firsts.clear       ();
+}
+
+const app_section_s::section_data_s*
+app_section_s::ancestor (const section_data_s& sec, uint32_t depth) const
+{
+  const section_data_s* pSec = &sec;
+
+  if (depth > pSec->depth)
+    return nullptr;
+
+  while (pSec->depth > depth)
+    pSec = &sections [pSec->parent];
+
+  return pSec;
+}
+
+bool
+app_section_s::within (const section_data_s& sec, const path_s& path) const
+{
+  if (path.count == 0 || sec.depth + 1 < path.count)
+    return false;
+
+  const section_data_s* pSec =
+    ancestor (sec, path.count - 1);
+
+  for (uint32_t i = path.count; i-- > 0; pSec = (pSec->parent != npos) ? &sections [pSec->parent] : nullptr)
+  {
+    if (pSec == nullptr || strcmp (pSec->name, path.parts [i]) != 0)
+      return false;
+  }
+
+  return true;
+}
+
+bool
+app_section_s::is (const section_data_s& sec, const path_s& path) const
+{
+  return sec.depth + 1 == path.count && within (sec, path);
+}
+
+bool
+app_section_s::under (const section_data_s& sec, const path_s& path) const
+{
+  return sec.depth + 1 >  path.count && within (sec, path);
+}
+
+// Only used for diagnostics and the odd dynamic name, as this allocates
+std::string
+app_section_s::getPath (const section_data_s& sec, uint32_t first_depth) const
+{
+  std::string path;
+
+  for (uint32_t depth = first_depth; depth <= sec.depth; ++depth)
+  {
+    if (! path.empty ())
+      path += '.';
+
+    path += ancestor (sec, depth)->name;
+  }
+
+  return path;
 }
 
 void*
 appinfo_s::getRootSection (size_t* pSize)
 {
-  size_t vdf_header_size =
-    ( vdf_version > 0x27 ? sizeof (appinfo_s)
-                         : sizeof (appinfo27_s) );
-
-  static bool
-      runOnce = true;
-  if (runOnce)
-  {   runOnce = false;
-  
-    switch (vdf_version)
-    {
-      case 0x29: // v41
-        PLOG_VERBOSE << "appinfo.vdf version: " << vdf_version << " (June 2024)";
-        break;
-      case 0x28: // v40
-        PLOG_VERBOSE << "appinfo.vdf version: " << vdf_version << " (December 2022)";
-        break;
-      case 0x27: // v39
-        PLOG_VERBOSE << "appinfo.vdf version: " << vdf_version << " (pre-December 2022)";
-        break;
-      default:
-        PLOG_WARNING << "appinfo.vdf version: " << vdf_version << " (unknown/unsupported)";
-    }
-  }
+  const size_t vdf_header_size =
+    SK_VDF_GetAppHeaderSize ();
 
+  // Size excludes the appid and size fields themselves; a malformed record yields an empty section
   size_t kv_size =
-    (size - vdf_header_size + 8);
+    ( (size_t)size + 8 > vdf_header_size ) ? (size_t)size + 8 - vdf_header_size
+                                           : 0;
 
   if (pSize != nullptr)
      *pSize  = kv_size;
@@ -289,8 +569,61 @@ appinfo_s::getNextApp (void)
                               nullptr : pNext;
 }
 
-appinfo_s*
+bool
 skValveDataFile::getAppInfo ( uint32_t appid, std::vector <std::pair < std::string, app_record_s > > *apps )
+{
+  app_record_s* pAppRecord = nullptr;
+
+  if (apps != nullptr)
+  {
+    for (auto& app : *apps)
+    {
+      if (app.second.id == appid && app.second.store == app_record_s::Store::Steam)
+      {
+        pAppRecord = &app.second;
+        break;
+      }
+    }
+  }
+
+  return
+    getAppInfo (appid, pAppRecord);
+}
+
+bool
+skValveDataFile::getAppInfo ( uint32_t appid, app_record_s* pAppRecord )
+{
+  // Never wait on the library worker decoding everything (it holds the lock meanwhile),
+  //   the app is left unprocessed and picked up by the worker or a later call instead
+  std::unique_lock lock (_lock, std::try_to_lock);
+
+  if (! lock.owns_lock ())
+    return false;
+
+  // The view is released once the library has been decoded; the file is only mapped again
+  //   for the duration of the call, and only for apps it contained when it was last indexed
+  bool remapped = false;
+
+  if (_data.empty ())
+  {
+    if (_index.count (appid) == 0 || (pAppRecord != nullptr && pAppRecord->processed))
+      return false;
+
+    remapped =
+      openView ();
+  }
+
+  bool decoded =
+    decodeAppInfo (appid, pAppRecord);
+
+  if (remapped)
+    closeView ();
+
+  return decoded;
+}
+
+bool
+skValveDataFile::decodeAppInfo ( uint32_t appid, app_record_s* pAppRecord )
 {
   static SKIF_CommonPathsCache& _path_cache = SKIF_CommonPathsCache::GetInstance ( );
 
@@ -299,976 +632,1046 @@ skValveDataFile::getAppInfo ( uint32_t appid, std::vector <std::pair < std::stri
   // Skip call if it concerns someone whom does not have SKIF installed on Steam
   if ( appid == SKIF_STEAM_APPID &&
              (! SKIF_STEAM_OWNER) )
-    return nullptr;
+    return false;
 
   if (root != nullptr)
   {
-    skValveDataFile::appinfo_s *pIter = root;
+    auto index =
+      _index.find (appid);
 
-    while (pIter != nullptr && pIter->appid != _LastSteamApp)
+    if (index != _index.cend ())
     {
-      if (pIter->appid == appid)
+      // If we're dealing with an unrecognized app, process it into a dummy object
+      std::unique_ptr <app_record_s> _non_steam;
+
+      if (! pAppRecord)
       {
-        app_record_s* pAppRecord = nullptr;
+        _non_steam = std::make_unique <app_record_s> (appid);
+        pAppRecord = _non_steam.get ();
+      }
 
-        for (auto& app : *apps)
-        {
-          if (app.second.id == appid && app.second.store == app_record_s::Store::Steam)
-          {
-            pAppRecord = &app.second;
-            break;
-          }
-        }
+      // Skip already processed apps
+      else if (pAppRecord->processed)
+        return false;
 
-        // If we're dealing with an unrecognized app, process it into a dummy object
-        if (! pAppRecord)
-        {
-          static app_record_s _non_steam (appid);
-          pAppRecord = &_non_steam;
-        }
+      // Parser state is per-thread, so multiple apps may be decoded concurrently
+      //   as long as each thread works on its own app record; the storage is
+      //     reused from the previous app, so parsing does not allocate
+      thread_local
+        appinfo_s::section_s    section;
+      appinfo_s::section_desc_s app_desc{};
 
-        // Skip already processed apps
-        else if (pAppRecord->processed)
-          break;
+      // Bounds come from the index rather than the record itself, as buildIndex has validated them
+      const size_t vdf_header_size =
+        SK_VDF_GetAppHeaderSize ();
 
-        static DWORD dwSingleThread  = GetCurrentThreadId ();
-        assert      (dwSingleThread == GetCurrentThreadId ());
+      auto *pApp =
+        (appinfo_s *)(_data.data () + index->second.offset);
 
-        static appinfo_s::section_s      section;
-        appinfo_s::section_desc_s app_desc{};
+      app_desc.blob = const_cast <BYTE *> (_data.data ()) + index->second.offset + vdf_header_size;
+      app_desc.size =                                      index->second.size   - vdf_header_size;
+
+      // The index may come from an earlier mapping of the file, so the record is checked against it first
+      if (! _data.contains (pApp, index->second.size) || pApp->appid != appid || (size_t)pApp->size + 8 != index->second.size
+                                                      || ! section.parse (app_desc))
+      {
+        PLOG_ERROR << "Malformed appinfo.vdf data for appid " << appid << ", the app will not be processed!";
 
-        section.finished_sections.clear ();
+        // Not retried, as the record reads the same until Steam rewrites the file
+        pAppRecord->processed = true;
 
-        app_desc.blob =
-          pIter->getRootSection (&app_desc.size);
+        return false;
+      }
 
-        section.parse (app_desc);
 //#define _WRITE_APPID_INI
 #ifdef  _WRITE_APPID_INI
-        FILE* fTest =
-          fopen (SK_FormatString ("appid%d.ini", pAppRecord->id).c_str (), "w");
+      FILE* fTest =
+        fopen (SK_FormatString ("appid%d.ini", pAppRecord->id).c_str (), "w");
 #endif
 
-        bool populate_appinfo_extended =
-          pAppRecord->extended_config.vac.enabled == -1;
-        bool populate_common =
-          pAppRecord->common_config.appid == 0;
-        bool populate_cloud_saves =
-         //pAppRecord != nullptr &&
-          pAppRecord->cloud_saves.empty ();
+      bool populate_appinfo_extended =
+        pAppRecord->details->extended_config.vac.enabled == -1;
+      bool populate_common =
+        pAppRecord->common_config.appid == 0;
+      bool populate_cloud_saves =
+       //pAppRecord != nullptr &&
+        pAppRecord->details->cloud_saves.empty ();
 
-        bool populate_branches  =
-        //pAppRecord != nullptr &&
-          pAppRecord->branches.empty ();
+      bool populate_branches  =
+      //pAppRecord != nullptr &&
+        pAppRecord->details->branches.empty ();
 
-        bool populate_launch_configs =
-        //pAppRecord != nullptr      &&
-          pAppRecord->launch_configs.empty ();
+      bool populate_launch_configs =
+      //pAppRecord != nullptr      &&
+        pAppRecord->launch_configs.empty ();
 
-        bool get_library_asset_paths = true;
+      bool get_library_asset_paths = true;
 
-        pAppRecord->install_dir =
-          SK_UseManifestToGetInstallDir (pAppRecord);
+      pAppRecord->install_dir =
+        SK_UseManifestToGetInstallDir (pAppRecord);
 
-        for (auto& finished_section : section.finished_sections)
-        {
-          if (finished_section.keys.empty ())
-            continue;
+      for (auto idx : section.finished_sections)
+      {
+        auto& finished_section =
+          section.at (idx);
 
-          if (pAppRecord != nullptr)
+        if (finished_section.keys.empty ())
+          continue;
+
+        if (pAppRecord != nullptr)
+        {
+          if ( populate_appinfo_extended &&
+               section.within (finished_section, path_extended) )
           {
-            if ( populate_appinfo_extended &&
-                 0 == finished_section.name.find ("appinfo.extended") )
-            {
-              auto *pVac =
-                &pAppRecord->extended_config.vac;
+            auto *pVac =
+              &pAppRecord->details->extended_config.vac;
 
-              //auto *pDev =
-              //  &pAppRecord->extended_config.dev;
+            //auto *pDev =
+            //  &pAppRecord->details->extended_config.dev;
 
-              for (auto& key : finished_section.keys)
+            for (auto& key : finished_section.keys)
+            {
+              if (! _stricmp (key.first, "vacmodulefilename"))
               {
-                if (! _stricmp (key.first, "vacmodulefilename"))
-                {
-                  pVac->vacmodulefilename =
-                    (const char *)key.second.second;
-                }
-
-                if (! pVac->vacmodulefilename.empty ())
-                      pVac->enabled = true;
-                else
-                      pVac->enabled = false;
+                pVac->vacmodulefilename =
+                  (const char *)key.second.second;
               }
 
-              if (pVac->enabled == -1)
-                pVac->enabled = false;
+              if (! pVac->vacmodulefilename.empty ())
+                    pVac->enabled = true;
+              else
+                    pVac->enabled = false;
             }
-            
-            else if (pAppRecord->extended_config.vac.enabled == -1)
-              pAppRecord->extended_config.vac.enabled = false;
 
-            auto _ParseOSArch =
-            [&](appinfo_s::section_s::_kv_pair& kv) ->
-            app_record_s::CPUType
-            {
-              app_record_s::CPUType cpu_type = app_record_s::CPUType::Common;
-              int                   bits = -1;
+            if (pVac->enabled == -1)
+              pVac->enabled = false;
+          }
+          
+          else if (pAppRecord->details->extended_config.vac.enabled == -1)
+            pAppRecord->details->extended_config.vac.enabled = false;
 
-              // This key is an integer sometimes and a string others, it's a PITA!
-              if (kv.second.first == appinfo_s::section_s::String)
-              {
-                bits =
-                  *(char *)kv.second.second;
+          auto _ParseOSArch =
+          [&](appinfo_s::section_s::_kv_pair& kv) ->
+          app_record_s::CPUType
+          {
+            app_record_s::CPUType cpu_type = app_record_s::CPUType::Common;
+            int                   bits = -1;
 
-                if (bits == 0)
-                {
-                  cpu_type =
-                   app_record_s::CPUType::Any;
-                }
+            // This key is an integer sometimes and a string others, it's a PITA!
+            if (kv.second.first == appinfo_s::section_s::String)
+            {
+              bits =
+                *(char *)kv.second.second;
 
-                else
-                {
-                  bits =
-                    std::atoi ((char *)kv.second.second);
-                }
+              if (bits == 0)
+              {
+                cpu_type =
+                 app_record_s::CPUType::Any;
               }
 
-              if (bits != 0)
+              else
               {
-                // We have an int32 key, need to extract the value
-                if (bits == -1)
-                  bits = *(int32_t *)kv.second.second;
+                bits =
+                  std::atoi ((char *)kv.second.second);
+              }
+            }
 
-                // else
-                // ... Otherwise we already got the value as a string
+            if (bits != 0)
+            {
+              // We have an int32 key, need to extract the value
+              if (bits == -1)
+                bits = *(int32_t *)kv.second.second;
 
-                switch (bits)
-                {
-                  case 32:
-                    cpu_type =
-                      app_record_s::CPUType::x86;
-                    break;
-                  case 64:
-                    cpu_type =
-                      app_record_s::CPUType::x64;
-                    break;
-                  default:
-                    cpu_type =
-                      app_record_s::CPUType::Any;
-                    PLOG_ERROR << SK_FormatString ("Got unexpected (int32) CPU osarch=%lu", bits);
-                    break;
-                }
+              // else
+              // ... Otherwise we already got the value as a string
+
+              switch (bits)
+              {
+                case 32:
+                  cpu_type =
+                    app_record_s::CPUType::x86;
+                  break;
+                case 64:
+                  cpu_type =
+                    app_record_s::CPUType::x64;
+                  break;
+                default:
+                  cpu_type =
+                    app_record_s::CPUType::Any;
+                  PLOG_ERROR << SK_FormatString ("Got unexpected (int32) CPU osarch=%lu", bits);
+                  break;
               }
+            }
 
-              return cpu_type;
-            };
+            return cpu_type;
+          };
 
-            if ( populate_common &&
-                 0 ==
-                 finished_section.name.find ("appinfo.common") )
-            {
-              pAppRecord->common_config.appid = pAppRecord->id;
+          if ( populate_common &&
+               section.within (finished_section, path_common) )
+          {
+            pAppRecord->common_config.appid = pAppRecord->id;
 
-              for (auto& key : finished_section.keys)
+            for (auto& key : finished_section.keys)
+            {
+              // OS Arch? More like CPU Arch...
+              // 
+              // This key, under common_config, either:
+              //  - do not exist at all, see  23310: The Last Remnant           (what does this mean?)
+              //  -            is empty, see    480: Spacewar (or most games)   (what does this mean? x86?)
+              //  -      is set to "64", see 546560: Half-Life: Alyx
+              //
+              // This makes it utterly useless for anything reliable, lol
+              // 
+              // See SteamDB's unique values search:
+              // - https://steamdb.info/search/?a=app_keynames&type=-1&keyname=369&operator=9&keyvalue=&display_value=on
+
+              if (! _stricmp (key.first, "osarch"))
               {
-                // OS Arch? More like CPU Arch...
-                // 
-                // This key, under common_config, either:
-                //  - do not exist at all, see  23310: The Last Remnant           (what does this mean?)
-                //  -            is empty, see    480: Spacewar (or most games)   (what does this mean? x86?)
-                //  -      is set to "64", see 546560: Half-Life: Alyx
-                //
-                // This makes it utterly useless for anything reliable, lol
-                // 
-                // See SteamDB's unique values search:
-                // - https://steamdb.info/search/?a=app_keynames&type=-1&keyname=369&operator=9&keyvalue=&display_value=on
-
-                if (! _stricmp (key.first, "osarch"))
-                {
-                  pAppRecord->common_config.cpu_type =
-                    _ParseOSArch (key);
-                }
-                
-                else if (! _stricmp (key.first, "type"))
-                {
-                  if      (! _stricmp ((char *)key.second.second, "game"))
-                    pAppRecord->common_config.type =
-                      app_record_s::common_config_s::AppType::Game;
-                  else if (! _stricmp ((char *)key.second.second, "application"))
-                    pAppRecord->common_config.type =
-                      app_record_s::common_config_s::AppType::Application;
-                  else if (! _stricmp ((char *)key.second.second, "tool"))
-                    pAppRecord->common_config.type =
-                      app_record_s::common_config_s::AppType::Tool;
-                  else if (! _stricmp ((char *)key.second.second, "music"))
-                    pAppRecord->common_config.type =
-                      app_record_s::common_config_s::AppType::Music;
-                  else if (! _stricmp ((char *)key.second.second, "demo"))
-                    pAppRecord->common_config.type =
-                      app_record_s::common_config_s::AppType::Demo;
-                }
+                pAppRecord->common_config.cpu_type =
+                  _ParseOSArch (key);
+              }
+              
+              else if (! _stricmp (key.first, "type"))
+              {
+                if      (! _stricmp ((char *)key.second.second, "game"))
+                  pAppRecord->common_config.type =
+                    app_record_s::common_config_s::AppType::Game;
+                else if (! _stricmp ((char *)key.second.second, "application"))
+                  pAppRecord->common_config.type =
+                    app_record_s::common_config_s::AppType::Application;
+                else if (! _stricmp ((char *)key.second.second, "tool"))
+                  pAppRecord->common_config.type =
+                    app_record_s::common_config_s::AppType::Tool;
+                else if (! _stricmp ((char *)key.second.second, "music"))
+                  pAppRecord->common_config.type =
+                    app_record_s::common_config_s::AppType::Music;
+                else if (! _stricmp ((char *)key.second.second, "demo"))
+                  pAppRecord->common_config.type =
+                    app_record_s::common_config_s::AppType::Demo;
+              }
 
-                else if (! _stricmp (key.first, "icon"))
-                {
-                  pAppRecord->common_config.icon_hash = (char *)key.second.second;
-                }
+              else if (! _stricmp (key.first, "icon"))
+              {
+                pAppRecord->common_config.icon_hash = (char *)key.second.second;
               }
             }
+          }
 
-            if ( get_library_asset_paths &&
-                 finished_section.name._Equal ("appinfo.common.library_assets_full.library_capsule.image") )
+          if ( get_library_asset_paths &&
+               section.is (finished_section, path_capsule_image) )
+          {
+            bool found_english_asset = false;
+            for (auto& key : finished_section.keys)
             {
-              bool found_english_asset = false;
-              for (auto& key : finished_section.keys)
+              if (! _stricmp (key.first, "english"))
               {
-                if (! _stricmp (key.first, "english"))
-                {
-                  pAppRecord->common_config.boxart_hash = (const char*)key.second.second;
-                  found_english_asset = true;
-                  break;
-                }
+                pAppRecord->common_config.boxart_hash = (const char*)key.second.second;
+                found_english_asset = true;
+                break;
               }
+            }
 
-              if (! found_english_asset)
+            if (! found_english_asset)
+            {
+              // Since language is not known, just use the first language found
+              for (auto& key : finished_section.keys)
               {
-                // Since language is not known, just use the first language found
-                for (auto& key : finished_section.keys)
-                {
-                  pAppRecord->common_config.boxart_hash = (const char*)key.second.second;
-                  break;
-                }
+                pAppRecord->common_config.boxart_hash = (const char*)key.second.second;
+                break;
               }
-              get_library_asset_paths = false;
             }
+            get_library_asset_paths = false;
+          }
 
-            if ( populate_launch_configs &&
-                 0 ==
-                 finished_section.name.find ("appinfo.config.launch.")
-               )
+          if ( populate_launch_configs &&
+               section.under (finished_section, path_launch)
+             )
+          {
+            //PLOG_VERBOSE << "---------------------------";
+
+            int launch_idx_skif =
+              static_cast<int> (pAppRecord->launch_configs.size());
+            int launch_idx_steam = 0; // We do not currently actually use this for anything.
+                                      // It is also unreliable as developers can remove launch configs...
+
+            launch_idx_steam =
+              std::atoi (section.ancestor (finished_section, 3)->name);
+
+            // The index used solely for parsing
+            int idx = launch_idx_steam;
+
+            // Use the Steam launch key to workaround some parsing issue or another...
+            // TODO: Fix this shit -- it's a shitty workaround for stupid duplicate parsing!
+            //       AND it breaks Instant Play custom options... :(
+            auto& launch_cfg =
+              pAppRecord->launch_configs [launch_idx_steam]; 
+
+            launch_cfg.id       = launch_idx_skif;
+            launch_cfg.id_steam = launch_idx_steam;
+
+            // Holds Widechar strings (external)
+            const std::pair <const char*, std::wstring*>
+              wstring_map [] = {
+                { "executable",  &launch_cfg.executable     },
+                { "arguments",   &launch_cfg.launch_options },
+                { "description", &launch_cfg.description    },
+                { "workingdir",  &launch_cfg.working_dir    }
+              };
+
+            // Holds UTF8 strings (internal only)
+            const std::pair <const char*, std::string*>
+               string_map [] = {
+            //  { "betakey",     &launch_cfg.beta_key       }, // TODO: Fix this shit -- it's landing on the duplicate launch configs
+                { "ownsdlc",     &launch_cfg.requires_dlc   }
+              };
+
+            // Linear, but these tables are tiny and it avoids creating a std::string per key
+            auto _FindDest = [](const auto& map, const char* name)
             {
-              //PLOG_VERBOSE << "---------------------------";
-
-              int launch_idx_skif =
-                static_cast<int> (pAppRecord->launch_configs.size());
-              int launch_idx_steam = 0; // We do not currently actually use this for anything.
-                                        // It is also unreliable as developers can remove launch configs...
-
-              std::sscanf ( finished_section.name.c_str (),
-                              "appinfo.config.launch.%d", &launch_idx_steam);
-
-              // The index used solely for parsing
-              int idx = launch_idx_steam;
-
-              // Use the Steam launch key to workaround some parsing issue or another...
-              // TODO: Fix this shit -- it's a shitty workaround for stupid duplicate parsing!
-              //       AND it breaks Instant Play custom options... :(
-              auto& launch_cfg =
-                pAppRecord->launch_configs [launch_idx_steam]; 
-
-              launch_cfg.id       = launch_idx_skif;
-              launch_cfg.id_steam = launch_idx_steam;
-
-              // Holds Widechar strings (external)
-              std::unordered_map <std::string, std::wstring*>
-                wstring_map = {
-                  { "executable",  &launch_cfg.executable     },
-                  { "arguments",   &launch_cfg.launch_options },
-                  { "description", &launch_cfg.description    },
-                  { "workingdir",  &launch_cfg.working_dir    }
-                };
-
-              // Holds UTF8 strings (internal only)
-              std::unordered_map <std::string, std::string*>
-                 string_map = {
-              //  { "betakey",     &launch_cfg.beta_key       }, // TODO: Fix this shit -- it's landing on the duplicate launch configs
-                  { "ownsdlc",     &launch_cfg.requires_dlc   }
-                };
-
-              for (auto& key : finished_section.keys)
+              for (auto& entry : map)
               {
-                if (! _stricmp (key.first, "oslist"))
-                {
-                  if (StrStrIA ((const char *)key.second.second, "windows"))
-                  {
-                    app_record_s::addSupportFor (
-                      pAppRecord->launch_configs [idx].platforms,
-                                                app_record_s::Platform::Windows
-                      );
-                  }
+                if (! strcmp (entry.first, name))
+                  return entry.second;
+              }
 
-                  else
-                    pAppRecord->launch_configs [idx].platforms =
-                      app_record_s::Platform::Unknown;
-                }
+              return decltype (map [0].second) (nullptr);
+            };
 
-                else if (! _stricmp (key.first, "osarch"))
+            for (auto& key : finished_section.keys)
+            {
+              if (! _stricmp (key.first, "oslist"))
+              {
+                if (StrStrIA ((const char *)key.second.second, "windows"))
                 {
-                  // OS Arch? More like CPU Arch...
-                  pAppRecord->launch_configs [idx].cpu_type =
-                    _ParseOSArch (key);
+                  app_record_s::addSupportFor (
+                    pAppRecord->launch_configs [idx].platforms,
+                                              app_record_s::Platform::Windows
+                    );
                 }
 
-                else if (! _stricmp (key.first, "betakey"))
-                {
-                  // Populate required betas for this launch option
-                  std::istringstream betas((const char *)key.second.second);
-                  std::string beta;
-                  while (std::getline (betas, beta, ' '))
-                    pAppRecord->launch_configs [idx].branches.emplace (beta);
-                }
+                else
+                  pAppRecord->launch_configs [idx].platforms =
+                    app_record_s::Platform::Unknown;
+              }
 
-                else if (! _stricmp (key.first, "type"))
-                {
-                  if (! _stricmp ((char *)key.second.second,      "default"))
-                    pAppRecord->launch_configs [idx].type =
-                      app_record_s::launch_config_s::Type::Default;
+              else if (! _stricmp (key.first, "osarch"))
+              {
+                // OS Arch? More like CPU Arch...
+                pAppRecord->launch_configs [idx].cpu_type =
+                  _ParseOSArch (key);
+              }
 
-                  else if (! _stricmp ((char *)key.second.second, "option1"))
-                    pAppRecord->launch_configs [idx].type =
-                      app_record_s::launch_config_s::Type::Option1;
+              else if (! _stricmp (key.first, "betakey"))
+              {
+                // Populate required betas for this launch option
+                std::istringstream betas((const char *)key.second.second);
+                std::string beta;
+                while (std::getline (betas, beta, ' '))
+                  pAppRecord->launch_configs [idx].branches.emplace (beta);
+              }
 
-                  else if (! _stricmp ((char *)key.second.second, "option2"))
-                    pAppRecord->launch_configs [idx].type =
-                      app_record_s::launch_config_s::Type::Option2;
+              else if (! _stricmp (key.first, "type"))
+              {
+                if (! _stricmp ((char *)key.second.second,      "default"))
+                  pAppRecord->launch_configs [idx].type =
+                    app_record_s::launch_config_s::Type::Default;
 
-                  else if (! _stricmp ((char *)key.second.second, "option3"))
-                    pAppRecord->launch_configs [idx].type =
-                      app_record_s::launch_config_s::Type::Option3;
+                else if (! _stricmp ((char *)key.second.second, "option1"))
+                  pAppRecord->launch_configs [idx].type =
+                    app_record_s::launch_config_s::Type::Option1;
 
-                  else if (! _stricmp ((char *)key.second.second, "none"))
-                    pAppRecord->launch_configs [idx].type =
-                      app_record_s::launch_config_s::Type::Unspecified;
-                }
+                else if (! _stricmp ((char *)key.second.second, "option2"))
+                  pAppRecord->launch_configs [idx].type =
+                    app_record_s::launch_config_s::Type::Option2;
 
-                else if (wstring_map.count (key.first) != 0)
-                {
-                  auto& string_dest =
-                    wstring_map [key.first];
+                else if (! _stricmp ((char *)key.second.second, "option3"))
+                  pAppRecord->launch_configs [idx].type =
+                    app_record_s::launch_config_s::Type::Option3;
 
-                  *string_dest =
-                    SK_UTF8ToWideChar ((const char *)key.second.second);
-                }
+                else if (! _stricmp ((char *)key.second.second, "none"))
+                  pAppRecord->launch_configs [idx].type =
+                    app_record_s::launch_config_s::Type::Unspecified;
+              }
 
-                else if (string_map.count (key.first) != 0)
-                {
-                  auto& string_dest =
-                    string_map [key.first];
+              else if (auto wstring_dest = _FindDest (wstring_map, key.first))
+              {
+                *wstring_dest =
+                  SK_UTF8ToWideChar ((const char *)key.second.second);
+              }
 
-                  *string_dest =
-                    std::string ((const char *)key.second.second);
-                }
+              else if (auto string_dest = _FindDest (string_map, key.first))
+              {
+                *string_dest =
+                  std::string ((const char *)key.second.second);
               }
-              
-              // There is a really annoying bug in SKIF where parsing the launch configs results in semi-duplicate empty entries,
-              //   though I have no idea why... Maybe has to do with some "padding" between the sections in the appinfo.vdf file?
+            }
+            
+            // There is a really annoying bug in SKIF where parsing the launch configs results in semi-duplicate empty entries,
+            //   though I have no idea why... Maybe has to do with some "padding" between the sections in the appinfo.vdf file?
 
 #if 0
 
-              PLOG_VERBOSE << "Steam Launch ID   : " <<       launch_idx_steam;
-              PLOG_VERBOSE << "SKIF  Launch ID   : " <<       launch_idx_skif;
-              PLOG_VERBOSE << "Executable        : " <<       launch_cfg.executable;
-              PLOG_VERBOSE << "Arguments         : " <<       launch_cfg.launch_options;
-              PLOG_VERBOSE << "Working Directory : " <<       launch_cfg.working_dir;
-              PLOG_VERBOSE << "Launch Type       : " << (int) launch_cfg.type;
-              PLOG_VERBOSE << "Description       : " <<       launch_cfg.description;
-              PLOG_VERBOSE << "Operating System  : " << (int) launch_cfg.platforms;
-              PLOG_VERBOSE << "CPU Architecture  : " << (int) launch_cfg.cpu_type;
-              PLOG_VERBOSE << "Beta key          : " <<       launch_cfg.beta_key;
-              PLOG_VERBOSE << "Owns DLC          : " <<       launch_cfg.owns_dlc;
+            PLOG_VERBOSE << "Steam Launch ID   : " <<       launch_idx_steam;
+            PLOG_VERBOSE << "SKIF  Launch ID   : " <<       launch_idx_skif;
+            PLOG_VERBOSE << "Executable        : " <<       launch_cfg.executable;
+            PLOG_VERBOSE << "Arguments         : " <<       launch_cfg.launch_options;
+            PLOG_VERBOSE << "Working Directory : " <<       launch_cfg.working_dir;
+            PLOG_VERBOSE << "Launch Type       : " << (int) launch_cfg.type;
+            PLOG_VERBOSE << "Description       : " <<       launch_cfg.description;
+            PLOG_VERBOSE << "Operating System  : " << (int) launch_cfg.platforms;
+            PLOG_VERBOSE << "CPU Architecture  : " << (int) launch_cfg.cpu_type;
+            PLOG_VERBOSE << "Beta key          : " <<       launch_cfg.beta_key;
+            PLOG_VERBOSE << "Owns DLC          : " <<       launch_cfg.owns_dlc;
 
 #endif
 
-            }
           }
         }
+      }
 
-        // If the appinfo.vdf didn't contain library asset paths, default to standard path
-        if (get_library_asset_paths)
-        {
-          pAppRecord->common_config.boxart_hash = "library_600x900.jpg";
-        }
-
-        // At this point, since we used Steam's index as the position to stuff data into, the vector has
-        //   has objects all over -- some at 0, some at 1, others at 0-4, not 5, 6-9. Basically we cannot
-        //     be certain of anything, at all, what so bloody ever! So let's just recreate the std::map!
+      // If the appinfo.vdf didn't contain library asset paths, default to standard path
+      if (get_library_asset_paths)
+      {
+        pAppRecord->common_config.boxart_hash = "library_600x900.jpg";
+      }
 
-        std::vector <app_record_s::launch_config_s> _cleaner;
+      // At this point, since we used Steam's index as the position to stuff data into, the vector has
+      //   has objects all over -- some at 0, some at 1, others at 0-4, not 5, 6-9. Basically we cannot
+      //     be certain of anything, at all, what so bloody ever! So let's just recreate the std::map!
 
-        // Put away put away put away put away
-        for ( auto& keep : pAppRecord->launch_configs )
-          _cleaner.push_back (keep.second);
-        
-        // Clean clean clean clean!
-        pAppRecord->launch_configs.clear ();
+      std::vector <app_record_s::launch_config_s> _cleaner;
 
-        // Restore restore restore restore!
-        for ( auto& launch : _cleaner )
-        {
-          // Reset SKIF's internal identifer for the launch configs
-          launch.id = 
-            static_cast<int> (pAppRecord->launch_configs.size());
-
-          // Add it back
-          pAppRecord->launch_configs.emplace (
-            static_cast<int> (pAppRecord->launch_configs.size()),
-            launch);
-        }
-        // std::map is now reliable again!
+      // Put away put away put away put away
+      for ( auto& keep : pAppRecord->launch_configs )
+        _cleaner.push_back (keep.second);
+      
+      // Clean clean clean clean!
+      pAppRecord->launch_configs.clear ();
 
-        std::set    <std::wstring>          _used_executables;
-        std::set    <std::wstring>          _used_executables_arguments;
-        std::vector <app_record_s::launch_config_s> _launches;
+      // Restore restore restore restore!
+      for ( auto& launch : _cleaner )
+      {
+        // Reset SKIF's internal identifer for the launch configs
+        launch.id = 
+          static_cast<int> (pAppRecord->launch_configs.size());
+
+        // Add it back
+        pAppRecord->launch_configs.emplace (
+          static_cast<int> (pAppRecord->launch_configs.size()),
+          launch);
+      }
+      // std::map is now reliable again!
 
-        // Now add in our custom launch configs!
-        for (auto& custom_cfg : pAppRecord->launch_configs_custom)
-        {
-          custom_cfg.second.id =
-            static_cast<int> (pAppRecord->launch_configs.size());
+      std::set    <std::wstring>          _used_executables;
+      std::set    <std::wstring>          _used_executables_arguments;
+      std::vector <app_record_s::launch_config_s> _launches;
 
-          // Custom launch config, so Steam launch ID is nothing we use
-          custom_cfg.second.id_steam = -1;
+      // Now add in our custom launch configs!
+      for (auto& custom_cfg : pAppRecord->launch_configs_custom)
+      {
+        custom_cfg.second.id =
+          static_cast<int> (pAppRecord->launch_configs.size());
 
-          if (! pAppRecord->launch_configs.emplace (custom_cfg.second.id, custom_cfg.second).second)
-            PLOG_ERROR << "Failed adding a custom launch config to the launch map. An element at that position already exists!";
-        }
+        // Custom launch config, so Steam launch ID is nothing we use
+        custom_cfg.second.id_steam = -1;
 
-        // Clear out the custom launches once they've been populated
-        pAppRecord->launch_configs_custom.clear();
+        if (! pAppRecord->launch_configs.emplace (custom_cfg.second.id, custom_cfg.second).second)
+          PLOG_ERROR << "Failed adding a custom launch config to the launch map. An element at that position already exists!";
+      }
 
-        for ( auto& launch_cfg : pAppRecord->launch_configs )
-        {
-          auto& launch = launch_cfg.second;
+      // Clear out the custom launches once they've been populated
+      pAppRecord->launch_configs_custom.clear();
 
-          // Summarize the branches in a comma-delimited string as well
-          if (! launch.branches.empty())
-          {
-            for (auto const& branch : launch.branches)
-              launch.branches_joined += branch + ", ";
+      for ( auto& launch_cfg : pAppRecord->launch_configs )
+      {
+        auto& launch = launch_cfg.second;
 
-            // Remove trailing comma and space
-            launch.branches_joined.pop_back();
-            launch.branches_joined.pop_back();
-          }
+        // Summarize the branches in a comma-delimited string as well
+        if (! launch.branches.empty())
+        {
+          for (auto const& branch : launch.branches)
+            launch.branches_joined += branch + ", ";
 
-          // Filter launch configurations for other OSes
-          if ( (! app_record_s::supports (launch.platforms,
-                                   app_record_s::Platform::Windows) ))
-            continue;
+          // Remove trailing comma and space
+          launch.branches_joined.pop_back();
+          launch.branches_joined.pop_back();
+        }
 
-          // Filter launch configurations lacking an executable
-          // This also skips all the semi-weird duplicate launch configs SKIF randomly creates
-          if (launch.executable.empty())
-            continue;
+        // Filter launch configurations for other OSes
+        if ( (! app_record_s::supports (launch.platforms,
+                                 app_record_s::Platform::Windows) ))
+          continue;
 
-          // Filter launch configurations requiring a beta branch that the user do not have
-          if (! launch.branches.empty() && launch.branches.count (pAppRecord->steam.branch) == 0)
-            launch.valid = 0;
+        // Filter launch configurations lacking an executable
+        // This also skips all the semi-weird duplicate launch configs SKIF randomly creates
+        if (launch.executable.empty())
+          continue;
 
-          // File extension, so we can flag out non-executable ones (e.g. link2ea)
-          const wchar_t* pwszExtension =
-            PathFindExtension (launch.executable.c_str());
+        // Filter launch configurations requiring a beta branch that the user do not have
+        if (! launch.branches.empty() && launch.branches.count (pAppRecord->steam.branch) == 0)
+          launch.valid = 0;
 
-          // If we cannot find an extension, or if it's not .exe, flag the launch config as invalid
-          if (pwszExtension == NULL || (pwszExtension + 1) == NULL || _wcsicmp (pwszExtension, L".exe") != 0)
-            launch.valid = 0;
+        // File extension, so we can flag out non-executable ones (e.g. link2ea)
+        const wchar_t* pwszExtension =
+          PathFindExtension (launch.executable.c_str());
 
-          // Clean valid executable paths
-          if (launch.valid)
-            launch.executable = std::filesystem::path(launch.executable).lexically_normal();
+        // If we cannot find an extension, or if it's not .exe, flag the launch config as invalid
+        if (pwszExtension == NULL || (pwszExtension + 1) == NULL || _wcsicmp (pwszExtension, L".exe") != 0)
+          launch.valid = 0;
 
-          // Flag duplicates...
-          //   but not if we found them as not valid above (as that would filter out custom launch configs that matches beta launch configs...)
-          if (launch.isExecutableFileNameValid() && launch.valid)
-          {
-            // Use the executable to identify duplicates (affects Disable Special K menu)
-            if (! _used_executables.emplace (launch.getExecutableFileName()).second)
-              launch.duplicate_exe = true;
+        // Clean valid executable paths
+        if (launch.valid)
+          launch.executable = std::filesystem::path(launch.executable).lexically_normal();
 
-            // Use a combination of the executable and arguments to identify duplicates (affects Instant Play menu)
-            if (! _used_executables_arguments.emplace (launch.getExecutableFileName() + launch.getLaunchOptions()).second)
-              launch.duplicate_exe_args = true;
-          }
+        // Flag duplicates...
+        //   but not if we found them as not valid above (as that would filter out custom launch configs that matches beta launch configs...)
+        if (launch.isExecutableFileNameValid() && launch.valid)
+        {
+          // Use the executable to identify duplicates (affects Disable Special K menu)
+          if (! _used_executables.emplace (launch.getExecutableFileName()).second)
+            launch.duplicate_exe = true;
 
-          // Working dir = empty, ., / or \ all need fixups
-          if ( wcslen (launch.working_dir.c_str ()) < 2 )
-          {
-            if ( launch.working_dir [0] == L'/'  ||
-                 launch.working_dir [0] == L'\\' ||
-                 launch.working_dir [0] == L'.'  ||
-                 launch.working_dir [0] == L'\0' )
-            {
-              launch.working_dir.clear();
-            }
-          }
+          // Use a combination of the executable and arguments to identify duplicates (affects Instant Play menu)
+          if (! _used_executables_arguments.emplace (launch.getExecutableFileName() + launch.getLaunchOptions()).second)
+            launch.duplicate_exe_args = true;
+        }
 
-          // Fix working directories
-          // TODO: Test this out properly with games with different working directories set!
-          //       See if there's any games that uses different working directories between launch configs, but otherwise the same executable and cmd-line arguments!
-          if (! launch.working_dir.empty())
+        // Working dir = empty, ., / or \ all need fixups
+        if ( wcslen (launch.working_dir.c_str ()) < 2 )
+        {
+          if ( launch.working_dir [0] == L'/'  ||
+               launch.working_dir [0] == L'\\' ||
+               launch.working_dir [0] == L'.'  ||
+               launch.working_dir [0] == L'\0' )
           {
-            launch.working_dir = std::wstring (pAppRecord->install_dir + LR"(\)" + launch.working_dir + L"\0\0");
-            launch.working_dir = std::filesystem::path(launch.working_dir).lexically_normal();
+            launch.working_dir.clear();
           }
-
-          // Flag the launch config to be added back
-          _launches.push_back (launch);
         }
-        
-        pAppRecord->launch_configs.clear ();
 
-        for ( auto& launch : _launches )
+        // Fix working directories
+        // TODO: Test this out properly with games with different working directories set!
+        //       See if there's any games that uses different working directories between launch configs, but otherwise the same executable and cmd-line arguments!
+        if (! launch.working_dir.empty())
         {
-          // Reset SKIF's internal identifer for the launch configs
-          launch.id = 
-            static_cast<int> (pAppRecord->launch_configs.size());
-          
+          launch.working_dir = std::wstring (pAppRecord->install_dir + LR"(\)" + launch.working_dir + L"\0\0");
+          launch.working_dir = std::filesystem::path(launch.working_dir).lexically_normal();
+        }
+
+        // Flag the launch config to be added back
+        _launches.push_back (launch);
+      }
+      
+      pAppRecord->launch_configs.clear ();
+
+      for ( auto& launch : _launches )
+      {
+        // Reset SKIF's internal identifer for the launch configs
+        launch.id = 
+          static_cast<int> (pAppRecord->launch_configs.size());
+        
 #if 0
 
-          PLOG_VERBOSE << "SKIF  Launch ID   : " <<       launch.id;
-          PLOG_VERBOSE << "Steam Launch ID   : " <<       launch.id_steam;
-          PLOG_VERBOSE << "Executable        : " <<       launch.executable;
-          PLOG_VERBOSE << "Arguments         : " <<       launch.launch_options;
-          PLOG_VERBOSE << "Working Directory : " <<       launch.working_dir;
-          PLOG_VERBOSE << "Launch Type       : " << (int) launch.type;
-          PLOG_VERBOSE << "Description       : " <<       launch.description;
-          PLOG_VERBOSE << "Operating System  : " << (int) launch.platforms;
-          PLOG_VERBOSE << "CPU Architecture  : " << (int) launch.cpu_type;
-          PLOG_VERBOSE << "Beta key          : " <<       launch.beta_key;
-          PLOG_VERBOSE << "Owns DLC          : " <<       launch.owns_dlc;
+        PLOG_VERBOSE << "SKIF  Launch ID   : " <<       launch.id;
+        PLOG_VERBOSE << "Steam Launch ID   : " <<       launch.id_steam;
+        PLOG_VERBOSE << "Executable        : " <<       launch.executable;
+        PLOG_VERBOSE << "Arguments         : " <<       launch.launch_options;
+        PLOG_VERBOSE << "Working Directory : " <<       launch.working_dir;
+        PLOG_VERBOSE << "Launch Type       : " << (int) launch.type;
+        PLOG_VERBOSE << "Description       : " <<       launch.description;
+        PLOG_VERBOSE << "Operating System  : " << (int) launch.platforms;
+        PLOG_VERBOSE << "CPU Architecture  : " << (int) launch.cpu_type;
+        PLOG_VERBOSE << "Beta key          : " <<       launch.beta_key;
+        PLOG_VERBOSE << "Owns DLC          : " <<       launch.owns_dlc;
 
 #endif
 
-          // Add it back
-          pAppRecord->launch_configs.emplace (
-            static_cast<int> (pAppRecord->launch_configs.size()),
-            launch);
-        }
-
-        // Naively move the first Default launch config type to the front
-        int firstValidFound = -1;
+        // Add it back
+        pAppRecord->launch_configs.emplace (
+          static_cast<int> (pAppRecord->launch_configs.size()),
+          launch);
+      }
 
-        for (auto& launch : pAppRecord->launch_configs)
-        {
-          // Ignore launch options requiring a beta key
-          // TODO: Contemplate this choice now that SKIF can read current beta!
-          if (! launch.second.branches.empty())
-            continue;
+      // Naively move the first Default launch config type to the front
+      int firstValidFound = -1;
 
-          if (launch.second.type == app_record_s::launch_config_s::Type::Default)
-          {
-            firstValidFound = launch.first;
-            break;
-          }
-        }
+      for (auto& launch : pAppRecord->launch_configs)
+      {
+        // Ignore launch options requiring a beta key
+        // TODO: Contemplate this choice now that SKIF can read current beta!
+        if (! launch.second.branches.empty())
+          continue;
 
-        if (firstValidFound != -1)
+        if (launch.second.type == app_record_s::launch_config_s::Type::Default)
         {
-          app_record_s::launch_config_s copy             = pAppRecord->launch_configs[0];
-          pAppRecord->launch_configs[0]                  = pAppRecord->launch_configs[firstValidFound];
-          pAppRecord->launch_configs[firstValidFound]    = copy;
-
-          // Swap the internal identifers that SKIF uses (default becomes 0, not-default becomes not)
-          int copy_id                                    = pAppRecord->launch_configs[0].id;
-          pAppRecord->launch_configs[0].id               = 0;
-          pAppRecord->launch_configs[firstValidFound].id = copy_id;
+          firstValidFound = launch.first;
+          break;
         }
+      }
+
+      if (firstValidFound != -1)
+      {
+        app_record_s::launch_config_s copy             = pAppRecord->launch_configs[0];
+        pAppRecord->launch_configs[0]                  = pAppRecord->launch_configs[firstValidFound];
+        pAppRecord->launch_configs[firstValidFound]    = copy;
+
+        // Swap the internal identifers that SKIF uses (default becomes 0, not-default becomes not)
+        int copy_id                                    = pAppRecord->launch_configs[0].id;
+        pAppRecord->launch_configs[0].id               = 0;
+        pAppRecord->launch_configs[firstValidFound].id = copy_id;
+      }
 #if 0
 
-        for (auto& launch : pAppRecord->launch_configs)
-        {
-          PLOG_VERBOSE << "SKIF  Launch ID   : " <<       launch.second.id;
-          PLOG_VERBOSE << "Steam Launch ID   : " <<       launch.second.id_steam;
-          PLOG_VERBOSE << "Executable        : " <<       launch.second.executable;
-          PLOG_VERBOSE << "Arguments         : " <<       launch.second.launch_options;
-          PLOG_VERBOSE << "Working Directory : " <<       launch.second.working_dir;
-          PLOG_VERBOSE << "Launch Type       : " << (int) launch.second.type;
-          PLOG_VERBOSE << "Description       : " <<       launch.second.description;
-          PLOG_VERBOSE << "Operating System  : " << (int) launch.second.platforms;
-          PLOG_VERBOSE << "CPU Architecture  : " << (int) launch.second.cpu_type;
-          PLOG_VERBOSE << "Beta key          : " <<       launch.second.beta_key;
-          PLOG_VERBOSE << "Owns DLC          : " <<       launch.second.owns_dlc;
-        }
+      for (auto& launch : pAppRecord->launch_configs)
+      {
+        PLOG_VERBOSE << "SKIF  Launch ID   : " <<       launch.second.id;
+        PLOG_VERBOSE << "Steam Launch ID   : " <<       launch.second.id_steam;
+        PLOG_VERBOSE << "Executable        : " <<       launch.second.executable;
+        PLOG_VERBOSE << "Arguments         : " <<       launch.second.launch_options;
+        PLOG_VERBOSE << "Working Directory : " <<       launch.second.working_dir;
+        PLOG_VERBOSE << "Launch Type       : " << (int) launch.second.type;
+        PLOG_VERBOSE << "Description       : " <<       launch.second.description;
+        PLOG_VERBOSE << "Operating System  : " << (int) launch.second.platforms;
+        PLOG_VERBOSE << "CPU Architecture  : " << (int) launch.second.cpu_type;
+        PLOG_VERBOSE << "Beta key          : " <<       launch.second.beta_key;
+        PLOG_VERBOSE << "Owns DLC          : " <<       launch.second.owns_dlc;
+      }
 
 #endif
 
-        std::map <std::string, std::wstring> roots = {
-          { "WinMyDocuments",        _path_cache.my_documents.path          },
-          { "WinAppDataLocal",       _path_cache.app_data_local.path        },
-          { "WinAppDataLocalLow",    _path_cache.app_data_local_low.path    },
-          { "WinAppDataRoaming",     _path_cache.app_data_roaming.path      },
-          { "WinSavedGames",         _path_cache.win_saved_games.path       },
-          { "App Install Directory", pAppRecord->install_dir                },
-          { "gameinstall",           pAppRecord->install_dir                },
-          { "SteamCloudDocuments",   L"<Steam Cloud Docs>"                  }
-        };
+      std::map <std::string, std::wstring> roots = {
+        { "WinMyDocuments",        _path_cache.my_documents.path          },
+        { "WinAppDataLocal",       _path_cache.app_data_local.path        },
+        { "WinAppDataLocalLow",    _path_cache.app_data_local_low.path    },
+        { "WinAppDataRoaming",     _path_cache.app_data_roaming.path      },
+        { "WinSavedGames",         _path_cache.win_saved_games.path       },
+        { "App Install Directory", pAppRecord->install_dir                },
+        { "gameinstall",           pAppRecord->install_dir                },
+        { "SteamCloudDocuments",   L"<Steam Cloud Docs>"                  }
+      };
 
-        std::wstring account_id_str   = L"anonymous";
+      std::wstring account_id_str   = L"anonymous";
 
-        std::wstring cloud_path       =
-          SK_FormatStringW (      LR"(%ws\userdata\%ws\%d\)",
-              _path_cache.steam_install, account_id_str.c_str (),
-                                             appid );
+      std::wstring cloud_path       =
+        SK_FormatStringW (      LR"(%ws\userdata\%ws\%d\)",
+            _path_cache.steam_install, account_id_str.c_str (),
+                                           appid );
 
-        roots ["SteamCloudDocuments"] =
-          cloud_path;
+      roots ["SteamCloudDocuments"] =
+        cloud_path;
 
-        for (auto& finished_section : section.finished_sections)
-        {
-          if (finished_section.keys.empty ())
-            continue;
+      for (auto idx : section.finished_sections)
+      {
+        auto& finished_section =
+          section.at (idx);
 
-          if (pAppRecord != nullptr)
+        if (finished_section.keys.empty ())
+          continue;
+
+        if (pAppRecord != nullptr)
+        {
+          if ( populate_cloud_saves &&
+                   section.under (finished_section, path_rootoverrides) )
           {
-            if ( populate_cloud_saves &&
-                   0 ==
-                     finished_section.name.find ("appinfo.ufs.rootoverrides.") )
+            std::wstring ufs_root;
+            std::wstring use_instead;
+            std::wstring add_path;
+
+            std::unordered_map <std::string, std::wstring*>
+              string_map = {
+                { "root",       &ufs_root    },
+                { "useinstead", &use_instead },
+                { "addpath",    &add_path    }
+              };
+
+            for ( auto& key : finished_section.keys )
             {
-              std::wstring ufs_root;
-              std::wstring use_instead;
-              std::wstring add_path;
-
-              std::unordered_map <std::string, std::wstring*>
-                string_map = {
-                  { "root",       &ufs_root    },
-                  { "useinstead", &use_instead },
-                  { "addpath",    &add_path    }
-                };
-
-              for ( auto& key : finished_section.keys )
+              if (! _stricmp (key.first, "os"))
               {
-                if (! _stricmp (key.first, "os"))
+                if (_stricmp ((char *)key.second.second, "windows"))
                 {
-                  if (_stricmp ((char *)key.second.second, "windows"))
-                  {
-                    ufs_root.clear    ();
-                    add_path.clear    ();
-                    use_instead.clear ();
-                    break;
-                  }
+                  ufs_root.clear    ();
+                  add_path.clear    ();
+                  use_instead.clear ();
+                  break;
                 }
+              }
 
-                else
-                {
-                  std::wstring* pStr = nullptr;
+              else
+              {
+                std::wstring* pStr = nullptr;
 
-                  auto it =
-                    string_map.find (key.first);
+                auto it =
+                  string_map.find (key.first);
 
-                  if (it != string_map.cend ())
-                    pStr = it->second;
+                if (it != string_map.cend ())
+                  pStr = it->second;
 
-                  if (pStr != nullptr)
-                     *pStr = SK_UTF8ToWideChar ((char *)key.second.second);
+                if (pStr != nullptr)
+                   *pStr = SK_UTF8ToWideChar ((char *)key.second.second);
 
-                  if (pStr == &add_path)
-                    add_path += LR"(\)";
-                }
+                if (pStr == &add_path)
+                  add_path += LR"(\)";
               }
+            }
 
-              if (! ufs_root.empty ())
-              {
-                auto utf8_ufs_root =
-                  SK_WideCharToUTF8 (ufs_root);
+            if (! ufs_root.empty ())
+            {
+              auto utf8_ufs_root =
+                SK_WideCharToUTF8 (ufs_root);
 
-                if (! use_instead.empty ())
-                { // Some games have overrides that don't override anything
-                  if (! use_instead._Equal (ufs_root))
-                  {
-                    auto utf8_use_instead =
-                      SK_WideCharToUTF8 (use_instead);
+              if (! use_instead.empty ())
+              { // Some games have overrides that don't override anything
+                if (! use_instead._Equal (ufs_root))
+                {
+                  auto utf8_use_instead =
+                    SK_WideCharToUTF8 (use_instead);
 
-                    roots [utf8_ufs_root] = roots.count (utf8_use_instead) != 0 ?
-                                                  roots [utf8_use_instead]      :
-                                                              use_instead;
-                  }
+                  roots [utf8_ufs_root] = roots.count (utf8_use_instead) != 0 ?
+                                                roots [utf8_use_instead]      :
+                                                            use_instead;
                 }
+              }
 
-                if (! add_path.empty ())
-                {
-                  roots [utf8_ufs_root] += add_path;
-                }
+              if (! add_path.empty ())
+              {
+                roots [utf8_ufs_root] += add_path;
               }
             }
+          }
 
-            if ( populate_branches &&
-                                 0 ==
-                   finished_section.name.find ("appinfo.depots.branches."))
-            {
-              std::string branch_name =
-                finished_section.name.substr (24);
+          if ( populate_branches &&
+                 section.under (finished_section, path_branches) )
+          {
+            std::string branch_name =
+              section.getPath (finished_section, 3);
 
-              auto *branch_ptr =
-                &pAppRecord->branches [branch_name];
+            auto *branch_ptr =
+              &pAppRecord->details->branches [branch_name];
 
 
-              static const
-                std::unordered_map <std::string, ptrdiff_t>
-                  int_map = {
-                    { "buildid",     offsetof (app_record_s::branch_record_s, build_id)     },
-                    { "pwdrequired", offsetof (app_record_s::branch_record_s, pwd_required) },
-                    { "timeupdated", offsetof (app_record_s::branch_record_s, time_updated) }
-                  };
+            static const
+              std::unordered_map <std::string, ptrdiff_t>
+                int_map = {
+                  { "buildid",     offsetof (app_record_s::branch_record_s, build_id)     },
+                  { "pwdrequired", offsetof (app_record_s::branch_record_s, pwd_required) },
+                  { "timeupdated", offsetof (app_record_s::branch_record_s, time_updated) }
+                };
 
-              static const
-                std::unordered_map <std::string, ptrdiff_t>
-                  str_map = {
-                    { "description", offsetof (app_record_s::branch_record_s, description) }
-                  };
+            static const
+              std::unordered_map <std::string, ptrdiff_t>
+                str_map = {
+                  { "description", offsetof (app_record_s::branch_record_s, description) }
+                };
 
-              int matches = 0;
+            int matches = 0;
 
-              for ( auto& key : finished_section.keys )
-              {
-                auto pInt =
-                  int_map.find (key.first);
+            for ( auto& key : finished_section.keys )
+            {
+              auto pInt =
+                int_map.find (key.first);
 
-                if (pInt != int_map.cend ())
-                  *(uint32_t *)VOID_OFFSET (branch_ptr,pInt->second) =
-                    *(uint32_t *)key.second.second, ++matches;
+              if (pInt != int_map.cend ())
+                *(uint32_t *)VOID_OFFSET (branch_ptr,pInt->second) =
+                  *(uint32_t *)key.second.second, ++matches;
 
-                else
-                {
-                  auto pStr =
-                    str_map.find (key.first);
-
-                  if (pStr != str_map.cend ()) {
-                     *(std::wstring *)VOID_OFFSET (branch_ptr,pStr->second) =
-                       SK_UTF8ToWideChar (
-                         (char *)key.second.second
-                       ), ++matches;
-                  }
+              else
+              {
+                auto pStr =
+                  str_map.find (key.first);
+
+                if (pStr != str_map.cend ()) {
+                   *(std::wstring *)VOID_OFFSET (branch_ptr,pStr->second) =
+                     SK_UTF8ToWideChar (
+                       (char *)key.second.second
+                     ), ++matches;
                 }
               }
-
-              if (matches > 0)
-                pAppRecord->branches       [branch_name].parent = pAppRecord;
-              else
-                pAppRecord->branches.erase (branch_name);
             }
+
+            if (matches > 0)
+              pAppRecord->details->branches [branch_name].parent = pAppRecord;
+            else
+              pAppRecord->details->branches.erase (branch_name);
           }
         }
+      }
 
-        for ( auto& finished_section : section.finished_sections )
+      for (auto idx : section.finished_sections)
+      {
+        auto& finished_section =
+          section.at (idx);
+
+        if (finished_section.keys.empty ())
+          continue;
+
+        if (pAppRecord != nullptr)
         {
-          if (finished_section.keys.empty ())
-            continue;
+          if ( populate_cloud_saves &&
+                 section.within (finished_section, path_ufs) )
 
-          if (pAppRecord != nullptr)
           {
-            if ( populate_cloud_saves &&
-                                    0 ==
-                   finished_section.name.find ("appinfo.ufs") )
-
+            if (section.is (finished_section, path_ufs))
             {
-              if (finished_section.name._Equal ("appinfo.ufs"))
+              for ( auto& ufs_key : finished_section.keys )
               {
-                for ( auto& ufs_key : finished_section.keys )
+                if (! _stricmp (ufs_key.first, "hidecloudui"))
                 {
-                  if (! _stricmp (ufs_key.first, "hidecloudui"))
-                  {
-                    pAppRecord->cloud_enabled =
-                      (*(uint32_t *)ufs_key.second.second) == 0;
-                  }
+                  pAppRecord->cloud_enabled =
+                    (*(uint32_t *)ufs_key.second.second) == 0;
                 }
               }
+            }
 
-              else if (0 == finished_section.name.find ("appinfo.ufs.savefiles."))
-              {
-                int cloud_idx = 0;
-
-                std::sscanf (
-                  finished_section.name.c_str (),
-                    "appinfo.ufs.savefiles.%d",
-                      &cloud_idx
-                );
-
-                static const
-                  std::unordered_map <std::string, app_record_s::Platform>
-                    platform_map = {
-                      { "windows", app_record_s::Platform::Windows },
-                      { "linux",   app_record_s::Platform::Linux   },
-                      { "mac",     app_record_s::Platform::Mac     },
-                      { "all",     app_record_s::Platform::All     }
-                    };
+            else if (section.under (finished_section, path_savefiles))
+            {
+              int cloud_idx =
+                std::atoi (section.ancestor (finished_section, 3)->name);
 
-                if (finished_section.name.find ("platforms") != std::string::npos)
+              static const
+                std::unordered_map <std::string, app_record_s::Platform>
+                  platform_map = {
+                    { "windows", app_record_s::Platform::Windows },
+                    { "linux",   app_record_s::Platform::Linux   },
+                    { "mac",     app_record_s::Platform::Mac     },
+                    { "all",     app_record_s::Platform::All     }
+                  };
+
+              if (strstr (finished_section.name, "platforms") != nullptr)
+              {
+                for (auto& platform : finished_section.keys)
                 {
-                  for (auto& platform : finished_section.keys)
+                  if (pAppRecord->details->cloud_saves.count (cloud_idx) != 0)
                   {
-                    if (pAppRecord->cloud_saves.count (cloud_idx) != 0)
+                    try
                     {
-                      try
-                      {
-                        pAppRecord->cloud_saves [cloud_idx].platforms =
-                          platform_map.at ((const char *)platform.second.second);
-                      }
-                      catch (const std::out_of_range& e) { UNREFERENCED_PARAMETER (e); };
+                      pAppRecord->details->cloud_saves [cloud_idx].platforms =
+                        platform_map.at ((const char *)platform.second.second);
                     }
+                    catch (const std::out_of_range& e) { UNREFERENCED_PARAMETER (e); };
                   }
                 }
+              }
 
-                else
+              else
+              {
+                for (auto& key : finished_section.keys)
                 {
-                  for (auto& key : finished_section.keys)
+                  if (! _stricmp (key.first, "root"))
                   {
-                    if (! _stricmp (key.first, "root"))
-                    {
-                      pAppRecord->cloud_saves [cloud_idx].root =
-                        roots [(const char *)key.second.second];
-                    }
+                    pAppRecord->details->cloud_saves [cloud_idx].root =
+                      roots [(const char *)key.second.second];
+                  }
 
-                    else if (! _stricmp (key.first, "path"))
+                  else if (! _stricmp (key.first, "path"))
+                  {
+                    auto replaceSpecialValues = []
+                    (       std::wstring& str,
+                      const std::wstring& special,
+                      const std::wstring& substitute )
                     {
-                      auto replaceSpecialValues = []
-                      (       std::wstring& str,
-                        const std::wstring& special,
-                        const std::wstring& substitute )
+                      if (special.empty ())
+                        return;
+
+                      size_t start_pos = 0;
+
+                      while ((start_pos = str.find (special, start_pos)) != std::string::npos)
                       {
-                        if (special.empty ())
-                          return;
+                        str.replace (
+                          start_pos, special.length (),
+                          substitute
+                        );
+                        start_pos += substitute.length ();
+                      }
+                    };
 
-                        size_t start_pos = 0;
+                    auto& rkCloudSave =
+                      pAppRecord->details->cloud_saves [cloud_idx];
 
-                        while ((start_pos = str.find (special, start_pos)) != std::string::npos)
+                    rkCloudSave.path =
+                      SK_UTF8ToWideChar ((const char *)key.second.second);
+
+                    static unsigned long Steam3AccountID = 0UL;
+                    static uint64        Steam64BitID    = 0ULL;
+
+                    static auto
+                      CacheAccountIDs =
+                       [&](void)
                         {
-                          str.replace (
-                            start_pos, special.length (),
-                            substitute
-                          );
-                          start_pos += substitute.length ();
-                        }
-                      };
-
-                      auto& rkCloudSave =
-                        pAppRecord->cloud_saves [cloud_idx];
-
-                      rkCloudSave.path =
-                        SK_UTF8ToWideChar ((const char *)key.second.second);
-
-                      static unsigned long Steam3AccountID = 0UL;
-                      static uint64        Steam64BitID    = 0ULL;
-
-                      static auto
-                        CacheAccountIDs =
-                         [&](void)
+                          WCHAR                    szData [255] = { };
+                          DWORD   dwSize = sizeof (szData);
+                          PVOID   pvData =         szData;
+                          CRegKey hKey ((HKEY)0);
+
+                          if (RegOpenKeyExW (HKEY_CURRENT_USER, LR"(SOFTWARE\Valve\Steam\ActiveProcess\)", 0, KEY_READ, &hKey.m_hKey) == ERROR_SUCCESS)
                           {
-                            WCHAR                    szData [255] = { };
-                            DWORD   dwSize = sizeof (szData);
-                            PVOID   pvData =         szData;
-                            CRegKey hKey ((HKEY)0);
-
-                            if (RegOpenKeyExW (HKEY_CURRENT_USER, LR"(SOFTWARE\Valve\Steam\ActiveProcess\)", 0, KEY_READ, &hKey.m_hKey) == ERROR_SUCCESS)
-                            {
-                              if (RegGetValueW (hKey, NULL, L"ActiveUser", RRF_RT_REG_DWORD, NULL, pvData, &dwSize) == ERROR_SUCCESS)
-                                Steam3AccountID = *(DWORD*)pvData;
-                            }
-
-                            Steam64BitID = std::stoull (
-                              SK_UseManifestToGetAppOwner (pAppRecord));
-                          };
-
-                        SK_RunOnce (
-                          CacheAccountIDs ()
-                        );
+                            if (RegGetValueW (hKey, NULL, L"ActiveUser", RRF_RT_REG_DWORD, NULL, pvData, &dwSize) == ERROR_SUCCESS)
+                              Steam3AccountID = *(DWORD*)pvData;
+                          }
 
-                      replaceSpecialValues ( rkCloudSave.path,
-                                             L"{64BitSteamID}",
-                               std::to_wstring (Steam64BitID) );
+                          Steam64BitID = std::stoull (
+                            SK_UseManifestToGetAppOwner (pAppRecord));
+                        };
 
-                      replaceSpecialValues ( rkCloudSave.path,
-                                                          L"{Steam3AccountID}",
-                                            std::to_wstring (Steam3AccountID) );
-                    }
+                      // Other threads must wait for the IDs rather than read zeroes
+                      SK_RunOnceEx (
+                        CacheAccountIDs
+                      );
+
+                    replaceSpecialValues ( rkCloudSave.path,
+                                           L"{64BitSteamID}",
+                             std::to_wstring (Steam64BitID) );
+
+                    replaceSpecialValues ( rkCloudSave.path,
+                                                        L"{Steam3AccountID}",
+                                          std::to_wstring (Steam3AccountID) );
                   }
                 }
               }
             }
           }
+        }
 
 #ifdef _WRITE_APPID_INI
-          fprintf (fTest, "[%s]\n", finished_section.name.c_str ());
+        fprintf (fTest, "[%s]\n", section.getPath (finished_section).c_str ());
 
-          for ( auto& datum : finished_section.keys )
-          {
-            if (datum.second.first == appinfo_s::section_s::String)
-              fprintf (fTest, "%s=%s\n",   datum.first,  (char     *)datum.second.second);
-            else if (datum.second.first == appinfo_s::section_s::Int32)
-              fprintf (fTest, "%s=%lu\n",  datum.first, *(uint32_t *)datum.second.second);
-            else if (datum.second.first == appinfo_s::section_s::Int64)
-              fprintf (fTest, "%s=%llu\n", datum.first, *(uint64_t *)datum.second.second);
-          }
-          fprintf (fTest, "\n");
-#endif
+        for ( auto& datum : finished_section.keys )
+        {
+          if (datum.second.first == appinfo_s::section_s::String)
+            fprintf (fTest, "%s=%s\n",   datum.first,  (char     *)datum.second.second);
+          else if (datum.second.first == appinfo_s::section_s::Int32)
+            fprintf (fTest, "%s=%lu\n",  datum.first, *(uint32_t *)datum.second.second);
+          else if (datum.second.first == appinfo_s::section_s::Int64)
+            fprintf (fTest, "%s=%llu\n", datum.first, *(uint64_t *)datum.second.second);
         }
+        fprintf (fTest, "\n");
+#endif
+      }
 
-        if (pAppRecord != nullptr)
-        {
-          std::set <std::wstring> _used_paths;
+      if (pAppRecord != nullptr)
+      {
+        std::set <std::wstring> _used_paths;
 
-          for ( auto& cloud_save : pAppRecord->cloud_saves )
-          {
-            // This only needs to be done once per-game, per-cloud path
-            if (! cloud_save.second.evaluated_dir.empty ())
-              continue;
+        for ( auto& cloud_save : pAppRecord->details->cloud_saves )
+        {
+          // This only needs to be done once per-game, per-cloud path
+          if (! cloud_save.second.evaluated_dir.empty ())
+            continue;
 
-            wchar_t     wszTestPath [MAX_PATH + 2] = { };
-            wnsprintf ( wszTestPath, MAX_PATH,
-                          L"%s\\%s", cloud_save.second.root.c_str (),
-                                     cloud_save.second.path.c_str () );
+          wchar_t     wszTestPath [MAX_PATH + 2] = { };
+          wnsprintf ( wszTestPath, MAX_PATH,
+                        L"%s\\%s", cloud_save.second.root.c_str (),
+                                   cloud_save.second.path.c_str () );
 
-            SK_FixSlashesW           (wszTestPath);
-            SK_StripTrailingSlashesW (wszTestPath);
-            SK_StripLeadingSlashesW  (wszTestPath);
+          SK_FixSlashesW           (wszTestPath);
+          SK_StripTrailingSlashesW (wszTestPath);
+          SK_StripLeadingSlashesW  (wszTestPath);
 
-            cloud_save.second.evaluated_dir =
-              wszTestPath;
+          cloud_save.second.evaluated_dir =
+            wszTestPath;
 
-            // Skip duplicate Auto-Cloud entries
-            if (! _used_paths.emplace (cloud_save.second.evaluated_dir).second)
-              continue;
-          }
+          // Skip duplicate Auto-Cloud entries
+          if (! _used_paths.emplace (cloud_save.second.evaluated_dir).second)
+            continue;
+        }
 
-          // Steam requires we resolve executable_path here as well
-          for ( auto& launch_cfg : pAppRecord->launch_configs )
+        // Steam requires we resolve executable_path here as well
+        for ( auto& launch_cfg : pAppRecord->launch_configs )
+        {
+          if (! pAppRecord->install_dir.empty())
           {
-            if (! pAppRecord->install_dir.empty())
+            launch_cfg.second.install_dir = pAppRecord->install_dir;
+            
+            // EA games using link2ea:// protocol handlers to launch games does not have an executable,
+            //  so this ensures we do not end up testing the installation folder instead (since this has
+            //   bearing on whether a launch config is deemed valid or not as part of the blacklist check)
+            if (launch_cfg.second.isExecutableFileNameValid ( ))
             {
-              launch_cfg.second.install_dir = pAppRecord->install_dir;
-              
-              // EA games using link2ea:// protocol handlers to launch games does not have an executable,
-              //  so this ensures we do not end up testing the installation folder instead (since this has
-              //   bearing on whether a launch config is deemed valid or not as part of the blacklist check)
-              if (launch_cfg.second.isExecutableFileNameValid ( ))
-              {
-                launch_cfg.second.executable_path = launch_cfg.second.install_dir;
-                launch_cfg.second.executable_path.append (L"\\");
-                launch_cfg.second.executable_path.append (launch_cfg.second.getExecutableFileName ( ));
-              }
+              launch_cfg.second.executable_path = launch_cfg.second.install_dir;
+              launch_cfg.second.executable_path.append (L"\\");
+              launch_cfg.second.executable_path.append (launch_cfg.second.getExecutableFileName ( ));
             }
+          }
 
-            // Populate empty launch descriptions as well
-            if (launch_cfg.second.description.empty())
-            {
-              launch_cfg.second.description      = SK_UTF8ToWideChar (pAppRecord->names.normal);
-              launch_cfg.second.description_utf8 = pAppRecord->names.normal;
-            }
+          // Populate empty launch descriptions as well
+          if (launch_cfg.second.description.empty())
+          {
+            launch_cfg.second.description      = SK_UTF8ToWideChar (pAppRecord->names.normal);
+            launch_cfg.second.description_utf8 = pAppRecord->names.normal;
           }
         }
+      }
 
 #ifdef _WRITE_APPID_INI
-        fclose (fTest);
+      fclose (fTest);
 #endif
 
-        if (pAppRecord != nullptr)
-          pAppRecord->processed = true;
-
-        return pIter;
-      }
+      if (pAppRecord != nullptr)
+        pAppRecord->processed = true;
 
-      pIter =
-        pIter->getNextApp ();
+      return true;
     }
   }
 
-  return nullptr;
-}
\ No newline at end of file
+  return false;
+}
+
+size_t
+skValveDataFile::getAppInfoParallel ( std::vector <std::pair < std::string, app_record_s > > *apps )
+{
+  extern bool SKIF_STEAM_OWNER;
+
+  std::scoped_lock lock (_lock);
+
+  if (root == nullptr || apps == nullptr)
+    return 0;
+
+  std::vector <app_record_s*> pending;
+
+  for (auto& app : *apps)
+  {
+    if (app.second.store != app_record_s::Store::Steam)
+      continue;
+
+    if (app.second.id == 0 || app.second.processed)
+      continue;
+
+    if (app.second.id == SKIF_STEAM_APPID && ! SKIF_STEAM_OWNER)
+      continue;
+
+    if (findAppInfo (app.second.id) != nullptr)
+      pending.push_back (&app.second);
+  }
+
+  if (pending.empty ())
+    return 0;
+
+  const size_t workers =
+    std::min <size_t> ( pending.size (),
+      std::max <size_t> (1, std::thread::hardware_concurrency ()) );
+
+  // Each record is only ever touched by the one worker that claimed it
+  std::atomic <size_t>             next    = 0,
+                                   decoded = 0;
+  std::vector <std::future <void>> tasks;
+
+  for (size_t i = 0; i < workers; ++i)
+  {
+    tasks.emplace_back (
+      std::async (std::launch::async, [&](void)
+      {
+        SKIF_Util_SetThreadDescription (GetCurrentThread (), L"SKIF_AppInfoWorker");
+
+        for (size_t idx = next++; idx < pending.size (); idx = next++)
+        {
+          if (decodeAppInfo (pending [idx]->id, pending [idx]))
+            decoded++;
+        }
+      })
+    );
+  }
+
+  for (auto& task : tasks)
+    SKIF_Util_JoinTask (task, "An appinfo worker");
+
+  return decoded;
+}
@@ -1,5 +1,6 @@
 
 #include <stores/xbox/xbox_library.h>
+#include <stores/generic_library2.h>
 #include <pugixml.hpp>
 #include <wtypes.h>
 #include <fstream>
@@ -9,6 +10,7 @@
 #include <utility/utility.h>
 
 #include <utility/registry.h>
+#include <stores/app_key.h>
 #include <comdef.h>
 
 /*
@@ -270,10 +272,7 @@ SKIF_Xbox_GetInstalledAppIDs (std::vector <std::pair < std::string, app_record_s
                       record.names.normal     = xmlRoot.child("Properties").child_value("DisplayName");
 
                       // Hash the PackageName into a unique integer we use for internal tracking purposes
-                      std::hash <std::string> stoi_hasher;
-                      size_t int_hash = stoi_hasher (record.xbox.package_name);
-
-                      record.id = static_cast<uint32_t>(int_hash);
+                      record.id = SKIF_AppKey_ToAppId (SKIF_AppKey_Hash (app_record_s::Store::Xbox, record.xbox.package_name));
 
                       // Some games, such as Forza Motorsport, stores their display name in a .pri resource file in the install folder
                       // We need to retrieve them using a special "ms-resource" URI path along with SHLoadIndirectString()...
@@ -422,13 +421,19 @@ SKIF_Xbox_GetInstalledAppIDs (std::vector <std::pair < std::string, app_record_s
                             std::wstring fullPath = record.install_dir + LR"(\)" + file;
 
                             if (CopyFile(fullPath.c_str(), iconPath.c_str(), FALSE))
+                            {
                               icon = true;
+                              SKIF_AssetIndex::GetInstance ( ).update (iconPath);
+                            }
                           }
                         }
 
                         if (!iconIco && icon)
                         {
                           iconIco = SKIF_Util_SaveImageAsICO (iconPath.c_str(), iconIcoPath.c_str(), 32);
+
+                          if (iconIco)
+                            SKIF_AssetIndex::GetInstance ( ).update (iconIcoPath);
                         }
 
                         if (!cover)
@@ -440,7 +445,10 @@ SKIF_Xbox_GetInstalledAppIDs (std::vector <std::pair < std::string, app_record_s
                             std::wstring fullPath = record.install_dir + LR"(\)" + file;
 
                             if (CopyFile(fullPath.c_str(), coverPath.c_str(), FALSE))
+                            {
                               cover = true;
+                              SKIF_AssetIndex::GetInstance ( ).update (coverPath);
+                            }
                           }
                         }
                       }
@@ -539,6 +547,7 @@ SKIF_Xbox_IdentifyAssetNew (std::string PackageName, std::string StoreID)
           PLOG_DEBUG << "Downloading cover asset: " << assetUrl;
 
           SKIF_Util_GetWebResource (SK_UTF8ToWideChar (assetUrl), targetAssetPath + L"cover-original.png", L"GET", L"", "");
+          SKIF_AssetIndex::GetInstance ( ).update (targetAssetPath + L"cover-original.png");
         }
       }
     }
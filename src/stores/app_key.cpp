@@ -0,0 +1,135 @@
+//
+// Copyright 2020 Andon "Kaldaien" Coleman
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+//
+
+#include <stores/app_key.h>
+
+std::string
+SKIF_AppKey_GetKey (const app_record_s& app)
+{
+  return (app.store == app_record_s::Store::Epic) ? app.epic.name_app     :
+         (app.store == app_record_s::Store::Xbox) ? app.xbox.package_name :
+                                    std::to_string (app.id);
+}
+
+uint64_t
+SKIF_AppKey_Hash (app_record_s::Store store, std::string_view key)
+{
+  // FNV-1a over the store followed by the key
+  uint64_t hash = 0xcbf29ce484222325ULL;
+
+  const uint32_t store_id = static_cast <uint32_t> (store);
+
+  for (int i = 0; i < 4; i++)
+  {
+    hash ^= (store_id >> (i * 8)) & 0xff;
+    hash *= 0x100000001b3ULL;
+  }
+
+  for (unsigned char c : key)
+  {
+    hash ^= c;
+    hash *= 0x100000001b3ULL;
+  }
+
+  return hash;
+}
+
+uint64_t
+SKIF_AppKey_Hash (const app_record_s& app)
+{
+  return
+    SKIF_AppKey_Hash (app.store, SKIF_AppKey_GetKey (app));
+}
+
+uint32_t
+SKIF_AppKey_ToAppId (uint64_t hash)
+{
+  uint32_t id =
+    static_cast <uint32_t> (hash ^ (hash >> 32));
+
+  return (id != 0) ? id : 1;
+}
+
+void
+SKIF_AppKeyTable::reserve (size_t count)
+{
+  _entries.reserve (count);
+  _by_hash.reserve (count);
+}
+
+void
+SKIF_AppKeyTable::clear (void)
+{
+  _entries.clear ();
+  _by_hash.clear ();
+}
+
+size_t
+SKIF_AppKeyTable::lookup (app_record_s::Store store, std::string_view key, uint64_t hash) const
+{
+  auto range = _by_hash.equal_range (hash);
+
+  for (auto it = range.first; it != range.second; ++it)
+  {
+    const entry_s& entry = _entries [it->second];
+
+    if (entry.store == store && entry.key == key)
+      return it->second;
+  }
+
+  return npos;
+}
+
+bool
+SKIF_AppKeyTable::insert (const app_record_s& app, size_t index)
+{
+  std::string key  = SKIF_AppKey_GetKey (app);
+  uint64_t    hash = SKIF_AppKey_Hash   (app.store, key);
+
+  if (lookup (app.store, key, hash) != npos)
+    return false;
+
+  _by_hash.emplace      (hash, _entries.size ());
+  _entries.emplace_back (entry_s { app.store, std::move (key), hash, index });
+
+  return true;
+}
+
+size_t
+SKIF_AppKeyTable::find (const app_record_s& app) const
+{
+  if (app.store != app_record_s::Store::Epic &&
+      app.store != app_record_s::Store::Xbox)
+    return find (app.store, std::to_string (app.id));
+
+  return find (app.store, (app.store == app_record_s::Store::Epic) ? std::string_view (app.epic.name_app)
+                                                                   : std::string_view (app.xbox.package_name));
+}
+
+size_t
+SKIF_AppKeyTable::find (app_record_s::Store store, std::string_view key) const
+{
+  size_t slot =
+    lookup (store, key, SKIF_AppKey_Hash (store, key));
+
+  return (slot != npos) ? _entries [slot].index : npos;
+}
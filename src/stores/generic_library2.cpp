@@ -4,6 +4,7 @@
 #include <utility/utility.h>
 #include <utility/fsutil.h>
 #include <filesystem>
+#include <algorithm>
 
 #include <images/patreon.png.h>
 #include <images/sk_icon.jpg.h>
@@ -14,6 +15,7 @@
 #include <concurrent_queue.h>
 #include "stores/Steam/steam_library.h"
 #include <utility/registry.h>
+#include <SKIF.h>
 
 #define STB_IMAGE_IMPLEMENTATION
 #define STBI_WINDOWS_UTF8
@@ -101,6 +103,541 @@ FastTextureLoading (const std::wstring& path, DirectX::TexMetadata& meta, Direct
   return success;
 }
 
+#pragma region SKIF_AssetIndex
+
+SKIF_AssetIndex::SKIF_AssetIndex (void)
+{
+  static SKIF_CommonPathsCache& _path_cache = SKIF_CommonPathsCache::GetInstance ( );
+
+  m_root  = SK_FormatStringW (LR"(%ws\Assets\)", _path_cache.specialk_userdata);
+  m_watch = std::make_unique <SKIF_DirectoryChangeWatch> ( );
+}
+
+SKIF_AssetIndex::~SKIF_AssetIndex (void) = default;
+
+void
+SKIF_AssetIndex::rebuild (void)
+{
+  DWORD pre = SKIF_Util_timeGetTime1 ( );
+
+  m_files.clear ( );
+
+  // Depth-first, and only ever a single FindFirstFileExW pass per folder
+  std::vector <std::wstring> folders = { L"" };
+
+  while (! folders.empty ( ))
+  {
+    std::wstring folder = std::move (folders.back ( ));
+    folders.pop_back ( );
+
+    WIN32_FIND_DATA ffd   = { };
+    HANDLE          hFind =
+      FindFirstFileExW ((m_root + folder + L"*").c_str(), FindExInfoBasic, &ffd, FindExSearchNameMatch, NULL, FIND_FIRST_EX_LARGE_FETCH);
+
+    if (INVALID_HANDLE_VALUE == hFind)
+      continue;
+
+    do
+    {
+      if (wcscmp (ffd.cFileName, L".")  == 0 ||
+          wcscmp (ffd.cFileName, L"..") == 0)
+        continue;
+
+      if (ffd.dwFileAttributes & FILE_ATTRIBUTE_DIRECTORY)
+        folders.emplace_back (folder + ffd.cFileName + L"\\");
+      else
+        m_files.emplace (SKIF_Util_ToLowerW (folder + ffd.cFileName));
+    } while (FindNextFile (hFind, &ffd));
+
+    FindClose (hFind);
+  }
+
+  PLOG_VERBOSE << "Indexed " << m_files.size ( ) << " assets in " << (SKIF_Util_timeGetTime1 ( ) - pre) << " ms.";
+}
+
+void
+SKIF_AssetIndex::refresh (void)
+{
+  std::unique_lock lock (m_lock);
+
+  // Registers the watch if it is not already (e.g. the folder did not exist before)
+  bool signaled = m_watch->isSignaled (m_root, UITab_None, TRUE, FILE_NOTIFY_CHANGE_FILE_NAME | FILE_NOTIFY_CHANGE_DIR_NAME);
+  bool watching = m_watch->isWatching ( );
+
+  // Changes made while rebuilding are reported by the watch afterwards, so nothing is missed
+  bool rebuilding = (watching && ! m_watching);
+
+  if (signaled)
+  {
+    bool overflowed = false;
+    auto changes    = m_watch->getChanges (&overflowed);
+
+    rebuilding |= overflowed;
+
+    for (auto& change : changes)
+    {
+      if (rebuilding)
+        break;
+
+      // Anything not known to be a file is a folder, whose contents are not reported when moved or removed
+      auto _remove = [&](const std::wstring& path) {
+        rebuilding |= (m_files.erase (SKIF_Util_ToLowerW (path)) == 0);
+      };
+
+      auto _add    = [&](const std::wstring& path) {
+        DWORD dwAttributes = GetFileAttributesW ((m_root + path).c_str());
+
+        if (dwAttributes == INVALID_FILE_ATTRIBUTES)
+          return; // Already gone again
+
+        if (dwAttributes & FILE_ATTRIBUTE_DIRECTORY)
+          rebuilding = true;
+        else
+          m_files.emplace (SKIF_Util_ToLowerW (path));
+      };
+
+      switch (change.action)
+      {
+      case SKIF_DirectoryChange::Action::Added:
+        _add    (change.path);
+        break;
+      case SKIF_DirectoryChange::Action::Removed:
+        _remove (change.path);
+        break;
+      case SKIF_DirectoryChange::Action::Renamed:
+        _remove (change.old_path);
+        _add    (change.path);
+        break;
+      case SKIF_DirectoryChange::Action::Modified:
+        break;
+      }
+    }
+  }
+
+  if (rebuilding)
+    rebuild ( );
+
+  m_watching = watching;
+}
+
+bool
+SKIF_AssetIndex::exists (std::wstring_view relative_path)
+{
+  std::shared_lock lock (m_lock);
+
+  // Without a watch on the folder the index cannot be trusted, so fall back to the file system
+  if (! m_watching)
+    return PathFileExistsW ((m_root + std::wstring (relative_path)).c_str());
+
+  return (m_files.count (SKIF_Util_ToLowerW (relative_path)) != 0);
+}
+
+void
+SKIF_AssetIndex::update (const std::wstring& path)
+{
+  // Only files below the Assets folder are indexed
+  if (path.length () <= m_root.length () || _wcsnicmp (path.c_str (), m_root.c_str (), m_root.length ()) != 0)
+    return;
+
+  DWORD        dwAttributes = GetFileAttributesW (path.c_str ());
+  std::wstring relative     = SKIF_Util_ToLowerW (std::wstring_view (path).substr (m_root.length ()));
+
+  std::unique_lock lock (m_lock);
+
+  if (dwAttributes != INVALID_FILE_ATTRIBUTES && ! (dwAttributes & FILE_ATTRIBUTE_DIRECTORY))
+    m_files.emplace (std::move (relative));
+  else
+    m_files.erase   (relative);
+}
+
+// Where an asset comes from
+enum AssetSource {
+  AssetSource_Custom,   // Provided by the user
+  AssetSource_Original, // Downloaded or extracted by SKIF
+  AssetSource_PCGW      // Cover from PCGamingWiki, optional
+};
+
+static constexpr uint32_t
+_AssetStore (app_record_s::Store store) { return (store != app_record_s::Store::Unspecified) ? 1UL << static_cast <uint32_t> (store) : 0; }
+
+static constexpr uint32_t AssetStore_All = UINT32_MAX;
+
+struct asset_rule_s {
+  LibraryTexture texture;
+  uint32_t       stores; // Mask of _AssetStore () bits
+  const wchar_t* file;
+  AssetSource    source;
+};
+
+// In order of precedence; the first asset that exists wins
+static constexpr asset_rule_s asset_rules [] = {
+  { LibraryTexture::Cover, AssetStore_All,                                   L"cover.png",          AssetSource_Custom   },
+  { LibraryTexture::Cover, AssetStore_All,                                   L"cover.jpg",          AssetSource_Custom   },
+  { LibraryTexture::Icon,  AssetStore_All,                                   L"icon.png",           AssetSource_Custom   },
+  { LibraryTexture::Icon,  AssetStore_All,                                   L"icon.jpg",           AssetSource_Custom   },
+  { LibraryTexture::Icon,  AssetStore_All,                                   L"icon.ico",           AssetSource_Custom   },
+
+  { LibraryTexture::Cover, _AssetStore (app_record_s::Store::Epic),          L"cover-original.jpg", AssetSource_Original },
+  { LibraryTexture::Cover, _AssetStore (app_record_s::Store::Xbox),          L"cover-original.png", AssetSource_Original },
+  { LibraryTexture::Cover, _AssetStore (app_record_s::Store::Xbox),          L"cover-fallback.png", AssetSource_Original },
+  { LibraryTexture::Icon,  _AssetStore (app_record_s::Store::Custom) |
+                           _AssetStore (app_record_s::Store::GOG)    |
+                           _AssetStore (app_record_s::Store::Epic)   |
+                           _AssetStore (app_record_s::Store::Xbox),        L"icon-original.png",  AssetSource_Original },
+
+  { LibraryTexture::Cover, _AssetStore (app_record_s::Store::Steam) |
+                           _AssetStore (app_record_s::Store::GOG),         L"cover-pcgw.png",     AssetSource_PCGW     },
+};
+
+bool
+SKIF_Assets_Resolve (
+        LibraryTexture                      libTexToLoad,
+        app_record_s::Store                 store,
+        const std::wstring&                 folder,
+        bool                                allowPCGW,
+        SKIF_AssetMatch&                    match)
+{
+  static SKIF_AssetIndex& _assets = SKIF_AssetIndex::GetInstance ( );
+
+  for (auto& rule : asset_rules)
+  {
+    if (rule.texture != libTexToLoad || (rule.stores & _AssetStore (store)) == 0)
+      continue;
+
+    if (rule.source == AssetSource_PCGW && ! allowPCGW)
+      continue;
+
+    if (! _assets.exists (folder + rule.file))
+      continue;
+
+    match.path      = _assets.getRoot ( ) + folder + rule.file;
+    match.isCustom  = (rule.source == AssetSource_Custom);
+    match.isManaged = true; // Everything below Assets\ is managed by SKIF
+
+    return true;
+  }
+
+  return false;
+}
+
+uint32_t
+SKIF_Assets_GetCoverDisplayHeight (void)
+{
+  static SKIF_RegistrySettings& _registry = SKIF_RegistrySettings::GetInstance ( );
+
+  if (_registry.iCoverScaling != 0)
+    return 0;
+
+  return static_cast <uint32_t> (900.0f * SKIF_ImGui_GlobalDPIScale);
+}
+
+#pragma endregion
+
+#pragma region SKIF_TextureCache
+
+// Layout of a cache entry: header, source path, padding, pixel data
+struct texture_cache_header_s {
+  static constexpr uint32_t Magic   = 0x43544B53; // SKTC
+  static constexpr uint32_t Version = 1;
+
+  uint32_t magic;
+  uint32_t version;
+  uint64_t source_size;
+  uint64_t source_time;  // Last write time of the source
+  uint32_t variant;
+  uint32_t format;       // DXGI_FORMAT
+  uint32_t width;
+  uint32_t height;
+  uint64_t row_pitch;
+  uint64_t data_offset;
+  uint64_t data_size;
+  uint32_t path_length;  // In characters, not null terminated
+  uint32_t reserved;
+};
+
+static bool
+SKIF_TextureCache_GetSourceInfo (const std::wstring& source, uint64_t& size, uint64_t& time)
+{
+  WIN32_FILE_ATTRIBUTE_DATA fad = { };
+
+  if (! GetFileAttributesExW (source.c_str(), GetFileExInfoStandard, &fad))
+    return false;
+
+  size = (static_cast <uint64_t> (fad.nFileSizeHigh)                 << 32) | fad.nFileSizeLow;
+  time = (static_cast <uint64_t> (fad.ftLastWriteTime.dwHighDateTime) << 32) | fad.ftLastWriteTime.dwLowDateTime;
+
+  return true;
+}
+
+SKIF_TextureCache::SKIF_TextureCache (void)
+{
+  static SKIF_CommonPathsCache& _path_cache = SKIF_CommonPathsCache::GetInstance ( );
+
+  m_root = SK_FormatStringW (LR"(%ws\Cache\Textures\)", _path_cache.specialk_userdata);
+}
+
+std::wstring
+SKIF_TextureCache::getEntryPath (const std::wstring& source, uint32_t variant) const
+{
+  // FNV-1a over the case-folded path, followed by the variant
+  uint64_t hash = 0xcbf29ce484222325ULL;
+
+  for (wchar_t ch : SKIF_Util_ToLowerW (source))
+    hash = (hash ^ static_cast <uint16_t> (ch)) * 0x100000001b3ULL;
+
+  return SK_FormatStringW (L"%ws%016llx-%x.tex", m_root.c_str(), hash, variant);
+}
+
+bool
+SKIF_TextureCache::load (const std::wstring& source, uint32_t variant, entry_s& entry)
+{
+  uint64_t source_size = 0,
+           source_time = 0;
+
+  if (! SKIF_TextureCache_GetSourceInfo (source, source_size, source_time))
+    return false;
+
+  std::wstring path =
+    getEntryPath (source, variant);
+
+  // Not cached (yet)
+  if (GetFileAttributesW (path.c_str()) == INVALID_FILE_ATTRIBUTES)
+    return false;
+
+  if (! entry.file.open (path.c_str()))
+    return false;
+
+  auto header =
+    reinterpret_cast <const texture_cache_header_s *> (entry.file.data ( ));
+
+  if (! entry.file.contains (header, sizeof (texture_cache_header_s)) ||
+      header->magic       != texture_cache_header_s::Magic            ||
+      header->version     != texture_cache_header_s::Version          ||
+      header->variant     != variant                                  ||
+      header->path_length != source.length ( ))
+  {
+    entry.file.close ( );
+    return false;
+  }
+
+  auto cached_path =
+    reinterpret_cast <const wchar_t *> (header + 1);
+
+  if (! entry.file.contains (cached_path, header->path_length * sizeof (wchar_t)) ||
+      _wcsnicmp (cached_path, source.c_str(), header->path_length) != 0)
+  {
+    entry.file.close ( );
+    return false;
+  }
+
+  // Stale, the source has changed since it was cached (it will be replaced by the next store)
+  if (header->source_size != source_size ||
+      header->source_time != source_time)
+  {
+    PLOG_VERBOSE << "Cached texture is out of date: " << source;
+    entry.file.close ( );
+    return false;
+  }
+
+  const BYTE* pixels = entry.file.data ( ) + header->data_offset;
+
+  if (header->data_offset <  sizeof (texture_cache_header_s)                      ||
+      header->data_size   != header->row_pitch * header->height                   ||
+      header->row_pitch   <  DirectX::BitsPerPixel ((DXGI_FORMAT)header->format) * header->width / 8 ||
+    ! entry.file.contains (pixels, static_cast <size_t> (header->data_size)))
+  {
+    PLOG_WARNING << "Cached texture is corrupt: " << path;
+    entry.file.close ( );
+    return false;
+  }
+
+  entry.meta            = { };
+  entry.meta.width      = header->width;
+  entry.meta.height     = header->height;
+  entry.meta.depth      = 1;
+  entry.meta.arraySize  = 1;
+  entry.meta.mipLevels  = 1;
+  entry.meta.format     = (DXGI_FORMAT)header->format;
+  entry.meta.dimension  = DirectX::TEX_DIMENSION_TEXTURE2D;
+
+  entry.image.width      = header->width;
+  entry.image.height     = header->height;
+  entry.image.format     = (DXGI_FORMAT)header->format;
+  entry.image.rowPitch   = static_cast <size_t> (header->row_pitch);
+  entry.image.slicePitch = static_cast <size_t> (header->data_size);
+  entry.image.pixels     = const_cast <uint8_t *> (pixels);
+
+  // Mark the entry as recently used
+  CHandle hEntry (
+    CreateFileW (path.c_str(), FILE_WRITE_ATTRIBUTES, FILE_SHARE_READ | FILE_SHARE_WRITE | FILE_SHARE_DELETE,
+                   nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr)
+  );
+
+  if (hEntry.m_h != INVALID_HANDLE_VALUE)
+  {
+    FILETIME ftNow;
+    GetSystemTimeAsFileTime (&ftNow);
+    SetFileTime (hEntry, nullptr, &ftNow, nullptr);
+  }
+
+  else
+    hEntry.Detach ( );
+
+  return true;
+}
+
+void
+SKIF_TextureCache::store (const std::wstring& source, uint32_t variant, const DirectX::TexMetadata& meta, const DirectX::Image& image)
+{
+  // Only simple 2D textures are cached
+  if (meta.dimension != DirectX::TEX_DIMENSION_TEXTURE2D || meta.mipLevels != 1 || meta.arraySize != 1 || image.pixels == nullptr)
+    return;
+
+  texture_cache_header_s header = { };
+
+  if (! SKIF_TextureCache_GetSourceInfo (source, header.source_size, header.source_time))
+    return;
+
+  header.magic       = texture_cache_header_s::Magic;
+  header.version     = texture_cache_header_s::Version;
+  header.variant     = variant;
+  header.format      = static_cast <uint32_t> (image.format);
+  header.width       = static_cast <uint32_t> (image.width);
+  header.height      = static_cast <uint32_t> (image.height);
+  header.row_pitch   = image.rowPitch;
+  header.data_size   = static_cast <uint64_t> (image.rowPitch) * image.height;
+  header.path_length = static_cast <uint32_t> (source.length ( ));
+
+  // Keep the pixel data 16-byte aligned
+  uint64_t path_end  = sizeof (texture_cache_header_s) + source.length ( ) * sizeof (wchar_t);
+  header.data_offset = (path_end + 15) & ~15ULL;
+
+  std::error_code ec;
+  std::filesystem::create_directories (m_root, ec);
+
+  std::wstring path = getEntryPath (source, variant),
+               temp = SK_FormatStringW (L"%ws.%u.tmp", path.c_str(), GetCurrentThreadId ( ));
+
+  // Written to a temporary file first, so a partially written entry is never picked up
+  {
+    CHandle hFile (
+      CreateFileW (temp.c_str(), GENERIC_WRITE, 0x0, nullptr, CREATE_ALWAYS, FILE_ATTRIBUTE_NORMAL | FILE_FLAG_SEQUENTIAL_SCAN, nullptr)
+    );
+
+    if (hFile.m_h == INVALID_HANDLE_VALUE)
+    {
+      hFile.Detach ( );
+      PLOG_ERROR << "Failed to create texture cache entry: " << temp;
+      return;
+    }
+
+    static constexpr BYTE padding [16] = { };
+
+    DWORD dwWritten = 0;
+    bool  bWritten  =
+      WriteFile (hFile, &header,                sizeof (header),                                         &dwWritten, nullptr) &&
+      WriteFile (hFile, source.c_str(),         header.path_length * sizeof (wchar_t),                    &dwWritten, nullptr) &&
+      WriteFile (hFile, padding,        static_cast <DWORD> (header.data_offset - path_end),              &dwWritten, nullptr) &&
+      WriteFile (hFile, image.pixels,   static_cast <DWORD> (header.data_size),                           &dwWritten, nullptr);
+
+    if (! bWritten)
+    {
+      hFile.Close ( );
+      DeleteFileW (temp.c_str());
+      return;
+    }
+  }
+
+  // The size of the entry being replaced, if any, so the total does not count both
+  WIN32_FILE_ATTRIBUTE_DATA fad = { };
+  uint64_t                  replaced =
+    GetFileAttributesExW (path.c_str(), GetFileExInfoStandard, &fad) ? (static_cast <uint64_t> (fad.nFileSizeHigh) << 32) | fad.nFileSizeLow
+                                                                     : 0;
+
+  // Fails if the old entry is currently mapped by another thread; that one will be replaced next time instead
+  if (! MoveFileExW (temp.c_str(), path.c_str(), MOVEFILE_REPLACE_EXISTING))
+  {
+    DeleteFileW (temp.c_str());
+    return;
+  }
+
+  std::scoped_lock lock (m_lock);
+
+  m_total += header.data_offset + header.data_size;
+  m_total -= std::min (m_total, replaced);
+
+  trim ( );
+}
+
+void
+SKIF_TextureCache::trim (void)
+{
+  // Only the first call has to look at what is already on disk
+  if (m_scanned && m_total <= MaxSize)
+    return;
+
+  struct cached_file_s {
+    std::wstring name;
+    uint64_t     size;
+    uint64_t     last_used;
+  };
+
+  std::vector <cached_file_s> files;
+
+  WIN32_FIND_DATA ffd   = { };
+  HANDLE          hFind =
+    FindFirstFileExW ((m_root + L"*.tex").c_str(), FindExInfoBasic, &ffd, FindExSearchNameMatch, NULL, FIND_FIRST_EX_LARGE_FETCH);
+
+  uint64_t total = 0;
+
+  if (INVALID_HANDLE_VALUE != hFind)
+  {
+    do
+    {
+      if (ffd.dwFileAttributes & FILE_ATTRIBUTE_DIRECTORY)
+        continue;
+
+      cached_file_s file;
+      file.name      = ffd.cFileName;
+      file.size      = (static_cast <uint64_t> (ffd.nFileSizeHigh)                  << 32) | ffd.nFileSizeLow;
+      file.last_used = (static_cast <uint64_t> (ffd.ftLastAccessTime.dwHighDateTime) << 32) | ffd.ftLastAccessTime.dwLowDateTime;
+
+      total += file.size;
+      files.emplace_back (file);
+    } while (FindNextFile (hFind, &ffd));
+
+    FindClose (hFind);
+  }
+
+  m_total   = total;
+  m_scanned = true;
+
+  if (m_total <= MaxSize)
+    return;
+
+  // Evict the least recently used entries until there is some headroom
+  std::sort (files.begin (), files.end (),
+    [](const cached_file_s& a, const cached_file_s& b) -> bool
+    {
+      return a.last_used < b.last_used;
+    }
+  );
+
+  for (auto& file : files)
+  {
+    if (m_total <= MaxSize / 4 * 3)
+      break;
+
+    // Entries that cannot be deleted right now are left for the next time
+    if (DeleteFileW ((m_root + file.name).c_str()))
+      m_total -= file.size;
+  }
+
+  PLOG_INFO << "Trimmed the texture cache down to " << (m_total / 1024 / 1024) << " MiB.";
+}
+
+#pragma endregion
+
 void
 LoadLibraryTexture (
         LibraryTexture                      libTexToLoad,
@@ -115,6 +652,8 @@ LoadLibraryTexture (
   // NOT REALLY THREAD-SAFE WHILE IT RELIES ON THESE STATIC GLOBAL OBJECTS!
   static SKIF_RegistrySettings& _registry   = SKIF_RegistrySettings::GetInstance ( );
   static SKIF_CommonPathsCache& _path_cache = SKIF_CommonPathsCache::GetInstance ( );
+  static SKIF_AssetIndex&       _assets     = SKIF_AssetIndex::GetInstance ( );
+  static SKIF_TextureCache&     _tex_cache  = SKIF_TextureCache::GetInstance ( );
 
   static const int SKIF_STEAM_APPID = 1157970;
 
@@ -143,242 +682,151 @@ LoadLibraryTexture (
     if (libTexToLoad == LibraryTexture::Icon)
       pApp->tex_icon.isCustom  = pApp->tex_icon.isManaged  = false;
 
-    // SKIF
-    if (       appid == SKIF_STEAM_APPID           &&
-         pApp->store == app_record_s::Store::Steam  )
+    // Pick up any assets that have been added or removed since the last time
+    _assets.refresh ( );
+
+    bool isSKIF = (       appid == SKIF_STEAM_APPID           &&
+                    pApp->store == app_record_s::Store::Steam  );
+
+    // The folder of the app below the Assets folder, e.g. LR"(Steam\620\)"
+    std::wstring AssetFolder;
+
+    if (isSKIF)
+      AssetFolder = L"";
+    else if (pApp->store == app_record_s::Store::Custom)
+      AssetFolder = SK_FormatStringW (LR"(Custom\%i\)", appid);
+    else if (pApp->store == app_record_s::Store::Epic)
+      AssetFolder = SK_FormatStringW (LR"(Epic\%ws\)",  SK_UTF8ToWideChar(pApp->epic.name_app).c_str());
+    else if (pApp->store == app_record_s::Store::GOG)
+      AssetFolder = SK_FormatStringW (LR"(GOG\%i\)",    appid);
+    else if (pApp->store == app_record_s::Store::Xbox)
+      AssetFolder = SK_FormatStringW (LR"(Xbox\%ws\)",  SK_UTF8ToWideChar(pApp->xbox.package_name).c_str());
+    else if (pApp->store == app_record_s::Store::Steam)
+      AssetFolder = SK_FormatStringW (LR"(Steam\%i\)",  appid);
+
+    std::wstring AssetPath = _assets.getRoot ( ) + AssetFolder;
+    SKIFCustomPath         = AssetPath + ((libTexToLoad == LibraryTexture::Cover) ? L"cover" : L"icon");
+
+    // Extract a copy of the official Steam icon and save it as a .ico
+    if (! isSKIF && pApp->store == app_record_s::Store::Steam && libTexToLoad == LibraryTexture::Icon)
     {
-      SKIFCustomPath = SK_FormatStringW (LR"(%ws\Assets\)", _path_cache.specialk_userdata);
+      if (! _assets.exists (AssetFolder + L"icon-original.ico") &&
+          SKIF_Util_SaveImageAsICO (name.c_str(), (AssetPath + L"icon-original.ico").c_str(), 32))
+        _assets.update (AssetPath + L"icon-original.ico");
+    }
 
-      if (libTexToLoad == LibraryTexture::Cover)
-        SKIFCustomPath += L"cover";
-      else
-        SKIFCustomPath += L"icon";
+    bool allowPCGW = (! isSKIF && ((pApp->store == app_record_s::Store::Steam && _registry.bPCGWCoversSteam) ||
+                                   (pApp->store == app_record_s::Store::GOG   && _registry.bPCGWCoversGOG  )));
 
-      if      (PathFileExistsW ((SKIFCustomPath + L".png").c_str()))
-        load_str =               SKIFCustomPath + L".png";
-      else if (PathFileExistsW ((SKIFCustomPath + L".jpg").c_str()))
-        load_str =               SKIFCustomPath + L".jpg";
-      else if (libTexToLoad == LibraryTexture::Icon &&
-               PathFileExistsW ((SKIFCustomPath + L".ico").c_str()))
-        load_str =               SKIFCustomPath + L".ico";
+    // Custom assets, followed by any originals or PCGW covers SKIF has already stored
+    SKIF_AssetMatch asset;
 
+    if (SKIF_Assets_Resolve (libTexToLoad, pApp->store, AssetFolder, allowPCGW, asset))
+    {
+      load_str     = asset.path;
+      customAsset  = asset.isCustom;
+      managedAsset = asset.isManaged;
+    }
+
+    // Everything below is only for assets that are not stored (yet) in the Assets folder
+
+    // SKIF
+    if (isSKIF)
+    {
       customAsset = managedAsset = (load_str != L"\0");
     }
 
     // SKIF Custom
     else if (pApp->store == app_record_s::Store::Custom)
     {
-      SKIFCustomPath = SK_FormatStringW (LR"(%ws\Assets\Custom\%i\)", _path_cache.specialk_userdata, appid);
-
-      if (libTexToLoad == LibraryTexture::Cover)
-        SKIFCustomPath += L"cover";
-      else
-        SKIFCustomPath += L"icon";
-
-      if      (PathFileExistsW    ((SKIFCustomPath + L".png").c_str()))
-        load_str =                  SKIFCustomPath + L".png";
-      else if (PathFileExistsW    ((SKIFCustomPath + L".jpg").c_str()))
-        load_str =                  SKIFCustomPath + L".jpg";
-      else if (libTexToLoad == LibraryTexture::Icon &&
-               PathFileExistsW    ((SKIFCustomPath + L".ico").c_str()))
-        load_str =                  SKIFCustomPath + L".ico";
-
-      customAsset = (load_str != L"\0");
-
-      if (! customAsset)
+      if (load_str == L"\0")
       {
         if      (libTexToLoad == LibraryTexture::Icon &&
                  SKIF_Util_SaveExtractExeIcon (pApp->launch_configs[0].getExecutableFullPath ( ), SKIFCustomPath + L"-original.png"))
+        {
           load_str =                SKIFCustomPath + L"-original.png";
+          _assets.update (load_str);
+        }
       }
     }
 
     // Epic
     else if (pApp->store == app_record_s::Store::Epic)
     {
-      std::wstring EpicAssetPath = SK_FormatStringW(LR"(%ws\Assets\Epic\%ws\)", _path_cache.specialk_userdata, SK_UTF8ToWideChar(pApp->epic.name_app).c_str());
-      SKIFCustomPath = std::wstring(EpicAssetPath);
-
-      if (libTexToLoad == LibraryTexture::Cover)
-        SKIFCustomPath += L"cover";
-      else
-        SKIFCustomPath += L"icon";
-
-      if      (PathFileExistsW  ((SKIFCustomPath + L".png").c_str()))
-        load_str =                SKIFCustomPath + L".png";
-      else if (PathFileExistsW  ((SKIFCustomPath + L".jpg").c_str()))
-        load_str =                SKIFCustomPath + L".jpg";
-      else if (libTexToLoad == LibraryTexture::Icon &&
-               PathFileExistsW  ((SKIFCustomPath + L".ico").c_str()))
-        load_str =                SKIFCustomPath + L".ico";
-
-      customAsset = (load_str != L"\0");
-
-      if (! customAsset)
+      if (load_str == L"\0")
       {
-        if      (libTexToLoad == LibraryTexture::Cover &&
-                 PathFileExistsW ((EpicAssetPath + L"cover-original.jpg").c_str()))
-          load_str =               EpicAssetPath + L"cover-original.jpg";
-        else if (libTexToLoad == LibraryTexture::Icon &&
-                 SKIF_Util_SaveExtractExeIcon (pApp->launch_configs[0].getExecutableFullPath ( ), EpicAssetPath + L"icon-original.png"))
+        if      (libTexToLoad == LibraryTexture::Icon &&
+                 SKIF_Util_SaveExtractExeIcon (pApp->launch_configs[0].getExecutableFullPath ( ), AssetPath + L"icon-original.png"))
+        {
           load_str =               SKIFCustomPath + L"-original.png";
+          _assets.update (load_str);
+        }
       }
 
       // Extract a copy of the icon and save it as an .ico
       if (libTexToLoad == LibraryTexture::Icon)
       {
         std::wstring
-          OriginalIconPath  = EpicAssetPath + L"icon-original.png",
-          ExtractedIconPath = EpicAssetPath + L"icon-original.ico";
+          OriginalIconPath  = AssetPath + L"icon-original.png",
+          ExtractedIconPath = AssetPath + L"icon-original.ico";
 
-        if (! PathFileExistsW (ExtractedIconPath.c_str()))
-          SKIF_Util_SaveImageAsICO (OriginalIconPath.c_str(), ExtractedIconPath.c_str(), 32);
+        if (! _assets.exists (AssetFolder + L"icon-original.ico") &&
+            SKIF_Util_SaveImageAsICO (OriginalIconPath.c_str(), ExtractedIconPath.c_str(), 32))
+          _assets.update (ExtractedIconPath);
       }
     }
 
     // GOG
     else if (pApp->store == app_record_s::Store::GOG)
     {
-      SKIFCustomPath = SK_FormatStringW (LR"(%ws\Assets\GOG\%i\)", _path_cache.specialk_userdata, appid);
-
-      if (libTexToLoad == LibraryTexture::Cover)
-        SKIFCustomPath += L"cover";
-      else
-        SKIFCustomPath += L"icon";
-
-      if      (PathFileExistsW ((SKIFCustomPath + L".png").c_str()))
-        load_str =               SKIFCustomPath + L".png";
-      else if (PathFileExistsW ((SKIFCustomPath + L".jpg").c_str()))
-        load_str =               SKIFCustomPath + L".jpg";
-      else if (libTexToLoad == LibraryTexture::Icon &&
-               PathFileExistsW ((SKIFCustomPath + L".ico").c_str()))
-        load_str =               SKIFCustomPath + L".ico";
-
-      customAsset = (load_str != L"\0");
-
-      if (! customAsset)
+      if (load_str == L"\0")
       {
         if      (libTexToLoad == LibraryTexture::Icon &&
                  SKIF_Util_SaveExtractExeIcon (pApp->launch_configs[0].getExecutableFullPath ( ), SKIFCustomPath + L"-original.png"))
+        {
           load_str =             SKIFCustomPath + L"-original.png";
+          _assets.update (load_str);
+        }
         else if (libTexToLoad == LibraryTexture::Icon)
         {
           managedAsset = false; // GOG default icons are not managed
           load_str =             name;
         }
 
+        // Load GOG Galaxy cover
         else if (libTexToLoad == LibraryTexture::Cover)
         {
-          // Load PCGW cover
-          if (_registry.bPCGWCoversGOG &&
-              PathFileExistsW ((SKIFCustomPath + L"-pcgw.png").c_str()))
-          {
-            load_str =          SKIFCustomPath + L"-pcgw.png";
-
-            managedAsset = true; // PCGW covers are managed
-          }
-
-          // Load GOG Galaxy cover
-          else {
-            managedAsset = false; // GOG covers are not managed
+          managedAsset = false; // GOG covers are not managed
 
-            extern std::wstring GOGGalaxy_UserID;
-            load_str = SK_FormatStringW (LR"(C:\ProgramData\GOG.com\Galaxy\webcache\%ws\gog\%i\)", GOGGalaxy_UserID.c_str(), appid);
+          extern std::wstring GOGGalaxy_UserID;
+          load_str = SK_FormatStringW (LR"(C:\ProgramData\GOG.com\Galaxy\webcache\%ws\gog\%i\)", GOGGalaxy_UserID.c_str(), appid);
 
-            HANDLE hFind        = INVALID_HANDLE_VALUE;
-            WIN32_FIND_DATA ffd = { };
+          HANDLE hFind        = INVALID_HANDLE_VALUE;
+          WIN32_FIND_DATA ffd = { };
 
-            hFind =
-              FindFirstFileExW ((load_str + name).c_str(), FindExInfoBasic, &ffd, FindExSearchNameMatch, NULL, NULL);
-            //FindFirstFile((load_str + name).c_str(), &ffd);
+          hFind =
+            FindFirstFileExW ((load_str + name).c_str(), FindExInfoBasic, &ffd, FindExSearchNameMatch, NULL, NULL);
+          //FindFirstFile((load_str + name).c_str(), &ffd);
 
-            if (INVALID_HANDLE_VALUE != hFind)
-            {
-              load_str += ffd.cFileName;
-              FindClose(hFind);
-            }
+          if (INVALID_HANDLE_VALUE != hFind)
+          {
+            load_str += ffd.cFileName;
+            FindClose(hFind);
           }
         }
       }
     }
 
-    // Xbox
-    else if (pApp->store == app_record_s::Store::Xbox)
-    {
-      std::wstring XboxAssetPath = SK_FormatStringW(LR"(%ws\Assets\Xbox\%ws\)", _path_cache.specialk_userdata, SK_UTF8ToWideChar(pApp->xbox.package_name).c_str());
-      SKIFCustomPath = std::wstring(XboxAssetPath);
-
-      if (libTexToLoad == LibraryTexture::Cover)
-        SKIFCustomPath += L"cover";
-      else
-        SKIFCustomPath += L"icon";
-
-      if      (PathFileExistsW  ((SKIFCustomPath + L".png").c_str()))
-        load_str =                SKIFCustomPath + L".png";
-      else if (PathFileExistsW  ((SKIFCustomPath + L".jpg").c_str()))
-        load_str =                SKIFCustomPath + L".jpg";
-      else if (libTexToLoad == LibraryTexture::Icon &&
-               PathFileExistsW  ((SKIFCustomPath + L".ico").c_str()))
-        load_str =                SKIFCustomPath + L".ico";
-
-      customAsset = (load_str != L"\0");
-
-      if (! customAsset)
-      {
-        if      (libTexToLoad == LibraryTexture::Cover &&
-                 PathFileExistsW ((SKIFCustomPath + L"-original.png").c_str()))
-          load_str =               SKIFCustomPath + L"-original.png";
-        else if (libTexToLoad == LibraryTexture::Cover &&
-                 PathFileExistsW ((SKIFCustomPath + L"-fallback.png").c_str()))
-          load_str =               SKIFCustomPath + L"-fallback.png";
-        else if (libTexToLoad == LibraryTexture::Icon &&
-                 PathFileExistsW ((SKIFCustomPath + L"-original.png").c_str()))
-          load_str =               SKIFCustomPath + L"-original.png";
-      }
-    }
-
     // STEAM
     else if (pApp->store == app_record_s::Store::Steam)
     {
-      SKIFCustomPath    = SK_FormatStringW (LR"(%ws\Assets\Steam\%i\)",                  _path_cache.specialk_userdata,                            appid);
       SteamCustomPath   = SK_FormatStringW (LR"(%ws\userdata\%i\config\grid\%i)",        _path_cache.steam_install, SKIF_Steam_GetCurrentUser ( ), appid);
 
-      if (libTexToLoad == LibraryTexture::Cover)
-        SKIFCustomPath += L"cover";
-      else
-        SKIFCustomPath += L"icon";
-
-      // Extract a copy of the official Steam icon and save it as a .ico
-      if (libTexToLoad == LibraryTexture::Icon)
-      {
-        std::wstring
-          ExtractedIconPath = SK_FormatStringW (LR"(%ws\Assets\Steam\%i\icon-original.ico)", _path_cache.specialk_userdata,                        appid);
-
-        if (! PathFileExistsW (ExtractedIconPath.c_str()))
-          SKIF_Util_SaveImageAsICO (name.c_str(), ExtractedIconPath.c_str(), 32);
-      }
-
-      if      (PathFileExistsW (( SKIFCustomPath +  L".png").c_str()))
-        load_str =                SKIFCustomPath +  L".png";
-      else if (PathFileExistsW (( SKIFCustomPath +  L".jpg").c_str()))
-        load_str =                SKIFCustomPath +  L".jpg";
-      else if (libTexToLoad == LibraryTexture::Icon  &&
-               PathFileExistsW (( SKIFCustomPath +  L".ico").c_str()))
-        load_str =                SKIFCustomPath +  L".ico";
-
-      customAsset = (load_str != L"\0");
-
-      if (! customAsset)
+      if (load_str == L"\0")
       {
         managedAsset = false; // Steam's user-specific custom covers are not managed
-        
-        if      (libTexToLoad == LibraryTexture::Cover && _registry.bPCGWCoversSteam &&
-                 PathFileExistsW ((SKIFCustomPath + L"-pcgw.png").c_str()))
-        {
-          load_str =               SKIFCustomPath + L"-pcgw.png";
-          managedAsset = true; // PCGW cover is managed!
-        }
-        else if (libTexToLoad == LibraryTexture::Cover &&
+
+        if      (libTexToLoad == LibraryTexture::Cover &&
                  PathFileExistsW ((SteamCustomPath + L"p.png").c_str()))
           load_str =               SteamCustomPath + L"p.png";
         else if (libTexToLoad == LibraryTexture::Cover &&
@@ -398,9 +846,22 @@ LoadLibraryTexture (
 
   PLOG_VERBOSE_IF (load_str != L"\0") << "Texture to load: " << load_str;
 
+  // Downscale covers to 220x330, which will then be shown in horizon mode
+  bool downscale = ((_registry._UseLowResCovers && ! _registry._UseLowResCoversHiDPIBypass && libTexToLoad == LibraryTexture::Cover) ||
+                    (libTexToLoad == LibraryTexture::Logo  && name == L"sk_boxart_small.png"));
+
+  // Larger covers are downscaled to the height they are shown at, so neither the texture nor its cache entry is larger than needed
+  uint32_t displayHeight = (libTexToLoad == LibraryTexture::Cover && ! downscale) ? SKIF_Assets_GetCoverDisplayHeight ( ) : 0;
+
+  // Files are decoded and processed only once, after which they are uploaded straight from the texture cache
+  uint32_t                   cacheVariant = (displayHeight << 8) | (static_cast <uint32_t> (libTexToLoad) << 1) | (downscale ? 1 : 0);
+  SKIF_TextureCache::entry_s cached;
+  bool                       cacheHit     = false;
+
   if (load_str != L"\0")
   {
-    succeeded = FastTextureLoading (load_str, meta, img);
+    cacheHit  = _tex_cache.load (load_str, cacheVariant, cached);
+    succeeded = cacheHit || FastTextureLoading (load_str, meta, img);
   }
 
   else if (appid        == SKIF_STEAM_APPID     &&
@@ -437,6 +898,10 @@ LoadLibraryTexture (
 
   DirectX::ScratchImage* pImg  =   &img;
   DirectX::ScratchImage   converted_img;
+  DirectX::ScratchImage   resized_img;
+
+  const DirectX::Image*  pImages = nullptr;
+  size_t                 nImages = 0;
 
   // Start aspect ratio
 #if 0
@@ -475,8 +940,15 @@ LoadLibraryTexture (
 #endif
   // End aspect ratio
 
+  if (cacheHit)
+  {
+    meta    =  cached.meta;
+    pImages = &cached.image;
+    nImages =  1;
+  }
+
   // We don't want single-channel icons, so convert to RGBA
-  if (meta.format == DXGI_FORMAT_R8_UNORM)
+  else if (meta.format == DXGI_FORMAT_R8_UNORM)
   {
     if (
       SUCCEEDED (
@@ -496,8 +968,7 @@ LoadLibraryTexture (
   }
 
   // Downscale covers to 220x330, which will then be shown in horizon mode
-  if ((_registry._UseLowResCovers && ! _registry._UseLowResCoversHiDPIBypass && libTexToLoad == LibraryTexture::Cover) ||
-      (libTexToLoad == LibraryTexture::Logo  && name == L"sk_boxart_small.png"))
+  if (! cacheHit && downscale)
   {
     float width  = 220.0f;
     float height = 330.0f;
@@ -525,6 +996,36 @@ LoadLibraryTexture (
     }
   }
 
+  // Downscale covers larger than the height they are shown at, keeping their aspect ratio
+  else if (! cacheHit && displayHeight != 0 && meta.height > displayHeight)
+  {
+    size_t width = static_cast <size_t> (static_cast <uint64_t> (meta.width) * displayHeight / meta.height);
+
+    if (
+      SUCCEEDED (
+        DirectX::Resize (
+          pImg->GetImages   (), pImg->GetImageCount (),
+          pImg->GetMetadata (), std::max <size_t> (width, 1), displayHeight,
+          DirectX::TEX_FILTER_FANT,
+              resized_img
+        )
+      )
+    )
+    {
+      meta =  resized_img.GetMetadata ();
+      pImg = &resized_img;
+    }
+  }
+
+  if (! cacheHit)
+  {
+    pImages = pImg->GetImages     ( );
+    nImages = pImg->GetImageCount ( );
+
+    if (load_str != L"\0" && nImages == 1)
+      _tex_cache.store (load_str, cacheVariant, meta, *pImages);
+  }
+
   // Store the resolution of the loaded image
   resolution.x = static_cast<float> (meta.width);
   resolution.y = static_cast<float> (meta.height);
@@ -541,7 +1042,7 @@ LoadLibraryTexture (
     SUCCEEDED (
       DirectX::CreateTexture (
         pDevice,
-          pImg->GetImages (), pImg->GetImageCount (),
+          pImages, nImages,
             meta, (ID3D11Resource **)&pTex2D.p
       )
     )
@@ -576,7 +1077,7 @@ LoadLibraryTexture (
     // If everything went well
     else {
       DWORD post = SKIF_Util_timeGetTime1 ( );
-      PLOG_INFO << "[Image Processing] Processed image in " << (post - pre) << " ms.";
+      PLOG_INFO << "[Image Processing] Processed image in " << (post - pre) << " ms" << ((cacheHit) ? " (cached)." : ".");
 
       if (pApp != nullptr)
       {
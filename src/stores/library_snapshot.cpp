@@ -0,0 +1,692 @@
+//
+// Copyright 2020 Andon "Kaldaien" Coleman
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+//
+
+#include <stores/library_snapshot.h>
+#include <stores/Steam/steam_library.h>
+
+#include <utility/sk_utility.h>
+#include <utility/utility.h>
+#include <utility/fsutil.h>
+
+#include <algorithm>
+#include <filesystem>
+#include <type_traits>
+#include <cstring>
+
+extern std::wstring SKIF_Epic_AppDataPath;
+
+struct library_snapshot_header_s {
+  static constexpr uint32_t Magic   = 0x534C4B53; // 'SKLS'
+  static constexpr uint32_t Version = 5;          // Bump whenever the serialized fields change
+
+  uint32_t magic;
+  uint32_t version;
+  uint64_t context;
+};
+
+// A source the library was built from, and its state at the time
+struct library_snapshot_source_s {
+  enum class Kind : uint32_t {
+    File,         // Files and directories
+    RegistryHKLM32,
+    RegistryHKLM64,
+    RegistryHKCU64
+  };
+
+  Kind         kind = Kind::File;
+  std::wstring path;
+  uint64_t     size = 0; // Registry keys: number of subkeys and values
+  uint64_t     time = 0; // Last write time; 0 if the source does not exist
+
+  void probe (void)
+  {
+    size = 0;
+    time = 0;
+
+    if (kind == Kind::File)
+    {
+      WIN32_FILE_ATTRIBUTE_DATA fad = { };
+
+      if (GetFileAttributesExW (path.c_str(), GetFileExInfoStandard, &fad))
+      {
+        size = (static_cast <uint64_t> (fad.nFileSizeHigh)                  << 32) | fad.nFileSizeLow;
+        time = (static_cast <uint64_t> (fad.ftLastWriteTime.dwHighDateTime) << 32) | fad.ftLastWriteTime.dwLowDateTime;
+      }
+
+      return;
+    }
+
+    HKEY   hRoot = (kind == Kind::RegistryHKCU64) ? HKEY_CURRENT_USER : HKEY_LOCAL_MACHINE;
+    REGSAM sam   = (kind == Kind::RegistryHKLM32) ? KEY_WOW64_32KEY   : KEY_WOW64_64KEY;
+    HKEY   hKey  = nullptr;
+
+    if (RegOpenKeyExW (hRoot, path.c_str(), 0, KEY_READ | sam, &hKey) == ERROR_SUCCESS)
+    {
+      DWORD    dwSubKeys = 0,
+               dwValues  = 0;
+      FILETIME ftWrite   = { };
+
+      if (RegQueryInfoKeyW (hKey, NULL, NULL, NULL, &dwSubKeys, NULL, NULL, &dwValues, NULL, NULL, NULL, &ftWrite) == ERROR_SUCCESS)
+      {
+        size = (static_cast <uint64_t> (dwSubKeys)              << 32) | dwValues;
+        time = (static_cast <uint64_t> (ftWrite.dwHighDateTime) << 32) | ftWrite.dwLowDateTime;
+      }
+
+      RegCloseKey (hKey);
+    }
+  }
+};
+
+#pragma region Serialization
+
+struct library_snapshot_writer_s {
+  static constexpr bool Reading = false;
+
+  std::string buffer;
+
+  void put (const void* data, size_t size)
+  {
+    buffer.append (static_cast <const char *> (data), size);
+  }
+
+  template <class _Tp>
+  void operator() (const _Tp& value)
+  {
+    static_assert (std::is_arithmetic_v <_Tp> || std::is_enum_v <_Tp>);
+    put (&value, sizeof (_Tp));
+  }
+
+  void operator() (const std::string& value)
+  {
+    uint32_t len = static_cast <uint32_t> (value.length ( ));
+    put (&len, sizeof (len));
+    put (value.data ( ), len);
+  }
+
+  void operator() (const std::wstring& value)
+  {
+    uint32_t len = static_cast <uint32_t> (value.length ( ));
+    put (&len, sizeof (len));
+    put (value.data ( ), len * sizeof (wchar_t));
+  }
+};
+
+struct library_snapshot_reader_s {
+  static constexpr bool Reading = true;
+
+  const BYTE* pos = nullptr;
+  const BYTE* end = nullptr;
+  bool        ok  = true;
+
+  bool get (void* out, size_t size)
+  {
+    if (! ok || static_cast <size_t> (end - pos) < size)
+      return (ok = false);
+
+    memcpy (out, pos, size);
+    pos += size;
+
+    return true;
+  }
+
+  template <class _Tp>
+  void operator() (_Tp& value)
+  {
+    static_assert (std::is_arithmetic_v <_Tp> || std::is_enum_v <_Tp>);
+    get (&value, sizeof (_Tp));
+  }
+
+  void operator() (std::string& value)
+  {
+    uint32_t len = 0;
+
+    if (get (&len, sizeof (len)) && static_cast <size_t> (end - pos) >= len)
+    {
+      value.assign (reinterpret_cast <const char *> (pos), len);
+      pos += len;
+    }
+
+    else
+      ok = false;
+  }
+
+  void operator() (std::wstring& value)
+  {
+    uint32_t len = 0;
+
+    if (get (&len, sizeof (len)) && static_cast <size_t> (end - pos) / sizeof (wchar_t) >= len)
+    {
+      value.resize (len);
+      memcpy (value.data ( ), pos, len * sizeof (wchar_t));
+      pos += len * sizeof (wchar_t);
+    }
+
+    else
+      ok = false;
+  }
+};
+
+// The same functions are used for both directions, so the layout cannot get out of sync
+
+template <class _Archive>
+static void
+SKIF_LibrarySnapshot_Serialize (_Archive& ar, std::set <std::string>& strings)
+{
+  uint32_t count = static_cast <uint32_t> (strings.size ( ));
+  ar (count);
+
+  if constexpr (_Archive::Reading)
+  {
+    for (uint32_t i = 0; i < count && ar.ok; i++)
+    {
+      std::string str;
+      ar (str);
+      strings.emplace (std::move (str));
+    }
+  }
+
+  else
+  {
+    for (auto& str : strings)
+      ar (str);
+  }
+}
+
+template <class _Archive>
+static void
+SKIF_LibrarySnapshot_Serialize (_Archive& ar, app_record_s::sk_install_state_s& state)
+{
+  ar (state.injection.bitness);
+  ar (state.injection.type);
+
+  ar (state.config.type);
+  ar (state.config.type_utf8);
+  ar (state.config.shorthand);
+  ar (state.config.shorthand_utf8);
+  ar (state.config.root_dir);
+  ar (state.config.root_dir_utf8);
+  ar (state.config.full_path);
+  ar (state.config.full_path_utf8);
+
+  ar (state.dll.shorthand);
+  ar (state.dll.shorthand_utf8);
+  ar (state.dll.version);
+  ar (state.dll.version_utf8);
+  ar (state.dll.full_path);
+  ar (state.dll.full_path_utf8);
+
+  ar (state.localized_name);
+}
+
+template <class _Archive>
+static void
+SKIF_LibrarySnapshot_Serialize (_Archive& ar, std::map <int, app_record_s::launch_config_s>& launch_configs)
+{
+  uint32_t count = static_cast <uint32_t> (launch_configs.size ( ));
+  ar (count);
+
+  auto _Serialize = [&](app_record_s::launch_config_s& lc)
+  {
+    ar (lc.id);
+    ar (lc.id_steam);
+    SKIF_LibrarySnapshot_Serialize (ar, lc.injection);
+    ar (lc.type);
+    ar (lc.cpu_type);
+    ar (lc.platforms);
+    ar (lc.executable);
+    ar (lc.executable_utf8);
+    ar (lc.executable_path);
+    ar (lc.executable_path_utf8);
+    ar (lc.install_dir);
+    ar (lc.Xbox_ApplicationId);
+    ar (lc.description);
+    ar (lc.description_utf8);
+    ar (lc.launch_options);
+    ar (lc.launch_options_utf8);
+    ar (lc.working_dir);
+    ar (lc.working_dir_utf8);
+    ar (lc.blacklist_file);
+    ar (lc.elevated_file);
+    ar (lc.executable_helper);
+    SKIF_LibrarySnapshot_Serialize (ar, lc.branches);
+    ar (lc.branches_joined);
+    ar (lc.requires_dlc);
+    ar (lc.valid);
+    ar (lc.duplicate_exe);
+    ar (lc.duplicate_exe_args);
+    ar (lc.custom_skif);
+    ar (lc.custom_user);
+    ar (lc.owns_dlc);
+
+    // Validity of the executable, blacklisting and elevation reflect files on disk, so are left to be checked again
+  };
+
+  if constexpr (_Archive::Reading)
+  {
+    for (uint32_t i = 0; i < count && ar.ok; i++)
+    {
+      int                           key = 0;
+      app_record_s::launch_config_s lc;
+      ar (key);
+      _Serialize (lc);
+      launch_configs.emplace (key, std::move (lc));
+    }
+  }
+
+  else
+  {
+    for (auto& lc : launch_configs)
+    {
+      ar (lc.first);
+      _Serialize (lc.second);
+    }
+  }
+}
+
+template <class _Archive>
+static void
+SKIF_LibrarySnapshot_Serialize (_Archive& ar, std::pair <std::string, app_record_s>& app)
+{
+  auto& record = app.second;
+
+  ar (app.first);
+  ar (record.id);
+  ar (record.store);
+  ar (record.store_utf8);
+  ar (record.install_dir);
+  ar (record._status.installed);
+  ar (record.cloud_enabled);
+  ar (record.ImGuiPushID);
+  ar (record.ImGuiLabelID);
+
+  uint64_t pre_stripped = record.names.pre_stripped;
+  ar (record.names.all_upper);
+  ar (record.names.all_upper_alnum);
+  ar (record.names.original);
+  ar (record.names.clean);
+  ar (record.names.normal);
+  ar (pre_stripped);
+  record.names.pre_stripped = static_cast <size_t> (pre_stripped);
+
+  ar (record.common_config.appid);
+  ar (record.common_config.cpu_type);
+  ar (record.common_config.type);
+  ar (record.common_config.icon_hash);
+  ar (record.common_config.boxart_hash);
+
+  ar (record.skif.name);
+  ar (record.skif.cpu_type);
+  ar (record.skif.instant_play);
+  ar (record.skif.auto_stop);
+  ar (record.skif.uses);
+  ar (record.skif.used);
+  ar (record.skif.used_formatted);
+  ar (record.skif.category);
+  ar (record.skif.hidden);
+  ar (record.skif.pinned);
+
+  ar (record.steam.local.launch_option);
+  ar (record.steam.local.launch_option_parsed);
+  ar (record.steam.shared.hidden);
+  ar (record.steam.shared.favorite);
+  ar (record.steam.branch);
+
+  ar (record.epic.catalog_namespace);
+  ar (record.epic.catalog_item_id);
+  ar (record.epic.name_app);
+  ar (record.epic.name_display);
+
+  ar (record.xbox.package_name);
+  ar (record.xbox.package_name_full);
+  ar (record.xbox.package_name_family);
+  ar (record.xbox.store_id);
+  ar (record.xbox.directory_app);
+  ar (record.xbox.directory_program_files);
+
+  ar (record.specialk.profile_dir);
+  ar (record.specialk.profile_dir_utf8);
+  SKIF_LibrarySnapshot_Serialize (ar, record.specialk.injection);
+
+  // Only present if something was loaded into the cold data of the app, so as to not allocate it for every app
+  bool has_details = record.details.allocated ();
+  ar (has_details);
+
+  if (has_details)
+  {
+    ar (record.details->extended_config.dev.publisher);
+    ar (record.details->extended_config.dev.developer);
+    ar (record.details->extended_config.dev.homepage);
+    ar (record.details->ui.pcgw);
+    ar (record.details->ui.sgdbGrids);
+    ar (record.details->ui.sgdbIcons);
+  }
+
+  SKIF_LibrarySnapshot_Serialize (ar, record.launch_configs);
+  SKIF_LibrarySnapshot_Serialize (ar, record.launch_configs_custom);
+
+  // Neither the Steam manifest nor its path is kept; SK_GetManifestForAppID only reads
+  //   the manifest while the path is still empty, so it is parsed again on demand
+}
+
+#pragma endregion
+
+static std::wstring
+SKIF_LibrarySnapshot_GetPath (void)
+{
+  static SKIF_CommonPathsCache& _path_cache = SKIF_CommonPathsCache::GetInstance ( );
+
+  return SK_FormatStringW (LR"(%ws\Cache\library.bin)", _path_cache.specialk_userdata);
+}
+
+// Lists every source the current library was built from
+static std::vector <library_snapshot_source_s>
+SKIF_LibrarySnapshot_GatherSources (const std::vector <std::pair <std::string, app_record_s>>& apps)
+{
+  static SKIF_CommonPathsCache& _path_cache = SKIF_CommonPathsCache::GetInstance ( );
+
+  using Kind = library_snapshot_source_s::Kind;
+
+  std::vector <library_snapshot_source_s> sources;
+
+  auto _Add = [&](Kind kind, std::wstring path)
+  {
+    library_snapshot_source_s& source =
+      sources.emplace_back ( );
+
+    source.kind = kind;
+    source.path = std::move (path);
+    source.probe ( );
+  };
+
+  // Launch configs and metadata
+  _Add (Kind::File, SK_FormatStringW (LR"(%ws\Assets\lc.json)",      _path_cache.specialk_userdata));
+  _Add (Kind::File, SK_FormatStringW (LR"(%ws\Assets\lc_user.json)", _path_cache.specialk_userdata));
+  _Add (Kind::File, SK_FormatStringW (LR"(%ws\Assets\db.json)",      _path_cache.specialk_userdata));
+  _Add (Kind::File, SK_FormatStringW (LR"(%ws\Assets\db.json.journal)", _path_cache.specialk_userdata)); // Changes made since db.json was written
+
+  // Steam
+  if (_path_cache.steam_install[0] != L'\0')
+  {
+    _Add (Kind::File, SK_FormatStringW (LR"(%ws\appcache\appinfo.vdf)",      _path_cache.steam_install));
+    _Add (Kind::File, SK_FormatStringW (LR"(%ws\config\libraryfolders.vdf)", _path_cache.steam_install));
+
+    SteamId3_t userid = SKIF_Steam_GetCurrentUser ( );
+
+    if (userid != 0)
+    {
+      _Add (Kind::File, SK_UTF8ToWideChar (SKIF_Steam_GetUserConfigStorePath (userid, ConfigStore_UserLocal)));
+      _Add (Kind::File, SK_UTF8ToWideChar (SKIF_Steam_GetUserConfigStorePath (userid, ConfigStore_UserRoaming)));
+    }
+
+    steam_library_t* steam_lib_paths = nullptr;
+    int              steam_libs      = SK_Steam_GetLibraries (&steam_lib_paths);
+
+    // Manifests being added or removed changes the last write time of the folder
+    for (int i = 0; i < steam_libs && steam_lib_paths != nullptr; i++)
+      _Add (Kind::File, SK_FormatStringW (LR"(%ws\steamapps)", (const wchar_t *)steam_lib_paths [i]));
+  }
+
+  for (auto& app : apps)
+  {
+    if (app.second.id    != 0                          &&
+        app.second.store == app_record_s::Store::Steam &&
+      ! app.second.steam.manifest_path.empty ( )       &&
+        app.second.steam.manifest_path != L"<InvalidPath>")
+      _Add (Kind::File, app.second.steam.manifest_path);
+  }
+
+  // Epic
+  if (! SKIF_Epic_AppDataPath.empty ( ))
+    _Add (Kind::File, SKIF_Epic_AppDataPath);
+
+  // GOG, Xbox and custom titles
+  _Add (Kind::RegistryHKLM32, LR"(SOFTWARE\GOG.com\Games)");
+  _Add (Kind::RegistryHKLM64, LR"(SOFTWARE\Microsoft\GamingServices\PackageRepository\Root)");
+  _Add (Kind::RegistryHKCU64, LR"(SOFTWARE\Kaldaien\Special K\Games)");
+
+  return sources;
+}
+
+bool
+SKIF_LibrarySnapshot_Load (uint64_t context, std::vector <std::pair <std::string, app_record_s>>& apps, std::set <std::string>& apptickets)
+{
+  std::wstring path =
+    SKIF_LibrarySnapshot_GetPath ( );
+
+  if (GetFileAttributesW (path.c_str()) == INVALID_FILE_ATTRIBUTES)
+    return false;
+
+  SK_MappedFile file;
+
+  if (! file.open (path.c_str()))
+    return false;
+
+  library_snapshot_reader_s reader;
+  reader.pos = file.data ( );
+  reader.end = file.end  ( );
+
+  library_snapshot_header_s header = { };
+  reader.get (&header, sizeof (header));
+
+  if (! reader.ok                                          ||
+      header.magic   != library_snapshot_header_s::Magic   ||
+      header.version != library_snapshot_header_s::Version)
+  {
+    PLOG_WARNING << "Ignoring incompatible library snapshot: " << path;
+    return false;
+  }
+
+  if (header.context != context)
+  {
+    PLOG_INFO << "Library snapshot was created with different settings; ignoring it.";
+    return false;
+  }
+
+  // Compare the state of every source against the current one
+  uint32_t sources = 0;
+  reader (sources);
+
+  for (uint32_t i = 0; i < sources && reader.ok; i++)
+  {
+    library_snapshot_source_s source;
+    uint64_t                  size = 0,
+                              time = 0;
+
+    reader (source.kind);
+    reader (source.path);
+    reader (size);
+    reader (time);
+
+    if (! reader.ok)
+      break;
+
+    source.probe ( );
+
+    if (source.size != size || source.time != time)
+    {
+      PLOG_INFO << "Library snapshot is out of date: " << source.path;
+      return false;
+    }
+  }
+
+  uint32_t count = 0;
+  reader (count);
+
+  std::vector <std::pair <std::string, app_record_s>> snapshot;
+
+  if (reader.ok)
+    snapshot.reserve (std::min <size_t> (count, reader.end - reader.pos));
+
+  for (uint32_t i = 0; i < count && reader.ok; i++)
+  {
+    std::pair <std::string, app_record_s> app ("", app_record_s (0));
+    SKIF_LibrarySnapshot_Serialize (reader, app);
+    snapshot.emplace_back (std::move (app));
+  }
+
+  std::set <std::string> tickets;
+  SKIF_LibrarySnapshot_Serialize (reader, tickets);
+
+  if (! reader.ok || reader.pos != reader.end)
+  {
+    PLOG_WARNING << "Ignoring corrupt library snapshot: " << path;
+    return false;
+  }
+
+  apps       = std::move (snapshot);
+  apptickets = std::move (tickets);
+
+  return true;
+}
+
+void
+SKIF_LibrarySnapshot_Save (uint64_t context, const std::vector <std::pair <std::string, app_record_s>>& apps, const std::set <std::string>& apptickets)
+{
+  library_snapshot_writer_s writer;
+
+  library_snapshot_header_s header = { };
+  header.magic   = library_snapshot_header_s::Magic;
+  header.version = library_snapshot_header_s::Version;
+  header.context = context;
+
+  writer.put (&header, sizeof (header));
+
+  auto sources =
+    SKIF_LibrarySnapshot_GatherSources (apps);
+
+  writer (static_cast <uint32_t> (sources.size ( )));
+
+  for (auto& source : sources)
+  {
+    writer (source.kind);
+    writer (source.path);
+    writer (source.size);
+    writer (source.time);
+  }
+
+  // Apps that were filtered out during processing are not kept
+  uint32_t count = static_cast <uint32_t> (
+    std::count_if (apps.begin ( ), apps.end ( ), [](const auto& app) { return app.second.id != 0; })
+  );
+
+  writer (count);
+
+  for (auto& app : apps)
+  {
+    if (app.second.id != 0)
+      SKIF_LibrarySnapshot_Serialize (writer, const_cast <std::pair <std::string, app_record_s>&> (app));
+  }
+
+  SKIF_LibrarySnapshot_Serialize (writer, const_cast <std::set <std::string>&> (apptickets));
+
+  std::wstring path = SKIF_LibrarySnapshot_GetPath ( ),
+               temp = path + L".tmp";
+
+  std::error_code ec;
+  std::filesystem::create_directories (std::filesystem::path (path).parent_path ( ), ec);
+
+  // Written to a temporary file first, so a partially written snapshot is never picked up
+  {
+    CHandle hFile (
+      CreateFileW (temp.c_str(), GENERIC_WRITE, 0x0, nullptr, CREATE_ALWAYS, FILE_ATTRIBUTE_NORMAL | FILE_FLAG_SEQUENTIAL_SCAN, nullptr)
+    );
+
+    if (hFile.m_h == INVALID_HANDLE_VALUE)
+    {
+      hFile.Detach ( );
+      PLOG_ERROR << "Failed to create library snapshot: " << temp;
+      return;
+    }
+
+    DWORD dwWritten = 0;
+
+    if (! WriteFile (hFile, writer.buffer.data ( ), static_cast <DWORD> (writer.buffer.size ( )), &dwWritten, nullptr) ||
+        dwWritten != writer.buffer.size ( ))
+    {
+      hFile.Close ( );
+      DeleteFileW (temp.c_str());
+      return;
+    }
+  }
+
+  if (! MoveFileExW (temp.c_str(), path.c_str(), MOVEFILE_REPLACE_EXISTING))
+  {
+    DeleteFileW (temp.c_str());
+    return;
+  }
+
+  PLOG_INFO << "Wrote library snapshot (" << count << " apps, " << sources.size ( ) << " sources, " << writer.buffer.size ( ) << " bytes).";
+}
+
+uint64_t
+SKIF_LibrarySnapshot_Fingerprint (const std::pair <std::string, app_record_s>& app)
+{
+  library_snapshot_writer_s writer;
+
+  SKIF_LibrarySnapshot_Serialize (writer, const_cast <std::pair <std::string, app_record_s>&> (app));
+
+  // Decoded from appinfo.vdf, but not part of the snapshot as that is always followed by a rebuild;
+  //   included so a library patch replaces the app when Steam changes its branches, cloud saves or VAC status
+  const auto& record = app.second;
+
+  writer (record.processed);
+
+  if (record.details.allocated ( ))
+  {
+    const auto& details = *record.details;
+
+    writer (details.extended_config.vac.enabled);
+    writer (details.extended_config.vac.vacmodulecache);
+    writer (details.extended_config.vac.vacmacmodulecache);
+    writer (details.extended_config.vac.vacmodulefilename);
+
+    for (const auto& branch : details.branches)
+    {
+      writer (branch.first);
+      writer (branch.second.build_id);
+      writer (branch.second.pwd_required);
+      writer (static_cast <int64_t> (branch.second.time_updated));
+      writer (branch.second.description);
+    }
+
+    for (const auto& cloud_save : details.cloud_saves)
+    {
+      writer (cloud_save.first);
+      writer (cloud_save.second.platforms);
+      writer (cloud_save.second.root);
+      writer (cloud_save.second.path);
+      writer (cloud_save.second.evaluated_dir);
+      writer (cloud_save.second.pattern);
+    }
+  }
+
+  // FNV-1a
+  uint64_t hash = 0xcbf29ce484222325ULL;
+
+  for (unsigned char c : writer.buffer)
+  {
+    hash ^= c;
+    hash *= 0x100000001b3ULL;
+  }
+
+  return hash;
+}
@@ -61,6 +61,9 @@
 #include <utility/registry.h>
 #include <utility/updater.h>
 #include <stores/Steam/steam_library.h>
+#include <stores/library_snapshot.h>
+#include <stores/app_key.h>
+#include <utility/task_scheduler.h>
 
 constexpr char         spaces[]          = { "\u0020\u0020\u0020\u0020" };
 constexpr wchar_t*     utf8_bom          =  L"\xEF\xBB\xBF";
@@ -163,6 +166,15 @@ nlohmann::json       jsonMetaDB;
 std::recursive_mutex jsonMetaDB_mutex;
 //std::shared_mutex    jsonMetaDB_mutex;
 
+// Changes to jsonMetaDB are appended to a journal next to db.json instead of rewriting the whole file,
+//   and the journal is folded back into db.json whenever it grows too large or the library is refreshed
+struct {
+  CHandle  hFile;
+  uint32_t entries    = 0;
+  static constexpr
+    uint32_t MaxEntries = 512; // Compact once the journal holds this many changes
+} static jsonMetaDB_journal;
+
 const float fTintMin     = 0.75f;
       float fTint        = 1.0f;
       float fAlpha       = 0.0f;
@@ -393,7 +405,7 @@ CalculateImageSizing (image_s& image, ImVec2 contentRegionAvail, ImVec2 imageRes
 #pragma endregion
 
 
-#pragma region Trie Keyboard Hint Search
+#pragma region Keyboard Hint Search
 
 struct {
   uint32_t            id = 0;
@@ -401,8 +413,30 @@ struct {
   std::string         category = "";
 } static search_selection;
 
-Trie labels;
-Trie labelsFiltered;
+// Built from g_apps on demand, as it refers to the apps by their position in the list
+SKIF_SearchIndex labels;
+
+// Flags the apps whose name or store ID matches the filter, by their position in g_apps
+static void
+SearchFilterMatches (std::vector <bool>& matches)
+{
+  static std::vector <SKIF_SearchIndex::match_s> ranked;
+
+  std::scoped_lock app_lock (g_apps_mutex);
+
+  matches.assign (g_apps.size (), false);
+
+  if (charFilter[0] == '\0')
+    return;
+
+  if (! labels.current ( ))
+    labels.build (g_apps);
+
+  labels.search (charFilter, ranked);
+
+  for (auto& match : ranked)
+    matches [match.index] = true;
+}
 
 static void
 SearchAppsList (void)
@@ -410,16 +444,8 @@ SearchAppsList (void)
   if (bFilterActive || bCategoryMgnt)
     return;
 
-  static auto
-    constexpr _text_chars =
-      { 'A','B','C','D','E','F','G','H',
-        'I','J','K','L','M','N','O','P',
-        'Q','R','S','T','U','V','W','X',
-        'Y','Z','0','1','2','3','4','5',
-        '6','7','8','9',' ','-','.' }; // ':', // ???
-
   static char test_ [1024] = {      };
-  char        out   [2]    = { 0, 0 };
+  char        out   [5]    = {      };
   bool        bText        = false;
 
   const  DWORD dwTimeout    = 850UL; // 425UL
@@ -455,13 +481,16 @@ SearchAppsList (void)
     dwLastUpdate = MAXDWORD; // Timer
   }
 
-  // Check input
-  for ( auto c : _text_chars )
+  // Check input, any script goes as the search index folds the case of them all
+  for (ImWchar c : ImGui::GetIO ().InputQueueCharacters)
   {
-    if (ImGui::GetKeyData (SKIF_ImGui_CharToImGuiKey (c))->DownDuration == 0.0f &&
-        (c != ' ' || strlen (test_) > 0))
+    if (c < 0x20 || c == 0x7F || (c == ' ' && strlen (test_) == 0))
+      continue;
+
+    ImTextCharToUtf8 (out, c);
+
+    if (strlen (test_) + strlen (out) < sizeof (test_))
     {
-      out [0] = c;
       StrCatA (test_, out);
       bText   = true;
     }
@@ -472,62 +501,71 @@ SearchAppsList (void)
   {
     dwLastUpdate = SKIF_Util_timeGetTime ();
 
-    Trie* searchLabels = (charFilter[0] != '\0') ? &labelsFiltered : &labels;
+    static std::vector <uint32_t>                   matches;
+    static std::vector <SKIF_SearchIndex::match_s>  ranked;
+    std::string                                     query = SKIF_Util_FoldCase (test_);
+    bool                                            found = false;
 
     // Acquire lock before iterating the global apps list
     std::scoped_lock app_lock (g_apps_mutex);
+
+    if (! labels.current ( ))
+      labels.build (g_apps);
       
-    // Prioritize trie search first
-    if (searchLabels->search (test_))
+    // Prioritize prefix search first
+    if (labels.find (query, matches))
     {
-      for (auto& app : g_apps)
+      for (uint32_t idx : matches)
       {
+        auto& app = g_apps [idx];
+
         // Skip invalid/hidden and filtered ones
         if (app.second.id == 0 || app.second.filtered)
           continue;
 
-        if (app.second.names.all_upper_alnum.find (test_) == 0)
-        {
-          result.text     = app.second.names.normal;
-          result.store    = app.second.store;
-          result.app_id   = app.second.id;
-          result.category = GetEffectiveCategory (&app.second);
-          result.pos      = app.second.names.pre_stripped;
-          result.len      = strlen (test_);
+        found = true;
 
-          // Handle cases where articles are ignored
+        result.text     = app.second.names.normal;
+        result.store    = app.second.store;
+        result.app_id   = app.second.id;
+        result.category = GetEffectiveCategory (&app.second);
+        result.pos      = app.second.names.pre_stripped;
+        result.len      = query.length ();
 
-          // Add one to the length if the regular all_upper cannot find a match
-          // as this indicates a stripped character in the found pattern
-          if (app.second.names.all_upper.find (test_) != 0)
-            result.len++;
+        // Handle cases where articles are ignored
 
-          break;
-        }
+        // Add one to the length if the regular all_upper cannot find a match
+        // as this indicates a stripped character in the found pattern
+        if (app.second.names.all_upper.find (query) != 0)
+          result.len++;
+
+        break;
       }
     }
 
-    // Fall back to using free text search when the trie fails us
-    else
+    // Fall back to the ranked substring/typo tolerant search when the prefix search fails us
+    if (! found && labels.search (query, ranked))
     {
-      for (auto& app : g_apps)
+      for (auto& match : ranked)
       {
+        auto& app = g_apps [match.index];
+
         // Skip invalid/hidden and filtered ones
         if (app.second.id == 0 || app.second.filtered)
           continue;
 
-        size_t 
-            pos  = app.second.names.all_upper.find (test_);
-        if (pos != std::string::npos ) // == 0 
-        {
-          result.text   = app.second.names.normal;
-          result.store  = app.second.store;
-          result.app_id = app.second.id;
-          result.pos    = pos;
-          result.len    = strlen (test_);
+        result.text     = app.second.names.normal;
+        result.store    = app.second.store;
+        result.app_id   = app.second.id;
+        result.category = GetEffectiveCategory (&app.second);
+        result.pos      = match.pos;
+        result.len      = match.len;
 
-          break;
-        }
+        // Positions within the folded name only apply if folding did not change its length
+        if (app.second.names.all_upper.length () != result.text.length ())
+          result.len    = 0;
+
+        break;
       }
     }
   }
@@ -587,7 +625,39 @@ JsonDB_CountElements (void)
   return items;
 }
 
-// This writes the Json object to the disk
+static std::wstring
+JsonDB_GetJournalPath (void)
+{
+  return file_metadata + L".journal";
+}
+
+// Identifies the exact db.json a journal applies to, so a journal left behind by
+//   an interrupted compaction is never replayed on top of the compacted file
+static nlohmann::json
+JsonDB_GetJournalBase (void)
+{
+  WIN32_FILE_ATTRIBUTE_DATA fad = { };
+  GetFileAttributesExW (file_metadata.c_str(), GetFileExInfoStandard, &fad);
+
+  return {
+    { "Op",   "Base" },
+    { "Size", (static_cast <uint64_t> (fad.nFileSizeHigh)                  << 32) | fad.nFileSizeLow                  },
+    { "Time", (static_cast <uint64_t> (fad.ftLastWriteTime.dwHighDateTime) << 32) | fad.ftLastWriteTime.dwLowDateTime }
+  };
+}
+
+static void
+JsonDB_CloseJournal (void)
+{
+  std::scoped_lock jsonLock (jsonMetaDB_mutex);
+
+  if (jsonMetaDB_journal.hFile.m_h != NULL)
+    jsonMetaDB_journal.hFile.Close ( );
+
+  jsonMetaDB_journal.entries = 0;
+}
+
+// This writes the Json object to the disk, and discards the journal as its changes are now part of the file
 bool
 JsonDB_WriteFile (void)
 {
@@ -595,11 +665,33 @@ JsonDB_WriteFile (void)
 
   if (! jsonMetaDB.is_discarded())
   {
-    std::ofstream out_file(file_metadata);
-    if (out_file.is_open())
+    std::wstring temp = file_metadata + L".tmp";
+
+    HANDLE hFile =
+      CreateFileW (temp.c_str(), GENERIC_WRITE, 0, nullptr, CREATE_ALWAYS, FILE_ATTRIBUTE_NORMAL, nullptr);
+
+    if (hFile != INVALID_HANDLE_VALUE)
     {
-      out_file << std::setw(2) << jsonMetaDB << std::endl;
-      out_file.close();
+      std::string data      = jsonMetaDB.dump (2) + "\n";
+      DWORD       dwWritten = 0;
+
+      // The data has to be on the disk before the rename, or a power loss could leave an empty db.json behind
+      bool bWritten = WriteFile (hFile, data.data(), static_cast <DWORD> (data.size()), &dwWritten, nullptr) &&
+                      dwWritten == data.size() &&
+                      FlushFileBuffers (hFile);
+
+      CloseHandle (hFile);
+
+      // Replace the file in one go, so a crash never leaves a partially written db.json behind
+      if (! bWritten || ! MoveFileEx (temp.c_str(), file_metadata.c_str(), MOVEFILE_REPLACE_EXISTING | MOVEFILE_WRITE_THROUGH))
+      {
+        PLOG_ERROR << "Could not replace JSON file: " << file_metadata;
+        DeleteFile (temp.c_str());
+        return false;
+      }
+
+      JsonDB_CloseJournal ( );
+      DeleteFile (JsonDB_GetJournalPath ( ).c_str());
 
       PLOG_INFO << "Successfully wrote persistent metadata (" << JsonDB_CountElements ( ) << " items) to JSON file.";
 
@@ -616,7 +708,144 @@ JsonDB_WriteFile (void)
   return false;
 }
 
-// This both updates the metadata and optionally writes the new object to the disk
+// Appends a single change to the journal
+static bool
+JsonDB_AppendJournal (const nlohmann::json& change)
+{
+  std::scoped_lock jsonLock (jsonMetaDB_mutex);
+
+  if (jsonMetaDB_journal.entries >= jsonMetaDB_journal.MaxEntries)
+    return JsonDB_WriteFile ( );
+
+  if (jsonMetaDB_journal.hFile.m_h == NULL)
+  {
+    std::wstring path = JsonDB_GetJournalPath ( );
+
+    // A journal that exists at this point has already been replayed into jsonMetaDB, so it can just be continued
+    bool bNew = (GetFileAttributesW (path.c_str()) == INVALID_FILE_ATTRIBUTES);
+
+    HANDLE hFile =
+      CreateFileW (path.c_str(), FILE_APPEND_DATA, FILE_SHARE_READ, nullptr, OPEN_ALWAYS, FILE_ATTRIBUTE_NORMAL, nullptr);
+
+    if (hFile == INVALID_HANDLE_VALUE)
+    {
+      PLOG_ERROR << "Could not open JSON journal for writing: " << path;
+      return JsonDB_WriteFile ( );
+    }
+
+    jsonMetaDB_journal.hFile.Attach (hFile);
+
+    if (bNew)
+    {
+      std::string line = JsonDB_GetJournalBase ( ).dump ( ) + "\n";
+      DWORD       dwWritten = 0;
+
+      WriteFile (jsonMetaDB_journal.hFile, line.data(), static_cast <DWORD> (line.size()), &dwWritten, nullptr);
+    }
+  }
+
+  // One write per change; an entry torn by a crash is detected and dropped during replay
+  std::string line      = change.dump ( ) + "\n";
+  DWORD       dwWritten = 0;
+
+  if (! WriteFile (jsonMetaDB_journal.hFile, line.data(), static_cast <DWORD> (line.size()), &dwWritten, nullptr) || dwWritten != line.size())
+  {
+    PLOG_ERROR << "Could not append to JSON journal; writing the full file instead.";
+    return JsonDB_WriteFile ( );
+  }
+
+  // A change only counts as saved once it has reached the disk, along with the base of a new journal
+  FlushFileBuffers (jsonMetaDB_journal.hFile);
+
+  jsonMetaDB_journal.entries++;
+
+  return true;
+}
+
+static void
+JsonDB_ApplyCategoryName (const std::string& szOld, const std::string& szNew)
+{
+  for (auto& platform : jsonMetaDB)
+  {
+    for (auto& game : platform)
+    {
+      if (! game.empty() && game.contains("Category") && game.at("Category") == szOld)
+        game.at("Category") = szNew;
+    }
+  }
+}
+
+// Applies the journal on top of the freshly read db.json
+static void
+JsonDB_ReplayJournal (void)
+{
+  std::scoped_lock jsonLock (jsonMetaDB_mutex);
+
+  JsonDB_CloseJournal ( );
+
+  std::wstring  path = JsonDB_GetJournalPath ( );
+  std::ifstream file (path);
+
+  if (! file.is_open())
+    return;
+
+  std::string line;
+  uint32_t    replayed = 0;
+  bool        valid    = false;
+
+  if (std::getline (file, line))
+  {
+    nlohmann::json base = nlohmann::json::parse (line, nullptr, false);
+
+    valid = (! base.is_discarded() && base == JsonDB_GetJournalBase ( ));
+  }
+
+  if (valid && ! jsonMetaDB.is_discarded())
+  {
+    while (std::getline (file, line))
+    {
+      nlohmann::json change = nlohmann::json::parse (line, nullptr, false);
+
+      // Only the last entry can be incomplete, if SKIF stopped in the middle of writing it
+      if (change.is_discarded() || ! change.contains ("Op"))
+      {
+        PLOG_WARNING << "Ignoring incomplete entry at the end of the JSON journal.";
+        break;
+      }
+
+      try {
+        if (change.at ("Op") == "App")
+          jsonMetaDB[change.at ("Store").get <std::string> ()][change.at ("Item").get <std::string> ()] = change.at ("Value");
+
+        else if (change.at ("Op") == "Category")
+          JsonDB_ApplyCategoryName (change.at ("Old").get <std::string> (), change.at ("New").get <std::string> ());
+
+        replayed++;
+      }
+      catch (const std::exception&)
+      {
+        PLOG_ERROR << "Error occurred when trying to replay a change from " << path;
+      }
+    }
+  }
+
+  file.close ( );
+
+  if (valid)
+  {
+    jsonMetaDB_journal.entries = replayed;
+    PLOG_INFO << "Replayed " << replayed << " changes from the JSON journal.";
+  }
+
+  // Left behind by an interrupted compaction; the changes are already part of db.json
+  else
+  {
+    PLOG_INFO << "Discarding outdated JSON journal: " << path;
+    DeleteFile (path.c_str());
+  }
+}
+
+// This both updates the metadata and optionally writes the change to the disk
 bool
 JsonDB_UpdateApp (app_record_s* pApp, bool bWriteToDisk)
 {
@@ -625,9 +854,7 @@ JsonDB_UpdateApp (app_record_s* pApp, bool bWriteToDisk)
   // Update the db.json file with any new values
   if (! jsonMetaDB.is_discarded())
   {
-    std::string item = (pApp->store == app_record_s::Store::Epic)  ? pApp->epic.name_app     :
-                       (pApp->store == app_record_s::Store::Xbox)  ? pApp->xbox.package_name :
-                                                     std::to_string (pApp->id);
+    std::string item = SKIF_AppKey_GetKey (*pApp);
 
     try {
       auto& key = jsonMetaDB[pApp->store_utf8][item];
@@ -649,7 +876,12 @@ JsonDB_UpdateApp (app_record_s* pApp, bool bWriteToDisk)
           pApp->store == app_record_s::Store::Xbox)
         key += { "InstantPlay", pApp->skif.instant_play };
 
-      return ! bWriteToDisk || JsonDB_WriteFile ( );
+      return ! bWriteToDisk || JsonDB_AppendJournal ({
+        { "Op",    "App"            },
+        { "Store", pApp->store_utf8 },
+        { "Item",  item             },
+        { "Value", key              }
+      });
     }
     catch (const std::exception&)
     {
@@ -674,16 +906,13 @@ JsonDB_SetCategoryName (std::string szOld, std::string szNew)
 
   if (! jsonMetaDB.is_discarded())
   {
-    for (auto& platform : jsonMetaDB)
-    {
-      for (auto& game : platform)
-      {
-        if (! game.empty() && game.contains("Category") && game.at("Category") == szOld)
-          game.at("Category") = szNew;
-      }
-    }
+    JsonDB_ApplyCategoryName (szOld, szNew);
 
-    return JsonDB_WriteFile ( );
+    return JsonDB_AppendJournal ({
+      { "Op",  "Category" },
+      { "Old", szOld      },
+      { "New", szNew      }
+    });
   }
 
   else
@@ -1586,19 +1815,11 @@ SaveGameCover (app_record_s* pApp, std::wstring_view path)
   data->store         = (int)pApp->store;
 
   HANDLE hWorkerThread = (HANDLE)
-  _beginthreadex (nullptr, 0x0, [](void* var) -> unsigned
+  SKIF_Util_QueueTask (SKIF_TaskPriority::Interactive, SKIF_TaskGroup_None, [data](const SKIF_TaskToken&)
   {
-    SKIF_Util_SetThreadDescription (GetCurrentThread (), L"SKIF_UpdateCoverWorker");
-
-    // Is this combo really appropriate for this thread?
-    SKIF_Util_SetThreadPowerThrottling (GetCurrentThread (), 1); // Enable EcoQoS for this thread
-    SetThreadPriority (GetCurrentThread (), THREAD_MODE_BACKGROUND_BEGIN);
+    PLOG_DEBUG << "SKIF_UpdateCoverWorker task started!";
 
-    PLOG_DEBUG << "SKIF_UpdateCoverWorker thread started!";
-
-    thread_s* _data = static_cast<thread_s*>(var);
-
-    CoInitializeEx (nullptr, 0x0);
+    thread_s* _data = data;
 
     PLOG_INFO  << "Updating game cover asynchronously...";
 
@@ -1706,6 +1927,10 @@ SaveGameCover (app_record_s* pApp, std::wstring_view path)
     // Delete the temporary file after we are done with it
     DeleteFile(tmpPath.c_str());
 
+    // Whichever cover ended up in place is picked up right away by the reload below
+    SKIF_AssetIndex::GetInstance ( ).update (_data->destination + L".jpg");
+    SKIF_AssetIndex::GetInstance ( ).update (_data->destination + L".png");
+
     PLOG_ERROR_IF(! success) << "Failed to process the new cover image!";
       
     PostMessage (SKIF_Notify_hWnd, WM_SKIF_REFRESHCOVER, _data->appid, _data->store); // Force a refresh when the cover has been swapped in
@@ -1715,18 +1940,14 @@ SaveGameCover (app_record_s* pApp, std::wstring_view path)
     // Free up the memory we allocated
     delete _data;
 
-    PLOG_DEBUG << "SKIF_UpdateCoverWorker thread stopped!";
-
-    SetThreadPriority (GetCurrentThread (), THREAD_MODE_BACKGROUND_END);
-
-    return 0;
-  }, data, 0x0, nullptr);
+    PLOG_DEBUG << "SKIF_UpdateCoverWorker task stopped!";
+  });
 
   bool threadCreated = (hWorkerThread != NULL);
 
   if (threadCreated) // We don't care about how it goes so the handle is unneeded
     CloseHandle (hWorkerThread);
-  else // Someting went wrong during thread creation, so free up the memory we allocated earlier
+  else // Someting went wrong while queuing the task, so free up the memory we allocated earlier
     delete data;
 
   return threadCreated;
@@ -2049,11 +2270,11 @@ DrawGameContextMenu (app_record_s* pApp)
   // Instant Play options
   if (SteamShortcutPossible || pApp->store != app_record_s::Store::Steam)
   {
-    if (pApp->ui.numSecondaryLaunchConfigs > 0 || (pApp->store == app_record_s::Store::Steam || pApp->store == app_record_s::Store::GOG || pApp->store == app_record_s::Store::Xbox))
+    if (pApp->details->ui.numSecondaryLaunchConfigs > 0 || (pApp->store == app_record_s::Store::Steam || pApp->store == app_record_s::Store::GOG || pApp->store == app_record_s::Store::Xbox))
       ImGui::Separator ( );
 
     // If there is only one valid launch config (Steam, GOG, Xbox games only)
-    if (pApp->ui.numSecondaryLaunchConfigs == 0   &&
+    if (pApp->details->ui.numSecondaryLaunchConfigs == 0   &&
        (pApp->store == app_record_s::Store::Steam ||
         pApp->store == app_record_s::Store::GOG   ||
         pApp->store == app_record_s::Store::Xbox))
@@ -2113,7 +2334,7 @@ DrawGameContextMenu (app_record_s* pApp)
     }
 
     // Multiple launch configs
-    else if (pApp->ui.numSecondaryLaunchConfigs > 0)
+    else if (pApp->details->ui.numSecondaryLaunchConfigs > 0)
     {
       if (playDisabled)
         ImGui::PushStyleColor (ImGuiCol_Text, ImGui::GetStyleColorVec4 (ImGuiCol_TextDisabled));
@@ -2436,14 +2657,14 @@ DrawGameContextMenu (app_record_s* pApp)
     SKIF_ImGui_SetMouseCursorHand ();
     SKIF_ImGui_SetHoverText       (SK_WideCharToUTF8 (pApp->specialk.injection.config.root_dir.c_str()).c_str());
 
-    if (pApp->ui.screenshotsFolderExists)
+    if (pApp->details->ui.screenshotsFolderExists)
     {
       // Screenshot Folder
       if (SKIF_ImGui_MenuItemEx2 ("Screenshots", ICON_FA_IMAGES, ImColor(200, 200, 200, 255)))
-        SKIF_Util_ExplorePath       (pApp->ui.wsScreenshotDir);
+        SKIF_Util_ExplorePath       (pApp->details->ui.wsScreenshotDir);
 
       SKIF_ImGui_SetMouseCursorHand ();
-      SKIF_ImGui_SetHoverText       (SK_WideCharToUTF8 (pApp->ui.wsScreenshotDir.data()).c_str());
+      SKIF_ImGui_SetHoverText       (SK_WideCharToUTF8 (pApp->details->ui.wsScreenshotDir.data()).c_str());
     }
 
     ImGui::Separator    ( );
@@ -2480,13 +2701,13 @@ DrawGameContextMenu (app_record_s* pApp)
 
     // --------------------------------------------
 
-    if (! pApp->ui.cloud_paths.empty())
+    if (! pApp->details->ui.cloud_paths.empty())
     {
       ImGui::Separator  ( );
 
       if (SKIF_ImGui_BeginMenuEx2 ("Save/config folders", ICON_FA_FLOPPY_DISK, ImColor(200, 200, 200, 255)))
       {
-        for (auto& folder : pApp->ui.cloud_paths)
+        for (auto& folder : pApp->details->ui.cloud_paths)
         {
           ImGui::PushStyleColor ( ImGuiCol_Text,
             ImGui::GetStyleColorVec4(ImGuiCol_SKIF_TextBase) // * ImVec4(1.0f, 1.0f, 1.0f, 1.0f) //(ImVec4)ImColor::HSV (0.0f, 0.0f, 0.75f)
@@ -2872,10 +3093,10 @@ DrawGameContextMenu (app_record_s* pApp)
     }
 
     if (SKIF_ImGui_MenuItemEx2 ("PCGamingWiki", ICON_FA_SCREWDRIVER_WRENCH, ImColor(200, 200, 200, 255)))
-      SKIF_Util_OpenURI (SK_UTF8ToWideChar(pApp->ui.pcgw).c_str());
+      SKIF_Util_OpenURI (SK_UTF8ToWideChar(pApp->details->ui.pcgw).c_str());
 
     SKIF_ImGui_SetMouseCursorHand ( );
-    SKIF_ImGui_SetHoverText       (pApp->ui.pcgw);
+    SKIF_ImGui_SetHoverText       (pApp->details->ui.pcgw);
 
     ImGui::EndMenu ( );
   }
@@ -3000,45 +3221,45 @@ DrawGameContextMenu (app_record_s* pApp)
 
           // ---
 
-          if (pApp->steam.urls.AppDetails.empty())
+          if (pApp->details->urls.AppDetails.empty())
           {
-            pApp->steam.urls.AppDetails      = SKIF_SteamWebAPI_AppDetails (pApp->id);
-            pApp->steam.urls.AppDetails_utf8 = SK_WideCharToUTF8 (pApp->steam.urls.AppDetails);
+            pApp->details->urls.AppDetails      = SKIF_SteamWebAPI_AppDetails (pApp->id);
+            pApp->details->urls.AppDetails_utf8 = SK_WideCharToUTF8 (pApp->details->urls.AppDetails);
           }
 
           if (SKIF_ImGui_MenuItemEx2 ("/AppDetails/", (const char*)u8"\u2022", ImColor(101, 192, 244, 255)))
-            SKIF_Util_OpenURI (pApp->steam.urls.AppDetails.c_str());
+            SKIF_Util_OpenURI (pApp->details->urls.AppDetails.c_str());
 
           SKIF_ImGui_SetMouseCursorHand ( );
-          SKIF_ImGui_SetHoverText       (pApp->steam.urls.AppDetails_utf8.c_str());
+          SKIF_ImGui_SetHoverText       (pApp->details->urls.AppDetails_utf8.c_str());
 
           // ---
 
-          if (pApp->steam.urls.ISteamUserStats_GetNumberOfCurrentPlayers1.empty())
+          if (pApp->details->urls.ISteamUserStats_GetNumberOfCurrentPlayers1.empty())
           {
-            pApp->steam.urls.ISteamUserStats_GetNumberOfCurrentPlayers1 = SKIF_SteamWebAPI_ISteamUserStats_GetNumberOfCurrentPlayers1 (pApp->id);
-            pApp->steam.urls.ISteamUserStats_GetNumberOfCurrentPlayers1_utf8 = SK_WideCharToUTF8 (pApp->steam.urls.ISteamUserStats_GetNumberOfCurrentPlayers1);
+            pApp->details->urls.ISteamUserStats_GetNumberOfCurrentPlayers1 = SKIF_SteamWebAPI_ISteamUserStats_GetNumberOfCurrentPlayers1 (pApp->id);
+            pApp->details->urls.ISteamUserStats_GetNumberOfCurrentPlayers1_utf8 = SK_WideCharToUTF8 (pApp->details->urls.ISteamUserStats_GetNumberOfCurrentPlayers1);
           }
 
           if (SKIF_ImGui_MenuItemEx2 ("/ISteamUserStats/GetNumberOfCurrentPlayers/v1/", (const char*)u8"\u2022", ImColor(101, 192, 244, 255)))
-            SKIF_Util_OpenURI (pApp->steam.urls.ISteamUserStats_GetNumberOfCurrentPlayers1.c_str());
+            SKIF_Util_OpenURI (pApp->details->urls.ISteamUserStats_GetNumberOfCurrentPlayers1.c_str());
 
           SKIF_ImGui_SetMouseCursorHand ( );
-          SKIF_ImGui_SetHoverText       (pApp->steam.urls.ISteamUserStats_GetNumberOfCurrentPlayers1_utf8.c_str());
+          SKIF_ImGui_SetHoverText       (pApp->details->urls.ISteamUserStats_GetNumberOfCurrentPlayers1_utf8.c_str());
 
           // ---
 
-          if (pApp->steam.urls.IStoreBrowseService_GetItems1.empty())
+          if (pApp->details->urls.IStoreBrowseService_GetItems1.empty())
           {
-            pApp->steam.urls.IStoreBrowseService_GetItems1      = SKIF_SteamWebAPI_IStoreBrowseService_GetItems1 (pApp->id, "US");
-            pApp->steam.urls.IStoreBrowseService_GetItems1_utf8 = SK_WideCharToUTF8 (pApp->steam.urls.IStoreBrowseService_GetItems1);
+            pApp->details->urls.IStoreBrowseService_GetItems1      = SKIF_SteamWebAPI_IStoreBrowseService_GetItems1 (pApp->id, "US");
+            pApp->details->urls.IStoreBrowseService_GetItems1_utf8 = SK_WideCharToUTF8 (pApp->details->urls.IStoreBrowseService_GetItems1);
           }
 
           if (SKIF_ImGui_MenuItemEx2 ("/IStoreBrowseService/GetItems/v1/", (const char*)u8"\u2022", ImColor(101, 192, 244, 255)))
-            SKIF_Util_OpenURI (pApp->steam.urls.IStoreBrowseService_GetItems1.c_str());
+            SKIF_Util_OpenURI (pApp->details->urls.IStoreBrowseService_GetItems1.c_str());
 
           SKIF_ImGui_SetMouseCursorHand ( );
-          SKIF_ImGui_SetHoverText       (pApp->steam.urls.IStoreBrowseService_GetItems1_utf8.c_str());
+          SKIF_ImGui_SetHoverText       (pApp->details->urls.IStoreBrowseService_GetItems1_utf8.c_str());
 
           // ---
 
@@ -3049,12 +3270,12 @@ DrawGameContextMenu (app_record_s* pApp)
 
       ImGui::Separator ( );
 
-      if (! pApp->branches.empty ())
+      if (! pApp->details->branches.empty ())
       {
-        if (SKIF_ImGui_BeginMenuEx2 (SKIF_Util_FormatStringRaw ("Branches (%i)", pApp->ui.branches.size()), ICON_FA_CODE_BRANCH, ImColor(255, 207, 72)))
+        if (SKIF_ImGui_BeginMenuEx2 (SKIF_Util_FormatStringRaw ("Branches (%i)", pApp->details->ui.branches.size()), ICON_FA_CODE_BRANCH, ImColor(255, 207, 72)))
         {
 
-          for ( auto& it : pApp->ui.branches)
+          for ( auto& it : pApp->details->ui.branches)
           {
             auto& branch_name = it.second.first;
             auto& branch      = it.second.second;
@@ -3230,7 +3451,7 @@ DrawGameContextMenu (app_record_s* pApp)
       
       if (pApp->store == app_record_s::Store::Xbox)
       {
-        if (pApp->ui.numSecondaryLaunchConfigs == 0)
+        if (pApp->details->ui.numSecondaryLaunchConfigs == 0)
         {
           if (SKIF_ImGui_MenuItemEx2 ("Open Terminal###GameContextMenu_TerminalMenu", ICON_FA_TERMINAL))
           {
@@ -3248,7 +3469,7 @@ DrawGameContextMenu (app_record_s* pApp)
           SKIF_ImGui_SetMouseCursorHand ( );
         }
 
-        else if (pApp->ui.numSecondaryLaunchConfigs > 0)
+        else if (pApp->details->ui.numSecondaryLaunchConfigs > 0)
         {
           if (SKIF_ImGui_BeginMenuEx2 ("Open Terminal###GameContextMenu_TerminalMenu", ICON_FA_TERMINAL))
           {
@@ -3316,11 +3537,7 @@ DrawGameContextMenu (app_record_s* pApp)
         }
       }
 
-      SKIF_ImGui_SetHoverText (
-        (pApp->store == app_record_s::Store::Epic) ? pApp->epic.name_app     :
-        (pApp->store == app_record_s::Store::Xbox) ? pApp->xbox.package_name :
-                                     std::to_string (pApp->id)
-      );
+      SKIF_ImGui_SetHoverText (SKIF_AppKey_GetKey (*pApp));
 
       ImGui::EndMenu ();
     }
@@ -3406,10 +3623,10 @@ DrawSpecialKContextMenu (app_record_s* pApp)
   );
 
   if (SKIF_ImGui_MenuItemEx2 ("PCGamingWiki", ICON_FA_SCREWDRIVER_WRENCH, ImColor(200, 200, 200, 255)))
-    SKIF_Util_OpenURI (SK_UTF8ToWideChar(pApp->ui.pcgw).c_str());
+    SKIF_Util_OpenURI (SK_UTF8ToWideChar(pApp->details->ui.pcgw).c_str());
 
   SKIF_ImGui_SetMouseCursorHand ( );
-  SKIF_ImGui_SetHoverText       (pApp->ui.pcgw);
+  SKIF_ImGui_SetHoverText       (pApp->details->ui.pcgw);
 
   if (SKIF_STEAM_OWNER)
   {
@@ -3568,7 +3785,7 @@ GetInjectionSummary (app_record_s* pApp)
     bool openLocalMenu = false;
 
     ImGui::PushStyleColor(ImGuiCol_TextDisabled, ImGui::GetStyleColorVec4(ImGuiCol_SKIF_TextCaption));
-    if (ImGui::Selectable (pApp->ui.label_version.c_str(), false, flags))
+    if (ImGui::Selectable (pApp->details->ui.label_version.c_str(), false, flags))
       openLocalMenu = true;
     ImGui::PopStyleColor();
 
@@ -4043,7 +4260,7 @@ GetInjectionSummary (app_record_s* pApp)
     GameMenu = PopupState_Open;
   }
 
-  if (pApp->extended_config.vac.enabled == 1)
+  if (pApp->details->extended_config.vac.enabled == 1)
   {
     ImGui::SameLine ( );
     // Vertical center-align
@@ -4600,6 +4817,8 @@ UpdateInjectionStrategy (app_record_s* pApp, std::set <std::string> apptickets)
     {
       pApp->launch_configs [0]               = pApp->launch_configs[firstValidFound];
       pApp->launch_configs [firstValidFound] = copy;
+
+      SKIF_GamingCollection::AppsGeneration++;
     }
   }
 
@@ -4611,6 +4830,8 @@ UpdateInjectionStrategy (app_record_s* pApp, std::set <std::string> apptickets)
   {
     PLOG_ERROR << "Could not detect any launch configs?! Defaulting to an empty one.";
     pApp->launch_configs.emplace (0, app_record_s::launch_config_s());
+
+    SKIF_GamingCollection::AppsGeneration++;
   }
 
   // This is safe because we inserted one above
@@ -4782,25 +5003,25 @@ UpdateInjectionStrategy (app_record_s* pApp, std::set <std::string> apptickets)
   switch (pApp->specialk.injection.injection.type)
   {
     case InjectionType::Local:
-      pApp->ui.label_version = SKIF_Util_FormatStringRaw (R"(v %s (%s))", pApp->specialk.injection.dll.version_utf8.c_str(), pApp->specialk.injection.dll.shorthand_utf8.c_str()); // injection.type_utf8.c_str()
+      pApp->details->ui.label_version = SKIF_Util_FormatStringRaw (R"(v %s (%s))", pApp->specialk.injection.dll.version_utf8.c_str(), pApp->specialk.injection.dll.shorthand_utf8.c_str()); // injection.type_utf8.c_str()
       break;
 
     case InjectionType::Global:
     default: // Unknown injection strategy, but let's assume global would work
       if ( _inject.bHasServlet )
-        pApp->ui.label_version = SKIF_Util_FormatStringRaw (R"(v %s)", pApp->specialk.injection.dll.version_utf8.c_str()); // injection.type_utf8.c_str() // We don't actually have SKIF say "Global v XXX" any longer due to space constraints -- Aemony, 2024-01-04
+        pApp->details->ui.label_version = SKIF_Util_FormatStringRaw (R"(v %s)", pApp->specialk.injection.dll.version_utf8.c_str()); // injection.type_utf8.c_str() // We don't actually have SKIF say "Global v XXX" any longer due to space constraints -- Aemony, 2024-01-04
       break;
   }
 
   // Refresh the context menu cached data
   
   // Profile + Screenshots
-  //pApp->ui.profileFolderExists     = PathFileExists (pApp->specialk.injection.config.root_dir.c_str());
-  pApp->ui.wsScreenshotDir         = pApp->specialk.injection.config.root_dir + LR"(\Screenshots)";
-  pApp->ui.screenshotsFolderExists = PathFileExists (pApp->ui.wsScreenshotDir.c_str()); // (pApp->ui.profileFolderExists) ? 
+  //pApp->details->ui.profileFolderExists     = PathFileExists (pApp->specialk.injection.config.root_dir.c_str());
+  pApp->details->ui.wsScreenshotDir         = pApp->specialk.injection.config.root_dir + LR"(\Screenshots)";
+  pApp->details->ui.screenshotsFolderExists = PathFileExists (pApp->details->ui.wsScreenshotDir.c_str()); // (pApp->details->ui.profileFolderExists) ? 
 
   // Check how many secondary launch configs are valid
-  pApp->ui.numSecondaryLaunchConfigs = 0;
+  pApp->details->ui.numSecondaryLaunchConfigs = 0;
   for (auto& _launch_cfg : pApp->launch_configs)
   {
     if (_launch_cfg.second.owns_dlc == -1)
@@ -4819,17 +5040,17 @@ UpdateInjectionStrategy (app_record_s* pApp, std::set <std::string> apptickets)
           _launch_cfg.second.duplicate_exe_args)
       continue;
     
-    pApp->ui.numSecondaryLaunchConfigs++;
+    pApp->details->ui.numSecondaryLaunchConfigs++;
   }
 
   // Steam Auto-Cloud
-  pApp->ui.cloud_paths.clear();
+  pApp->details->ui.cloud_paths.clear();
   if (pApp->cloud_enabled && // If this is false, Steam Auto-Cloud is not enabled
-    ! pApp->cloud_saves.empty ())
+    ! pApp->details->cloud_saves.empty ())
   {
     std::set <std::wstring> _used_paths;
 
-    for (auto& cloud : pApp->cloud_saves)
+    for (auto& cloud : pApp->details->cloud_saves)
     {
       if (cloud.second.valid == 0)
         continue;
@@ -4845,30 +5066,30 @@ UpdateInjectionStrategy (app_record_s* pApp, std::set <std::string> apptickets)
       {
         // Filter out duplicate paths
         if (_used_paths.emplace (cloud.second.evaluated_dir).second)
-          pApp->ui.cloud_paths.emplace_back (app_record_s::CloudPath (cloud.first, cloud.second.evaluated_dir));
+          pApp->details->ui.cloud_paths.emplace_back (app_record_s::CloudPath (cloud.first, cloud.second.evaluated_dir));
       }
     }
   }
 
   // PCGamingWiki
-  pApp->ui.pcgw  = ((pApp->store == app_record_s::Store::GOG)   ? "https://www.pcgamingwiki.com/api/gog.php?page="
+  pApp->details->ui.pcgw  = ((pApp->store == app_record_s::Store::GOG)   ? "https://www.pcgamingwiki.com/api/gog.php?page="
                  :  (pApp->store == app_record_s::Store::Steam) ? "https://www.pcgamingwiki.com/api/appid.php?appid="
                                                                 : "https://www.pcgamingwiki.com/w/index.php?search=")
                  + ((pApp->store == app_record_s::Store::Steam  || pApp->store == app_record_s::Store::GOG)
                  ? std::to_string(pApp->id) : pApp->names.clean);
 
   // SteamGridDB
-  pApp->ui.sgdbGrids = (pApp->store == app_record_s::Store::Steam)
+  pApp->details->ui.sgdbGrids = (pApp->store == app_record_s::Store::Steam)
                      ? SKIF_Util_FormatStringRaw ("https://www.steamgriddb.com/steam/%lu/grids",      pApp->id)
                      : SKIF_Util_FormatStringRaw ("https://www.steamgriddb.com/search/grids?term=%s", pApp->names.clean.c_str());
-  pApp->ui.sgdbIcons = (pApp->store == app_record_s::Store::Steam)
+  pApp->details->ui.sgdbIcons = (pApp->store == app_record_s::Store::Steam)
                      ? SKIF_Util_FormatStringRaw ("https://www.steamgriddb.com/steam/%lu/icons",      pApp->id)
                      : SKIF_Util_FormatStringRaw ("https://www.steamgriddb.com/search/icons?term=%s", pApp->names.clean.c_str());
 
   // Steam Branches
-  pApp->ui.branches.clear ();
+  pApp->details->ui.branches.clear ();
   std::set <std::string> used_branches;
-  for ( auto& it : pApp->branches )
+  for ( auto& it : pApp->details->branches )
   {
     if (used_branches.emplace (it.first).second)
     {
@@ -4878,7 +5099,7 @@ UpdateInjectionStrategy (app_record_s* pApp, std::set <std::string> apptickets)
       // TODO: Maybe split sort in public v. private?
       
       // Sort in descending order
-      pApp->ui.branches.emplace (
+      pApp->details->ui.branches.emplace (
         std::make_pair   (-(int64_t)branch.build_id,
           std::make_pair (
             it.first,
@@ -4892,6 +5113,111 @@ UpdateInjectionStrategy (app_record_s* pApp, std::set <std::string> apptickets)
 
 #pragma endregion
 
+#pragma region PatchLibrary
+
+// Outcome of applying a freshly built library to g_apps
+struct library_patch_s {
+  size_t added     = 0;
+  size_t removed   = 0;
+  size_t changed   = 0;
+  size_t unchanged = 0;
+  bool   reordered = false;
+};
+
+// Applies a freshly built library to g_apps, only touching the apps that were added, removed or changed
+//   -> Apps are matched the same way the library worker deduplicates them (SKIF_AppKeyTable),
+//        and compared by the fingerprint the library worker gave them
+//   -> Unchanged apps are kept as they are, along with their icons and anything loaded for them since;
+//        changed apps are replaced but keep their icon, and the icons of removed apps are released
+//   -> The list follows the order of the fresh one, which the library worker has already sorted
+static library_patch_s
+PatchLibrary (std::vector <std::pair <std::string, app_record_s>>& fresh)
+{
+  std::scoped_lock app_lock (g_apps_mutex);
+
+  library_patch_s patch;
+
+  // The table holds copies of the keys, so it is unaffected by apps being moved out of g_apps
+  SKIF_AppKeyTable   current;
+  std::vector <bool> matched (g_apps.size ( ), false);
+
+  current.reserve (g_apps.size ( ));
+
+  for (size_t i = 0; i < g_apps.size ( ); i++)
+  {
+    if (g_apps [i].second.id != 0)
+      current.insert (g_apps [i].second, i);
+  }
+
+  std::vector <std::pair <std::string, app_record_s>> apps;
+  apps.reserve (fresh.size ( ));
+
+  size_t last = 0;
+
+  for (auto& app : fresh)
+  {
+    // Filtered out while processing
+    if (app.second.id == 0)
+      continue;
+
+    size_t existing = current.find (app.second);
+
+    if (existing == SKIF_AppKeyTable::npos || matched [existing])
+    {
+      patch.added++;
+      apps.emplace_back (std::move (app));
+      continue;
+    }
+
+    auto& previous = g_apps [existing];
+
+    if (existing < last)
+      patch.reordered = true;
+
+    last = existing;
+    matched [existing] = true;
+
+    if (previous.second.library_hash == app.second.library_hash)
+    {
+      patch.unchanged++;
+      apps.emplace_back (std::move (previous));
+    }
+
+    else
+    {
+      patch.changed++;
+      app.second.tex_icon         = previous.second.tex_icon;
+      app.second.tex_icon.iWorker = 2;
+      apps.emplace_back (std::move (app));
+    }
+  }
+
+  // Whatever is left has been removed
+  for (size_t i = 0; i < g_apps.size ( ); i++)
+  {
+    if (matched [i] || g_apps [i].second.id == 0)
+      continue;
+
+    auto& icon = g_apps [i].second.tex_icon;
+
+    if (icon.texture.p != nullptr)
+    {
+      SKIF_ResourcesToFree.push (icon.texture.p);
+      icon.texture.p = nullptr;
+    }
+
+    patch.removed++;
+  }
+
+  g_apps.swap (apps);
+
+  SKIF_GamingCollection::AppsGeneration++;
+
+  return patch;
+}
+
+#pragma endregion
+
 
 
 void
@@ -4902,7 +5228,7 @@ SKIF_UI_Tab_DrawLibrary (void)
   static SKIF_InjectionContext& _inject     = SKIF_InjectionContext::GetInstance ( );
   static SKIF_GamingCollection& _games      = SKIF_GamingCollection::GetInstance  ( );
   
-  static SKIF_DirectoryWatch     SKIF_Epic_ManifestWatch;
+  static SKIF_DirectoryChangeWatch SKIF_Epic_ManifestWatch;
 
   static image_s cover, cover_old, coverSK;
 
@@ -4960,6 +5286,8 @@ SKIF_UI_Tab_DrawLibrary (void)
       SKIF ( "Special K", SKIF_record );
 
     g_apps.emplace_back (SKIF);
+
+    SKIF_GamingCollection::AppsGeneration++;
   }
 #endif
 
@@ -5016,9 +5344,22 @@ SKIF_UI_Tab_DrawLibrary (void)
       time_current = SKIF_Util_timeGetTime1 ( );
     }
 
-    // Sets up a wait object on UITab_Library
-    if (SKIF_Epic_ManifestWatch.isSignaled (SKIF_Epic_AppDataPath) && _registry.bLibraryEpic)
-      RepopulateGames = true;
+    // Does not set up a wait object
+    //   Only the .item manifests are of interest, not the temporary files the launcher writes alongside them
+    if (SKIF_Epic_ManifestWatch.isSignaled (SKIF_Epic_AppDataPath))
+    {
+      bool overflowed = false;
+      auto changes    = SKIF_Epic_ManifestWatch.getChanges (&overflowed);
+
+      bool manifests  = overflowed ||
+        std::any_of (changes.begin(), changes.end(), [](const SKIF_DirectoryChange& change) {
+          return PathMatchSpecW (change.path.c_str(),     L"*.item") ||
+                 PathMatchSpecW (change.old_path.c_str(), L"*.item");
+        });
+
+      if (manifests && _registry.bLibraryEpic)
+        RepopulateGames = true;
+    }
 
     if (runOnce)
     {
@@ -5068,6 +5409,9 @@ SKIF_UI_Tab_DrawLibrary (void)
   else if (RepopulateGames)
   {
     PLOG_VERBOSE << "RepopulateGames " << activeIconWorkers;
+
+    // Icons that have yet to be loaded are of no use for the records about to be replaced
+    SKIF_TaskScheduler::GetInstance ( ).cancel (SKIF_TaskGroup_GameIcons);
   }
 
 
@@ -5078,14 +5422,20 @@ SKIF_UI_Tab_DrawLibrary (void)
     std::set    < std::string >
                   apptickets = { };
     SteamId3_t    steam_user = 0;
-    Trie          labels     = { };
     HANDLE        hWorker    = NULL;
     int           iWorker    = 0;
+    uint64_t      snapshot_context = 0;     // Settings the library snapshot has to match
+    bool          use_snapshot     = false; // Try the library snapshot before building the library
+    bool          from_snapshot    = false; // The data came from the library snapshot
   };
 
   static lib_worker_thread_s* library_worker = nullptr;
 
-  if (! PopulatedGames && library_worker == nullptr)
+  // The library snapshot is only tried on the first population; when used, the library is rebuilt right after
+  static bool snapshotTried     = false;
+  static bool revalidateLibrary = false;
+
+  if ((! PopulatedGames || revalidateLibrary) && library_worker == nullptr)
   {
     PLOG_INFO << "Populating library list...";
 
@@ -5094,6 +5444,16 @@ SKIF_UI_Tab_DrawLibrary (void)
 
     library_worker = new lib_worker_thread_s;
     library_worker->steam_user = SKIF_Steam_GetCurrentUser ( );
+    library_worker->use_snapshot = ! std::exchange (snapshotTried, true);
+    library_worker->snapshot_context =
+      (static_cast <uint64_t> (library_worker->steam_user) << 32) |
+      (static_cast <uint64_t> (_registry.bLibrarySteam)    <<  0) |
+      (static_cast <uint64_t> (_registry.bLibraryGOG)      <<  1) |
+      (static_cast <uint64_t> (_registry.bLibraryEpic)     <<  2) |
+      (static_cast <uint64_t> (_registry.bLibraryXbox)     <<  3) |
+      (static_cast <uint64_t> (_registry.bLibraryCustom)   <<  4) |
+      (static_cast <uint64_t> (_registry._LibraryHidden)   <<  5) |
+      (static_cast <uint64_t> (SKIF_STEAM_OWNER)           <<  6);
 
     HANDLE hWorkerThread = (HANDLE)
     _beginthreadex (nullptr, 0x0, [](void* var) -> unsigned
@@ -5106,120 +5466,151 @@ SKIF_UI_Tab_DrawLibrary (void)
 
       PLOG_DEBUG << "SKIF_LibraryWorker thread started!";
 
-      std::scoped_lock app_lock (g_apps_mutex);
-      
+      // Index the Assets folder before the first cover or icon gets loaded
+      SKIF_AssetIndex::GetInstance ( ).refresh ( );
+
       DWORD pre   = 0,
             post  = 0,
             start = SKIF_Util_timeGetTime1 ( );
 
       lib_worker_thread_s* _data = static_cast<lib_worker_thread_s*>(var);
 
-      size_t games = _data->apps.size();
-
-      // Load Steam titles from disk
-      if (_registry.bLibrarySteam || _registry._LibraryHidden)
+      // Show the library of the last run if none of its sources have changed since;
+      //   the library is then rebuilt in the background by another run of this worker
+      if (_data->use_snapshot && SKIF_LibrarySnapshot_Load (_data->snapshot_context, _data->apps, _data->apptickets))
       {
-        pre  = start;
+        _data->from_snapshot = true;
 
-        SKIF_Steam_GetInstalledAppIDs (&_data->apps);
+        for (auto& app : _data->apps)
+          app.second.library_hash = SKIF_LibrarySnapshot_Fingerprint (app);
 
-        if (! _registry._LibraryHidden)
-        {
-          post = SKIF_Util_timeGetTime1 ( );
-          PLOG_INFO << "[Library Processing] Processed " << (_data->apps.size() - games) << " Steam games in " << (post - pre) << " ms.";
-          pre  = post;
-          games = _data->apps.size();
-        }
+        PLOG_INFO << "[Library Processing] Loaded " << _data->apps.size() << " apps from the library snapshot in " << (SKIF_Util_timeGetTime1 ( ) - start) << " ms.";
 
-        // Preload user-specific stuff for all Steam games (custom launch options + DLC ownership)
-        SKIF_Steam_PreloadUserConfig (_data->steam_user, &_data->apps, &_data->apptickets);
+        PLOG_DEBUG << "SKIF_LibraryWorker thread stopped!";
 
-        if (! _registry._LibraryHidden)
-        {
-          post = SKIF_Util_timeGetTime1 ( );
-          PLOG_INFO << "[Library Processing] Processed Steam user configs in " << (post - pre) << " ms.";
-          pre  = post;
-        }
+        return 0;
       }
 
-      if ( ! SKIF_STEAM_OWNER )
+      using app_list_t =
+        std::vector <std::pair <std::string, app_record_s>>;
+
+      // Each store is discovered by its own task into a private list, as they are all I/O or registry bound
+      struct store_task_s {
+        const wchar_t*      name;
+        const char*         label;   // Used in the log
+        bool                enabled;
+        void              (*discover)(app_list_t*);
+        app_list_t          apps;
+        DWORD               dwTime = 0; // ms
+        std::future <void>  task;
+      };
+
+      store_task_s stores [] = {
+        { L"Steam",  "Steam games",        _registry.bLibrarySteam  || _registry._LibraryHidden, SKIF_Steam_GetInstalledAppIDs },
+        { L"GOG",    "GOG games",          _registry.bLibraryGOG    || _registry._LibraryHidden, SKIF_GOG_GetInstalledAppIDs   },
+        { L"Epic",   "Epic games",         _registry.bLibraryEpic   || _registry._LibraryHidden, SKIF_Epic_GetInstalledAppIDs  },
+        { L"Xbox",   "Xbox games",         _registry.bLibraryXbox   || _registry._LibraryHidden, SKIF_Xbox_GetInstalledAppIDs  },
+        { L"Custom", "custom SKIF titles", _registry.bLibraryCustom || _registry._LibraryHidden, SKIF_GetCustomAppIDs          }
+      };
+
+      // User-specific stuff for all Steam games (custom launch options + DLC ownership) is preloaded as part of the Steam task
+      DWORD dwSteamUserConfigTime = 0;
+
+      for (auto& store : stores)
       {
-        app_record_s SKIF_record (SKIF_STEAM_APPID);
+        if (! store.enabled)
+          continue;
 
-        SKIF_record.id                = SKIF_STEAM_APPID;
-        SKIF_record.names.normal      = "Special K";
-        SKIF_record.names.all_upper   = "SPECIAL K";
-        SKIF_record._status.installed = true;
-        SKIF_record.install_dir       = _path_cache.specialk_install;
-        SKIF_record.store             = app_record_s::Store::Steam;
-        SKIF_record.store_utf8        = "Steam";
-        SKIF_record.ImGuiLabelID      = SKIF_Util_FormatStringRaw ("##%i-%i-selectable", (int)SKIF_record.store, SKIF_record.id);
-        SKIF_record.ImGuiPushID       = SKIF_Util_FormatStringRaw ("##%i-%i",            (int)SKIF_record.store, SKIF_record.id);
+        store.task =
+          std::async (std::launch::async, [&store, &dwSteamUserConfigTime, _data](void)
+          {
+            SKIF_Util_SetThreadDescription (GetCurrentThread (), SK_FormatStringW (L"SKIF_LibraryWorker_%ws", store.name).c_str());
 
-        SKIF_record.specialk.profile_dir      = SK_FormatStringW(LR"(%ws\Profiles)", _path_cache.specialk_userdata);
-        SKIF_record.specialk.profile_dir_utf8 = SK_WideCharToUTF8 (SKIF_record.specialk.profile_dir);
+            DWORD dwStart = SKIF_Util_timeGetTime1 ( );
 
-        std::pair <std::string, app_record_s>
-          SKIF ( "Special K", SKIF_record );
+            store.discover (&store.apps);
 
-        _data->apps.emplace_back (SKIF);
-        games = _data->apps.size();
-      }
+            store.dwTime  = SKIF_Util_timeGetTime1 ( ) - dwStart;
 
-      // Load GOG titles from registry
-      if (_registry.bLibraryGOG || _registry._LibraryHidden)
-      {
-        SKIF_GOG_GetInstalledAppIDs  (&_data->apps);
+            if (store.discover == SKIF_Steam_GetInstalledAppIDs)
+            {
+              dwStart = SKIF_Util_timeGetTime1 ( );
 
-        if (! _registry._LibraryHidden)
-        {
-          post = SKIF_Util_timeGetTime1 ( );
-          PLOG_INFO << "[Library Processing] Processed " << (_data->apps.size() - games) << " GOG games in " << (post - pre) << " ms.";
-          pre  = post;
-          games = _data->apps.size();
-        }
+              SKIF_Steam_PreloadUserConfig (_data->steam_user, &store.apps, &_data->apptickets);
+
+              dwSteamUserConfigTime = SKIF_Util_timeGetTime1 ( ) - dwStart;
+            }
+          });
       }
 
-      // Load Epic titles from disk
-      if (_registry.bLibraryEpic || _registry._LibraryHidden)
+      for (auto& store : stores)
       {
-        SKIF_Epic_GetInstalledAppIDs (&_data->apps);
-
-        if (! _registry._LibraryHidden)
-        {
-          post = SKIF_Util_timeGetTime1 ( );
-          PLOG_INFO << "[Library Processing] Processed " << (_data->apps.size() - games) << " Epic games in " << (post - pre) << " ms.";
-          pre  = post;
-          games = _data->apps.size();
-        }
+        // A store that failed is left out of this refresh, without taking the other stores down with it
+        if (store.task.valid () && ! SKIF_Util_JoinTask (store.task, std::string ("[Library Processing] Discovery of ") + store.label))
+          store.apps.clear ( );
       }
-    
-      if (_registry.bLibraryXbox || _registry._LibraryHidden)
-      {
-        SKIF_Xbox_GetInstalledAppIDs (&_data->apps);
 
-        if (! _registry._LibraryHidden)
-        {
-          post = SKIF_Util_timeGetTime1 ( );
-          PLOG_INFO << "[Library Processing] Processed " << (_data->apps.size() - games) << " Xbox games in " << (post - pre) << " ms.";
-          pre  = post;
-          games = _data->apps.size();
-        }
-      }
+      if (! _registry._LibraryHidden)
+        PLOG_INFO << "[Library Processing] Discovered all stores in " << (SKIF_Util_timeGetTime1 ( ) - start) << " ms.";
 
-      // Load custom SKIF titles from registry
-      if (_registry.bLibraryCustom || _registry._LibraryHidden)
+      // The lock is only held while the results are merged
       {
-        SKIF_GetCustomAppIDs (&_data->apps);
+        std::scoped_lock app_lock (g_apps_mutex);
+
+        // Guards against the same app being listed twice
+        SKIF_AppKeyTable unique_apps;
 
-        if (! _registry._LibraryHidden)
+        for (auto& store : stores)
         {
-          post = SKIF_Util_timeGetTime1 ( );
-          PLOG_INFO << "[Library Processing] Processed " << (_data->apps.size() - games) << " custom SKIF titles in " << (post - pre) << " ms.";
-          games = _data->apps.size();
+          if (store.enabled)
+          {
+            size_t merged = 0;
+
+            _data->apps.reserve (_data->apps.size () + store.apps.size ());
+
+            for (auto& app : store.apps)
+            {
+              if (unique_apps.insert (app.second, _data->apps.size ()))
+              {
+                _data->apps.emplace_back (std::move (app));
+                merged++;
+              }
+            }
+
+            if (! _registry._LibraryHidden)
+            {
+              PLOG_INFO << "[Library Processing] Processed " << merged << " " << store.label << " in " << store.dwTime << " ms.";
+
+              if (store.discover == SKIF_Steam_GetInstalledAppIDs)
+                PLOG_INFO << "[Library Processing] Processed Steam user configs in " << dwSteamUserConfigTime << " ms.";
+            }
+          }
+
+          // Special K comes right after the Steam games
+          if (store.discover == SKIF_Steam_GetInstalledAppIDs && ! SKIF_STEAM_OWNER)
+          {
+            app_record_s SKIF_record (SKIF_STEAM_APPID);
+
+            SKIF_record.id                = SKIF_STEAM_APPID;
+            SKIF_record.names.normal      = "Special K";
+            SKIF_record.names.all_upper   = "SPECIAL K";
+            SKIF_record._status.installed = true;
+            SKIF_record.install_dir       = _path_cache.specialk_install;
+            SKIF_record.store             = app_record_s::Store::Steam;
+            SKIF_record.store_utf8        = "Steam";
+            SKIF_record.ImGuiLabelID      = SKIF_Util_FormatStringRaw ("##%i-%i-selectable", (int)SKIF_record.store, SKIF_record.id);
+            SKIF_record.ImGuiPushID       = SKIF_Util_FormatStringRaw ("##%i-%i",            (int)SKIF_record.store, SKIF_record.id);
+
+            SKIF_record.specialk.profile_dir      = SK_FormatStringW(LR"(%ws\Profiles)", _path_cache.specialk_userdata);
+            SKIF_record.specialk.profile_dir_utf8 = SK_WideCharToUTF8 (SKIF_record.specialk.profile_dir);
+
+            _data->apps.emplace_back ("Special K", std::move (SKIF_record));
+          }
         }
       }
 
+      size_t games = _data->apps.size();
+
       PLOG_INFO << "Loading custom launch configs synchronously...";
 
       static const std::pair <bool, std::wstring> lc_files[] = {
@@ -5252,9 +5643,7 @@ SKIF_UI_Tab_DrawLibrary (void)
             auto& append_cfg = (record.store == app_record_s::Store::Steam) ? record.launch_configs_custom
                                                                             : record.launch_configs;
 
-            std::string key  = (record.store == app_record_s::Store::Epic)  ? record.epic.name_app     :
-                               (record.store == app_record_s::Store::Xbox)  ? record.xbox.package_name :
-                                                              std::to_string (record.id);
+            std::string key  = SKIF_AppKey_GetKey (record);
 
             for (auto& launch_config : jf[record.store_utf8][key])
             {
@@ -5281,28 +5670,37 @@ SKIF_UI_Tab_DrawLibrary (void)
         }
       }
 
-      PLOG_INFO << "Loading persistent metadata...";
+      // Once loaded, the metadata in memory is kept up to date by SKIF itself, so it is not read again on later refreshes
+      static bool metadataLoaded = false;
 
-      std::ifstream file(file_metadata);
-      if (file.is_open())
+      if (! std::exchange (metadataLoaded, true))
       {
-        std::scoped_lock jsonLock (jsonMetaDB_mutex);
-
-        jsonMetaDB = nlohmann::json::parse(file, nullptr, false);
-        file.close();
+        PLOG_INFO << "Loading persistent metadata...";
 
-        if (jsonMetaDB.is_discarded ( ))
+        std::ifstream file(file_metadata);
+        if (file.is_open())
         {
-          PLOG_ERROR << "Error occurred while trying to parse " << file_metadata;
-          MoveFileEx (file_metadata.c_str(), (file_metadata + L".bak").c_str(), MOVEFILE_REPLACE_EXISTING);
-          jsonMetaDB = nlohmann::json();
+          std::scoped_lock jsonLock (jsonMetaDB_mutex);
+
+          jsonMetaDB = nlohmann::json::parse(file, nullptr, false);
+          file.close();
+
+          if (jsonMetaDB.is_discarded ( ))
+          {
+            PLOG_ERROR << "Error occurred while trying to parse " << file_metadata;
+            MoveFileEx (file_metadata.c_str(), (file_metadata + L".bak").c_str(), MOVEFILE_REPLACE_EXISTING);
+            jsonMetaDB = nlohmann::json();
+          }
+          else {
+            PLOG_INFO << "Successfully read persistent metadata (" << JsonDB_CountElements ( ) << " items) from JSON file.";
+          }
         }
         else {
-          PLOG_INFO << "Successfully read persistent metadata (" << JsonDB_CountElements ( ) << " items) from JSON file.";
+          PLOG_ERROR << "Could not open JSON file for reading: " << file_metadata;
         }
-      }
-      else {
-        PLOG_ERROR << "Could not open JSON file for reading: " << file_metadata;
+
+        // Changes made since db.json was last written
+        JsonDB_ReplayJournal ( );
       }
 
       PLOG_INFO << "Processing detected games...";
@@ -5338,9 +5736,9 @@ SKIF_UI_Tab_DrawLibrary (void)
 
           // Default values that needs to be set
           app.second.skif.pinned  = 99; // Default to pinned
-          app.second.ui.pcgw      = SKIF_Util_FormatStringRaw ("https://www.pcgamingwiki.com/api/appid.php?appid=%lu", app.second.id);
-          app.second.ui.sgdbGrids = SKIF_Util_FormatStringRaw ("https://www.steamgriddb.com/steam/%lu/grids",          app.second.id);
-          app.second.ui.sgdbIcons = SKIF_Util_FormatStringRaw ("https://www.steamgriddb.com/steam/%lu/icons",          app.second.id);
+          app.second.details->ui.pcgw      = SKIF_Util_FormatStringRaw ("https://www.pcgamingwiki.com/api/appid.php?appid=%lu", app.second.id);
+          app.second.details->ui.sgdbGrids = SKIF_Util_FormatStringRaw ("https://www.steamgriddb.com/steam/%lu/grids",          app.second.id);
+          app.second.details->ui.sgdbIcons = SKIF_Util_FormatStringRaw ("https://www.steamgriddb.com/steam/%lu/icons",          app.second.id);
         }
 
         // Regular handling for the remaining Steam games
@@ -5366,9 +5764,7 @@ SKIF_UI_Tab_DrawLibrary (void)
           // Load any custom data
           if (! jsonMetaDB.is_discarded())
           {
-            std::string item = (app.second.store == app_record_s::Store::Epic)  ? app.second.epic.name_app     :
-                               (app.second.store == app_record_s::Store::Xbox)  ? app.second.xbox.package_name :
-                                                                  std::to_string (app.second.id);
+            std::string item = SKIF_AppKey_GetKey (app.second);
 
             try {
               auto& key = jsonMetaDB[app.second.store_utf8][item];
@@ -5587,7 +5983,7 @@ SKIF_UI_Tab_DrawLibrary (void)
         if (app.second._status.installed && ! isSpecialK)
         {
           // Prepare for the keyboard hint / search/filter functionality
-          InsertTrieKey (&app, &_data->labels);
+          PrepareSearchNames (&app);
 
           std::wstring wsName =
             SK_UTF8ToWideChar (app.second.names.original);
@@ -5683,10 +6079,35 @@ SKIF_UI_Tab_DrawLibrary (void)
       games = games - 1; // Do not count Special K as a game
       PLOG_INFO << "Finished processing " << games << " detected games in " << (post - pre) << " ms.";
 
+      // Decode the appinfo.vdf data of all Steam games up front, spread across all cores
+      if (appinfo != nullptr && (_registry.bLibrarySteam || _registry._LibraryHidden))
+      {
+        pre = post;
+
+        size_t decoded =
+          appinfo->getAppInfoParallel (&_data->apps);
+
+        post = SKIF_Util_timeGetTime1 ( );
+        PLOG_INFO << "[AppInfo Processing] Decoded " << decoded << " Steam games in " << (post - pre) << " ms.";
+      }
+
+      // Release the view of appinfo.vdf, as Steam cannot rewrite the file while it is mapped
+      if (appinfo != nullptr)
+        appinfo->close ( );
+
+      // Lets the library be patched with only the apps that have changed since the last refresh
+      for (auto& app : _data->apps)
+      {
+        if (app.second.id != 0)
+          app.second.library_hash = SKIF_LibrarySnapshot_Fingerprint (app);
+      }
+
       SKIF_GamingCollection::SortApps (&_data->apps);
 
       //PLOG_INFO << "Apps were sorted!";
 
+      SKIF_LibrarySnapshot_Save (_data->snapshot_context, _data->apps, _data->apptickets);
+
       PLOG_INFO << "Finished populating the library list.";
 
       PLOG_INFO_IF(pPatTexSRV.p == nullptr) << "Loading the embedded Patreon texture...";
@@ -5724,16 +6145,10 @@ SKIF_UI_Tab_DrawLibrary (void)
     }
   }
 
-  else if (! PopulatedGames && library_worker != nullptr && library_worker->iWorker == 1 && WaitForSingleObject (library_worker->hWorker, 0) == WAIT_OBJECT_0)
+  else if ((! PopulatedGames || revalidateLibrary) && library_worker != nullptr && library_worker->iWorker == 1 && WaitForSingleObject (library_worker->hWorker, 0) == WAIT_OBJECT_0)
   {
-
-    struct IconCache {
-      app_record_s::tex_registry_s tex_icon;
-      app_record_s::Store store;
-      AppId_t id;
-    };
-
-    std::vector<IconCache> icon_cache;
+    // Replacing the data from the library snapshot should go by unnoticed
+    const bool revalidated = std::exchange (revalidateLibrary, library_worker->from_snapshot);
 
     // Clear up any unacknowledged icon workers
     for (auto& app : g_apps)
@@ -5748,79 +6163,84 @@ SKIF_UI_Tab_DrawLibrary (void)
           activeIconWorkers--;
         }
       }
-      
-      // Cache any existing icon textures...
-      if (app.second.tex_icon.texture.p != nullptr)
-      {
-        icon_cache.push_back ({
-          app.second.tex_icon,
-          app.second.store,
-          app.second.id
-        });
-
-        //SKIF_ResourcesToFree.push(app.second.tex_icon.texture.p);
-        //app.second.tex_icon.texture.p = nullptr;
-      }
     }
 
     std::scoped_lock app_lock (g_apps_mutex);
 
-    // Clear current data
-    g_apps         = { };
-    g_apptickets   = { };
-    labels         = { };
-    labelsFiltered = { };
+    // Only the initial population replaces the whole list; later refreshes patch it
+    const bool patched = ! g_apps.empty ( );
 
-    // Insert new data
-    g_apps       = library_worker->apps;
-    g_apptickets = library_worker->apptickets;
-    labels       = library_worker->labels;
+    // Fingerprint of the selected app, to tell whether it survives the refresh as it is
+    bool     selected_found = false;
+    uint64_t selected_hash  = 0;
 
-    // Move cached icons over
     for (auto& app : g_apps)
     {
-      for (auto& icon : icon_cache)
+      if (app.second.id == selection.appid && app.second.store == selection.store)
       {
-        if (icon.id    == app.second.id
-         && icon.store == app.second.store)
-        {
-          app.second.tex_icon = icon.tex_icon; // Move it over
-          app.second.tex_icon.iWorker = 2;
-          icon.id = 0; // Mark it _not_ for release
-          break;
-        }
+        selected_found = true;
+        selected_hash  = app.second.library_hash;
       }
     }
 
-    // Push unused icons for release
-    for (auto& icon : icon_cache)
+    library_patch_s patch =
+      PatchLibrary (library_worker->apps);
+
+    g_apptickets = library_worker->apptickets;
+
+    PLOG_INFO << "[Library Processing] Patched the library: " << patch.added   << " added, " << patch.removed   << " removed, "
+                                                              << patch.changed << " changed, " << patch.unchanged << " unchanged.";
+
+    // The search index refers to the apps by their position in the list
+    if (patch.added != 0 || patch.removed != 0 || patch.changed != 0 || patch.reordered)
+      labels.clear ( );
+
+    bool selection_removed = true;
+
+    for (auto& app : g_apps)
     {
-      if (icon.id == 0)
-        continue; // Skip icons marked as 0
-      
-      SKIF_ResourcesToFree.push(icon.tex_icon.texture.p);
-      icon.tex_icon.texture.p = nullptr;
+      if (app.second.id == selection.appid && app.second.store == selection.store)
+      {
+        selection_removed = false;
+
+        // Reload what is shown for the selected app if it changed
+        if (! selected_found || selected_hash != app.second.library_hash)
+          update = true;
+      }
     }
 
-    fAlphaList = (_registry.bFadeCovers) ? 0.0f : 1.0f;
+    // The list only fades in when populated from scratch
+    if (! revalidated && ! patched)
+    {
+      fAlphaList = (_registry.bFadeCovers) ? 0.0f : 1.0f;
 
-    frameLibraryRefreshed = ImGui::GetFrameCount ( );
+      frameLibraryRefreshed = ImGui::GetFrameCount ( );
+    }
 
     // Reset selection to Special K, but only if set to something else than -1
-    if (selection.appid != 0)
+    //   (the last selected app is then selected again below, if it can be found)
+    const bool reselect = (! revalidated && (! patched || selection_removed));
+
+    if (reselect && selection.appid != 0)
       selection.reset();
 
     bool resortGames   = false;
     int tmpPinnedOnTop = 0;
 
+    std::vector <bool> filterMatches;
+    SearchFilterMatches (filterMatches);
+
     // Do other misc stuff
     for (auto& app : g_apps)
     {
       if (app.second.id == 0)
         continue;
 
+      size_t idx = &app - g_apps.data ();
+
       // Set to last selected if it can be found
-      if (app.second.id       ==                      _registry.uiLastSelectedGame &&
+      if (reselect                                                                 &&
+          app.second.id       ==                      _registry.uiLastSelectedGame &&
           app.second.store    == (app_record_s::Store)_registry.uiLastSelectedStore)
       {
         PLOG_VERBOSE << "Selected app ID " << app.second.id << " from platform ID " << (int)app.second.store << ".";
@@ -5840,7 +6260,7 @@ SKIF_UI_Tab_DrawLibrary (void)
       app.second.specialk.injection.dll.version_utf8 = SK_WideCharToUTF8 (app.second.specialk.injection.dll.version);
 
       // Apply the current filter
-      app.second.filtered = (charFilter[0] != '\0' && (StrStrIA (app.first.c_str(), charFilter) == NULL &&                // Name
+      app.second.filtered = (charFilter[0] != '\0' && (! filterMatches [idx] &&                                           // Name / store ID
                                                        StrStrIA (app.second.skif.category.c_str(), charFilter) == NULL)); // Category
 
       // Count the number of pinned entries on top
@@ -5874,8 +6294,6 @@ SKIF_UI_Tab_DrawLibrary (void)
       if (app.second.id == 0 || app.second.filtered)
         continue;
 
-      InsertTrieKey (&app, &labelsFiltered);
-
       numRegular++;
 
       if (app.second.skif.pinned > 50)
@@ -5887,7 +6305,6 @@ SKIF_UI_Tab_DrawLibrary (void)
     CloseHandle (library_worker->hWorker);
     library_worker->hWorker = NULL;
     library_worker->iWorker = 2;
-    library_worker->labels  = Trie { };
     library_worker->apps.clear ();
     library_worker->apptickets.clear();
 
@@ -6008,8 +6425,8 @@ SKIF_UI_Tab_DrawLibrary (void)
       {
         // Parse appinfo data for the current game
         // This must be done from the main thread since it also manipulates the g_apps array
-        if (! pApp->processed)
-          appinfo->getAppInfo ( pApp->id, &g_apps );
+        if (! pApp->processed && appinfo->getAppInfo ( pApp->id, pApp ))
+          SKIF_GamingCollection::AppsGeneration++;
       }
 
       // Only run a worker if we're not dealing with Special K
@@ -6023,30 +6440,21 @@ SKIF_UI_Tab_DrawLibrary (void)
         worker->apptickets = g_apptickets;
         worker->cpu_pre    = (int)pApp->specialk.injection.injection.bitness;
 
+        // The selected game always goes ahead of any background work
         HANDLE hWorkerThread = (HANDLE)
-        _beginthreadex (nullptr, 0x0, [](void* var) -> unsigned
+        SKIF_Util_QueueTask (SKIF_TaskPriority::Interactive, SKIF_TaskGroup_None, [worker](const SKIF_TaskToken&)
         {
-          SKIF_Util_SetThreadDescription (GetCurrentThread (), L"SKIF_GameWorker");
-
-          // Is this combo really appropriate for this thread?
-          //SKIF_Util_SetThreadPowerThrottling (GetCurrentThread (), 1); // Enable EcoQoS for this thread
-          //SetThreadPriority (GetCurrentThread (), THREAD_MODE_BACKGROUND_BEGIN);
-
-          //PLOG_DEBUG << "SKIF_GameWorker thread started!";
+          //PLOG_DEBUG << "SKIF_GameWorker task started!";
 
-          SKIF_Lib_GameWorkerThread_s* _data = static_cast<SKIF_Lib_GameWorkerThread_s*>(var);
+          SKIF_Lib_GameWorkerThread_s* _data = worker;
 
           UpdateInjectionStrategy (&_data->app, _data->apptickets);
       
           // Force a refresh when the game icons have finished being streamed
           PostMessage (SKIF_Notify_hWnd, WM_SKIF_ICON, 0x0, 0x0);
 
-          //PLOG_DEBUG << "SKIF_GameWorker thread stopped!";
-
-          //SetThreadPriority (GetCurrentThread (), THREAD_MODE_BACKGROUND_END);
-
-          return 0;
-        }, worker, 0x0, nullptr);
+          //PLOG_DEBUG << "SKIF_GameWorker task stopped!";
+        });
 
         bool threadCreated = (hWorkerThread != NULL);
 
@@ -6056,7 +6464,7 @@ SKIF_UI_Tab_DrawLibrary (void)
           worker->free = false;
         }
 
-        else // Someting went wrong during thread creation
+        else // Someting went wrong while queuing the task
         {
           // Reset all values
           *worker = SKIF_Lib_GameWorkerThread_s();
@@ -6497,23 +6905,25 @@ SKIF_UI_Tab_DrawLibrary (void)
   {
     strncpy (charFilter, charFilterTmp, MAX_PATH);
 
-    labelsFiltered = Trie { };
     numPinnedOnTop = 0;
     numRegular     = 0;
 
+    std::vector <bool> filterMatches;
+    SearchFilterMatches (filterMatches);
+
     for (auto& app : g_apps)
     {
       if (app.second.id == 0)
         continue;
+
+      size_t idx = &app - g_apps.data ();
       
-      app.second.filtered = (charFilter[0] != '\0' && (StrStrIA (app.first.c_str(), charFilter) == NULL &&                // Name
+      app.second.filtered = (charFilter[0] != '\0' && (! filterMatches [idx] &&                                           // Name / store ID
                                                        StrStrIA (app.second.skif.category.c_str(), charFilter) == NULL)); // Category
 
       if (app.second.filtered)
         continue;
 
-      InsertTrieKey (&app, &labelsFiltered);
-
       numRegular++;
 
       if (app.second.skif.pinned > 50)
@@ -7071,7 +7481,9 @@ SKIF_UI_Tab_DrawLibrary (void)
         load_str = app.second.install_dir + L"\\goggame-" + std::to_wstring(app.second.id) + L".ico";
       else if (app.second.store  == app_record_s::Store::Steam)  // Steam
       {
-        appinfo->getAppInfo ( app.second.id, &g_apps );
+        if (appinfo->getAppInfo ( app.second.id, &app.second ))
+          SKIF_GamingCollection::AppsGeneration++;
+
         load_str = SK_FormatStringW(LR"(%ws\appcache\librarycache\%i\%hs.jpg)", _path_cache.steam_install, app.second.id, app.second.common_config.icon_hash.c_str ()); //L"_icon.jpg"
       }
       else if (app.second.store  == app_record_s::Store::Xbox)  // Xbox
@@ -7091,45 +7503,43 @@ SKIF_UI_Tab_DrawLibrary (void)
       data->texture = &app.second.tex_icon;
       data->app     = &app.second;
 
-      // We're going to stream game icons asynchronously on this thread
+      // We're going to stream game icons asynchronously as background work
       HANDLE hWorkerThread = (HANDLE)
-      _beginthreadex (nullptr, 0x0, [](void* var) -> unsigned
+      SKIF_Util_QueueTask (SKIF_TaskPriority::Background, SKIF_TaskGroup_GameIcons, [data](const SKIF_TaskToken& token)
       {
-        SKIF_Util_SetThreadDescription (GetCurrentThread (), L"SKIF_LibIconWorker");
-
-        CoInitializeEx (nullptr, 0x0);
-
-        thread_s* _data = static_cast<thread_s*>(var);
-
-        ImVec2 dontCare;
+        thread_s* _data = data;
 
-        LoadLibraryTexture ( LibraryTexture::Icon,
-                                _data->appid,
-                                  _data->texture->texture,
-                                    _data->path,
-                                      dontCare,
-                                        _data->app );
+        // Skipped if the library is being repopulated
+        if (! token.cancelled ( ))
+        {
+          ImVec2 dontCare;
+
+          LoadLibraryTexture ( LibraryTexture::Icon,
+                                  _data->appid,
+                                    _data->texture->texture,
+                                      _data->path,
+                                        dontCare,
+                                          _data->app );
+        }
           
         delete _data;
 
         // Force a refresh when the game icons have finished being streamed
         PostMessage (SKIF_Notify_hWnd, WM_SKIF_ICON, 0x0, 0x0);
-
-        return 0;
-      }, data, 0x0, nullptr);
+      });
         
       bool threadCreated = (hWorkerThread != NULL);
 
       if (threadCreated)
       {
-        PLOG_VERBOSE << "An icon worker was spawned successfully!";
+        PLOG_VERBOSE << "An icon worker task was queued successfully!";
         app.second.tex_icon.hWorker = hWorkerThread;
         app.second.tex_icon.iWorker = 1;
       }
 
-      else // Someting went wrong during thread creation, so free up the memory we allocated earlier
+      else // Someting went wrong while queuing the task, so free up the memory we allocated earlier
       {
-        PLOG_VERBOSE << "Something went wrong when spawning an icon worker thread...";
+        PLOG_VERBOSE << "Something went wrong when queuing an icon worker task...";
 
         delete data;
         app.second.tex_icon.iWorker = 2;
@@ -7561,6 +7971,12 @@ SKIF_UI_Tab_DrawLibrary (void)
             // If any file was removed
             if (d1 || d2 || d3 || d4)
             {
+              for (auto file : { L"cover.png",          L"cover.jpg",
+                                 L"cover-original.png", L"cover-original.jpg",
+                                 L"cover-pcgw.png",
+                                 L"cover-fallback.png", L"cover-fallback.jpg" })
+                SKIF_AssetIndex::GetInstance ( ).update (targetPath + file);
+
               update    = true;
               lastCover.reset(); // Needed as otherwise SKIF would not reload the cover
             }
@@ -7669,11 +8085,11 @@ SKIF_UI_Tab_DrawLibrary (void)
       ImGui::Separator ( );
 
       if (SKIF_ImGui_MenuItemEx2 ("Open SteamGridDB", ICON_FA_UP_RIGHT_FROM_SQUARE, ImGui::GetStyleColorVec4 (ImGuiCol_SKIF_Info)))
-        SKIF_Util_OpenURI (SK_UTF8ToWideChar (pApp->ui.sgdbGrids).c_str());
+        SKIF_Util_OpenURI (SK_UTF8ToWideChar (pApp->details->ui.sgdbGrids).c_str());
       else
       {
         SKIF_ImGui_SetMouseCursorHand ( );
-        SKIF_ImGui_SetHoverText       (pApp->ui.sgdbGrids);
+        SKIF_ImGui_SetHoverText       (pApp->details->ui.sgdbGrids);
       }
 
       ImGui::PopStyleColor ( );
@@ -7793,6 +8209,10 @@ SKIF_UI_Tab_DrawLibrary (void)
 
             SetFileAttributes ((targetPath + ext).c_str(),
                     GetFileAttributes ((targetPath + ext).c_str()) & ~FILE_ATTRIBUTE_READONLY);
+
+            SKIF_AssetIndex::GetInstance ( ).update (targetPath + L".png");
+            SKIF_AssetIndex::GetInstance ( ).update (targetPath + L".jpg");
+            SKIF_AssetIndex::GetInstance ( ).update (targetPath + L".ico");
             
             ImVec2 dontCare;
 
@@ -7880,10 +8300,14 @@ SKIF_UI_Tab_DrawLibrary (void)
             // If any file was removed
             if (d1 || d2 || d3)
             {
+              SKIF_AssetIndex::GetInstance ( ).update (targetPath + fileName + L".png");
+              SKIF_AssetIndex::GetInstance ( ).update (targetPath + fileName + L".jpg");
+              SKIF_AssetIndex::GetInstance ( ).update (targetPath + fileName + L".ico");
+
               ImVec2 dontCare;
 
-              if (pApp->store == app_record_s::Store::Steam)
-                appinfo->getAppInfo ( pApp->id, &g_apps );
+              if (pApp->store == app_record_s::Store::Steam && appinfo->getAppInfo ( pApp->id, pApp ))
+                SKIF_GamingCollection::AppsGeneration++;
 
               // Reload the icon
               LoadLibraryTexture (LibraryTexture::Icon,
@@ -7902,11 +8326,11 @@ SKIF_UI_Tab_DrawLibrary (void)
       ImGui::Separator ( );
 
       if (SKIF_ImGui_MenuItemEx2 ("Open SteamGridDB", ICON_FA_UP_RIGHT_FROM_SQUARE, ImGui::GetStyleColorVec4 (ImGuiCol_SKIF_Info)))
-        SKIF_Util_OpenURI (SK_UTF8ToWideChar (pApp->ui.sgdbIcons).c_str());
+        SKIF_Util_OpenURI (SK_UTF8ToWideChar (pApp->details->ui.sgdbIcons).c_str());
       else
       {
         SKIF_ImGui_SetMouseCursorHand ( );
-        SKIF_ImGui_SetHoverText       (pApp->ui.sgdbIcons);
+        SKIF_ImGui_SetHoverText       (pApp->details->ui.sgdbIcons);
       }
 
       ImGui::Separator      ( );
@@ -8099,22 +8523,25 @@ SKIF_UI_Tab_DrawLibrary (void)
     tryingToLoadCover = true;
     queuePosGameCover = textureLoadQueueLength.load() + 1;
 
-    // We're going to stream the cover in asynchronously on this thread
+    // Any cover of a previous selection that has yet to start loading is stale by now;
+    //   cancelled tasks never take a queue position, so the position above still holds
+    SKIF_TaskScheduler::GetInstance ( ).cancel (SKIF_TaskGroup_Cover);
+
+    // We're going to stream the cover in asynchronously on the task scheduler
     HANDLE hWorkerThread = (HANDLE)
-    _beginthreadex (nullptr, 0x0, [](void*) -> unsigned
+    SKIF_Util_QueueTask (SKIF_TaskPriority::Interactive, SKIF_TaskGroup_Cover, [](const SKIF_TaskToken& token)
     {
-      SKIF_Util_SetThreadDescription (GetCurrentThread (), L"SKIF_LibCoverWorker");
-
-      CoInitializeEx (nullptr, 0x0);
+      if (token.cancelled ( ))
+        return;
 
-      PLOG_DEBUG << "SKIF_LibCoverWorker thread started!";
+      PLOG_DEBUG << "SKIF_LibCoverWorker task started!";
 
       PLOG_INFO  << "Streaming game cover asynchronously...";
 
       if (pApp == nullptr)
       {
         PLOG_ERROR << "Aborting due to pApp being a nullptr!";
-        return 0;
+        return;
       }
 
       app_record_s* _pApp = pApp;
@@ -8311,10 +8738,8 @@ SKIF_UI_Tab_DrawLibrary (void)
       }
 
       PLOG_INFO  << "Finished streaming game cover asynchronously...";
-      PLOG_DEBUG << "SKIF_LibCoverWorker thread stopped!";
-
-      return 0;
-    }, nullptr, 0x0, nullptr);
+      PLOG_DEBUG << "SKIF_LibCoverWorker task stopped!";
+    });
 
     if (hWorkerThread != NULL)
       CloseHandle (hWorkerThread);
@@ -8370,6 +8795,8 @@ SKIF_UI_Tab_DrawLibrary (void)
         // Hide entry
         pApp->id = 0;
 
+        SKIF_GamingCollection::AppsGeneration++;
+
         // Release the icon texture (the cover will be handled by LoadLibraryTexture on next frame
         if (pApp->tex_icon.texture.p != nullptr)
         {
@@ -9139,10 +9566,13 @@ SKIF_UI_Tab_DrawLibrary (void)
 
         if (SKIF_ModifyCustomAppID (pApp, wszPath, wszArgs, wszWorkDir))
         {
+          SKIF_GamingCollection::AppsGeneration++;
+
           // Attempt to extract the icon from the given executable straight away
           std::wstring SKIFCustomPath = SK_FormatStringW (LR"(%ws\Assets\Custom\%i\icon-original.png)", _path_cache.specialk_userdata, pApp->id);
           DeleteFile (SKIFCustomPath.c_str());
           SKIF_Util_SaveExtractExeIcon (wszPath, SKIFCustomPath);
+          SKIF_AssetIndex::GetInstance ( ).update (SKIFCustomPath);
         }
       }
 
@@ -9961,6 +10391,16 @@ SKIF_UI_Tab_DrawLibrary (void)
     lastCover.reset(); // Needed as otherwise SKIF would not reload the cover
   }
 
+  // Same if the height covers are downscaled to has changed (cover scaling or DPI)
+  static uint32_t
+      lastCoverDisplayHeight  = SKIF_Assets_GetCoverDisplayHeight ( );
+  if (lastCoverDisplayHeight != SKIF_Assets_GetCoverDisplayHeight ( ) && uiCoverVisible && ! ImGui::IsAnyMouseDown ( ))
+  {   lastCoverDisplayHeight  = SKIF_Assets_GetCoverDisplayHeight ( );
+
+    update    = true;
+    lastCover.reset(); // Needed as otherwise SKIF would not reload the cover
+  }
+
   extern uint32_t SelectNewSKIFGame;
 
   if (SelectNewSKIFGame > 0)
@@ -10051,7 +10491,7 @@ SKIF_UI_Tab_DrawLibrary (void)
           continue;
         
         //PLOG_DEBUG << "[AppInfo Processing] " << "[" << ImGui::GetFrameCount ( ) << "] Processing " << app.second.id << "...";
-        appinfo->getAppInfo ( app.second.id, &g_apps );
+        appinfo->getAppInfo ( app.second.id, &app.second );
 
         fallbackAvailable = false;
         break;
@@ -27,6 +27,7 @@
 
 #include <utility/injection.h>
 #include <utility/fsutil.h>
+#include <utility/process_tracker.h>
 
 #include <fonts/fa_621.h>
 #include <fonts/fa_621b.h>
@@ -38,6 +39,7 @@
 #include <map>
 #include <unordered_map>
 #include <stack>
+#include <algorithm>
 
 #include <Windows.h>
 #include <wmsdk.h>
@@ -681,6 +683,9 @@ SKIF_UI_Tab_DrawMonitor (void)
     //std::map <DWORD, standby_record_s> Processes;
     std::vector <standby_record_s> Processes;
     DWORD dwPIDs [MAX_INJECTED_PROCS] = { };
+    double dScanTimeMs = 0.0; // Time spent on the refresh
+    size_t uiScanned   = 0,   // Processes examined
+           uiRescanned = 0;   // Processes whose handles/modules had to be looked through again
   } static snapshots [3];
 
   //static volatile LONG snapshot_idx = 0;
@@ -803,6 +808,20 @@ SKIF_UI_Tab_DrawMonitor (void)
     SKIF_ImGui_SetHoverTip ("Real-time updates are paused.");
   }
 
+  else if (snapshot.uiScanned > 0)
+  {
+    ImGui::SameLine         ( );
+    ImGui::TextColored      (
+      ImGui::GetStyleColorVec4 (ImGuiCol_TextDisabled),
+        "%.1f ms", snapshot.dScanTimeMs);
+
+    SKIF_ImGui_SetHoverTip  (
+      SK_FormatString ("Time spent on the last refresh.\n"
+                       "%zu of %zu processes had to be scanned again.",
+                         snapshot.uiRescanned, snapshot.uiScanned)
+    );
+  }
+
   ImGui::TreePop          ( );
   ImGui::EndGroup         ( );
 
@@ -996,13 +1015,8 @@ SKIF_UI_Tab_DrawMonitor (void)
 
         Processes.clear    ();
 
-        using _PerProcessHandleMap =
-          std::map        < DWORD,
-              std::vector < SYSTEM_HANDLE_TABLE_ENTRY_INFO_EX >
-                                                              >;
-
-        _PerProcessHandleMap
-          handles_by_process;
+        LARGE_INTEGER liScanStart = { };
+        QueryPerformanceCounter (&liScanStart);
           
         static HANDLE hProcessDst =
           SKIF_Util_GetCurrentProcess (); // Pseudo Handle
@@ -1012,13 +1026,12 @@ SKIF_UI_Tab_DrawMonitor (void)
 #pragma region Collect All Event Handles
         NTSTATUS ntStatusHandles;
 
-        ULONG      handle_info_size ( SystemHandleInformationSize );
-        _ByteArray handle_info_buffer;
+        // Kept across refreshes, so it only ever has to grow once the system has more handles than before
+        static _ByteArray handle_info_buffer (SystemHandleInformationSize);
 
         do
         {
-          handle_info_buffer.resize (
-                    handle_info_size );
+          ULONG handle_info_size = static_cast <ULONG> (handle_info_buffer.size ());
 
           ntStatusHandles =
             NtQuerySystemInformation (
@@ -1027,8 +1040,19 @@ SKIF_UI_Tab_DrawMonitor (void)
                 handle_info_size,
                 &handle_info_size     );
 
+          // Leave some headroom as the number of handles keeps fluctuating
+          if (ntStatusHandles == STATUS_INFO_LENGTH_MISMATCH)
+            handle_info_buffer.resize (
+              std::max <size_t> (handle_info_size, handle_info_buffer.size ()) + handle_info_buffer.size () / 4
+            );
+
         } while (ntStatusHandles == STATUS_INFO_LENGTH_MISMATCH);
 
+        // All Event handles in the system, grouped by process
+        static std::vector <SYSTEM_HANDLE_TABLE_ENTRY_INFO_EX>
+          event_handles;
+          event_handles.clear ( );
+
         if (NT_SUCCESS (ntStatusHandles))
         {
           auto handleTableInformationEx =
@@ -1050,320 +1074,390 @@ SKIF_UI_Tab_DrawMonitor (void)
               continue;
 
             // Add the remaining handles to the list of handles to go through
-            handles_by_process [handleTableInformationEx->Handles [i].ProcessId]
-                  .emplace_back (handleTableInformationEx->Handles [i]);
+            event_handles.emplace_back (handleTableInformationEx->Handles [i]);
           }
+
+          std::stable_sort (event_handles.begin (), event_handles.end (),
+            [](const SYSTEM_HANDLE_TABLE_ENTRY_INFO_EX& a, const SYSTEM_HANDLE_TABLE_ENTRY_INFO_EX& b) -> bool
+            {
+              return a.ProcessId < b.ProcessId;
+            }
+          );
         }
 
 #pragma endregion
 
 #pragma region Detect Special K Module and Handle (primary method)
 
-        PROCESSENTRY32W pe32 = { };
-        MODULEENTRY32W  me32 = { };
+        // Verdicts are cached per process (PID + creation time) and only redone once the number of Event
+        //   handles of the process changes, which it does as Special K is injected or unloaded; the count
+        //     comes from the system handle table that is already queried, so unchanged processes cost nothing
+        struct verdict_s {
+          uint64_t     creation_time = 0;
+          size_t       event_count   = 0; // Number of Event handles
+          int          status        = 255;
+          int          handles       = 0;
+          std::wstring path;              // DOS path of the executable
+          bool         admin         = false;
+          uint32_t     generation    = 0;
+        };
+
+        static std::unordered_map <DWORD, verdict_s>
+                        verdicts;
+        static uint32_t generation = 0;
+                      ++generation;
+
+        size_t scanned   = 0,
+               rescanned = 0;
+
+        static SKIF_ProcessTracker& _tracker = SKIF_ProcessTracker::GetInstance ( );
+                                    _tracker.Refresh ( );
 
-        SK_AutoHandle hProcessSnap (
-          CreateToolhelp32Snapshot (TH32CS_SNAPPROCESS, 0)
-        );
+        MODULEENTRY32W  me32 = { };
 
-        if ((intptr_t)hProcessSnap.m_h > 0)
+        for (auto& process : _tracker.GetProcesses ( ))
         {
-          pe32.dwSize = sizeof (PROCESSENTRY32W);
+          // Skip everything belonging to SKIF, as well as processes we cannot open
+          if (process->pid == dwPidOfMe ||
+              process->pid == 0         ||
+            ! process->accessible)
+            continue;
+
+          scanned++;
+
+          auto& verdict = verdicts [process->pid];
 
-          if (Process32FirstW (hProcessSnap, &pe32))
+          // Newly seen process, or the PID has been reused
+          bool fresh = (verdict.generation    == 0 ||
+                        verdict.creation_time != process->creation_time);
+
+          if (fresh)
           {
-            do
+            verdict               = verdict_s { };
+            verdict.creation_time = process->creation_time;
+            verdict.admin         = SKIF_Util_IsProcessAdmin (process->pid);
+
+            // We don't actually need the additional stuff of PROCESS_QUERY_INFORMATION
+            SK_AutoHandle hProcessInfo (
+              OpenProcess (PROCESS_QUERY_LIMITED_INFORMATION, FALSE, process->pid)
+            );
+
+            wchar_t                                 wszProcessName [MAX_PATH + 2] = { };
+            GetProcessImageFileNameW (hProcessInfo, wszProcessName, MAX_PATH);
+
+            std::wstring friendlyPath = std::wstring(wszProcessName);
+
+            static std::map <std::wstring, std::wstring>
+              deviceMap = GetDosPathDevicePathMap ( );
+
+            for (auto& device : deviceMap)
             {
-              // Skip everything belonging to SKIF
-              if (pe32.th32ProcessID == dwPidOfMe ||
-                  pe32.th32ProcessID == 0)
-                continue;
-
-              HANDLE hProcessSrc =
-                  OpenProcess (
-                      PROCESS_DUP_HANDLE | // Required to open handles (will fail on elevated processes)
-                      PROCESS_QUERY_LIMITED_INFORMATION, FALSE, // We don't actually need the additional stuff of PROCESS_QUERY_INFORMATION
-                    pe32.th32ProcessID );
-
-              // If we cannot open the process with PROCESS_DUP_HANDLE, it's probably because it's running elevated. Let's try without it
-              if (! hProcessSrc)
+              if (friendlyPath.find(device.second) != std::wstring::npos)
               {
-                hProcessSrc =
-                  OpenProcess (
-                      PROCESS_QUERY_LIMITED_INFORMATION, FALSE, // We don't actually need the additional stuff of PROCESS_QUERY_INFORMATION
-                    pe32.th32ProcessID );
+                friendlyPath.replace(0, device.second.length(), (device.first + L"\\"));
+                // Strip all null terminator \0 characters from the string
+                friendlyPath.erase(std::find(friendlyPath.begin(), friendlyPath.end(), '\0'), friendlyPath.end());
+                break;
               }
+            }
 
-              if (! hProcessSrc) continue;
-                
-              // Initialize a variable were we'll store all stuff in
-              standby_record_s proc = standby_record_s{};
+            verdict.path = friendlyPath;
+          }
 
-              SK_AutoHandle hModuleSnap (
-                CreateToolhelp32Snapshot (TH32CS_SNAPMODULE | TH32CS_SNAPMODULE32, pe32.th32ProcessID)
-              );
+          verdict.generation = generation;
 
-              // Go through modules first (local injection)
-              if ((intptr_t)hModuleSnap.m_h > 0)
-              {
-                me32.dwSize = sizeof (MODULEENTRY32W);
+          // The Event handles of this process
+          auto handles_begin =
+            std::lower_bound (event_handles.begin (), event_handles.end (), process->pid,
+              [](const SYSTEM_HANDLE_TABLE_ENTRY_INFO_EX& handle, DWORD pid) -> bool { return handle.ProcessId < pid; });
+          auto handles_end =
+            std::upper_bound (handles_begin,          event_handles.end (), process->pid,
+              [](DWORD pid, const SYSTEM_HANDLE_TABLE_ENTRY_INFO_EX& handle) -> bool { return pid < handle.ProcessId; });
+
+          size_t event_count = static_cast <size_t> (std::distance (handles_begin, handles_end));
+
+          // Only examine the modules and handles of the process if anything changed since the last time
+          if (fresh || verdict.event_count != event_count)
+          {
+            rescanned++;
+
+            verdict.event_count = event_count;
+            verdict.status      = 255;
+            verdict.handles     = 0;
+
+            SK_AutoHandle hModuleSnap (
+              CreateToolhelp32Snapshot (TH32CS_SNAPMODULE | TH32CS_SNAPMODULE32, process->pid)
+            );
 
-                if (Module32FirstW (hModuleSnap, &me32))
+            // Go through modules first (local injection)
+            if ((intptr_t)hModuleSnap.m_h > 0)
+            {
+              me32.dwSize = sizeof (MODULEENTRY32W);
+
+              if (Module32FirstW (hModuleSnap, &me32))
+              {
+                do
                 {
-                  do
+                  std::wstring moduleName = me32.szModule;
+
+                  // Special K's global DLL files
+                  if (StrStrIW (moduleName.c_str(), L"SpecialK32.dll") || 
+                      StrStrIW (moduleName.c_str(), L"SpecialK64.dll"))
                   {
-                    std::wstring moduleName = me32.szModule;
+                    verdict.status = 254; // Stuck?
+                    // We'll keep checking the modules for a potential local injection
+                  }
 
-                    // Special K's global DLL files
-                    if (StrStrIW (moduleName.c_str(), L"SpecialK32.dll") || 
-                        StrStrIW (moduleName.c_str(), L"SpecialK64.dll"))
+                  // Fallback of the fallback -- detect locally injected copies of SK!
+                  else {
+                    static std::wstring localDLLs[] = { // The small things matter -- array is sorted in the order of most expected
+                      L"DXGI.dll",
+                      L"D3D11.dll",
+                      L"D3D9.dll",
+                      L"OpenGL32.dll"
+                      L"DInput8.dll",
+                      L"D3D8.dll",
+                      L"DDraw.dll",
+                    };
+
+                    for (auto& localDLL : localDLLs)
                     {
-                      proc.status = 254; // Stuck?
-                      // We'll keep checking the modules for a potential local injection
-                    }
+                      // Skip if it doesn't have the name of a local wrapper DLL
+                      if (StrStrIW (moduleName.c_str(), localDLL.c_str()) == NULL)
+                        continue;
 
-                    // Fallback of the fallback -- detect locally injected copies of SK!
-                    else {
-                      static std::wstring localDLLs[] = { // The small things matter -- array is sorted in the order of most expected
-                        L"DXGI.dll",
-                        L"D3D11.dll",
-                        L"D3D9.dll",
-                        L"OpenGL32.dll"
-                        L"DInput8.dll",
-                        L"D3D8.dll",
-                        L"DDraw.dll",
-                      };
-
-                      for (auto& localDLL : localDLLs)
-                      {
-                        // Skip if it doesn't have the name of a local wrapper DLL
-                        if (StrStrIW (moduleName.c_str(), localDLL.c_str()) == NULL)
-                          continue;
-
-                        // Skip system modules below \Windows\System32 and \Windows\SysWOW64
-                        if (StrStrIW (me32.szExePath, LR"(\Windows\Sys)"))
-                          continue;
-
-                        bool isKnownDLL = false,
-                              isSpecialK = false;
+                      // Skip system modules below \Windows\System32 and \Windows\SysWOW64
+                      if (StrStrIW (me32.szExePath, LR"(\Windows\Sys)"))
+                        continue;
 
-                        // Is it known?
-                        for (auto& knownDLL : knownDLLs)
-                        {
-                          // We're dealing with a known DLL
-                          if (knownDLL.path == me32.szExePath) //if (StrStrIW (me32.szExePath, knownDLL.path.c_str()))
-                          {
-                            //PLOG_VERBOSE << "Known DLL detected!";
-                            isKnownDLL = true;
-                            isSpecialK = knownDLL.isSpecialK;
-
-                            // Skip checking the remaining known DLLs for a match
-                            break;
-                          }
-                        }
+                      bool isKnownDLL = false,
+                            isSpecialK = false;
 
-                        if (isKnownDLL && isSpecialK)
+                      // Is it known?
+                      for (auto& knownDLL : knownDLLs)
+                      {
+                        // We're dealing with a known DLL
+                        if (knownDLL.path == me32.szExePath) //if (StrStrIW (me32.szExePath, knownDLL.path.c_str()))
                         {
-                          proc.status = 2; // Local injection
+                          //PLOG_VERBOSE << "Known DLL detected!";
+                          isKnownDLL = true;
+                          isSpecialK = knownDLL.isSpecialK;
 
-                          // Skip checking the remaining local SK DLLs for this module
+                          // Skip checking the remaining known DLLs for a match
                           break;
                         }
+                      }
+
+                      if (isKnownDLL && isSpecialK)
+                      {
+                        verdict.status = 2; // Local injection
 
-                        // DLL file is not known -- let it be known
-                        else {
-                          std::wstring productName = SKIF_Util_GetProductName (me32.szExePath);
+                        // Skip checking the remaining local SK DLLs for this module
+                        break;
+                      }
 
-                          known_dll_s be_known = known_dll_s { };
-                          be_known.path        = me32.szExePath;
-                          be_known.isSpecialK  = StrStrIW (productName.c_str(), L"Special K");
+                      // DLL file is not known -- let it be known
+                      else {
+                        std::wstring productName = SKIF_Util_GetProductName (me32.szExePath);
 
-                          knownDLLs.emplace_back (be_known);
+                        known_dll_s be_known = known_dll_s { };
+                        be_known.path        = me32.szExePath;
+                        be_known.isSpecialK  = StrStrIW (productName.c_str(), L"Special K");
 
-                          PLOG_VERBOSE << "Unknown DLL detected, let it be known: " << me32.szExePath;
-                          PLOG_VERBOSE << "DLL " << ((be_known.isSpecialK) ? "is" : "is not") << " Special K!";
-                          PLOG_VERBOSE << "Full product name: " << productName;
+                        knownDLLs.emplace_back (be_known);
 
-                          // Let us not forget to flag the process as injected as well... :)
-                          if (be_known.isSpecialK)
-                            proc.status = 2;
-                        }
+                        PLOG_VERBOSE << "Unknown DLL detected, let it be known: " << me32.szExePath;
+                        PLOG_VERBOSE << "DLL " << ((be_known.isSpecialK) ? "is" : "is not") << " Special K!";
+                        PLOG_VERBOSE << "Full product name: " << productName;
+
+                        // Let us not forget to flag the process as injected as well... :)
+                        if (be_known.isSpecialK)
+                          verdict.status = 2;
                       }
                     }
+                  }
 
-                    // If we have detected a local injection we shouldn't keep checking the remaining modules
-                    if (proc.status == 2)
-                      break;
-                  } while (Module32NextW (hModuleSnap, &me32));
-                }
+                  // If we have detected a local injection we shouldn't keep checking the remaining modules
+                  if (verdict.status == 2)
+                    break;
+                } while (Module32NextW (hModuleSnap, &me32));
               }
+            }
 
-              // Go through each handle the process contains (but only if not local)
-              if (proc.status != 2)
+            // Go through each handle the process contains (but only if not local)
+            if (verdict.status != 2 && handles_begin != handles_end)
+            {
+              // Required to open handles (will fail on elevated processes)
+              SK_AutoHandle hProcessSrc (
+                OpenProcess (PROCESS_DUP_HANDLE, FALSE, process->pid)
+              );
+
+              for (auto handle = handles_begin; handle != handles_end; ++handle)
               {
-                proc.handles = 0;
+                verdict.handles++;
 
-                for ( auto& handle : handles_by_process[pe32.th32ProcessID])
-                {
-                  proc.handles++;
+                auto hHandleSrc = handle->Handle;
 
-                  auto hHandleSrc = handle.Handle;
+                // Debug purposes
+                //PLOG_VERBOSE << "Handle Granted Access: " << handle->GrantedAccess;
 
-                  // Debug purposes
-                  //PLOG_VERBOSE << "Handle Granted Access: " << handle.GrantedAccess;
+                if (! hProcessSrc.isValid ( )) continue;
 
-                  HANDLE   hDupHandle;
-                  NTSTATUS ntStat     =
-                    NtDuplicateObject (
-                      hProcessSrc,  hHandleSrc,
-                      hProcessDst, &hDupHandle,
-                              0, 0, 0 );
+                HANDLE   hDupHandle;
+                NTSTATUS ntStat     =
+                  NtDuplicateObject (
+                    hProcessSrc,  hHandleSrc,
+                    hProcessDst, &hDupHandle,
+                            0, 0, 0 );
 
-                  if (! NT_SUCCESS (ntStat)) continue;
+                if (! NT_SUCCESS (ntStat)) continue;
 
-                  std::wstring handle_name = L"";
+                std::wstring handle_name = L"";
 
-                  ULONG      _ObjectNameLen ( 64 );
-                  _ByteArray pObjectName;
+                ULONG      _ObjectNameLen ( 64 );
+                _ByteArray pObjectName;
 
-                  do
-                  {
-                    pObjectName.resize (
-                        _ObjectNameLen );
+                do
+                {
+                  pObjectName.resize (
+                      _ObjectNameLen );
 
-                    ntStat =
-                      NtQueryObject (
-                        hDupHandle,
-                              ObjectNameInformation,
-                            pObjectName.data (),
-                            _ObjectNameLen,
-                            &_ObjectNameLen );
+                  ntStat =
+                    NtQueryObject (
+                      hDupHandle,
+                            ObjectNameInformation,
+                          pObjectName.data (),
+                          _ObjectNameLen,
+                          &_ObjectNameLen );
 
-                  } while (ntStat == STATUS_INFO_LENGTH_MISMATCH);
+                } while (ntStat == STATUS_INFO_LENGTH_MISMATCH);
 
-                  if (NT_SUCCESS (ntStat))
-                  {
-                    POBJECT_NAME_INFORMATION _pni =
-                      (POBJECT_NAME_INFORMATION) pObjectName.data ();
+                if (NT_SUCCESS (ntStat))
+                {
+                  POBJECT_NAME_INFORMATION _pni =
+                    (POBJECT_NAME_INFORMATION) pObjectName.data ();
 
-                    handle_name = _pni != nullptr ?
-                                  _pni->Name.Length > 0 ?
-                                  _pni->Name.Buffer     : L""
-                                                        : L"";
-                  }
+                  handle_name = _pni != nullptr ?
+                                _pni->Name.Length > 0 ?
+                                _pni->Name.Buffer     : L""
+                                                      : L"";
+                }
 
-                  CloseHandle (hDupHandle);
+                CloseHandle (hDupHandle);
 
-                  // Examine what we got
-                  if ( (std::wstring::npos != handle_name.find ( L"SK_GlobalHookTeardown32" )  ||
-                        std::wstring::npos != handle_name.find ( L"SK_GlobalHookTeardown64" )) )
-                  {
-                    proc.status = 3; // Some form of global injection -- set to Inert for now
+                // Examine what we got
+                if ( (std::wstring::npos != handle_name.find ( L"SK_GlobalHookTeardown32" )  ||
+                      std::wstring::npos != handle_name.find ( L"SK_GlobalHookTeardown64" )) )
+                {
+                  verdict.status = 3; // Some form of global injection -- set to Inert for now
 
-                    // Skip checking the remaining handles for this process
-                    break;
-                  }
+                  // Skip checking the remaining handles for this process
+                  break;
                 }
               }
+            }
+          }
 
-              // If some form of injection was detected, add it to the list
-              if (_registry.bProcessIncludeAll || proc.status != 255)
-              {
-                wchar_t                                wszProcessName [MAX_PATH + 2] = { };
-                GetProcessImageFileNameW (hProcessSrc, wszProcessName, MAX_PATH);
+          // If some form of injection was detected, add it to the list
+          if (_registry.bProcessIncludeAll || verdict.status != 255)
+          {
+            // Only opened for the processes that are listed
+            SK_AutoHandle hProcessInfo (
+              OpenProcess (PROCESS_QUERY_LIMITED_INFORMATION, FALSE, process->pid)
+            );
 
-                std::wstring friendlyPath = std::wstring(wszProcessName);
+            if (! hProcessInfo.isValid ( ))
+              continue;
 
-                static std::map <std::wstring, std::wstring>
-                  deviceMap = GetDosPathDevicePathMap ( );
+            // Initialize a variable were we'll store all stuff in
+            standby_record_s proc = standby_record_s{};
 
-                for (auto& device : deviceMap)
-                {
-                  if (friendlyPath.find(device.second) != std::wstring::npos)
-                  {
-                    friendlyPath.replace(0, device.second.length(), (device.first + L"\\"));
-                    // Strip all null terminator \0 characters from the string
-                    friendlyPath.erase(std::find(friendlyPath.begin(), friendlyPath.end(), '\0'), friendlyPath.end());
-                    break;
-                  }
-                }
+            std::wstring& friendlyPath = verdict.path;
 
-                proc.pid      = pe32.th32ProcessID;
-                proc.arch     = SKIF_Util_IsProcessX86 (hProcessSrc) ? "32-bit" : "64-bit";
-                proc.filename = (friendlyPath.empty()) ? L"<unknown>" : friendlyPath;
-                proc.path     = friendlyPath;
-                proc.pathUTF8 = SK_WideCharToUTF8 (friendlyPath);
-                proc.tooltip  = proc.pathUTF8;
-                proc.admin    = SKIF_Util_IsProcessAdmin (pe32.th32ProcessID);
+            proc.pid      = process->pid;
+            proc.status   = verdict.status;
+            proc.handles  = verdict.handles;
+            proc.arch     = process->x86 ? "32-bit" : "64-bit";
+            proc.filename = (friendlyPath.empty()) ? L"<unknown>" : friendlyPath;
+            proc.path     = friendlyPath;
+            proc.pathUTF8 = SK_WideCharToUTF8 (friendlyPath);
+            proc.tooltip  = proc.pathUTF8;
+            proc.admin    = verdict.admin;
 
-                if      (_inject._TestUserList     (proc.pathUTF8.c_str(), false))
-                  proc.policy = Blacklist;
-                else if (_inject._TestUserList     (proc.pathUTF8.c_str(),  true))
-                  proc.policy = Whitelist;
-                else
-                  proc.policy = DontCare;
+            if      (_inject._TestUserList     (proc.pathUTF8.c_str(), false))
+              proc.policy = Blacklist;
+            else if (_inject._TestUserList     (proc.pathUTF8.c_str(),  true))
+              proc.policy = Whitelist;
+            else
+              proc.policy = DontCare;
 
-                PathStripPathW (proc.filename.data());
+            PathStripPathW (proc.filename.data());
 
-                // Strip all null terminator \0 characters from the string
-                proc.filename.erase(std::find(proc.filename.begin(), proc.filename.end(), '\0'), proc.filename.end());
+            // Strip all null terminator \0 characters from the string
+            proc.filename.erase(std::find(proc.filename.begin(), proc.filename.end(), '\0'), proc.filename.end());
 
-                if (proc.filename == L"SKIFsvc32.exe")
-                  proc.details = "Special K 32-bit Injection Service Host ";
+            if (proc.filename == L"SKIFsvc32.exe")
+              proc.details = "Special K 32-bit Injection Service Host ";
 
-                if (proc.filename == L"SKIFsvc64.exe")
-                  proc.details = "Special K 64-bit Injection Service Host ";
+            if (proc.filename == L"SKIFsvc64.exe")
+              proc.details = "Special K 64-bit Injection Service Host ";
 
-                if (proc.filename == L"SKIFdrv.exe")
-                  proc.details = "Special K Driver Manager ";
+            if (proc.filename == L"SKIFdrv.exe")
+              proc.details = "Special K Driver Manager ";
 
-                if (proc.admin && ! ::IsUserAnAdmin ( ))
-                  proc.details += "<access denied> ";
+            if (proc.admin && ! ::IsUserAnAdmin ( ))
+              proc.details += "<access denied> ";
 
-                // Check if process is suspended
-                NTSTATUS ntStatusInfoProc;
-                PROCESS_EXTENDED_BASIC_INFORMATION pebi{};
+            // Check if process is suspended
+            NTSTATUS ntStatusInfoProc;
+            PROCESS_EXTENDED_BASIC_INFORMATION pebi{};
 
-                ntStatusInfoProc = 
-                  NtQueryInformationProcess (
-                    hProcessSrc,
-                      ProcessBasicInformation,
-                      &pebi,
-                      sizeof(pebi),
-                      0                     );
+            ntStatusInfoProc = 
+              NtQueryInformationProcess (
+                hProcessInfo,
+                  ProcessBasicInformation,
+                  &pebi,
+                  sizeof(pebi),
+                  0                     );
 
-                if (NT_SUCCESS (ntStatusInfoProc) && pebi.Size >= sizeof (pebi))
-                {
-                  // This does not detect all suspended processes, e.g. suspended using NtSuspendProcess()
-                  if (pebi.IsFrozen)
-                    proc.details += "<suspended> ";
-
-                  if (pebi.IsProtectedProcess)
-                    proc.details += "<protected> ";
+            if (NT_SUCCESS (ntStatusInfoProc) && pebi.Size >= sizeof (pebi))
+            {
+              // This does not detect all suspended processes, e.g. suspended using NtSuspendProcess()
+              if (pebi.IsFrozen)
+                proc.details += "<suspended> ";
 
-                  //if (pebi.IsWow64Process)
-                  //  proc.details += "<wow64> ";
+              if (pebi.IsProtectedProcess)
+                proc.details += "<protected> ";
 
-                  if (pebi.IsProcessDeleting)
-                    proc.details += "<zombie process> ";
+              //if (pebi.IsWow64Process)
+              //  proc.details += "<wow64> ";
 
-                  if (pebi.IsBackground)
-                    proc.details += "<background> ";
+              if (pebi.IsProcessDeleting)
+                proc.details += "<zombie process> ";
 
-                  if (pebi.IsSecureProcess)
-                    proc.details += "<secure> ";
-                }
+              if (pebi.IsBackground)
+                proc.details += "<background> ";
 
-                // Add it to the list, but only if it's not a zombie process
-                if (! pebi.IsProcessDeleting)
-                  Processes.emplace_back(proc);
-              }
+              if (pebi.IsSecureProcess)
+                proc.details += "<secure> ";
+            }
 
-              CloseHandle (hProcessSrc);
-            } while (Process32NextW (hProcessSnap, &pe32));
+            // Add it to the list, but only if it's not a zombie process
+            if (! pebi.IsProcessDeleting)
+              Processes.emplace_back(proc);
           }
         }
 
+        // Forget about processes that are no longer running
+        for (auto verdict  = verdicts.begin ( );
+                  verdict != verdicts.end   ( ); )
+        {
+          if (verdict->second.generation != generation)
+            verdict = verdicts.erase (verdict);
+          else
+            ++verdict;
+        }
+
 #pragma endregion
 
 #pragma region Detect Active Injections
@@ -1432,6 +1526,17 @@ SKIF_UI_Tab_DrawMonitor (void)
         // Sort the results
         SortProcesses (Processes);
 
+        static LARGE_INTEGER liFreq = { };
+        if (liFreq.QuadPart == 0)
+          QueryPerformanceFrequency (&liFreq);
+
+        LARGE_INTEGER liScanEnd = { };
+        QueryPerformanceCounter (&liScanEnd);
+
+        snapshot.dScanTimeMs = static_cast <double> (liScanEnd.QuadPart - liScanStart.QuadPart) * 1000.0 / static_cast <double> (liFreq.QuadPart);
+        snapshot.uiScanned   = scanned;
+        snapshot.uiRescanned = rescanned;
+
         // Swap in the results
         lastWritten = currWriting;
         snapshot_idx_written.store (lastWritten);
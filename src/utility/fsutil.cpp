@@ -449,4 +449,77 @@ SK_FileOpenDialog (LPWSTR *pszPath, const COMDLG_FILTERSPEC fileTypes, UINT cFil
   PLOG_ERROR_IF(FAILED(hr)) << SKIF_Util_GetErrorAsWStr (HRESULT_CODE(hr));
 
   return hr;
-}
\ No newline at end of file
+}
+
+bool
+SK_MappedFile::open (const wchar_t* wszPath)
+{
+  close ();
+
+  // Share everything so we never block the owner (e.g. Steam) from updating the file
+  CHandle hFile (
+    CreateFileW ( wszPath, GENERIC_READ,
+                    FILE_SHARE_READ | FILE_SHARE_WRITE | FILE_SHARE_DELETE,
+                      nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL | FILE_FLAG_RANDOM_ACCESS, nullptr )
+  );
+
+  // CHandle expects nullptr for invalid handles
+  if (hFile.m_h == INVALID_HANDLE_VALUE)
+  {
+    hFile.Detach ( );
+    PLOG_ERROR << "Failed to open file: " << wszPath;
+    return false;
+  }
+
+  LARGE_INTEGER liSize = { };
+
+  if (! GetFileSizeEx (hFile, &liSize) || liSize.QuadPart == 0)
+    return false;
+
+#ifndef _WIN64
+  // A 32-bit process cannot map files of this size in a single view
+  if (liSize.QuadPart > (LONGLONG)std::numeric_limits <size_t>::max ( ))
+  {
+    PLOG_ERROR << "File is too large to be mapped: " << wszPath;
+    return false;
+  }
+#endif
+
+  // The mapping holds its own reference to the file, so the file handle is released on return
+  _mapping =
+    CreateFileMappingW (hFile, nullptr, PAGE_READONLY, 0, 0, nullptr);
+
+  if (_mapping == nullptr)
+  {
+    PLOG_ERROR << "CreateFileMappingW failed: " << SKIF_Util_GetErrorAsWStr ( );
+    return false;
+  }
+
+  _view =
+    static_cast <BYTE *> (MapViewOfFile (_mapping, FILE_MAP_READ, 0, 0, 0));
+
+  if (_view == nullptr)
+  {
+    PLOG_ERROR << "MapViewOfFile failed: " << SKIF_Util_GetErrorAsWStr ( );
+    close ( );
+    return false;
+  }
+
+  _size = static_cast <size_t> (liSize.QuadPart);
+
+  return true;
+}
+
+void
+SK_MappedFile::close (void)
+{
+  if (_view != nullptr)
+    UnmapViewOfFile (_view);
+
+  if (_mapping != nullptr)
+    CloseHandle (_mapping);
+
+  _view    = nullptr;
+  _mapping = nullptr;
+  _size    = 0;
+}
@@ -9,13 +9,17 @@
 #include <string>
 #include <sstream>
 #include <concurrent_queue.h>
+#include <unordered_map>
+#include <algorithm>
+#include <iterator>
 
 #include <utility/games.h>
 #include <SKIF.h>
 #include <utility/utility.h>
-#include "stores/Steam/apps_ignore.h"
+#include <utility/sk_utility.h>
 #include <utility/injection.h>
 #include <utility/fsutil.h>
+#include <utility/process_tracker.h>
 #include <stores/GOG/gog_library.h>
 #include <stores/epic/epic_library.h>
 #include <stores/Xbox/xbox_library.h>
@@ -30,136 +34,353 @@
 
 CONDITION_VARIABLE LibRefreshPaused = { };
 
-#pragma region Trie Keyboard Hint Search
+#pragma region Keyboard Hint Search Index
 
-// Iterative function to insert a key in the Trie
-void
-Trie::insert (const std::string& key)
+std::atomic <uint32_t> SKIF_GamingCollection::SortCounter    = 0;
+std::atomic <uint32_t> SKIF_GamingCollection::AppsGeneration = 0;
+
+// Appends the trigrams of the text, as (trigram << 32 | tag), skipping those spanning lines
+static void
+SKIF_SearchIndex_GetTrigrams (std::string_view text, std::vector <uint64_t>& grams, uint64_t tag)
+{
+  for (size_t i = 0; i + 2 < text.length ( ); i++)
+  {
+    if (text [i] == '\n' || text [i + 1] == '\n' || text [i + 2] == '\n')
+      continue;
+
+    uint64_t gram = (static_cast <uint64_t> (static_cast <uint8_t> (text [i    ])) << 16) |
+                    (static_cast <uint64_t> (static_cast <uint8_t> (text [i + 1])) <<  8) |
+                    (static_cast <uint64_t> (static_cast <uint8_t> (text [i + 2]))      );
+
+    grams.push_back (gram << 32 | tag);
+  }
+}
+
+// Edit distance between the pattern and the closest substring of the text, which ends at end
+static uint32_t
+SKIF_SearchIndex_GetDistance (std::string_view pattern, std::string_view text, size_t& end)
 {
-  // start from root node
-  Trie* curr = this;
-  for (size_t i = 0; i < key.length (); i++)
+  std::vector <uint32_t> column (pattern.length ( ) + 1);
+
+  for (size_t i = 0; i < column.size ( ); i++)
+    column [i] = static_cast <uint32_t> (i);
+
+  uint32_t best = column.back ( );
+  end           = 0;
+
+  for (size_t j = 0; j < text.length ( ); j++)
   {
-    // create a new node if path doesn't exists
-    if (curr->character [key [i]] == nullptr)
-        curr->character [key [i]]  = new Trie ();
+    // A match can start anywhere in the text, so the first row is always zero
+    uint32_t diagonal = column [0];
+
+    for (size_t i = 1; i < column.size ( ); i++)
+    {
+      uint32_t above = column [i];
+
+      column [i] = std::min ({ column [i    ] + 1,
+                               column [i - 1] + 1,
+                               diagonal + ((pattern [i - 1] == text [j]) ? 0U : 1U) });
+      diagonal   = above;
+    }
 
-    // go to next node
-    curr = curr->character [key [i]];
+    if (column.back ( ) < best)
+    {
+      best = column.back ( );
+      end  = j;
+    }
   }
 
-  // mark current node as leaf
-  curr->isLeaf = true;
+  return best;
 }
 
-// Iterative function to search a key in Trie. It returns true
-// if the key is found in the Trie, else it returns false
-bool
-Trie::search (const std::string& key)
+void
+SKIF_SearchIndex::build (const std::vector <std::pair <std::string, app_record_s> >& apps)
 {
-  Trie* curr = this;
-  for (size_t i = 0; i < key.length (); i++)
+  clear ( );
+
+  m_entries.reserve (apps.size ( ));
+
+  for (uint32_t i = 0; i < static_cast <uint32_t> (apps.size ( )); i++)
   {
-    // go to next node
-    curr = curr->character [key [i]];
+    const std::string& name = apps [i].second.names.all_upper_alnum;
+
+    // Skip invalid/hidden ones
+    if (apps [i].second.id == 0 || name.empty ( ))
+      continue;
+
+    const auto& names = apps [i].second.names;
+
+    entry_s entry;
+    entry.offset      = static_cast <uint32_t> (m_keys.length ( ));
+    entry.length      = static_cast <uint32_t> (name.length ( ));
+    entry.index       = i;
+    entry.text_offset = static_cast <uint32_t> (m_text.length ( ));
+    entry.name_length = static_cast <uint32_t> (names.all_upper.length ( ));
+
+    m_keys.append (name);
 
-    // if string is invalid (reached end of path in Trie)
-    if (curr == nullptr)
-      return false;
+    // Lines never span a newline, so neither do the trigrams or matches
+    m_text.append (names.all_upper);
+
+    if (! names.original.empty ( ))
+    {
+      std::string original = SKIF_Util_FoldCase (names.original);
+
+      if (original != names.all_upper)
+        m_text.append ("\n" + original);
+    }
+
+    // Store IDs; Epic and Xbox apps are identified by name, their numeric ID is only used internally
+    const auto& app = apps [i].second;
+
+    if (app.store == app_record_s::Store::Epic)
+    {
+      for (const std::string* id : { &app.epic.name_app, &app.epic.catalog_item_id })
+        if (! id->empty ( ))
+          m_text.append ("\n" + SKIF_Util_FoldCase (*id));
+    }
+
+    else if (app.store == app_record_s::Store::Xbox)
+    {
+      for (const std::string* id : { &app.xbox.package_name, &app.xbox.store_id })
+        if (! id->empty ( ))
+          m_text.append ("\n" + SKIF_Util_FoldCase (*id));
+    }
+
+    else
+      m_text.append ("\n" + std::to_string (app.id));
+
+    entry.text_length = static_cast <uint32_t> (m_text.length ( )) - entry.text_offset;
+
+    m_entries.push_back (entry);
   }
 
-  // if current node is a leaf and we have reached the
-  // end of the string, return true
-  return curr->isLeaf;
+  // Sorted by name, with ties broken by position in the list
+  std::sort ( m_entries.begin (),
+              m_entries.end   (),
+    [&](const entry_s& a, const entry_s& b) -> bool
+    {
+      int cmp = key (a).compare (key (b));
+      return (cmp != 0) ? (cmp < 0) : (a.index < b.index);
+    }
+  );
+
+  for (uint32_t e = 0; e < static_cast <uint32_t> (m_entries.size ( )); e++)
+    SKIF_SearchIndex_GetTrigrams (text (m_entries [e]), m_grams, static_cast <uint64_t> (e));
+
+  std::sort (m_grams.begin ( ), m_grams.end ( ));
+  m_grams.erase (std::unique (m_grams.begin ( ), m_grams.end ( )), m_grams.end ( ));
+
+  m_generation = SKIF_GamingCollection::SortCounter.load ( );
+  m_built      = true;
+}
+
+void
+SKIF_SearchIndex::clear (void)
+{
+  m_keys.clear    ( );
+  m_text.clear    ( );
+  m_entries.clear ( );
+  m_grams.clear   ( );
+  m_built = false;
 }
 
-// returns true if given node has any children
 bool
-Trie::haveChildren (Trie const* curr)
+SKIF_SearchIndex::find (std::string_view prefix, std::vector <uint32_t>& matches) const
 {
-  for (int i = 0; i < CHAR_SIZE; i++)
-    if (curr->character [i])
-      return true;  // child found
+  matches.clear ( );
+
+  if (prefix.empty ( ))
+    return false;
 
-  return false;
+  // All names beginning with the prefix sort as one contiguous range
+  auto it =
+    std::lower_bound ( m_entries.begin (),
+                       m_entries.end   (), prefix,
+      [&](const entry_s& entry, std::string_view value) -> bool
+      {
+        return key (entry) < value;
+      }
+    );
+
+  for ( ; it != m_entries.end ( ); it++)
+  {
+    std::string_view name = key (*it);
+
+    if (name.substr (0, prefix.length ( )) != prefix)
+      break;
+
+    matches.push_back (it->index);
+  }
+
+  std::sort (matches.begin ( ), matches.end ( ));
+
+  return (! matches.empty ( ));
 }
 
-// Recursive function to delete a key in the Trie
 bool
-Trie::deletion (Trie*& curr, const std::string& key)
+SKIF_SearchIndex::search (std::string_view query, std::vector <match_s>& matches) const
 {
-  // return if Trie is empty
-  if (curr == nullptr)
+  matches.clear ( );
+
+  std::string folded = SKIF_Util_FoldCase (query);
+  SKIF_Util_TrimSpaces (folded);
+
+  if (folded.empty ( ) || folded.find ('\n') != std::string::npos)
     return false;
 
-  // if we have not reached the end of the key
-  if (key.length ())
+  std::vector <uint64_t> grams;
+  SKIF_SearchIndex_GetTrigrams (folded, grams, 0);
+
+  std::sort (grams.begin ( ), grams.end ( ));
+  grams.erase (std::unique (grams.begin ( ), grams.end ( )), grams.end ( ));
+
+  // The entries holding a trigram of the query, in ascending order
+  auto getPostings = [&](uint64_t gram, std::vector <uint32_t>& postings)
+  {
+    postings.clear ( );
+
+    for (auto it  = std::lower_bound (m_grams.begin ( ), m_grams.end ( ), gram);
+              it != m_grams.end ( ) && (*it >> 32) == (gram >> 32);
+              it++)
+      postings.push_back (static_cast <uint32_t> (*it));
+  };
+
+  // Candidates have to hold every trigram of the query; shorter queries are checked against all entries
+  std::vector <uint32_t> candidates,
+                         postings,
+                         intersection;
+
+  if (grams.empty ( ))
+  {
+    candidates.resize (m_entries.size ( ));
+
+    for (uint32_t e = 0; e < static_cast <uint32_t> (candidates.size ( )); e++)
+      candidates [e] = e;
+  }
+
+  else
   {
-    // recur for the node corresponding to next character in the key
-    // and if it returns true, delete current node (if it is non-leaf)
+    getPostings (grams [0], candidates);
 
-    if (        curr                      != nullptr       &&
-                curr->character [key [0]] != nullptr       &&
-      deletion (curr->character [key [0]], key.substr (1)) &&
-                curr->isLeaf == false)
+    for (size_t g = 1; g < grams.size ( ) && ! candidates.empty ( ); g++)
     {
-      if (! haveChildren (curr))
-      {
-        delete curr;
-        curr = nullptr;
-        return true;
-      }
+      getPostings (grams [g], postings);
 
-      else {
-        return false;
-      }
+      intersection.clear ( );
+      std::set_intersection (candidates.begin ( ), candidates.end ( ),
+                             postings.begin   ( ), postings.end   ( ), std::back_inserter (intersection));
+      candidates.swap (intersection);
     }
   }
 
-  // if we have reached the end of the key
-  if (key.length () == 0 && curr->isLeaf)
+  for (uint32_t e : candidates)
   {
-    // if current node is a leaf node and don't have any children
-    if (! haveChildren (curr))
+    const entry_s&   entry = m_entries [e];
+    std::string_view line  = text (entry);
+
+    size_t pos = line.find (folded);
+
+    if (pos == std::string_view::npos)
+      continue;
+
+    match_s match;
+    match.index = entry.index;
+    match.rank  = (pos == 0)                                      ? 0
+                : (line [pos - 1] == ' ' || line [pos - 1] == '\n') ? 1
+                                                                  : 2;
+
+    if (pos + folded.length ( ) <= entry.name_length)
+    {
+      match.pos = static_cast <uint32_t> (pos);
+      match.len = static_cast <uint32_t> (folded.length ( ));
+    }
+
+    matches.push_back (match);
+  }
+
+  // Typo tolerance, for queries long enough to have at least two trigrams
+  if (matches.empty ( ) && grams.size ( ) >= 2)
+  {
+    uint32_t maxEdits  = (folded.length ( ) < 8) ? 1 : 2;
+
+    // A single edit affects at most three trigrams of the query
+    size_t   minShared = (grams.size ( ) > 3 * maxEdits) ? grams.size ( ) - 3 * maxEdits : 1;
+
+    std::vector <uint16_t> shared (m_entries.size ( ), 0);
+
+    for (uint64_t gram : grams)
     {
-      // delete current node
-      delete curr;
-      curr = nullptr;
+      getPostings (gram, postings);
 
-      // delete non-leaf parent nodes
-      return true;
+      for (uint32_t e : postings)
+        shared [e]++;
     }
 
-    // if current node is a leaf node and have children
-    else
+    for (uint32_t e = 0; e < static_cast <uint32_t> (shared.size ( )); e++)
     {
-      // mark current node as non-leaf node (DON'T DELETE IT)
-      curr->isLeaf = false;
+      if (shared [e] < minShared)
+        continue;
 
-      // don't delete its parent nodes
-      return false;
+      const entry_s& entry = m_entries [e];
+
+      size_t   end      = 0;
+      uint32_t distance = SKIF_SearchIndex_GetDistance (folded, text (entry), end);
+
+      if (distance > maxEdits)
+        continue;
+
+      match_s match;
+      match.index = entry.index;
+      match.rank  = 3 + distance;
+
+      if (end < entry.name_length)
+      {
+        match.len = static_cast <uint32_t> (std::min (folded.length ( ), end + 1));
+        match.pos = static_cast <uint32_t> (end + 1) - match.len;
+      }
+
+      matches.push_back (match);
     }
   }
 
-  return false;
+  std::sort ( matches.begin (),
+              matches.end   (),
+    [](const match_s& a, const match_s& b) -> bool
+    {
+      return (a.rank != b.rank) ? (a.rank < b.rank) : (a.index < b.index);
+    }
+  );
+
+  return (! matches.empty ( ));
+}
+
+bool
+SKIF_SearchIndex::current (void) const
+{
+  return m_built && m_generation == SKIF_GamingCollection::SortCounter.load ( );
 }
 
 void
-InsertTrieKey (std::pair <std::string, app_record_s>* app, Trie* labels)
+PrepareSearchNames (std::pair <std::string, app_record_s>* app)
 {
   static SKIF_RegistrySettings& _registry = SKIF_RegistrySettings::GetInstance ( );
 
-  std::string all_upper = SKIF_Util_ToUpper (app->first),
-              all_upper_alnum;
-          
-  for (const char c : app->first)
+  // Folded using the invariant locale so titles in non-Latin scripts can be searched for as well
+  std::string  all_upper = SKIF_Util_FoldCase (app->first);
+  std::wstring all_upper_wide = SK_UTF8ToWideChar (all_upper),
+               all_upper_alnum_wide;
+
+  for (const wchar_t c : all_upper_wide)
   {
-    if (! ( isalnum (c) || isspace (c) ))
+    if (! ( IsCharAlphaNumericW (c) || iswspace (c) ))
       continue;
 
-    all_upper_alnum += (char)toupper (c);
+    all_upper_alnum_wide += c;
   }
 
+  std::string all_upper_alnum = SK_WideCharToUTF8 (all_upper_alnum_wide);
+
   size_t stripped = 0;
 
   if (_registry.bLibraryIgnoreArticles)
@@ -187,15 +408,6 @@ InsertTrieKey (std::pair <std::string, app_record_s>* app, Trie* labels)
     }
   }
 
-  std::string trie_builder;
-
-  for ( const char c : all_upper_alnum)
-  {
-    trie_builder += c;
-
-    labels->insert (trie_builder);
-  }
-        
   app->second.names.normal          = app->first;
   app->second.names.all_upper       = all_upper;
   app->second.names.all_upper_alnum = all_upper_alnum;
@@ -206,8 +418,14 @@ InsertTrieKey (std::pair <std::string, app_record_s>* app, Trie* labels)
 
 
 extern std::recursive_mutex g_apps_mutex;
+extern std::vector <std::pair <std::string, app_record_s>> g_apps;
 
 // This sorts the app vector
+//   -> Sorts small keys referring to the apps instead of the apps themselves,
+//        then moves every app into place once
+//   -> Orders as if the following stable sorts were applied one after another:
+//        name, then used count/last used (if enabled), then pinned state,
+//          and finally category for unpinned entries, with uncategorized ones last
 void
 SKIF_GamingCollection::SortApps (std::vector <std::pair <std::string, app_record_s> > *apps)
 {
@@ -215,98 +433,162 @@ SKIF_GamingCollection::SortApps (std::vector <std::pair <std::string, app_record
 
   static SKIF_RegistrySettings& _registry   = SKIF_RegistrySettings::GetInstance ( );
 
-  // The base sort is by name
-  std::stable_sort ( apps->begin (),
-                     apps->end   (),
-    []( const std::pair <std::string, app_record_s>& a,
-        const std::pair <std::string, app_record_s>& b ) -> int
+  // Invalidates any search index built from the list; only g_apps is ever indexed,
+  //   so sorting a library that has yet to be swapped in leaves the current index alone
+  if (apps == &g_apps)
+    SortCounter++;
+
+  struct sort_key_s {
+    int              pinned   = 0; // Highest value between SKIF's pinned value, or 0 / Steam's pinned value if SKIF's is unset
+    uint32_t         category = 0; // Rank of the category, 0 if pinned (and so not sorted by category), uncategorized last
+    int              uses     = 0;
+    std::string_view used;
+    std::string_view name;
+    uint32_t         index    = 0; // Position before sorting, for stability
+  };
+
+  const uint32_t count = static_cast <uint32_t> (apps->size ( ));
+
+  // Rank the categories in use up front, so comparing two keys never has to compare them as strings
+  std::vector <std::string_view> categories;
+  categories.reserve (count);
+
+  for (const auto& app : *apps)
+    if (! app.second.skif.category.empty ( ))
+      categories.push_back (app.second.skif.category);
+
+  std::sort (categories.begin ( ), categories.end ( ));
+  categories.erase (std::unique (categories.begin ( ), categories.end ( )), categories.end ( ));
+
+  std::vector <sort_key_s> keys (count);
+
+  for (uint32_t i = 0; i < count; i++)
+  {
+    const app_record_s& app = (*apps) [i].second;
+    sort_key_s&         key = keys [i];
+
+    key.pinned = std::max (app.skif.pinned, (app.skif.pinned == -1) ? app.steam.shared.favorite : 0);
+    key.uses   = app.skif.uses;
+    key.used   = app.skif.used;
+    key.name   = app.names.all_upper_alnum;
+    key.index  = i;
+
+    if (key.pinned == 0)
     {
-      return a.second.names.all_upper_alnum.compare(
-             b.second.names.all_upper_alnum
-      ) < 0;
+      key.category = (app.skif.category.empty ( ))
+                   ? static_cast <uint32_t> (categories.size ( )) + 1
+                   : static_cast <uint32_t> (std::lower_bound (categories.begin ( ), categories.end ( ), std::string_view (app.skif.category)) - categories.begin ( )) + 1;
     }
-  );
+  }
 
-  // Then we apply any overarching custom sort
-  switch (_registry.iLibrarySort)
-  {
+  int sortMode = _registry.iLibrarySort;
 
-  case 1: // Sorting by used count
+  if (sortMode == 1)
     PLOG_VERBOSE << "Sorting by used count...";
-    std::stable_sort ( apps->begin (),
-                       apps->end   (),
-      []( const std::pair <std::string, app_record_s>& a,
-          const std::pair <std::string, app_record_s>& b ) -> int
-      {
-        return a.second.skif.uses >
-               b.second.skif.uses;
-      }
-    );
-    break;
-
-  case 2: // Sorting by last used
+  else if (sortMode == 2)
     PLOG_VERBOSE << "Sorting by last used...";
-    std::stable_sort ( apps->begin (),
-                       apps->end   (),
-      []( const std::pair <std::string, app_record_s>& a,
-          const std::pair <std::string, app_record_s>& b ) -> int
+
+  std::sort ( keys.begin (),
+              keys.end   (),
+    [sortMode]( const sort_key_s& a,
+                const sort_key_s& b ) -> bool
+    {
+      // Pinned state
+      if (a.pinned   != b.pinned)
+        return a.pinned   > b.pinned;
+
+      // Category, for unpinned entries
+      if (a.category != b.category)
+        return a.category < b.category;
+
+      // Overarching custom sort
+      if (sortMode == 1 && a.uses != b.uses)
+        return a.uses > b.uses;
+
+      if (sortMode == 2)
       {
-        return a.second.skif.used.compare(
-               b.second.skif.used
-        ) > 0;
+        int cmp = a.used.compare (b.used);
+
+        if (cmp != 0)
+          return cmp > 0;
       }
-    );
-    break;
-  }
 
-  // Now we sort by the pinned state
-  std::stable_sort ( apps->begin (),
-                     apps->end   (),
-    []( const std::pair <std::string, app_record_s>& a,
-        const std::pair <std::string, app_record_s>& b ) -> int
-    {
-      // Use the highest value between SKIF's pinned value, or 0 / Steam's pinned value if SKIF's is unset
-      return std::max (a.second.skif.pinned, (a.second.skif.pinned == -1) ? a.second.steam.shared.favorite : 0) >
-             std::max (b.second.skif.pinned, (b.second.skif.pinned == -1) ? b.second.steam.shared.favorite : 0);
+      // The base sort is by name
+      int cmp = a.name.compare (b.name);
+
+      if (cmp != 0)
+        return cmp < 0;
+
+      return a.index < b.index;
     }
   );
 
-  // We need an iterator at the unpinned entries to sort the rest separately
-  auto   it  = apps->begin ();
-  while (it != apps->end   ())
+  // Apply the permutation, moving every app once
+  std::vector <std::pair <std::string, app_record_s> > sorted;
+  sorted.reserve (count);
+
+  for (const auto& key : keys)
+    sorted.push_back (std::move ((*apps) [key.index]));
+
+  apps->swap (sorted);
+}
+
+
+
+
+#pragma region RefreshRunningApps
+
+// Maps executables to their position in the apps vector, so each process
+//   costs a hash lookup rather than a pass over every app
+struct SKIF_RunningAppsIndex {
+  uint32_t generation = 0;
+  uint32_t sort_count = 0;
+
+  std::unordered_map <std::wstring, std::vector <size_t>> paths; // Full path of launch config 0
+  std::unordered_map <std::wstring, std::vector <size_t>> names; // Executable name (Xbox only)
+
+  // Rebuilt whenever the list is repopulated, patched or sorted, or an app has its launch configs
+  //   rebuilt, as tracked by AppsGeneration and SortCounter rather than by rehashing every path
+  void
+  update (std::vector <std::pair <std::string, app_record_s> > *apps)
   {
-    auto& item = *it;
-    if (std::max (item.second.skif.pinned, (item.second.skif.pinned == -1) ? item.second.steam.shared.favorite : 0) == 0)
-      break;
+    const uint32_t current_generation = SKIF_GamingCollection::AppsGeneration.load ( ),
+                   current_sort_count = SKIF_GamingCollection::SortCounter   .load ( );
 
-    it++;
-  }
+    if (current_generation == generation &&
+        current_sort_count == sort_count && ! (paths.empty () && names.empty ()))
+      return;
 
-  // Then sort unpinned entires by category
-  std::stable_sort ( it,
-                     apps->end   (),
-    []( const std::pair <std::string, app_record_s>& a,
-        const std::pair <std::string, app_record_s>& b ) -> int
-    {
-      return a.second.skif.category.compare(
-             b.second.skif.category) < 0;
-    }
-  );
+    generation = current_generation;
+    sort_count = current_sort_count;
 
-  // And move all uncategorized entries last
-  std::stable_partition ( it,
-                          apps->end   (),
-    []( const std::pair <std::string, app_record_s>& a ) -> bool
+    paths.clear ();
+    names.clear ();
+
+    for (size_t idx = 0; idx < apps->size (); ++idx)
     {
-      return ! a.second.skif.category.empty();
-    }
-  );
-}
+      auto& app = (*apps)[idx].second;
+      auto  lc0 = app.launch_configs.find (0);
 
+      if (lc0 == app.launch_configs.end ())
+        continue;
+
+      if (app.store == app_record_s::Store::Xbox)
+      {
+        const std::wstring& exe =
+          lc0->second.getExecutableFileName ( );
 
+        names [SKIF_ProcessTracker::Fold (exe.c_str (), exe.length ())].push_back (idx);
+      }
 
+      const std::wstring& path =
+        lc0->second.executable_path;
 
-#pragma region RefreshRunningApps
+      if (! path.empty ())
+        paths [SKIF_ProcessTracker::Fold (path.c_str (), path.length ())].push_back (idx);
+    }
+  }
+};
 
 void
 SKIF_GamingCollection::RefreshRunningApps (std::vector <std::pair <std::string, app_record_s> > *apps, bool forced)
@@ -332,6 +614,10 @@ SKIF_GamingCollection::RefreshRunningApps (std::vector <std::pair <std::string,
   {
     std::scoped_lock app_lock (g_apps_mutex);
 
+    // Only rebuilt when the list of apps or their primary executables change
+    static SKIF_RunningAppsIndex index;
+                                 index.update (apps);
+
     if (! forced)
       last_checked = current_time;
 
@@ -359,140 +645,114 @@ SKIF_GamingCollection::RefreshRunningApps (std::vector <std::pair <std::string,
       app.second._staging.running = false;
     }
 
-    PROCESSENTRY32W none = { },
-                    pe32 = { };
-
-    SK_AutoHandle hProcessSnap (
-      CreateToolhelp32Snapshot (TH32CS_SNAPPROCESS, 0)
-    );
+    // Only processes that were not seen before are opened and resolved
+    static SKIF_ProcessTracker& _tracker = SKIF_ProcessTracker::GetInstance ( );
+                                _tracker.Refresh ( );
 
-    if ((intptr_t)hProcessSnap.m_h > 0)
+    for (auto& process : _tracker.GetProcesses ( ))
     {
-      pe32.dwSize = sizeof (PROCESSENTRY32W);
-      std::wstring exeFileLast, exeFileNew;
+      if (! process->accessible)
+        continue;
 
-      if (Process32FirstW (hProcessSnap, &pe32))
+      // Recognize that the Steam client is running
+      if (_wcsnicmp (process->name.c_str(), exeSteam.c_str(), exeSteam.length()) == 0)
       {
-        do
-        {
-          SetLastError (NO_ERROR);
-          CHandle hProcess (OpenProcess (PROCESS_QUERY_LIMITED_INFORMATION, FALSE, pe32.th32ProcessID));
-          // Use PROCESS_QUERY_LIMITED_INFORMATION since that allows us to retrieve exit code/full process name for elevated processes
-
-          if (hProcess == nullptr)
-            continue;
-
-          exeFileNew = pe32.szExeFile;
+        new_steamRunning = true;
+        continue;
+      }
 
-          // Skip duplicate processes
-          // NOTE: Potential bug is that Epic, GOG and SKIF Custom games with two running and identically named executables (launcher + game) may not be detected as such
-          if (exeFileLast == exeFileNew)
-            continue;
+      // Candidates by executable name (Xbox) and full path, merged back into list order
+      //   so the first matching app still wins, just like a pass over the whole list
+      static std::vector <std::pair <size_t, bool>> candidates; // app index, matched by name
+                                                    candidates.clear ();
 
-          exeFileLast = exeFileNew;
+      if (auto name = index.names.find (process->name_folded);
+               name != index.names.end ())
+      {
+        for (size_t idx : name->second)
+          candidates.emplace_back (idx, true);
+      }
 
-          // Recognize that the Steam client is running
-          if (_wcsnicmp (exeFileLast.c_str(), exeSteam.c_str(), exeSteam.length()) == 0)
-          {
-            new_steamRunning = true;
-            continue;
-          }
+      if (! process->path_folded.empty ())
+      {
+        if (auto path = index.paths.find (process->path_folded);
+                 path != index.paths.end ())
+        {
+          for (size_t idx : path->second)
+            candidates.emplace_back (idx, false);
+        }
+      }
 
-          bool accessDenied =
-            GetLastError ( ) == ERROR_ACCESS_DENIED;
+      if (candidates.size () > 1)
+        std::sort (candidates.begin (), candidates.end ());
 
-          // Get exit code to filter out zombie processes
-          DWORD dwExitCode = 0;
-          GetExitCodeProcess (hProcess, &dwExitCode);
-          
-          WCHAR szExePath     [MAX_PATH + 2] = { };
-          DWORD szExePathLen = MAX_PATH + 2; // Specifies the size of the lpExeName buffer, in characters.
+      for (auto& candidate : candidates)
+      {
+        auto& app = (*apps)[candidate.first];
 
-          if (! accessDenied)
-          {
-            // If the process is not active any longer, skip it (terminated or zombie process)
-            if (dwExitCode != STILL_ACTIVE)
-              continue;
+        if (app.second._status.dwTimeDelayChecks > current_time && (! forced))
+          continue;
 
-            // See if we can retrieve the full path of the executable
-            if (! QueryFullProcessImageName (hProcess, 0, szExePath, &szExePathLen))
-              szExePathLen = 0;
-          }
+        // Workaround for Xbox games that run under the virtual folder, e.g. H:\Games\Xbox Games\Hades\Content\Hades.exe, by only checking the presence of the process name
+        // TODO: Investigate if this is even really needed any longer? // Aemony, 2023-12-31
+        if (candidate.second)
+        {
+          app.second._staging.running     = true;
+          app.second._staging.running_pid = process->pid;
+          break;
+        }
 
-          for (auto& app : *apps)
+        else
+        {
+          if (app.second.store == app_record_s::Store::Steam)
           {
-            if (app.second._status.dwTimeDelayChecks > current_time && (! forced))
-              continue;
+            app.second._staging.running_pid = process->pid;
 
-            if (! app.second.launch_configs.contains (0))
+            // Only set the running state if the primary registry monitoring is unavailable
+            if (! steamFallback)
               continue;
 
-            // Workaround for Xbox games that run under the virtual folder, e.g. H:\Games\Xbox Games\Hades\Content\Hades.exe, by only checking the presence of the process name
-            // TODO: Investigate if this is even really needed any longer? // Aemony, 2023-12-31
-            if (app.second.store == app_record_s::Store::Xbox && StrStrIW (app.second.launch_configs[0].getExecutableFileName ( ).c_str(), pe32.szExeFile))
-            {
-              app.second._staging.running     = true;
-              app.second._staging.running_pid = pe32.th32ProcessID;
-              break;
-            }
-
-            else if (szExePathLen != 0)
-            {
-              if (app.second.store == app_record_s::Store::Steam)
-              {
-                if (_wcsnicmp (app.second.launch_configs[0].getExecutableFullPath ( ).c_str(), szExePath, szExePathLen) == 0)
-                {
-                  app.second._staging.running_pid = pe32.th32ProcessID;
-
-                  // Only set the running state if the primary registry monitoring is unavailable
-                  if (! steamFallback)
-                    continue;
-
-                  app.second._staging.running     = true;
-                  break;
-                }
-              }
-
-              // Epic, GOG and SKIF Custom should be straight forward
-              else if (_wcsnicmp (app.second.launch_configs[0].getExecutableFullPath ( ).c_str(), szExePath, szExePathLen) == 0) // full path
-              {
-                app.second._staging.running     = true;
-                app.second._staging.running_pid = pe32.th32ProcessID;
-                break;
-
-                // One can also perform a partial match with the below OR clause in the IF statement, however from testing
-                //   PROCESS_QUERY_LIMITED_INFORMATION gives us GetExitCodeProcess() and QueryFullProcessImageName() rights
-                //     even to elevated processes, meaning the below OR clause is unnecessary.
-                // 
-                // (fullPath.empty() && ! wcscmp (pe32.szExeFile, app.second.launch_configs[0].executable.c_str()))
-                //
-              }
-            }
+            app.second._staging.running     = true;
+            break;
           }
 
-          if (! _registry.bWarningRTSS        &&
-              ! SKIF_ImGui_IsAnyPopupOpen ( ) &&
-              ! wcscmp (pe32.szExeFile, L"RTSS.exe"))
+          // Epic, GOG and SKIF Custom should be straight forward
+          else // full path, already matched through the index
           {
-            _registry.bWarningRTSS = true;
-            _registry.regKVWarningRTSS.putData (_registry.bWarningRTSS);
-
-            constexpr char* error_title =
-              "One-time warning about RTSS.exe";
-            constexpr char* error_label =
-              "RivaTuner Statistics Server (RTSS) occasionally conflicts with Special K.\n"
-              "Try closing it down if Special K does not behave as expected, or enable\n"
-              "the option 'Use Microsoft Detours API hooking' in the settings of RTSS.\n"
-              "\n"
-              "If you use MSI Afterburner, try closing it as well as otherwise it will\n"
-              "automatically restart RTSS silently in the background.\n"
-              "\n"
-              "This warning will not appear again.";
-            
-            SKIF_ImGui_InfoMessage (error_title, error_label);
+            app.second._staging.running     = true;
+            app.second._staging.running_pid = process->pid;
+            break;
+
+            // One can also perform a partial match with the below OR clause in the IF statement, however from testing
+            //   PROCESS_QUERY_LIMITED_INFORMATION gives us GetExitCodeProcess() and QueryFullProcessImageName() rights
+            //     even to elevated processes, meaning the below OR clause is unnecessary.
+            // 
+            // (fullPath.empty() && ! wcscmp (pe32.szExeFile, app.second.launch_configs[0].executable.c_str()))
+            //
           }
+        }
+      }
 
-        } while (Process32NextW (hProcessSnap, &pe32));
+      if (! _registry.bWarningRTSS        &&
+          ! SKIF_ImGui_IsAnyPopupOpen ( ) &&
+          ! wcscmp (process->name.c_str(), L"RTSS.exe"))
+      {
+        _registry.bWarningRTSS = true;
+        _registry.regKVWarningRTSS.putData (_registry.bWarningRTSS);
+
+        constexpr char* error_title =
+          "One-time warning about RTSS.exe";
+        constexpr char* error_label =
+          "RivaTuner Statistics Server (RTSS) occasionally conflicts with Special K.\n"
+          "Try closing it down if Special K does not behave as expected, or enable\n"
+          "the option 'Use Microsoft Detours API hooking' in the settings of RTSS.\n"
+          "\n"
+          "If you use MSI Afterburner, try closing it as well as otherwise it will\n"
+          "automatically restart RTSS silently in the background.\n"
+          "\n"
+          "This warning will not appear again.";
+        
+        SKIF_ImGui_InfoMessage (error_title, error_label);
       }
     }
 
@@ -0,0 +1,231 @@
+//
+// Copyright 2020 Andon "Kaldaien" Coleman
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+//
+
+#include <utility/process_tracker.h>
+#include <utility/sk_utility.h>
+#include <utility/utility.h>
+#include <tlhelp32.h>
+#include <cwctype>
+
+#pragma region SKIF_ProcessSource_Win32
+
+bool
+SKIF_ProcessSource_Win32::enumerate (std::vector <entry_s>& entries)
+{
+  entries.clear ();
+
+  SK_AutoHandle hProcessSnap (
+    CreateToolhelp32Snapshot (TH32CS_SNAPPROCESS, 0)
+  );
+
+  if ((intptr_t)hProcessSnap.m_h <= 0)
+    return false;
+
+  PROCESSENTRY32W pe32 = { };
+  pe32.dwSize = sizeof (PROCESSENTRY32W);
+
+  if (! Process32FirstW (hProcessSnap, &pe32))
+    return false;
+
+  do
+  {
+    entries.push_back ({ pe32.th32ProcessID, pe32.th32ParentProcessID, pe32.szExeFile });
+  } while (Process32NextW (hProcessSnap, &pe32));
+
+  return true;
+}
+
+bool
+SKIF_ProcessSource_Win32::identify (DWORD pid, uint64_t& creation_time, bool& terminated)
+{
+  // Use PROCESS_QUERY_LIMITED_INFORMATION since that allows us to retrieve exit code/full process name for elevated processes
+  SK_AutoHandle hProcess (
+    OpenProcess (PROCESS_QUERY_LIMITED_INFORMATION, FALSE, pid)
+  );
+
+  if (! hProcess.isValid ( ))
+    return false;
+
+  // Get exit code to filter out zombie processes
+  DWORD dwExitCode = 0;
+  GetExitCodeProcess (hProcess, &dwExitCode);
+
+  terminated    = (dwExitCode != STILL_ACTIVE);
+  creation_time = 0;
+
+  FILETIME ftCreation, ftExit, ftKernel, ftUser;
+
+  if (GetProcessTimes (hProcess, &ftCreation, &ftExit, &ftKernel, &ftUser))
+    creation_time = (static_cast <uint64_t> (ftCreation.dwHighDateTime) << 32) | ftCreation.dwLowDateTime;
+
+  return true;
+}
+
+void
+SKIF_ProcessSource_Win32::resolve (SKIF_ProcessInfo& process)
+{
+  SK_AutoHandle hProcess (
+    OpenProcess (PROCESS_QUERY_LIMITED_INFORMATION, FALSE, process.pid)
+  );
+
+  if (! hProcess.isValid ( ))
+    return;
+
+  WCHAR szExePath     [MAX_PATH + 2] = { };
+  DWORD szExePathLen = MAX_PATH + 2; // Specifies the size of the lpExeName buffer, in characters.
+
+  // See if we can retrieve the full path of the executable
+  if (QueryFullProcessImageName (hProcess, 0, szExePath, &szExePathLen))
+    process.path.assign (szExePath, szExePathLen);
+
+  process.x86 = SKIF_Util_IsProcessX86 (hProcess);
+}
+
+#pragma endregion
+
+
+#pragma region SKIF_ProcessTracker
+
+SKIF_ProcessTracker::SKIF_ProcessTracker (std::unique_ptr <SKIF_ProcessSource> source) : m_source (std::move (source))
+{ }
+
+std::wstring
+SKIF_ProcessTracker::Fold (const wchar_t* wszStr, size_t len)
+{
+  std::wstring folded (wszStr, len);
+
+  // Case-folded and slash-normalized, so lookups match _wcsnicmp semantics
+  for (auto& ch : folded)
+    ch = (ch == L'/') ? L'\\' : (wchar_t)std::towlower (ch);
+
+  return folded;
+}
+
+void
+SKIF_ProcessTracker::Refresh (DWORD max_age)
+{
+  std::scoped_lock lock (m_mutex);
+
+  DWORD current_time = SKIF_Util_timeGetTime1 ( );
+
+  if (m_bRefreshed && max_age != 0 && current_time - m_dwLastRefresh < max_age)
+    return;
+
+  if (! m_source->enumerate (m_entries))
+  {
+    PLOG_ERROR << "Failed to enumerate running processes!";
+    return;
+  }
+
+  m_bRefreshed    = true;
+  m_dwLastRefresh = current_time;
+
+  uint32_t generation = ++m_generation;
+
+  m_running.clear ();
+
+  for (auto& entry : m_entries)
+  {
+    uint64_t creation_time = 0;
+    bool     terminated    = false;
+
+    // Only a short-lived handle is used, so PID reuse is told apart by the creation time
+    if (! m_source->identify (entry.pid, creation_time, terminated))
+    {
+      // Not accessible, so nothing beyond the snapshot is known; it is tried again on the next refresh
+      auto process =
+        std::make_shared <SKIF_ProcessInfo> ( );
+
+      process->pid         = entry.pid;
+      process->parent_pid  = entry.parent_pid;
+      process->name        = entry.name;
+      process->name_folded = Fold (process->name.c_str (), process->name.length ());
+
+      m_running.push_back (process);
+      continue;
+    }
+
+    // Zombies are left out, and forgotten about once they are no longer tracked
+    if (terminated)
+      continue;
+
+    auto tracked =
+      m_processes.find (entry.pid);
+
+    if (tracked != m_processes.end ())
+    {
+      const SKIF_ProcessInfoPtr& known =
+        tracked->second.process;
+
+      // Same process as before
+      if (known->creation_time == creation_time && known->name == entry.name)
+      {
+        tracked->second.generation = generation;
+
+        m_running.push_back (known);
+        continue;
+      }
+
+      // The PID has been reused
+      m_processes.erase (tracked);
+    }
+
+    // Newly seen process, the only time its path and architecture are queried
+    auto process =
+      std::make_shared <SKIF_ProcessInfo> ( );
+
+    process->pid           = entry.pid;
+    process->parent_pid    = entry.parent_pid;
+    process->name          = entry.name;
+    process->creation_time = creation_time;
+    process->accessible    = true;
+
+    m_source->resolve (*process);
+
+    process->name_folded = Fold (process->name.c_str (), process->name.length ());
+    process->path_folded = Fold (process->path.c_str (), process->path.length ());
+
+    m_processes.emplace (entry.pid, tracked_s { process, generation });
+    m_running.push_back (process);
+  }
+
+  // Drop everything that was not part of this snapshot
+  for (auto tracked  = m_processes.begin ( );
+            tracked != m_processes.end   ( ); )
+  {
+    if (tracked->second.generation != generation)
+      tracked = m_processes.erase (tracked);
+
+    else
+      ++tracked;
+  }
+}
+
+std::vector <SKIF_ProcessInfoPtr>
+SKIF_ProcessTracker::GetProcesses (void)
+{
+  std::scoped_lock lock (m_mutex);
+
+  return m_running;
+}
+
+#pragma endregion
@@ -0,0 +1,207 @@
+//
+// Copyright 2020 Andon "Kaldaien" Coleman
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+//
+
+#include <utility/task_scheduler.h>
+#include <algorithm>
+#include <iterator>
+
+SKIF_TaskScheduler::SKIF_TaskScheduler (size_t threads, std::function <void (void)> thread_init)
+{
+  threads = std::max (threads, static_cast <size_t> (1));
+
+  // The first worker is kept free for interactive work, so background work can never hold it up
+  for (size_t i = 0; i < threads; i++)
+    _threads.emplace_back (&SKIF_TaskScheduler::worker, this, (i == 0 && threads > 1), thread_init);
+}
+
+SKIF_TaskScheduler::~SKIF_TaskScheduler (void)
+{
+  {
+    std::scoped_lock lock (_lock);
+    _stopping.store (true);
+  }
+
+  _signal.notify_all ( );
+
+  for (auto& thread : _threads)
+    thread.join ( );
+}
+
+void
+SKIF_TaskScheduler::submit (SKIF_TaskPriority priority, SKIF_TaskGroup group, task_fn task)
+{
+  {
+    std::scoped_lock lock (_lock);
+
+    _queues [static_cast <int> (priority)].push_back ({ std::move (task), group, _generations [group].load ( ) });
+  }
+
+  // Not every worker takes every task, so waking a single one might wake the wrong one
+  _signal.notify_all ( );
+}
+
+void
+SKIF_TaskScheduler::cancel (SKIF_TaskGroup group)
+{
+  if (group == SKIF_TaskGroup_None)
+    return;
+
+  {
+    std::scoped_lock lock (_lock);
+
+    _generations [group]++;
+
+    // Hand the cancelled tasks out first so they can release their resources right away
+    std::deque <task_s> cancelled;
+
+    for (auto& queue : _queues)
+    {
+      auto it = std::stable_partition (queue.begin ( ), queue.end ( ),
+        [group](const task_s& task) -> bool
+        {
+          return task.group != group;
+        }
+      );
+
+      std::move (it, queue.end ( ), std::back_inserter (cancelled));
+      queue.erase (it, queue.end ( ));
+    }
+
+    _queues [static_cast <int> (SKIF_TaskPriority::Interactive)].insert (
+      _queues [static_cast <int> (SKIF_TaskPriority::Interactive)].begin ( ),
+        std::make_move_iterator (cancelled.begin ( )),
+        std::make_move_iterator (cancelled.end   ( ))
+    );
+  }
+
+  _signal.notify_all ( );
+}
+
+size_t
+SKIF_TaskScheduler::pending (void) const
+{
+  std::scoped_lock lock (_lock);
+
+  return _queues [0].size ( ) + _queues [1].size ( );
+}
+
+void
+SKIF_TaskScheduler::worker (bool interactive_only, std::function <void (void)> thread_init)
+{
+  if (thread_init)
+    thread_init ( );
+
+  while (true)
+  {
+    task_s task;
+
+    {
+      std::unique_lock lock (_lock);
+
+      _signal.wait (lock, [&]
+      {
+        return _stopping.load ( ) || ! _queues [0].empty ( ) || (! interactive_only && ! _queues [1].empty ( ));
+      });
+
+      auto& queue = (! _queues [0].empty ( ) || interactive_only) ? _queues [0] : _queues [1];
+
+      // Only stop once everything queued has been handed out
+      if (queue.empty ( ))
+        return;
+
+      task = std::move (queue.front ( ));
+      queue.pop_front ( );
+    }
+
+    SKIF_TaskToken token (_generations [task.group], task.generation, _stopping);
+
+    task.fn (token);
+  }
+}
+
+#ifdef _WIN32
+
+#include <Windows.h>
+#include <objbase.h>
+#include <utility/utility.h>
+
+SKIF_TaskScheduler&
+SKIF_TaskScheduler::GetInstance (void)
+{
+  // Never destroyed, as the workers might be stuck on a download while the process exits
+  static SKIF_TaskScheduler* instance =
+    new SKIF_TaskScheduler (std::clamp (std::thread::hardware_concurrency ( ) / 2, 2U, 4U), []
+    {
+      SKIF_Util_SetThreadDescription (GetCurrentThread (), L"SKIF_TaskWorker");
+
+      CoInitializeEx (nullptr, 0x0);
+    });
+
+  return *instance;
+}
+
+void*
+SKIF_Util_QueueTask (SKIF_TaskPriority priority, SKIF_TaskGroup group, SKIF_TaskScheduler::task_fn task)
+{
+  HANDLE hDone =
+    CreateEvent (nullptr, TRUE, FALSE, nullptr);
+
+  if (hDone == NULL)
+    return NULL;
+
+  // The task gets its own handle, as the caller is free to close theirs at any time
+  HANDLE hSignal = NULL;
+  if (! DuplicateHandle (GetCurrentProcess ( ), hDone, GetCurrentProcess ( ), &hSignal, 0, FALSE, DUPLICATE_SAME_ACCESS))
+  {
+    CloseHandle (hDone);
+    return NULL;
+  }
+
+  SKIF_TaskScheduler::GetInstance ( ).submit (priority, group,
+    [priority, hSignal, task = std::move (task)](const SKIF_TaskToken& token)
+    {
+      bool background = (priority == SKIF_TaskPriority::Background);
+
+      if (background)
+      {
+        SKIF_Util_SetThreadPowerThrottling (GetCurrentThread (), 1); // Enable EcoQoS for this thread
+        SetThreadPriority                  (GetCurrentThread (), THREAD_MODE_BACKGROUND_BEGIN);
+      }
+
+      task (token);
+
+      // The thread is reused, so restore its defaults
+      if (background)
+      {
+        SetThreadPriority                  (GetCurrentThread (), THREAD_MODE_BACKGROUND_END);
+        SKIF_Util_SetThreadPowerThrottling (GetCurrentThread (), -1); // Let the system decide
+      }
+
+      SetEvent    (hSignal);
+      CloseHandle (hSignal);
+    }
+  );
+
+  return hDone;
+}
+
+#endif
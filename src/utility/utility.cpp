@@ -27,6 +27,7 @@
 #include <utility/fsutil.h>
 #include <utility/registry.h>
 #include <utility/injection.h>
+#include <utility/task_scheduler.h>
 #include <HybridDetect.h>
 
 std::vector<HANDLE> vWatchHandles[UITab_ALL];
@@ -119,6 +120,18 @@ SKIF_Util_ToUpperW     (std::wstring_view input)
   return copy;
 }
 
+// Upper case using the invariant locale, so it also covers non-Latin scripts (unlike SKIF_Util_ToUpper)
+std::string
+SKIF_Util_FoldCase     (std::string_view input)
+{
+  std::wstring wide = SK_UTF8ToWideChar (std::string (input));
+
+  if (! wide.empty ())
+    LCMapStringEx (LOCALE_NAME_INVARIANT, LCMAP_UPPERCASE, wide.data(), static_cast <int> (wide.length()), wide.data(), static_cast <int> (wide.length()), nullptr, nullptr, 0);
+
+  return SK_WideCharToUTF8 (wide);
+}
+
 void
 SKIF_Util_CleanString (std::string& input)
 {
@@ -1723,6 +1736,29 @@ SKIF_Util_SetThreadDescription (HANDLE hThread, PCWSTR lpThreadDescription)
   return SKIF_SetThreadDescription (hThread, lpThreadDescription);
 }
 
+// Waits for a task and logs anything it threw, so a failed task is never dropped silently
+//   -> Returns false if the task failed
+bool
+SKIF_Util_JoinTask (std::future <void>& task, const std::string& description)
+{
+  try {
+    task.get ( );
+    return true;
+  }
+
+  catch (const std::exception& e)
+  {
+    PLOG_ERROR << description << " failed: " << e.what ( );
+  }
+
+  catch (...)
+  {
+    PLOG_ERROR << description << " failed due to an unknown error.";
+  }
+
+  return false;
+}
+
 BOOL
 WINAPI
 SKIF_Util_SetThreadSelectedCpuSets (HANDLE hThread, const ULONG* CpuSetIds, ULONG CpuSetIdCount)
@@ -2778,22 +2814,10 @@ SKIF_Util_AddEnvironmentBlock (const void* pEnvBlock, const std::wstring& varNam
 void
 SKIF_Util_FileExplorer_SelectFile (PCWSTR filePath)
 {
-  struct thread_s {
-    std::wstring path = L"";
-  };
-  
-  thread_s* data = new thread_s;
-  data->path = filePath;
-
+  // The task workers have already been initialized for COM
   HANDLE hWorkerThread = (HANDLE)
-  _beginthreadex (nullptr, 0x0, [](void* var) -> unsigned
+  SKIF_Util_QueueTask (SKIF_TaskPriority::Interactive, SKIF_TaskGroup_None, [path = std::wstring (filePath)](const SKIF_TaskToken&)
   {
-    CoInitialize (NULL);
-
-    SKIF_Util_SetThreadDescription (GetCurrentThread (), L"Worker_SelectFile");
-
-    thread_s* _data = static_cast<thread_s*>(var);
-
     // PIDLIST_ABSOLUTE: The ITEMIDLIST is absolute and has been allocated, as indicated by its being non-constant.
     // This means that it needs to be deallocated with ILFree when it is no longer needed.
     // Because it is a direct pointer to allocated memory, it is aligned.
@@ -2802,10 +2826,10 @@ SKIF_Util_FileExplorer_SelectFile (PCWSTR filePath)
     // Unused
     SFGAOF           flags   = 0;
 
-    if (PathFileExists (_data->path.c_str()))
+    if (PathFileExists (path.c_str()))
     {
       // You should call this function from a background thread. Failure to do so could cause the UI to stop responding.
-      if (S_OK == SHParseDisplayName (_data->path.c_str(), nullptr, &iidlPtr, 0, &flags))
+      if (S_OK == SHParseDisplayName (path.c_str(), nullptr, &iidlPtr, 0, &flags))
       {
         // CoInitialize or CoInitializeEx must be called before using SHOpenFolderAndSelectItems.
         // Not doing so causes SHOpenFolderAndSelectItems to fail.
@@ -2818,21 +2842,12 @@ SKIF_Util_FileExplorer_SelectFile (PCWSTR filePath)
     }
 
     else {
-      SKIF_Util_ExplorePath (std::filesystem::path(_data->path).parent_path().wstring());
+      SKIF_Util_ExplorePath (std::filesystem::path(path).parent_path().wstring());
     }
-
-    // Free up the memory we allocated
-    delete _data;
-
-    CoUninitialize ( );
-
-    return 0;
-  }, data, 0x0, nullptr);
+  });
 
   if (hWorkerThread != NULL) // We don't care about how it goes so the handle is unneeded
     CloseHandle (hWorkerThread);
-  else // Someting went wrong during thread creation, so free up the memory we allocated earlier
-    delete data;
 }
 
 bool
@@ -4158,6 +4173,34 @@ SKIF_Util_URLEncode (const std::wstring & url)
 
 // Directory Watch
 
+// Adds the handle to the wait objects of the tab, so the main loop wakes up when it is signaled
+static void
+SKIF_Util_AddWaitHandle (HANDLE hWait, UITab waitTab)
+{
+  if (waitTab == UITab_ALL)
+  {
+    for (auto& vWatchHandle : vWatchHandles)
+      vWatchHandle.push_back (hWait);
+  }
+  else if (waitTab != UITab_None)
+    vWatchHandles[waitTab].push_back (hWait);
+}
+
+static void
+SKIF_Util_RemoveWaitHandle (HANDLE hWait, UITab waitTab)
+{
+  if (waitTab == UITab_ALL)
+  {
+    for (auto& vWatchHandle : vWatchHandles)
+    {
+      if (! vWatchHandle.empty())
+        vWatchHandle.erase(std::remove(vWatchHandle.begin(), vWatchHandle.end(), hWait), vWatchHandle.end());
+    }
+  }
+  else if (waitTab != UITab_None && ! vWatchHandles[waitTab].empty())
+    vWatchHandles[waitTab].erase(std::remove(vWatchHandles[waitTab].begin(), vWatchHandles[waitTab].end(), hWait), vWatchHandles[waitTab].end());
+}
+
 SKIF_DirectoryWatch::SKIF_DirectoryWatch (std::wstring_view wstrPath, UITab waitTab, BOOL bWatchSubtree, DWORD dwNotifyFilter)
 {
   registerNotify (wstrPath, waitTab, bWatchSubtree, dwNotifyFilter);
@@ -4205,17 +4248,7 @@ SKIF_DirectoryWatch::reset (void)
   if (      _hChangeNotification != INVALID_HANDLE_VALUE)
     FindCloseChangeNotification (_hChangeNotification);
 
-
-  if (_waitTab == UITab_ALL)
-  {
-    for (auto& vWatchHandle : vWatchHandles)
-    {
-      if (! vWatchHandle.empty())
-        vWatchHandle.erase(std::remove(vWatchHandle.begin(), vWatchHandle.end(), _hChangeNotification), vWatchHandle.end());
-    }
-  }
-  else if (_waitTab != UITab_None && ! vWatchHandles[_waitTab].empty())
-    vWatchHandles[_waitTab].erase(std::remove(vWatchHandles[_waitTab].begin(), vWatchHandles[_waitTab].end(), _hChangeNotification), vWatchHandles[_waitTab].end());
+  SKIF_Util_RemoveWaitHandle (_hChangeNotification, _waitTab);
 
   // Reset variables
   _hChangeNotification = INVALID_HANDLE_VALUE;
@@ -4244,13 +4277,7 @@ SKIF_DirectoryWatch::registerNotify (std::wstring_view wstrPath, UITab waitTab,
 
       _waitTab  = waitTab;
 
-      if (_waitTab == UITab_ALL)
-      {
-        for (auto& vWatchHandle : vWatchHandles)
-          vWatchHandle.push_back (_hChangeNotification);
-      }
-      else if (_waitTab != UITab_None)
-        vWatchHandles[_waitTab].push_back (_hChangeNotification);
+      SKIF_Util_AddWaitHandle (_hChangeNotification, _waitTab);
     }
   }
 
@@ -4265,6 +4292,386 @@ SKIF_DirectoryWatch::~SKIF_DirectoryWatch (void)
 }
 
 
+// Directory Change Watch
+
+// Case-folded, so lookups match the _wcsicmp semantics file names are compared with
+static std::wstring
+SKIF_DirectoryChange_Fold (const std::wstring& path)
+{
+  std::wstring folded (path);
+
+  for (auto& ch : folded)
+    ch = (wchar_t)std::towlower (ch);
+
+  return folded;
+}
+
+bool
+SKIF_DirectoryChangeWatch::isSignaled (std::wstring_view wstrPath, UITab waitTab, BOOL bWatchSubtree, DWORD dwNotifyFilter, DWORD dwSettleTime)
+{
+  if (_hDirectory == INVALID_HANDLE_VALUE)
+  {
+    if (! wstrPath.empty())
+      registerNotify (wstrPath, waitTab, bWatchSubtree, dwNotifyFilter);
+
+    return false;
+  }
+
+  readChanges ( );
+
+  if (_overflowed)
+    return true;
+
+  return (! _pending_index.empty() && _lastChange + dwSettleTime <= SKIF_Util_timeGetTime ( ));
+}
+
+std::vector <SKIF_DirectoryChange>
+SKIF_DirectoryChangeWatch::getChanges (bool* overflowed)
+{
+  if (overflowed != nullptr)
+     *overflowed  = _overflowed;
+
+  _overflowed = false;
+
+  std::vector <SKIF_DirectoryChange> changes;
+  changes.swap (_pending);
+  _pending_index.clear ( );
+
+  changes.erase (
+    std::remove_if (changes.begin(), changes.end(), [](const SKIF_DirectoryChange& change) { return change.path.empty(); }),
+    changes.end()
+  );
+
+  return changes;
+}
+
+void
+SKIF_DirectoryChangeWatch::reset (void)
+{
+  if (_hDirectory != INVALID_HANDLE_VALUE)
+  {
+    // The buffer must not be released while the system might still write to it
+    DWORD dwBytes = 0;
+    if (CancelIoEx (_hDirectory, &_overlapped))
+      GetOverlappedResult (_hDirectory, &_overlapped, &dwBytes, TRUE);
+
+    CloseHandle (_hDirectory);
+  }
+
+  if (_overlapped.hEvent != NULL)
+  {
+    SKIF_Util_RemoveWaitHandle (_overlapped.hEvent, _waitTab);
+    CloseHandle                (_overlapped.hEvent);
+  }
+
+  // Reset variables
+  _hDirectory  = INVALID_HANDLE_VALUE;
+  _overlapped  = { };
+  _waitTab     = UITab_None;
+  _path        = L"";
+  _lastChange  = 0;
+  _overflowed  = false;
+  _buffer.clear   ( );
+  _pending.clear  ( );
+  _pending_index.clear ( );
+}
+
+void
+SKIF_DirectoryChangeWatch::registerNotify (std::wstring_view wstrPath, UITab waitTab, BOOL bWatchSubtree, DWORD dwNotifyFilter)
+{
+  _path    = wstrPath;
+  _subtree = bWatchSubtree;
+  _filter  = dwNotifyFilter;
+
+  _hDirectory =
+    CreateFileW (_path.c_str(), FILE_LIST_DIRECTORY,
+                   FILE_SHARE_READ | FILE_SHARE_WRITE | FILE_SHARE_DELETE, nullptr,
+                     OPEN_EXISTING, FILE_FLAG_BACKUP_SEMANTICS | FILE_FLAG_OVERLAPPED, nullptr);
+
+  if (_hDirectory == INVALID_HANDLE_VALUE)
+    return;
+
+  _overlapped.hEvent =
+    CreateEvent (nullptr, TRUE, FALSE, nullptr);
+
+  // 64 KiB is the most ReadDirectoryChangesW supports over the network
+  _buffer.resize (16384);
+
+  if (_overlapped.hEvent == NULL || ! issueRead ( ))
+  {
+    PLOG_ERROR << "Failed to register for directory change notifications: " << _path;
+    reset ( );
+    return;
+  }
+
+  _waitTab = waitTab;
+
+  SKIF_Util_AddWaitHandle (_overlapped.hEvent, _waitTab);
+}
+
+// Overlapped I/O is cancelled once the thread that issued it exits, and the watches are read and re-armed
+//   from short-lived workers as well (e.g. the library worker), so every read is issued from one thread that never exits
+struct SKIF_DirectoryRead_s {
+  SKIF_DirectoryChangeWatch* watch;
+  BOOL                       result;
+  HANDLE                     hDone;
+};
+
+bool
+SKIF_DirectoryChangeWatch::issueRead (void)
+{
+  static HANDLE hIssuer = (HANDLE)
+  _beginthreadex (nullptr, 0x0, [](void*) -> unsigned
+  {
+    SKIF_Util_SetThreadDescription (GetCurrentThread (), L"SKIF_DirectoryWatchIssuer");
+
+    // The reads are queued as APCs, so only ever wait alertably
+    while (true)
+      SleepEx (INFINITE, TRUE);
+
+    return 0;
+  }, nullptr, 0x0, nullptr);
+
+  SKIF_DirectoryRead_s read = { this, FALSE, NULL };
+
+  auto _Issue = [](ULONG_PTR pRead)
+  {
+    auto* _read  = reinterpret_cast <SKIF_DirectoryRead_s*> (pRead);
+    auto* _watch = _read->watch;
+
+    _read->result =
+      ReadDirectoryChangesW (_watch->_hDirectory, _watch->_buffer.data(), static_cast <DWORD> (_watch->_buffer.size() * sizeof (DWORD)),
+                               _watch->_subtree, _watch->_filter, nullptr, &_watch->_overlapped, nullptr);
+
+    if (_read->hDone != NULL)
+      SetEvent (_read->hDone);
+  };
+
+  read.hDone =
+    CreateEvent (nullptr, FALSE, FALSE, nullptr);
+
+  if (hIssuer != 0 && read.hDone != NULL && QueueUserAPC (_Issue, hIssuer, reinterpret_cast <ULONG_PTR> (&read)))
+    WaitForSingleObject (read.hDone, INFINITE);
+
+  // Should the thread not be available, issue it from this one instead
+  else
+  {
+    PLOG_WARNING << "Issuing the directory change read from the current thread: " << _path;
+
+    if (read.hDone != NULL)
+      CloseHandle (std::exchange (read.hDone, (HANDLE)NULL));
+
+    _Issue (reinterpret_cast <ULONG_PTR> (&read));
+  }
+
+  if (read.hDone != NULL)
+    CloseHandle (read.hDone);
+
+  return read.result;
+}
+
+void
+SKIF_DirectoryChangeWatch::readChanges (void)
+{
+  if (WAIT_OBJECT_0 != WaitForSingleObject (_overlapped.hEvent, 0))
+    return;
+
+  DWORD dwBytes = 0;
+
+  // The folder itself is gone (or otherwise unreachable), so start over the next time around
+  if (! GetOverlappedResult (_hDirectory, &_overlapped, &dwBytes, FALSE))
+  {
+    PLOG_WARNING << "Lost the directory change notifications for " << _path;
+    reset ( );
+    _overflowed = true;
+    return;
+  }
+
+  _lastChange = SKIF_Util_timeGetTime ( );
+
+  // Zero bytes means the changes did not fit in the buffer, so the consumer has to rescan everything
+  if (dwBytes == 0)
+  {
+    _overflowed = true;
+    _pending.clear ( );
+    _pending_index.clear ( );
+  }
+
+  else
+  {
+    std::wstring old_path;
+    BYTE*        pBuffer  = reinterpret_cast <BYTE*> (_buffer.data());
+
+    while (true)
+    {
+      FILE_NOTIFY_INFORMATION* pInfo =
+        reinterpret_cast <FILE_NOTIFY_INFORMATION*> (pBuffer);
+
+      std::wstring path (pInfo->FileName, pInfo->FileNameLength / sizeof (wchar_t));
+
+      switch (pInfo->Action)
+      {
+      case FILE_ACTION_ADDED:
+        record (SKIF_DirectoryChange::Action::Added,    std::move (path));
+        break;
+      case FILE_ACTION_REMOVED:
+        record (SKIF_DirectoryChange::Action::Removed,  std::move (path));
+        break;
+      case FILE_ACTION_MODIFIED:
+        record (SKIF_DirectoryChange::Action::Modified, std::move (path));
+        break;
+      case FILE_ACTION_RENAMED_OLD_NAME:
+        old_path = std::move (path);
+        break;
+      case FILE_ACTION_RENAMED_NEW_NAME:
+        // The old name falls outside of the watched folder when a file is moved in
+        if (old_path.empty())
+          record (SKIF_DirectoryChange::Action::Added,   std::move (path));
+        else
+          record (SKIF_DirectoryChange::Action::Renamed, std::move (path), std::move (old_path));
+        old_path.clear ( );
+        break;
+      }
+
+      if (pInfo->NextEntryOffset == 0)
+        break;
+
+      pBuffer += pInfo->NextEntryOffset;
+    }
+
+    // Moved out of the watched folder
+    if (! old_path.empty())
+      record (SKIF_DirectoryChange::Action::Removed, std::move (old_path));
+  }
+
+  if (! issueRead ( ))
+  {
+    PLOG_WARNING << "Lost the directory change notifications for " << _path;
+    reset ( );
+    _overflowed = true;
+  }
+}
+
+SKIF_DirectoryChange*
+SKIF_DirectoryChangeWatch::findPending (const std::wstring& path)
+{
+  auto entry =
+    _pending_index.find (SKIF_DirectoryChange_Fold (path));
+
+  return (entry != _pending_index.end()) ? &_pending [entry->second] : nullptr;
+}
+
+void
+SKIF_DirectoryChangeWatch::addPending (SKIF_DirectoryChange::Action action, std::wstring path, std::wstring old_path)
+{
+  _pending_index [SKIF_DirectoryChange_Fold (path)] = _pending.size ( );
+  _pending.push_back ({ action, std::move (path), std::move (old_path) });
+}
+
+// Entries are only blanked out, so the rest keep their position in _pending (and their order)
+void
+SKIF_DirectoryChangeWatch::dropPending (SKIF_DirectoryChange* change)
+{
+  _pending_index.erase (SKIF_DirectoryChange_Fold (change->path));
+
+  change->path    .clear ( );
+  change->old_path.clear ( );
+}
+
+// Folds the change into any pending change of the same file, so each file is only reported once
+//   and only with the net effect, e.g. a file that is added and then removed is never reported
+void
+SKIF_DirectoryChangeWatch::record (SKIF_DirectoryChange::Action action, std::wstring path, std::wstring old_path)
+{
+  using Action = SKIF_DirectoryChange::Action;
+
+  if (action == Action::Renamed)
+  {
+    // Whatever was pending for the new name has been replaced
+    if (SKIF_DirectoryChange* existing = findPending (path))
+      dropPending (existing);
+
+    if (SKIF_DirectoryChange* previous = findPending (old_path))
+    {
+      Action       previous_action = previous->action;
+      std::wstring origin          = (previous_action == Action::Renamed) ? previous->old_path : old_path;
+
+      dropPending (previous);
+
+      // Added and then renamed is still just an added file
+      if (previous_action == Action::Added)
+        action = Action::Added, origin.clear ( );
+
+      // Renamed back to where it started
+      else if (_wcsicmp (origin.c_str(), path.c_str()) == 0)
+        action = Action::Modified, origin.clear ( );
+
+      old_path = std::move (origin);
+    }
+
+    addPending (action, std::move (path), std::move (old_path));
+    return;
+  }
+
+  SKIF_DirectoryChange* existing = findPending (path);
+
+  if (existing == nullptr)
+  {
+    addPending (action, std::move (path));
+    return;
+  }
+
+  switch (action)
+  {
+  case Action::Added:
+    // Removed and then added again
+    if (existing->action == Action::Removed)
+      existing->action = Action::Modified;
+    break;
+
+  case Action::Modified:
+    // Added and renamed files are already reported as such, and will be read anyway
+    if (existing->action == Action::Removed)
+      existing->action = Action::Modified;
+    break;
+
+  case Action::Removed:
+    if (existing->action == Action::Added)
+      dropPending (existing);
+
+    // The file is gone under its original name
+    else if (existing->action == Action::Renamed)
+    {
+      std::wstring origin = std::move (existing->old_path);
+
+      dropPending (existing);
+
+      // A new file may have taken the original name in the meantime
+      if (SKIF_DirectoryChange* replaced = findPending (origin))
+      {
+        if (replaced->action == Action::Added)
+          replaced->action = Action::Modified;
+      }
+
+      else
+        addPending (Action::Removed, std::move (origin));
+    }
+
+    else
+      existing->action = Action::Removed;
+    break;
+
+  default: // Renamed has been handled above
+    break;
+  }
+}
+
+SKIF_DirectoryChangeWatch::~SKIF_DirectoryChangeWatch (void)
+{
+  reset ( );
+}
+
+
 // Registry Watch
 
 SKIF_RegistryWatch::SKIF_RegistryWatch ( HKEY hRootKey, const wchar_t* wszSubKey, const wchar_t* wszEventName, BOOL bWatchSubtree, DWORD dwNotifyFilter, UITab waitTab, bool bWOW6432Key, bool bWOW6464Key )